@@ -35,10 +35,15 @@
 #endif
 
 
+//  Count of (k, kP) pairs precomputed in the background for the selected EC-key
+static const size_t SIGN_NONCE_POOL_DEPTH = 8;
+
+
 SessionPkcs12Context::SessionPkcs12Context (void)
     : activeBag(nullptr)
     , ctxHash(nullptr)
     , hashAlgo(HASH_ALG_UNDEFINED)
+    , signCtx(nullptr)
 {
     DEBUG_OUTCON(puts("SessionPkcs12Context::SessionPkcs12Context()"));
     memset(&keyApi, 0, sizeof(CM_KEY_API));
@@ -48,6 +53,26 @@ SessionPkcs12Context::~SessionPkcs12Context (void)
 {
     DEBUG_OUTCON(puts("SessionPkcs12Context::~SessionPkcs12Context()"));
     resetSignLong();
+    resetSignCtx();
+}
+
+const PrivateKeySignCtx* SessionPkcs12Context::getSignCtx (
+        const ByteArray* baKey
+)
+{
+    if (!private_key_sign_ctx_has_key(signCtx, baKey)) {
+        resetSignCtx();
+        if (private_key_sign_ctx_alloc(baKey, SIGN_NONCE_POOL_DEPTH, &signCtx) != RET_OK) {
+            signCtx = nullptr;
+        }
+    }
+    return signCtx;
+}
+
+void SessionPkcs12Context::resetSignCtx (void)
+{
+    private_key_sign_ctx_free(signCtx);
+    signCtx = nullptr;
 }
 
 void SessionPkcs12Context::resetSignLong (void)
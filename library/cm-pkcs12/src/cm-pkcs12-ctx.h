@@ -31,6 +31,7 @@
 
 #include "cm-api.h"
 #include "file-storage.h"
+#include "private-key.h"
 #include "uapkic.h"
 #include "uapki-ns.h"
 
@@ -44,10 +45,15 @@ struct SessionPkcs12Context {
     HashAlg     hashAlgo;
     UapkiNS::AlgorithmIdentifier
                 aidSignAlgo;
+    //  Signing context of the last used key (with the nonce pool for EC-keys)
+    PrivateKeySignCtx*
+                signCtx;
 
     SessionPkcs12Context (void);
     ~SessionPkcs12Context (void);
 
+    const PrivateKeySignCtx* getSignCtx (const ByteArray* baKey);
+    void resetSignCtx (void);
     void resetSignLong (void);
 
 };  //  end struct SessionPkcs12Context
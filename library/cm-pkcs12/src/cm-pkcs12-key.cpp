@@ -48,6 +48,9 @@ using namespace std;
 using namespace UapkiNS;
 
 
+//  Batches of at least this count of hashes are signed in parallel (one worker per CPU)
+static const uint32_t SIGN_PARALLEL_MIN_COUNT = 16;
+
 static const uint8_t DER_ALGOID_ECDSA_P256[] = {
     0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86, 0x48,
     0xCE, 0x3D, 0x03, 0x01, 0x07
@@ -209,12 +212,28 @@ static CM_ERROR cm_key_sign (
     StoreBag* selected_key = storage.selectedKey();
     if (!selected_key) return RET_CM_KEY_NOT_SELECTED;
 
-    const int ret = private_key_sign(
+    if (count < SIGN_PARALLEL_MIN_COUNT) {
+        //  Small batches reuse the key context of the session and its precomputed nonces
+        const PrivateKeySignCtx* sign_ctx = ss_ctx->getSignCtx(selected_key->bagValue());
+        if (sign_ctx) {
+            return private_key_sign_with_ctx(
+                sign_ctx,
+                (const ByteArray**) abaHashes,
+                count,
+                (const char*) signAlgo,
+                (const ByteArray*) baSignAlgoParams,
+                (ByteArray***) abaSignatures
+            );
+        }
+    }
+
+    const int ret = private_key_sign_parallel(
         selected_key->bagValue(),
         (const ByteArray**) abaHashes,
         count,
         (const char*) signAlgo,
         (const ByteArray*) baSignAlgoParams,
+        (count >= SIGN_PARALLEL_MIN_COUNT) ? 0 : 1,
         (ByteArray***) abaSignatures
     );
     return ret;
@@ -302,7 +321,24 @@ static CM_ERROR cm_key_sign_final (
 
     SmartBA sba_hash;
     int ret = hash_final(ss_ctx->ctxHash, &sba_hash);
-    if (ret == RET_OK) {
+    const PrivateKeySignCtx* sign_ctx = (ret == RET_OK) ? ss_ctx->getSignCtx(ss_ctx->activeBag->bagValue()) : nullptr;
+    if (sign_ctx) {
+        const ByteArray* hash = sba_hash.get();
+        ByteArray** signatures = nullptr;
+        ret = private_key_sign_with_ctx(
+            sign_ctx,
+            &hash,
+            1,
+            (const char*)ss_ctx->aidSignAlgo.algorithm.c_str(),
+            ss_ctx->aidSignAlgo.baParameters,
+            &signatures
+        );
+        if (ret == RET_OK) {
+            *baSignature = (CM_BYTEARRAY*)signatures[0];
+        }
+        ::free(signatures);
+    }
+    else if (ret == RET_OK) {
         ret = private_key_sign_single(
             ss_ctx->activeBag->bagValue(),
             (const char*)ss_ctx->aidSignAlgo.algorithm.c_str(),
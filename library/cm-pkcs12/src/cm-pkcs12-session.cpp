@@ -116,6 +116,7 @@ static CM_ERROR cm_session_logout (
     if (!ss_ctx) return RET_CM_NO_SESSION;
 
     ss_ctx->fileStorage.selectKey(nullptr);
+    ss_ctx->resetSignCtx();
     //TODO: fileStorage.reset()
     return RET_OK;
 }   //  cm_session_logout
@@ -350,6 +351,7 @@ static CM_ERROR cm_session_delete_key (
 
     if (storage.selectedKey() == bag_to_del) {
         storage.selectKey(nullptr);
+        ss_ctx->resetSignCtx();
     }
     storage.deleteBag(bag_to_del);
 
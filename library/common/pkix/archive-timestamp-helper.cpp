@@ -46,6 +46,10 @@
 using namespace std;
 
 
+//  Longer items (e.g. CRLs) are hashed at once, not kept for the multi-buffer hashing in calcHash()
+static const size_t ATS_HASH_MULTI_MAX_LEN = 4096;
+
+
 namespace UapkiNS {
 
 namespace Pkcs7 {
@@ -191,6 +195,19 @@ int ArchiveTs3Helper::calcHash (void)
     UapkiNS::SmartBA sba_concatdata;
     size_t len, offset = 0;
 
+    if (!m_PendingItems.items.empty()) {
+        VectorBA vba_hashes(m_PendingItems.items.size());
+        DO(::hash_multi(m_HashAlgo, m_PendingItems.items.data(), m_PendingItems.items.size(), vba_hashes.data()));
+        for (size_t i = 0; i < vba_hashes.size(); i++) {
+            VectorBA& hashes = *m_PendingItems.slots[i].first;
+            hashes[m_PendingItems.slots[i].second] = vba_hashes[i];
+            vba_hashes[i] = nullptr;
+            ba_free(m_PendingItems.items[i]);
+        }
+        m_PendingItems.items.clear();
+        m_PendingItems.slots.clear();
+    }
+
     DO(atshi_builder.init(*m_HashIndAlgorithm));
     for (const auto& it : m_ATSHashIndex.certHashes) {
         DO(atshi_builder.addHashCert(it));
@@ -245,13 +262,24 @@ int ArchiveTs3Helper::hashAndAdd (
     DEBUG_OUTCON(printf("ArchiveTs3Helper::hashAndAdd(), baData, hex: ");  ba_print(stdout, baData));
     if (!baData) return RET_OK;
 
-    ByteArray* ba_hash = nullptr;
-    const int ret = ::hash(m_HashAlgo, baData, &ba_hash);
-    if (ret == RET_OK) {
-        DEBUG_OUTCON(printf("ArchiveTs3Helper::hashAndAdd(), ba_hash, hex: ");  ba_print(stdout, ba_hash));
-        hashes.push_back(ba_hash);
+    if (ba_get_len(baData) > ATS_HASH_MULTI_MAX_LEN) {
+        ByteArray* ba_hash = nullptr;
+        const int ret = ::hash(m_HashAlgo, baData, &ba_hash);
+        if (ret == RET_OK) {
+            DEBUG_OUTCON(printf("ArchiveTs3Helper::hashAndAdd(), ba_hash, hex: ");  ba_print(stdout, ba_hash));
+            hashes.push_back(ba_hash);
+        }
+        return ret;
     }
-    return ret;
+
+    //  The slot is filled by calcHash()
+    ByteArray* ba_item = ba_copy_with_alloc(baData, 0, 0);
+    if (!ba_item) return RET_UAPKI_GENERAL_ERROR;
+
+    m_PendingItems.items.push_back(ba_item);
+    m_PendingItems.slots.push_back(make_pair(&hashes, hashes.size()));
+    hashes.push_back(nullptr);
+    return RET_OK;
 }
 
 
@@ -50,6 +50,12 @@ namespace Pkcs7 {
             VectorBA    crlHashes;
             VectorBA    unsignedAttrHashes;
         }           m_ATSHashIndex;
+        //  Short items hashed all at once by calcHash() and their slots in m_ATSHashIndex
+        struct {
+            VectorBA    items;
+            std::vector<std::pair<VectorBA*, size_t>>
+                        slots;
+        }           m_PendingItems;
         struct {
             SmartBA     contentType;
             SmartBA     hashContent;
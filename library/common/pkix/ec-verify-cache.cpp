@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2021, The UAPKI Project Authors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ec-verify-cache.h"
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace std;
+
+
+namespace UapkiNS {
+
+
+struct EC_VERIFY_CACHE_ENTRY {
+    string  spki;
+    SignAlg keyAlgo;
+    shared_ptr<const EcCtx>
+            ecCtx;
+};
+
+struct EC_VERIFY_CACHE {
+    mutex   mtx;
+    list<EC_VERIFY_CACHE_ENTRY>
+            lru;
+    unordered_map<string, list<EC_VERIFY_CACHE_ENTRY>::iterator>
+            index;
+    unordered_set<size_t>
+            missed;
+    size_t  maxEntries;
+    uint64_t
+            hits;
+    uint64_t
+            misses;
+
+    EC_VERIFY_CACHE (void)
+        : maxEntries(EcVerifyCache::DEFAULT_MAX_ENTRIES)
+        , hits(0)
+        , misses(0)
+    {}
+
+    void trim (void)
+    {
+        while (lru.size() > maxEntries) {
+            index.erase(lru.back().spki);
+            lru.pop_back();
+        }
+    }
+
+};  //  end struct EC_VERIFY_CACHE
+
+static EC_VERIFY_CACHE ec_verify_cache;
+
+
+shared_ptr<const EcCtx> EcVerifyCache::get (
+        const ByteArray* baSpki,
+        SignAlg& keyAlgo,
+        bool* missedBefore
+)
+{
+    if (missedBefore) {
+        *missedBefore = false;
+    }
+    if (!baSpki) return nullptr;
+
+    const string key((const char*)ba_get_buf_const(baSpki), ba_get_len(baSpki));
+    lock_guard<mutex> lock(ec_verify_cache.mtx);
+
+    auto it = ec_verify_cache.index.find(key);
+    if (it == ec_verify_cache.index.end()) {
+        ec_verify_cache.misses++;
+        if (missedBefore) {
+            //  Only key hashes are kept, the set is bounded by MAX_MISSED_KEYS
+            if (ec_verify_cache.missed.size() >= EcVerifyCache::MAX_MISSED_KEYS) {
+                ec_verify_cache.missed.clear();
+            }
+            *missedBefore = !ec_verify_cache.missed.insert(std::hash<string>()(key)).second;
+        }
+        return nullptr;
+    }
+
+    ec_verify_cache.hits++;
+    ec_verify_cache.lru.splice(ec_verify_cache.lru.begin(), ec_verify_cache.lru, it->second);
+    keyAlgo = it->second->keyAlgo;
+    return it->second->ecCtx;
+}
+
+void EcVerifyCache::put (
+        const ByteArray* baSpki,
+        const SignAlg keyAlgo,
+        const shared_ptr<const EcCtx>& ecCtx
+)
+{
+    if (!baSpki || !ecCtx) return;
+
+    const string key((const char*)ba_get_buf_const(baSpki), ba_get_len(baSpki));
+    lock_guard<mutex> lock(ec_verify_cache.mtx);
+
+    if (ec_verify_cache.maxEntries == 0) return;
+
+    auto it = ec_verify_cache.index.find(key);
+    if (it != ec_verify_cache.index.end()) {
+        //  Another thread has already added this key
+        ec_verify_cache.lru.splice(ec_verify_cache.lru.begin(), ec_verify_cache.lru, it->second);
+        return;
+    }
+
+    ec_verify_cache.lru.push_front(EC_VERIFY_CACHE_ENTRY{ key, keyAlgo, ecCtx });
+    ec_verify_cache.index[key] = ec_verify_cache.lru.begin();
+    ec_verify_cache.trim();
+}
+
+void EcVerifyCache::clear (void)
+{
+    lock_guard<mutex> lock(ec_verify_cache.mtx);
+
+    ec_verify_cache.index.clear();
+    ec_verify_cache.lru.clear();
+    ec_verify_cache.missed.clear();
+    ec_verify_cache.hits = 0;
+    ec_verify_cache.misses = 0;
+}
+
+void EcVerifyCache::setMaxEntries (
+        const size_t maxEntries
+)
+{
+    lock_guard<mutex> lock(ec_verify_cache.mtx);
+
+    ec_verify_cache.maxEntries = maxEntries;
+    ec_verify_cache.trim();
+}
+
+EcVerifyCache::Stats EcVerifyCache::getStats (void)
+{
+    lock_guard<mutex> lock(ec_verify_cache.mtx);
+
+    Stats rv_stats;
+    rv_stats.hits = ec_verify_cache.hits;
+    rv_stats.misses = ec_verify_cache.misses;
+    rv_stats.count = ec_verify_cache.lru.size();
+    rv_stats.maxEntries = ec_verify_cache.maxEntries;
+    return rv_stats;
+}
+
+
+}   //  end namespace UapkiNS
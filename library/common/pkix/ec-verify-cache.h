@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, The UAPKI Project Authors.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef UAPKI_EC_VERIFY_CACHE_H
+#define UAPKI_EC_VERIFY_CACHE_H
+
+
+#include "uapkic.h"
+#include "oid-utils.h"
+#include <memory>
+
+
+namespace UapkiNS {
+
+
+//  Bounded LRU of ready-to-verify EcCtx (public key set, comb precomputation for Q),
+//  keyed by encoded SubjectPublicKeyInfo. Cached contexts are immutable and may be
+//  used from several threads at once.
+class EcVerifyCache {
+public:
+    static const size_t DEFAULT_MAX_ENTRIES = 64;
+    static const size_t MAX_MISSED_KEYS = 1024;
+
+    struct Stats {
+        uint64_t    hits;
+        uint64_t    misses;
+        size_t      count;
+        size_t      maxEntries;
+    };
+
+    //  missedBefore (optional) is set when the key is absent from the cache but
+    //  was already looked up recently, i.e. it is worth caching
+    static std::shared_ptr<const EcCtx> get (
+        const ByteArray* baSpki,
+        SignAlg& keyAlgo,
+        bool* missedBefore = nullptr
+    );
+    static void put (
+        const ByteArray* baSpki,
+        const SignAlg keyAlgo,
+        const std::shared_ptr<const EcCtx>& ecCtx
+    );
+    static void clear (void);
+    static void setMaxEntries (
+        const size_t maxEntries
+    );
+    static Stats getStats (void);
+
+};  //  end class EcVerifyCache
+
+
+}   //  end namespace UapkiNS
+
+
+#endif
@@ -39,6 +39,11 @@
 #include "oids.h"
 #include "oid-utils.h"
 #include "uapkif.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 
 #define DEBUG_OUTCON(expression)
@@ -48,6 +53,11 @@
 #endif
 
 
+//  Upper limit of worker-threads for the parallel batch signing
+#define PRIVATE_KEY_SIGN_MAX_THREADS        16
+//  Minimal count of hashes per worker-thread (each worker builds its own key context)
+#define PRIVATE_KEY_SIGN_MIN_PER_THREAD     4
+
 static const char* HEX_DKE_BY_DEFAULT = "A9D6EB45F13C708280C4967B231F5EADF658EBA4C037291D38D96BF025CA4E17"
                                         "F8E9720DC615B43A28975F0BC1DEA36438B564EA2C179FD0123E6DB8FAC57904";
 
@@ -765,32 +775,20 @@ cleanup:
     return ret;
 }
 
-static int private_key_sign_ec(const PrivateKeyInfo_t* privkey, SignAlg sign_alg, HashAlg hash_alg,
-        const ByteArray** hashes, size_t hashes_count, ByteArray** signatures)
+static int private_key_ec_ctx_alloc(const PrivateKeyInfo_t* privkey, bool is_dstu, EcCtx** ec_ctx_out)
 {
     int ret = RET_OK;
     EcCtx* ec_ctx = NULL;
-    ByteArray* r = NULL;
-    ByteArray* s = NULL;
     ByteArray* d = NULL;
     ECPrivateKey_t* ec_key = NULL;
     ByteArray* ec_key_encoded = NULL;
     char* curve_oid = NULL;
-    size_t i;
 
-    if (SIGN_DSTU4145 == sign_alg) {
+    if (is_dstu) {
         DO(dstu4145_params_get_ec(&privkey->privateKeyAlgorithm, &ec_ctx));
         DO(asn_OCTSTRING2ba(&privkey->privateKey, &d));
         DO(ba_swap(d));
         DO(ec_init_sign(ec_ctx, d));
-        for (i = 0; i < hashes_count; i++) {
-            DO(dstu4145_sign(ec_ctx, hashes[i], &r, &s));
-            CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
-            ba_free(r);
-            r = NULL;
-            ba_free(s);
-            s = NULL;
-        }
     }
     else {
         EcParamsId ec_id;
@@ -808,48 +806,67 @@ static int private_key_sign_ec(const PrivateKeyInfo_t* privkey, SignAlg sign_alg
         }
         CHECK_NOT_NULL(ec_ctx = ec_alloc_default(ec_id));
         DO(ec_init_sign(ec_ctx, d));
-
-        for (i = 0; i < hashes_count; i++) {
-            switch(sign_alg) {
-            case SIGN_ECDSA:
-                DO(ecdsa_sign(ec_ctx, hashes[i], &r, &s));
-                DO(pack_ec_signature(r, s, &signatures[i]));
-                break;
-            case SIGN_ECKCDSA:
-                DO(eckcdsa_sign(ec_ctx, hashes[i], hash_alg, &r, &s));
-                CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
-                break;
-            case SIGN_ECGDSA:
-                DO(ecgdsa_sign(ec_ctx, hashes[i], &r, &s));
-                CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
-                break;
-            case SIGN_ECRDSA:
-                DO(ecrdsa_sign(ec_ctx, hashes[i], &r, &s));
-                CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
-                break;
-            case SIGN_SM2DSA:
-                DO(sm2dsa_sign(ec_ctx, hashes[i], &r, &s));
-                DO(pack_ec_signature(r, s, &signatures[i]));
-                break;
-            default:
-                SET_ERROR(RET_CM_UNSUPPORTED_ALG);
-            }
-
-            ba_free(r);
-            r = NULL;
-            ba_free(s);
-            s = NULL;
-        }
     }
 
+    *ec_ctx_out = ec_ctx;
+    ec_ctx = NULL;
+
 cleanup:
     free(curve_oid);
-    ba_free(r);
-    ba_free(s);
     ba_free_private(ec_key_encoded);
     ba_free_private(d);
     asn_free(get_ECPrivateKey_desc(), ec_key);
     ec_free(ec_ctx);
+    return ret;
+}
+
+static int private_key_sign_ec_with_ctx(const EcCtx* ec_ctx, SignAlg sign_alg, HashAlg hash_alg,
+        const ByteArray** hashes, size_t hashes_count, ByteArray** signatures)
+{
+    int ret = RET_OK;
+    ByteArray* r = NULL;
+    ByteArray* s = NULL;
+    size_t i;
+
+    for (i = 0; i < hashes_count; i++) {
+        switch(sign_alg) {
+        case SIGN_DSTU4145:
+            DO(dstu4145_sign(ec_ctx, hashes[i], &r, &s));
+            CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
+            break;
+        case SIGN_ECDSA:
+            DO(ecdsa_sign(ec_ctx, hashes[i], &r, &s));
+            DO(pack_ec_signature(r, s, &signatures[i]));
+            break;
+        case SIGN_ECKCDSA:
+            DO(eckcdsa_sign(ec_ctx, hashes[i], hash_alg, &r, &s));
+            CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
+            break;
+        case SIGN_ECGDSA:
+            DO(ecgdsa_sign(ec_ctx, hashes[i], &r, &s));
+            CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
+            break;
+        case SIGN_ECRDSA:
+            DO(ecrdsa_sign(ec_ctx, hashes[i], &r, &s));
+            CHECK_NOT_NULL(signatures[i] = ba_join(r, s));
+            break;
+        case SIGN_SM2DSA:
+            DO(sm2dsa_sign(ec_ctx, hashes[i], &r, &s));
+            DO(pack_ec_signature(r, s, &signatures[i]));
+            break;
+        default:
+            SET_ERROR(RET_CM_UNSUPPORTED_ALG);
+        }
+
+        ba_free(r);
+        r = NULL;
+        ba_free(s);
+        s = NULL;
+    }
+
+cleanup:
+    ba_free(r);
+    ba_free(s);
     if (ret != RET_OK) {
         for (i = 0; i < hashes_count; i++) {
             ba_free(signatures[i]);
@@ -862,6 +879,22 @@ cleanup:
     return ret;
 }
 
+static int private_key_sign_ec(const PrivateKeyInfo_t* privkey, SignAlg sign_alg, HashAlg hash_alg,
+        const ByteArray** hashes, size_t hashes_count, ByteArray** signatures)
+{
+    int ret = RET_OK;
+    EcCtx* ec_ctx = NULL;
+
+    DO(private_key_ec_ctx_alloc(privkey, (SIGN_DSTU4145 == sign_alg), &ec_ctx));
+    DO(private_key_sign_ec_with_ctx(ec_ctx, sign_alg, hash_alg, hashes, hashes_count, signatures));
+
+cleanup:
+    ec_free(ec_ctx);
+    if (ret == RET_UNSUPPORTED) ret = RET_CM_UNSUPPORTED_ELLIPTIC_CURVE;
+    if (ret == RET_INVALID_EC_PARAMS) ret = RET_CM_INVALID_ELLIPTIC_CURVE;
+    return ret;
+}
+
 static int private_key_sign_rsa(const PrivateKeyInfo_t* rsaprivkey, SignAlg sign_alg, HashAlg hash_alg,
         const ByteArray** hashes, size_t hashes_count, ByteArray** signatures)
 {
@@ -870,6 +903,12 @@ static int private_key_sign_rsa(const PrivateKeyInfo_t* rsaprivkey, SignAlg sign
     RSAPrivateKey_t* privkey = NULL;
     ByteArray* ba_d = NULL;
     ByteArray* ba_n = NULL;
+    ByteArray* ba_e = NULL;
+    ByteArray* ba_p = NULL;
+    ByteArray* ba_q = NULL;
+    ByteArray* ba_dmp1 = NULL;
+    ByteArray* ba_dmq1 = NULL;
+    ByteArray* ba_iqmp = NULL;
     RsaCtx *rsa_ctx = NULL;
     size_t i;
 
@@ -886,6 +925,16 @@ static int private_key_sign_rsa(const PrivateKeyInfo_t* rsaprivkey, SignAlg sign
         DO(rsa_init_sign_pkcs1_v1_5(rsa_ctx, hash_alg, ba_n, ba_d));
     }
 
+    //  Use CRT if the key has valid CRT-parameters, otherwise sign with the exponent d
+    if ((asn_INTEGER2ba(&privkey->publicExponent, &ba_e) == RET_OK)
+        && (asn_INTEGER2ba(&privkey->prime1, &ba_p) == RET_OK)
+        && (asn_INTEGER2ba(&privkey->prime2, &ba_q) == RET_OK)
+        && (asn_INTEGER2ba(&privkey->exponent1, &ba_dmp1) == RET_OK)
+        && (asn_INTEGER2ba(&privkey->exponent2, &ba_dmq1) == RET_OK)
+        && (asn_INTEGER2ba(&privkey->coefficient, &ba_iqmp) == RET_OK)) {
+        rsa_init_crt(rsa_ctx, ba_e, ba_p, ba_q, ba_dmp1, ba_dmq1, ba_iqmp);
+    }
+
     for (i = 0; i < hashes_count; i++) {
         DEBUG_OUTCON(ba_print(stdout, ba_n));
         DO(rsa_sign(rsa_ctx, hashes[i], &signatures[i]));
@@ -894,7 +943,13 @@ static int private_key_sign_rsa(const PrivateKeyInfo_t* rsaprivkey, SignAlg sign
 
 cleanup:
     ba_free(ba_n);
+    ba_free(ba_e);
     ba_free_private(ba_d);
+    ba_free_private(ba_p);
+    ba_free_private(ba_q);
+    ba_free_private(ba_dmp1);
+    ba_free_private(ba_dmq1);
+    ba_free_private(ba_iqmp);
     ba_free_private(encoded_privkey);
     rsa_free(rsa_ctx);
     asn_free(get_RSAPrivateKey_desc(), privkey);
@@ -1012,39 +1067,159 @@ cleanup:
     return ret;
 }
 
-int private_key_sign(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
-        const char* signAlgo, const ByteArray* signAlgoParams, ByteArray*** signatures)
+typedef struct PrivateKeySignShard_st {
+    const PrivateKeyInfo_t* privkey;
+    bool is_ec;
+    SignAlg sign_alg;
+    HashAlg hash_alg;
+    const ByteArray** hashes;
+    size_t hashes_count;
+    ByteArray** signatures;
+    int ret;
+} PrivateKeySignShard;
+
+static void private_key_sign_shard(PrivateKeySignShard* shard)
+{
+    //  Each shard builds its own EcCtx/RsaCtx from the key and writes into its own range of signatures
+    if (shard->is_ec) {
+        shard->ret = private_key_sign_ec(shard->privkey, shard->sign_alg, shard->hash_alg,
+            shard->hashes, shard->hashes_count, shard->signatures);
+    }
+    else {
+        shard->ret = private_key_sign_rsa(shard->privkey, shard->sign_alg, shard->hash_alg,
+            shard->hashes, shard->hashes_count, shard->signatures);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI private_key_sign_thread(LPVOID arg)
+{
+    private_key_sign_shard((PrivateKeySignShard*)arg);
+    return 0;
+}
+#else
+static void* private_key_sign_thread(void* arg)
+{
+    private_key_sign_shard((PrivateKeySignShard*)arg);
+    return NULL;
+}
+#endif
+
+static int private_key_sign_batch(const PrivateKeyInfo_t* privkey, bool is_ec, SignAlg sign_alg, HashAlg hash_alg,
+        const ByteArray** hashes, size_t hashes_count, size_t max_threads, ByteArray** signatures)
+{
+    int ret = RET_OK;
+    PrivateKeySignShard* shards = NULL;
+#ifdef _WIN32
+    HANDLE* threads = NULL;
+#else
+    pthread_t* threads = NULL;
+#endif
+    bool* started = NULL;
+    size_t cnt_threads, i, offset;
+
+    if (max_threads == 0) {
+        max_threads = cpu_count();
+    }
+    cnt_threads = hashes_count / PRIVATE_KEY_SIGN_MIN_PER_THREAD;
+    if (cnt_threads > max_threads) cnt_threads = max_threads;
+    if (cnt_threads > PRIVATE_KEY_SIGN_MAX_THREADS) cnt_threads = PRIVATE_KEY_SIGN_MAX_THREADS;
+    if (cnt_threads < 2) {
+        PrivateKeySignShard shard = { privkey, is_ec, sign_alg, hash_alg, hashes, hashes_count, signatures, RET_OK };
+        private_key_sign_shard(&shard);
+        return shard.ret;
+    }
+
+    CALLOC_CHECKED(shards, sizeof(PrivateKeySignShard) * cnt_threads);
+    CALLOC_CHECKED(threads, sizeof(threads[0]) * cnt_threads);
+    CALLOC_CHECKED(started, sizeof(bool) * cnt_threads);
+
+    //  Contiguous shards: signatures[i] always corresponds to hashes[i]
+    offset = 0;
+    for (i = 0; i < cnt_threads; i++) {
+        const size_t len = hashes_count / cnt_threads + ((i < hashes_count % cnt_threads) ? 1 : 0);
+        shards[i].privkey = privkey;
+        shards[i].is_ec = is_ec;
+        shards[i].sign_alg = sign_alg;
+        shards[i].hash_alg = hash_alg;
+        shards[i].hashes = hashes + offset;
+        shards[i].hashes_count = len;
+        shards[i].signatures = signatures + offset;
+        shards[i].ret = RET_OK;
+        offset += len;
+    }
+
+    //  Shard 0 is signed by the calling thread, if a thread cannot be started its shard is signed here too
+    for (i = 1; i < cnt_threads; i++) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, private_key_sign_thread, &shards[i], 0, NULL);
+        started[i] = (threads[i] != NULL);
+#else
+        started[i] = (pthread_create(&threads[i], NULL, private_key_sign_thread, &shards[i]) == 0);
+#endif
+    }
+
+    private_key_sign_shard(&shards[0]);
+    for (i = 1; i < cnt_threads; i++) {
+        if (started[i]) {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else {
+            private_key_sign_shard(&shards[i]);
+        }
+    }
+
+    for (i = 0; i < cnt_threads; i++) {
+        if (shards[i].ret != RET_OK) {
+            SET_ERROR(shards[i].ret);
+        }
+    }
+
+cleanup:
+    if ((ret != RET_OK) && shards) {
+        for (i = 0; i < hashes_count; i++) {
+            ba_free(signatures[i]);
+            signatures[i] = NULL;
+        }
+    }
+    free(shards);
+    free(threads);
+    free(started);
+    return ret;
+}
+
+static int private_key_sign_prepare(const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, SignAlg* sign_alg, HashAlg* hash_alg)
 {
     int ret = RET_OK;
-    HashAlg hash_alg = HASH_ALG_UNDEFINED;
-    SignAlg sign_alg = SIGN_UNDEFINED;
     size_t i, hash_size;
-    PrivateKeyInfo_t* privkey = NULL;
-    char* key_algo = NULL;
 
-    CHECK_PARAM(key != NULL);
     CHECK_PARAM(hashes != NULL);
     CHECK_PARAM(hashes_count > 0);
     CHECK_PARAM(signAlgo != NULL);
-    CHECK_PARAM(signatures != NULL);
 
-    if ((sign_alg = signature_from_oid(signAlgo)) == SIGN_UNDEFINED) {
+    if ((*sign_alg = signature_from_oid(signAlgo)) == SIGN_UNDEFINED) {
         SET_ERROR(RET_CM_UNSUPPORTED_ALG);
     }
 
-    if (SIGN_RSA_PSS != sign_alg) {
-        if ((hash_alg = hash_from_oid(signAlgo)) == HASH_ALG_UNDEFINED) {
+    if (SIGN_RSA_PSS != *sign_alg) {
+        if ((*hash_alg = hash_from_oid(signAlgo)) == HASH_ALG_UNDEFINED) {
             SET_ERROR(RET_CM_UNSUPPORTED_ALG);
         }
     }
     else {
-        DO(hash_from_rsa_pss(signAlgoParams, &hash_alg));
-        if (hash_alg == HASH_ALG_UNDEFINED) {
+        DO(hash_from_rsa_pss(signAlgoParams, hash_alg));
+        if (*hash_alg == HASH_ALG_UNDEFINED) {
             SET_ERROR(RET_CM_UNSUPPORTED_ALG);
         }
     }
 
-    hash_size = hash_get_size(hash_alg);
+    hash_size = hash_get_size(*hash_alg);
 
     for (i = 0; i < hashes_count; i++) {
         if (ba_get_len(hashes[i]) != hash_size) {
@@ -1052,6 +1227,36 @@ int private_key_sign(const ByteArray* key, const ByteArray** hashes, size_t hash
         }
     }
 
+cleanup:
+    return ret;
+}
+
+static bool private_key_is_ec(const char* key_algo)
+{
+    return oid_is_parent(OID_DSTU4145_WITH_GOST3411, key_algo) ||
+        oid_is_parent(OID_DSTU4145_WITH_DSTU7564, key_algo) ||
+        oid_is_equal(OID_EC_KEY, key_algo) ||
+        oid_is_equal(OID_ECKCDSA, key_algo) ||
+        oid_is_parent(OID_ECGDSA_STD, key_algo) ||
+        oid_is_equal(OID_GOST_KEY_3410_2012_256, key_algo) ||
+        oid_is_equal(OID_GOST_KEY_3410_2012_512, key_algo) ||
+        oid_is_equal(OID_SM2, key_algo);
+}
+
+static int private_key_sign_internal(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, size_t max_threads, ByteArray*** signatures)
+{
+    int ret = RET_OK;
+    HashAlg hash_alg = HASH_ALG_UNDEFINED;
+    SignAlg sign_alg = SIGN_UNDEFINED;
+    PrivateKeyInfo_t* privkey = NULL;
+    char* key_algo = NULL;
+
+    CHECK_PARAM(key != NULL);
+    CHECK_PARAM(signatures != NULL);
+
+    DO(private_key_sign_prepare(hashes, hashes_count, signAlgo, signAlgoParams, &sign_alg, &hash_alg));
+
     CHECK_NOT_NULL(privkey = asn_decode_ba_with_alloc(get_PrivateKeyInfo_desc(), key));
     DO(asn_oid_to_text(&privkey->privateKeyAlgorithm.algorithm, &key_algo));
 
@@ -1061,25 +1266,18 @@ int private_key_sign(const ByteArray* key, const ByteArray** hashes, size_t hash
 
     CALLOC_CHECKED((*signatures), sizeof(ByteArray*) * hashes_count);
 
-    if (oid_is_parent(OID_DSTU4145_WITH_GOST3411, key_algo) ||
-        oid_is_parent(OID_DSTU4145_WITH_DSTU7564, key_algo) ||
-        oid_is_equal(OID_EC_KEY, key_algo) ||
-        oid_is_equal(OID_ECKCDSA, key_algo) ||
-        oid_is_parent(OID_ECGDSA_STD, key_algo) ||
-        oid_is_equal(OID_GOST_KEY_3410_2012_256, key_algo) ||
-        oid_is_equal(OID_GOST_KEY_3410_2012_512, key_algo) ||
-        oid_is_equal(OID_SM2, key_algo)) {
-        ret = private_key_sign_ec(privkey, sign_alg, hash_alg, hashes, hashes_count, *signatures);
+    if (private_key_is_ec(key_algo)) {
+        ret = private_key_sign_batch(privkey, true, sign_alg, hash_alg, hashes, hashes_count, max_threads, *signatures);
     }
     else if (oid_is_equal(OID_RSA, key_algo)) {
-        ret = private_key_sign_rsa(privkey, sign_alg, hash_alg, hashes, hashes_count, *signatures);
+        ret = private_key_sign_batch(privkey, false, sign_alg, hash_alg, hashes, hashes_count, max_threads, *signatures);
     }
     else {
         SET_ERROR(RET_CM_UNSUPPORTED_ALG);
     }
 
 cleanup:
-    if (ret != RET_OK) {
+    if ((ret != RET_OK) && signatures) {
         free(*signatures);
         *signatures = NULL;
     }
@@ -1088,6 +1286,106 @@ cleanup:
     return ret;
 }
 
+int private_key_sign(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, ByteArray*** signatures)
+{
+    return private_key_sign_internal(key, hashes, hashes_count, signAlgo, signAlgoParams, 1, signatures);
+}
+
+//  Batch signing sharded over worker-threads (max_threads == 0: by count of CPUs), order of signatures is preserved
+int private_key_sign_parallel(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, size_t max_threads, ByteArray*** signatures)
+{
+    return private_key_sign_internal(key, hashes, hashes_count, signAlgo, signAlgoParams, max_threads, signatures);
+}
+
+struct PrivateKeySignCtx_st {
+    ByteArray* key;
+    char* key_algo;
+    EcCtx* ec_ctx;      //  NULL for non-EC keys, those are signed by private_key_sign()
+};
+
+int private_key_sign_ctx_alloc(const ByteArray* key, size_t noncePoolDepth, PrivateKeySignCtx** ctx)
+{
+    int ret = RET_OK;
+    PrivateKeySignCtx* sign_ctx = NULL;
+    PrivateKeyInfo_t* privkey = NULL;
+
+    CHECK_PARAM(key != NULL);
+    CHECK_PARAM(ctx != NULL);
+
+    CALLOC_CHECKED(sign_ctx, sizeof(PrivateKeySignCtx));
+    CHECK_NOT_NULL(sign_ctx->key = ba_copy_with_alloc(key, 0, 0));
+    CHECK_NOT_NULL(privkey = asn_decode_ba_with_alloc(get_PrivateKeyInfo_desc(), key));
+    DO(asn_oid_to_text(&privkey->privateKeyAlgorithm.algorithm, &sign_ctx->key_algo));
+
+    if (private_key_is_ec(sign_ctx->key_algo)) {
+        const bool is_dstu = oid_is_parent(OID_DSTU4145_WITH_GOST3411, sign_ctx->key_algo) ||
+            oid_is_parent(OID_DSTU4145_WITH_DSTU7564, sign_ctx->key_algo);
+        DO(private_key_ec_ctx_alloc(privkey, is_dstu, &sign_ctx->ec_ctx));
+        if (noncePoolDepth > 0) {
+            //  Without the pool nonces are generated on demand
+            (void)ec_set_nonce_pool(sign_ctx->ec_ctx, noncePoolDepth, noncePoolDepth / 4);
+        }
+    }
+
+    *ctx = sign_ctx;
+    sign_ctx = NULL;
+
+cleanup:
+    asn_free(get_PrivateKeyInfo_desc(), privkey);
+    private_key_sign_ctx_free(sign_ctx);
+    if (ret == RET_UNSUPPORTED) ret = RET_CM_UNSUPPORTED_ELLIPTIC_CURVE;
+    if (ret == RET_INVALID_EC_PARAMS) ret = RET_CM_INVALID_ELLIPTIC_CURVE;
+    return ret;
+}
+
+bool private_key_sign_ctx_has_key(const PrivateKeySignCtx* ctx, const ByteArray* key)
+{
+    return (ctx != NULL) && (ba_cmp(ctx->key, key) == 0);
+}
+
+int private_key_sign_with_ctx(const PrivateKeySignCtx* ctx, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, ByteArray*** signatures)
+{
+    int ret = RET_OK;
+    HashAlg hash_alg = HASH_ALG_UNDEFINED;
+    SignAlg sign_alg = SIGN_UNDEFINED;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(signatures != NULL);
+
+    if (ctx->ec_ctx == NULL) {
+        return private_key_sign(ctx->key, hashes, hashes_count, signAlgo, signAlgoParams, signatures);
+    }
+
+    DO(private_key_sign_prepare(hashes, hashes_count, signAlgo, signAlgoParams, &sign_alg, &hash_alg));
+
+    if (!private_key_check_algo(ctx->key_algo, sign_alg)) {
+        SET_ERROR(RET_CM_INVALID_KEY);
+    }
+
+    CALLOC_CHECKED((*signatures), sizeof(ByteArray*) * hashes_count);
+    DO(private_key_sign_ec_with_ctx(ctx->ec_ctx, sign_alg, hash_alg, hashes, hashes_count, *signatures));
+
+cleanup:
+    if ((ret != RET_OK) && signatures) {
+        free(*signatures);
+        *signatures = NULL;
+    }
+    return ret;
+}
+
+void private_key_sign_ctx_free(PrivateKeySignCtx* ctx)
+{
+    if (ctx) {
+        ba_free_private(ctx->key);
+        free(ctx->key_algo);
+        ec_free(ctx->ec_ctx);
+        free(ctx);
+    }
+}
+
 int private_key_ecdh(const bool withCofactor, const ByteArray* baSenderKey,
         const ByteArray* baRecipientSpki, ByteArray** baCommonSecret)
 {
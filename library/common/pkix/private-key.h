@@ -50,6 +50,18 @@ int private_key_sign_single(const ByteArray* key, const char* signAlgo, const By
         const ByteArray* hash, ByteArray** signature);
 int private_key_sign(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
         const char* signAlgo, const ByteArray* signAlgoParams, ByteArray*** signatures);
+int private_key_sign_parallel(const ByteArray* key, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, size_t max_threads, ByteArray*** signatures);
+
+//  Signing context of one key, keeps the prepared EcCtx (and its nonce pool) between calls
+typedef struct PrivateKeySignCtx_st PrivateKeySignCtx;
+
+int private_key_sign_ctx_alloc(const ByteArray* key, size_t noncePoolDepth, PrivateKeySignCtx** ctx);
+bool private_key_sign_ctx_has_key(const PrivateKeySignCtx* ctx, const ByteArray* key);
+int private_key_sign_with_ctx(const PrivateKeySignCtx* ctx, const ByteArray** hashes, size_t hashes_count,
+        const char* signAlgo, const ByteArray* signAlgoParams, ByteArray*** signatures);
+void private_key_sign_ctx_free(PrivateKeySignCtx* ctx);
+
 int private_key_ecdh(const bool withCofactor, const ByteArray* baSenderKey,
         const ByteArray* baRecipientSpki, ByteArray** baCommonSecret);
 
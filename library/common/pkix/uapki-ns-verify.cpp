@@ -29,17 +29,24 @@
 
 #include "uapki-ns-verify.h"
 #include "dstu4145-params.h"
+#include "ec-verify-cache.h"
 #include "ecdsa-params.h"
 #include "macros-internal.h"
 #include "oid-utils.h"
 #include "uapkif.h"
 #include "uapki-errors.h"
 #include "uapki-ns-util.h"
+#include <map>
 
 
 namespace UapkiNS {
 
 
+static void ec_free_const (const EcCtx* ecCtx)
+{
+    ec_free((EcCtx*)ecCtx);
+}
+
 static int parse_dstu_signvalue (const ByteArray* baSignature, ByteArray** baR, ByteArray** baS)
 {
     int ret = RET_OK;
@@ -114,21 +121,18 @@ cleanup:
     return ret;
 }
 
-int Verify::verifyEcSign (
+static int init_ec_verify_ctx (
         const SignAlg signAlgo,
         const EcParamsId ecParamId,
         const ByteArray* baPubkey,
-        const ByteArray* baHash,
-        const ByteArray* baSignValue
+        EcCtx** ecCtx
 )
 {
     int ret = RET_OK;
     EcCtx* ec_ctx = nullptr;
-    SmartBA sba_Qx, sba_Qy, sba_r, sba_s;
+    SmartBA sba_Qx, sba_Qy;
 
     CHECK_NOT_NULL(baPubkey);
-    CHECK_NOT_NULL(baHash);
-    CHECK_NOT_NULL(baSignValue);
 
     CHECK_NOT_NULL(ec_ctx = ec_alloc_default(ecParamId));
     switch (signAlgo)
@@ -137,21 +141,177 @@ int Verify::verifyEcSign (
         DO(dstu4145_decompress_pubkey(ec_ctx, baPubkey, &sba_Qx, &sba_Qy));
         DO(ba_swap(sba_Qx.get()));
         DO(ba_swap(sba_Qy.get()));
-        DO(parse_dstu_signvalue(baSignValue, &sba_r, &sba_s));
-        DO(ec_init_verify(ec_ctx, sba_Qx.get(), sba_Qy.get()));
-        DO(dstu4145_verify(ec_ctx, baHash, sba_r.get(), sba_s.get()));
         break;
     case SIGN_ECDSA:
         DO(parse_ecdsa_pubkey(baPubkey, &sba_Qx, &sba_Qy));
+        break;
+    default:
+        SET_ERROR(RET_UNSUPPORTED);
+        break;
+    }
+    DO(ec_init_verify(ec_ctx, sba_Qx.get(), sba_Qy.get()));
+
+    *ecCtx = ec_ctx;
+    ec_ctx = nullptr;
+
+cleanup:
+    ec_free(ec_ctx);
+    return ret;
+}
+
+static int verify_ec_sign (
+        const SignAlg signAlgo,
+        const EcCtx* ecCtx,
+        const ByteArray* baHash,
+        const ByteArray* baSignValue
+)
+{
+    int ret = RET_OK;
+    SmartBA sba_r, sba_s;
+
+    CHECK_NOT_NULL(baHash);
+    CHECK_NOT_NULL(baSignValue);
+
+    switch (signAlgo)
+    {
+    case SIGN_DSTU4145:
+        DO(parse_dstu_signvalue(baSignValue, &sba_r, &sba_s));
+        DO(dstu4145_verify(ecCtx, baHash, sba_r.get(), sba_s.get()));
+        break;
+    case SIGN_ECDSA:
         DO(parse_ecdsa_signvalue(baSignValue, &sba_r, &sba_s));
-        DO(ec_init_verify(ec_ctx, sba_Qx.get(), sba_Qy.get()));
-        DO(ecdsa_verify(ec_ctx, baHash, sba_r.get(), sba_s.get()));
+        DO(ecdsa_verify(ecCtx, baHash, sba_r.get(), sba_s.get()));
         break;
     default:
         SET_ERROR(RET_UNSUPPORTED);
         break;
     }
 
+cleanup:
+    return ret;
+}
+
+int Verify::verifyEcSign (
+        const SignAlg signAlgo,
+        const EcParamsId ecParamId,
+        const ByteArray* baPubkey,
+        const ByteArray* baHash,
+        const ByteArray* baSignValue
+)
+{
+    int ret = RET_OK;
+    EcCtx* ec_ctx = nullptr;
+
+    CHECK_NOT_NULL(baPubkey);
+    CHECK_NOT_NULL(baHash);
+    CHECK_NOT_NULL(baSignValue);
+
+    DO(init_ec_verify_ctx(signAlgo, ecParamId, baPubkey, &ec_ctx));
+    DO(verify_ec_sign(signAlgo, ec_ctx, baHash, baSignValue));
+
+cleanup:
+    ec_free(ec_ctx);
+    return ret;
+}
+
+int Verify::verifyEcSignBatch (
+        const SignAlg signAlgo,
+        const EcParamsId ecParamId,
+        const std::vector<const ByteArray*>& baPubkeys,
+        const std::vector<const ByteArray*>& baHashes,
+        const std::vector<const ByteArray*>& baSignValues,
+        std::vector<int>& results
+)
+{
+    int ret = RET_OK;
+    EcCtx* ec_ctx = nullptr;
+    const size_t count = baPubkeys.size();
+    VectorBA vba_Qx, vba_Qy, vba_r, vba_s;
+    std::vector<const ByteArray*> hashes;
+    std::vector<size_t> indexes;
+    std::vector<int> batch_results;
+    bool all_ok = true;
+
+    CHECK_PARAM(baHashes.size() == count);
+    CHECK_PARAM(baSignValues.size() == count);
+    if ((signAlgo != SIGN_DSTU4145) && (signAlgo != SIGN_ECDSA)) {
+        SET_ERROR(RET_UNSUPPORTED);
+    }
+
+    results.assign(count, RET_OK);
+    CHECK_NOT_NULL(ec_ctx = ec_alloc_default(ecParamId));
+
+    //  Items with malformed pubkey or signature are rejected before the batch
+    for (size_t i = 0; i < count; i++) {
+        int item_ret = RET_OK;
+        SmartBA sba_Qx, sba_Qy, sba_r, sba_s;
+
+        if (!baPubkeys[i] || !baHashes[i] || !baSignValues[i]) {
+            results[i] = RET_INVALID_PARAM;
+            continue;
+        }
+
+        if (signAlgo == SIGN_DSTU4145) {
+            item_ret = dstu4145_decompress_pubkey(ec_ctx, baPubkeys[i], &sba_Qx, &sba_Qy);
+            if (item_ret == RET_OK) {
+                ba_swap(sba_Qx.get());
+                ba_swap(sba_Qy.get());
+                item_ret = parse_dstu_signvalue(baSignValues[i], &sba_r, &sba_s);
+            }
+        }
+        else {
+            item_ret = parse_ecdsa_pubkey(baPubkeys[i], &sba_Qx, &sba_Qy);
+            if (item_ret == RET_OK) {
+                item_ret = parse_ecdsa_signvalue(baSignValues[i], &sba_r, &sba_s);
+            }
+        }
+
+        results[i] = item_ret;
+        if (item_ret == RET_OK) {
+            vba_Qx.push_back(sba_Qx.pop());
+            vba_Qy.push_back(sba_Qy.pop());
+            vba_r.push_back(sba_r.pop());
+            vba_s.push_back(sba_s.pop());
+            hashes.push_back(baHashes[i]);
+            indexes.push_back(i);
+        }
+    }
+
+    if (!indexes.empty()) {
+        int batch_ret;
+        batch_results.resize(indexes.size());
+        if (signAlgo == SIGN_DSTU4145) {
+            batch_ret = dstu4145_verify_batch(ec_ctx, indexes.size(), vba_Qx.data(), vba_Qy.data(),
+                hashes.data(), vba_r.data(), vba_s.data(), batch_results.data());
+        }
+        else {
+            batch_ret = ecdsa_verify_batch(ec_ctx, indexes.size(), vba_Qx.data(), vba_Qy.data(),
+                hashes.data(), vba_r.data(), vba_s.data(), batch_results.data());
+        }
+
+        if ((batch_ret == RET_OK) || (batch_ret == RET_VERIFY_FAILED)) {
+            for (size_t j = 0; j < indexes.size(); j++) {
+                results[indexes[j]] = batch_results[j];
+            }
+        }
+        else {
+            //  Batch failed as a whole - verify each signature separately
+            for (size_t j = 0; j < indexes.size(); j++) {
+                const size_t i = indexes[j];
+                results[i] = verifyEcSign(signAlgo, ecParamId, baPubkeys[i], baHashes[i], baSignValues[i]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (results[i] != RET_OK) {
+            all_ok = false;
+        }
+    }
+    if (!all_ok) {
+        ret = RET_VERIFY_FAILED;
+    }
+
 cleanup:
     ec_free(ec_ctx);
     return ret;
@@ -304,6 +464,122 @@ cleanup:
     return ret;
 }
 
+static int get_verify_hash (
+        const HashAlg hashAlgo,
+        const ByteArray* baData,
+        const bool isHash,
+        ByteArray** baHash,
+        const ByteArray** refHash
+)
+{
+    int ret = RET_OK;
+
+    if (!isHash) {
+        DO(hash(hashAlgo, baData, baHash));
+        *refHash = *baHash;
+    }
+    else {
+        if (hash_get_size(hashAlgo) != ba_get_len(baData)) {
+            SET_ERROR(RET_UAPKI_INVALID_HASH_SIZE);
+        }
+        *refHash = baData;
+    }
+
+cleanup:
+    return ret;
+}
+
+static int verify_ec_sign_with_new_ctx (
+        const SignAlg signAlgo,
+        const EcParamsId ecParamId,
+        const ByteArray* baPubkey,
+        const ByteArray* baSignerSPKI,
+        const ByteArray* baHash,
+        const ByteArray* baSignValue
+)
+{
+    int ret = RET_OK;
+    EcCtx* new_ctx = nullptr;
+    std::shared_ptr<const EcCtx> ec_ctx;
+
+    DO(init_ec_verify_ctx(signAlgo, ecParamId, baPubkey, &new_ctx));
+    ec_ctx = std::shared_ptr<const EcCtx>(new_ctx, ec_free_const);
+    //  Comb precomputation for Q pays off after a few verifications with the same key,
+    //  the shared curve parameters are left as they are
+    if (ec_set_opt_level(new_ctx, OPT_LEVEL_VERIFY_COMB_5) != RET_OK) {
+        //  Verify with a plain context and leave the key uncached
+        ec_ctx.reset();
+        DO(Verify::verifyEcSign(signAlgo, ecParamId, baPubkey, baHash, baSignValue));
+        goto cleanup;
+    }
+    EcVerifyCache::put(baSignerSPKI, signAlgo, ec_ctx);
+    DO(verify_ec_sign(signAlgo, ec_ctx.get(), baHash, baSignValue));
+
+cleanup:
+    return ret;
+}
+
+//  Verifies the signature at once if it is not a batch candidate (not EC, the key is cached
+//  or was seen recently), otherwise parses the key and sets toBatch
+static int verify_or_prepare_ec_item (
+        const Verify::SignatureItem& item,
+        bool& toBatch,
+        SignAlg& signAlgo,
+        EcParamsId& ecParamId,
+        ByteArray** baHash,
+        const ByteArray** refHash,
+        ByteArray** baPubkey
+)
+{
+    int ret = RET_OK;
+    SmartBA sba_pubkey_rsae;
+    HashAlg hash_algo = HASH_ALG_UNDEFINED;
+    SignAlg key_algo = SIGN_UNDEFINED;
+    bool missed_before = false;
+    std::shared_ptr<const EcCtx> ec_ctx;
+
+    toBatch = false;
+    CHECK_PARAM(item.signAlgo != NULL);
+    CHECK_PARAM(item.baData != NULL);
+    CHECK_PARAM(item.baSignerSPKI != NULL);
+    CHECK_PARAM(item.baSignValue != NULL);
+
+    hash_algo = hash_from_oid(item.signAlgo);
+    signAlgo = signature_from_oid(item.signAlgo);
+    if ((hash_algo == HASH_ALG_UNDEFINED) || (signAlgo == SIGN_UNDEFINED)) {
+        SET_ERROR(RET_UAPKI_UNSUPPORTED_ALG);
+    }
+    if ((signAlgo != SIGN_DSTU4145) && (signAlgo != SIGN_ECDSA)) {
+        ret = Verify::verifySignature(item.signAlgo, item.baData, item.isHash, item.baSignerSPKI, item.baSignValue);
+        goto cleanup;
+    }
+
+    DO(get_verify_hash(hash_algo, item.baData, item.isHash, baHash, refHash));
+
+    ec_ctx = EcVerifyCache::get(item.baSignerSPKI, key_algo, &missed_before);
+    if (ec_ctx) {
+        if (key_algo != signAlgo) {
+            SET_ERROR(RET_UAPKI_INVALID_PARAMETER);
+        }
+        DO(verify_ec_sign(signAlgo, ec_ctx.get(), *refHash, item.baSignValue));
+        goto cleanup;
+    }
+
+    DO(Verify::parseSpki(item.baSignerSPKI, &key_algo, &ecParamId, baPubkey, &sba_pubkey_rsae));
+    if (key_algo != signAlgo) {
+        SET_ERROR(RET_UAPKI_INVALID_PARAMETER);
+    }
+    if (missed_before) {
+        //  The key is used repeatedly - its context is built and cached
+        DO(verify_ec_sign_with_new_ctx(signAlgo, ecParamId, *baPubkey, item.baSignerSPKI, *refHash, item.baSignValue));
+        goto cleanup;
+    }
+    toBatch = true;
+
+cleanup:
+    return ret;
+}
+
 int Verify::verifySignature (
         const char* signAlgo,
         const ByteArray* baData,
@@ -313,12 +589,14 @@ int Verify::verifySignature (
 )
 {
     int ret = RET_OK;
-    const ByteArray* ref_ba;
+    const ByteArray* ref_ba = nullptr;
     SmartBA sba_hash, sba_pubkey, sba_pubkey_rsae;
     HashAlg hash_algo = HASH_ALG_UNDEFINED;
     SignAlg key_algo = SIGN_UNDEFINED;
     SignAlg sign_algo = SIGN_UNDEFINED;
     EcParamsId ec_paramsid = EC_PARAMS_ID_UNDEFINED;
+    bool missed_before = false;
+    std::shared_ptr<const EcCtx> ec_ctx;
 
     CHECK_PARAM(signAlgo != NULL);
     CHECK_PARAM(baData != NULL);
@@ -331,15 +609,18 @@ int Verify::verifySignature (
         SET_ERROR(RET_UAPKI_UNSUPPORTED_ALG);
     }
 
-    if (!isHash) {
-        DO(hash(hash_algo, baData, &sba_hash));
-        ref_ba = sba_hash.get();
-    }
-    else {
-        if (hash_get_size(hash_algo) != ba_get_len(baData)) {
-            SET_ERROR(RET_UAPKI_INVALID_HASH_SIZE);
+    DO(get_verify_hash(hash_algo, baData, isHash, &sba_hash, &ref_ba));
+
+    if ((sign_algo == SIGN_DSTU4145) || (sign_algo == SIGN_ECDSA)) {
+        //  Ready-to-verify context for the same SPKI is taken from the cache
+        ec_ctx = EcVerifyCache::get(baSignerSPKI, key_algo, &missed_before);
+        if (ec_ctx) {
+            if (key_algo != sign_algo) {
+                SET_ERROR(RET_UAPKI_INVALID_PARAMETER);
+            }
+            DO(verify_ec_sign(sign_algo, ec_ctx.get(), ref_ba, baSignValue));
+            goto cleanup;
         }
-        ref_ba = baData;
     }
 
     DO(parseSpki(baSignerSPKI, &key_algo, &ec_paramsid, &sba_pubkey, &sba_pubkey_rsae));
@@ -348,10 +629,14 @@ int Verify::verifySignature (
     }
     switch (sign_algo) {
     case SIGN_DSTU4145:
-        DO(verifyEcSign(sign_algo, ec_paramsid, sba_pubkey.get(), ref_ba, baSignValue));
-        break;
     case SIGN_ECDSA:
-        DO(verifyEcSign(sign_algo, ec_paramsid, sba_pubkey.get(), ref_ba, baSignValue));
+        if (missed_before) {
+            //  The key is used repeatedly - its context is built and cached
+            DO(verify_ec_sign_with_new_ctx(sign_algo, ec_paramsid, sba_pubkey.get(), baSignerSPKI, ref_ba, baSignValue));
+        }
+        else {
+            DO(verifyEcSign(sign_algo, ec_paramsid, sba_pubkey.get(), ref_ba, baSignValue));
+        }
         break;
     case SIGN_RSA_PKCS_1_5:
         DO(verifyRsaV15Sign(hash_algo, sba_pubkey.get(), sba_pubkey_rsae.get(), ref_ba, baSignValue));
@@ -365,5 +650,66 @@ cleanup:
     return ret;
 }
 
+int Verify::verifySignatures (
+        const std::vector<SignatureItem>& items,
+        std::vector<int>& results
+)
+{
+    typedef std::pair<SignAlg, EcParamsId> EcBatchKey;
+    VectorBA vba_hashes(items.size()), vba_pubkeys(items.size());
+    std::vector<const ByteArray*> ref_hashes(items.size(), nullptr);
+    std::map<EcBatchKey, std::vector<size_t>> ec_batches;
+
+    results.assign(items.size(), RET_OK);
+
+    for (size_t i = 0; i < items.size(); i++) {
+        bool to_batch = false;
+        SignAlg sign_algo = SIGN_UNDEFINED;
+        EcParamsId ec_paramsid = EC_PARAMS_ID_UNDEFINED;
+
+        results[i] = verify_or_prepare_ec_item(
+            items[i],
+            to_batch,
+            sign_algo,
+            ec_paramsid,
+            &vba_hashes[i],
+            &ref_hashes[i],
+            &vba_pubkeys[i]
+        );
+        if (to_batch) {
+            ec_batches[EcBatchKey(sign_algo, ec_paramsid)].push_back(i);
+        }
+    }
+
+    //  Keys met for the first time are verified together, one batch per curve
+    for (const auto& it : ec_batches) {
+        const std::vector<size_t>& indexes = it.second;
+        std::vector<const ByteArray*> pubkeys, hashes, signvalues;
+        std::vector<int> batch_results;
+        int ret_batch;
+
+        for (const size_t i : indexes) {
+            pubkeys.push_back(vba_pubkeys[i]);
+            hashes.push_back(ref_hashes[i]);
+            signvalues.push_back(items[i].baSignValue);
+        }
+
+        ret_batch = verifyEcSignBatch(it.first.first, it.first.second, pubkeys, hashes, signvalues, batch_results);
+        if ((ret_batch == RET_OK) || (ret_batch == RET_VERIFY_FAILED)) {
+            for (size_t j = 0; j < indexes.size(); j++) {
+                results[indexes[j]] = batch_results[j];
+            }
+        }
+        else {
+            for (const size_t i : indexes) {
+                const SignatureItem& item = items[i];
+                results[i] = verifySignature(item.signAlgo, item.baData, item.isHash, item.baSignerSPKI, item.baSignValue);
+            }
+        }
+    }
+
+    return RET_OK;
+}
+
 
 }   //  end namespace UapkiNS
@@ -29,6 +29,7 @@
 #define UAPKI_NS_VERIFY_H
 
 
+#include <vector>
 #include "uapkic.h"
 #include "oid-utils.h"
 
@@ -38,6 +39,15 @@ namespace UapkiNS {
 namespace Verify {
 
 
+struct SignatureItem {
+    const char*         signAlgo;
+    const ByteArray*    baData;
+    bool                isHash;
+    const ByteArray*    baSignerSPKI;
+    const ByteArray*    baSignValue;
+};  //  end struct SignatureItem
+
+
 int parseSpki (
     const ByteArray* baSignerSPKI,
     SignAlg* keyAlgo,
@@ -52,6 +62,14 @@ int verifyEcSign (
     const ByteArray* baHash,
     const ByteArray* baSignValue
 );
+int verifyEcSignBatch (
+    const SignAlg signAlgo,
+    const EcParamsId ecParamId,
+    const std::vector<const ByteArray*>& baPubkeys,
+    const std::vector<const ByteArray*>& baHashes,
+    const std::vector<const ByteArray*>& baSignValues,
+    std::vector<int>& results
+);
 int verifyRsaV15Sign (
     const HashAlg hashAlgo,
     const ByteArray* baPubkeyN,
@@ -66,6 +84,12 @@ int verifySignature (
     const ByteArray* baSignerSPKI,
     const ByteArray* baSignValue
 );
+//  Verifies several signatures, results[i] is the code verifySignature() returns for items[i].
+//  EC signatures with keys that are not cached are checked in one batch per curve.
+int verifySignatures (
+    const std::vector<SignatureItem>& items,
+    std::vector<int>& results
+);
 
 
 }   //  end namespace Verify
@@ -97,6 +97,9 @@ int uapki_encrypt (JSON_Object* joParams, JSON_Object* joResult);
 int uapki_random_bytes (JSON_Object* joParams, JSON_Object* joResult);
 int uapki_cert_status_by_ocsp (JSON_Object* joParams, JSON_Object* joResult);
 
+//  Out CPU-features and selected implementations of crypto-primitives (for VERSION and INIT)
+int uapki_cpu_info (JSON_Object* joResult);
+
 #ifdef API_JSON_INTERNAL_CUSTOM
   API_JSON_INTERNAL_CUSTOM
 #endif
@@ -28,6 +28,7 @@
 #define FILE_MARKER "uapki/api/library-deinit.cpp"
 
 #include "api-json-internal.h"
+#include "ec-verify-cache.h"
 #include "global-objects.h"
 #include "http-helper.h"
 
@@ -44,6 +45,7 @@ int uapki_deinit (JSON_Object* joParams, JSON_Object* joResult)
     CmProviders::deinit();
     release_stores();
     HttpHelper::deinit();
+    EcVerifyCache::clear();
 
     return RET_OK;
 }
@@ -28,6 +28,7 @@
 #define FILE_MARKER "uapki/api/library-init.cpp"
 
 #include "api-json-internal.h"
+#include "ec-verify-cache.h"
 #include "global-objects.h"
 #include "http-helper.h"
 #include "ocsp-helper.h"
@@ -223,6 +224,9 @@ int uapki_init (JSON_Object* joParams, JSON_Object* joResult)
 
     if (lib_config->isInitialized()) return RET_UAPKI_ALREADY_INITIALIZED;
 
+    //  Force generic (portable) implementations of crypto-primitives, e.g. for testing
+    cpu_features_set_mask(ParsonHelper::jsonObjectGetBoolean(joParams, "forceGenericCrypto", false) ? 0 : CPU_FEATURES_ALL);
+
     DO(uapkic_init(nullptr, p_selftest_status));
 
     if (!fn_config.empty()) {
@@ -302,12 +306,15 @@ int uapki_init (JSON_Object* joParams, JSON_Object* joResult)
 
     DO_JSON(ParsonHelper::jsonObjectSetBoolean(joResult, "validationByCrl", lib_config->getValidationByCrl()));
 
+    DO(uapki_cpu_info(joResult));
+
 cleanup:
     if (ret != RET_OK) {
         release_config();
         CmProviders::deinit();
         release_stores();
         HttpHelper::deinit();
+        EcVerifyCache::clear();
     }
 
     return ret;
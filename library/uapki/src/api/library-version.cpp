@@ -28,6 +28,8 @@
 #define FILE_MARKER "uapki/api/library-version.cpp"
 
 #include "api-json-internal.h"
+#include "ec-verify-cache.h"
+#include "parson-helper.h"
 #include "uapkic.h"
 #include "uapkif.h"
 #include <string>
@@ -44,12 +46,62 @@ static const char* LIB_NAME = "UAPKI";
 
 
 using namespace std;
+using namespace UapkiNS;
 
 
 static string versionToStr (uint32_t version) {
     return to_string(version / 1000) + "." + to_string((version / 100) % 10) + "." + to_string(version % 100);
 }
 
+int uapki_cpu_info (JSON_Object* joResult)
+{
+    int ret = RET_OK;
+    const uint32_t features = cpu_features_get();
+    JSON_Object* jo_cpu = nullptr;
+    JSON_Object* jo_impls = nullptr;
+    JSON_Array* ja_features = nullptr;
+
+    DO_JSON(json_object_set_value(joResult, "cpu", json_value_init_object()));
+    jo_cpu = json_object_get_object(joResult, "cpu");
+
+    DO_JSON(json_object_set_value(jo_cpu, "features", json_value_init_array()));
+    ja_features = json_object_get_array(jo_cpu, "features");
+    for (uint32_t bit = 1; (bit & CPU_FEATURES_ALL) != 0; bit <<= 1) {
+        const char* s_name = cpu_feature_name(bit);
+        if (s_name && (features & bit)) {
+            DO_JSON(json_array_append_string(ja_features, s_name));
+        }
+    }
+
+    DO_JSON(json_object_set_value(jo_cpu, "implementations", json_value_init_object()));
+    jo_impls = json_object_get_object(jo_cpu, "implementations");
+    for (int i = 0; i < (int)CPU_PRIMITIVE_COUNT; i++) {
+        const CpuPrimitive primitive = (CpuPrimitive)i;
+        DO_JSON(json_object_set_string(jo_impls, cpu_primitive_name(primitive), cpu_primitive_impl(primitive)));
+    }
+
+cleanup:
+    return ret;
+}
+
+static int ec_verify_cache_info (JSON_Object* joResult)
+{
+    int ret = RET_OK;
+    const EcVerifyCache::Stats stats = EcVerifyCache::getStats();
+    JSON_Object* jo_cache = nullptr;
+
+    DO_JSON(json_object_set_value(joResult, "ecVerifyCache", json_value_init_object()));
+    jo_cache = json_object_get_object(joResult, "ecVerifyCache");
+
+    DO_JSON(ParsonHelper::jsonObjectSetUint64(jo_cache, "hits", stats.hits));
+    DO_JSON(ParsonHelper::jsonObjectSetUint64(jo_cache, "misses", stats.misses));
+    DO_JSON(ParsonHelper::jsonObjectSetUint32(jo_cache, "count", (uint32_t)stats.count));
+    DO_JSON(ParsonHelper::jsonObjectSetUint32(jo_cache, "maxEntries", (uint32_t)stats.maxEntries));
+
+cleanup:
+    return ret;
+}
+
 int uapki_version (JSON_Object* joParams, JSON_Object* joResult)
 {
     (void)joParams;
@@ -59,6 +111,8 @@ int uapki_version (JSON_Object* joParams, JSON_Object* joResult)
     DO_JSON(json_object_set_string(joResult, "version", STR_FILEVERSION));
     DO_JSON(json_object_set_string(joResult, "uapkicVersion", versionToStr(UAPKIC_VERSION).c_str()));
     DO_JSON(json_object_set_string(joResult, "uapkifVersion", versionToStr(UAPKIF_VERSION).c_str()));
+    DO(uapki_cpu_info(joResult));
+    DO(ec_verify_cache_info(joResult));
 
 cleanup:
     return ret;
@@ -204,6 +204,61 @@ cleanup:
     return ret;
 }   //  parse_doc_from_json
 
+static int digest_contents (
+        vector<Doc::Sign::SigningDoc>& signingDocs,
+        const HashAlg hashAlgo
+)
+{
+    //  Contents given as bytes are independent messages: hash them in one multi-buffer call,
+    //  digestMessage() then takes the ready value from ContentHasher
+    int ret = RET_OK;
+    vector<ContentHasher*> content_hashers;
+    vector<const ByteArray*> refba_contents;
+
+    for (auto& it : signingDocs) {
+        if (!it.isDigest && (it.contentHasher.getSourceType() == ContentHasher::SourceType::BYTEARRAY)) {
+            content_hashers.push_back(&it.contentHasher);
+            refba_contents.push_back(it.contentHasher.getContentBytes());
+        }
+    }
+    if (refba_contents.size() < 2) return RET_OK;
+
+    {
+        VectorBA vba_hashes(refba_contents.size());
+        DO(::hash_multi(hashAlgo, refba_contents.data(), refba_contents.size(), vba_hashes.data()));
+        for (size_t i = 0; i < content_hashers.size(); i++) {
+            DO(content_hashers[i]->setHashValue(hashAlgo, vba_hashes[i]));
+            vba_hashes[i] = nullptr;
+        }
+    }
+
+cleanup:
+    return ret;
+}
+
+static int digest_signed_attributes (
+        vector<Doc::Sign::SigningDoc>& signingDocs,
+        const HashAlg hashAlgo
+)
+{
+    int ret = RET_OK;
+    vector<const ByteArray*> refba_signedattrs;
+    VectorBA vba_hashes(signingDocs.size());
+
+    for (const auto& it : signingDocs) {
+        refba_signedattrs.push_back(it.signerInfo->getSignedAttrsEncoded());
+    }
+
+    DO(::hash_multi(hashAlgo, refba_signedattrs.data(), refba_signedattrs.size(), vba_hashes.data()));
+    for (size_t i = 0; i < signingDocs.size(); i++) {
+        (void)signingDocs[i].hashSignedAttrs.reset(vba_hashes[i]);
+        vba_hashes[i] = nullptr;
+    }
+
+cleanup:
+    return ret;
+}
+
 static int resultdoc_to_json (
         JSON_Object* joResultDoc,
         Doc::Sign::SigningDoc& sDoc
@@ -350,6 +405,7 @@ int uapki_sign (
     }
 
     if (shared_data.signatureFormat != SignatureFormat::RAW) {
+        DO(digest_contents(signing_docs, shared_data.hashDigest));
         for (size_t i = 0; i < signing_docs.size(); i++) {
             Doc::Sign::SigningDoc& sdoc = signing_docs[i];
 
@@ -362,8 +418,11 @@ int uapki_sign (
             }
 
             DO(sdoc.buildSignedAttributes());
-            DO(sdoc.digestSignedAttributes());
-            refba_hashes.push_back(sdoc.hashSignedAttrs.get());
+        }
+
+        DO(digest_signed_attributes(signing_docs, shared_data.hashSignature));
+        for (size_t i = 0; i < signing_docs.size(); i++) {
+            refba_hashes.push_back(signing_docs[i].hashSignedAttrs.get());
         }
 
         DO(storage->keySign(
@@ -390,6 +449,7 @@ int uapki_sign (
         }
     }
     else {
+        DO(digest_contents(signing_docs, shared_data.hashDigest));
         for (size_t i = 0; i < signing_docs.size(); i++) {
             Doc::Sign::SigningDoc& sdoc = signing_docs[i];
             DO(sdoc.digestMessage());
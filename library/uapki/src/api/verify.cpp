@@ -678,6 +678,9 @@ static int verify_p7s (
 )
 {
     int ret = RET_OK;
+    vector<size_t> sign_indexes, batch_indexes;
+    vector<Verify::SignatureItem> sign_items, batch_items;
+    vector<int> sign_rets, batch_results;
     Doc::Verify::VerifySignedDoc verify_sdoc(
         get_config(),
         get_cerstore(),
@@ -714,25 +717,58 @@ static int verify_p7s (
             (verifyOptions.verifySignerInfoIndex < 0) ||
             (verifyOptions.verifySignerInfoIndex == (int)idx)
         ) {
-            DO(verified_sinfo.verifySignedAttribute());
-            DO(verified_sinfo.verifyMessageDigest(*verify_sdoc.refContentHasher));
-            DO(verified_sinfo.verifySigningCertificateV2());
-
-            verified_sinfo.determineSignFormat();
-            DO(verified_sinfo.tspCertToStore());
-            DO(verified_sinfo.certValuesToStore());
-            DO(verified_sinfo.verifyContentTimeStamp(*verify_sdoc.refContentHasher));
-            DO(verified_sinfo.verifySignatureTimeStamp());
-            DO(verified_sinfo.verifyCertificateRefs());
-            DO(verified_sinfo.verifyArchiveTimeStamp(verify_sdoc.addedCerts, verify_sdoc.addedCrls));
-
-            verified_sinfo.validateSignFormat(verify_sdoc.validateTime, verify_sdoc.refContentHasher->isPresent());
-            if (verifyOptions.validationType >= Doc::Verify::VerifyOptions::ValidationType::CHAIN) {
-                DO(verified_sinfo.buildCertChain());
+            sign_indexes.push_back(idx);
+            sign_items.push_back(Verify::SignatureItem());
+            sign_rets.push_back(verified_sinfo.getSignedAttrsSignItem(sign_items.back()));
+        }
+    }
+
+    //  Signatures of all signer_infos are verified together
+    for (size_t i = 0; i < sign_indexes.size(); i++) {
+        if (sign_rets[i] == RET_OK) {
+            batch_indexes.push_back(i);
+            batch_items.push_back(sign_items[i]);
+        }
+    }
+    DO(Verify::verifySignatures(batch_items, batch_results));
+    for (size_t j = 0; j < batch_indexes.size(); j++) {
+        sign_rets[batch_indexes[j]] = batch_results[j];
+    }
+
+    for (size_t i = 0; i < sign_indexes.size(); i++) {
+        Doc::Verify::VerifiedSignerInfo& verified_sinfo = verify_sdoc.verifiedSignerInfos[sign_indexes[i]];
+
+        if (sign_rets[i] == RET_UAPKI_CERT_NOT_FOUND) {
+            //  Signer certificate may come with the certificate-values of a previous signer_info
+            sign_rets[i] = verified_sinfo.getSignedAttrsSignItem(sign_items[i]);
+            if (sign_rets[i] == RET_OK) {
+                sign_rets[i] = Verify::verifySignature(
+                    sign_items[i].signAlgo,
+                    sign_items[i].baData,
+                    sign_items[i].isHash,
+                    sign_items[i].baSignerSPKI,
+                    sign_items[i].baSignValue
+                );
             }
-            DO(validate_certs(verify_sdoc, verified_sinfo));
-            verified_sinfo.validateStatusCerts();
         }
+        DO(verified_sinfo.setSignedAttrsVerifyResult(sign_rets[i]));
+        DO(verified_sinfo.verifyMessageDigest(*verify_sdoc.refContentHasher));
+        DO(verified_sinfo.verifySigningCertificateV2());
+
+        verified_sinfo.determineSignFormat();
+        DO(verified_sinfo.tspCertToStore());
+        DO(verified_sinfo.certValuesToStore());
+        DO(verified_sinfo.verifyContentTimeStamp(*verify_sdoc.refContentHasher));
+        DO(verified_sinfo.verifySignatureTimeStamp());
+        DO(verified_sinfo.verifyCertificateRefs());
+        DO(verified_sinfo.verifyArchiveTimeStamp(verify_sdoc.addedCerts, verify_sdoc.addedCrls));
+
+        verified_sinfo.validateSignFormat(verify_sdoc.validateTime, verify_sdoc.refContentHasher->isPresent());
+        if (verifyOptions.validationType >= Doc::Verify::VerifyOptions::ValidationType::CHAIN) {
+            DO(verified_sinfo.buildCertChain());
+        }
+        DO(validate_certs(verify_sdoc, verified_sinfo));
+        verified_sinfo.validateStatusCerts();
     }
 
     verify_sdoc.detectCertSources();
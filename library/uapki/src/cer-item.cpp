@@ -399,6 +399,30 @@ int CerItem::verify (
     SmartBA sba_signvalue, sba_tbs;
     string s_signalgo;
 
+    DO(getTbsSignature(s_signalgo, &sba_tbs, &sba_signvalue));
+
+    ret = Verify::verifySignature(
+        s_signalgo.c_str(),
+        sba_tbs.get(),
+        false,
+        cerIssuer->getSpki(),
+        sba_signvalue.get()
+    );
+    setVerifyResult(cerIssuer, ret);
+
+cleanup:
+    return ret;
+}
+
+int CerItem::getTbsSignature (
+        string& signAlgo,
+        ByteArray** baTbs,
+        ByteArray** baSignValue
+) const
+{
+    int ret = RET_OK;
+    SmartBA sba_signvalue, sba_tbs;
+
     X509Tbs_t* x509_tbs = (X509Tbs_t*)asn_decode_ba_with_alloc(get_X509Tbs_desc(), m_Encoded);
     if (!x509_tbs) {
         SET_ERROR(RET_UAPKI_INVALID_STRUCT);
@@ -407,10 +431,10 @@ int CerItem::verify (
         SET_ERROR(RET_UAPKI_GENERAL_ERROR);
     }
 
-    DO(Util::oidFromAsn1(&m_Cert->signatureAlgorithm.algorithm, s_signalgo));
+    DO(Util::oidFromAsn1(&m_Cert->signatureAlgorithm.algorithm, signAlgo));
     if (
-        oid_is_parent(OID_DSTU4145_WITH_DSTU7564, s_signalgo.c_str()) ||
-        oid_is_parent(OID_DSTU4145_WITH_GOST3411, s_signalgo.c_str())
+        oid_is_parent(OID_DSTU4145_WITH_DSTU7564, signAlgo.c_str()) ||
+        oid_is_parent(OID_DSTU4145_WITH_GOST3411, signAlgo.c_str())
     ) {
         DO(Util::bitStringEncapOctetFromAsn1(&m_Cert->signature, &sba_signvalue));
     }
@@ -418,14 +442,20 @@ int CerItem::verify (
         DO(asn_BITSTRING2ba(&m_Cert->signature, &sba_signvalue));
     }
 
-    ret = Verify::verifySignature(
-        s_signalgo.c_str(),
-        sba_tbs.get(),
-        false,
-        cerIssuer->getSpki(),
-        sba_signvalue.get()
-    );
-    switch (ret) {
+    *baTbs = sba_tbs.pop();
+    *baSignValue = sba_signvalue.pop();
+
+cleanup:
+    asn_free(get_X509Tbs_desc(), x509_tbs);
+    return ret;
+}
+
+void CerItem::setVerifyResult (
+        const CerItem* cerIssuer,
+        const int retVerify
+)
+{
+    switch (retVerify) {
     case RET_OK:
         m_VerifyStatus = VerifyStatus::VALID;
         break;
@@ -442,10 +472,6 @@ int CerItem::verify (
             m_VerifyStatus = VerifyStatus::VALID_WITHOUT_KEYUSAGE;
         }
     }
-
-cleanup:
-    asn_free(get_X509Tbs_desc(), x509_tbs);
-    return ret;
 }
 
 int CerItem::checkValidity (
@@ -899,6 +925,57 @@ ValidationType validationTypeFromStr (
     return rv_type;
 }
 
+int verifyCerts (
+        const vector<CerItem*>& cerSubjects,
+        const vector<const CerItem*>& cerIssuers,
+        vector<int>& results,
+        const bool force
+)
+{
+    int ret = RET_OK;
+    const size_t count = cerSubjects.size();
+    VectorBA vba_tbs(count), vba_signvalues(count);
+    vector<string> signalgos(count);
+    vector<Verify::SignatureItem> sign_items;
+    vector<size_t> indexes;
+    vector<int> sign_results;
+
+    CHECK_PARAM(cerIssuers.size() == count);
+
+    results.assign(count, RET_OK);
+    for (size_t i = 0; i < count; i++) {
+        CerItem* cer_subject = cerSubjects[i];
+        lock_guard<mutex> lock(cer_subject->m_Mutex);
+
+        if (!force && (cer_subject->m_VerifyStatus > VerifyStatus::INDETERMINATE)) continue;
+
+        cer_subject->m_VerifyStatus = VerifyStatus::INDETERMINATE;
+        if (!cerIssuers[i]) continue;
+
+        results[i] = cer_subject->getTbsSignature(signalgos[i], &vba_tbs[i], &vba_signvalues[i]);
+        if (results[i] == RET_OK) {
+            sign_items.push_back(Verify::SignatureItem{
+                signalgos[i].c_str(), vba_tbs[i], false, cerIssuers[i]->getSpki(), vba_signvalues[i]
+            });
+            indexes.push_back(i);
+        }
+    }
+
+    //  Mutexes are released while the signatures are verified, statuses are set afterwards
+    DO(Verify::verifySignatures(sign_items, sign_results));
+    for (size_t j = 0; j < indexes.size(); j++) {
+        const size_t i = indexes[j];
+        CerItem* cer_subject = cerSubjects[i];
+        lock_guard<mutex> lock(cer_subject->m_Mutex);
+
+        results[i] = sign_results[j];
+        cer_subject->setVerifyResult(cerIssuers[i], sign_results[j]);
+    }
+
+cleanup:
+    return ret;
+}
+
 const char* verifyStatusToStr (
         const VerifyStatus status
 )
@@ -352,6 +352,17 @@ public:
         const bool force = false
     );
 
+private:
+    int getTbsSignature (
+        std::string& signAlgo,
+        ByteArray** baTbs,
+        ByteArray** baSignValue
+    ) const;
+    void setVerifyResult (
+        const CerItem* cerIssuer,
+        const int retVerify
+    );
+
 public:
     int checkValidity (
         const uint64_t validateTime
@@ -369,6 +380,12 @@ public:
         const ByteArray* baEncoded,
         CerItem** cerItem
     );
+    friend int verifyCerts (
+        const std::vector<CerItem*>& cerSubjects,
+        const std::vector<const CerItem*>& cerIssuers,
+        std::vector<int>& results,
+        const bool force
+    );
 
 };  //  end class CerItem
 
@@ -425,6 +442,14 @@ int parseSID (
 ValidationType validationTypeFromStr (
     const std::string& validationType
 );
+//  Batch form of CerItem::verify(): results[i] is the code cerSubjects[i]->verify(cerIssuers[i], force)
+//  would return, EC signatures of all certificates are checked together
+int verifyCerts (
+    const std::vector<CerItem*>& cerSubjects,
+    const std::vector<const CerItem*>& cerIssuers,
+    std::vector<int>& results,
+    const bool force = false
+);
 const char* verifyStatusToStr (
     const VerifyStatus status
 );
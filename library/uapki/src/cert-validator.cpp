@@ -334,7 +334,9 @@ int CertValidator::getStatus (
     if (m_ValidationType <= Cert::ValidationType::NONE) return RET_OK;
 
     int ret = RET_OK;
-    vector<Cert::CerItem*> chain_certs, obtained_certs;
+    vector<Cert::CerItem*> chain_certs, obtained_certs, cer_subjects;
+    vector<const Cert::CerItem*> cer_issuers;
+    vector<int> verify_results;
     size_t idx_root;
     CertEntity expected_certentity = CertEntity::UNDEFINED;
 
@@ -353,15 +355,18 @@ int CertValidator::getStatus (
     }
     chain_certs.clear();
 
-    //  check signature in chain-certs
+    //  check signature in chain-certs, all at once
     idx_root = m_CertChain.size() - 1;
-    entity = m_CertChain[idx_root];
-    DO(entity->getSubject()->verify(entity->getSubject(), true));
-    entity->setRoot();
+    for (size_t i = 0; i <= idx_root; i++) {
+        cer_subjects.push_back(m_CertChain[i]->getSubject());
+        cer_issuers.push_back(m_CertChain[(i < idx_root) ? i + 1 : i]->getSubject());
+    }
+    DO(Cert::verifyCerts(cer_subjects, cer_issuers, verify_results, true));
+    DO(verify_results[idx_root]);
+    m_CertChain[idx_root]->setRoot();
     for (size_t i = 0; i < idx_root; i++) {
-        entity = m_CertChain[i];
-        DO(entity->getSubject()->verify(m_CertChain[i + 1]->getSubject(), true));
-        entity->setIssuer(m_CertChain[i + 1]->getSubject());
+        DO(verify_results[i]);
+        m_CertChain[i]->setIssuer(m_CertChain[i + 1]->getSubject());
     }
 
     //  check validity in chain-certs
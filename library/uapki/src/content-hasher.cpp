@@ -217,6 +217,23 @@ int ContentHasher::digestMemory (
     return ::hash(hashAlgo, &ba_local, &m_Value);
 }
 
+int ContentHasher::setHashValue (
+        const HashAlg hashAlgo,
+        ByteArray* baHashValue
+)
+{
+    //  Hash value computed outside (e.g. by hash_multi), takes ownership on success
+    if (
+        (hashAlgo == HASH_ALG_UNDEFINED) ||
+        (m_SourceType == SourceType::UNDEFINED) ||
+        !baHashValue
+    ) return RET_UAPKI_INVALID_PARAMETER;
+
+    (void)m_Value.reset(baHashValue);
+    m_HashAlgo = hashAlgo;
+    return RET_OK;
+}
+
 void ContentHasher::setSourceType (
         const SourceType sourceType
 )
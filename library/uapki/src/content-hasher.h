@@ -76,6 +76,10 @@ public:
         const uint8_t* ptr,
         const size_t size
     );
+    int setHashValue (
+        const HashAlg hashAlgo,
+        ByteArray* baHashValue
+    );
 
 public:
     const ByteArray* getContentBytes (void) const {
@@ -1049,7 +1049,9 @@ int VerifiedSignerInfo::verifySignatureTimeStamp (void)
     return ret;
 }
 
-int VerifiedSignerInfo::verifySignedAttribute (void)
+int VerifiedSignerInfo::getSignedAttrsSignItem (
+        UapkiNS::Verify::SignatureItem& signItem
+)
 {
     int ret = RET_OK;
 
@@ -1067,16 +1069,24 @@ int VerifiedSignerInfo::verifySignedAttribute (void)
     }
     ret = getCerStore()->getCertBySID(m_SignerInfo.getSidEncoded(), &m_CerSigner);
 
-    //  Verify signed attributes
     if (ret == RET_OK) {
-        ret = UapkiNS::Verify::verifySignature(
-            m_SignerInfo.getSignatureAlgorithm().algorithm.c_str(),
-            m_SignerInfo.getSignedAttrsEncoded(),
-            false,
-            m_CerSigner->getSpki(),
-            m_SignerInfo.getSignature()
-        );
+        signItem.signAlgo = m_SignerInfo.getSignatureAlgorithm().algorithm.c_str();
+        signItem.baData = m_SignerInfo.getSignedAttrsEncoded();
+        signItem.isHash = false;
+        signItem.baSignerSPKI = m_CerSigner->getSpki();
+        signItem.baSignValue = m_SignerInfo.getSignature();
     }
+
+cleanup:
+    return ret;
+}
+
+int VerifiedSignerInfo::setSignedAttrsVerifyResult (
+        const int retVerify
+)
+{
+    int ret = retVerify;
+
     switch (ret) {
     case RET_OK:
         m_StatusSignature = SignatureVerifyStatus::VALID;
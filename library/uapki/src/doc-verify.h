@@ -38,6 +38,7 @@
 #include "signature-format.h"
 #include "signeddata-helper.h"
 #include "tsp-helper.h"
+#include "uapki-ns-verify.h"
 #include "verify-status.h"
 
 
@@ -268,7 +269,13 @@ public:
         ResultValidationByOcsp& resultValByOcsp
     );
     int verifySignatureTimeStamp (void);
-    int verifySignedAttribute (void);
+    //  Signature of signed attributes is verified in two steps, for all signer infos at once
+    int getSignedAttrsSignItem (
+        UapkiNS::Verify::SignatureItem& signItem
+    );
+    int setSignedAttrsVerifyResult (
+        const int retVerify
+    );
     int verifySigningCertificateV2 (void);
 
 public:
@@ -186,6 +186,76 @@ UAPKIC_EXPORT int aes_encrypt_mac(AesCtx* ctx, const ByteArray* auth_data, const
 UAPKIC_EXPORT int aes_decrypt_mac(AesCtx* ctx, const ByteArray* auth_data,
     const ByteArray* encrypted_data, const ByteArray* mac, ByteArray** data);
 
+/**
+ * Починає потокове шифрування з виробленням імітовставки (GCM, CCM).
+ * Далі викликаються aes_update_auth_data, aes_encrypt_mac_update і aes_encrypt_mac_final.
+ *
+ * @param ctx контекст AES, ініціалізований aes_init_gcm або aes_init_ccm
+ * @param auth_data_len загальна довжина відкритого тексту повідомлення
+ * @param data_len загальна довжина даних для шифрування
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_encrypt_mac_init(AesCtx* ctx, uint64_t auth_data_len, uint64_t data_len);
+
+/**
+ * Починає потокове розшифрування з перевіркою імітовставки (GCM, CCM).
+ * Далі викликаються aes_update_auth_data, aes_decrypt_mac_update і aes_decrypt_mac_final.
+ *
+ * @param ctx контекст AES, ініціалізований aes_init_gcm або aes_init_ccm
+ * @param auth_data_len загальна довжина відкритого тексту повідомлення
+ * @param data_len загальна довжина даних для розшифрування
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_decrypt_mac_init(AesCtx* ctx, uint64_t auth_data_len, uint64_t data_len);
+
+/**
+ * Додає частину відкритого тексту повідомлення. Викликається до обробки даних.
+ *
+ * @param ctx контекст AES
+ * @param auth_data частина відкритого тексту повідомлення
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_update_auth_data(AesCtx* ctx, const ByteArray* auth_data);
+
+/**
+ * Шифрує чергову частину даних.
+ *
+ * @param ctx контекст AES
+ * @param data частина даних для шифрування
+ * @param encrypted_data зашифрована частина даних
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_encrypt_mac_update(AesCtx* ctx, const ByteArray* data, ByteArray** encrypted_data);
+
+/**
+ * Розшифровує чергову частину даних. Розшифровані дані не можна використовувати,
+ * доки aes_decrypt_mac_final не підтвердить імітовставку.
+ *
+ * @param ctx контекст AES
+ * @param encrypted_data частина даних для розшифрування
+ * @param data розшифрована частина даних
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_decrypt_mac_update(AesCtx* ctx, const ByteArray* encrypted_data, ByteArray** data);
+
+/**
+ * Завершує потокове шифрування і повертає імітовставку.
+ *
+ * @param ctx контекст AES
+ * @param mac імітовставка
+ * @return код помилки
+ */
+UAPKIC_EXPORT int aes_encrypt_mac_final(AesCtx* ctx, ByteArray** mac);
+
+/**
+ * Завершує потокове розшифрування і перевіряє імітовставку.
+ *
+ * @param ctx контекст AES
+ * @param mac імітовставка
+ * @return код помилки, RET_VERIFY_FAILED - імітовставка не збігається
+ */
+UAPKIC_EXPORT int aes_decrypt_mac_final(AesCtx* ctx, const ByteArray* mac);
+
 /**
  * Звільняє контекст AES.
  *
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UAPKIC_CPU_FEATURES_H
+#define UAPKIC_CPU_FEATURES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "uapkic-export.h"
+
+#define CPU_FEATURE_PCLMUL      0x00000001  /* PCLMULQDQ */
+#define CPU_FEATURE_AVX2        0x00000002  /* AVX2 з підтримкою YMM-регістрів ОС */
+#define CPU_FEATURE_VPCLMUL     0x00000004  /* VPCLMULQDQ (YMM) */
+#define CPU_FEATURE_SSSE3       0x00000008  /* SSSE3 */
+#define CPU_FEATURE_SSE41       0x00000010  /* SSE4.1 */
+#define CPU_FEATURE_AESNI       0x00000020  /* AES-NI */
+#define CPU_FEATURE_SHANI       0x00000040  /* SHA extensions (SHA-1, SHA-256) */
+#define CPU_FEATURE_AVX512BW    0x00000080  /* AVX-512F і AVX-512BW з підтримкою ZMM-регістрів ОС */
+#define CPU_FEATURE_AVX512VBMI  0x00000100  /* AVX-512 VBMI (VPERMB, VPERMI2B) */
+#define CPU_FEATURE_GFNI        0x00000200  /* GFNI (афінні перетворення над GF(2^8)) */
+
+#define CPU_FEATURES_ALL        0x7FFFFFFF  /* Дозволити всі розширення процесора */
+
+/** Змінна оточення, непорожнє значення якої (крім "0") залишає лише загальні реалізації. */
+#define CPU_FEATURES_ENV_GENERIC "UAPKIC_FORCE_GENERIC"
+
+/** Примітиви з кількома реалізаціями, що обираються під час виконання. */
+typedef enum {
+    CPU_PRIMITIVE_GF2M_MUL = 0,     /* Множення у полі GF(2^m) */
+    CPU_PRIMITIVE_SHA1,             /* Перетворення SHA-1 */
+    CPU_PRIMITIVE_SHA256,           /* Перетворення SHA-224/256 */
+    CPU_PRIMITIVE_SHA512,           /* Перетворення SHA-384/512 */
+    CPU_PRIMITIVE_SHA256_MULTI,     /* Багатобуферне гешування SHA-224/256 */
+    CPU_PRIMITIVE_SHA512_MULTI,     /* Багатобуферне гешування SHA-384/512 */
+    CPU_PRIMITIVE_AES,              /* Блоковий шифр AES */
+    CPU_PRIMITIVE_GHASH,            /* GHASH режиму AES-GCM */
+    CPU_PRIMITIVE_DSTU7624,         /* Блоковий шифр ДСТУ 7624 (Калина) */
+    CPU_PRIMITIVE_DSTU7624_GMAC,    /* Множення GMAC режимів GCM/GMAC ДСТУ 7624 */
+    CPU_PRIMITIVE_COUNT
+} CpuPrimitive;
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Обмежує набір розширень процесора, які можуть використовувати реалізації примітивів,
+ * і заново обирає реалізації. Контексти, створені раніше, зберігають обрані реалізації,
+ * тому функцію слід викликати до uapkic_init.
+ *
+ * @param mask дозволені розширення CPU_FEATURE_*, 0 - лише загальні реалізації
+ */
+UAPKIC_EXPORT void cpu_features_set_mask(uint32_t mask);
+
+/**
+ * Повертає набір розширень процесора, що використовуються (визначені та дозволені маскою).
+ *
+ * @return комбінація прапорців CPU_FEATURE_*
+ */
+UAPKIC_EXPORT uint32_t cpu_features_get(void);
+
+/**
+ * Повертає назву розширення процесора.
+ *
+ * @param feature один прапорець CPU_FEATURE_*
+ * @return назва або NULL для невідомого прапорця
+ */
+UAPKIC_EXPORT const char* cpu_feature_name(uint32_t feature);
+
+/**
+ * Повертає назву примітива.
+ *
+ * @param primitive примітив
+ * @return назва або NULL
+ */
+UAPKIC_EXPORT const char* cpu_primitive_name(CpuPrimitive primitive);
+
+/**
+ * Повертає назву обраної реалізації примітива.
+ *
+ * @param primitive примітив
+ * @return назва реалізації або NULL
+ */
+UAPKIC_EXPORT const char* cpu_primitive_impl(CpuPrimitive primitive);
+
+/**
+ * Повертає кількість доступних логічних процесорів.
+ *
+ * @return кількість процесорів, не менше 1
+ */
+UAPKIC_EXPORT size_t cpu_count(void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -214,6 +214,77 @@ UAPKIC_EXPORT int dstu7624_encrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_d
 UAPKIC_EXPORT int dstu7624_decrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_data,
         const ByteArray *encrypted_data, ByteArray *mac, ByteArray **data);
 
+/**
+ * Починає потокове шифрування з виробленням імітовставки (GCM, CCM).
+ * Далі викликаються dstu7624_update_auth_data, dstu7624_encrypt_mac_update і dstu7624_encrypt_mac_final.
+ *
+ * @param ctx контекст ДСТУ 7624, ініціалізований dstu7624_init_gcm або dstu7624_init_ccm
+ * @param auth_data_len загальна довжина відкритого тексту повідомлення
+ * @param data_len загальна довжина даних для шифрування
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_encrypt_mac_init(Dstu7624Ctx *ctx, uint64_t auth_data_len, uint64_t data_len);
+
+/**
+ * Починає потокове розшифрування з перевіркою імітовставки (GCM, CCM).
+ * Далі викликаються dstu7624_update_auth_data, dstu7624_decrypt_mac_update і dstu7624_decrypt_mac_final.
+ *
+ * @param ctx контекст ДСТУ 7624, ініціалізований dstu7624_init_gcm або dstu7624_init_ccm
+ * @param auth_data_len загальна довжина відкритого тексту повідомлення
+ * @param data_len загальна довжина розшифрованих даних (для CCM - без зашифрованої імітовставки)
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_decrypt_mac_init(Dstu7624Ctx *ctx, uint64_t auth_data_len, uint64_t data_len);
+
+/**
+ * Додає частину відкритого тексту повідомлення. Викликається до обробки даних.
+ *
+ * @param ctx контекст ДСТУ 7624
+ * @param auth_data частина відкритого тексту повідомлення
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_update_auth_data(Dstu7624Ctx *ctx, const ByteArray *auth_data);
+
+/**
+ * Шифрує чергову частину даних.
+ *
+ * @param ctx контекст ДСТУ 7624
+ * @param data частина даних для шифрування
+ * @param encrypted_data зашифрована частина даних
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_encrypt_mac_update(Dstu7624Ctx *ctx, const ByteArray *data, ByteArray **encrypted_data);
+
+/**
+ * Розшифровує чергову частину даних. Для CCM зашифрована імітовставка в кінці даних пропускається.
+ * Розшифровані дані не можна використовувати, доки dstu7624_decrypt_mac_final не підтвердить імітовставку.
+ *
+ * @param ctx контекст ДСТУ 7624
+ * @param encrypted_data частина даних для розшифрування
+ * @param data розшифрована частина даних
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_decrypt_mac_update(Dstu7624Ctx *ctx, const ByteArray *encrypted_data, ByteArray **data);
+
+/**
+ * Завершує потокове шифрування і повертає імітовставку.
+ *
+ * @param ctx контекст ДСТУ 7624
+ * @param mac імітовставка
+ * @param encrypted_data останні зашифровані дані: для CCM - зашифрована імітовставка, для GCM - порожні
+ * @return код помилки
+ */
+UAPKIC_EXPORT int dstu7624_encrypt_mac_final(Dstu7624Ctx *ctx, ByteArray **mac, ByteArray **encrypted_data);
+
+/**
+ * Завершує потокове розшифрування і перевіряє імітовставку.
+ *
+ * @param ctx контекст ДСТУ 7624
+ * @param mac імітовставка
+ * @return код помилки, RET_VERIFY_FAILED - імітовставка не збігається
+ */
+UAPKIC_EXPORT int dstu7624_decrypt_mac_final(Dstu7624Ctx *ctx, const ByteArray *mac);
+
 /**
  * Шифрування даних.
  *
@@ -43,7 +43,13 @@ typedef enum {
     OPT_LEVEL_WIN_5_WIN_5 = 0x0505,
     OPT_LEVEL_WIN_11_WIN_11 = 0x0b0b,
     OPT_LEVEL_COMB_5_COMB_5 = 0x5050,
-    OPT_LEVEL_COMB_11_COMB_11 = 0xb0b0
+    OPT_LEVEL_COMB_11_COMB_11 = 0xb0b0,
+    /* Передобчислення лише для перевірки підпису: наявне передобчислення базової точки
+       та спільні параметри кривої не змінюються. */
+    OPT_LEVEL_VERIFY_COMB_5 = 0x0050,
+    /* Прапорець, що поєднується з рівнями вище: множення точки на число для кривих над GF(2^m)
+       (ec_dh, отримання відкритого ключа ДСТУ 4145) виконується сходами Монтгомері. */
+    OPT_LEVEL_EC2M_LADDER = 0x10000
 } OptLevelId;
 
 typedef struct EcCtx_st EcCtx;
@@ -116,6 +122,18 @@ UAPKIC_EXPORT void ec_free(EcCtx* ctx);
  */
 UAPKIC_EXPORT int ec_set_opt_level(EcCtx* ctx, OptLevelId opt_level);
 
+/**
+ * Вмикає фоновий пул одноразових пар (k, kP) для формування підпису.
+ * Фоновий потік поповнює пул до depth, коли в ньому лишається low_watermark пар або менше.
+ * Кожна пара використовується один раз і затирається. depth == 0 вимикає пул.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param depth місткість пулу (0..1024)
+ * @param low_watermark поріг поповнення (менше depth)
+ * @return код помилки
+ */
+UAPKIC_EXPORT int ec_set_nonce_pool(EcCtx* ctx, size_t depth, size_t low_watermark);
+
 /**
  * Створює новий контекст еліптичної кривої та копіює туди параметри
  *
@@ -78,6 +78,23 @@ UAPKIC_EXPORT int ecdsa_sign(const EcCtx *ctx, const ByteArray *H, ByteArray **r
  */
 UAPKIC_EXPORT int ecdsa_verify(const EcCtx* ctx, const ByteArray* H, const ByteArray* r, const ByteArray* s);
 
+/**
+ * Виконує перевірку пакета підписів на одній кривій.
+ * Множення на базову точку та переведення в аффінні координати виконуються для всього пакета разом.
+ *
+ * @param ctx контекст ECDSA з параметрами кривої
+ * @param count кількість підписів
+ * @param qx Х-координати відкритих ключів
+ * @param qy Y-координати відкритих ключів
+ * @param H геші
+ * @param r частини підписів
+ * @param s частини підписів
+ * @param results результати перевірки кожного підпису (RET_OK, якщо підпис вірний)
+ * @return код помилки, RET_VERIFY_FAILED, якщо хоча б один підпис невірний, або RET_OK
+ */
+UAPKIC_EXPORT int ecdsa_verify_batch(const EcCtx* ctx, size_t count, const ByteArray* const* qx, const ByteArray* const* qy,
+        const ByteArray* const* H, const ByteArray* const* r, const ByteArray* const* s, int* results);
+
 /**
  * Виконує самотестування алгоритму ECDSA.
  * @return код помилки або RET_OK, якщо срмотестування пройдено
@@ -137,6 +137,19 @@ UAPKIC_EXPORT void hash_free(HashCtx *ctx);
  */
 UAPKIC_EXPORT int hash(HashAlg alg, const ByteArray *data, ByteArray **out);
 
+/**
+ * Обчислює геш-функцію від кількох незалежних повідомлень.
+ * Для SHA-224/256/384/512 на процесорах з AVX2 повідомлення обробляються одночасно кількома SIMD-доріжками.
+ * Інші алгоритми, зокрема ДСТУ 7564, гешують повідомлення послідовно, так само як виклики hash().
+ *
+ * @param alg алгоритм гешування
+ * @param msgs повідомлення
+ * @param count кількість повідомлень
+ * @param hashes масив з count елементів для гешів від повідомлень
+ * @return код помилки
+ */
+UAPKIC_EXPORT int hash_multi(HashAlg alg, const ByteArray *const *msgs, size_t count, ByteArray **hashes);
+
 /**
  * Повертає розмір у байтах геш-значення за заданим алгоритмом.
  *
@@ -178,6 +178,23 @@ UAPKIC_EXPORT int rsa_init_verify_pkcs1_v1_5(RsaCtx *ctx, HashAlg hash_alg, cons
  */
 UAPKIC_EXPORT int rsa_init_sign_pss(RsaCtx* ctx, HashAlg hash_alg, const ByteArray* n, const ByteArray* d);
 
+/**
+ * Задає параметри китайської теореми про залишки (CRT) для контексту RSA,
+ * ініціалізованого для операцій з особистим ключем (підпис або розшифрування).
+ * Операції з особистим ключем виконуються за модулями p і q замість n.
+ *
+ * @param ctx контекст RSA
+ * @param e публічна экспонента
+ * @param p просте число p
+ * @param q просте число q
+ * @param dmp1 d mod (p-1)
+ * @param dmq1 d mod (q-1)
+ * @param iqmp q^(-1) mod p
+ * @return код помилки
+ */
+UAPKIC_EXPORT int rsa_init_crt(RsaCtx* ctx, const ByteArray* e, const ByteArray* p, const ByteArray* q,
+        const ByteArray* dmp1, const ByteArray* dmq1, const ByteArray* iqmp);
+
 /**
  * Ініціалізує контекст RSA для перевірки ЕЦП згідно з RSA-PSS.
  *
@@ -31,6 +31,7 @@
 
 #define UAPKIC_VERSION 2002
 
+#include "cpu-features.h"
 #include "entropy.h"
 #include "drbg.h"
 #include "des.h"
@@ -107,7 +108,7 @@ extern "C" {
 #endif
 
 /**
- * Ініціалізує ГПВП, проводить самотестування
+ * Ініціалізує ГПВП, обирає реалізації примітивів за можливостями процесора, проводить самотестування
  *
  * @param version повертає версію бібліотеки
  * @param self_test_status повертає результат самотестування, якщо NULL - самотестування не виконується
@@ -34,12 +34,18 @@
 #include "byte-array-internal.h"
 #include "aes.h"
 #include "byte-utils-internal.h"
+#include "cpu-features-internal.h"
 #include "drbg.h"
 
+#if defined(CPU_X86_64)
+# include <immintrin.h>
+#endif
+
 #define AES_BLOCK_LEN 16
 #define AES_KEY128_LEN 16
 #define AES_KEY192_LEN 24
 #define AES_KEY256_LEN 32
+#define GHASH_AGG_BLOCKS 8
 
 typedef enum {
     AES_MODE_ECB,
@@ -52,7 +58,43 @@ typedef enum {
     AES_MODE_WRAP
 } CipherMode;
 
+typedef enum {
+    AES_AEAD_NONE,
+    AES_AEAD_AAD,
+    AES_AEAD_DATA
+} AesAeadStage;
+
+/* Стан потокового шифрування GCM/CCM. */
+typedef struct AesAead_st {
+    uint8_t ctr[AES_BLOCK_LEN];         /* лічильник гамування */
+    uint8_t gamma[AES_BLOCK_LEN];       /* гама останнього блока */
+    size_t gamma_off;                   /* використано байт гами */
+    uint8_t mac[AES_BLOCK_LEN];         /* стан GHASH або CBC-MAC */
+    uint8_t buf[AES_BLOCK_LEN];         /* неповний блок автентифікації */
+    size_t buf_len;
+    uint8_t tag_mask[AES_BLOCK_LEN];    /* E(J0) для GCM, E(A0) для CCM */
+    size_t ctr_width;                   /* кількість байт лічильника, що збільшуються */
+    uint64_t aad_len;
+    uint64_t data_len;
+    uint64_t aad_total;                 /* CCM: оголошені довжини */
+    uint64_t data_total;
+    AesAeadStage stage;
+    bool encrypt;
+} AesAead;
+
+typedef struct AesImpl_st AesImpl;
+typedef struct GhashImpl_st GhashImpl;
+
 struct AesCtx_st {
+#if defined(CPU_X86_64)
+    __m128i ni_ekey[15];
+    __m128i ni_dkey[15];
+    __m128i ghash_hpow[GHASH_AGG_BLOCKS];
+#endif
+    const AesImpl *impl;
+    const GhashImpl *ghash;
+    uint64_t ghash_hl[16];
+    uint64_t ghash_hh[16];
     size_t offset;
     uint8_t gamma[AES_BLOCK_LEN];
     uint8_t feed[AES_BLOCK_LEN];
@@ -64,8 +106,11 @@ struct AesCtx_st {
     size_t rounds_num;
     size_t tag_len;
     CipherMode mode_id;
+    AesAead aead;
 };
 
+static void aes_set_impl(AesCtx *ctx);
+
 /*Precomputed sbox, shitf_rows and m_col operation for fast calculation*/
 static const uint32_t Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
@@ -949,6 +994,8 @@ static int aes_base_init(AesCtx *ctx, const ByteArray *key)
     DO(ba_to_uint8(key, ctx->key, key_len));
     ctx->key_len = key_len;
     ctx->rounds_num = expanded_key(ctx);
+    ctx->aead.stage = AES_AEAD_NONE;
+    aes_set_impl(ctx);
 
 cleanup:
 
@@ -1015,17 +1062,17 @@ static void init_revert_rkey(AesCtx *ctx)
     }
 }
 
-__inline static void block_decrypt(AesCtx *ctx, uint8_t *in, uint8_t *out)
+__inline static void block_decrypt_soft(const AesCtx *ctx, const uint8_t *in, uint8_t *out)
 {
-    uint32_t *rk;
+    const uint32_t *rk;
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
 
-    rk = (uint32_t *) ctx->revert_rkey;
+    rk = ctx->revert_rkey;
 
-    s0 = GETU_32(out) ^ rk[0];
-    s1 = GETU_32(out + 4) ^ rk[1];
-    s2 = GETU_32(out + 8) ^ rk[2];
-    s3 = GETU_32(out + 12) ^ rk[3];
+    s0 = GETU_32(in) ^ rk[0];
+    s1 = GETU_32(in + 4) ^ rk[1];
+    s2 = GETU_32(in + 8) ^ rk[2];
+    s3 = GETU_32(in + 12) ^ rk[3];
 
     t_round_decrypt(1);
     s_round_decrypt(2);
@@ -1052,33 +1099,33 @@ __inline static void block_decrypt(AesCtx *ctx, uint8_t *in, uint8_t *out)
             (Td4[(t2 >> 8) & 0xff] & 0x0000ff00) ^
             (Td4[(t1) & 0xff] & 0x000000ff) ^
             rk[0];
-    PUT_U32(in, s0);
+    PUT_U32(out, s0);
     s1 = (Td4[(t1 >> 24) ] & 0xff000000) ^
             (Td4[(t0 >> 16) & 0xff] & 0x00ff0000) ^
             (Td4[(t3 >> 8) & 0xff] & 0x0000ff00) ^
             (Td4[(t2) & 0xff] & 0x000000ff) ^
             rk[1];
-    PUT_U32(in + 4, s1);
+    PUT_U32(out + 4, s1);
     s2 = (Td4[(t2 >> 24) ] & 0xff000000) ^
             (Td4[(t1 >> 16) & 0xff] & 0x00ff0000) ^
             (Td4[(t0 >> 8) & 0xff] & 0x0000ff00) ^
             (Td4[(t3) & 0xff] & 0x000000ff) ^
             rk[2];
-    PUT_U32(in + 8, s2);
+    PUT_U32(out + 8, s2);
     s3 = (Td4[(t3 >> 24) ] & 0xff000000) ^
             (Td4[(t2 >> 16) & 0xff] & 0x00ff0000) ^
             (Td4[(t1 >> 8) & 0xff] & 0x0000ff00) ^
             (Td4[(t0) & 0xff] & 0x000000ff) ^
             rk[3];
-    PUT_U32(in + 12, s3);
+    PUT_U32(out + 12, s3);
 }
 
-__inline static void block_encrypt(AesCtx *ctx, uint8_t *in, uint8_t *out)
+__inline static void block_encrypt_soft(const AesCtx *ctx, const uint8_t *in, uint8_t *out)
 {
-    uint32_t *rk;
+    const uint32_t *rk;
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
 
-    rk = (uint32_t *) ctx->rkey;
+    rk = ctx->rkey;
 
     s0 = GETU_32(in) ^ ctx->rkey[0];
     s1 = GETU_32(in + 4) ^ ctx->rkey[1];
@@ -1132,10 +1179,10 @@ __inline static void block_encrypt(AesCtx *ctx, uint8_t *in, uint8_t *out)
     PUT_U32(out + 12, s3);
 }
 
-__inline static void aes_xor(void *arg1, void *arg2, void *out)
+__inline static void aes_xor(const void *arg1, const void *arg2, void *out)
 {
-    uint8_t *a1 = (uint8_t*) arg1;
-    uint8_t*a2 = (uint8_t*) arg2;
+    const uint8_t *a1 = (const uint8_t*) arg1;
+    const uint8_t *a2 = (const uint8_t*) arg2;
     uint8_t*o = (uint8_t*) out;
 
     // побайтно бо на деяких платформах не підтримується 32 або 64 бітовий 
@@ -1158,11 +1205,585 @@ __inline static void aes_xor(void *arg1, void *arg2, void *out)
     o[15] = a1[15] ^ a2[15];
 }
 
+static void gamma_gen(uint8_t *gamma, size_t size)
+{
+    do {
+        size--;
+        gamma[size]++;
+    } while (gamma[size] == 0);
+}
+
+/*
+ * Реалізація AES: перетворення послідовності повних блоків у режимах, що допускають
+ * паралельну обробку. Стан режиму (gamma, feed) зберігається у контексті так само,
+ * як при поблоковій обробці.
+ */
+struct AesImpl_st {
+    const char *name;
+    uint32_t features;
+    void (*set_key)(AesCtx *ctx);
+    void (*encrypt_blocks)(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+    void (*decrypt_blocks)(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+    void (*decrypt_cbc)(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+    void (*decrypt_cfb)(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+    void (*crypt_ctr)(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+};
+
+static void encrypt_blocks_soft(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        block_encrypt_soft(ctx, in, out);
+    }
+}
+
+static void decrypt_blocks_soft(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        block_decrypt_soft(ctx, in, out);
+    }
+}
+
+static void decrypt_cbc_soft(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        memcpy(ctx->feed, in, AES_BLOCK_LEN);
+        block_decrypt_soft(ctx, in, out);
+        aes_xor(out, ctx->gamma, out);
+        memcpy(ctx->gamma, ctx->feed, AES_BLOCK_LEN);
+    }
+}
+
+static void decrypt_cfb_soft(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        memcpy(ctx->feed, in, AES_BLOCK_LEN);
+        aes_xor(in, ctx->gamma, out);
+        block_encrypt_soft(ctx, ctx->feed, ctx->gamma);
+    }
+}
+
+static void crypt_ctr_soft(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        aes_xor(in, ctx->gamma, out);
+        block_encrypt_soft(ctx, ctx->feed, ctx->gamma);
+        gamma_gen(ctx->feed, AES_BLOCK_LEN);
+    }
+}
+
+#if defined(CPU_X86_64)
+
+/*
+ * AES-NI. Раундові ключі зберігаються у контексті як вирівняні __m128i; незалежні блоки
+ * обробляються по 8, щоб приховати затримку aesenc/aesdec.
+ */
+#define AES_NI_WAY 8
+
+CPU_TARGET("aes,sse2")
+static void set_key_ni(AesCtx *ctx)
+{
+    uint8_t rk[AES_BLOCK_LEN];
+    const size_t nr = ctx->rounds_num;
+    size_t i;
+
+    for (i = 0; i <= nr; i++) {
+        PUT_U32(rk, ctx->rkey[4 * i]);
+        PUT_U32(rk + 4, ctx->rkey[4 * i + 1]);
+        PUT_U32(rk + 8, ctx->rkey[4 * i + 2]);
+        PUT_U32(rk + 12, ctx->rkey[4 * i + 3]);
+        ctx->ni_ekey[i] = _mm_loadu_si128((const __m128i *)rk);
+    }
+
+    /* Ключі розшифрування для aesdec: у зворотному порядку, внутрішні - через InvMixColumns. */
+    ctx->ni_dkey[0] = ctx->ni_ekey[nr];
+    for (i = 1; i < nr; i++) {
+        ctx->ni_dkey[i] = _mm_aesimc_si128(ctx->ni_ekey[nr - i]);
+    }
+    ctx->ni_dkey[nr] = ctx->ni_ekey[0];
+
+    secure_zero(rk, sizeof(rk));
+}
+
+CPU_TARGET("aes,sse2")
+static __inline __m128i aes_ni_enc1(const __m128i *rk, size_t nr, __m128i b)
+{
+    size_t r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < nr; r++) {
+        b = _mm_aesenc_si128(b, rk[r]);
+    }
+    return _mm_aesenclast_si128(b, rk[nr]);
+}
+
+CPU_TARGET("aes,sse2")
+static __inline __m128i aes_ni_dec1(const __m128i *rk, size_t nr, __m128i b)
+{
+    size_t r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < nr; r++) {
+        b = _mm_aesdec_si128(b, rk[r]);
+    }
+    return _mm_aesdeclast_si128(b, rk[nr]);
+}
+
+CPU_TARGET("aes,sse2")
+static __inline void aes_ni_enc8(const __m128i *rk, size_t nr, __m128i *b)
+{
+    __m128i k = rk[0];
+    size_t r;
+
+    b[0] = _mm_xor_si128(b[0], k); b[1] = _mm_xor_si128(b[1], k);
+    b[2] = _mm_xor_si128(b[2], k); b[3] = _mm_xor_si128(b[3], k);
+    b[4] = _mm_xor_si128(b[4], k); b[5] = _mm_xor_si128(b[5], k);
+    b[6] = _mm_xor_si128(b[6], k); b[7] = _mm_xor_si128(b[7], k);
+    for (r = 1; r < nr; r++) {
+        k = rk[r];
+        b[0] = _mm_aesenc_si128(b[0], k); b[1] = _mm_aesenc_si128(b[1], k);
+        b[2] = _mm_aesenc_si128(b[2], k); b[3] = _mm_aesenc_si128(b[3], k);
+        b[4] = _mm_aesenc_si128(b[4], k); b[5] = _mm_aesenc_si128(b[5], k);
+        b[6] = _mm_aesenc_si128(b[6], k); b[7] = _mm_aesenc_si128(b[7], k);
+    }
+    k = rk[nr];
+    b[0] = _mm_aesenclast_si128(b[0], k); b[1] = _mm_aesenclast_si128(b[1], k);
+    b[2] = _mm_aesenclast_si128(b[2], k); b[3] = _mm_aesenclast_si128(b[3], k);
+    b[4] = _mm_aesenclast_si128(b[4], k); b[5] = _mm_aesenclast_si128(b[5], k);
+    b[6] = _mm_aesenclast_si128(b[6], k); b[7] = _mm_aesenclast_si128(b[7], k);
+}
+
+CPU_TARGET("aes,sse2")
+static __inline void aes_ni_dec8(const __m128i *rk, size_t nr, __m128i *b)
+{
+    __m128i k = rk[0];
+    size_t r;
+
+    b[0] = _mm_xor_si128(b[0], k); b[1] = _mm_xor_si128(b[1], k);
+    b[2] = _mm_xor_si128(b[2], k); b[3] = _mm_xor_si128(b[3], k);
+    b[4] = _mm_xor_si128(b[4], k); b[5] = _mm_xor_si128(b[5], k);
+    b[6] = _mm_xor_si128(b[6], k); b[7] = _mm_xor_si128(b[7], k);
+    for (r = 1; r < nr; r++) {
+        k = rk[r];
+        b[0] = _mm_aesdec_si128(b[0], k); b[1] = _mm_aesdec_si128(b[1], k);
+        b[2] = _mm_aesdec_si128(b[2], k); b[3] = _mm_aesdec_si128(b[3], k);
+        b[4] = _mm_aesdec_si128(b[4], k); b[5] = _mm_aesdec_si128(b[5], k);
+        b[6] = _mm_aesdec_si128(b[6], k); b[7] = _mm_aesdec_si128(b[7], k);
+    }
+    k = rk[nr];
+    b[0] = _mm_aesdeclast_si128(b[0], k); b[1] = _mm_aesdeclast_si128(b[1], k);
+    b[2] = _mm_aesdeclast_si128(b[2], k); b[3] = _mm_aesdeclast_si128(b[3], k);
+    b[4] = _mm_aesdeclast_si128(b[4], k); b[5] = _mm_aesdeclast_si128(b[5], k);
+    b[6] = _mm_aesdeclast_si128(b[6], k); b[7] = _mm_aesdeclast_si128(b[7], k);
+}
+
+#define AES_NI_LOAD(p)      _mm_loadu_si128((const __m128i *)(p))
+#define AES_NI_STORE(p, x)  _mm_storeu_si128((__m128i *)(p), (x))
+
+CPU_TARGET("aes,sse2")
+static void encrypt_blocks_ni(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    __m128i b[AES_NI_WAY];
+    size_t i;
+
+    for (; blocks >= AES_NI_WAY; blocks -= AES_NI_WAY, in += AES_NI_WAY * AES_BLOCK_LEN, out += AES_NI_WAY * AES_BLOCK_LEN) {
+        for (i = 0; i < AES_NI_WAY; i++) {
+            b[i] = AES_NI_LOAD(in + i * AES_BLOCK_LEN);
+        }
+        aes_ni_enc8(ctx->ni_ekey, ctx->rounds_num, b);
+        for (i = 0; i < AES_NI_WAY; i++) {
+            AES_NI_STORE(out + i * AES_BLOCK_LEN, b[i]);
+        }
+    }
+
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        AES_NI_STORE(out, aes_ni_enc1(ctx->ni_ekey, ctx->rounds_num, AES_NI_LOAD(in)));
+    }
+}
+
+CPU_TARGET("aes,sse2")
+static void decrypt_blocks_ni(const AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    __m128i b[AES_NI_WAY];
+    size_t i;
+
+    for (; blocks >= AES_NI_WAY; blocks -= AES_NI_WAY, in += AES_NI_WAY * AES_BLOCK_LEN, out += AES_NI_WAY * AES_BLOCK_LEN) {
+        for (i = 0; i < AES_NI_WAY; i++) {
+            b[i] = AES_NI_LOAD(in + i * AES_BLOCK_LEN);
+        }
+        aes_ni_dec8(ctx->ni_dkey, ctx->rounds_num, b);
+        for (i = 0; i < AES_NI_WAY; i++) {
+            AES_NI_STORE(out + i * AES_BLOCK_LEN, b[i]);
+        }
+    }
+
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        AES_NI_STORE(out, aes_ni_dec1(ctx->ni_dkey, ctx->rounds_num, AES_NI_LOAD(in)));
+    }
+}
+
+CPU_TARGET("aes,sse2")
+static void decrypt_cbc_ni(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    __m128i b[AES_NI_WAY], c[AES_NI_WAY];
+    __m128i prev = AES_NI_LOAD(ctx->gamma);
+    size_t i;
+
+    for (; blocks >= AES_NI_WAY; blocks -= AES_NI_WAY, in += AES_NI_WAY * AES_BLOCK_LEN, out += AES_NI_WAY * AES_BLOCK_LEN) {
+        for (i = 0; i < AES_NI_WAY; i++) {
+            b[i] = c[i] = AES_NI_LOAD(in + i * AES_BLOCK_LEN);
+        }
+        aes_ni_dec8(ctx->ni_dkey, ctx->rounds_num, b);
+        AES_NI_STORE(out, _mm_xor_si128(b[0], prev));
+        for (i = 1; i < AES_NI_WAY; i++) {
+            AES_NI_STORE(out + i * AES_BLOCK_LEN, _mm_xor_si128(b[i], c[i - 1]));
+        }
+        prev = c[AES_NI_WAY - 1];
+    }
+
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        c[0] = AES_NI_LOAD(in);
+        AES_NI_STORE(out, _mm_xor_si128(aes_ni_dec1(ctx->ni_dkey, ctx->rounds_num, c[0]), prev));
+        prev = c[0];
+    }
+
+    AES_NI_STORE(ctx->gamma, prev);
+    AES_NI_STORE(ctx->feed, prev);
+}
+
+CPU_TARGET("aes,sse2")
+static void decrypt_cfb_ni(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    __m128i b[AES_NI_WAY], c[AES_NI_WAY];
+    __m128i gamma = AES_NI_LOAD(ctx->gamma);
+    size_t i;
+
+    if (blocks == 0) {
+        return;
+    }
+
+    /* gamma(i) = E(C(i - 1)): шифрування всіх блоків шифротексту незалежне. */
+    for (; blocks >= AES_NI_WAY; blocks -= AES_NI_WAY, in += AES_NI_WAY * AES_BLOCK_LEN, out += AES_NI_WAY * AES_BLOCK_LEN) {
+        for (i = 0; i < AES_NI_WAY; i++) {
+            b[i] = c[i] = AES_NI_LOAD(in + i * AES_BLOCK_LEN);
+        }
+        aes_ni_enc8(ctx->ni_ekey, ctx->rounds_num, b);
+        AES_NI_STORE(out, _mm_xor_si128(c[0], gamma));
+        for (i = 1; i < AES_NI_WAY; i++) {
+            AES_NI_STORE(out + i * AES_BLOCK_LEN, _mm_xor_si128(c[i], b[i - 1]));
+        }
+        gamma = b[AES_NI_WAY - 1];
+        c[0] = c[AES_NI_WAY - 1];
+    }
+
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        c[0] = AES_NI_LOAD(in);
+        AES_NI_STORE(out, _mm_xor_si128(c[0], gamma));
+        gamma = aes_ni_enc1(ctx->ni_ekey, ctx->rounds_num, c[0]);
+    }
+
+    AES_NI_STORE(ctx->feed, c[0]);
+    AES_NI_STORE(ctx->gamma, gamma);
+}
+
+CPU_TARGET("aes,ssse3")
+static void crypt_ctr_ni(AesCtx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    __m128i b[AES_NI_WAY];
+    __m128i gamma = AES_NI_LOAD(ctx->gamma);
+    uint64_t hi, lo;
+    size_t i;
+
+    /* Лічильник - 128-бітове число big-endian у feed. */
+    hi = ((uint64_t)GETU_32(ctx->feed) << 32) | GETU_32(ctx->feed + 4);
+    lo = ((uint64_t)GETU_32(ctx->feed + 8) << 32) | GETU_32(ctx->feed + 12);
+
+    for (; blocks >= AES_NI_WAY; blocks -= AES_NI_WAY, in += AES_NI_WAY * AES_BLOCK_LEN, out += AES_NI_WAY * AES_BLOCK_LEN) {
+        for (i = 0; i < AES_NI_WAY; i++) {
+            b[i] = _mm_shuffle_epi8(_mm_set_epi64x((long long)lo, (long long)hi), bswap);
+            if (++lo == 0) {
+                hi++;
+            }
+        }
+        aes_ni_enc8(ctx->ni_ekey, ctx->rounds_num, b);
+        AES_NI_STORE(out, _mm_xor_si128(AES_NI_LOAD(in), gamma));
+        for (i = 1; i < AES_NI_WAY; i++) {
+            AES_NI_STORE(out + i * AES_BLOCK_LEN, _mm_xor_si128(AES_NI_LOAD(in + i * AES_BLOCK_LEN), b[i - 1]));
+        }
+        gamma = b[AES_NI_WAY - 1];
+    }
+
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN, out += AES_BLOCK_LEN) {
+        AES_NI_STORE(out, _mm_xor_si128(AES_NI_LOAD(in), gamma));
+        gamma = aes_ni_enc1(ctx->ni_ekey, ctx->rounds_num,
+                _mm_shuffle_epi8(_mm_set_epi64x((long long)lo, (long long)hi), bswap));
+        if (++lo == 0) {
+            hi++;
+        }
+    }
+
+    AES_NI_STORE(ctx->gamma, gamma);
+    PUT_U32(ctx->feed, (uint32_t)(hi >> 32));
+    PUT_U32(ctx->feed + 4, (uint32_t)hi);
+    PUT_U32(ctx->feed + 8, (uint32_t)(lo >> 32));
+    PUT_U32(ctx->feed + 12, (uint32_t)lo);
+}
+
+#endif
+
+/*
+ * Реалізація GHASH: S = (S ^ X_i) * H для послідовності повних блоків X_i.
+ * Таблиці або степені H готуються один раз у aes_init_gcm.
+ */
+struct GhashImpl_st {
+    const char *name;
+    uint32_t features;
+    void (*init)(AesCtx *ctx, const uint8_t *h);
+    void (*blocks)(const AesCtx *ctx, uint8_t *s, const uint8_t *in, size_t blocks);
+};
+
+/* Редукція 4-бітового зсуву за модулем x^128 + x^7 + x^2 + x + 1. */
+static const uint16_t ghash_last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+/* Таблиця Шоупа: ghash_hh/ghash_hl[i] = i * H для всіх 4-бітових i. */
+static void ghash_init_table(AesCtx *ctx, const uint8_t *h)
+{
+    uint64_t vh, vl;
+    size_t i, j;
+
+    vh = ((uint64_t)GETU_32(h) << 32) | GETU_32(h + 4);
+    vl = ((uint64_t)GETU_32(h + 8) << 32) | GETU_32(h + 12);
+
+    ctx->ghash_hh[0] = 0;
+    ctx->ghash_hl[0] = 0;
+    ctx->ghash_hh[8] = vh;
+    ctx->ghash_hl[8] = vl;
+
+    for (i = 4; i > 0; i >>= 1) {
+        uint64_t r = (0 - (vl & 1)) & 0xe100000000000000ULL;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ r;
+        ctx->ghash_hh[i] = vh;
+        ctx->ghash_hl[i] = vl;
+    }
+
+    for (i = 2; i <= 8; i *= 2) {
+        for (j = 1; j < i; j++) {
+            ctx->ghash_hh[i + j] = ctx->ghash_hh[i] ^ ctx->ghash_hh[j];
+            ctx->ghash_hl[i + j] = ctx->ghash_hl[i] ^ ctx->ghash_hl[j];
+        }
+    }
+}
+
+static void ghash_mul_table(const AesCtx *ctx, uint8_t *x)
+{
+    uint64_t zh, zl;
+    size_t i, rem;
+    uint8_t lo, hi;
+
+    lo = x[15] & 0x0f;
+    zh = ctx->ghash_hh[lo];
+    zl = ctx->ghash_hl[lo];
+
+    for (i = 16; i-- > 0; ) {
+        lo = x[i] & 0x0f;
+        hi = x[i] >> 4;
+
+        if (i != 15) {
+            rem = (size_t)(zl & 0x0f);
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ ((uint64_t)ghash_last4[rem] << 48);
+            zh ^= ctx->ghash_hh[lo];
+            zl ^= ctx->ghash_hl[lo];
+        }
+
+        rem = (size_t)(zl & 0x0f);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ((uint64_t)ghash_last4[rem] << 48);
+        zh ^= ctx->ghash_hh[hi];
+        zl ^= ctx->ghash_hl[hi];
+    }
+
+    PUT_U32(x, (uint32_t)(zh >> 32));
+    PUT_U32(x + 4, (uint32_t)zh);
+    PUT_U32(x + 8, (uint32_t)(zl >> 32));
+    PUT_U32(x + 12, (uint32_t)zl);
+}
+
+static void ghash_blocks_table(const AesCtx *ctx, uint8_t *s, const uint8_t *in, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += AES_BLOCK_LEN) {
+        aes_xor(s, in, s);
+        ghash_mul_table(ctx, s);
+    }
+}
+
+#if defined(CPU_X86_64)
+
+/*
+ * GHASH на PCLMULQDQ. Блоки обертаються порядком байтів, добутки до GHASH_AGG_BLOCKS блоків
+ * на степені H накопичуються без редукції, після чого виконується одна редукція.
+ */
+#define GHASH_BSWAP_MASK _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+
+CPU_TARGET("pclmul,ssse3")
+static __inline void ghash_clmul_acc(__m128i a, __m128i b, __m128i *lo, __m128i *mid, __m128i *hi)
+{
+    *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(a, b, 0x00));
+    *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(a, b, 0x11));
+    *mid = _mm_xor_si128(*mid, _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+            _mm_clmulepi64_si128(a, b, 0x01)));
+}
+
+CPU_TARGET("pclmul,ssse3")
+static __inline __m128i ghash_clmul_reduce(__m128i lo, __m128i mid, __m128i hi)
+{
+    __m128i t1, t2, t3;
+
+    lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+    /* Зсув 256-бітового добутку на 1 біт ліворуч (біти GHASH відображені). */
+    t1 = _mm_srli_epi32(lo, 31);
+    t2 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t3 = _mm_srli_si128(t1, 12);
+    t2 = _mm_slli_si128(t2, 4);
+    t1 = _mm_slli_si128(t1, 4);
+    lo = _mm_or_si128(lo, t1);
+    hi = _mm_or_si128(hi, t2);
+    hi = _mm_or_si128(hi, t3);
+
+    /* Редукція за модулем x^128 + x^7 + x^2 + x + 1. */
+    t1 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+    t2 = _mm_srli_si128(t1, 4);
+    t1 = _mm_slli_si128(t1, 12);
+    lo = _mm_xor_si128(lo, t1);
+    t3 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+    t3 = _mm_xor_si128(t3, t2);
+    lo = _mm_xor_si128(lo, t3);
+
+    return _mm_xor_si128(hi, lo);
+}
+
+CPU_TARGET("pclmul,ssse3")
+static void ghash_init_clmul(AesCtx *ctx, const uint8_t *h)
+{
+    const __m128i h1 = _mm_shuffle_epi8(AES_NI_LOAD(h), GHASH_BSWAP_MASK);
+    __m128i lo, mid, hi;
+    size_t i;
+
+    ctx->ghash_hpow[0] = h1;
+    for (i = 1; i < GHASH_AGG_BLOCKS; i++) {
+        lo = mid = hi = _mm_setzero_si128();
+        ghash_clmul_acc(ctx->ghash_hpow[i - 1], h1, &lo, &mid, &hi);
+        ctx->ghash_hpow[i] = ghash_clmul_reduce(lo, mid, hi);
+    }
+}
+
+CPU_TARGET("pclmul,ssse3")
+static void ghash_blocks_clmul(const AesCtx *ctx, uint8_t *s, const uint8_t *in, size_t blocks)
+{
+    const __m128i bswap = GHASH_BSWAP_MASK;
+    __m128i x = _mm_shuffle_epi8(AES_NI_LOAD(s), bswap);
+    __m128i lo, mid, hi, b;
+    size_t i, n;
+
+    /* S' = (S ^ X_1) * H^n ^ X_2 * H^(n-1) ^ ... ^ X_n * H */
+    while (blocks > 0) {
+        n = (blocks < GHASH_AGG_BLOCKS) ? blocks : GHASH_AGG_BLOCKS;
+        lo = mid = hi = _mm_setzero_si128();
+
+        b = _mm_xor_si128(x, _mm_shuffle_epi8(AES_NI_LOAD(in), bswap));
+        ghash_clmul_acc(b, ctx->ghash_hpow[n - 1], &lo, &mid, &hi);
+        for (i = 1; i < n; i++) {
+            b = _mm_shuffle_epi8(AES_NI_LOAD(in + i * AES_BLOCK_LEN), bswap);
+            ghash_clmul_acc(b, ctx->ghash_hpow[n - 1 - i], &lo, &mid, &hi);
+        }
+        x = ghash_clmul_reduce(lo, mid, hi);
+
+        blocks -= n;
+        in += n * AES_BLOCK_LEN;
+    }
+
+    AES_NI_STORE(s, _mm_shuffle_epi8(x, bswap));
+}
+
+#endif
+
+/* Реалізації AES, від найшвидшої до загальної; остання не потребує розширень. */
+static const AesImpl AES_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"aes-ni", CPU_FEATURE_AESNI | CPU_FEATURE_SSSE3, set_key_ni,
+            encrypt_blocks_ni, decrypt_blocks_ni, decrypt_cbc_ni, decrypt_cfb_ni, crypt_ctr_ni},
+#endif
+    {"generic", 0, NULL,
+            encrypt_blocks_soft, decrypt_blocks_soft, decrypt_cbc_soft, decrypt_cfb_soft, crypt_ctr_soft}
+};
+
+#define AES_IMPL_GENERIC (&AES_IMPLS[sizeof(AES_IMPLS) / sizeof(AES_IMPLS[0]) - 1])
+
+/* Реалізації GHASH, від найшвидшої до загальної. */
+static const GhashImpl GHASH_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"pclmulqdq", CPU_FEATURE_PCLMUL | CPU_FEATURE_SSSE3, ghash_init_clmul, ghash_blocks_clmul},
+#endif
+    {"table4", 0, ghash_init_table, ghash_blocks_table}
+};
+
+static const AesImpl * volatile aes_impl_selected = NULL;
+static const GhashImpl * volatile ghash_impl_selected = NULL;
+
+void aes_dispatch_init(void)
+{
+    uint32_t features = cpu_features();
+    size_t i = 0;
+
+    while ((AES_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    aes_impl_selected = &AES_IMPLS[i];
+    cpu_dispatch_set(CPU_PRIMITIVE_AES, AES_IMPLS[i].name);
+
+    i = 0;
+    while ((GHASH_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    ghash_impl_selected = &GHASH_IMPLS[i];
+    cpu_dispatch_set(CPU_PRIMITIVE_GHASH, GHASH_IMPLS[i].name);
+}
+
+/* Закріплює за контекстом обрану реалізацію і готує її розклад ключа. */
+static void aes_set_impl(AesCtx *ctx)
+{
+    if (aes_impl_selected == NULL) {
+        aes_dispatch_init();
+    }
+
+    ctx->impl = aes_impl_selected;
+    if (ctx->impl->set_key != NULL) {
+        ctx->impl->set_key(ctx);
+    }
+}
+
+static __inline void block_encrypt(const AesCtx *ctx, const uint8_t *in, uint8_t *out)
+{
+    ctx->impl->encrypt_blocks(ctx, in, out, 1);
+}
+
+static __inline void block_decrypt(const AesCtx *ctx, const uint8_t *in, uint8_t *out)
+{
+    ctx->impl->decrypt_blocks(ctx, in, out, 1);
+}
+
 static int encrypt_ecb(AesCtx *ctx, const ByteArray *pdata, ByteArray **cdata)
 {
     uint8_t *pdata_buf = NULL;
     size_t pdata_len;
-    size_t i;
     int ret = RET_OK;
 
     if (pdata->len % AES_BLOCK_LEN != 0) {
@@ -1171,9 +1792,7 @@ static int encrypt_ecb(AesCtx *ctx, const ByteArray *pdata, ByteArray **cdata)
 
     DO(ba_to_uint8_with_alloc(pdata, &pdata_buf, &pdata_len));
 
-    for (i = 0; i < pdata_len; i += AES_BLOCK_LEN) {
-        block_encrypt(ctx, &pdata_buf[i], &pdata_buf[i]);
-    }
+    ctx->impl->encrypt_blocks(ctx, pdata_buf, pdata_buf, pdata_len / AES_BLOCK_LEN);
 
     CHECK_NOT_NULL(*cdata = ba_alloc());
     (*cdata)->buf = pdata_buf;
@@ -1191,7 +1810,6 @@ static int decrypt_ecb(AesCtx *ctx, const ByteArray *pdata, ByteArray **cdata)
 {
     uint8_t *pdata_buf = NULL;
     size_t pdata_len;
-    size_t i;
     int ret = RET_OK;
 
     if (pdata->len % AES_BLOCK_LEN != 0) {
@@ -1200,9 +1818,7 @@ static int decrypt_ecb(AesCtx *ctx, const ByteArray *pdata, ByteArray **cdata)
 
     DO(ba_to_uint8_with_alloc(pdata, &pdata_buf, &pdata_len));
 
-    for (i = 0; i < pdata_len; i += AES_BLOCK_LEN) {
-        block_decrypt(ctx, &pdata_buf[i], &pdata_buf[i]);
-    }
+    ctx->impl->decrypt_blocks(ctx, pdata_buf, pdata_buf, pdata_len / AES_BLOCK_LEN);
 
     CHECK_NOT_NULL(*cdata = ba_alloc());
     (*cdata)->buf = pdata_buf;
@@ -1324,6 +1940,7 @@ static int decrypt_cfb(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
     uint8_t *gamma = ctx->gamma;
     uint8_t *feed = ctx->feed;
     size_t data_off = 0;
+    size_t blocks;
     ByteArray *out = NULL;
 
     CHECK_PARAM(ctx != NULL);
@@ -1348,13 +1965,9 @@ static int decrypt_cfb(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
 
     if (data_off < src->len) {
         /* Расшифрование блоками по AES_BLOCK_LEN байт. */
-        for (; data_off + AES_BLOCK_LEN <= src->len; data_off += AES_BLOCK_LEN) {
-            memcpy(feed, &src->buf[data_off], AES_BLOCK_LEN);
-            aes_xor(&src->buf[data_off], gamma, &out->buf[data_off]);
-
-            block_encrypt(ctx, feed, gamma);
-        }
-
+        blocks = (src->len - data_off) / AES_BLOCK_LEN;
+        ctx->impl->decrypt_cfb(ctx, &src->buf[data_off], &out->buf[data_off], blocks);
+        data_off += blocks * AES_BLOCK_LEN;
 
         /* Расшифрование последнего неполного блока. */
         for (; data_off < src->len; data_off++) {
@@ -1408,7 +2021,6 @@ cleanup:
 static int decrypt_cbc(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
 {
     int ret = RET_OK;
-    size_t data_off = 0;
     ByteArray *out = NULL;
 
     CHECK_PARAM(ctx != NULL);
@@ -1417,12 +2029,7 @@ static int decrypt_cbc(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
 
     CHECK_NOT_NULL(out = ba_copy_with_alloc(src, 0, 0));
 
-    for (; data_off + AES_BLOCK_LEN <= src->len; data_off += AES_BLOCK_LEN) {
-        memcpy(ctx->feed, &out->buf[data_off], AES_BLOCK_LEN);
-        block_decrypt(ctx, &out->buf[data_off], &out->buf[data_off]);
-        aes_xor(&out->buf[data_off], ctx->gamma, &out->buf[data_off]);
-        memcpy(ctx->gamma, ctx->feed, AES_BLOCK_LEN);
-    }
+    ctx->impl->decrypt_cbc(ctx, out->buf, out->buf, src->len / AES_BLOCK_LEN);
 
     *dst = out;
     out = NULL;
@@ -1434,14 +2041,6 @@ cleanup:
     return ret;
 }
 
-static void gamma_gen(uint8_t *gamma, size_t size)
-{
-    do {
-        size--;
-        gamma[size]++;
-    } while (gamma[size] == 0);
-}
-
 static int encrypt_ctr(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
 {
     uint8_t *gamma = ctx->gamma;
@@ -1449,6 +2048,7 @@ static int encrypt_ctr(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
     ByteArray *out = NULL;
     int ret = RET_OK;
     size_t data_off = 0;
+    size_t blocks;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(src != NULL);
@@ -1472,13 +2072,10 @@ static int encrypt_ctr(AesCtx *ctx, const ByteArray *src, ByteArray **dst)
     }
 
     if (data_off < src->len) {
-        /* Шифрование блоками по 8 байт. */
-        for (; data_off + AES_BLOCK_LEN <= src->len; data_off += AES_BLOCK_LEN) {
-            aes_xor(&src->buf[data_off], gamma, &out->buf[data_off]);
-
-            block_encrypt(ctx, feed, gamma);
-            gamma_gen(feed, AES_BLOCK_LEN);
-        }
+        /* Шифрование блоками по AES_BLOCK_LEN байт. */
+        blocks = (src->len - data_off) / AES_BLOCK_LEN;
+        ctx->impl->crypt_ctr(ctx, &src->buf[data_off], &out->buf[data_off], blocks);
+        data_off += blocks * AES_BLOCK_LEN;
 
         /* Шифрование последнего неполного блока. */
         for (; data_off < src->len; data_off++) {
@@ -1502,6 +2099,7 @@ AesCtx *aes_alloc(void)
     int ret = RET_OK;
 
     CALLOC_CHECKED(ctx, sizeof(AesCtx));
+    ctx->impl = AES_IMPL_GENERIC;
 
 cleanup:
 
@@ -1852,29 +2450,22 @@ static void xor_bytes(uint8_t* x, const uint8_t* a, const uint8_t* b, size_t n)
     }
 }
 
-static void gcm_mul(uint8_t* r, const uint8_t* a, const uint8_t* b)
+/* Додає дані до GHASH; неповний останній блок доповнюється нулями. */
+static void ghash_update(const AesCtx* ctx, uint8_t* S, const uint8_t* data, size_t len)
 {
-    static const uint8_t ieee_bit[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
-    static const uint8_t rp[] = { 0x00, 0xE1 };
-    uint8_t Z[16], V[16];
-    uint8_t x, y, z;
+    uint8_t last[AES_BLOCK_LEN];
+    size_t blocks = len / AES_BLOCK_LEN;
 
-    memset(Z, 0, 16);
-    memcpy(V, a, 16);
-    for (x = 0; x < 128; x++) {
-        if (b[x >> 3] & ieee_bit[x & 7]) {
-            for (y = 0; y < 16; y++) {
-                Z[y] ^= V[y];
-            }
-        }
-        z = V[15] & 0x01;
-        for (y = 15; y > 0; y--) {
-            V[y] = (V[y] >> 1) | ((V[y - 1] << 7) & 0x80);
-        }
-        V[0] >>= 1;
-        V[0] ^= rp[z];
+    if (blocks > 0) {
+        ctx->ghash->blocks(ctx, S, data, blocks);
+    }
+
+    len -= blocks * AES_BLOCK_LEN;
+    if (len > 0) {
+        memset(last, 0, AES_BLOCK_LEN);
+        memcpy(last, data + blocks * AES_BLOCK_LEN, len);
+        ctx->ghash->blocks(ctx, S, last, 1);
     }
-    memcpy(r, Z, 16);
 }
 
 int aes_init_gcm(AesCtx* ctx, const ByteArray* key, const ByteArray* iv, const size_t tag_len)
@@ -1908,6 +2499,12 @@ int aes_init_gcm(AesCtx* ctx, const ByteArray* key, const ByteArray* iv, const s
     memset(H, 0, AES_BLOCK_LEN);
     block_encrypt(ctx, H, H);
 
+    if (ghash_impl_selected == NULL) {
+        aes_dispatch_init();
+    }
+    ctx->ghash = ghash_impl_selected;
+    ctx->ghash->init(ctx, H);
+
     if (iv_len == 12) {
         memcpy(J, iv->buf, 12);
         J[12] = J[13] = J[14] = 0;
@@ -1915,517 +2512,418 @@ int aes_init_gcm(AesCtx* ctx, const ByteArray* key, const ByteArray* iv, const s
     }
     else {
         uint8_t tmp[16];
-        size_t l;
-        uint8_t* ptr = iv->buf;
 
         memset(J, 0, 16);
-
-        while (iv_len > 0) {
-            l = iv_len < 16 ? iv_len : 16;
-            xor_bytes(J, J, ptr, l);
-            gcm_mul(J, J, H);
-            ptr += l;
-            iv_len -= l;
-        }
+        ghash_update(ctx, J, iv->buf, iv_len);
 
         memset(tmp, 0, 8);
         STORE64BE(iv->len * 8, tmp + 8);
-
-        xor_bytes(J, J, tmp, 16);
-        gcm_mul(J, J, H);
+        ghash_update(ctx, J, tmp, 16);
     }
 
 cleanup:
     return ret;
 }
 
-static int aes_encrypt_gcm(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* plain_text,
-    ByteArray** tag, ByteArray** cipher_text)
+int aes_init_ccm(AesCtx* ctx, const ByteArray* key, const ByteArray* nonce, const size_t tag_len)
 {
     int ret = RET_OK;
-    size_t a_len = 0;
-    size_t pt_len = 0;
-    size_t i, l;
-    uint8_t tmp[16];
-    uint8_t S[16];
-    ByteArray* ba_tag = NULL;
-    ByteArray* ba_ct = NULL;
-    uint8_t* H;
-    uint8_t* J;
+    size_t nonce_len;
 
     CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(tag != NULL);
-
-    H = ctx->gamma;
-    J = ctx->iv;
-
-    CHECK_NOT_NULL(ba_tag = ba_alloc_by_len(ctx->tag_len));
-
-    block_encrypt(ctx, ctx->iv, tmp);
-    memcpy(ba_tag->buf, tmp, ctx->tag_len);
-
-    memset(S, 0, 16);
-
-    if (auth_data) {
-        uint8_t* ptr = auth_data->buf;
-        a_len = auth_data->len;
-
-        while (a_len > 0) {
-            l = a_len < 16 ? a_len : 16;
-            xor_bytes(S, S, ptr, l);
-            gcm_mul(S, S, H);
-            ptr += l;
-            a_len -= l;
-        }
+    CHECK_PARAM(key != NULL);
+    CHECK_PARAM(nonce != NULL);
 
-        a_len = auth_data->len;
+    if ((tag_len < 4) || (tag_len > 16) || ((tag_len & 1) != 0)) {
+        SET_ERROR(RET_INVALID_PARAM);
     }
 
-    if (plain_text) {
-        uint8_t* pt_ptr = plain_text->buf;
-        uint8_t* ct_ptr;
-        pt_len = plain_text->len;
-
-        CHECK_NOT_NULL(ba_ct = ba_alloc_by_len(pt_len));
-        ct_ptr = ba_ct->buf;
-
-        while (pt_len > 0) {
-            l = pt_len < 16 ? pt_len : 16;
-
-            for (i = 15; i >= 12; i--) {
-                J[i]++;
-                if (J[i] != 0) { 
-                    break; 
-                }
-            }
-
-            block_encrypt(ctx, J, tmp);
-            xor_bytes(ct_ptr, pt_ptr, tmp, l);
-
-            xor_bytes(S, S, ct_ptr, l);
-            gcm_mul(S, S, H);
-
-            pt_ptr += l;
-            ct_ptr += l;
-            pt_len -= l;
-        }
+    nonce_len = nonce->len;
 
-        pt_len = plain_text->len;
+    if ((nonce_len < 7) || (nonce_len > 13)) {
+        SET_ERROR(RET_INVALID_PARAM);
     }
 
-    STORE64BE(a_len * 8, tmp);
-    STORE64BE(pt_len * 8, tmp + 8);
-
-    xor_bytes(S, S, tmp, 16);
-    gcm_mul(S, S, H);
-
-    xor_bytes(ba_tag->buf, ba_tag->buf, S, ctx->tag_len);
+    DO(aes_base_init(ctx, key));
+    ctx->mode_id = AES_MODE_CCM;
+    ctx->tag_len = tag_len;
 
-    *tag = ba_tag;
-    ba_tag = NULL;
-    if (cipher_text) {
-        *cipher_text = ba_ct;
-        ba_ct = NULL;
-    }
+    ctx->iv[0] = (uint8_t)nonce_len;
+    memcpy(ctx->iv + 1, nonce->buf, nonce_len);
 
 cleanup:
-    ba_free(ba_tag);
-    ba_free(ba_ct);
     return ret;
 }
 
-static int aes_decrypt_gcm(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* cipher_text,
-    const ByteArray* tag, ByteArray** plain_text)
-{
-    int ret = RET_OK;
-    size_t a_len = 0;
-    size_t ct_len = 0;
-    size_t i, l;
-    uint8_t _tag[16];
-    uint8_t tmp[16];
-    uint8_t S[16];
-    ByteArray* ba_pt = NULL;
-    uint8_t* H;
-    uint8_t* J;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(tag != NULL);
-
-    H = ctx->gamma;
-    J = ctx->iv;
-
-    block_encrypt(ctx, ctx->iv, _tag);
+#define AEAD_CTR_BLOCKS 8
 
-    memset(S, 0, 16);
-
-    if (auth_data) {
-        uint8_t* ptr = auth_data->buf;
-        a_len = auth_data->len;
+static void aead_ctr_inc(AesAead* aead)
+{
+    size_t i;
 
-        while (a_len > 0) {
-            l = a_len < 16 ? a_len : 16;
-            xor_bytes(S, S, ptr, l);
-            gcm_mul(S, S, H);
-            ptr += l;
-            a_len -= l;
+    for (i = AES_BLOCK_LEN; i-- > AES_BLOCK_LEN - aead->ctr_width; ) {
+        if (++aead->ctr[i] != 0) {
+            break;
         }
-
-        a_len = auth_data->len;
     }
+}
 
-    if (cipher_text) {
-        uint8_t* ct_ptr = cipher_text->buf;
-        uint8_t* pt_ptr;
-        ct_len = cipher_text->len;
-
-        CHECK_NOT_NULL(ba_pt = ba_alloc_by_len(ct_len));
-        pt_ptr = ba_pt->buf;
-
-        while (ct_len > 0) {
-            l = ct_len < 16 ? ct_len : 16;
-
-            xor_bytes(S, S, ct_ptr, l);
-            gcm_mul(S, S, H);
+/* Гамування: лічильник збільшується перед кожним блоком, повні блоки шифруються пакетами. */
+static void aead_crypt(AesCtx* ctx, const uint8_t* in, uint8_t* out, size_t len)
+{
+    uint8_t ctr[AEAD_CTR_BLOCKS * AES_BLOCK_LEN];
+    uint8_t ks[AEAD_CTR_BLOCKS * AES_BLOCK_LEN];
+    AesAead* aead = &ctx->aead;
+    size_t i, n;
 
-            for (i = 15; i >= 12; i--) {
-                J[i]++;
-                if (J[i] != 0) {
-                    break;
-                }
-            }
+    while (len > 0 && aead->gamma_off < AES_BLOCK_LEN) {
+        *out++ = *in++ ^ aead->gamma[aead->gamma_off++];
+        len--;
+    }
 
-            block_encrypt(ctx, J, tmp);
-            xor_bytes(pt_ptr, ct_ptr, tmp, l);
+    while (len >= AES_BLOCK_LEN) {
+        n = len / AES_BLOCK_LEN;
+        if (n > AEAD_CTR_BLOCKS) {
+            n = AEAD_CTR_BLOCKS;
+        }
 
-            pt_ptr += l;
-            ct_ptr += l;
-            ct_len -= l;
+        for (i = 0; i < n; i++) {
+            aead_ctr_inc(aead);
+            memcpy(ctr + i * AES_BLOCK_LEN, aead->ctr, AES_BLOCK_LEN);
         }
+        ctx->impl->encrypt_blocks(ctx, ctr, ks, n);
+        xor_bytes(out, in, ks, n * AES_BLOCK_LEN);
 
-        ct_len = cipher_text->len;
+        in += n * AES_BLOCK_LEN;
+        out += n * AES_BLOCK_LEN;
+        len -= n * AES_BLOCK_LEN;
     }
 
-    STORE64BE(a_len * 8, tmp);
-    STORE64BE(ct_len * 8, tmp + 8);
-
-    xor_bytes(S, S, tmp, 16);
-    gcm_mul(S, S, H);
-
-    xor_bytes(_tag, _tag, S, ctx->tag_len);
-
-    if (memcmp(_tag, tag->buf, ctx->tag_len)) {
-        SET_ERROR(RET_VERIFY_FAILED);
+    if (len > 0) {
+        aead_ctr_inc(aead);
+        block_encrypt(ctx, aead->ctr, aead->gamma);
+        xor_bytes(out, in, aead->gamma, len);
+        aead->gamma_off = len;
     }
+}
 
-    if (cipher_text) {
-        *plain_text = ba_pt;
-        ba_pt = NULL;
+static void aead_auth_blocks(AesCtx* ctx, const uint8_t* in, size_t blocks)
+{
+    if (ctx->mode_id == AES_MODE_GCM) {
+        ctx->ghash->blocks(ctx, ctx->aead.mac, in, blocks);
+    }
+    else {
+        for (; blocks > 0; blocks--, in += AES_BLOCK_LEN) {
+            aes_xor(ctx->aead.mac, in, ctx->aead.mac);
+            block_encrypt(ctx, ctx->aead.mac, ctx->aead.mac);
+        }
     }
-
-cleanup:
-    ba_free(ba_pt);
-    return ret;
 }
 
-int aes_init_ccm(AesCtx* ctx, const ByteArray* key, const ByteArray* nonce, const size_t tag_len)
+/* Додає дані до GHASH (GCM) або CBC-MAC (CCM); неповний блок накопичується у buf. */
+static void aead_auth_update(AesCtx* ctx, const uint8_t* in, size_t len)
 {
-    int ret = RET_OK;
-    size_t nonce_len;
+    AesAead* aead = &ctx->aead;
+    size_t l;
 
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(key != NULL);
-    CHECK_PARAM(nonce != NULL);
+    if (aead->buf_len > 0) {
+        l = AES_BLOCK_LEN - aead->buf_len;
+        if (l > len) {
+            l = len;
+        }
+        memcpy(aead->buf + aead->buf_len, in, l);
+        aead->buf_len += l;
+        in += l;
+        len -= l;
 
-    if ((tag_len < 4) || (tag_len > 16) || ((tag_len & 1) != 0)) {
-        SET_ERROR(RET_INVALID_PARAM);
+        if (aead->buf_len < AES_BLOCK_LEN) {
+            return;
+        }
+        aead_auth_blocks(ctx, aead->buf, 1);
+        aead->buf_len = 0;
     }
 
-    nonce_len = nonce->len;
-
-    if ((nonce_len < 7) || (nonce_len > 13)) {
-        SET_ERROR(RET_INVALID_PARAM);
+    l = len / AES_BLOCK_LEN;
+    if (l > 0) {
+        aead_auth_blocks(ctx, in, l);
+        in += l * AES_BLOCK_LEN;
+        len -= l * AES_BLOCK_LEN;
     }
 
-    DO(aes_base_init(ctx, key));
-    ctx->mode_id = AES_MODE_CCM;
-    ctx->tag_len = tag_len;
+    if (len > 0) {
+        memcpy(aead->buf, in, len);
+        aead->buf_len = len;
+    }
+}
 
-    ctx->iv[0] = (uint8_t)nonce_len;
-    memcpy(ctx->iv + 1, nonce->buf, nonce_len);
+static void aead_auth_pad(AesCtx* ctx)
+{
+    AesAead* aead = &ctx->aead;
 
-cleanup:
-    return ret;
+    if (aead->buf_len > 0) {
+        memset(aead->buf + aead->buf_len, 0, AES_BLOCK_LEN - aead->buf_len);
+        aead_auth_blocks(ctx, aead->buf, 1);
+        aead->buf_len = 0;
+    }
 }
 
-static int aes_encrypt_ccm(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* plain_text,
-    ByteArray** tag, ByteArray** cipher_text)
+/* CCM: блок B0, кодування довжини відкритих даних і лічильник A0. */
+static int aead_ccm_start(AesCtx* ctx)
 {
     int ret = RET_OK;
+    AesAead* aead = &ctx->aead;
+    size_t nonce_len = ctx->iv[0];
+    size_t len_len = 15 - nonce_len;
+    uint64_t q = aead->data_total;
+    uint8_t b0[AES_BLOCK_LEN];
     size_t l;
-    size_t q = 0;
-    size_t nonce_len;
-    size_t pt_len_len;
-    size_t pt_len = 0;
-    size_t aad_len = 0;
-    uint8_t Y[16];
-    uint8_t S[16];
-    uint8_t tmp[16];
-    ByteArray* ba_tag = NULL;
-    ByteArray* ba_ct = NULL;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(tag != NULL);
-
-    memcpy(tmp, ctx->iv, 16);
 
-    if (auth_data) {
-        aad_len = auth_data->len;
-    }
+    b0[0] = (aead->aad_total > 0) ? 0x40 : 0x00;
+    b0[0] |= ((ctx->tag_len - 2) / 2) << 3;
+    b0[0] |= len_len - 1;
+    memcpy(b0 + 1, ctx->iv + 1, nonce_len);
 
-    if (plain_text) {
-        pt_len = plain_text->len;
-    }
-
-    nonce_len = tmp[0];
-    pt_len_len = 15 - nonce_len;
-
-    tmp[0] = (aad_len > 0) ? 0x40 : 0x00;
-    tmp[0] |= ((ctx->tag_len - 2) / 2) << 3;
-    tmp[0] |= pt_len_len - 1;
-
-    q = pt_len;
-    for (l = 0; l < pt_len_len; l++, q >>= 8) {
-        tmp[15 - l] = q & 0xFF;
+    for (l = 0; l < len_len; l++, q >>= 8) {
+        b0[15 - l] = q & 0xFF;
     }
 
     if (q != 0) {
         SET_ERROR(RET_INVALID_PARAM);
     }
 
-    block_encrypt(ctx, tmp, Y);
-
-    if (aad_len > 0) {
-        uint8_t* ptr = auth_data->buf;
+    block_encrypt(ctx, b0, aead->mac);
 
-        memset(tmp, 0, 16);
-
-        if (aad_len < 0xFF00) {
-            STORE16BE(aad_len, tmp);
-            l = aad_len < (16 - 2) ? aad_len : (16 - 2);
-            memcpy(tmp + 2, ptr, l);
+    if (aead->aad_total > 0) {
+        if (aead->aad_total < 0xFF00) {
+            STORE16BE(aead->aad_total, aead->buf);
+            aead->buf_len = 2;
         }
-        else {
-            tmp[0] = 0xFF;
-            tmp[1] = 0xFE;
-            STORE32BE(aad_len, tmp + 2);
-            l = aad_len < (16 - 6) ? aad_len : (16 - 6);
-            memcpy(tmp + 6, ptr, l);
+        else if (aead->aad_total <= 0xFFFFFFFF) {
+            aead->buf[0] = 0xFF;
+            aead->buf[1] = 0xFE;
+            STORE32BE(aead->aad_total, aead->buf + 2);
+            aead->buf_len = 6;
         }
-
-        xor_bytes(Y, Y, tmp, 16);
-        block_encrypt(ctx, Y, Y);
-
-        aad_len -= l;
-        ptr += l;
-
-        while (aad_len > 0)
-        {
-            l = aad_len < 16 ? aad_len : 16;
-            xor_bytes(Y, Y, ptr, l);
-            block_encrypt(ctx, Y, Y);
-            aad_len -= l;
-            ptr += l;
+        else {
+            aead->buf[0] = 0xFF;
+            aead->buf[1] = 0xFF;
+            STORE64BE(aead->aad_total, aead->buf + 2);
+            aead->buf_len = 10;
         }
     }
 
-    tmp[0] = (uint8_t)(pt_len_len - 1);
-    memcpy(tmp + 1, ctx->iv + 1, nonce_len);
-    memset(tmp + 1 + nonce_len, 0, pt_len_len);
+    memset(aead->ctr, 0, AES_BLOCK_LEN);
+    aead->ctr[0] = (uint8_t)(len_len - 1);
+    memcpy(aead->ctr + 1, ctx->iv + 1, nonce_len);
+    block_encrypt(ctx, aead->ctr, aead->tag_mask);
+    aead->ctr_width = len_len;
 
-    block_encrypt(ctx, tmp, S);
+cleanup:
+    return ret;
+}
 
-    CHECK_NOT_NULL(ba_tag = ba_alloc_by_len(ctx->tag_len));
-    memcpy(ba_tag->buf, S, ctx->tag_len);
+static int aead_init(AesCtx* ctx, bool encrypt, uint64_t auth_data_len, uint64_t data_len)
+{
+    int ret = RET_OK;
+    AesAead* aead;
 
-    if (plain_text) {
-        int i;
-        uint8_t* ct_ptr;
-        uint8_t* pt_ptr = plain_text->buf;
+    CHECK_PARAM(ctx != NULL);
 
-        CHECK_NOT_NULL(ba_ct = ba_alloc_by_len(plain_text->len));
-        ct_ptr = ba_ct->buf;
+    aead = &ctx->aead;
+    memset(aead, 0, sizeof(AesAead));
+    aead->encrypt = encrypt;
+    aead->gamma_off = AES_BLOCK_LEN;
+    aead->aad_total = auth_data_len;
+    aead->data_total = data_len;
 
-        while (pt_len > 0)
-        {
-            l = pt_len < 16 ? pt_len : 16;
+    switch (ctx->mode_id) {
+    case AES_MODE_GCM:
+        memcpy(aead->ctr, ctx->iv, AES_BLOCK_LEN);
+        aead->ctr_width = 4;
+        block_encrypt(ctx, ctx->iv, aead->tag_mask);
+        break;
+    case AES_MODE_CCM:
+        DO(aead_ccm_start(ctx));
+        break;
+    default:
+        SET_ERROR(RET_INVALID_CTX_MODE);
+    }
 
-            xor_bytes(Y, Y, pt_ptr, l);
-            block_encrypt(ctx, Y, Y);
+    aead->stage = AES_AEAD_AAD;
 
-            for (i = 15; i >= 0; i--) {
-                tmp[i]++;
-                if (tmp[i] != 0) {
-                    break;
-                }
-            }
+cleanup:
+    return ret;
+}
 
-            block_encrypt(ctx, tmp, S);
-            xor_bytes(ct_ptr, pt_ptr, S, l);
+/* Завершує дані автентифікації перед першим блоком повідомлення. */
+static int aead_begin_data(AesCtx* ctx)
+{
+    int ret = RET_OK;
+    AesAead* aead = &ctx->aead;
 
-            pt_len -= l;
-            pt_ptr += l;
-            ct_ptr += l;
+    if (aead->stage == AES_AEAD_AAD) {
+        if (aead->aad_len != aead->aad_total) {
+            SET_ERROR(RET_INVALID_DATA_LEN);
         }
+        aead_auth_pad(ctx);
+        aead->stage = AES_AEAD_DATA;
     }
 
-    xor_bytes(ba_tag->buf, ba_tag->buf, Y, ctx->tag_len);
-
-    *tag = ba_tag;
-    ba_tag = NULL;
-    if (cipher_text) {
-        *cipher_text = ba_ct;
-        ba_ct = NULL;
+    if (aead->stage != AES_AEAD_DATA) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
     }
 
 cleanup:
-    ba_free(ba_tag);
-    ba_free(ba_ct);
     return ret;
 }
 
-static int aes_decrypt_ccm(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* cipher_text,
-    const ByteArray* tag, ByteArray** plain_text)
+static int aead_update(AesCtx* ctx, bool encrypt, const ByteArray* in, ByteArray** out)
 {
     int ret = RET_OK;
-    size_t l;
-    size_t q = 0;
-    size_t nonce_len;
-    size_t ct_len_len;
-    size_t ct_len = 0;
-    size_t aad_len = 0;
-    uint8_t _tag[16];
-    uint8_t Y[16];
-    uint8_t S[16];
-    uint8_t tmp[16];
-    ByteArray* ba_pt = NULL;
+    AesAead* aead;
+    ByteArray* ba_out = NULL;
 
     CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(tag != NULL);
+    CHECK_PARAM(in != NULL);
+    CHECK_PARAM(out != NULL);
 
-    memcpy(tmp, ctx->iv, 16);
+    aead = &ctx->aead;
+    if (aead->encrypt != encrypt) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
+    }
+    DO(aead_begin_data(ctx));
 
-    if (auth_data) {
-        aad_len = auth_data->len;
+    if (in->len > aead->data_total - aead->data_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    if (cipher_text) {
-        ct_len = cipher_text->len;
+    CHECK_NOT_NULL(ba_out = ba_alloc_by_len(in->len));
+    aead_crypt(ctx, in->buf, ba_out->buf, in->len);
+
+    /* GCM автентифікує шифртекст, CCM - відкритий текст. */
+    if ((ctx->mode_id == AES_MODE_GCM) == encrypt) {
+        aead_auth_update(ctx, ba_out->buf, ba_out->len);
     }
+    else {
+        aead_auth_update(ctx, in->buf, in->len);
+    }
+    aead->data_len += in->len;
 
-    nonce_len = tmp[0];
-    ct_len_len = 15 - nonce_len;
+    *out = ba_out;
+    ba_out = NULL;
 
-    tmp[0] = (aad_len > 0) ? 0x40 : 0x00;
-    tmp[0] |= ((ctx->tag_len - 2) / 2) << 3;
-    tmp[0] |= ct_len_len - 1;
+cleanup:
+    ba_free(ba_out);
+    return ret;
+}
+
+static int aead_final(AesCtx* ctx, bool encrypt, uint8_t* tag)
+{
+    int ret = RET_OK;
+    AesAead* aead = &ctx->aead;
+    uint8_t len_block[AES_BLOCK_LEN];
 
-    q = ct_len;
-    for (l = 0; l < ct_len_len; l++, q >>= 8) {
-        tmp[15 - l] = q & 0xFF;
+    if (aead->encrypt != encrypt) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
     }
+    DO(aead_begin_data(ctx));
 
-    if (q != 0) {
-        SET_ERROR(RET_INVALID_PARAM);
+    if (aead->data_len != aead->data_total) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    block_encrypt(ctx, tmp, Y);
+    aead_auth_pad(ctx);
+    if (ctx->mode_id == AES_MODE_GCM) {
+        STORE64BE(aead->aad_len * 8, len_block);
+        STORE64BE(aead->data_len * 8, len_block + 8);
+        ctx->ghash->blocks(ctx, aead->mac, len_block, 1);
+    }
 
-    if (aad_len > 0) {
-        uint8_t* ptr = auth_data->buf;
+    xor_bytes(tag, aead->tag_mask, aead->mac, ctx->tag_len);
+
+cleanup:
+    if (ctx != NULL) {
+        ctx->aead.stage = AES_AEAD_NONE;
+    }
+    return ret;
+}
 
-        memset(tmp, 0, 16);
+int aes_encrypt_mac_init(AesCtx* ctx, uint64_t auth_data_len, uint64_t data_len)
+{
+    return aead_init(ctx, true, auth_data_len, data_len);
+}
 
-        if (aad_len < 0xFF00) {
-            STORE16BE(aad_len, tmp);
-            l = aad_len < (16 - 2) ? aad_len : (16 - 2);
-            memcpy(tmp + 2, ptr, l);
-        }
-        else {
-            tmp[0] = 0xFF;
-            tmp[1] = 0xFE;
-            STORE32BE(aad_len, tmp + 2);
-            l = aad_len < (16 - 6) ? aad_len : (16 - 6);
-            memcpy(tmp + 6, ptr, l);
-        }
+int aes_decrypt_mac_init(AesCtx* ctx, uint64_t auth_data_len, uint64_t data_len)
+{
+    return aead_init(ctx, false, auth_data_len, data_len);
+}
 
-        xor_bytes(Y, Y, tmp, 16);
-        block_encrypt(ctx, Y, Y);
+int aes_update_auth_data(AesCtx* ctx, const ByteArray* auth_data)
+{
+    int ret = RET_OK;
 
-        aad_len -= l;
-        ptr += l;
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(auth_data != NULL);
 
-        while (aad_len > 0)
-        {
-            l = aad_len < 16 ? aad_len : 16;
-            xor_bytes(Y, Y, ptr, l);
-            block_encrypt(ctx, Y, Y);
-            aad_len -= l;
-            ptr += l;
-        }
+    if (ctx->aead.stage != AES_AEAD_AAD) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
     }
 
-    tmp[0] = (uint8_t)(ct_len_len - 1);
-    memcpy(tmp + 1, ctx->iv + 1, nonce_len);
-    memset(tmp + 1 + nonce_len, 0, ct_len_len);
+    if (auth_data->len > ctx->aead.aad_total - ctx->aead.aad_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
+    }
 
-    block_encrypt(ctx, tmp, S);
+    aead_auth_update(ctx, auth_data->buf, auth_data->len);
+    ctx->aead.aad_len += auth_data->len;
 
-    memcpy(_tag, S, ctx->tag_len);
+cleanup:
+    return ret;
+}
 
-    if (cipher_text) {
-        int i;
-        uint8_t* pt_ptr;
-        uint8_t* ct_ptr = cipher_text->buf;
+int aes_encrypt_mac_update(AesCtx* ctx, const ByteArray* data, ByteArray** encrypted_data)
+{
+    return aead_update(ctx, true, data, encrypted_data);
+}
 
-        CHECK_NOT_NULL(ba_pt = ba_alloc_by_len(cipher_text->len));
-        pt_ptr = ba_pt->buf;
+int aes_decrypt_mac_update(AesCtx* ctx, const ByteArray* encrypted_data, ByteArray** data)
+{
+    return aead_update(ctx, false, encrypted_data, data);
+}
 
-        while (ct_len > 0)
-        {
-            l = ct_len < 16 ? ct_len : 16;
+int aes_encrypt_mac_final(AesCtx* ctx, ByteArray** mac)
+{
+    int ret = RET_OK;
+    ByteArray* ba_mac = NULL;
 
-            for (i = 15; i >= 0; i--) {
-                tmp[i]++;
-                if (tmp[i] != 0) {
-                    break;
-                }
-            }
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(mac != NULL);
 
-            block_encrypt(ctx, tmp, S);
-            xor_bytes(pt_ptr, ct_ptr, S, l);
+    CHECK_NOT_NULL(ba_mac = ba_alloc_by_len(ctx->tag_len));
+    DO(aead_final(ctx, true, ba_mac->buf));
 
-            xor_bytes(Y, Y, pt_ptr, l);
-            block_encrypt(ctx, Y, Y);
+    *mac = ba_mac;
+    ba_mac = NULL;
 
-            ct_len -= l;
-            pt_ptr += l;
-            ct_ptr += l;
-        }
-    }
+cleanup:
+    ba_free(ba_mac);
+    return ret;
+}
 
-    xor_bytes(_tag, _tag, Y, ctx->tag_len);
+int aes_decrypt_mac_final(AesCtx* ctx, const ByteArray* mac)
+{
+    int ret = RET_OK;
+    uint8_t tag[AES_BLOCK_LEN];
 
-    if (memcmp(_tag, tag->buf, ctx->tag_len)) {
-        SET_ERROR(RET_VERIFY_FAILED);
-    }
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(mac != NULL);
+
+    DO(aead_final(ctx, false, tag));
 
-    if (plain_text) {
-        *plain_text = ba_pt;
-        ba_pt = NULL;
+    if ((mac->len < ctx->tag_len) || memcmp(tag, mac->buf, ctx->tag_len)) {
+        SET_ERROR(RET_VERIFY_FAILED);
     }
 
 cleanup:
-    ba_free(ba_pt);
     return ret;
 }
 
@@ -2433,23 +2931,31 @@ int aes_encrypt_mac(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* da
     ByteArray** encrypted_data)
 {
     int ret = RET_OK;
+    ByteArray* ba_mac = NULL;
+    ByteArray* ba_enc = NULL;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(mac != NULL);
 
-    switch (ctx->mode_id) {
-    case AES_MODE_GCM:
-        DO(aes_encrypt_gcm(ctx, auth_data, data, mac, encrypted_data));
-        break;
-    case AES_MODE_CCM:
-        DO(aes_encrypt_ccm(ctx, auth_data, data, mac, encrypted_data));
-        break;
-    default:
-        SET_ERROR(RET_INVALID_CTX_MODE);
+    DO(aes_encrypt_mac_init(ctx, auth_data ? auth_data->len : 0, data ? data->len : 0));
+    if (auth_data) {
+        DO(aes_update_auth_data(ctx, auth_data));
+    }
+    if (data) {
+        DO(aes_encrypt_mac_update(ctx, data, &ba_enc));
     }
+    DO(aes_encrypt_mac_final(ctx, &ba_mac));
 
-cleanup:
+    *mac = ba_mac;
+    ba_mac = NULL;
+    if (encrypted_data) {
+        *encrypted_data = ba_enc;
+        ba_enc = NULL;
+    }
 
+cleanup:
+    ba_free(ba_mac);
+    ba_free(ba_enc);
     return ret;
 }
 
@@ -2457,23 +2963,27 @@ int aes_decrypt_mac(AesCtx* ctx, const ByteArray* auth_data, const ByteArray* en
     ByteArray** data)
 {
     int ret = RET_OK;
+    ByteArray* ba_data = NULL;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(mac != NULL);
 
-    switch (ctx->mode_id) {
-    case AES_MODE_GCM:
-        DO(aes_decrypt_gcm(ctx, auth_data, encrypted_data, mac, data));
-        break;
-    case AES_MODE_CCM:
-        DO(aes_decrypt_ccm(ctx, auth_data, encrypted_data, mac, data));
-        break;
-    default:
-        SET_ERROR(RET_INVALID_CTX_MODE);
+    DO(aes_decrypt_mac_init(ctx, auth_data ? auth_data->len : 0, encrypted_data ? encrypted_data->len : 0));
+    if (auth_data) {
+        DO(aes_update_auth_data(ctx, auth_data));
+    }
+    if (encrypted_data) {
+        DO(aes_decrypt_mac_update(ctx, encrypted_data, &ba_data));
     }
+    DO(aes_decrypt_mac_final(ctx, mac));
 
-cleanup:
+    if (encrypted_data) {
+        *data = ba_data;
+        ba_data = NULL;
+    }
 
+cleanup:
+    ba_free(ba_data);
     return ret;
 }
 
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define FILE_MARKER "uapkic/cpu-features-internal.c"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu-features-internal.h"
+#include "math-gf2m-internal.h"
+#include "pthread-internal.h"
+
+#if defined(CPU_X86_64)
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#endif
+
+#define CPU_FEATURES_UNKNOWN 0x80000000
+
+static volatile uint32_t features = CPU_FEATURES_UNKNOWN;
+static volatile uint32_t features_mask = CPU_FEATURES_ALL;
+
+static const char* FEATURE_NAMES[] = {
+    "pclmul", "avx2", "vpclmul", "ssse3", "sse4.1", "aesni", "sha",
+    "avx512bw", "avx512vbmi", "gfni"
+};
+
+static const char* PRIMITIVE_NAMES[CPU_PRIMITIVE_COUNT] = {
+    "gf2mMul", "sha1", "sha256", "sha512", "sha256Multi", "sha512Multi", "aes", "ghash", "dstu7624",
+    "dstu7624Gmac"
+};
+
+static const char* volatile primitive_impls[CPU_PRIMITIVE_COUNT];
+
+#if defined(CPU_X86_64)
+
+static void cpu_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)info[0];
+    regs[1] = (uint32_t)info[1];
+    regs[2] = (uint32_t)info[2];
+    regs[3] = (uint32_t)info[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t cpu_xgetbv(void)
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+static uint32_t cpu_detect(void)
+{
+    uint32_t regs[4];
+    uint32_t max_leaf;
+    uint32_t out = 0;
+    int ymm = 0;
+    int zmm = 0;
+
+    cpu_cpuid(0, 0, regs);
+    max_leaf = regs[0];
+    if (max_leaf < 1) {
+        return 0;
+    }
+
+    cpu_cpuid(1, 0, regs);
+    if (regs[2] & (1u << 1)) {
+        out |= CPU_FEATURE_PCLMUL;
+    }
+    if (regs[2] & (1u << 9)) {
+        out |= CPU_FEATURE_SSSE3;
+    }
+    if (regs[2] & (1u << 19)) {
+        out |= CPU_FEATURE_SSE41;
+    }
+    if (regs[2] & (1u << 25)) {
+        out |= CPU_FEATURE_AESNI;
+    }
+
+    /* OSXSAVE + AVX, ОС зберігає стан XMM і YMM. */
+    if ((regs[2] & (1u << 27)) && (regs[2] & (1u << 28))) {
+        uint64_t xcr0 = cpu_xgetbv();
+
+        ymm = ((xcr0 & 0x6) == 0x6);
+        /* Додатково opmask, ZMM0-15 (старші половини) і ZMM16-31. */
+        zmm = ((xcr0 & 0xE6) == 0xE6);
+    }
+
+    if (max_leaf >= 7) {
+        cpu_cpuid(7, 0, regs);
+        if (regs[1] & (1u << 29)) {
+            out |= CPU_FEATURE_SHANI;
+        }
+        if (regs[2] & (1u << 8)) {
+            out |= CPU_FEATURE_GFNI;
+        }
+    }
+
+    if (max_leaf >= 7 && ymm) {
+        if (regs[1] & (1u << 5)) {
+            out |= CPU_FEATURE_AVX2;
+            if (regs[2] & (1u << 10)) {
+                out |= CPU_FEATURE_VPCLMUL;
+            }
+        }
+    }
+
+    if (max_leaf >= 7 && zmm) {
+        /* AVX-512F + AVX-512BW */
+        if ((regs[1] & (1u << 16)) && (regs[1] & (1u << 30))) {
+            out |= CPU_FEATURE_AVX512BW;
+            if (regs[2] & (1u << 1)) {
+                out |= CPU_FEATURE_AVX512VBMI;
+            }
+        }
+    }
+
+    return out;
+}
+
+#else
+
+static uint32_t cpu_detect(void)
+{
+    return 0;
+}
+
+#endif
+
+static int cpu_env_generic(void)
+{
+    const char* value = getenv(CPU_FEATURES_ENV_GENERIC);
+
+    return (value != NULL) && (value[0] != '\0') && (strcmp(value, "0") != 0);
+}
+
+uint32_t cpu_features(void)
+{
+    uint32_t out = features;
+
+    /* Повторне визначення з різних потоків дає той самий результат. */
+    if (out == CPU_FEATURES_UNKNOWN) {
+        out = cpu_env_generic() ? 0 : cpu_detect();
+        features = out;
+    }
+
+    return out & features_mask;
+}
+
+void cpu_dispatch_init(void)
+{
+    gf2m_dispatch_init();
+    sha1_dispatch_init();
+    sha2_dispatch_init();
+    aes_dispatch_init();
+    dstu7624_dispatch_init();
+}
+
+void cpu_dispatch_set(CpuPrimitive primitive, const char* impl)
+{
+    if ((size_t)primitive < CPU_PRIMITIVE_COUNT) {
+        primitive_impls[primitive] = impl;
+    }
+}
+
+void cpu_features_set_mask(uint32_t mask)
+{
+    features_mask = mask & CPU_FEATURES_ALL;
+    cpu_dispatch_init();
+}
+
+uint32_t cpu_features_get(void)
+{
+    return cpu_features();
+}
+
+const char* cpu_feature_name(uint32_t feature)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(FEATURE_NAMES) / sizeof(FEATURE_NAMES[0]); i++) {
+        if (feature == (1u << i)) {
+            return FEATURE_NAMES[i];
+        }
+    }
+
+    return NULL;
+}
+
+const char* cpu_primitive_name(CpuPrimitive primitive)
+{
+    return ((size_t)primitive < CPU_PRIMITIVE_COUNT) ? PRIMITIVE_NAMES[primitive] : NULL;
+}
+
+const char* cpu_primitive_impl(CpuPrimitive primitive)
+{
+    if ((size_t)primitive >= CPU_PRIMITIVE_COUNT) {
+        return NULL;
+    }
+
+    if (primitive_impls[primitive] == NULL) {
+        cpu_dispatch_init();
+    }
+
+    return primitive_impls[primitive];
+}
+
+size_t cpu_count(void)
+{
+    return pthread_cpu_count();
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UAPKIC_CPU_FEATURES_INTERNAL_H
+#define UAPKIC_CPU_FEATURES_INTERNAL_H
+
+#include <stdint.h>
+#include "cpu-features.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+/** Компілятор підтримує інтринсики x86-64 для окремих функцій без глобальних прапорців. */
+# define CPU_X86_64
+# if defined(_MSC_VER) && !defined(__clang__)
+#  define CPU_TARGET(_features)
+# else
+#  define CPU_TARGET(_features) __attribute__((target(_features)))
+# endif
+#endif
+
+/**
+ * Повертає набір розширень процесора, доступних для оптимізованих реалізацій.
+ * Визначається один раз при першому виклику з урахуванням маски та змінної оточення
+ * CPU_FEATURES_ENV_GENERIC.
+ *
+ * @return комбінація прапорців CPU_FEATURE_*
+ */
+uint32_t cpu_features(void);
+
+/**
+ * Обирає реалізації всіх примітивів за поточним набором розширень.
+ * Викликається з uapkic_init і cpu_features_set_mask.
+ */
+void cpu_dispatch_init(void);
+
+/**
+ * Обирають реалізації перетворень SHA-1, SHA-2, AES і ДСТУ 7624 (sha1.c, sha2.c, aes.c, dstu7624.c).
+ */
+void sha1_dispatch_init(void);
+void sha2_dispatch_init(void);
+void aes_dispatch_init(void);
+void dstu7624_dispatch_init(void);
+
+/**
+ * Запам'ятовує обрану реалізацію примітива для звіту.
+ *
+ * @param primitive примітив
+ * @param impl назва реалізації (статичний рядок)
+ */
+void cpu_dispatch_set(CpuPrimitive primitive, const char* impl);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -88,15 +88,20 @@ int dstu4145_get_pubkey(const EcCtx *ctx, const ByteArray *d, ByteArray **qx, By
 
     /* Получение открытого ключа. */
     CHECK_NOT_NULL(Q = ec_point_alloc(params->ec2m->len));
-    if (ctx->params->precomp_p == NULL) {
-        int sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
-        if (sign_win_opt_level == 0) {
-            sign_win_opt_level = EC_DEFAULT_WIN_WIDTH;
-        }
+    if (params->ec2m->use_ladder) {
+        ec2m_mul(params->ec2m, params->p, d_wa, Q);
+    }
+    else {
+        if (ctx->params->precomp_p == NULL) {
+            int sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
+            if (sign_win_opt_level == 0) {
+                sign_win_opt_level = EC_DEFAULT_WIN_WIDTH;
+            }
 
-        DO(ec_set_sign_precomp(ctx, 0, sign_win_opt_level));
+            DO(ec_set_sign_precomp(ctx, 0, sign_win_opt_level));
+        }
+        DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, d_wa, NULL, NULL, Q));
     }
-    DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, d_wa, NULL, NULL, Q));
 
     /* Инвертируем точку эллиптической кривой. */
     gf2m_mod_add(Q->x, Q->y, Q->y);
@@ -184,27 +189,29 @@ cleanup:
     return ret;
 }
 
-static int dstu4145_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* e, ByteArray** r, ByteArray** s)
+static int dstu4145_sign_internal(const EcCtx* ctx, EcScratch* scratch, const ByteArray* H, const WordArray* e,
+        const ECPoint* kp, ByteArray** r, ByteArray** s)
 {
     const EcParamsCtx* params;
     WordArray* res = NULL;
     WordArray* h = NULL;
+    WordArray* d = NULL;
     WordArray* wr = NULL;
     WordArray* ws = NULL;
     ByteArray* r_ba = NULL;
     ByteArray* s_ba = NULL;
-    ECPoint* rec = NULL;
+    ECPoint rec = { NULL, NULL, NULL };
     int ret = RET_OK;
     size_t words, n_bit_len;
 
     params = ctx->params;
     words = params->ec2m->len;
 
-    CHECK_NOT_NULL(h = wa_alloc_from_ba(H));
+    CHECK_PARAM(H->len != 0);
+    CHECK_NOT_NULL(h = ec_scratch_wa(scratch, words));
+    wa_from_le(H->buf, H->len, h);
     int_truncate(h, params->m);
 
-    wa_change_len(h, words);
-
     if (params->is_onb) {
         DO(onb_to_pb(params, h));
     }
@@ -213,13 +220,13 @@ static int dstu4145_sign_internal(const EcCtx* ctx, const ByteArray* H, const Wo
         h->buf[0] = 1;
     }
 
-    CHECK_NOT_NULL(rec = ec_point_alloc(words));
-    CHECK_NOT_NULL(wr = wa_alloc(words));
-    CHECK_NOT_NULL(ws = wa_alloc(params->n->len));
+    CHECK_NOT_NULL(wr = ec_scratch_wa(scratch, words));
+    CHECK_NOT_NULL(ws = ec_scratch_wa(scratch, params->n->len));
 
-    DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, e, NULL, NULL, rec));
+    DO(ec_scratch_point(scratch, words, &rec));
+    DO(ec_sign_nonce_point(ctx, e, kp, &rec));
 
-    gf2m_mod_mul(params->ec2m->gf2m, rec->x, h, wr);
+    gf2m_mod_mul(params->ec2m->gf2m, rec.x, h, wr);
 
     if (params->is_onb) {
         DO(pb_to_onb(params, wr));
@@ -233,11 +240,12 @@ static int dstu4145_sign_internal(const EcCtx* ctx, const ByteArray* H, const Wo
         goto cleanup;
     }
 
-    CHECK_NOT_NULL(res = wa_alloc(2 * words));
+    CHECK_NOT_NULL(res = ec_scratch_wa(scratch, 2 * words));
 
-    /* ws = (e + rd)(mod n). */
-    wa_change_len(ctx->priv_key, wr->len);
-    int_mul(ctx->priv_key, wr, res);
+    /* ws = (e + rd)(mod n). Ключ копіюється, бо контекст може використовуватися з кількох потоків. */
+    CHECK_NOT_NULL(d = ec_scratch_wa(scratch, words));
+    DO(wa_copy(ctx->priv_key, d));
+    int_mul(d, wr, res);
     int_div(res, params->n, NULL, ws);
     if (int_add(e, ws, ws) > 0 || int_cmp(ws, params->n) >= 0) {
         int_sub(ws, params->n, ws);
@@ -261,20 +269,23 @@ static int dstu4145_sign_internal(const EcCtx* ctx, const ByteArray* H, const Wo
 
 cleanup:
 
-    wa_free_private(res);
-    wa_free(h);
-    wa_free(wr);
-    wa_free(ws);
+    ec_scratch_wa_free(scratch, res);
+    ec_scratch_wa_free(scratch, d);
+    ec_scratch_wa_free(scratch, h);
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_wa_free(scratch, ws);
     ba_free(r_ba);
     ba_free(s_ba);
-    ec_point_free(rec);
+    ec_scratch_point_free(scratch, &rec);
 
     return ret;
 }
 
 int dstu4145_sign(const EcCtx *ctx, const ByteArray *H, ByteArray **r, ByteArray **s)
 {
+    EcScratch *scratch = NULL;
     WordArray *e = NULL;
+    ECPoint *kp = NULL;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -288,65 +299,68 @@ int dstu4145_sign(const EcCtx *ctx, const ByteArray *H, ByteArray **r, ByteArray
         SET_ERROR(RET_INVALID_CTX_MODE);
     }
 
-    CHECK_NOT_NULL(e = wa_alloc(ctx->params->n->len));
+    scratch = ec_scratch_acquire(ctx->scratch);
+
+    CHECK_NOT_NULL(e = ec_scratch_wa(scratch, ctx->params->n->len));
 
     do {
-        DO(int_rand(ctx->params->n, e));
-        ret = dstu4145_sign_internal(ctx, H, e, r, s);
+        DO(ec_sign_nonce(ctx, e, &kp));
+        ret = dstu4145_sign_internal(ctx, scratch, H, e, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
-    wa_free_private(e);
+    ec_scratch_wa_free(scratch, e);
+    ec_point_free_private(kp);
+    ec_scratch_release(scratch);
     return ret;
 }
 
-int dstu4145_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const ByteArray *s)
+/**
+ * Перевіряє діапазон r, s і переводить геш в елемент поля.
+ *
+ * @param params параметри еліптичної кривої
+ * @param scratch арена для проміжних і вихідних значень або NULL
+ * @param H геш
+ * @param r частина підпису
+ * @param s частина підпису
+ * @param wr_out r у вигляді числа
+ * @param ws_out s у вигляді числа
+ * @param h_out геш у вигляді елемента поля (ПБ)
+ * @return код помилки або RET_VERIFY_FAILED, якщо r або s поза діапазоном
+ */
+static int dstu4145_verify_prepare(const EcParamsCtx *params, EcScratch *scratch, const ByteArray *H,
+        const ByteArray *r, const ByteArray *s, WordArray **wr_out, WordArray **ws_out, WordArray **h_out)
 {
-    const EcParamsCtx *params;
     WordArray *ws = NULL;
     WordArray *wr = NULL;
-    WordArray *r1 = NULL;
     WordArray *h = NULL;
-    ECPoint *r_point = NULL;
-    const EcGf2mCtx *ec2m;
-    size_t n_bit_len;
     int ret = RET_OK;
 
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(H != NULL);
-    CHECK_PARAM((H->len == 32) || (H->len == 48) || (H->len == 64));
-    CHECK_PARAM(r != NULL);
-    CHECK_PARAM(s != NULL);
-    CHECK_PARAM(ctx->params->ec_field == EC_FIELD_BINARY);
-
-    params = ctx->params;
-
-    if (ctx->verify_status == 0) {
-        SET_ERROR(RET_INVALID_CTX_MODE);
-    }
-
-    ec2m = params->ec2m;
-
-    /* Проверка ЭЦП. */
-    n_bit_len = int_bit_len(ctx->params->n);
-
     if (((ba_get_len(s) + ba_get_len(r)) & 1) == 1) {
         SET_ERROR(RET_VERIFY_FAILED);
     }
 
-    CHECK_NOT_NULL(wr = wa_alloc_from_ba(r));
-    CHECK_NOT_NULL(ws = wa_alloc_from_ba(s));
+    CHECK_PARAM(r->len != 0);
+    CHECK_PARAM(s->len != 0);
+    CHECK_PARAM(H->len != 0);
+
+    CHECK_NOT_NULL(wr = ec_scratch_wa(scratch, (r->len + WORD_BYTE_LENGTH - 1) / WORD_BYTE_LENGTH));
+    CHECK_NOT_NULL(ws = ec_scratch_wa(scratch, (s->len + WORD_BYTE_LENGTH - 1) / WORD_BYTE_LENGTH));
+    wa_from_le(r->buf, r->len, wr);
+    wa_from_le(s->buf, s->len, ws);
 
     /* 0 < wr < n і 0 < ws < n, иначе подпись неверная. */
-    if ((int_cmp(wr, ctx->params->n) >= 0) || (int_cmp(ws, ctx->params->n) >= 0)
+    if ((int_cmp(wr, params->n) >= 0) || (int_cmp(ws, params->n) >= 0)
             || int_is_zero(wr) || int_is_zero(ws)) {
         SET_ERROR(RET_VERIFY_FAILED);
     }
 
-    CHECK_NOT_NULL(h = wa_alloc_from_ba(H));
+    CHECK_NOT_NULL(h = ec_scratch_wa(scratch, params->ec2m->len));
+    wa_from_le(H->buf, H->len, h);
     int_truncate(h, params->m);
-    wa_change_len(h, ec2m->len);
 
     if (params->is_onb) {
         DO(onb_to_pb(params, h));
@@ -356,18 +370,47 @@ int dstu4145_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, co
         h->buf[0] = 1;
     }
 
-    CHECK_NOT_NULL(r_point = ec_point_alloc(ec2m->len));
+    *wr_out = wr;
+    *ws_out = ws;
+    *h_out = h;
+    wr = NULL;
+    ws = NULL;
+    h = NULL;
+
+cleanup:
 
-    DO(ec2m_dual_mul_opt(ec2m, ctx->params->precomp_p, ws, ctx->precomp_q, wr, r_point));
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_wa_free(scratch, ws);
+    ec_scratch_wa_free(scratch, h);
 
-    CHECK_NOT_NULL(r1 = wa_alloc(ec2m->len));
+    return ret;
+}
+
+/**
+ * Порівнює r з x-координатою точки R, помноженою на геш.
+ *
+ * @param params параметри еліптичної кривої
+ * @param scratch арена для проміжних значень або NULL
+ * @param r_point аффінна точка R = s*P+r*Q
+ * @param h геш у вигляді елемента поля (ПБ)
+ * @param wr r у вигляді числа
+ * @return RET_OK, якщо підпис вірний, або RET_VERIFY_FAILED
+ */
+static int dstu4145_verify_check(const EcParamsCtx *params, EcScratch *scratch, const ECPoint *r_point,
+        const WordArray *h, const WordArray *wr)
+{
+    WordArray *r1 = NULL;
+    const EcGf2mCtx *ec2m = params->ec2m;
+    int ret = RET_OK;
+
+    CHECK_NOT_NULL(r1 = ec_scratch_wa(scratch, ec2m->len));
     gf2m_mod_mul(ec2m->gf2m, r_point->x, h, r1);
 
     if (params->is_onb) {
-        DO(pb_to_onb(ctx->params, r1));
+        DO(pb_to_onb(params, r1));
     }
 
-    int_truncate(r1, n_bit_len - 1);
+    int_truncate(r1, int_bit_len(params->n) - 1);
 
     if (!int_equals(r1, wr)) {
         SET_ERROR(RET_VERIFY_FAILED);
@@ -375,11 +418,142 @@ int dstu4145_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, co
 
 cleanup:
 
-    wa_free(wr);
-    wa_free(ws);
-    wa_free(r1);
-    wa_free(h);
-    ec_point_free(r_point);
+    ec_scratch_wa_free(scratch, r1);
+
+    return ret;
+}
+
+int dstu4145_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const ByteArray *s)
+{
+    EcScratch *scratch = NULL;
+    WordArray *ws = NULL;
+    WordArray *wr = NULL;
+    WordArray *h = NULL;
+    ECPoint r_point = { NULL, NULL, NULL };
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(H != NULL);
+    CHECK_PARAM((H->len == 32) || (H->len == 48) || (H->len == 64));
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(s != NULL);
+    CHECK_PARAM(ctx->params->ec_field == EC_FIELD_BINARY);
+
+    if (ctx->verify_status == 0) {
+        SET_ERROR(RET_INVALID_CTX_MODE);
+    }
+
+    scratch = ec_scratch_acquire(ctx->scratch);
+
+    /* Проверка ЭЦП. */
+    DO(dstu4145_verify_prepare(ctx->params, scratch, H, r, s, &wr, &ws, &h));
+
+    DO(ec_scratch_point(scratch, ctx->params->ec2m->len, &r_point));
+
+    DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, ws, ctx->precomp_q, wr, &r_point));
+
+    DO(dstu4145_verify_check(ctx->params, scratch, &r_point, h, wr));
+
+cleanup:
+
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_wa_free(scratch, ws);
+    ec_scratch_wa_free(scratch, h);
+    ec_scratch_point_free(scratch, &r_point);
+    ec_scratch_release(scratch);
+
+    return ret;
+}
+
+int dstu4145_verify_batch(const EcCtx *ctx, size_t count, const ByteArray *const *qx, const ByteArray *const *qy,
+        const ByteArray *const *H, const ByteArray *const *r, const ByteArray *const *s, int *results)
+{
+    ECPoint **q = NULL;
+    ECPoint **r_point = NULL;
+    WordArray **wr = NULL;
+    WordArray **ws = NULL;
+    WordArray **h = NULL;
+    size_t *idx = NULL;
+    size_t i;
+    size_t n = 0;
+    bool all_ok = true;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(qx != NULL);
+    CHECK_PARAM(qy != NULL);
+    CHECK_PARAM(H != NULL);
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(s != NULL);
+    CHECK_PARAM(results != NULL);
+    CHECK_PARAM(ctx->params->ec_field == EC_FIELD_BINARY);
+
+    if (count == 0) {
+        return RET_OK;
+    }
+
+    CALLOC_CHECKED(q, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(r_point, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(wr, count * sizeof(WordArray *));
+    CALLOC_CHECKED(ws, count * sizeof(WordArray *));
+    CALLOC_CHECKED(h, count * sizeof(WordArray *));
+    CALLOC_CHECKED(idx, count * sizeof(size_t));
+
+    /* Некоректні ключі та підписи відкидаються до пакетного обчислення. */
+    for (i = 0; i < count; i++) {
+        if ((qx[i] == NULL) || (qy[i] == NULL) || (H[i] == NULL) || (r[i] == NULL) || (s[i] == NULL)) {
+            results[i] = RET_INVALID_PARAM;
+            continue;
+        }
+        if ((H[i]->len != 32) && (H[i]->len != 48) && (H[i]->len != 64)) {
+            results[i] = RET_INVALID_PARAM;
+            continue;
+        }
+
+        results[i] = public_key_to_ec_point(ctx->params, qx[i], qy[i], &q[n]);
+        if (results[i] == RET_OK) {
+            results[i] = dstu4145_verify_prepare(ctx->params, NULL, H[i], r[i], s[i], &wr[n], &ws[n], &h[n]);
+            if (results[i] != RET_OK) {
+                ec_point_free(q[n]);
+                q[n] = NULL;
+            }
+        }
+        if (results[i] == RET_OK) {
+            CHECK_NOT_NULL(r_point[n] = ec_point_alloc(ctx->params->ec2m->len));
+            idx[n++] = i;
+        }
+    }
+
+    DO(ec_dual_mul_batch(ctx, q, ws, wr, n, r_point));
+
+    for (i = 0; i < n; i++) {
+        results[idx[i]] = dstu4145_verify_check(ctx->params, NULL, r_point[i], h[i], wr[i]);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (results[i] != RET_OK) {
+            all_ok = false;
+        }
+    }
+    if (!all_ok) {
+        ret = RET_VERIFY_FAILED;
+    }
+
+cleanup:
+
+    for (i = 0; (idx != NULL) && (i < count); i++) {
+        ec_point_free(q[i]);
+        ec_point_free(r_point[i]);
+        wa_free(wr[i]);
+        wa_free(ws[i]);
+        wa_free(h[i]);
+    }
+    free(q);
+    free(r_point);
+    free(wr);
+    free(ws);
+    free(h);
+    free(idx);
 
     return ret;
 }
@@ -413,6 +587,44 @@ cleanup:
     return ret;
 }
 
+/* Пакет із трьох підписів, другий з яких зіпсований: відхиляється лише він. */
+static int dstu4145_batch_self_test(const EcCtx* ctx, const ByteArray* Qx, const ByteArray* Qy,
+        const ByteArray* H, const ByteArray* r, const ByteArray* s)
+{
+    int ret = RET_OK;
+    ByteArray* Qx_be = NULL;
+    ByteArray* Qy_be = NULL;
+    ByteArray* ba_bad_hash = NULL;
+    const ByteArray* qxs[3] = { NULL, NULL, NULL };
+    const ByteArray* qys[3] = { NULL, NULL, NULL };
+    const ByteArray* hashes[3] = { H, NULL, H };
+    const ByteArray* rs[3] = { r, r, r };
+    const ByteArray* ss[3] = { s, s, s };
+    int results[3] = { RET_OK, RET_OK, RET_OK };
+    size_t i;
+
+    CHECK_NOT_NULL(Qx_be = ba_alloc_from_uint8_be(Qx->buf, Qx->len));
+    CHECK_NOT_NULL(Qy_be = ba_alloc_from_uint8_be(Qy->buf, Qy->len));
+    CHECK_NOT_NULL(ba_bad_hash = ba_copy_with_alloc(H, 0, 0));
+    ba_bad_hash->buf[0] ^= 0x01;
+    hashes[1] = ba_bad_hash;
+    for (i = 0; i < 3; i++) {
+        qxs[i] = Qx_be;
+        qys[i] = Qy_be;
+    }
+
+    if ((dstu4145_verify_batch(ctx, 3, qxs, qys, hashes, rs, ss, results) != RET_VERIFY_FAILED) ||
+        (results[0] != RET_OK) || (results[1] != RET_VERIFY_FAILED) || (results[2] != RET_OK)) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+
+cleanup:
+    ba_free(Qx_be);
+    ba_free(Qy_be);
+    ba_free(ba_bad_hash);
+    return ret;
+}
+
 int dstu4145_self_test(void)
 {   
     // ДСТУ 4145-2002. Додаток Б 
@@ -461,7 +673,7 @@ int dstu4145_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_le(test_k, sizeof(test_k)));
 
     DO(dstu4145_init_sign(ec_ctx, &ba_d));
-    DO(dstu4145_sign_internal(ec_ctx, &ba_H, wa_k, &ba_R, &ba_S));
+    DO(dstu4145_sign_internal(ec_ctx, NULL, &ba_H, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -472,6 +684,7 @@ int dstu4145_self_test(void)
 
     DO(dstu4145_init_verify(ec_ctx, ba_Qx, ba_Qy));
     DO(dstu4145_verify(ec_ctx, &ba_H, ba_R, ba_S));
+    DO(dstu4145_batch_self_test(ec_ctx, ba_Qx, ba_Qy, &ba_H, ba_R, ba_S));
     
 cleanup:
     wa_free(wa_k);
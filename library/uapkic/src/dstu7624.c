@@ -36,8 +36,12 @@
 #include "paddings.h"
 #include "byte-utils-internal.h"
 #include "byte-array-internal.h"
-#include "math-gf2m-internal.h"
 #include "macros-internal.h"
+#include "cpu-features-internal.h"
+
+#if defined(CPU_X86_64)
+# include <immintrin.h>
+#endif
 
 #define REDUCTION_POLYNOMIAL 0x11d  /* x^8 + x^4 + x^3 + x^2 + 1 */
 #define ROWS 8
@@ -51,6 +55,11 @@
 #define KALINA_256_BLOCK_LEN 32
 #define KALINA_512_BLOCK_LEN 64
 #define SBOX_LEN 1024
+#define MAX_ROUNDS 18
+#define SIMD_LANE_LEN 16
+#define SIMD_BATCH_LEN 512
+#define BATCH_LEN 1024
+#define GMAC_AGG_BLOCKS 8
 
 #define GALUA_MUL(i, j, k, shift) (uint64_t)((uint64_t)multiply_galua(mds[j * ROWS + k], s_blocks[(k % 4) * MAX_NUM_IN_BYTE + i]) << ((uint64_t)shift))
 
@@ -91,32 +100,26 @@ typedef struct Dstu7624CfbCtx_st {
 } Dstu7624CfbCtx;
 
 typedef struct Dstu7624GmacCtx_st {
-    uint64_t H[8];
-    uint64_t B[8];
+    uint8_t B[MAX_BLOCK_LEN];
     uint8_t last_block[MAX_BLOCK_LEN];
     size_t last_block_len;
     size_t msg_tot_len;
     size_t q;
-    Gf2mCtx *gf2m_ctx;
 } Dstu7624GmacCtx;
 
 typedef struct Dstu7624GcmCtx_st {
     uint64_t iv[8];
     size_t q;
-    Gf2mCtx *gf2m_ctx;
 } Dstu7624GcmCtx;
 
 typedef struct Dstu7624CcmCtx_st {
     size_t q;
-    const ByteArray *key;
-    const ByteArray *iv_tmp;
     uint8_t iv[MAX_BLOCK_LEN];
     size_t nb;
 } Dstu7624CcmCtx;
 
 typedef struct Dstu7624XtsCtx_st {
     uint8_t iv[64];
-    Gf2mCtx *gf2m_ctx;
 } Dstu7624XtsCtx;
 
 typedef struct Dstu7624CmacCtx_st {
@@ -125,6 +128,32 @@ typedef struct Dstu7624CmacCtx_st {
     size_t lblock_len;
 } Dstu7624CmacCtx;
 
+typedef struct Dstu7624Impl_st Dstu7624Impl;
+typedef struct Dstu7624GmacImpl_st Dstu7624GmacImpl;
+
+typedef enum {
+    DSTU7624_AEAD_NONE,
+    DSTU7624_AEAD_AAD,
+    DSTU7624_AEAD_DATA
+} Dstu7624AeadStage;
+
+/* Стан потокового шифрування GCM/CCM. */
+typedef struct Dstu7624AeadCtx_st {
+    uint64_t ctr[8];                /* лічильник гамування */
+    uint8_t gamma[MAX_BLOCK_LEN];   /* гама останнього блока */
+    size_t gamma_off;               /* використано байт гами */
+    uint8_t mac[MAX_BLOCK_LEN];     /* стан GMAC або CBC-MAC */
+    uint8_t buf[MAX_BLOCK_LEN];     /* неповний блок автентифікації */
+    size_t buf_len;
+    uint64_t aad_len;
+    uint64_t data_len;
+    uint64_t tail_len;              /* CCM: пропущені байти зашифрованої імітовставки */
+    uint64_t aad_total;             /* CCM: оголошені довжини */
+    uint64_t data_total;
+    Dstu7624AeadStage stage;
+    bool encrypt;
+} Dstu7624AeadCtx;
+
 struct Dstu7624Ctx_st {
     Dstu7624Mode mode_id;
     uint64_t p_boxrowcol[ROWS][MAX_NUM_IN_BYTE];
@@ -150,9 +179,27 @@ struct Dstu7624Ctx_st {
         Dstu7624CmacCtx cmac;
     } mode;
 
+    Dstu7624AeadCtx aead;
+
     void (*basic_transform)(Dstu7624Ctx *, uint64_t *);
     void (*subrowcol)(uint64_t *, Dstu7624Ctx *); /*store pointer on each subshiftmix for all block size type*/
     void (*subrowcol_dec)(Dstu7624Ctx *, uint64_t *); /*store pointer on each subshiftmix for all block size type*/
+
+    const Dstu7624Impl *impl;
+#if defined(CPU_X86_64)
+    /* Розклад ключа для SIMD: стан зберігається по рядках, 16 стовпців у 128-бітній смузі. */
+    uint8_t simd_rkeys[MAX_ROUNDS + 1][ROWS][SIMD_LANE_LEN];
+    uint8_t simd_shift[2][ROWS][SIMD_LANE_LEN];         /* ShiftRows і обернений */
+    uint64_t simd_gf_mul[2][ROWS];                      /* матриці GF2P8AFFINEQB для коефіцієнтів MDS і оберненої */
+#endif
+
+    /* Множення на H = E(0) у полі GF(2^n) режимів GCM/GMAC, готується в dstu7624_init_gcm/gmac. */
+    const Dstu7624GmacImpl *gmac;
+    uint64_t gmac_table[16][ROWS];
+    uint16_t gmac_last4[16];
+#if defined(CPU_X86_64)
+    __m128i gmac_hpow[GMAC_AGG_BLOCKS][MAX_BLOCK_LEN / 16];
+#endif
 };
 
 
@@ -1457,13 +1504,10 @@ void dstu7624_free(Dstu7624Ctx *ctx)
         case DSTU7624_MODE_CMAC:
             break;
         case DSTU7624_MODE_XTS:
-            gf2m_free(ctx->mode.xts.gf2m_ctx);
             break;
         case DSTU7624_MODE_GCM:
-            gf2m_free(ctx->mode.gcm.gf2m_ctx);
             break;
         case DSTU7624_MODE_GMAC:
-            gf2m_free(ctx->mode.gmac.gf2m_ctx);
             break;
         default:
             break;
@@ -2474,6 +2518,634 @@ cleanup:
     return ret;
 }
 
+static __inline void decrypt_basic_transform(Dstu7624Ctx *ctx, const uint8_t *cipher_data, uint8_t *plain_data)
+{
+    uint64_t block[8];
+
+    uint8_to_uint64(cipher_data, ctx->block_len, block, ctx->block_len >> 3);
+    ctx->subrowcol_dec(ctx, block);
+    uint64_to_uint8(block, ctx->block_len >> 3, plain_data, ctx->block_len);
+}
+
+/*
+ * Реалізація ДСТУ 7624: перетворення послідовності незалежних повних блоків
+ * (ECB, гамування CTR/GCM/CCM, XTS, розшифрування CBC).
+ */
+struct Dstu7624Impl_st {
+    const char *name;
+    uint32_t features;
+    void (*set_key)(Dstu7624Ctx *ctx);
+    void (*encrypt_blocks)(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+    void (*decrypt_blocks)(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks);
+};
+
+static void encrypt_blocks_generic(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += ctx->block_len, out += ctx->block_len) {
+        crypt_basic_transform(ctx, in, out);
+    }
+}
+
+static void decrypt_blocks_generic(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    for (; blocks > 0; blocks--, in += ctx->block_len, out += ctx->block_len) {
+        decrypt_basic_transform(ctx, in, out);
+    }
+}
+
+#if defined(CPU_X86_64)
+
+/*
+ * AVX-512 реалізація без таблиць у пам'яті, індексованих даними. Пакет з 512 байт у 8 регістрах
+ * транспонується так, що кожна 128-бітна смуга регістра містить один рядок стану (байт k
+ * 16 стовпців): S-блок рядка - дві VPERMI2B по 128 елементів і вибір за старшим бітом,
+ * ShiftRows - VPSHUFB, множення на коефіцієнти MDS - GF2P8AFFINEQB.
+ * Додавання за модулем 2^64 першого і останнього раундових ключів виконується до/після транспонування.
+ */
+static const uint8_t simd_to_rows[SIMD_LANE_LEN] = {
+    0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15
+};
+
+static const uint8_t simd_from_rows[SIMD_LANE_LEN] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15
+};
+
+/* Матриця множення на c для GF2P8AFFINEQB: байт 7 - i задає біт i добутку. */
+static uint64_t gf2p8_matrix(uint8_t c)
+{
+    uint64_t m = 0;
+    uint8_t col;
+    size_t i, j;
+
+    for (j = 0; j < BITS_IN_BYTE; j++) {
+        col = multiply_galua(c, (uint8_t)(1 << j));
+        for (i = 0; i < BITS_IN_BYTE; i++) {
+            m |= (uint64_t)((col >> i) & 1) << (8 * (7 - i) + j);
+        }
+    }
+
+    return m;
+}
+
+static void set_key_avx512(Dstu7624Ctx *ctx)
+{
+    const size_t nc = ctx->block_len >> 3;
+    size_t r, k, p, j, shift;
+
+    for (r = 0; r <= ctx->rounds; r++) {
+        for (k = 0; k < ROWS; k++) {
+            for (p = 0; p < SIMD_LANE_LEN; p++) {
+                ctx->simd_rkeys[r][k][p] = (uint8_t)(ctx->p_rkeys[r * nc + p % nc] >> (8 * k));
+            }
+        }
+    }
+
+    /* Рядок k зсувається на k * nc / 8 стовпців у межах свого блока. */
+    for (k = 0; k < ROWS; k++) {
+        shift = k * nc / ROWS;
+        for (p = 0; p < SIMD_LANE_LEN; p++) {
+            j = p % nc;
+            ctx->simd_shift[0][k][p] = (uint8_t)(p - j + (j + nc - shift) % nc);
+            ctx->simd_shift[1][k][p] = (uint8_t)(p - j + (j + shift) % nc);
+        }
+        ctx->simd_gf_mul[0][k] = gf2p8_matrix(mds_matrix[k]);
+        ctx->simd_gf_mul[1][k] = gf2p8_matrix(mds_matrix_reverse[k]);
+    }
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline __m512i load_avx512(const uint8_t *in)
+{
+    return _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)in));
+}
+
+/* Смуги регістра обробляють чотири незалежні частини пакета по 128 байт. */
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline __m512i load_data_avx512(const uint8_t *in)
+{
+    __m512i x = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *)in));
+
+    x = _mm512_inserti32x4(x, _mm_loadu_si128((const __m128i *)(in + 128)), 1);
+    x = _mm512_inserti32x4(x, _mm_loadu_si128((const __m128i *)(in + 256)), 2);
+    return _mm512_inserti32x4(x, _mm_loadu_si128((const __m128i *)(in + 384)), 3);
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void store_data_avx512(uint8_t *out, __m512i x)
+{
+    _mm_storeu_si128((__m128i *)out, _mm512_castsi512_si128(x));
+    _mm_storeu_si128((__m128i *)(out + 128), _mm512_extracti32x4_epi32(x, 1));
+    _mm_storeu_si128((__m128i *)(out + 256), _mm512_extracti32x4_epi32(x, 2));
+    _mm_storeu_si128((__m128i *)(out + 384), _mm512_extracti32x4_epi32(x, 3));
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void transpose_avx512(__m512i *s)
+{
+    __m512i a0, a1, a2, a3, a4, a5, a6, a7;
+    __m512i b0, b1, b2, b3, b4, b5, b6, b7;
+
+    a0 = _mm512_unpacklo_epi16(s[0], s[1]);
+    a1 = _mm512_unpackhi_epi16(s[0], s[1]);
+    a2 = _mm512_unpacklo_epi16(s[2], s[3]);
+    a3 = _mm512_unpackhi_epi16(s[2], s[3]);
+    a4 = _mm512_unpacklo_epi16(s[4], s[5]);
+    a5 = _mm512_unpackhi_epi16(s[4], s[5]);
+    a6 = _mm512_unpacklo_epi16(s[6], s[7]);
+    a7 = _mm512_unpackhi_epi16(s[6], s[7]);
+
+    b0 = _mm512_unpacklo_epi32(a0, a2);
+    b1 = _mm512_unpackhi_epi32(a0, a2);
+    b2 = _mm512_unpacklo_epi32(a1, a3);
+    b3 = _mm512_unpackhi_epi32(a1, a3);
+    b4 = _mm512_unpacklo_epi32(a4, a6);
+    b5 = _mm512_unpackhi_epi32(a4, a6);
+    b6 = _mm512_unpacklo_epi32(a5, a7);
+    b7 = _mm512_unpackhi_epi32(a5, a7);
+
+    s[0] = _mm512_unpacklo_epi64(b0, b4);
+    s[1] = _mm512_unpackhi_epi64(b0, b4);
+    s[2] = _mm512_unpacklo_epi64(b1, b5);
+    s[3] = _mm512_unpackhi_epi64(b1, b5);
+    s[4] = _mm512_unpacklo_epi64(b2, b6);
+    s[5] = _mm512_unpackhi_epi64(b2, b6);
+    s[6] = _mm512_unpacklo_epi64(b3, b7);
+    s[7] = _mm512_unpackhi_epi64(b3, b7);
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void to_rows_avx512(__m512i *s)
+{
+    const __m512i m = load_avx512(simd_to_rows);
+    size_t i;
+
+    for (i = 0; i < ROWS; i++) {
+        s[i] = _mm512_shuffle_epi8(s[i], m);
+    }
+    transpose_avx512(s);
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void from_rows_avx512(__m512i *s)
+{
+    const __m512i m = load_avx512(simd_from_rows);
+    size_t i;
+
+    transpose_avx512(s);
+    for (i = 0; i < ROWS; i++) {
+        s[i] = _mm512_shuffle_epi8(s[i], m);
+    }
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline __m512i sbox_avx512(const uint8_t *tbl, __m512i x)
+{
+    __m512i lo = _mm512_permutex2var_epi8(_mm512_loadu_si512(tbl), x, _mm512_loadu_si512(tbl + 64));
+    __m512i hi = _mm512_permutex2var_epi8(_mm512_loadu_si512(tbl + 128), x, _mm512_loadu_si512(tbl + 192));
+
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(x), lo, hi);
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline __m512i gf_mul_avx512(__m512i x, uint64_t matrix)
+{
+    return _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64((long long)matrix), 0);
+}
+
+/* Рядки з коефіцієнтом MDS 1 (зсуви 0, 1, 3) додаються без множення; 0x96 - XOR трьох операндів. */
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void mix_avx512(const Dstu7624Ctx *ctx, __m512i *s)
+{
+    const uint64_t *m = ctx->simd_gf_mul[0];
+    __m512i t[ROWS];
+    __m512i a, b, c;
+    size_t j;
+
+    for (j = 0; j < ROWS; j++) {
+        t[j] = s[j];
+    }
+
+    for (j = 0; j < ROWS; j++) {
+        a = _mm512_ternarylogic_epi64(t[j], t[(j + 1) & 7], t[(j + 3) & 7], 0x96);
+        b = _mm512_ternarylogic_epi64(gf_mul_avx512(t[(j + 2) & 7], m[2]), gf_mul_avx512(t[(j + 4) & 7], m[4]),
+                gf_mul_avx512(t[(j + 5) & 7], m[5]), 0x96);
+        c = _mm512_ternarylogic_epi64(a, gf_mul_avx512(t[(j + 6) & 7], m[6]), gf_mul_avx512(t[(j + 7) & 7], m[7]), 0x96);
+        s[j] = _mm512_xor_si512(b, c);
+    }
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static __inline void inv_mix_avx512(const Dstu7624Ctx *ctx, __m512i *s)
+{
+    const uint64_t *m = ctx->simd_gf_mul[1];
+    __m512i t[ROWS];
+    __m512i a, b;
+    size_t j;
+
+    for (j = 0; j < ROWS; j++) {
+        t[j] = s[j];
+    }
+
+    for (j = 0; j < ROWS; j++) {
+        a = _mm512_ternarylogic_epi64(gf_mul_avx512(t[j], m[0]), gf_mul_avx512(t[(j + 1) & 7], m[1]),
+                gf_mul_avx512(t[(j + 2) & 7], m[2]), 0x96);
+        b = _mm512_ternarylogic_epi64(gf_mul_avx512(t[(j + 3) & 7], m[3]), gf_mul_avx512(t[(j + 4) & 7], m[4]),
+                gf_mul_avx512(t[(j + 5) & 7], m[5]), 0x96);
+        a = _mm512_ternarylogic_epi64(a, gf_mul_avx512(t[(j + 6) & 7], m[6]), gf_mul_avx512(t[(j + 7) & 7], m[7]), 0x96);
+        s[j] = _mm512_xor_si512(a, b);
+    }
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static void encrypt_batch_avx512(const Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out)
+{
+    const size_t nc = ctx->block_len >> 3;
+    const uint8_t *rkey = (const uint8_t *)ctx->p_rkeys;
+    __m512i s[ROWS];
+    size_t i, r;
+
+    for (i = 0; i < ROWS; i++) {
+        s[i] = _mm512_add_epi64(load_data_avx512(in + SIMD_LANE_LEN * i), load_avx512(rkey + ((2 * i) % nc) * 8));
+    }
+    to_rows_avx512(s);
+
+    for (r = 1; r <= ctx->rounds; r++) {
+        for (i = 0; i < ROWS; i++) {
+            s[i] = sbox_avx512(ctx->s_blocks + (i & 3) * MAX_NUM_IN_BYTE, s[i]);
+            s[i] = _mm512_shuffle_epi8(s[i], load_avx512(ctx->simd_shift[0][i]));
+        }
+        mix_avx512(ctx, s);
+        if (r < ctx->rounds) {
+            for (i = 0; i < ROWS; i++) {
+                s[i] = _mm512_xor_si512(s[i], load_avx512(ctx->simd_rkeys[r][i]));
+            }
+        }
+    }
+
+    from_rows_avx512(s);
+    rkey += ctx->rounds * ctx->block_len;
+    for (i = 0; i < ROWS; i++) {
+        store_data_avx512(out + SIMD_LANE_LEN * i, _mm512_add_epi64(s[i], load_avx512(rkey + ((2 * i) % nc) * 8)));
+    }
+}
+
+CPU_TARGET("avx512f,avx512bw,avx512vbmi,gfni")
+static void decrypt_batch_avx512(const Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out)
+{
+    const size_t nc = ctx->block_len >> 3;
+    const uint8_t *rkey = (const uint8_t *)ctx->p_rkeys + ctx->rounds * ctx->block_len;
+    __m512i s[ROWS];
+    size_t i, r;
+
+    for (i = 0; i < ROWS; i++) {
+        s[i] = _mm512_sub_epi64(load_data_avx512(in + SIMD_LANE_LEN * i), load_avx512(rkey + ((2 * i) % nc) * 8));
+    }
+    to_rows_avx512(s);
+
+    for (r = ctx->rounds; r > 0; r--) {
+        if (r < ctx->rounds) {
+            for (i = 0; i < ROWS; i++) {
+                s[i] = _mm512_xor_si512(s[i], load_avx512(ctx->simd_rkeys[r][i]));
+            }
+        }
+        inv_mix_avx512(ctx, s);
+        for (i = 0; i < ROWS; i++) {
+            s[i] = _mm512_shuffle_epi8(s[i], load_avx512(ctx->simd_shift[1][i]));
+            s[i] = sbox_avx512(ctx->inv_s_blocks + (i & 3) * MAX_NUM_IN_BYTE, s[i]);
+        }
+    }
+
+    from_rows_avx512(s);
+    rkey = (const uint8_t *)ctx->p_rkeys;
+    for (i = 0; i < ROWS; i++) {
+        store_data_avx512(out + SIMD_LANE_LEN * i, _mm512_sub_epi64(s[i], load_avx512(rkey + ((2 * i) % nc) * 8)));
+    }
+}
+
+static void encrypt_blocks_avx512(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    const size_t batch = SIMD_BATCH_LEN / ctx->block_len;
+
+    for (; blocks >= batch; blocks -= batch, in += SIMD_BATCH_LEN, out += SIMD_BATCH_LEN) {
+        encrypt_batch_avx512(ctx, in, out);
+    }
+    encrypt_blocks_generic(ctx, in, out, blocks);
+}
+
+static void decrypt_blocks_avx512(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t blocks)
+{
+    const size_t batch = SIMD_BATCH_LEN / ctx->block_len;
+
+    for (; blocks >= batch; blocks -= batch, in += SIMD_BATCH_LEN, out += SIMD_BATCH_LEN) {
+        decrypt_batch_avx512(ctx, in, out);
+    }
+    decrypt_blocks_generic(ctx, in, out, blocks);
+}
+
+#endif
+
+/*
+ * Множення GMAC: S = (S ^ X_i) * H для послідовності повних блоків X_i у полі GF(2^n),
+ * n = 128, 256, 512. Біт j байта i блока - коефіцієнт при x^(8i + j).
+ * Таблиці або степені H готуються один раз у dstu7624_init_gcm/dstu7624_init_gmac.
+ */
+struct Dstu7624GmacImpl_st {
+    const char *name;
+    uint32_t features;
+    void (*init)(Dstu7624Ctx *ctx, const uint8_t *h);
+    void (*blocks)(const Dstu7624Ctx *ctx, uint8_t *s, const uint8_t *in, size_t blocks);
+};
+
+/* Молодші члени многочленів x^128 + x^7 + x^2 + x + 1, x^256 + x^10 + x^5 + x^2 + 1, x^512 + x^8 + x^5 + x^2 + 1. */
+static uint64_t gmac_poly(size_t block_len)
+{
+    switch (block_len) {
+    case KALINA_128_BLOCK_LEN:
+        return 0x87;
+    case KALINA_256_BLOCK_LEN:
+        return 0x425;
+    default:
+        return 0x125;
+    }
+}
+
+/* Таблиця Шоупа: gmac_table[i] = i * H для всіх 4-бітових i, gmac_last4[t] = t * x^n. */
+static void gmac_init_table(Dstu7624Ctx *ctx, const uint8_t *h)
+{
+    const size_t nc = ctx->block_len >> 3;
+    const uint64_t poly = gmac_poly(ctx->block_len);
+    uint64_t carry;
+    size_t i, j, w;
+
+    memset(ctx->gmac_table, 0, sizeof(ctx->gmac_table));
+    uint8_to_uint64(h, ctx->block_len, ctx->gmac_table[1], nc);
+
+    for (i = 2; i <= 8; i *= 2) {
+        carry = 0 - (ctx->gmac_table[i / 2][nc - 1] >> 63);
+        for (w = nc - 1; w > 0; w--) {
+            ctx->gmac_table[i][w] = (ctx->gmac_table[i / 2][w] << 1) | (ctx->gmac_table[i / 2][w - 1] >> 63);
+        }
+        ctx->gmac_table[i][0] = (ctx->gmac_table[i / 2][0] << 1) ^ (carry & poly);
+    }
+
+    for (i = 2; i <= 8; i *= 2) {
+        for (j = 1; j < i; j++) {
+            for (w = 0; w < nc; w++) {
+                ctx->gmac_table[i + j][w] = ctx->gmac_table[i][w] ^ ctx->gmac_table[j][w];
+            }
+        }
+    }
+
+    for (i = 0; i < 16; i++) {
+        ctx->gmac_last4[i] = 0;
+        for (j = 0; j < 4; j++) {
+            if ((i >> j) & 1) {
+                ctx->gmac_last4[i] ^= (uint16_t)(poly << j);
+            }
+        }
+    }
+}
+
+/* nc - кількість 64-бітових слів блока, стала в кожному виклику для розгортання циклів. */
+static __inline void gmac_mul_table(const Dstu7624Ctx *ctx, uint64_t *x, const size_t nc)
+{
+    uint64_t z[ROWS] = {0};
+    size_t i, j, w, nibble, top;
+
+    /* Схема Горнера за тетрадами X, від старших до молодших. */
+    for (i = nc; i-- > 0; ) {
+        for (j = 16; j-- > 0; ) {
+            top = (size_t)(z[nc - 1] >> 60);
+            for (w = nc - 1; w > 0; w--) {
+                z[w] = (z[w] << 4) | (z[w - 1] >> 60);
+            }
+            z[0] = (z[0] << 4) ^ ctx->gmac_last4[top];
+
+            nibble = (size_t)(x[i] >> (4 * j)) & 0x0f;
+            for (w = 0; w < nc; w++) {
+                z[w] ^= ctx->gmac_table[nibble][w];
+            }
+        }
+    }
+
+    memcpy(x, z, nc * sizeof(uint64_t));
+}
+
+static __inline void gmac_blocks_table_n(const Dstu7624Ctx *ctx, uint8_t *s, const uint8_t *in, size_t blocks,
+        const size_t nc)
+{
+    uint64_t x[ROWS];
+    uint64_t b[ROWS];
+    size_t w;
+
+    uint8_to_uint64(s, nc * 8, x, nc);
+    for (; blocks > 0; blocks--, in += nc * 8) {
+        uint8_to_uint64(in, nc * 8, b, nc);
+        for (w = 0; w < nc; w++) {
+            x[w] ^= b[w];
+        }
+        gmac_mul_table(ctx, x, nc);
+    }
+    uint64_to_uint8(x, nc, s, nc * 8);
+}
+
+static void gmac_blocks_table(const Dstu7624Ctx *ctx, uint8_t *s, const uint8_t *in, size_t blocks)
+{
+    switch (ctx->block_len) {
+    case KALINA_128_BLOCK_LEN:
+        gmac_blocks_table_n(ctx, s, in, blocks, 2);
+        break;
+    case KALINA_256_BLOCK_LEN:
+        gmac_blocks_table_n(ctx, s, in, blocks, 4);
+        break;
+    default:
+        gmac_blocks_table_n(ctx, s, in, blocks, 8);
+        break;
+    }
+}
+
+#if defined(CPU_X86_64)
+
+/*
+ * GMAC на PCLMULQDQ. Порядок байтів блока збігається з порядком x86, тож 128-бітні частини
+ * завантажуються без перестановок. Добутки до GMAC_AGG_BLOCKS блоків на степені H
+ * накопичуються без редукції: lo/mid/hi[k] - складові з вагою x^(128k), x^(128k + 64), x^(128k + 128).
+ */
+CPU_TARGET("pclmul")
+static __inline void gmac_clmul_acc(const __m128i *a, const __m128i *b, size_t m, __m128i *lo, __m128i *mid, __m128i *hi)
+{
+    size_t i, j;
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < m; j++) {
+            lo[i + j] = _mm_xor_si128(lo[i + j], _mm_clmulepi64_si128(a[i], b[j], 0x00));
+            hi[i + j] = _mm_xor_si128(hi[i + j], _mm_clmulepi64_si128(a[i], b[j], 0x11));
+            mid[i + j] = _mm_xor_si128(mid[i + j], _mm_xor_si128(_mm_clmulepi64_si128(a[i], b[j], 0x10),
+                    _mm_clmulepi64_si128(a[i], b[j], 0x01)));
+        }
+    }
+}
+
+/* Редукція добутку довжиною 2n біт: старша половина множиться на молодші члени многочлена. */
+CPU_TARGET("pclmul")
+static __inline void gmac_clmul_reduce(__m128i poly, size_t m, const __m128i *lo, const __m128i *mid,
+        const __m128i *hi, __m128i *x)
+{
+    __m128i u[2 * MAX_BLOCK_LEN / 16];
+    __m128i t0, t1, over;
+    size_t k;
+
+    for (k = 0; k < 2 * m; k++) {
+        u[k] = _mm_setzero_si128();
+        if (k < 2 * m - 1) {
+            u[k] = _mm_xor_si128(lo[k], _mm_slli_si128(mid[k], 8));
+        }
+        if (k > 0) {
+            u[k] = _mm_xor_si128(u[k], _mm_xor_si128(hi[k - 1], _mm_srli_si128(mid[k - 1], 8)));
+        }
+    }
+
+    over = _mm_setzero_si128();
+    for (k = 0; k < m; k++) {
+        t0 = _mm_clmulepi64_si128(u[m + k], poly, 0x00);
+        t1 = _mm_clmulepi64_si128(u[m + k], poly, 0x01);
+        x[k] = _mm_xor_si128(_mm_xor_si128(u[k], over), _mm_xor_si128(t0, _mm_slli_si128(t1, 8)));
+        over = _mm_srli_si128(t1, 8);
+    }
+    /* Перенос за x^n не перевищує 11 біт, його добуток на многочлен вміщується в одне слово. */
+    x[0] = _mm_xor_si128(x[0], _mm_clmulepi64_si128(over, poly, 0x00));
+}
+
+CPU_TARGET("pclmul")
+static void gmac_init_clmul(Dstu7624Ctx *ctx, const uint8_t *h)
+{
+    const size_t m = ctx->block_len / 16;
+    const __m128i poly = _mm_set_epi64x(0, (long long)gmac_poly(ctx->block_len));
+    __m128i lo[2 * MAX_BLOCK_LEN / 16], mid[2 * MAX_BLOCK_LEN / 16], hi[2 * MAX_BLOCK_LEN / 16];
+    size_t i, k;
+
+    for (k = 0; k < m; k++) {
+        ctx->gmac_hpow[0][k] = _mm_loadu_si128((const __m128i *)(h + 16 * k));
+    }
+
+    for (i = 1; i < GMAC_AGG_BLOCKS; i++) {
+        for (k = 0; k < 2 * m; k++) {
+            lo[k] = mid[k] = hi[k] = _mm_setzero_si128();
+        }
+        gmac_clmul_acc(ctx->gmac_hpow[i - 1], ctx->gmac_hpow[0], m, lo, mid, hi);
+        gmac_clmul_reduce(poly, m, lo, mid, hi, ctx->gmac_hpow[i]);
+    }
+}
+
+CPU_TARGET("pclmul")
+static void gmac_blocks_clmul(const Dstu7624Ctx *ctx, uint8_t *s, const uint8_t *in, size_t blocks)
+{
+    const size_t m = ctx->block_len / 16;
+    const __m128i poly = _mm_set_epi64x(0, (long long)gmac_poly(ctx->block_len));
+    __m128i lo[2 * MAX_BLOCK_LEN / 16], mid[2 * MAX_BLOCK_LEN / 16], hi[2 * MAX_BLOCK_LEN / 16];
+    __m128i x[MAX_BLOCK_LEN / 16], b[MAX_BLOCK_LEN / 16];
+    size_t i, k, n;
+
+    for (k = 0; k < m; k++) {
+        x[k] = _mm_loadu_si128((const __m128i *)(s + 16 * k));
+    }
+
+    /* S' = (S ^ X_1) * H^n ^ X_2 * H^(n-1) ^ ... ^ X_n * H */
+    while (blocks > 0) {
+        n = (blocks < GMAC_AGG_BLOCKS) ? blocks : GMAC_AGG_BLOCKS;
+        for (k = 0; k < 2 * m; k++) {
+            lo[k] = mid[k] = hi[k] = _mm_setzero_si128();
+        }
+
+        for (i = 0; i < n; i++) {
+            for (k = 0; k < m; k++) {
+                b[k] = _mm_loadu_si128((const __m128i *)(in + i * ctx->block_len + 16 * k));
+                if (i == 0) {
+                    b[k] = _mm_xor_si128(b[k], x[k]);
+                }
+            }
+            gmac_clmul_acc(b, ctx->gmac_hpow[n - 1 - i], m, lo, mid, hi);
+        }
+        gmac_clmul_reduce(poly, m, lo, mid, hi, x);
+
+        blocks -= n;
+        in += n * ctx->block_len;
+    }
+
+    for (k = 0; k < m; k++) {
+        _mm_storeu_si128((__m128i *)(s + 16 * k), x[k]);
+    }
+}
+
+#endif
+
+/* Реалізації ДСТУ 7624, від найшвидшої до загальної; остання не потребує розширень. */
+static const Dstu7624Impl DSTU7624_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"avx512", CPU_FEATURE_AVX512BW | CPU_FEATURE_AVX512VBMI | CPU_FEATURE_GFNI,
+            set_key_avx512, encrypt_blocks_avx512, decrypt_blocks_avx512},
+#endif
+    {"generic", 0, NULL, encrypt_blocks_generic, decrypt_blocks_generic}
+};
+
+/* Реалізації множення GMAC, від найшвидшої до загальної. */
+static const Dstu7624GmacImpl GMAC_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"pclmulqdq", CPU_FEATURE_PCLMUL, gmac_init_clmul, gmac_blocks_clmul},
+#endif
+    {"table4", 0, gmac_init_table, gmac_blocks_table}
+};
+
+static const Dstu7624Impl * volatile dstu7624_impl_selected = NULL;
+static const Dstu7624GmacImpl * volatile gmac_impl_selected = NULL;
+
+void dstu7624_dispatch_init(void)
+{
+    uint32_t features = cpu_features();
+    size_t i = 0;
+
+    while ((DSTU7624_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    dstu7624_impl_selected = &DSTU7624_IMPLS[i];
+    cpu_dispatch_set(CPU_PRIMITIVE_DSTU7624, DSTU7624_IMPLS[i].name);
+
+    i = 0;
+    while ((GMAC_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    gmac_impl_selected = &GMAC_IMPLS[i];
+    cpu_dispatch_set(CPU_PRIMITIVE_DSTU7624_GMAC, GMAC_IMPLS[i].name);
+}
+
+/* Закріплює за контекстом обрану реалізацію і готує її розклад ключа. */
+static void dstu7624_set_impl(Dstu7624Ctx *ctx)
+{
+    if (dstu7624_impl_selected == NULL) {
+        dstu7624_dispatch_init();
+    }
+
+    ctx->impl = dstu7624_impl_selected;
+    if (ctx->impl->set_key != NULL) {
+        ctx->impl->set_key(ctx);
+    }
+    ctx->gmac = gmac_impl_selected;
+}
+
+/* Готує множення на H = E(0) для GCM і GMAC. */
+static void gmac_set_key(Dstu7624Ctx *ctx)
+{
+    uint64_t H[8] = {0};
+    uint8_t h[MAX_BLOCK_LEN];
+
+    ctx->basic_transform(ctx, H);
+    uint64_to_uint8(H, ctx->block_len >> 3, h, ctx->block_len);
+    ctx->gmac->init(ctx, h);
+
+    secure_zero(H, sizeof(H));
+    secure_zero(h, sizeof(h));
+}
+
 static int dstu7624_init(Dstu7624Ctx *ctx, const ByteArray *key, const size_t block_size)
 {
     const uint8_t *key_buf = NULL;
@@ -2487,9 +3159,6 @@ static int dstu7624_init(Dstu7624Ctx *ctx, const ByteArray *key, const size_t bl
     CHECK_PARAM(block_size == KALINA_128_BLOCK_LEN || block_size == KALINA_256_BLOCK_LEN || 
         block_size == KALINA_512_BLOCK_LEN);
 
-    gf2m_free(ctx->mode.gmac.gf2m_ctx);
-    ctx->mode.gmac.gf2m_ctx = NULL;
-
     key_buf = key->buf;
     key_buf_len = key->len;
 
@@ -2537,6 +3206,7 @@ static int dstu7624_init(Dstu7624Ctx *ctx, const ByteArray *key, const size_t bl
     ctx->key_len = key_buf_len;
     memset(ctx->state, 0, MAX_BLOCK_LEN);
     ctx->block_len = block_size;
+    ctx->aead.stage = DSTU7624_AEAD_NONE;
 
     DO(p_key_shift(key_buf, ctx, &p_key_shifts));
     DO(p_help_round_key(key, ctx, p_hrkey));
@@ -2544,6 +3214,7 @@ static int dstu7624_init(Dstu7624Ctx *ctx, const ByteArray *key, const size_t bl
 
     memcpy(&ctx->p_rkeys_rev[0], &ctx->p_rkeys[0], MAX_BLOCK_LEN * 20);
     reverse_rkey(ctx->p_rkeys_rev, ctx);
+    dstu7624_set_impl(ctx);
 
 cleanup:
 
@@ -2560,19 +3231,10 @@ cleanup:
     return ret;
 }
 
-static __inline void decrypt_basic_transform(Dstu7624Ctx *ctx, const uint8_t *cipher_data, uint8_t *plain_data)
+static uint8_t padding(Dstu7624Ctx *ctx, uint8_t *plain_data, size_t *data_size_byte, uint8_t *padded)
 {
-    uint64_t block[8];
-
-    uint8_to_uint64(cipher_data, ctx->block_len, block, ctx->block_len >> 3);
-    ctx->subrowcol_dec(ctx, block);
-    uint64_to_uint8(block, ctx->block_len >> 3, plain_data, ctx->block_len);
-}
-
-static uint8_t padding(Dstu7624Ctx *ctx, uint8_t *plain_data, size_t *data_size_byte, uint8_t *padded)
-{
-    size_t padded_byte;
-    size_t block_len;
+    size_t padded_byte;
+    size_t block_len;
 
     block_len = ctx->block_len;
 
@@ -2618,115 +3280,6 @@ static uint8_t unpadding(uint8_t *padded_data, size_t *data_size_byte, uint8_t *
     return 1;
 }
 
-static int ccm_padd(Dstu7624Ctx *ctx, const ByteArray *auth_data, const ByteArray *plain_data,
-        uint8_t **h_out, size_t Nb)
-{
-    uint8_t *a_data_buf = NULL;
-    uint8_t *p_data_buf = NULL;
-    uint8_t *h = NULL;
-    uint8_t G1[64];
-    uint8_t G2[64];
-    uint8_t B[64];
-    uint64_t B64[8];
-    size_t i;
-    size_t tmp;
-    size_t block_len;
-    size_t a_data_len, p_data_len;
-    int ret = RET_OK;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(auth_data != NULL);
-    CHECK_PARAM(plain_data != NULL);
-    CHECK_PARAM(h_out != NULL);
-    CHECK_PARAM(ctx->block_len >= Nb + 1);
-
-    /*Начало виробки імітовставки*/
-    tmp = ctx->block_len - Nb - 1;
-    block_len = ctx->block_len;
-
-    memset(G1, 0, 64);
-    memset(G2, 0, 64);
-    memset(B, 0, 64);
-    memcpy(G1, ctx->mode.ccm.iv, tmp);
-    a_data_len = ba_get_len(auth_data);
-    CALLOC_CHECKED(a_data_buf, a_data_len + block_len);
-    DO(ba_to_uint8(auth_data, a_data_buf, a_data_len));
-
-    p_data_len = ba_get_len(plain_data);
-    CALLOC_CHECKED(p_data_buf, p_data_len + block_len);
-    DO(ba_to_uint8(plain_data, p_data_buf, p_data_len));
-
-    //Создание заголовка аутентификации
-    G1[tmp] = (uint8_t) p_data_len;
-
-    if (ba_get_len(plain_data) > 0) {
-        G1[block_len - 1] = 1 << 7; //0b10000000
-    } else {
-        G1[block_len - 1] = 0;
-    }
-    //Код довжини імітовставки. Определен у стандарте.
-    switch (ctx->mode.ccm.q) {
-    case 8:
-        G1[block_len - 1] |= 2 << 4;
-        break;
-    case 16:
-        G1[block_len - 1] |= 3 << 4;
-        break;
-    case 32:
-        G1[block_len - 1] |= 4 << 4;
-        break;
-    case 48:
-        G1[block_len - 1] |= 5 << 4;
-        break;
-    case 64:
-        G1[block_len - 1] |= 6 << 4;
-        break;
-    default:
-        break;
-    }
-    G1[block_len - 1] |= ((Nb - 1));
-    //Конец создания заголовка аутентификации
-
-    G2[0] = (uint8_t) a_data_len;
-
-    MALLOC_CHECKED(h, block_len * 2 + a_data_len);
-
-    tmp = a_data_len % block_len;
-
-    memcpy(h, G1, block_len);
-    memcpy(&h[block_len], G2, block_len - tmp);
-    memcpy(&h[block_len + block_len - tmp], a_data_buf, a_data_len);
-
-    for (i = 0; i < a_data_len + block_len + (block_len - tmp); i += block_len) {
-        kalyna_xor(B, &h[i], block_len, B);
-        uint8_to_uint64(B, block_len, B64, block_len >> 3);
-        ctx->basic_transform(ctx, B64);
-        DO(uint64_to_uint8(B64, block_len >> 3, B, block_len));
-    }
-
-    padding(ctx, p_data_buf, &p_data_len, p_data_buf);
-    for (i = 0; i < p_data_len; i += block_len) {
-        kalyna_xor(B, &p_data_buf[i], block_len, B);
-        uint8_to_uint64(B, block_len, B64, block_len >> 3);
-        ctx->basic_transform(ctx, B64);
-        DO(uint64_to_uint8(B64, block_len >> 3, B, block_len));
-    }
-    memcpy(h, B, ctx->mode.ccm.q);
-
-    *h_out = h;
-    h = NULL;
-
-    /*Конец виробки імітовставки*/
-
-cleanup:
-
-    free(a_data_buf);
-    free(p_data_buf);
-    free(h);
-
-    return ret;
-}
-
 static void gamma_gen(uint8_t *gamma)
 {
     size_t i = 0;
@@ -2738,12 +3291,16 @@ static void gamma_gen(uint8_t *gamma)
 
 static int encrypt_ctr(Dstu7624Ctx *ctx, const ByteArray *src, ByteArray **dst)
 {
+    uint8_t ctr[BATCH_LEN];
+    uint8_t ks[BATCH_LEN];
     uint8_t *gamma = ctx->mode.ctr.gamma;
     uint8_t *feed = ctx->mode.ctr.feed;
     size_t offset = ctx->mode.ctr.used_gamma_len;
+    size_t block_len = ctx->block_len;
     ByteArray *out = NULL;
     int ret = RET_OK;
     size_t data_off = 0;
+    size_t i, n;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(src != NULL);
@@ -2767,12 +3324,23 @@ static int encrypt_ctr(Dstu7624Ctx *ctx, const ByteArray *src, ByteArray **dst)
     }
 
     if (data_off < src->len) {
-        /* Шифрування блоками по 8 байт. */
-        for (; data_off + ctx->block_len <= src->len; data_off += ctx->block_len) {
-            kalyna_xor(&src->buf[data_off], gamma, ctx->block_len, &out->buf[data_off]);
+        /* Шифрування повними блоками: гама наступних блоків обчислюється пакетом. */
+        while (data_off + block_len <= src->len) {
+            n = (src->len - data_off) / block_len;
+            if (n > BATCH_LEN / block_len) {
+                n = BATCH_LEN / block_len;
+            }
 
-            gamma_gen(feed);
-            crypt_basic_transform(ctx, feed, gamma);
+            for (i = 0; i < n; i++) {
+                gamma_gen(feed);
+                memcpy(&ctr[i * block_len], feed, block_len);
+            }
+            ctx->impl->encrypt_blocks(ctx, ctr, ks, n);
+
+            kalyna_xor(&src->buf[data_off], gamma, block_len, &out->buf[data_off]);
+            kalyna_xor(&src->buf[data_off + block_len], ks, (n - 1) * block_len, &out->buf[data_off + block_len]);
+            memcpy(gamma, &ks[(n - 1) * block_len], block_len);
+            data_off += n * block_len;
         }
         /* Шифрування последнйого неполного блока. */
         for (; data_off < src->len; data_off++) {
@@ -2789,226 +3357,121 @@ cleanup:
     return ret;
 }
 
-static int dstu7624_encrypt_ccm(Dstu7624Ctx *ctx, const ByteArray *auth_data, const ByteArray *plain_data,
-        ByteArray **h_ba, ByteArray **cipher_data)
-{
-    uint8_t *p_data_buf = NULL;
-    uint8_t *h = NULL;
-    uint8_t *h_tmp = NULL;
-    size_t p_data_len;
-    size_t block_len;
-    size_t q;
-    Dstu7624CcmCtx *ccm;
-    Dstu7624Ctx *ctr = NULL;
-    ByteArray *pdata_buf_part = NULL;
-    ByteArray *h_part = NULL;
-    int ret = RET_OK;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(auth_data != NULL);
-    CHECK_PARAM(plain_data != NULL);
-    CHECK_PARAM(h_ba != NULL);
-    CHECK_PARAM(cipher_data != NULL);
-
-    if (ctx->mode_id != DSTU7624_MODE_CCM) {
-        SET_ERROR(RET_INVALID_CTX_MODE);
-    }
-
-    ccm = &ctx->mode.ccm;
-    DO(ccm_padd(ctx, auth_data, plain_data, &h_tmp, ccm->nb));
-
-    q = ccm->q;
-    block_len = ctx->block_len;
-
-    CHECK_NOT_NULL(*h_ba = ba_alloc_from_uint8(h_tmp, q));
-    p_data_len = ba_get_len(plain_data);
-    MALLOC_CHECKED(p_data_buf, p_data_len + block_len);
-    DO(ba_to_uint8(plain_data, p_data_buf, p_data_len));
-
-    MALLOC_CHECKED(h, p_data_len + block_len);
-
-    CHECK_NOT_NULL(ctr = dstu7624_alloc(DSTU7624_SBOX_1));
-    DO(dstu7624_init_ctr(ctr, ccm->key, ccm->iv_tmp));
-    DO(encrypt_ctr(ctr, plain_data, &pdata_buf_part));
-    DO(encrypt_ctr(ctr, *h_ba, &h_part));
-
-    CHECK_NOT_NULL(*cipher_data = ba_join(pdata_buf_part, h_part));
-
-cleanup:
-
-    dstu7624_free(ctr);
-    ba_free(h_part);
-    ba_free(pdata_buf_part);
-    free(p_data_buf);
-    free(h);
-    free(h_tmp);
-
-    return ret;
-}
-
-static int dstu7624_decrypt_ccm(Dstu7624Ctx *ctx, const ByteArray *auth_data, const ByteArray *cipher_data,
-        ByteArray *h_ba, ByteArray **plain_data)
+static int encrypt_ecb(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
 {
-    uint8_t *p_data_buf = NULL;
-    uint8_t *check_h = NULL;
-    int ret = RET_OK;
-    Dstu7624CcmCtx *ccm;
-    Dstu7624Ctx *ctr = NULL;
-    ByteArray *p_data_part = NULL;
-    size_t part_len;
     ByteArray *ans = NULL;
+    int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(auth_data != NULL);
-    CHECK_PARAM(cipher_data != NULL);
-    CHECK_PARAM(h_ba != NULL);
-    CHECK_PARAM(plain_data != NULL);
+    CHECK_PARAM(in != NULL);
+    CHECK_PARAM(out != NULL);
+    CHECK_PARAM(in->len != 0);
 
-    if (ctx->mode_id != DSTU7624_MODE_CCM) {
-        SET_ERROR(RET_INVALID_CTX_MODE);
+    if (in->len % ctx->block_len != 0) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    ccm = &ctx->mode.ccm;
-
-    CHECK_NOT_NULL(ctr = dstu7624_alloc(DSTU7624_SBOX_1));
-    DO(dstu7624_init_ctr(ctr, ccm->key, ccm->iv_tmp));
-    DO(encrypt_ctr(ctr, cipher_data, &p_data_part));
-
-    DO(ba_to_uint8_with_alloc(p_data_part, &p_data_buf, &part_len));
-    CHECK_NOT_NULL(ans = ba_alloc_from_uint8(p_data_buf, part_len - ccm->q));
-    DO(ccm_padd(ctx, auth_data, ans, &check_h, ctx->mode.ccm.nb));
+    CHECK_NOT_NULL(ans = ba_alloc_by_len(in->len));
+    ctx->impl->encrypt_blocks(ctx, in->buf, ans->buf, in->len / ctx->block_len);
 
-    if (memcmp(check_h, ba_get_buf_const(h_ba), ccm->q) != 0) {
-        SET_ERROR(RET_VERIFY_FAILED);
-    }
-
-    *plain_data = ans;
+    *out = ans;
     ans = NULL;
 
 cleanup:
 
-    free(p_data_buf);
-    dstu7624_free(ctr);
-    ba_free(p_data_part);
-    free(check_h);
     ba_free(ans);
 
     return ret;
 }
 
-static int encrypt_ecb(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
+static int decrypt_ecb(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
 {
-    uint64_t *plain_data = NULL;
-    size_t block_len_word;
-    size_t plain_data_size_word;
-    size_t i;
+    ByteArray *ans = NULL;
     int ret = RET_OK;
-    block_len_word = ctx->block_len >> 3;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(in != NULL);
     CHECK_PARAM(out != NULL);
+    CHECK_PARAM(in->len != 0);
 
     if (in->len % ctx->block_len != 0) {
         SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    DO(ba_to_uint64_with_alloc(in, &plain_data, &plain_data_size_word));
+    CHECK_NOT_NULL(ans = ba_alloc_by_len(in->len));
+    ctx->impl->decrypt_blocks(ctx, in->buf, ans->buf, in->len / ctx->block_len);
 
-    for (i = 0; i < plain_data_size_word; i += block_len_word) {
-        ctx->basic_transform(ctx, &plain_data[i]);
-    }
-
-    CHECK_NOT_NULL(*out = ba_alloc_from_uint64(plain_data, plain_data_size_word));
+    *out = ans;
+    ans = NULL;
 
 cleanup:
 
-    free(plain_data);
+    ba_free(ans);
 
     return ret;
 }
 
-static int decrypt_ecb(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
+/* Множення твіка XTS на x у полі GF(2^n) з многочленом режиму. */
+static void xts_mul_alpha(uint8_t *tweak, size_t block_len)
 {
-    uint64_t *plain_data = NULL;
-    size_t block_len_word;
-    size_t plain_data_size_word;
+    uint8_t mask = (uint8_t)(0 - (tweak[block_len - 1] >> 7));
     size_t i;
-    int ret = RET_OK;
-    block_len_word = ctx->block_len >> 3;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(in != NULL);
-    CHECK_PARAM(out != NULL);
 
-    if (in->len % ctx->block_len != 0) {
-        SET_ERROR(RET_INVALID_DATA_LEN);
+    for (i = block_len - 1; i > 0; i--) {
+        tweak[i] = (uint8_t)((tweak[i] << 1) | (tweak[i - 1] >> 7));
     }
+    tweak[0] = (uint8_t)(tweak[0] << 1);
 
-    DO(ba_to_uint64_with_alloc(in, &plain_data, &plain_data_size_word));
-
-    for (i = 0; i < plain_data_size_word; i += block_len_word) {
-        ctx->subrowcol_dec(ctx, &plain_data[i]);
+    switch (block_len) {
+    case KALINA_128_BLOCK_LEN:
+        tweak[0] ^= mask & 0x87;    /* x^128 + x^7 + x^2 + x + 1 */
+        break;
+    case KALINA_256_BLOCK_LEN:
+        tweak[0] ^= mask & 0x25;    /* x^256 + x^10 + x^5 + x^2 + 1 */
+        tweak[1] ^= mask & 0x04;
+        break;
+    default:
+        tweak[0] ^= mask & 0x25;    /* x^512 + x^8 + x^5 + x^2 + 1 */
+        tweak[1] ^= mask & 0x01;
+        break;
     }
-
-    CHECK_NOT_NULL(*out = ba_alloc_from_uint64(plain_data, plain_data_size_word));
-
-cleanup:
-
-    free(plain_data);
-
-    return ret;
 }
 
-static int gf2m_mul(Gf2mCtx *ctx, size_t block_len, uint8_t *arg1, uint8_t *arg2, uint8_t *out)
+/* Перетворення повних блоків XTS пакетами: data ^= T; E/D(data); data ^= T. */
+static void xts_crypt_blocks(Dstu7624Ctx *ctx, bool encrypt, uint8_t *gamma, uint8_t *data, size_t blocks)
 {
-    WordArray *wa_arg1 = NULL;
-    WordArray *wa_arg2 = NULL;
-    WordArray *wa_res = NULL;
-    int ret = RET_OK;
-    size_t mod_len;
-    size_t old_len;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(arg1 != NULL);
-    CHECK_PARAM(arg2 != NULL);
-    CHECK_PARAM(out != NULL);
-
-    CHECK_NOT_NULL(wa_arg2 = wa_alloc_from_uint8(arg2, block_len));
-    CHECK_NOT_NULL(wa_arg1 = wa_alloc_from_uint8(arg1, block_len));
-
-    mod_len = ctx->len;
-    old_len = wa_arg1->len;
-
-    CHECK_NOT_NULL(wa_res = wa_alloc(mod_len));
-
-    wa_change_len(wa_arg1, mod_len);
-    wa_change_len(wa_arg2, mod_len);
-
-    gf2m_mod_mul(ctx, wa_arg1, wa_arg2, wa_res);
+    uint8_t tweak[BATCH_LEN];
+    size_t block_len = ctx->block_len;
+    size_t i, n;
 
-    wa_res->len = old_len;
-    DO(wa_to_uint8(wa_res, out, block_len));
-    wa_res->len = mod_len;
+    while (blocks > 0) {
+        n = (blocks < BATCH_LEN / block_len) ? blocks : BATCH_LEN / block_len;
 
-cleanup:
+        for (i = 0; i < n; i++) {
+            xts_mul_alpha(gamma, block_len);
+            memcpy(&tweak[i * block_len], gamma, block_len);
+        }
 
-    wa_free(wa_res);
-    wa_free(wa_arg2);
-    wa_free(wa_arg1);
+        kalyna_xor(data, tweak, n * block_len, data);
+        if (encrypt) {
+            ctx->impl->encrypt_blocks(ctx, data, data, n);
+        } else {
+            ctx->impl->decrypt_blocks(ctx, data, data, n);
+        }
+        kalyna_xor(data, tweak, n * block_len, data);
 
-    return ret;
+        data += n * block_len;
+        blocks -= n;
+    }
 }
 
 static int encrypt_xts(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
 {
     uint8_t *plain_data = NULL;
-    uint8_t two[64] = {0};
     uint8_t gamma[64] = {0};
     size_t plain_size;
     size_t i;
     size_t block_len;
-    size_t loop_len;
     size_t padded_len = 0;
     int ret = RET_OK;
 
@@ -3017,28 +3480,21 @@ static int encrypt_xts(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
     CHECK_PARAM(out != NULL);
 
     block_len = ctx->block_len;
-    two[0] = 2;
 
     plain_size = ba_get_len(in);
 
     padded_len = block_len - (plain_size % block_len);
+    if (padded_len != block_len && plain_size < block_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
+    }
+
     MALLOC_CHECKED(plain_data, plain_size + padded_len);
     DO(ba_to_uint8(in, plain_data, plain_size));
 
     crypt_basic_transform(ctx, ctx->mode.xts.iv, gamma);
 
-    if (padded_len == block_len) {
-        loop_len = plain_size;
-    } else {
-        loop_len = plain_size - block_len;
-    }
-
-    for (i = 0; i < loop_len; i += block_len) {
-        DO(gf2m_mul(ctx->mode.xts.gf2m_ctx, block_len, gamma, two, gamma));
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
-        crypt_basic_transform(ctx, &plain_data[i], &plain_data[i]);
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
-    }
+    xts_crypt_blocks(ctx, true, gamma, plain_data, plain_size / block_len);
+    i = plain_size - plain_size % block_len;
 
     if (padded_len != block_len) {
         //Дополняем последний блок шифротекстом предпоследнего
@@ -3046,11 +3502,7 @@ static int encrypt_xts(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
         memcpy(&plain_data[i], &plain_data[i - block_len], padded_len);
         i -= plain_size % block_len;
 
-        //Конвертируем а для бе машин.
-        DO(gf2m_mul(ctx->mode.xts.gf2m_ctx, block_len, gamma, two, gamma));
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
-        crypt_basic_transform(ctx, &plain_data[i], &plain_data[i]);
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
+        xts_crypt_blocks(ctx, true, gamma, &plain_data[i], 1);
         //Меняем n-1 блок и nй местами.
         memcpy(gamma, &plain_data[i - block_len], block_len);
         memcpy(&plain_data[i - block_len], &plain_data[i], block_len);
@@ -3070,52 +3522,46 @@ static int decrypt_xts(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
 {
     uint8_t *plain_data = NULL;
     uint8_t gamma[64];
-    uint8_t two[64] = {0};
+    uint8_t two[64];
     size_t plain_size;
     size_t block_len;
     size_t i;
     int ret = RET_OK;
     size_t padded_len;
-    size_t loop_num;
+    size_t blocks;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(in != NULL);
     CHECK_PARAM(out != NULL);
 
-    two[0] = 2;
-
     block_len = ctx->block_len;
 
     memset(gamma, 0, 64);
 
     plain_size = ba_get_len(in);
     padded_len = block_len - (plain_size % block_len);
+    if (padded_len != block_len && plain_size < block_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
+    }
+
     MALLOC_CHECKED(plain_data, plain_size + padded_len);
     DO(ba_to_uint8(in, plain_data, plain_size));
 
     crypt_basic_transform(ctx, ctx->mode.xts.iv, gamma);
 
-    if (padded_len == block_len) {
-        loop_num = plain_size;
-    } else {
-        loop_num = plain_size < 2 * block_len ? 0 : plain_size - 2 * block_len;
-    }
-
-    for (i = 0; i < loop_num; i += block_len) {
-        DO(gf2m_mul(ctx->mode.xts.gf2m_ctx, block_len, gamma, two, gamma));
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
-        decrypt_basic_transform(ctx, &plain_data[i], &plain_data[i]);
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
+    blocks = plain_size / block_len;
+    if (padded_len != block_len) {
+        blocks--;
     }
+    xts_crypt_blocks(ctx, false, gamma, plain_data, blocks);
+    i = blocks * block_len;
 
     if (padded_len != block_len) {
         //Если было дополнение, на вход приходят последний и предпоследний блок
         //Так как при дополнении в шифровании меняются местами последний и предпоследний блоки, расшифровуем последний блок, как предпоследний
-        DO(gf2m_mul(ctx->mode.xts.gf2m_ctx, block_len, gamma, two, gamma));
-        DO(gf2m_mul(ctx->mode.xts.gf2m_ctx, block_len, gamma, two, two));
-        kalyna_xor(&plain_data[i], two, block_len, &plain_data[i]);
-        decrypt_basic_transform(ctx, &plain_data[i], &plain_data[i]);
-        kalyna_xor(&plain_data[i], two, block_len, &plain_data[i]);
+        memcpy(two, gamma, block_len);
+        xts_mul_alpha(two, block_len);
+        xts_crypt_blocks(ctx, false, two, &plain_data[i], 1);
 
         //В конце предпоследнего блока хранится дополнение к последнему блоку
         i += block_len;
@@ -3124,9 +3570,7 @@ static int decrypt_xts(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
         memcpy(&plain_data[i], &plain_data[i - block_len], padded_len);
         i -= plain_size % block_len;
 
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
-        decrypt_basic_transform(ctx, &plain_data[i], &plain_data[i]);
-        kalyna_xor(&plain_data[i], gamma, block_len, &plain_data[i]);
+        xts_crypt_blocks(ctx, false, gamma, &plain_data[i], 1);
 
         //Меняем n-1 блок и nй местами.
         memcpy(gamma, &plain_data[i - block_len], block_len);
@@ -3233,287 +3677,409 @@ cleanup:
     return ret;
 }
 
-static int dstu7624_encrypt_gcm(Dstu7624Ctx *ctx, const ByteArray *plain_data, const ByteArray *auth_data,
-        ByteArray **h, ByteArray **cipher_text)
+static size_t aead_tag_len(const Dstu7624Ctx *ctx)
 {
-    uint8_t *auth_buf = NULL;
-    uint8_t *plain_buf = NULL;
-    uint64_t gamma[8];
-    uint8_t gamma8[64];
-    uint64_t gamma_old[8];
-    uint64_t H[8];
-    uint64_t B[8];
-    uint8_t H8[64];
-    uint8_t B8[64];
-    size_t auth_len;
-    size_t plain_len;
-    size_t i = 0;
-    size_t block_len;
-    size_t block_len_word;
-    int ret = RET_OK;
-
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(plain_data != NULL);
-    CHECK_PARAM(auth_data != NULL);
-    CHECK_PARAM(h != NULL);
-    CHECK_PARAM(cipher_text != NULL);
+    return (ctx->mode_id == DSTU7624_MODE_GCM) ? ctx->mode.gcm.q : ctx->mode.ccm.q;
+}
 
-    block_len = ctx->block_len;
-    block_len_word = block_len >> 3;
+/* Гамування GCM/CCM: гама i-го блока - E(E(IV) + i). */
+static void aead_crypt(Dstu7624Ctx *ctx, const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint8_t ctr[BATCH_LEN];
+    uint8_t ks[BATCH_LEN];
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    size_t block_len = ctx->block_len;
+    size_t i, n;
 
-    memset(gamma, 0, 64);
-    memset(gamma_old, 0, 64);
-    memset(B, 0, 64);
-    memset(H, 0, 64);
+    while (len > 0 && aead->gamma_off < block_len) {
+        *out++ = *in++ ^ aead->gamma[aead->gamma_off++];
+        len--;
+    }
 
-    auth_len = ba_get_len(auth_data);
-    MALLOC_CHECKED(auth_buf, auth_len + block_len);
-    plain_len = ba_get_len(plain_data);
-    MALLOC_CHECKED(plain_buf, plain_len + block_len);
+    while (len >= block_len) {
+        n = len / block_len;
+        if (n > BATCH_LEN / block_len) {
+            n = BATCH_LEN / block_len;
+        }
 
-    memcpy(gamma_old, ctx->mode.gcm.iv, ctx->block_len);
-    ctx->basic_transform(ctx, gamma_old);
+        for (i = 0; i < n; i++) {
+            aead->ctr[0]++;
+            uint64_to_uint8(aead->ctr, block_len >> 3, &ctr[i * block_len], block_len);
+        }
+        ctx->impl->encrypt_blocks(ctx, ctr, ks, n);
+        kalyna_xor((void *)in, ks, n * block_len, out);
 
-    DO(ba_to_uint8(auth_data, auth_buf, auth_len));
-    DO(ba_to_uint8(plain_data, plain_buf, plain_len));
-    memset(auth_buf + auth_len, 0, block_len);
+        in += n * block_len;
+        out += n * block_len;
+        len -= n * block_len;
+    }
 
-    /*Шифрування і обеспечение целостности.*/
-    for (i = 0; i < plain_len; i += block_len) {
-        gamma_old[0]++;
-        memcpy(gamma, gamma_old, block_len);
-        ctx->basic_transform(ctx, gamma);
-        uint64_to_uint8(gamma, block_len_word, gamma8, block_len);
-        kalyna_xor(&plain_buf[i], gamma8, block_len, &plain_buf[i]);
+    if (len > 0) {
+        aead->ctr[0]++;
+        uint64_to_uint8(aead->ctr, block_len >> 3, ctr, block_len);
+        crypt_basic_transform(ctx, ctr, aead->gamma);
+        kalyna_xor((void *)in, aead->gamma, len, out);
+        aead->gamma_off = len;
     }
+}
 
-    CHECK_NOT_NULL(*cipher_text = ba_alloc_from_uint8(plain_buf, plain_len));
+static void aead_auth_blocks(Dstu7624Ctx *ctx, const uint8_t *in, size_t blocks)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    size_t block_len = ctx->block_len;
 
-    /*Выработка імітовставки.*/
-    padding(ctx, plain_buf, &plain_len, plain_buf);
-    ctx->basic_transform(ctx, H);
-    /*H - у ле формате. Для умножения нам нужно 2 бе формата. auth_buf - бе.*/
-    DO(uint64_to_uint8(H, block_len_word, H8, block_len));
-    for (i = 0; i < auth_len; i += block_len) {
-        kalyna_xor(&auth_buf[i], B, block_len, B);
-        DO(gf2m_mul(ctx->mode.gcm.gf2m_ctx, block_len, (uint8_t *) B, H8, (uint8_t *) B));
+    if (ctx->mode_id == DSTU7624_MODE_GCM) {
+        ctx->gmac->blocks(ctx, aead->mac, in, blocks);
+        return;
     }
 
-    for (i = 0; i < plain_len; i += block_len) {
-        kalyna_xor(&plain_buf[i], B, block_len, B);
-        DO(gf2m_mul(ctx->mode.gcm.gf2m_ctx, block_len, (uint8_t *) B, H8, (uint8_t *) B));
+    for (; blocks > 0; blocks--, in += block_len) {
+        kalyna_xor(aead->mac, (void *)in, block_len, aead->mac);
+        crypt_basic_transform(ctx, aead->mac, aead->mac);
     }
+}
 
-    memset(H, 0, 64);
-    auth_len <<= 3;
-    plain_len <<= 3;
-    for (i = 0; auth_len != 0; i++) {
-        H[0] ^= (auth_len & 255) << (i << 3);
-        auth_len >>= 8;
+/* Додає дані до GMAC (GCM) або CBC-MAC (CCM); неповний блок накопичується у buf. */
+static int aead_auth_update(Dstu7624Ctx *ctx, const uint8_t *in, size_t len)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    size_t block_len = ctx->block_len;
+    size_t l;
+    int ret = RET_OK;
+
+    if (aead->buf_len > 0) {
+        l = block_len - aead->buf_len;
+        if (l > len) {
+            l = len;
+        }
+        memcpy(aead->buf + aead->buf_len, in, l);
+        aead->buf_len += l;
+        in += l;
+        len -= l;
+
+        if (aead->buf_len < block_len) {
+            goto cleanup;
+        }
+        aead_auth_blocks(ctx, aead->buf, 1);
+        aead->buf_len = 0;
     }
-    for (i = 0; plain_len != 0; i++) {
-        H[((block_len / 2) >> 3)] ^= (plain_len & 255) << (i << 3);
-        plain_len >>= 8;
+
+    l = len / block_len;
+    if (l > 0) {
+        aead_auth_blocks(ctx, in, l);
+        in += l * block_len;
+        len -= l * block_len;
     }
 
-    DO(uint64_to_uint8(B, block_len_word, B8, block_len));
-    kalyna_xor(H, B8, block_len, H);
-    ctx->basic_transform(ctx, H);
-    DO(uint64_to_uint8(H, block_len_word, H8, block_len));
-    CHECK_NOT_NULL(*h = ba_alloc_from_uint8(H8, ctx->mode.gcm.q));
+    if (len > 0) {
+        memcpy(aead->buf, in, len);
+        aead->buf_len = len;
+    }
 
 cleanup:
 
-    free(plain_buf);
-    free(auth_buf);
+    return ret;
+}
+
+/* Доповнює неповний блок: 0x80 00..00 для даних повідомлення, нулями для відкритого тексту GCM. */
+static void aead_auth_pad(Dstu7624Ctx *ctx, uint8_t marker)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+
+    if (aead->buf_len > 0) {
+        aead->buf[aead->buf_len] = marker;
+        memset(&aead->buf[aead->buf_len + 1], 0, ctx->block_len - aead->buf_len - 1);
+        aead_auth_blocks(ctx, aead->buf, 1);
+        aead->buf_len = 0;
+    }
+}
+
+/* CCM: заголовок автентифікації G1 і блок довжини відкритого тексту G2. */
+static int aead_ccm_start(Dstu7624Ctx *ctx)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    uint8_t G1[MAX_BLOCK_LEN];
+    uint8_t G2[MAX_BLOCK_LEN];
+    size_t block_len = ctx->block_len;
+    size_t nb = ctx->mode.ccm.nb;
+    size_t tmp;
+    int ret = RET_OK;
+
+    CHECK_PARAM(block_len >= nb + 1);
+
+    tmp = block_len - nb - 1;
+
+    memset(G1, 0, MAX_BLOCK_LEN);
+    memset(G2, 0, MAX_BLOCK_LEN);
+    memcpy(G1, ctx->mode.ccm.iv, tmp);
+
+    G1[tmp] = (uint8_t) aead->data_total;
+
+    if (aead->data_total > 0) {
+        G1[block_len - 1] = 1 << 7; //0b10000000
+    } else {
+        G1[block_len - 1] = 0;
+    }
+    //Код довжини імітовставки. Определен у стандарте.
+    switch (ctx->mode.ccm.q) {
+    case 8:
+        G1[block_len - 1] |= 2 << 4;
+        break;
+    case 16:
+        G1[block_len - 1] |= 3 << 4;
+        break;
+    case 32:
+        G1[block_len - 1] |= 4 << 4;
+        break;
+    case 48:
+        G1[block_len - 1] |= 5 << 4;
+        break;
+    case 64:
+        G1[block_len - 1] |= 6 << 4;
+        break;
+    default:
+        break;
+    }
+    G1[block_len - 1] |= ((nb - 1));
+
+    G2[0] = (uint8_t) aead->aad_total;
+
+    DO(aead_auth_update(ctx, G1, block_len));
+    /* G2 скорочується так, щоб відкритий текст закінчувався на межі блока. */
+    DO(aead_auth_update(ctx, G2, block_len - (size_t)(aead->aad_total % block_len)));
+
+    uint8_to_uint64(ctx->mode.ccm.iv, block_len, aead->ctr, block_len >> 3);
+    ctx->basic_transform(ctx, aead->ctr);
+
+cleanup:
 
     return ret;
 }
 
-static int dstu7624_decrypt_gcm(Dstu7624Ctx *ctx, const ByteArray *cipher_data, const ByteArray *h_ba,
-        const ByteArray *auth_data, ByteArray **out)
+static int aead_init(Dstu7624Ctx *ctx, bool encrypt, uint64_t auth_data_len, uint64_t data_len)
 {
-    uint8_t *auth_buf = NULL;
-    uint8_t *plain_buf = NULL;
-    uint64_t *h = NULL;
-    uint64_t gamma[8];
-    uint8_t gamma8[64];
-    uint64_t gamma_old[8];
-    uint64_t H[8];
-    uint8_t H8[64];
-    uint64_t B[8];
-    uint8_t B8[64];
-    size_t auth_len;
-    size_t plain_len;
-    size_t h_len;
-    size_t block_len;
-    size_t block_len_word;
-    size_t i = 0;
+    Dstu7624AeadCtx *aead;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(cipher_data != NULL);
-    CHECK_PARAM(h_ba != NULL);
-    CHECK_PARAM(auth_data != NULL);
-    CHECK_PARAM(out != NULL);
 
-    block_len = ctx->block_len;
-    block_len_word = block_len >> 3;
+    aead = &ctx->aead;
+    memset(aead, 0, sizeof(Dstu7624AeadCtx));
+    aead->encrypt = encrypt;
+    aead->gamma_off = ctx->block_len;
+    aead->aad_total = auth_data_len;
+    aead->data_total = data_len;
 
-    memset(gamma, 0, 64);
-    memset(gamma_old, 0, 64);
-    memset(B, 0, 64);
-    memset(H, 0, 64);
+    switch (ctx->mode_id) {
+    case DSTU7624_MODE_GCM:
+        memcpy(aead->ctr, ctx->mode.gcm.iv, ctx->block_len);
+        ctx->basic_transform(ctx, aead->ctr);
+        break;
+    case DSTU7624_MODE_CCM:
+        DO(aead_ccm_start(ctx));
+        break;
+    default:
+        SET_ERROR(RET_INVALID_CTX_MODE);
+    }
 
-    auth_len = ba_get_len(auth_data);
-    MALLOC_CHECKED(auth_buf, auth_len + block_len);
-    plain_len = ba_get_len(cipher_data);
-    MALLOC_CHECKED(plain_buf, plain_len + block_len);
+    aead->stage = DSTU7624_AEAD_AAD;
 
-    memcpy(gamma_old, ctx->mode.gcm.iv, ctx->block_len);
-    ctx->basic_transform(ctx, gamma_old);
+cleanup:
 
-    DO(ba_to_uint8(auth_data, auth_buf, auth_len));
-    DO(ba_to_uint8(cipher_data, plain_buf, plain_len));
-    memset(auth_buf + auth_len, 0, block_len);
+    return ret;
+}
 
-    /*Выработка імітовставки.*/
-    padding(ctx, plain_buf, &plain_len, plain_buf);
+/* Завершує відкритий текст повідомлення перед першим блоком даних. */
+static int aead_begin_data(Dstu7624Ctx *ctx)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    int ret = RET_OK;
 
-    ctx->basic_transform(ctx, H);
-    /*H - у ле формате. Для умножения нам нужно 2 бе формата. auth_buf - бе.*/
-    uint64_to_uint8(H, block_len_word, H8, block_len);
-    for (i = 0; i < auth_len; i += block_len) {
-        kalyna_xor(&auth_buf[i], B, block_len, B);
-        DO(gf2m_mul(ctx->mode.gcm.gf2m_ctx, block_len, (uint8_t *) B, (uint8_t *) H8, (uint8_t *) B));
+    if (aead->stage == DSTU7624_AEAD_AAD) {
+        if (aead->aad_len != aead->aad_total) {
+            SET_ERROR(RET_INVALID_DATA_LEN);
+        }
+        aead_auth_pad(ctx, 0);
+        aead->stage = DSTU7624_AEAD_DATA;
     }
 
-    for (i = 0; i < plain_len; i += block_len) {
-        kalyna_xor(&plain_buf[i], B, block_len, B);
-        DO(gf2m_mul(ctx->mode.gcm.gf2m_ctx, block_len, (uint8_t *) B, H8, (uint8_t *) B));
+    if (aead->stage != DSTU7624_AEAD_DATA) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
     }
 
-    memset(H, 0, 64);
+cleanup:
+
+    return ret;
+}
+
+static int aead_update(Dstu7624Ctx *ctx, bool encrypt, const ByteArray *in, ByteArray **out)
+{
+    Dstu7624AeadCtx *aead;
+    ByteArray *ba_out = NULL;
+    uint64_t rest;
+    size_t len;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(in != NULL);
+    CHECK_PARAM(out != NULL);
 
-    auth_len <<= 3;
-    plain_len <<= 3;
-    for (i = 0; auth_len != 0; i++) {
-        H[0] ^= (auth_len & 255) << (i << 3);
-        auth_len >>= 8;
+    aead = &ctx->aead;
+    if (aead->encrypt != encrypt) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
     }
-    for (i = 0; plain_len != 0; i++) {
-        H[((block_len / 2) >> 3)] ^= (plain_len & 255) << (i << 3);
-        plain_len >>= 8;
+    DO(aead_begin_data(ctx));
+
+    len = in->len;
+    if (ctx->mode_id == DSTU7624_MODE_CCM) {
+        rest = aead->data_total - aead->data_len;
+        if (len > rest) {
+            /* Шифртекст CCM завершується зашифрованою імітовставкою, її байти пропускаються. */
+            if (encrypt || (len - rest > ctx->mode.ccm.q - aead->tail_len)) {
+                SET_ERROR(RET_INVALID_DATA_LEN);
+            }
+            aead->tail_len += len - rest;
+            len = (size_t) rest;
+        }
+    } else if (len > aead->data_total - aead->data_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    DO(uint64_to_uint8(B, block_len_word, B8, block_len));
-    kalyna_xor(H, B8, block_len, H);
-    ctx->basic_transform(ctx, H);
-
-    DO(ba_to_uint64_with_alloc(h_ba, &h, &h_len));
+    CHECK_NOT_NULL(ba_out = ba_alloc_by_len(len));
+    aead_crypt(ctx, in->buf, ba_out->buf, len);
 
-    if (memcmp(H, h, ctx->mode.gcm.q)) {
-        SET_ERROR(RET_VERIFY_FAILED);
+    /* GCM автентифікує шифртекст, CCM - відкритий текст. */
+    if ((ctx->mode_id == DSTU7624_MODE_GCM) == encrypt) {
+        DO(aead_auth_update(ctx, ba_out->buf, len));
+    } else {
+        DO(aead_auth_update(ctx, in->buf, len));
     }
+    aead->data_len += len;
 
-    /*Шифрування і забезпечення цілісності.*/
-    auth_len = ba_get_len(auth_data);
-    plain_len = ba_get_len(cipher_data);
+    *out = ba_out;
+    ba_out = NULL;
+
+cleanup:
 
-    for (i = 0; i < plain_len; i += ctx->block_len) {
-        gamma_old[0]++;
-        memcpy(gamma, gamma_old, ctx->block_len);
-        ctx->basic_transform(ctx, gamma);
-        DO(uint64_to_uint8(gamma, block_len_word, gamma8, block_len));
-        kalyna_xor(&plain_buf[i], gamma8, block_len, &plain_buf[i]);
+    ba_free(ba_out);
+
+    return ret;
+}
+
+static int aead_final(Dstu7624Ctx *ctx, bool encrypt, uint8_t *tag)
+{
+    Dstu7624AeadCtx *aead = &ctx->aead;
+    uint64_t H[8];
+    uint64_t padded_len;
+    size_t block_len = ctx->block_len;
+    int ret = RET_OK;
+
+    if (aead->encrypt != encrypt) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
+    }
+    DO(aead_begin_data(ctx));
+
+    if (aead->data_len != aead->data_total) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
     }
 
-    CHECK_NOT_NULL(*out = ba_alloc_from_uint8(plain_buf, plain_len));
+    padded_len = aead->data_len;
+    if (aead->buf_len > 0) {
+        padded_len += block_len - aead->buf_len;
+    }
+    aead_auth_pad(ctx, 0x80);
+
+    if (ctx->mode_id == DSTU7624_MODE_GCM) {
+        /* Блок довжин (у бітах): відкритий текст і доповнений шифртекст. */
+        DO(uint8_to_uint64(aead->mac, block_len, H, block_len >> 3));
+        H[0] ^= aead->aad_len << 3;
+        H[(block_len / 2) >> 3] ^= padded_len << 3;
+        ctx->basic_transform(ctx, H);
+        DO(uint64_to_uint8(H, block_len >> 3, tag, block_len));
+    } else {
+        memcpy(tag, aead->mac, block_len);
+    }
 
 cleanup:
 
-    free(h);
-    free(plain_buf);
-    free(auth_buf);
+    if (ctx != NULL) {
+        ctx->aead.stage = DSTU7624_AEAD_NONE;
+    }
 
     return ret;
 }
 
 static int gmac_update(Dstu7624Ctx *ctx, const ByteArray *plain_data)
 {
-    uint8_t *data_buf = NULL;
-    uint8_t *last_block = NULL;
-    uint64_t *B = NULL;
-    uint64_t *H = NULL;
-    uint8_t H8[MAX_BLOCK_LEN];
-    uint8_t B8[MAX_BLOCK_LEN];
+    Dstu7624GmacCtx *gmac = NULL;
+    const uint8_t *data_buf;
     size_t data_len;
     size_t block_len;
-    size_t tail_len;
-    size_t last_block_len;
-    size_t i;
+    size_t n;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(plain_data != NULL);
 
-    B = ctx->mode.gmac.B;
-    H = ctx->mode.gmac.H;
+    gmac = &ctx->mode.gmac;
     block_len = ctx->block_len;
-    last_block = ctx->mode.gmac.last_block;
-    last_block_len = ctx->mode.gmac.last_block_len;
-
-    //Приводим данные к u8 типу
-    DO(uint64_to_uint8(B, block_len >> 3, B8, block_len));
-    DO(uint64_to_uint8(H, block_len >> 3, H8, block_len));
-
     data_buf = plain_data->buf;
     data_len = plain_data->len;
 
-    ctx->mode.gmac.msg_tot_len += data_len;
-    //Если последний блок не пустой:
-    if (last_block_len != 0) {
-        /*Если длинна последнего блока и данных в сумме меньше размера блока*/
-        if (last_block_len + data_len < block_len) {
-            //Добавляем в конец последнего блока новые данные
-            memcpy(&last_block[last_block_len], data_buf, data_len);
-            ctx->mode.gmac.last_block_len += data_len;
-            goto cleanup;
-        } else {
-            //Ксорим последний блок с текущими данными
-            kalyna_xor(last_block, B8, last_block_len, B8);
-            tail_len = block_len - last_block_len;
-            //Ксорим первые байты из пришедшего блока, до размера блока.
-            kalyna_xor(data_buf, &B8[last_block_len], tail_len, &B[last_block_len]);
-            data_len -= tail_len;
+    gmac->msg_tot_len += data_len;
+    if (data_len == 0) {
+        goto cleanup;
+    }
+
+    /* Доповнюємо накопичений неповний блок. */
+    if (gmac->last_block_len != 0) {
+        n = block_len - gmac->last_block_len;
+        if (n > data_len) {
+            n = data_len;
         }
-    } else {
+        memcpy(&gmac->last_block[gmac->last_block_len], data_buf, n);
+        gmac->last_block_len += n;
+        data_buf += n;
+        data_len -= n;
 
-        if (data_len >= block_len) {
-            kalyna_xor(&data_buf[0], B8, block_len, B8);
-        } else {
-            memcpy(last_block, data_buf, data_len);
-            ctx->mode.gmac.last_block_len = data_len;
+        if (gmac->last_block_len < block_len) {
             goto cleanup;
         }
+        ctx->gmac->blocks(ctx, gmac->B, gmac->last_block, 1);
+        gmac->last_block_len = 0;
     }
-    //Высчитываем остаток
-    tail_len = (block_len - data_len % block_len) % block_len;
 
-    data_len -= tail_len;
-    for (i = 0; i < data_len; i += block_len) {
-        DO(gf2m_mul(ctx->mode.gmac.gf2m_ctx, block_len, B8, H8, B8));
-        if ((i + block_len) < data_len) {
-            kalyna_xor(&data_buf[i], B8, block_len, B8);
-        }
+    n = data_len / block_len;
+    if (n > 0) {
+        ctx->gmac->blocks(ctx, gmac->B, data_buf, n);
+        data_buf += n * block_len;
+        data_len -= n * block_len;
     }
 
-    if (tail_len != 0) {
-        memcpy(last_block, &data_buf[i], tail_len);
-        ctx->mode.gmac.last_block_len = tail_len;
+    if (data_len > 0) {
+        memcpy(gmac->last_block, data_buf, data_len);
+        gmac->last_block_len = data_len;
     }
 
-    DO(uint8_to_uint64(B8, block_len, B, block_len >> 3));
+cleanup:
+
+    return ret;
+}
+
+/* Імітовставка GMAC: E(S ^ L), L - довжина доповнених даних у бітах. */
+static int gmac_tag(Dstu7624Ctx *ctx, const uint8_t *s, size_t data_len, ByteArray **mac)
+{
+    uint64_t block[8];
+    uint8_t tag[MAX_BLOCK_LEN];
+    size_t block_len = ctx->block_len;
+    int ret = RET_OK;
+
+    DO(uint8_to_uint64(s, block_len, block, block_len >> 3));
+    block[0] ^= (uint64_t)data_len << 3;
+    ctx->basic_transform(ctx, block);
+    DO(uint64_to_uint8(block, block_len >> 3, tag, block_len));
+
+    CHECK_NOT_NULL(*mac = ba_alloc_from_uint8(tag, ctx->mode.gmac.q));
 
 cleanup:
 
@@ -3522,47 +4088,25 @@ cleanup:
 
 static int gmac_final(Dstu7624Ctx *ctx, ByteArray **mac)
 {
-    uint8_t *last_block = NULL;
-    uint64_t *H;
-    uint64_t *B;
-    uint8_t B8[MAX_BLOCK_LEN];
-    uint8_t H8[MAX_BLOCK_LEN];
-    size_t last_block_len;
-    size_t block_len;
+    Dstu7624GmacCtx *gmac = NULL;
+    size_t padded_len;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(mac != NULL);
 
-    B = ctx->mode.gmac.B;
-    H = ctx->mode.gmac.H;
-    block_len = ctx->block_len;
-    last_block = ctx->mode.gmac.last_block;
-    last_block_len = ctx->mode.gmac.last_block_len;
-
-    DO(uint64_to_uint8(B, block_len >> 3, B8, block_len));
-    DO(uint64_to_uint8(H, block_len >> 3, H8, block_len));
+    gmac = &ctx->mode.gmac;
+    padded_len = gmac->msg_tot_len;
 
     // Проверяем, нужно ли достчитывать последний блок.
-    if (last_block_len != 0) {
+    if (gmac->last_block_len != 0) {
         //Если последний блок не нулевой, дополняем его.
-        padding(ctx, last_block, &last_block_len, last_block);
-
-        kalyna_xor(&last_block, B8, last_block_len, B8);
-        DO(gf2m_mul(ctx->mode.gmac.gf2m_ctx, block_len, B8, H8, B8));
+        padded_len += ctx->block_len - gmac->last_block_len;
+        padding(ctx, gmac->last_block, &gmac->last_block_len, gmac->last_block);
+        ctx->gmac->blocks(ctx, gmac->B, gmac->last_block, 1);
     }
-    memset(H, 0, MAX_BLOCK_LEN);
 
-    //Записываем длинну всего сообщения в битах
-    H[0] = ctx->mode.gmac.msg_tot_len << 3;
-
-    DO(uint64_to_uint8(H, block_len >> 3, H8, block_len));
-    kalyna_xor(H8, B8, block_len, H8);
-    DO(uint8_to_uint64(H8, block_len, H, block_len >> 3));
-    ctx->basic_transform(ctx, H);
-
-    DO(uint64_to_uint8(H, block_len >> 3, H8, block_len));
-    CHECK_NOT_NULL(*mac = ba_alloc_from_uint8(H8, ctx->mode.gmac.q));
+    DO(gmac_tag(ctx, gmac->B, padded_len, mac));
 
 cleanup:
 
@@ -3571,15 +4115,11 @@ cleanup:
 
 static int encrypt_gmac(Dstu7624Ctx *ctx, const ByteArray *plain_data, ByteArray **out)
 {
-    uint8_t *data_buf = NULL;
-    uint64_t H[8];
-    uint8_t H8[64];
-    uint64_t B[8];
-    uint8_t B8[64];
+    uint8_t B[MAX_BLOCK_LEN] = {0};
+    uint8_t last_block[MAX_BLOCK_LEN];
     size_t data_len;
-    size_t i;
+    size_t tail_len;
     size_t block_len;
-    size_t block_len_word;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -3587,37 +4127,23 @@ static int encrypt_gmac(Dstu7624Ctx *ctx, const ByteArray *plain_data, ByteArray
     CHECK_PARAM(out != NULL);
 
     block_len = ctx->block_len;
-    block_len_word = block_len >> 3;
-    memset(H, 0, 64);
-    memset(B, 0, 64);
-    memset(H8, 0, 64);
-    memset(B8, 0, 64);
     data_len = ba_get_len(plain_data);
-    MALLOC_CHECKED(data_buf, data_len + block_len);
-    DO(ba_to_uint8(plain_data, data_buf, data_len));
+    tail_len = data_len % block_len;
 
-    padding(ctx, data_buf, &data_len, data_buf);
-    ctx->basic_transform(ctx, H);
-    DO(uint64_to_uint8(H, block_len_word, H8, block_len));
-    for (i = 0; i < data_len; i += block_len) {
-        kalyna_xor(&data_buf[i], B, block_len, B);
-        DO(gf2m_mul(ctx->mode.gmac.gf2m_ctx, block_len, (uint8_t *) B, H8, (uint8_t *) B));
+    if (data_len >= block_len) {
+        ctx->gmac->blocks(ctx, B, plain_data->buf, data_len / block_len);
+    }
+    if (tail_len != 0) {
+        memcpy(last_block, &plain_data->buf[data_len - tail_len], tail_len);
+        padding(ctx, last_block, &tail_len, last_block);
+        ctx->gmac->blocks(ctx, B, last_block, 1);
+        data_len += block_len - data_len % block_len;
     }
 
-    memset(H, 0, 64);
-
-    H[0] = data_len << 3;
-    DO(uint64_to_uint8(B, block_len_word, B8, block_len));
-    kalyna_xor(H, B8, block_len, H);
-    ctx->basic_transform(ctx, H);
-    DO(uint64_to_uint8(H, block_len_word, H8, block_len));
-
-    CHECK_NOT_NULL(*out = ba_alloc_from_uint8(H8, ctx->mode.gmac.q));
+    DO(gmac_tag(ctx, B, data_len, out));
 
 cleanup:
 
-    free(data_buf);
-
     return ret;
 }
 
@@ -3900,10 +4426,15 @@ static int decrypt_cbc(Dstu7624Ctx *ctx, const ByteArray *in, ByteArray **out)
 
     cipher_data = in->buf;
     data_len = in->len;
+    if (data_len % block_len != 0) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
+    }
+
     MALLOC_CHECKED(plain_data, data_len);
 
+    /* Блоки розшифровуються незалежно, зчеплення - окремим проходом. */
+    ctx->impl->decrypt_blocks(ctx, cipher_data, plain_data, data_len / block_len);
     for (i = 0; i < data_len; i += block_len) {
-        decrypt_basic_transform(ctx, &cipher_data[i], &plain_data[i]);
         kalyna_xor(ctx->mode.cbc.gamma, &plain_data[i], block_len, &plain_data[i]);
         memcpy(ctx->mode.cbc.gamma, &cipher_data[i], ctx->block_len);
     }
@@ -4015,7 +4546,6 @@ cleanup:
 int dstu7624_init_gmac(Dstu7624Ctx *ctx, const ByteArray *key, const size_t block_size, const size_t q)
 {
     int ret = RET_OK;
-    int f[5] = {0};
 
     CHECK_PARAM(ctx != NULL);
     CHECK_PARAM(key != NULL);
@@ -4025,38 +4555,10 @@ int dstu7624_init_gmac(Dstu7624Ctx *ctx, const ByteArray *key, const size_t bloc
     DO(dstu7624_init(ctx, key, block_size));
 
     ctx->mode.gmac.q = q;
+    gmac_set_key(ctx);
 
-    switch (block_size) {
-    case 16:
-        f[0] = 128;
-        f[1] = 7;
-        f[2] = 2;
-        f[3] = 1;
-        f[4] = 0;
-        break;
-    case 32:
-        f[0] = 256;
-        f[1] = 10;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    case 64:
-        f[0] = 512;
-        f[1] = 8;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    default:
-        break;
-    }
-
-    CHECK_NOT_NULL(ctx->mode.gmac.gf2m_ctx = gf2m_alloc(f, 5));
     memset(ctx->mode.gmac.B, 0, MAX_BLOCK_LEN);
     memset(ctx->mode.gmac.last_block, 0, MAX_BLOCK_LEN);
-    memset(ctx->mode.gmac.H, 0, MAX_BLOCK_LEN);
-    ctx->basic_transform(ctx, ctx->mode.gmac.H);
     ctx->mode.gmac.last_block_len = 0;
     ctx->mode.gmac.msg_tot_len = 0;
 
@@ -4088,7 +4590,6 @@ cleanup:
 
 int dstu7624_init_xts(Dstu7624Ctx *ctx, const ByteArray *key, const ByteArray *iv)
 {
-    int f[5] = {0};
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -4098,37 +4599,6 @@ int dstu7624_init_xts(Dstu7624Ctx *ctx, const ByteArray *key, const ByteArray *i
     DO(dstu7624_init(ctx, key, ba_get_len(iv)));
     DO(ba_to_uint8(iv, ctx->mode.xts.iv, ctx->block_len));
 
-    switch (ctx->block_len) {
-    case 16:
-        f[0] = 128;
-        f[1] = 7;
-        f[2] = 2;
-        f[3] = 1;
-        f[4] = 0;
-        break;
-    case 32:
-        f[0] = 256;
-        f[1] = 10;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    case 64:
-        f[0] = 512;
-        f[1] = 8;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    default:
-        break;
-    }
-
-    gf2m_free(ctx->mode.xts.gf2m_ctx);
-    ctx->mode.xts.gf2m_ctx = NULL;
-
-    CHECK_NOT_NULL(ctx->mode.xts.gf2m_ctx = gf2m_alloc(f, 5));
-
     ctx->mode_id = DSTU7624_MODE_XTS;
 
 cleanup:
@@ -4150,10 +4620,7 @@ int dstu7624_init_ccm(Dstu7624Ctx *ctx, const ByteArray *key, const ByteArray *i
 
     CHECK_PARAM(q <= ctx->block_len);
 
-    ctx->mode.ccm.key = key;
-
     DO(ba_to_uint8(iv, ctx->mode.ccm.iv, ctx->block_len));
-    ctx->mode.ccm.iv_tmp = iv;
     ctx->mode.ccm.q = q;
     ctx->mode.ccm.nb = (size_t) (((n_max - 3) >> 3) + 1);
 
@@ -4166,7 +4633,6 @@ cleanup:
 
 int dstu7624_init_gcm(Dstu7624Ctx *ctx, const ByteArray *key, const ByteArray *iv, const size_t q)
 {
-    int f[5] = {0};
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -4179,37 +4645,7 @@ int dstu7624_init_gcm(Dstu7624Ctx *ctx, const ByteArray *key, const ByteArray *i
     DO(ba_to_uint64(iv, ctx->mode.gcm.iv, ctx->block_len >> 3));
 
     ctx->mode.gcm.q = q;
-
-    switch (ctx->block_len) {
-    case 16:
-        f[0] = 128;
-        f[1] = 7;
-        f[2] = 2;
-        f[3] = 1;
-        f[4] = 0;
-        break;
-    case 32:
-        f[0] = 256;
-        f[1] = 10;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    case 64:
-        f[0] = 512;
-        f[1] = 8;
-        f[2] = 5;
-        f[3] = 2;
-        f[4] = 0;
-        break;
-    default:
-        break;
-    }
-
-    gf2m_free(ctx->mode.gcm.gf2m_ctx);
-    ctx->mode.gcm.gf2m_ctx = NULL;
-
-    CHECK_NOT_NULL(ctx->mode.gcm.gf2m_ctx = gf2m_alloc(f, 5));
+    gmac_set_key(ctx);
 
     ctx->mode_id = DSTU7624_MODE_GCM;
 
@@ -4466,9 +4902,113 @@ cleanup:
     return ret;
 }
 
+int dstu7624_encrypt_mac_init(Dstu7624Ctx *ctx, uint64_t auth_data_len, uint64_t data_len)
+{
+    return aead_init(ctx, true, auth_data_len, data_len);
+}
+
+int dstu7624_decrypt_mac_init(Dstu7624Ctx *ctx, uint64_t auth_data_len, uint64_t data_len)
+{
+    return aead_init(ctx, false, auth_data_len, data_len);
+}
+
+int dstu7624_update_auth_data(Dstu7624Ctx *ctx, const ByteArray *auth_data)
+{
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(auth_data != NULL);
+
+    if (ctx->aead.stage != DSTU7624_AEAD_AAD) {
+        SET_ERROR(RET_CONTEXT_NOT_READY);
+    }
+
+    if (auth_data->len > ctx->aead.aad_total - ctx->aead.aad_len) {
+        SET_ERROR(RET_INVALID_DATA_LEN);
+    }
+
+    DO(aead_auth_update(ctx, auth_data->buf, auth_data->len));
+    ctx->aead.aad_len += auth_data->len;
+
+cleanup:
+
+    return ret;
+}
+
+int dstu7624_encrypt_mac_update(Dstu7624Ctx *ctx, const ByteArray *data, ByteArray **encrypted_data)
+{
+    return aead_update(ctx, true, data, encrypted_data);
+}
+
+int dstu7624_decrypt_mac_update(Dstu7624Ctx *ctx, const ByteArray *encrypted_data, ByteArray **data)
+{
+    return aead_update(ctx, false, encrypted_data, data);
+}
+
+int dstu7624_encrypt_mac_final(Dstu7624Ctx *ctx, ByteArray **mac, ByteArray **encrypted_data)
+{
+    uint8_t tag[MAX_BLOCK_LEN];
+    ByteArray *ba_mac = NULL;
+    ByteArray *ba_enc = NULL;
+    size_t q;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(mac != NULL);
+    CHECK_PARAM(encrypted_data != NULL);
+
+    DO(aead_final(ctx, true, tag));
+
+    q = aead_tag_len(ctx);
+    CHECK_NOT_NULL(ba_mac = ba_alloc_from_uint8(tag, q));
+
+    if (ctx->mode_id == DSTU7624_MODE_CCM) {
+        CHECK_NOT_NULL(ba_enc = ba_alloc_by_len(q));
+        aead_crypt(ctx, tag, ba_enc->buf, q);
+    } else {
+        CHECK_NOT_NULL(ba_enc = ba_alloc());
+    }
+
+    *mac = ba_mac;
+    ba_mac = NULL;
+    *encrypted_data = ba_enc;
+    ba_enc = NULL;
+
+cleanup:
+
+    ba_free(ba_mac);
+    ba_free(ba_enc);
+
+    return ret;
+}
+
+int dstu7624_decrypt_mac_final(Dstu7624Ctx *ctx, const ByteArray *mac)
+{
+    uint8_t tag[MAX_BLOCK_LEN];
+    size_t q;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(mac != NULL);
+
+    DO(aead_final(ctx, false, tag));
+
+    q = aead_tag_len(ctx);
+    if ((ba_get_len(mac) < q) || memcmp(tag, ba_get_buf_const(mac), q)) {
+        SET_ERROR(RET_VERIFY_FAILED);
+    }
+
+cleanup:
+
+    return ret;
+}
+
 int dstu7624_encrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_data, const ByteArray *data, ByteArray **mac,
         ByteArray **encrypted_data)
 {
+    ByteArray *ba_mac = NULL;
+    ByteArray *ba_enc = NULL;
+    ByteArray *ba_tail = NULL;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -4477,25 +5017,34 @@ int dstu7624_encrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_data, const Byt
     CHECK_PARAM(mac != NULL);
     CHECK_PARAM(encrypted_data != NULL);
 
-    switch (ctx->mode_id) {
-    case DSTU7624_MODE_GCM:
-        DO(dstu7624_encrypt_gcm(ctx, data, auth_data, mac, encrypted_data));
-        break;
-    case DSTU7624_MODE_CCM:
-        DO(dstu7624_encrypt_ccm(ctx, auth_data, data, mac, encrypted_data));
-        break;
-    default:
-        SET_ERROR(RET_INVALID_CTX_MODE);
+    DO(dstu7624_encrypt_mac_init(ctx, ba_get_len(auth_data), ba_get_len(data)));
+    DO(dstu7624_update_auth_data(ctx, auth_data));
+    DO(dstu7624_encrypt_mac_update(ctx, data, &ba_enc));
+    DO(dstu7624_encrypt_mac_final(ctx, &ba_mac, &ba_tail));
+
+    if (ba_get_len(ba_tail) > 0) {
+        DO(ba_append(ba_tail, 0, 0, ba_enc));
     }
 
+    *mac = ba_mac;
+    ba_mac = NULL;
+    *encrypted_data = ba_enc;
+    ba_enc = NULL;
+
 cleanup:
 
+    ba_free(ba_mac);
+    ba_free(ba_enc);
+    ba_free(ba_tail);
+
     return ret;
 }
 
 int dstu7624_decrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_data, const ByteArray *encrypted_data, ByteArray *mac,
         ByteArray **data)
 {
+    ByteArray *ba_data = NULL;
+    size_t data_len;
     int ret = RET_OK;
 
     CHECK_PARAM(ctx != NULL);
@@ -4504,19 +5053,27 @@ int dstu7624_decrypt_mac(Dstu7624Ctx *ctx, const ByteArray *auth_data, const Byt
     CHECK_PARAM(mac != NULL);
     CHECK_PARAM(data != NULL);
 
-    switch (ctx->mode_id) {
-    case DSTU7624_MODE_GCM:
-        DO(dstu7624_decrypt_gcm(ctx, encrypted_data, mac, auth_data, data));
-        break;
-    case DSTU7624_MODE_CCM:
-        DO(dstu7624_decrypt_ccm(ctx, auth_data, encrypted_data, mac, data));
-        break;
-    default:
-        SET_ERROR(RET_INVALID_CTX_MODE);
+    data_len = ba_get_len(encrypted_data);
+    if (ctx->mode_id == DSTU7624_MODE_CCM) {
+        /* Останні q байт - зашифрована імітовставка. */
+        if (data_len < ctx->mode.ccm.q) {
+            SET_ERROR(RET_INVALID_DATA_LEN);
+        }
+        data_len -= ctx->mode.ccm.q;
     }
 
+    DO(dstu7624_decrypt_mac_init(ctx, ba_get_len(auth_data), data_len));
+    DO(dstu7624_update_auth_data(ctx, auth_data));
+    DO(dstu7624_decrypt_mac_update(ctx, encrypted_data, &ba_data));
+    DO(dstu7624_decrypt_mac_final(ctx, mac));
+
+    *data = ba_data;
+    ba_data = NULL;
+
 cleanup:
 
+    ba_free(ba_data);
+
     return ret;
 }
 
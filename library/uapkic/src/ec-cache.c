@@ -55,36 +55,52 @@ typedef struct EcCache_st {
     struct EcCache_st *next;
 } EcCache;
 
-static EcCache *ec_cache = NULL;
+/* Хеш-таблиця кешу. Елементи після публікації не змінюються, тому читання виконується без блокування,
+ * а додавання - під ec_cache_mutex з атомарною публікацією нового початку ланцюжка. */
+#define EC_CACHE_BUCKETS 64
+
+static EcCache *ec_cache_buckets[EC_CACHE_BUCKETS];
 static pthread_mutex_t ec_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 OptLevelId default_opt_level = 0;
 
-static void ec_cache_append(EcCache *ec_cache_new)
+static size_t ec_cache_hash(EcCacheItemType item_type, const ByteArray *px, const ByteArray *py)
 {
-    if (ec_cache) {
-        EcCache * ec_cache_curr = ec_cache;
-        while (ec_cache_curr->next != NULL) {
-            ec_cache_curr = ec_cache_curr->next;
-        }
-        ec_cache_curr->next = ec_cache_new;
-    } else {
-        ec_cache = ec_cache_new;
+    uint32_t hash = 2166136261u ^ (uint32_t)item_type;
+    const uint8_t *buf;
+    size_t len;
+    size_t i;
+
+    buf = ba_get_buf_const(px);
+    len = ba_get_len(px);
+    for (i = 0; i < len; i++) {
+        hash = (hash ^ buf[i]) * 16777619u;
+    }
+    buf = ba_get_buf_const(py);
+    len = ba_get_len(py);
+    for (i = 0; i < len; i++) {
+        hash = (hash ^ buf[i]) * 16777619u;
     }
+
+    return hash % EC_CACHE_BUCKETS;
+}
+
+static void ec_cache_insert(size_t index, EcCache *ec_cache_new)
+{
+    ec_cache_new->next = ec_cache_buckets[index];
+    ATOMIC_STORE_PTR(&ec_cache_buckets[index], ec_cache_new);
 }
 
 static EcCache *ec_cache_get_element_by_id(EcParamsId params_id)
 {
-    if (ec_cache) {
-        EcCache *ec_cache_curr = ec_cache;
-        while (ec_cache_curr != NULL) {
-            if (ec_cache_curr->item_type == CHACHE_EC_BY_ID &&
-                ec_cache_curr->ctx->params->params_id == params_id) {
-                return ec_cache_curr;
-            } else {
-                ec_cache_curr = ec_cache_curr->next;
-            }
+    EcCache *ec_cache_curr = ATOMIC_LOAD_PTR(&ec_cache_buckets[(size_t)params_id % EC_CACHE_BUCKETS]);
+
+    while (ec_cache_curr != NULL) {
+        if (ec_cache_curr->item_type == CHACHE_EC_BY_ID &&
+            ec_cache_curr->ctx->params->params_id == params_id) {
+            return ec_cache_curr;
         }
+        ec_cache_curr = ec_cache_curr->next;
     }
 
     return NULL;
@@ -101,23 +117,21 @@ static bool compare_f(const int* f1, const int* f2)
 static EcCache *ec_cache_get_element_by_pb(const int *f, size_t a, const ByteArray *b,
         const ByteArray *n, const ByteArray *px, const ByteArray *py)
 {
-    if (ec_cache) {
-        EcCache *ec_cache_curr = ec_cache;
-        while (ec_cache_curr != NULL) {
-            if (ec_cache_curr->item_type == CHACHE_EC_BINARY_PB && 
-                ec_cache_curr->ctx->params->is_onb == false && 
-                ec_cache_curr->ctx->params->ec2m != NULL && 
-                compare_f(ec_cache_curr->ctx->params->ec2m->gf2m->f, f) && 
-                ec_cache_curr->ctx->params->ec2m->a == a && 
-                ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
-                ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
-                ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
-                ba_cmp(ec_cache_curr->ba_py, py) == 0) {
-                return ec_cache_curr;
-            } else {
-                ec_cache_curr = ec_cache_curr->next;
-            }
+    EcCache *ec_cache_curr = ATOMIC_LOAD_PTR(&ec_cache_buckets[ec_cache_hash(CHACHE_EC_BINARY_PB, px, py)]);
+
+    while (ec_cache_curr != NULL) {
+        if (ec_cache_curr->item_type == CHACHE_EC_BINARY_PB && 
+            ec_cache_curr->ctx->params->is_onb == false && 
+            ec_cache_curr->ctx->params->ec2m != NULL && 
+            compare_f(ec_cache_curr->ctx->params->ec2m->gf2m->f, f) && 
+            ec_cache_curr->ctx->params->ec2m->a == a && 
+            ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
+            ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
+            ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
+            ba_cmp(ec_cache_curr->ba_py, py) == 0) {
+            return ec_cache_curr;
         }
+        ec_cache_curr = ec_cache_curr->next;
     }
 
     return NULL;
@@ -126,23 +140,21 @@ static EcCache *ec_cache_get_element_by_pb(const int *f, size_t a, const ByteArr
 static EcCache *ec_cache_get_element_by_onb(size_t m, size_t a, const ByteArray *b, const ByteArray *n,
         const ByteArray *px, const ByteArray *py)
 {
-    if (ec_cache) {
-        EcCache *ec_cache_curr = ec_cache;
-        while (ec_cache_curr != NULL) {
-            if (ec_cache_curr->item_type == CHACHE_EC_BINARY_ONB && 
-                ec_cache_curr->ctx->params->is_onb == true && 
-                ec_cache_curr->ctx->params->m == m && 
-                ec_cache_curr->ctx->params->ec2m != NULL && 
-                ec_cache_curr->ctx->params->ec2m->a == a && 
-                ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
-                ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
-                ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
-                ba_cmp(ec_cache_curr->ba_py, py) == 0) {
-                return ec_cache_curr;
-            } else {
-                ec_cache_curr = ec_cache_curr->next;
-            }
+    EcCache *ec_cache_curr = ATOMIC_LOAD_PTR(&ec_cache_buckets[ec_cache_hash(CHACHE_EC_BINARY_ONB, px, py)]);
+
+    while (ec_cache_curr != NULL) {
+        if (ec_cache_curr->item_type == CHACHE_EC_BINARY_ONB && 
+            ec_cache_curr->ctx->params->is_onb == true && 
+            ec_cache_curr->ctx->params->m == m && 
+            ec_cache_curr->ctx->params->ec2m != NULL && 
+            ec_cache_curr->ctx->params->ec2m->a == a && 
+            ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
+            ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
+            ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
+            ba_cmp(ec_cache_curr->ba_py, py) == 0) {
+            return ec_cache_curr;
         }
+        ec_cache_curr = ec_cache_curr->next;
     }
 
     return NULL;
@@ -151,22 +163,20 @@ static EcCache *ec_cache_get_element_by_onb(size_t m, size_t a, const ByteArray
 static EcCache *ec_cache_get_element_by_p(const ByteArray *p, const ByteArray *a, const ByteArray *b,
         const ByteArray *n, const ByteArray *px, const ByteArray *py)
 {
-    if (ec_cache) {
-        EcCache * ec_cache_curr = ec_cache;
-        while (ec_cache_curr != NULL) {
-            if (ec_cache_curr->item_type == CHACHE_EC_PRIME && 
-                ec_cache_curr->ctx->params->ecp != NULL && 
-                ba_cmp(ec_cache_curr->ba_p, p) == 0 && 
-                ba_cmp(ec_cache_curr->ba_a, a) == 0 && 
-                ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
-                ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
-                ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
-                ba_cmp(ec_cache_curr->ba_py, py) == 0) {
-                return ec_cache_curr;
-            } else {
-                ec_cache_curr = ec_cache_curr->next;
-            }
+    EcCache *ec_cache_curr = ATOMIC_LOAD_PTR(&ec_cache_buckets[ec_cache_hash(CHACHE_EC_PRIME, px, py)]);
+
+    while (ec_cache_curr != NULL) {
+        if (ec_cache_curr->item_type == CHACHE_EC_PRIME && 
+            ec_cache_curr->ctx->params->ecp != NULL && 
+            ba_cmp(ec_cache_curr->ba_p, p) == 0 && 
+            ba_cmp(ec_cache_curr->ba_a, a) == 0 && 
+            ba_cmp(ec_cache_curr->ba_b, b) == 0 && 
+            ba_cmp(ec_cache_curr->ba_n, n) == 0 && 
+            ba_cmp(ec_cache_curr->ba_px, px) == 0 && 
+            ba_cmp(ec_cache_curr->ba_py, py) == 0) {
+            return ec_cache_curr;
         }
+        ec_cache_curr = ec_cache_curr->next;
     }
 
     return NULL;
@@ -193,28 +203,35 @@ int ec_cache_add_default(EcParamsId params_id, OptLevelId opt_level)
     EcCache* ec_cache_curr = NULL;
     EcCache* ec_cache_new = NULL;
 
+    if (ec_cache_get_element_by_id(params_id) != NULL) {
+        SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
+    }
+
+    /* Контекст будується поза блокуванням: ec_alloc_new() сам звертається до кешу за параметрами кривої. */
+    CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
+
+    CHECK_NOT_NULL(ctx = ec_alloc_new(params_id));
+    DO(ec_set_opt_level(ctx, opt_level));
+
+    ec_cache_new->ctx = ctx;
+    ctx = NULL;
+    ec_cache_new->item_type = CHACHE_EC_BY_ID;
+
     pthread_mutex_lock(&ec_cache_mutex);
 
     ec_cache_curr = ec_cache_get_element_by_id(params_id);
     if (ec_cache_curr != NULL) {
+        pthread_mutex_unlock(&ec_cache_mutex);
         SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
-    } else {
-        CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
-
-        CHECK_NOT_NULL(ctx = ec_alloc_new(params_id));
-        DO(ec_set_opt_level(ctx, opt_level));
+    }
 
-        ec_cache_new->ctx = ctx;
-        ctx = NULL;
-        ec_cache_new->item_type = CHACHE_EC_BY_ID;
+    ec_cache_insert((size_t)params_id % EC_CACHE_BUCKETS, ec_cache_new);
+    ec_cache_new = NULL;
 
-        ec_cache_append(ec_cache_new);
-        ec_cache_new = NULL;
-    }
+    pthread_mutex_unlock(&ec_cache_mutex);
 
 cleanup:
 
-    pthread_mutex_unlock(&ec_cache_mutex);
     ec_cache_item_free(ec_cache_new);
     ec_free(ctx);
 
@@ -255,33 +272,39 @@ int ec_cache_add_ec2m_pb(const int *f, size_t f_len, size_t a, const ByteArray *
     EcCache *ec_cache_curr = NULL;
     EcCache *ec_cache_new = NULL;
 
+    if (ec_cache_get_element_by_pb(f, a, b, n, px, py) != NULL) {
+        SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
+    }
+
+    CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
+
+    CHECK_NOT_NULL(ctx = ec_alloc_binary_pb_new(f, f_len, a, b, n, px, py));
+    DO(ec_set_opt_level(ctx, opt_level));
+
+    ec_cache_new->ctx = ctx;
+    ctx = NULL;
+
+    ec_cache_new->item_type = CHACHE_EC_BINARY_PB;
+    CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(n, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+
     pthread_mutex_lock(&ec_cache_mutex);
 
     ec_cache_curr = ec_cache_get_element_by_pb(f, a, b, n, px, py);
     if (ec_cache_curr != NULL) {
+        pthread_mutex_unlock(&ec_cache_mutex);
         SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
-    } else {
-        CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
-
-        CHECK_NOT_NULL(ctx = ec_alloc_binary_pb_new(f, f_len, a, b, n, px, py));
-        DO(ec_set_opt_level(ctx, opt_level));
-
-        ec_cache_new->ctx = ctx;
-        ctx = NULL;
+    }
 
-        ec_cache_new->item_type = CHACHE_EC_BINARY_PB;
-        CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(n, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+    ec_cache_insert(ec_cache_hash(CHACHE_EC_BINARY_PB, px, py), ec_cache_new);
+    ec_cache_new = NULL;
 
-        ec_cache_append(ec_cache_new);
-        ec_cache_new = NULL;
-    }
+    pthread_mutex_unlock(&ec_cache_mutex);
 
 cleanup:
 
-    pthread_mutex_unlock(&ec_cache_mutex);
     ec_cache_item_free(ec_cache_new);
     ec_free(ctx);
 
@@ -300,7 +323,10 @@ EcCtx *ec_cache_get_ec2m_pb(const int *f, size_t f_len, size_t a, const ByteArra
         CHECK_NOT_NULL(ctx = ec_copy_params_with_alloc(ec_cache_curr->ctx));
     } else if (default_opt_level != 0) {
 
-        DO(ec_cache_add_ec2m_pb(f, f_len, a, b, n, px, py, default_opt_level));
+        ret = ec_cache_add_ec2m_pb(f, f_len, a, b, n, px, py, default_opt_level);
+        if (ret != RET_OK && ret != RET_CTX_ALREADY_IN_CACHE) {
+            SET_ERROR(ret);
+        }
 
         ec_cache_curr = ec_cache_get_element_by_pb(f, a, b, n, px, py);
         if (ec_cache_curr != NULL) {
@@ -321,33 +347,39 @@ int ec_cache_add_ec2m_onb(size_t m, size_t a, const ByteArray *b, const ByteArra
     EcCache *ec_cache_curr = NULL;
     EcCache *ec_cache_new = NULL;
 
+    if (ec_cache_get_element_by_onb(m, a, b, n, px, py) != NULL) {
+        SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
+    }
+
+    CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
+
+    CHECK_NOT_NULL(ctx = ec_alloc_binary_onb_new(m, a, b, n, px, py));
+    DO(ec_set_opt_level(ctx, opt_level));
+
+    ec_cache_new->ctx = ctx;
+    ctx = NULL;
+
+    ec_cache_new->item_type = CHACHE_EC_BINARY_ONB;
+    CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(n, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+
     pthread_mutex_lock(&ec_cache_mutex);
 
     ec_cache_curr = ec_cache_get_element_by_onb(m, a, b, n, px, py);
     if (ec_cache_curr != NULL) {
+        pthread_mutex_unlock(&ec_cache_mutex);
         SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
-    } else {
-        CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
-
-        CHECK_NOT_NULL(ctx = ec_alloc_binary_onb_new(m, a, b, n, px, py));
-        DO(ec_set_opt_level(ctx, opt_level));
-
-        ec_cache_new->ctx = ctx;
-        ctx = NULL;
+    }
 
-        ec_cache_new->item_type = CHACHE_EC_BINARY_ONB;
-        CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(n, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+    ec_cache_insert(ec_cache_hash(CHACHE_EC_BINARY_ONB, px, py), ec_cache_new);
+    ec_cache_new = NULL;
 
-        ec_cache_append(ec_cache_new);
-        ec_cache_new = NULL;
-    }
+    pthread_mutex_unlock(&ec_cache_mutex);
 
 cleanup:
 
-    pthread_mutex_unlock(&ec_cache_mutex);
     ec_cache_item_free(ec_cache_new);
     ec_free(ctx);
 
@@ -367,7 +399,10 @@ EcCtx* ec_cache_get_ec2m_onb(size_t m, size_t a, const ByteArray* b, const ByteA
     }
     else if (default_opt_level != 0) {
 
-        DO(ec_cache_add_ec2m_onb(m, a, b, n, px, py, default_opt_level));
+        ret = ec_cache_add_ec2m_onb(m, a, b, n, px, py, default_opt_level);
+        if (ret != RET_OK && ret != RET_CTX_ALREADY_IN_CACHE) {
+            SET_ERROR(ret);
+        }
 
         ec_cache_curr = ec_cache_get_element_by_onb(m, a, b, n, px, py);
         if (ec_cache_curr != NULL) {
@@ -387,35 +422,41 @@ int ec_cache_add_ecp(const ByteArray *p, const ByteArray *a, const ByteArray *b,
     EcCache *ec_cache_curr = NULL;
     EcCache *ec_cache_new = NULL;
 
+    if (ec_cache_get_element_by_p(p, a, b, q, px, py) != NULL) {
+        SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
+    }
+
+    CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
+
+    CHECK_NOT_NULL(ctx = ec_alloc_prime_new(p, a, b, q, px, py));
+    DO(ec_set_opt_level(ctx, opt_level));
+
+    ec_cache_new->ctx = ctx;
+    ctx = NULL;
+
+    ec_cache_new->item_type = CHACHE_EC_PRIME;
+    CHECK_NOT_NULL(ec_cache_new->ba_p = ba_copy_with_alloc(p, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_a = ba_copy_with_alloc(a, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(q, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
+    CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+
     pthread_mutex_lock(&ec_cache_mutex);
 
     ec_cache_curr = ec_cache_get_element_by_p(p, a, b, q, px, py);
     if (ec_cache_curr != NULL) {
+        pthread_mutex_unlock(&ec_cache_mutex);
         SET_ERROR(RET_CTX_ALREADY_IN_CACHE);
-    } else {
-        CALLOC_CHECKED(ec_cache_new, sizeof(EcCache));
-
-        CHECK_NOT_NULL(ctx = ec_alloc_prime_new(p, a, b, q, px, py));
-        DO(ec_set_opt_level(ctx, opt_level));
-
-        ec_cache_new->ctx = ctx;
-        ctx = NULL;
+    }
 
-        ec_cache_new->item_type = CHACHE_EC_PRIME;
-        CHECK_NOT_NULL(ec_cache_new->ba_p = ba_copy_with_alloc(p, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_a = ba_copy_with_alloc(a, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_b = ba_copy_with_alloc(b, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_n = ba_copy_with_alloc(q, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_px = ba_copy_with_alloc(px, 0, 0));
-        CHECK_NOT_NULL(ec_cache_new->ba_py = ba_copy_with_alloc(py, 0, 0));
+    ec_cache_insert(ec_cache_hash(CHACHE_EC_PRIME, px, py), ec_cache_new);
+    ec_cache_new = NULL;
 
-        ec_cache_append(ec_cache_new);
-        ec_cache_new = NULL;
-    }
+    pthread_mutex_unlock(&ec_cache_mutex);
 
 cleanup:
 
-    pthread_mutex_unlock(&ec_cache_mutex);
     ec_cache_item_free(ec_cache_new);
     ec_free(ctx);
 
@@ -434,7 +475,10 @@ EcCtx* ec_cache_get_ecp(const ByteArray* p, const ByteArray* a, const ByteArray*
         CHECK_NOT_NULL(ctx = ec_copy_params_with_alloc(ec_cache_curr->ctx));
     }
     else if (default_opt_level != 0) {
-        DO(ec_cache_add_ecp(p, a, b, q, px, py, default_opt_level));
+        ret = ec_cache_add_ecp(p, a, b, q, px, py, default_opt_level);
+        if (ret != RET_OK && ret != RET_CTX_ALREADY_IN_CACHE) {
+            SET_ERROR(ret);
+        }
 
         ec_cache_curr = ec_cache_get_element_by_p(p, a, b, q, px, py);
         if (ec_cache_curr != NULL) {
@@ -470,6 +514,8 @@ cleanup:
 
 void ec_cache_free(void)
 {
+    size_t i;
+
     pthread_mutex_lock(&ec_cache_mutex);
 
 #if defined(_WIN32)
@@ -478,11 +524,11 @@ void ec_cache_free(void)
     sleep(1);
 #endif
 
-    if (ec_cache) {
-        EcCache* ec_cache_next = ec_cache;
-        ec_cache = NULL;
+    for (i = 0; i < EC_CACHE_BUCKETS; i++) {
+        EcCache* ec_cache_next = ec_cache_buckets[i];
         EcCache* ec_cache_curr;
 
+        ATOMIC_STORE_PTR(&ec_cache_buckets[i], NULL);
         while (ec_cache_next != NULL) {
             ec_cache_curr = ec_cache_next;
             ec_cache_next = ec_cache_curr->next;
@@ -938,37 +938,62 @@ static void decompress_matrix(const WordArray *compress_mulp, uint16_t *mulp)
     }
 }
 
+/**
+ * Циклічний зсув m-бітного вектора на один біт: w_j = v_((j + 1) mod m).
+ *
+ * @param v вектор довжини n слів
+ * @param n кількість слів
+ * @param m довжина вектора у бітах
+ * @param w результат, може збігатися з v
+ */
+static void onb_rotate1(const word_t *v, size_t n, size_t m, word_t *w)
+{
+    word_t low = v[0] & 1;
+    size_t i;
+
+    for (i = 0; i + 1 < n; i++) {
+        w[i] = (v[i] >> 1) | (v[i + 1] << (WORD_BIT_LENGTH - 1));
+    }
+    w[n - 1] = v[n - 1] >> 1;
+    w[(m - 1) >> WORD_BIT_LEN_SHIFT] |= low << ((m - 1) & WORD_BIT_LEN_MASK);
+}
+
 /**
  * Выполняет умножение в поле GF(2^m) в ОНБ.
+ * r_j = sum_i (y_(a_i + j + 1) + y_(b_i + j + 1)) * x_(i + j + 1), індекси за модулем m,
+ * тобто сума по i добутків циклічних зсувів x та y, що обчислюється цілими словами.
  *
  * @param x первый множитель
- * @param y второй множитель
+ * @param y_rot m циклічних зсувів другого множника, зсув s займає слова [s * n, (s + 1) * n)
  * @param mulp матрица для умножения в ОНБ
  * @param m степень расширения поля GF(2^m)
  * @param r массив для x * y
  */
-static void multiply_onb(const WordArray *x, const WordArray *y, const uint16_t *mulp, size_t m, WordArray *r)
+static void multiply_onb(const WordArray *x, const word_t *y_rot, const uint16_t *mulp, size_t m, WordArray *r)
 {
-    size_t i, j;
+    size_t n = r->len;
+    size_t i, k;
+    word_t xr[GF2M_MAX_LEN];
+    const word_t *y1, *y2;
+
+    memcpy(xr, x->buf, n * sizeof(word_t));
     wa_zero(r);
 
-    /* XXX: очень медленная фукнция */
-    for (j = 0; j < m; j++) {
-        word_t bit = 0;
-        for (i = 0; i < m - 1; i++) {
-            word_t t1 = int_get_bit(y, (mulp[2 * i] + j + 1) % m);
-            word_t t2 = int_get_bit(y, (mulp[2 * i + 1] + j + 1) % m);
-            word_t t3 = int_get_bit(x, (i + j + 1) % m);
-            bit ^= (t1 ^ t2) & t3;
+    for (i = 0; i < m - 1; i++) {
+        onb_rotate1(xr, n, m, xr);
+        y1 = y_rot + ((mulp[2 * i] + 1) % m) * n;
+        y2 = y_rot + ((mulp[2 * i + 1] + 1) % m) * n;
+        for (k = 0; k < n; k++) {
+            r->buf[k] ^= (y1[k] ^ y2[k]) & xr[k];
         }
+    }
 
-        bit ^= int_get_bit(y, (mulp[2 * m - 2] + j + 1) % m) & int_get_bit(x, (m - 1 + j + 1) % m);
-        /* XOR j бит у r */
-        r->buf[j >> WORD_BIT_LEN_SHIFT] ^= bit << (j & WORD_BIT_LEN_MASK);
+    y1 = y_rot + ((mulp[2 * m - 2] + 1) % m) * n;
+    for (k = 0; k < n; k++) {
+        r->buf[k] ^= y1[k] & x->buf[k];
     }
 }
 
-
 static int get_defaut_ind_onb(size_t m)
 {
     switch (m) {
@@ -1011,6 +1036,27 @@ const int *get_defaut_f_onb(size_t m)
     return (params_ind_onb >= 0) ? ALL_F_ONB[params_ind_onb] : NULL;
 }
 
+/**
+ * Переставляє біти m-бітного вектора у зворотному порядку.
+ *
+ * @param v вектор
+ * @param m довжина вектора у бітах
+ */
+static void onb_reverse(WordArray *v, size_t m)
+{
+    size_t i, k;
+    int bi, bk;
+
+    for (i = 0, k = m - 1; i < k; i++, k--) {
+        bi = int_get_bit(v, i);
+        bk = int_get_bit(v, k);
+        if (bi != bk) {
+            v->buf[i >> WORD_BIT_LEN_SHIFT] ^= (word_t)1 << (i & WORD_BIT_LEN_MASK);
+            v->buf[k >> WORD_BIT_LEN_SHIFT] ^= (word_t)1 << (k & WORD_BIT_LEN_MASK);
+        }
+    }
+}
+
 /**
  * Инициализирует параметры для ОНБ (полином образующий ПБ,
  * матрицы преобразования ОНБ в ПБ и наоборот).
@@ -1031,6 +1077,7 @@ int init_onb_params(EcParamsCtx *params, size_t m)
     WordArray **to_onb_prec = NULL;
     WordArray *root1 = NULL;
     WordArray *root2 = NULL;
+    word_t *root2_rot = NULL;
 
     params_ind_onb = get_defaut_ind_onb(m);
     CHECK_PARAM(params_ind_onb >= 0);
@@ -1055,13 +1102,24 @@ int init_onb_params(EcParamsCtx *params, size_t m)
     }
 
     /* Инициализация V. */
+    MALLOC_CHECKED(root2_rot, m * words * sizeof(word_t));
+    memcpy(root2_rot, root2->buf, words * sizeof(word_t));
+    for (i = 1; i < m; i++) {
+        onb_rotate1(root2_rot + (i - 1) * words, words, m, root2_rot + i * words);
+    }
+
     CHECK_NOT_NULL(to_onb_prec[0] = wa_alloc(words));
     memset(to_onb_prec[0]->buf, 0xff, words * sizeof(word_t));
     int_truncate(to_onb_prec[0], m);
 
     for (i = 1; i < m; i++) {
         CHECK_NOT_NULL(to_onb_prec[i] = wa_alloc(words));
-        multiply_onb(to_onb_prec[i - 1], root2, mulp, m, to_onb_prec[i]);
+        multiply_onb(to_onb_prec[i - 1], root2_rot, mulp, m, to_onb_prec[i]);
+    }
+
+    /* Рядки V зберігаються у порядку бітів результату pb_to_onb: біт i рядка j дорівнює біту (m - 1 - i) V_j. */
+    for (i = 0; i < m; i++) {
+        onb_reverse(to_onb_prec[i], m);
     }
 
     params->to_pb = to_pb_prec;
@@ -1074,6 +1132,7 @@ cleanup:
     wa_free(compress_mulp);
     wa_free(root1);
     wa_free(root2);
+    free(root2_rot);
     free(mulp);
     if (to_pb_prec) {
         for (i = 0; i < m; i++) {
@@ -1099,24 +1158,26 @@ cleanup:
  */
 int onb_to_pb(const EcParamsCtx *params, WordArray *x)
 {
-    WordArray *r = NULL;
+    size_t j, k, w, n;
+    const WordArray *uj;
+    word_t mask;
     int ret = RET_OK;
-    size_t i, j, k, n;
-    WordArray *uj;
-    word_t xj;
 
     CHECK_PARAM(params != NULL);
     CHECK_PARAM(x != NULL);
 
     n = params->ec2m->len;
-    CHECK_NOT_NULL(r = wa_alloc_with_zero(n));
 
+    WA_STACK(r, GF2M_MAX_LEN, n);
+    wa_zero(r);
+
+    /* r = sum_j x_(m - 1 - j) * U_j, рядки додаються цілими словами під маскою. */
     for (j = 0, k = params->m - 1; j < params->m; j++, k--) {
         uj = params->to_pb[j];
-        xj = int_get_bit(x, k);
+        mask = (word_t)0 - (word_t)int_get_bit(x, k);
 
-        for (i = 0; i < params->m; i++) {
-            r->buf[i >> WORD_BIT_LEN_SHIFT] ^= ((xj << (i & WORD_BIT_LEN_MASK)) & uj->buf[i >> WORD_BIT_LEN_SHIFT]);
+        for (w = 0; w < n; w++) {
+            r->buf[w] ^= uj->buf[w] & mask;
         }
     }
 
@@ -1124,8 +1185,6 @@ int onb_to_pb(const EcParamsCtx *params, WordArray *x)
 
 cleanup:
 
-    wa_free(r);
-
     return ret;
 }
 
@@ -1137,27 +1196,27 @@ cleanup:
  */
 int pb_to_onb(const EcParamsCtx *params, WordArray *x)
 {
-    WordArray *r = NULL;
     size_t n = params->ec2m->len;
-    size_t i, j;
-    size_t m = params->m;
-    size_t k;
+    size_t j, w;
+    const WordArray *vj;
+    word_t mask;
     int ret = RET_OK;
 
-    CHECK_NOT_NULL(r = wa_alloc_with_zero(n));
+    WA_STACK(r, GF2M_MAX_LEN, n);
+    wa_zero(r);
 
-    for (j = 0; j < m; j++) {
-        WordArray *vj = params->to_onb[j];
-        word_t xj = int_get_bit(x, j);
+    /* r = sum_j x_j * V_j, рядки V збережені у порядку бітів результату. */
+    for (j = 0; j < params->m; j++) {
+        vj = params->to_onb[j];
+        mask = (word_t)0 - (word_t)int_get_bit(x, j);
 
-        for (i = 0, k = m - 1; i < m; i++, k--) {
-            r->buf[(i >> WORD_BIT_LEN_SHIFT)] ^= (xj & (vj->buf[(k >> WORD_BIT_LEN_SHIFT)] >> (k & WORD_BIT_LEN_MASK))) <<
-                    (i & WORD_BIT_LEN_MASK);
+        for (w = 0; w < n; w++) {
+            r->buf[w] ^= vj->buf[w] & mask;
         }
     }
+
     wa_copy(r, x);
-cleanup:
-    wa_free(r);
+
     return ret;
 }
 
@@ -37,6 +37,8 @@
 #include "math-ec-point-internal.h"
 #include "math-ec2m-internal.h"
 #include "math-ecp-internal.h"
+#include "ec-nonce-pool-internal.h"
+#include "ec-scratch-internal.h"
 
 #define EC_DEFAULT_WIN_WIDTH 5
 
@@ -55,9 +57,10 @@ struct EcParamsCtx_st {
     bool is_onb;                    /* Чи є формат подання у розширеному полі ОНБ */
     size_t m;                       /* Степінь основного поля (ОНБ) */
     WordArray** to_pb;              /* Матриця перетворення елемента з ОНБ у ПБ */
-    WordArray** to_onb;             /* Матриця перетворення елемента з ПБ у ОНБ */
+    WordArray** to_onb;             /* Матриця перетворення елемента з ПБ у ОНБ, рядки з оберненим порядком бітів */
     EcParamsId params_id;           /* Ідентифікатор стандартних параметрів */
     EcPrecomp* precomp_p;
+    volatile long refcount;         /* Кількість контекстів, що спільно використовують параметри */
 };
 
 struct EcCtx_st {
@@ -67,6 +70,8 @@ struct EcCtx_st {
     EcPrecomp* precomp_q;
     bool sign_status;               /* Готовність контексту для формування підпису */
     bool verify_status;             /* Готовність контексту для перевірки підпису */
+    EcNoncePool* nonce_pool;        /* Пул попередньо обчислених пар (k, kP) або NULL */
+    EcScratch* scratch;             /* Арена проміжних значень підпису та перевірки або NULL */
 };
 
 EcCtx* ec_alloc_new(EcParamsId params_id);
@@ -84,6 +89,35 @@ int ec_set_sign_precomp(const EcCtx* ctx, int sign_comb_opt_level, int sign_win_
 
 int ec_set_verify_precomp(EcCtx* ctx, int verify_comb_opt_level, int verify_win_opt_level);
 
+/**
+ * Вибирає одноразове k для підпису: з пулу, якщо він увімкнений і не порожній, інакше випадкове.
+ *
+ * @param ctx контекст ЕК
+ * @param k буфер для k довжини порядку підгрупи
+ * @param kp точка kP з пулу або NULL, якщо її треба обчислити
+ * @return код помилки
+ */
+int ec_sign_nonce(const EcCtx* ctx, WordArray* k, ECPoint** kp);
+
+/**
+ * Записує в c точку C = kP: копію kp, якщо вона є, інакше обчислену з базової точки.
+ *
+ * @param ctx контекст ЕК
+ * @param k одноразове число
+ * @param kp попередньо обчислена точка kP або NULL
+ * @param c точка kP з координатами довжини поля
+ * @return код помилки
+ */
+int ec_sign_nonce_point(const EcCtx* ctx, const WordArray* k, const ECPoint* kp, ECPoint* c);
+
+/**
+ * Створює арену проміжних значень контексту, якщо її ще немає.
+ *
+ * @param ctx контекст ЕК
+ * @return код помилки
+ */
+int ec_init_scratch(EcCtx* ctx);
+
 const int *get_defaut_f_onb(size_t m);
 
 int init_onb_params(EcParamsCtx *params, size_t m);
@@ -108,6 +142,21 @@ int ec2m_decompress_point_core(const EcParamsCtx* params, const ByteArray* x, in
 
 int public_key_to_ec_point(const EcParamsCtx* params, const ByteArray* qx, const ByteArray* qy, ECPoint** q);
 
+/**
+ * Обчислює R_i = m_i * P + n_i * Q_i для пакета відкритих ключів однієї кривої.
+ * Якщо пакетне обчислення не вдалося, кожна точка обчислюється окремо.
+ *
+ * @param ctx контекст ЕК
+ * @param q відкриті ключі Q_i (аффінні точки)
+ * @param m множники для базової точки P
+ * @param n множники для точок Q_i
+ * @param count кількість елементів пакета
+ * @param r аффінні точки R_i
+ * @return код помилки
+ */
+int ec_dual_mul_batch(const EcCtx* ctx, ECPoint* const* q, WordArray* const* m, WordArray* const* n, size_t count,
+    ECPoint** r);
+
 /**
  * Генерує особистий ключ для будь якого алгоритму підпису або Д-Х на ЕК.
  *
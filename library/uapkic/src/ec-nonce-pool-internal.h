@@ -0,0 +1,84 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UAPKIC_EC_NONCE_POOL_INTERNAL_H
+#define UAPKIC_EC_NONCE_POOL_INTERNAL_H
+
+#include "ec.h"
+#include "word-internal.h"
+#include "math-ec-point-internal.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+#define EC_NONCE_POOL_MAX_DEPTH 1024
+
+typedef struct EcNoncePool_st EcNoncePool;
+
+/**
+ * Створює пул пар (k, kP) і запускає фоновий потік, що його поповнює.
+ * Потік доповнює пул до depth, коли кількість пар опускається до low_watermark.
+ *
+ * @param ctx контекст ЕК (параметри спільно використовуються пулом)
+ * @param depth місткість пулу
+ * @param low_watermark поріг, з якого починається поповнення (< depth)
+ * @param pool пул
+ * @return код помилки
+ */
+int ec_nonce_pool_alloc(const EcCtx *ctx, size_t depth, size_t low_watermark, EcNoncePool **pool);
+
+/**
+ * Бере з пулу одноразову пару (k, kP). Пара видаляється з пулу.
+ *
+ * @param pool пул
+ * @param k буфер для k довжини порядку підгрупи
+ * @param kp точка kP (звільняється ec_point_free_private) або NULL, якщо пул порожній
+ * @return код помилки
+ */
+int ec_nonce_pool_take(EcNoncePool *pool, WordArray *k, ECPoint **kp);
+
+/**
+ * Доповнює пул до depth у потоці виклику, не чекаючи фонового потоку.
+ *
+ * @param pool пул
+ * @return код помилки
+ */
+int ec_nonce_pool_fill(EcNoncePool *pool);
+
+/**
+ * Зупиняє фоновий потік, затирає і звільняє всі пари пулу.
+ *
+ * @param pool пул
+ */
+void ec_nonce_pool_free(EcNoncePool *pool);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,305 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define FILE_MARKER "uapkic/ec-nonce-pool.c"
+
+#include <string.h>
+
+#include "ec-nonce-pool-internal.h"
+#include "ec-internal.h"
+#include "math-int-internal.h"
+#include "pthread-internal.h"
+#include "macros-internal.h"
+
+#ifdef _WIN32
+/* Період перевірки потреби у поповненні, мс (у реалізації pthread для Windows немає умовних змінних). */
+#define EC_NONCE_POOL_IDLE_MS 5
+#endif
+
+struct EcNoncePool_st {
+    EcCtx *ec;                      /* Контекст зі спільними параметрами кривої, без ключів */
+    WordArray **k;                  /* Кільцевий буфер одноразових k */
+    ECPoint **kp;                   /* Відповідні точки kP */
+    size_t depth;
+    size_t low_watermark;
+    size_t head;                    /* Індекс найстарішої пари */
+    size_t count;
+    bool refill;                    /* Пул поповнюється до depth */
+    volatile long stop;
+    pthread_mutex_t mutex;
+#ifndef _WIN32
+    pthread_cond_t cond;            /* Сигнал потоку поповнення: потрібне поповнення або зупинка */
+    bool cond_init;
+#endif
+    pthread_t thread;
+    bool thread_started;
+};
+
+static int ec_nonce_pool_calc(const EcCtx *ec, WordArray **k_out, ECPoint **kp_out)
+{
+    const EcParamsCtx *params = ec->params;
+    WordArray *k = NULL;
+    ECPoint *kp = NULL;
+    int ret = RET_OK;
+
+    CHECK_NOT_NULL(k = wa_alloc(params->n->len));
+    DO(int_rand(params->n, k));
+
+    if (params->ec_field == EC_FIELD_PRIME) {
+        CHECK_NOT_NULL(kp = ec_point_alloc(params->ecp->len));
+        DO(ecp_dual_mul_opt(params->ecp, params->precomp_p, k, NULL, NULL, kp));
+    } else {
+        CHECK_NOT_NULL(kp = ec_point_alloc(params->ec2m->len));
+        DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, k, NULL, NULL, kp));
+    }
+
+    *k_out = k;
+    *kp_out = kp;
+    k = NULL;
+    kp = NULL;
+
+cleanup:
+
+    wa_free_private(k);
+    ec_point_free_private(kp);
+
+    return ret;
+}
+
+/**
+ * Очікує, поки пул потребуватиме поповнення.
+ *
+ * @return false, якщо потік треба зупинити
+ */
+static bool ec_nonce_pool_wait(EcNoncePool *pool)
+{
+    bool need = false;
+
+    pthread_mutex_lock(&pool->mutex);
+#ifdef _WIN32
+    while (!ATOMIC_LOAD_LONG(&pool->stop) && !(pool->refill && pool->count < pool->depth)) {
+        pthread_mutex_unlock(&pool->mutex);
+        pthread_sleep_ms(EC_NONCE_POOL_IDLE_MS);
+        pthread_mutex_lock(&pool->mutex);
+    }
+#else
+    while (!ATOMIC_LOAD_LONG(&pool->stop) && !(pool->refill && pool->count < pool->depth)) {
+        pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+#endif
+    need = !ATOMIC_LOAD_LONG(&pool->stop);
+    pthread_mutex_unlock(&pool->mutex);
+
+    return need;
+}
+
+static void *ec_nonce_pool_thread(void *arg)
+{
+    EcNoncePool *pool = (EcNoncePool *)arg;
+    WordArray *k = NULL;
+    ECPoint *kp = NULL;
+    size_t tail;
+
+    while (ec_nonce_pool_wait(pool)) {
+        //  Обчислення kP виконується поза блокуванням
+        if (ec_nonce_pool_calc(pool->ec, &k, &kp) != RET_OK) {
+            break;
+        }
+
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->count < pool->depth) {
+            tail = (pool->head + pool->count) % pool->depth;
+            pool->k[tail] = k;
+            pool->kp[tail] = kp;
+            pool->count++;
+            k = NULL;
+            kp = NULL;
+        }
+        if (pool->count == pool->depth) {
+            pool->refill = false;
+        }
+        pthread_mutex_unlock(&pool->mutex);
+
+        wa_free_private(k);
+        ec_point_free_private(kp);
+        k = NULL;
+        kp = NULL;
+    }
+
+    return NULL;
+}
+
+int ec_nonce_pool_alloc(const EcCtx *ctx, size_t depth, size_t low_watermark, EcNoncePool **pool_out)
+{
+    EcNoncePool *pool = NULL;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(depth > 0 && depth <= EC_NONCE_POOL_MAX_DEPTH);
+    CHECK_PARAM(low_watermark < depth);
+    CHECK_PARAM(pool_out != NULL);
+
+    CALLOC_CHECKED(pool, sizeof(EcNoncePool));
+    pthread_mutex_init(&pool->mutex, NULL);
+#ifndef _WIN32
+    if (pthread_cond_init(&pool->cond, NULL) != 0) {
+        SET_ERROR(RET_INVALID_CTX);
+    }
+    pool->cond_init = true;
+#endif
+    CHECK_NOT_NULL(pool->ec = ec_copy_params_with_alloc(ctx));
+    CALLOC_CHECKED(pool->k, depth * sizeof(WordArray *));
+    CALLOC_CHECKED(pool->kp, depth * sizeof(ECPoint *));
+    pool->depth = depth;
+    pool->low_watermark = low_watermark;
+    pool->refill = true;
+
+    if (pthread_create(&pool->thread, NULL, ec_nonce_pool_thread, pool) != 0) {
+        SET_ERROR(RET_INVALID_CTX);
+    }
+    pool->thread_started = true;
+
+    *pool_out = pool;
+    pool = NULL;
+
+cleanup:
+
+    ec_nonce_pool_free(pool);
+
+    return ret;
+}
+
+int ec_nonce_pool_take(EcNoncePool *pool, WordArray *k, ECPoint **kp)
+{
+    WordArray *wk = NULL;
+    int ret = RET_OK;
+
+    CHECK_PARAM(pool != NULL);
+    CHECK_PARAM(k != NULL);
+    CHECK_PARAM(kp != NULL);
+
+    *kp = NULL;
+
+    pthread_mutex_lock(&pool->mutex);
+    if (pool->count > 0) {
+        wk = pool->k[pool->head];
+        *kp = pool->kp[pool->head];
+        pool->k[pool->head] = NULL;
+        pool->kp[pool->head] = NULL;
+        pool->head = (pool->head + 1) % pool->depth;
+        pool->count--;
+    }
+    if (pool->count <= pool->low_watermark && !pool->refill) {
+        pool->refill = true;
+#ifndef _WIN32
+        pthread_cond_signal(&pool->cond);
+#endif
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    if (wk != NULL) {
+        DO(wa_copy(wk, k));
+    }
+
+cleanup:
+
+    wa_free_private(wk);
+
+    return ret;
+}
+
+int ec_nonce_pool_fill(EcNoncePool *pool)
+{
+    WordArray *k = NULL;
+    ECPoint *kp = NULL;
+    size_t tail;
+    bool full = false;
+    int ret = RET_OK;
+
+    CHECK_PARAM(pool != NULL);
+
+    while (!full) {
+        DO(ec_nonce_pool_calc(pool->ec, &k, &kp));
+
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->count < pool->depth) {
+            tail = (pool->head + pool->count) % pool->depth;
+            pool->k[tail] = k;
+            pool->kp[tail] = kp;
+            pool->count++;
+            k = NULL;
+            kp = NULL;
+        }
+        if (pool->count == pool->depth) {
+            pool->refill = false;
+            full = true;
+        }
+        pthread_mutex_unlock(&pool->mutex);
+
+        wa_free_private(k);
+        ec_point_free_private(kp);
+        k = NULL;
+        kp = NULL;
+    }
+
+cleanup:
+
+    return ret;
+}
+
+void ec_nonce_pool_free(EcNoncePool *pool)
+{
+    size_t i;
+
+    if (pool) {
+        if (pool->thread_started) {
+            pthread_mutex_lock(&pool->mutex);
+            ATOMIC_INC(&pool->stop);
+#ifndef _WIN32
+            pthread_cond_signal(&pool->cond);
+#endif
+            pthread_mutex_unlock(&pool->mutex);
+            pthread_join(pool->thread, NULL);
+        }
+        if (pool->k != NULL) {
+            for (i = 0; i < pool->depth; i++) {
+                wa_free_private(pool->k[i]);
+                ec_point_free_private(pool->kp[i]);
+            }
+        }
+        free(pool->k);
+        free(pool->kp);
+        ec_free(pool->ec);
+#ifndef _WIN32
+        if (pool->cond_init) {
+            pthread_cond_destroy(&pool->cond);
+        }
+#endif
+        pthread_mutex_destroy(&pool->mutex);
+        free(pool);
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UAPKIC_EC_SCRATCH_INTERNAL_H
+#define UAPKIC_EC_SCRATCH_INTERNAL_H
+
+#include "word-internal.h"
+#include "math-ec-point-internal.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/* Кількість слів буфера на одне слово найдовшого з чисел кривої (порядок або елемент поля). */
+#define EC_SCRATCH_WORDS_PER_LEN 16
+/* Кількість заголовків WordArray в арені. */
+#define EC_SCRATCH_MAX_WA 24
+
+typedef struct EcScratch_st EcScratch;
+
+/**
+ * Створює арену для проміжних значень підпису та перевірки підпису.
+ *
+ * @param len довжина найдовшого з чисел кривої у словах
+ * @param scratch арена
+ * @return код помилки
+ */
+int ec_scratch_alloc(size_t len, EcScratch **scratch);
+
+/**
+ * Займає арену для однієї операції. Контекст ЕК може використовуватися з кількох потоків,
+ * тому арена, зайнята іншим потоком, не очікується: повертається NULL, і проміжні значення
+ * виділяються в купі.
+ *
+ * @param scratch арена або NULL
+ * @return зайнята арена або NULL
+ */
+EcScratch *ec_scratch_acquire(EcScratch *scratch);
+
+/**
+ * Затирає використану частину арени і звільняє її для наступної операції.
+ *
+ * @param scratch арена, повернута ec_scratch_acquire, або NULL
+ */
+void ec_scratch_release(EcScratch *scratch);
+
+/**
+ * Виділяє обнулений WordArray з арени або, якщо арена відсутня чи заповнена, з купи.
+ *
+ * @param scratch зайнята арена або NULL
+ * @param len довжина у словах
+ * @return WordArray або NULL
+ */
+WordArray *ec_scratch_wa(EcScratch *scratch, size_t len);
+
+/**
+ * Звільняє WordArray, виділений ec_scratch_wa. Пам'ять арени звільняється в ec_scratch_release.
+ *
+ * @param scratch арена, з якої виділено wa, або NULL
+ * @param wa WordArray або NULL
+ */
+void ec_scratch_wa_free(EcScratch *scratch, WordArray *wa);
+
+/**
+ * Виділяє обнулену точку з арени або з купи.
+ *
+ * @param scratch зайнята арена або NULL
+ * @param len довжина координат у словах
+ * @param point точка (структура розміщується викликачем)
+ * @return код помилки
+ */
+int ec_scratch_point(EcScratch *scratch, size_t len, ECPoint *point);
+
+/**
+ * Звільняє координати точки, виділеної ec_scratch_point.
+ *
+ * @param scratch арена, з якої виділено точку, або NULL
+ * @param point точка
+ */
+void ec_scratch_point_free(EcScratch *scratch, ECPoint *point);
+
+/**
+ * Затирає і звільняє арену.
+ *
+ * @param scratch арена
+ */
+void ec_scratch_free(EcScratch *scratch);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
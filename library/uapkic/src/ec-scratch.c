@@ -0,0 +1,156 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define FILE_MARKER "uapkic/ec-scratch.c"
+
+#include <string.h>
+
+#include "ec-scratch-internal.h"
+#include "pthread-internal.h"
+#include "macros-internal.h"
+#include "byte-utils-internal.h"
+
+struct EcScratch_st {
+    word_t *buf;                            /* Буфер для значень, обнулений поза операцією */
+    size_t buf_len;
+    size_t buf_used;
+    WordArray wa[EC_SCRATCH_MAX_WA];        /* Заголовки виділених значень */
+    size_t wa_used;
+    volatile long busy;                     /* Арену зайнято операцією */
+};
+
+int ec_scratch_alloc(size_t len, EcScratch **scratch)
+{
+    EcScratch *arena = NULL;
+    int ret = RET_OK;
+
+    CHECK_PARAM(len > 0);
+    CHECK_PARAM(scratch != NULL);
+
+    CALLOC_CHECKED(arena, sizeof(EcScratch));
+    arena->buf_len = len * EC_SCRATCH_WORDS_PER_LEN;
+    CALLOC_CHECKED(arena->buf, arena->buf_len * WORD_BYTE_LENGTH);
+
+    *scratch = arena;
+    arena = NULL;
+
+cleanup:
+
+    ec_scratch_free(arena);
+
+    return ret;
+}
+
+EcScratch *ec_scratch_acquire(EcScratch *scratch)
+{
+    if ((scratch == NULL) || (ATOMIC_XCHG_LONG(&scratch->busy, 1) != 0)) {
+        return NULL;
+    }
+
+    return scratch;
+}
+
+void ec_scratch_release(EcScratch *scratch)
+{
+    if (scratch != NULL) {
+        secure_zero(scratch->buf, scratch->buf_used * WORD_BYTE_LENGTH);
+        scratch->buf_used = 0;
+        scratch->wa_used = 0;
+        ATOMIC_XCHG_LONG(&scratch->busy, 0);
+    }
+}
+
+WordArray *ec_scratch_wa(EcScratch *scratch, size_t len)
+{
+    WordArray *wa;
+
+    if ((scratch == NULL) || (scratch->wa_used == EC_SCRATCH_MAX_WA)
+            || (len > scratch->buf_len - scratch->buf_used)) {
+        return wa_alloc_with_zero(len);
+    }
+
+    wa = &scratch->wa[scratch->wa_used++];
+    wa->buf = scratch->buf + scratch->buf_used;
+    wa->len = len;
+    scratch->buf_used += len;
+
+    return wa;
+}
+
+void ec_scratch_wa_free(EcScratch *scratch, WordArray *wa)
+{
+    if ((scratch != NULL) && (wa >= scratch->wa) && (wa < scratch->wa + EC_SCRATCH_MAX_WA)) {
+        return;
+    }
+
+    wa_free_private(wa);
+}
+
+int ec_scratch_point(EcScratch *scratch, size_t len, ECPoint *point)
+{
+    int ret = RET_OK;
+
+    CHECK_PARAM(point != NULL);
+
+    point->x = NULL;
+    point->y = NULL;
+    point->z = NULL;
+    CHECK_NOT_NULL(point->x = ec_scratch_wa(scratch, len));
+    CHECK_NOT_NULL(point->y = ec_scratch_wa(scratch, len));
+    CHECK_NOT_NULL(point->z = ec_scratch_wa(scratch, len));
+
+cleanup:
+
+    if (ret != RET_OK) {
+        ec_scratch_point_free(scratch, point);
+    }
+
+    return ret;
+}
+
+void ec_scratch_point_free(EcScratch *scratch, ECPoint *point)
+{
+    if (point != NULL) {
+        ec_scratch_wa_free(scratch, point->x);
+        ec_scratch_wa_free(scratch, point->y);
+        ec_scratch_wa_free(scratch, point->z);
+        point->x = NULL;
+        point->y = NULL;
+        point->z = NULL;
+    }
+}
+
+void ec_scratch_free(EcScratch *scratch)
+{
+    if (scratch != NULL) {
+        if (scratch->buf != NULL) {
+            secure_zero(scratch->buf, scratch->buf_len * WORD_BYTE_LENGTH);
+            free(scratch->buf);
+        }
+        free(scratch);
+    }
+}
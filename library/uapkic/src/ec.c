@@ -30,6 +30,7 @@
 #include <string.h>
 #include "ec-internal.h"
 #include "ec-cache-internal.h"
+#include "pthread-internal.h"
 #include "math-ecp-internal.h"
 #include "math-ec2m-internal.h"
 #include "math-int-internal.h"
@@ -67,6 +68,18 @@ static void ec_params_free(EcParamsCtx* params)
     }
 }
 
+/**
+ * Звільняє посилання на параметри, сами параметри звільняються разом з останнім посиланням.
+ *
+ * @param params параметри еліптичної кривої
+ */
+static void ec_params_release(EcParamsCtx* params)
+{
+    if (params != NULL && ATOMIC_DEC(&params->refcount) == 0) {
+        ec_params_free(params);
+    }
+}
+
 static EcParamsCtx* ec_params_alloc_prime(const ByteArray* p, const ByteArray* a, const ByteArray* b,
     const ByteArray* q, const ByteArray* px, const ByteArray* py)
 {
@@ -81,6 +94,7 @@ static EcParamsCtx* ec_params_alloc_prime(const ByteArray* p, const ByteArray* a
 
     CALLOC_CHECKED(params, sizeof(EcParamsCtx));
 
+    params->refcount = 1;
     params->ec_field = EC_FIELD_PRIME;
     params->is_onb = false;
 
@@ -187,6 +201,7 @@ static EcParamsCtx* ec_params_alloc_binary(const int* f, size_t f_len, size_t a,
 
     CALLOC_CHECKED(params, sizeof(EcParamsCtx));
 
+    params->refcount = 1;
     params->ec_field = EC_FIELD_BINARY;
     params->is_onb = is_onb;
 
@@ -195,6 +210,7 @@ static EcParamsCtx* ec_params_alloc_binary(const int* f, size_t f_len, size_t a,
 
     CHECK_NOT_NULL(params->n = wa_alloc_from_ba(n));
     wa_change_len(params->n, WA_LEN_FROM_BITS(int_bit_len(params->n)));
+    params->ec2m->order_bits = int_bit_len(params->n);
     params->m = f[0];
 
     if (is_onb) {
@@ -398,14 +414,44 @@ EcCtx* ec_alloc_default(EcParamsId params_id)
 void ec_free(EcCtx* ctx)
 {
     if (ctx) {
+        ec_nonce_pool_free(ctx->nonce_pool);
+        ec_scratch_free(ctx->scratch);
         wa_free_private(ctx->priv_key);
-        ec_params_free(ctx->params);
+        ec_params_release(ctx->params);
         ec_point_free(ctx->pub_key);
         ec_precomp_free(ctx->precomp_q);
         free(ctx);
     }
 }
 
+static int ec_params_make_unique(EcCtx* ctx);
+
+static void ec_resolve_sign_opt_level(int* sign_comb_opt_level, int* sign_win_opt_level)
+{
+    if (*sign_comb_opt_level == 0 && *sign_win_opt_level == 0) {
+        if (default_opt_level != 0) {
+            *sign_comb_opt_level = (default_opt_level >> 12) & 0x0f;
+            *sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
+        }
+        else {
+            *sign_win_opt_level = EC_DEFAULT_WIN_WIDTH;
+        }
+    }
+}
+
+static bool ec_sign_precomp_is_actual(const EcParamsCtx* params, int sign_comb_opt_level, int sign_win_opt_level)
+{
+    if (sign_comb_opt_level > 0) {
+        return params->precomp_p != NULL && params->precomp_p->type == EC_PRECOMP_TYPE_COMB
+            && params->precomp_p->ctx.comb->comb_width == sign_comb_opt_level;
+    }
+    if (sign_win_opt_level > 0) {
+        return params->precomp_p != NULL && params->precomp_p->type == EC_PRECOMP_TYPE_WIN
+            && params->precomp_p->ctx.win->win_width == sign_win_opt_level;
+    }
+    return true;
+}
+
 int ec_set_sign_precomp(const EcCtx* ctx, int sign_comb_opt_level, int sign_win_opt_level)
 {
     EcParamsCtx* params = NULL;
@@ -413,40 +459,39 @@ int ec_set_sign_precomp(const EcCtx* ctx, int sign_comb_opt_level, int sign_win_
 
     params = ctx->params;
 
-    if (sign_comb_opt_level == 0 && sign_win_opt_level == 0) {
-        if (default_opt_level != 0) {
-            sign_comb_opt_level = (default_opt_level >> 12) & 0x0f;
-            sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
-        }
-        else {
-            sign_win_opt_level = EC_DEFAULT_WIN_WIDTH;
+    ec_resolve_sign_opt_level(&sign_comb_opt_level, &sign_win_opt_level);
+
+    if (ec_sign_precomp_is_actual(params, sign_comb_opt_level, sign_win_opt_level)) {
+        return RET_OK;
+    }
+
+    ec_precomp_free(params->precomp_p);
+    params->precomp_p = NULL;
+
+    /* Для стандартних кривих таблиці базової точки вбудовані у бібліотеку. */
+    if (params->params_id != EC_PARAMS_ID_UNDEFINED) {
+        params->precomp_p = (sign_comb_opt_level > 0)
+            ? ec_precomp_alloc_static(params->params_id, EC_PRECOMP_TYPE_COMB, sign_comb_opt_level, params->p->x->len)
+            : ec_precomp_alloc_static(params->params_id, EC_PRECOMP_TYPE_WIN, sign_win_opt_level, params->p->x->len);
+        if (params->precomp_p != NULL) {
+            return RET_OK;
         }
     }
 
     if (sign_comb_opt_level > 0) {
-        if (params->precomp_p == NULL || params->precomp_p->type != EC_PRECOMP_TYPE_COMB
-            || params->precomp_p->ctx.comb->comb_width != sign_comb_opt_level) {
-            ec_precomp_free(params->precomp_p);
-            params->precomp_p = NULL;
-            if (params->ec_field == EC_FIELD_BINARY) {
-                DO(ec2m_calc_comb_precomp(params->ec2m, params->p, sign_comb_opt_level, &params->precomp_p));
-            }
-            else {
-                DO(ecp_calc_comb_precomp(params->ecp, params->p, sign_comb_opt_level, &params->precomp_p));
-            }
+        if (params->ec_field == EC_FIELD_BINARY) {
+            DO(ec2m_calc_comb_precomp(params->ec2m, params->p, sign_comb_opt_level, &params->precomp_p));
+        }
+        else {
+            DO(ecp_calc_comb_precomp(params->ecp, params->p, sign_comb_opt_level, &params->precomp_p));
         }
     }
     else if (sign_win_opt_level > 0) {
-        if (params->precomp_p == NULL || params->precomp_p->type != EC_PRECOMP_TYPE_WIN
-            || params->precomp_p->ctx.win->win_width != sign_win_opt_level) {
-            ec_precomp_free(params->precomp_p);
-            params->precomp_p = NULL;
-            if (params->ec_field == EC_FIELD_BINARY) {
-                DO(ec2m_calc_win_precomp(params->ec2m, params->p, sign_win_opt_level, &params->precomp_p));
-            }
-            else {
-                DO(ecp_calc_win_precomp(params->ecp, params->p, sign_win_opt_level, &params->precomp_p));
-            }
+        if (params->ec_field == EC_FIELD_BINARY) {
+            DO(ec2m_calc_win_precomp(params->ec2m, params->p, sign_win_opt_level, &params->precomp_p));
+        }
+        else {
+            DO(ecp_calc_win_precomp(params->ecp, params->p, sign_win_opt_level, &params->precomp_p));
         }
     }
 
@@ -511,6 +556,7 @@ int ec_set_opt_level(EcCtx* ctx, OptLevelId opt_level)
     int sign_win_opt_level;
     int verify_comb_opt_level;
     int verify_win_opt_level;
+    bool use_ladder;
 
     CHECK_PARAM(ctx != NULL);
 
@@ -528,6 +574,28 @@ int ec_set_opt_level(EcCtx* ctx, OptLevelId opt_level)
     CHECK_PARAM(verify_comb_opt_level == 0 || verify_win_opt_level == 0);
     CHECK_PARAM(verify_win_opt_level == 0 || (verify_win_opt_level & 1) == 1);
 
+    use_ladder = (opt_level & OPT_LEVEL_EC2M_LADDER) != 0;
+
+    /* Рівень без передобчислення для підпису не чіпає спільних параметрів, якщо їх уже підготовлено
+     * і режим драбини не змінюється. */
+    if (sign_comb_opt_level == 0 && sign_win_opt_level == 0 && ctx->params->precomp_p != NULL
+        && (ctx->params->ec_field != EC_FIELD_BINARY || ctx->params->ec2m->use_ladder == use_ladder)) {
+        DO(ec_set_verify_precomp(ctx, verify_comb_opt_level, verify_win_opt_level));
+        goto cleanup;
+    }
+
+    ec_resolve_sign_opt_level(&sign_comb_opt_level, &sign_win_opt_level);
+
+    /* Параметри можуть бути спільними з кешем, тому перед зміною їх треба відокремити. */
+    if (!ec_sign_precomp_is_actual(ctx->params, sign_comb_opt_level, sign_win_opt_level)
+        || (ctx->params->ec_field == EC_FIELD_BINARY && ctx->params->ec2m->use_ladder != use_ladder)) {
+        DO(ec_params_make_unique(ctx));
+    }
+
+    if (ctx->params->ec_field == EC_FIELD_BINARY) {
+        ctx->params->ec2m->use_ladder = use_ladder;
+    }
+
     DO(ec_set_sign_precomp(ctx, sign_comb_opt_level, sign_win_opt_level));
     DO(ec_set_verify_precomp(ctx, verify_comb_opt_level, verify_win_opt_level));
 
@@ -536,48 +604,177 @@ cleanup:
     return ret;
 }
 
-EcCtx* ec_copy_params_with_alloc(const EcCtx* param)
+int ec_set_nonce_pool(EcCtx* ctx, size_t depth, size_t low_watermark)
 {
     int ret = RET_OK;
-    size_t i;
-    EcCtx* param_copy = NULL;
 
-    CHECK_PARAM(param != NULL);
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(depth <= EC_NONCE_POOL_MAX_DEPTH);
+    CHECK_PARAM(depth == 0 || low_watermark < depth);
 
-    CALLOC_CHECKED(param_copy, sizeof(EcCtx));
-    CALLOC_CHECKED(param_copy->params, sizeof(EcParamsCtx));
+    ec_nonce_pool_free(ctx->nonce_pool);
+    ctx->nonce_pool = NULL;
+
+    if (depth > 0) {
+        DO(ec_nonce_pool_alloc(ctx, depth, low_watermark, &ctx->nonce_pool));
+    }
+
+cleanup:
+
+    return ret;
+}
+
+int ec_sign_nonce(const EcCtx* ctx, WordArray* k, ECPoint** kp)
+{
+    int ret = RET_OK;
+
+    *kp = NULL;
+
+    if (ctx->nonce_pool != NULL) {
+        DO(ec_nonce_pool_take(ctx->nonce_pool, k, kp));
+    }
+    if (*kp == NULL) {
+        DO(int_rand(ctx->params->n, k));
+    }
 
-    param_copy->params->ec_field = param->params->ec_field;
-    param_copy->params->params_id = param->params->params_id;
-    param_copy->params->is_onb = param->params->is_onb;
-    param_copy->params->m = param->params->m;
+cleanup:
 
-    if (param->params->ec_field == EC_FIELD_BINARY) {
-        CHECK_NOT_NULL(param_copy->params->ec2m = ec2m_copy_with_alloc(param->params->ec2m));
+    return ret;
+}
+
+int ec_sign_nonce_point(const EcCtx* ctx, const WordArray* k, const ECPoint* kp, ECPoint* c)
+{
+    const EcParamsCtx* params = ctx->params;
+    int ret = RET_OK;
+
+    if (kp != NULL) {
+        ec_point_copy(kp, c);
+    }
+    else if (params->ec_field == EC_FIELD_PRIME) {
+        DO(ecp_dual_mul_opt(params->ecp, params->precomp_p, k, NULL, NULL, c));
+    }
+    else {
+        DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, k, NULL, NULL, c));
+    }
+
+cleanup:
+
+    return ret;
+}
+
+int ec_init_scratch(EcCtx* ctx)
+{
+    size_t len;
+    int ret = RET_OK;
+
+    if (ctx->scratch == NULL) {
+        len = (ctx->params->ec_field == EC_FIELD_PRIME) ? ctx->params->ecp->len : ctx->params->ec2m->len;
+        if (len < ctx->params->n->len) {
+            len = ctx->params->n->len;
+        }
+        DO(ec_scratch_alloc(len, &ctx->scratch));
+    }
 
-        if (param->params->to_onb) {
-            MALLOC_CHECKED(param_copy->params->to_onb, param->params->m * sizeof(WordArray*));
-            for (i = 0; i < param->params->m; i++) {
-                param_copy->params->to_onb[i] = wa_copy_with_alloc(param->params->to_onb[i]);
+cleanup:
+
+    return ret;
+}
+
+/**
+ * Створює незалежну копію параметрів еліптичної кривої.
+ *
+ * @param params параметри еліптичної кривої
+ * @return копія параметрів або NULL
+ */
+static EcParamsCtx* ec_params_copy_with_alloc(const EcParamsCtx* params)
+{
+    int ret = RET_OK;
+    size_t i;
+    EcParamsCtx* params_copy = NULL;
+
+    CALLOC_CHECKED(params_copy, sizeof(EcParamsCtx));
+
+    params_copy->refcount = 1;
+    params_copy->ec_field = params->ec_field;
+    params_copy->params_id = params->params_id;
+    params_copy->is_onb = params->is_onb;
+    params_copy->m = params->m;
+
+    if (params->ec_field == EC_FIELD_BINARY) {
+        CHECK_NOT_NULL(params_copy->ec2m = ec2m_copy_with_alloc(params->ec2m));
+
+        if (params->to_onb) {
+            MALLOC_CHECKED(params_copy->to_onb, params->m * sizeof(WordArray*));
+            for (i = 0; i < params->m; i++) {
+                params_copy->to_onb[i] = wa_copy_with_alloc(params->to_onb[i]);
             }
         }
 
-        if (param->params->to_pb) {
-            MALLOC_CHECKED(param_copy->params->to_pb, param->params->m * sizeof(WordArray*));
-            for (i = 0; i < param->params->m; i++) {
-                param_copy->params->to_pb[i] = wa_copy_with_alloc(param->params->to_pb[i]);
+        if (params->to_pb) {
+            MALLOC_CHECKED(params_copy->to_pb, params->m * sizeof(WordArray*));
+            for (i = 0; i < params->m; i++) {
+                params_copy->to_pb[i] = wa_copy_with_alloc(params->to_pb[i]);
             }
         }
     }
     else {
-        CHECK_NOT_NULL(param_copy->params->ecp = ecp_copy_with_alloc(param->params->ecp));
+        CHECK_NOT_NULL(params_copy->ecp = ecp_copy_with_alloc(params->ecp));
+    }
+    CHECK_NOT_NULL(params_copy->p = ec_point_copy_with_alloc(params->p));
+    CHECK_NOT_NULL(params_copy->n = wa_copy_with_alloc(params->n));
+    if (params->precomp_p) {
+        CHECK_NOT_NULL(params_copy->precomp_p = ec_copy_precomp_with_alloc(params->precomp_p));
+    }
+
+    return params_copy;
+
+cleanup:
+
+    ec_params_free(params_copy);
+
+    return NULL;
+}
+
+/**
+ * Робить параметри контексту власними перед їх зміною,
+ * якщо вони спільні з іншими контекстами (копіювання при записі).
+ *
+ * @param ctx контекст ЕК
+ * @return код помилки
+ */
+static int ec_params_make_unique(EcCtx* ctx)
+{
+    EcParamsCtx* params_copy = NULL;
+    int ret = RET_OK;
+
+    if (ATOMIC_LOAD_LONG(&ctx->params->refcount) > 1) {
+        CHECK_NOT_NULL(params_copy = ec_params_copy_with_alloc(ctx->params));
+        ec_params_release(ctx->params);
+        ctx->params = params_copy;
     }
-    CHECK_NOT_NULL(param_copy->params->p = ec_point_copy_with_alloc(param->params->p));
-    CHECK_NOT_NULL(param_copy->params->n = wa_copy_with_alloc(param->params->n));
-    if (param->params->precomp_p) {
-        CHECK_NOT_NULL(param_copy->params->precomp_p = ec_copy_precomp_with_alloc(param->params->precomp_p));
+
+cleanup:
+
+    return ret;
+}
+
+EcCtx* ec_copy_params_with_alloc(const EcCtx* param)
+{
+    int ret = RET_OK;
+    EcCtx* param_copy = NULL;
+
+    CHECK_PARAM(param != NULL);
+
+    if (param->params->precomp_p == NULL) {
+        DO(ec_set_sign_precomp(param, 0, 0));
     }
 
+    CALLOC_CHECKED(param_copy, sizeof(EcCtx));
+
+    /* Параметри незмінні і використовуються спільно, копія створюється лише при їх зміні. */
+    ATOMIC_INC(&param->params->refcount);
+    param_copy->params = param->params;
+
     if (param->precomp_q != NULL) {
         int verify_comb_opt_level = (param->precomp_q->type == EC_PRECOMP_TYPE_COMB) ? param->precomp_q->ctx.comb->comb_width : 0;
         int verify_win_opt_level = (param->precomp_q->type == EC_PRECOMP_TYPE_WIN) ? param->precomp_q->ctx.win->win_width : 0;
@@ -618,6 +815,9 @@ EcCtx* ec_copy_with_alloc(const EcCtx* param)
 
     param_copy->sign_status = param->sign_status;
     param_copy->verify_status = param->verify_status;
+    if (param_copy->sign_status || param_copy->verify_status) {
+        DO(ec_init_scratch(param_copy));
+    }
 
     ba_free_private(seed);
 
@@ -1006,6 +1206,7 @@ int ec_init_sign(EcCtx* ctx, const ByteArray* d)
         ec_set_sign_precomp(ctx, 0, sign_win_opt_level);
     }
 
+    DO(ec_init_scratch(ctx));
     ctx->sign_status = true;
 
 cleanup:
@@ -1084,6 +1285,7 @@ int ec_init_verify(EcCtx* ctx, const ByteArray* qx, const ByteArray* qy)
         DO(ec_set_verify_precomp(ctx, verify_comb_opt_level, verify_win_opt_level));
     }
 
+    DO(ec_init_scratch(ctx));
     ctx->verify_status = true;
 
 cleanup:
@@ -1096,6 +1298,68 @@ cleanup:
     return ret;
 }
 
+int ec_dual_mul_batch(const EcCtx* ctx, ECPoint* const* q, WordArray* const* m, WordArray* const* n, size_t count,
+    ECPoint** r)
+{
+    EcParamsCtx* params = NULL;
+    EcPrecomp* precomp_q = NULL;
+    int win_width;
+    size_t i;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(q != NULL);
+    CHECK_PARAM(m != NULL);
+    CHECK_PARAM(n != NULL);
+    CHECK_PARAM(r != NULL);
+
+    params = ctx->params;
+
+    if (params->precomp_p == NULL) {
+        int win_opt_level = (default_opt_level >> 8) & 0x0f;
+        if (win_opt_level == 0) {
+            win_opt_level = EC_DEFAULT_WIN_WIDTH;
+        }
+
+        DO(ec_set_sign_precomp(ctx, 0, win_opt_level));
+    }
+
+    win_width = default_opt_level & 0x0f;
+    if (win_width == 0) {
+        win_width = EC_DEFAULT_WIN_WIDTH;
+    }
+
+    if (params->ec_field == EC_FIELD_PRIME) {
+        ret = ecp_dual_mul_batch(params->ecp, params->precomp_p, m, q, n, count, win_width, r);
+    }
+    else {
+        ret = ec2m_dual_mul_batch(params->ec2m, params->precomp_p, m, q, n, count, win_width, r);
+    }
+
+    if (ret != RET_OK) {
+        /* Пакетне обчислення не вдалося, кожна точка обчислюється окремо. */
+        ret = RET_OK;
+        for (i = 0; i < count; i++) {
+            if (params->ec_field == EC_FIELD_PRIME) {
+                DO(ecp_calc_win_precomp(params->ecp, q[i], win_width, &precomp_q));
+                DO(ecp_dual_mul_opt(params->ecp, params->precomp_p, m[i], precomp_q, n[i], r[i]));
+            }
+            else {
+                DO(ec2m_calc_win_precomp(params->ec2m, q[i], win_width, &precomp_q));
+                DO(ec2m_dual_mul_opt(params->ec2m, params->precomp_p, m[i], precomp_q, n[i], r[i]));
+            }
+            ec_precomp_free(precomp_q);
+            precomp_q = NULL;
+        }
+    }
+
+cleanup:
+
+    ec_precomp_free(precomp_q);
+
+    return ret;
+}
+
 /**
  * Возвращает кофактор.
  *
@@ -1245,6 +1509,25 @@ int ec_dh_self_test(void)
         SET_ERROR(RET_SELF_TEST_FAIL);
     }
 
+    /* Сходи Монтгомері дають той самий спільний секрет, а рівень лише для перевірки підпису їх вимикає. */
+    DO(ec_set_opt_level(ctx, (OptLevelId)(OPT_LEVEL_EC2M_LADDER | OPT_LEVEL_VERIFY_COMB_5)));
+    if (!ctx->params->ec2m->use_ladder) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+
+    ba_free(zx); zx = NULL;
+    ba_free(zy); zy = NULL;
+    DO(ec_dh(ctx, true, d, qx, qy, &zx, &zy));
+
+    if (ba_cmp(zx, expected) != 0) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+
+    DO(ec_set_opt_level(ctx, OPT_LEVEL_VERIFY_COMB_5));
+    if (ctx->params->ec2m->use_ladder) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+
     ec_free(ctx); ctx = NULL;
     ba_free(d); d = NULL;
     ba_free(qx); qx = NULL;
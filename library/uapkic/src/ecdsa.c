@@ -94,7 +94,8 @@ cleanup:
     return ret;
 }
 
-static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* k, ByteArray** r, ByteArray** s)
+static int ecdsa_sign_internal(const EcCtx* ctx, EcScratch* scratch, const ByteArray* H, const WordArray* k,
+        const ECPoint* kp, ByteArray** r, ByteArray** s)
 {
     WordArray* tmp = NULL;
     WordArray* t = NULL;
@@ -103,10 +104,10 @@ static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordA
     WordArray* ws = NULL;
     ByteArray* br = NULL;
     ByteArray* bs = NULL;
-    ECPoint* C = NULL;
+    ECPoint C = { NULL, NULL, NULL };
     const WordArray* q;
     int ret = RET_OK;
-    size_t q_bit_len, q_byte_len, used_hash_len;
+    size_t q_bit_len, q_byte_len, used_hash_len, point_len;
 
     q = ctx->params->n;
     q_bit_len = int_bit_len(q);
@@ -116,8 +117,8 @@ static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordA
         used_hash_len = q_byte_len;
     }
 
-    CHECK_NOT_NULL(e = wa_alloc_from_be(H->buf, used_hash_len));
-    wa_change_len(e, q->len);
+    CHECK_NOT_NULL(e = ec_scratch_wa(scratch, q->len));
+    wa_from_be(H->buf, used_hash_len, e);
 
     if (used_hash_len * 8 > q_bit_len) {
         size_t rshift = used_hash_len * 8 - q_bit_len;
@@ -130,18 +131,13 @@ static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordA
 
     /* Шаг 3. Обчислити точку ЕК C = kP,
      * c = (cx, cy) та визначити r = cx (mod q). */
-    if (ctx->params->ec_field == EC_FIELD_PRIME) {
-        CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-        DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, k, NULL, NULL, C));
-    }
-    else {
-        CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ec2m->len));
-        DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, k, NULL, NULL, C));
-    }
+    point_len = (ctx->params->ec_field == EC_FIELD_PRIME) ? ctx->params->ecp->len : ctx->params->ec2m->len;
+    DO(ec_scratch_point(scratch, point_len, &C));
+    DO(ec_sign_nonce_point(ctx, k, kp, &C));
 
-    CHECK_NOT_NULL(tmp = wa_alloc(q->len * 2));
-    CHECK_NOT_NULL(wr = wa_alloc(q->len));
-    wa_copy(C->x, tmp);
+    CHECK_NOT_NULL(tmp = ec_scratch_wa(scratch, q->len * 2));
+    CHECK_NOT_NULL(wr = ec_scratch_wa(scratch, q->len));
+    wa_copy(C.x, tmp);
     int_div(tmp, q, NULL, wr);
 
     /* Якщо r = 0, то повернутися до Шагу 2. */
@@ -152,9 +148,10 @@ static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordA
 
     /* t = k^(-1)(mod q);
      * s = t * (rd + e)(mod q). */
-    CHECK_NOT_NULL(t = gfp_mod_inv_core(k, q));
+    CHECK_NOT_NULL(t = ec_scratch_wa(scratch, q->len));
+    DO(gfp_mod_inv_core(k, q, t));
     int_mul(wr, ctx->priv_key, tmp);
-    CHECK_NOT_NULL(ws = wa_alloc(q->len));
+    CHECK_NOT_NULL(ws = ec_scratch_wa(scratch, q->len));
     int_div(tmp, q, NULL, ws);
     if ((int_add(ws, e, ws) > 0) || (int_cmp(ws, q) >= 0)) {
         int_sub(ws, q, ws);
@@ -184,21 +181,23 @@ static int ecdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordA
 
 cleanup:
 
-    wa_free_private(tmp);
-    wa_free_private(t);
-    wa_free(wr);
-    wa_free(ws);
-    wa_free(e);
+    ec_scratch_wa_free(scratch, tmp);
+    ec_scratch_wa_free(scratch, t);
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_wa_free(scratch, ws);
+    ec_scratch_wa_free(scratch, e);
     ba_free(br);
     ba_free(bs);
-    ec_point_free(C);
+    ec_scratch_point_free(scratch, &C);
 
     return ret;
 }
 
 int ecdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray** s)
 {
+    EcScratch* scratch = NULL;
     WordArray* k = NULL;
+    ECPoint* kp = NULL;
     const WordArray* q;
     int ret = RET_OK;
 
@@ -212,23 +211,42 @@ int ecdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray**
     }
 
     q = ctx->params->n;
+    scratch = ec_scratch_acquire(ctx->scratch);
 
-    CHECK_NOT_NULL(k = wa_alloc(q->len));
+    CHECK_NOT_NULL(k = ec_scratch_wa(scratch, q->len));
 
     do {
         /* Шаг 2. Згенерувати випадкове число k (0 < k < q). */
-        DO(int_rand(q, k));
-        ret = ecdsa_sign_internal(ctx, H, k, r, s);
+        DO(ec_sign_nonce(ctx, k, &kp));
+        ret = ecdsa_sign_internal(ctx, scratch, H, k, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
-    wa_free_private(k);
+    ec_scratch_wa_free(scratch, k);
+    ec_point_free_private(kp);
+    ec_scratch_release(scratch);
 
     return ret;
 }
 
-int ecdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const ByteArray *s)
+/**
+ * Перевіряє діапазон r, s і обчислює z1 = s^(-1) * e (mod n), z2 = s^(-1) * r (mod n).
+ *
+ * @param params параметри еліптичної кривої
+ * @param scratch арена для проміжних і вихідних значень або NULL
+ * @param H геш
+ * @param r частина підпису
+ * @param s частина підпису
+ * @param wr_out r у вигляді числа
+ * @param z1_out множник для точки P
+ * @param z2_out множник для точки Q
+ * @return код помилки або RET_VERIFY_FAILED, якщо r або s поза діапазоном
+ */
+static int ecdsa_verify_prepare(const EcParamsCtx *params, EcScratch *scratch, const ByteArray *H,
+        const ByteArray *r, const ByteArray *s, WordArray **wr_out, WordArray **z1_out, WordArray **z2_out)
 {
     WordArray *e = NULL;
     WordArray *z1 = NULL;
@@ -236,33 +254,23 @@ int ecdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const
     WordArray *wr = NULL;
     WordArray *ws = NULL;
     WordArray *s_inv = NULL;
-    WordArray *r_act = NULL;
-    WordArray* t = NULL;
     WordArray* tmp = NULL;
-    ECPoint *C = NULL;
     const WordArray *q;
     int ret = RET_OK;
     size_t q_bit_len, q_byte_len, used_hash_len;
 
-    CHECK_PARAM(ctx != NULL);
-    CHECK_PARAM(H != NULL);
-    CHECK_PARAM(r != NULL);
-    CHECK_PARAM(s != NULL);
+    q = params->n;
 
-    if (ctx->verify_status == 0) {
-        SET_ERROR(RET_INVALID_CTX_MODE);
-    }
+    CHECK_PARAM(r->len != 0);
+    CHECK_PARAM(s->len != 0);
 
-    q = ctx->params->n;
-
-    CHECK_NOT_NULL(wr = wa_alloc_from_be(r->buf, r->len));
-    CHECK_NOT_NULL(ws = wa_alloc_from_be(s->buf, s->len));
-
-    wa_change_len(wr, q->len);
-    wa_change_len(ws, q->len);
+    CHECK_NOT_NULL(wr = ec_scratch_wa(scratch, q->len));
+    CHECK_NOT_NULL(ws = ec_scratch_wa(scratch, q->len));
+    wa_from_be(r->buf, r->len, wr);
+    wa_from_be(s->buf, s->len, ws);
 
     /* 0 < r < n та 0 < s < n, інакше підпис неправильний. */
-    if ((int_cmp(wr, ctx->params->n) >= 0) || (int_cmp(ws, ctx->params->n) >= 0)
+    if ((int_cmp(wr, params->n) >= 0) || (int_cmp(ws, params->n) >= 0)
             || int_is_zero(wr) || int_is_zero(ws)) {
         SET_ERROR(RET_VERIFY_FAILED);
     }
@@ -274,8 +282,9 @@ int ecdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const
         used_hash_len = q_byte_len;
     }
 
-    CHECK_NOT_NULL(e = wa_alloc_from_be(H->buf, used_hash_len));
-    wa_change_len(e, q->len);
+    CHECK_PARAM(used_hash_len != 0);
+    CHECK_NOT_NULL(e = ec_scratch_wa(scratch, q->len));
+    wa_from_be(H->buf, used_hash_len, e);
 
     if (used_hash_len * 8 > q_bit_len) {
         size_t rshift = used_hash_len * 8 - q_bit_len;
@@ -287,51 +296,282 @@ int ecdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const
     }
 
     /* Шаг 3. s = s^(-1)(mod q). */
-    CHECK_NOT_NULL(s_inv = gfp_mod_inv_core(ws, q));
+    CHECK_NOT_NULL(s_inv = ec_scratch_wa(scratch, q->len));
+    DO(gfp_mod_inv_core(ws, q, s_inv));
 
     /* Шаг 4. z1 = s*e(mod q), z2 = s*r(mod q). */
-    CHECK_NOT_NULL(z1 = wa_alloc(q->len));
-    CHECK_NOT_NULL(z2 = wa_alloc(q->len));
-    CHECK_NOT_NULL(tmp = wa_alloc(q->len * 2));
+    CHECK_NOT_NULL(z1 = ec_scratch_wa(scratch, q->len));
+    CHECK_NOT_NULL(z2 = ec_scratch_wa(scratch, q->len));
+    CHECK_NOT_NULL(tmp = ec_scratch_wa(scratch, q->len * 2));
 
     int_mul(s_inv, e, tmp);
     int_div(tmp, q, NULL, z1);
     int_mul(s_inv, wr, tmp);
     int_div(tmp, q, NULL, z2);
 
+    *wr_out = wr;
+    *z1_out = z1;
+    *z2_out = z2;
+    wr = NULL;
+    z1 = NULL;
+    z2 = NULL;
+
+cleanup:
+
+    ec_scratch_wa_free(scratch, tmp);
+    ec_scratch_wa_free(scratch, e);
+    ec_scratch_wa_free(scratch, z1);
+    ec_scratch_wa_free(scratch, z2);
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_wa_free(scratch, ws);
+    ec_scratch_wa_free(scratch, s_inv);
+
+    return ret;
+}
+
+/**
+ * Порівнює x-координату точки C = z1*P+z2*Q за модулем n з r.
+ *
+ * @param params параметри еліптичної кривої
+ * @param scratch арена для проміжних значень або NULL
+ * @param C аффінна точка C
+ * @param wr r у вигляді числа
+ * @return RET_OK, якщо підпис вірний, або RET_VERIFY_FAILED
+ */
+static int ecdsa_verify_check(const EcParamsCtx *params, EcScratch *scratch, const ECPoint *C, const WordArray *wr)
+{
+    WordArray *r_act = NULL;
+    WordArray* t = NULL;
+    const WordArray *q;
+    int ret = RET_OK;
+
+    q = params->n;
+
+    CHECK_NOT_NULL(t = ec_scratch_wa(scratch, (C->x->len > q->len * 2) ? C->x->len : q->len * 2));
+    DO(wa_copy(C->x, t));
+
+    CHECK_NOT_NULL(r_act = ec_scratch_wa(scratch, q->len));
+    int_div(t, q, NULL, r_act);
+
+    if (!int_equals(r_act, wr)) {
+        SET_ERROR(RET_VERIFY_FAILED);
+    }
+
+cleanup:
+
+    ec_scratch_wa_free(scratch, r_act);
+    ec_scratch_wa_free(scratch, t);
+
+    return ret;
+}
+
+int ecdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, const ByteArray *s)
+{
+    EcScratch *scratch = NULL;
+    WordArray *z1 = NULL;
+    WordArray *z2 = NULL;
+    WordArray *wr = NULL;
+    ECPoint C = { NULL, NULL, NULL };
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(H != NULL);
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(s != NULL);
+
+    if (ctx->verify_status == 0) {
+        SET_ERROR(RET_INVALID_CTX_MODE);
+    }
+
+    scratch = ec_scratch_acquire(ctx->scratch);
+
+    DO(ecdsa_verify_prepare(ctx->params, scratch, H, r, s, &wr, &z1, &z2));
+
     /* Шаг 5. Обчислити точку ЕК C = z1*P+z2*Q */
     if (ctx->params->ec_field == EC_FIELD_PRIME) {
-        CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-        DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, z1, ctx->precomp_q, z2, C));
+        DO(ec_scratch_point(scratch, ctx->params->ecp->len, &C));
+        DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, z1, ctx->precomp_q, z2, &C));
     }
     else {
-        CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ec2m->len));
-        DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, z1, ctx->precomp_q, z2, C));
+        DO(ec_scratch_point(scratch, ctx->params->ec2m->len, &C));
+        DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, z1, ctx->precomp_q, z2, &C));
     }
 
-    CHECK_NOT_NULL(t = wa_copy_with_alloc(C->x));
-    wa_change_len(t, q->len * 2);
+    DO(ecdsa_verify_check(ctx->params, scratch, &C, wr));
 
-    CHECK_NOT_NULL(r_act = wa_alloc(q->len));
-    int_div(t, q, NULL, r_act);
+cleanup:
 
-    if (!int_equals(r_act, wr)) {
-        SET_ERROR(RET_VERIFY_FAILED);
+    ec_scratch_wa_free(scratch, z1);
+    ec_scratch_wa_free(scratch, z2);
+    ec_scratch_wa_free(scratch, wr);
+    ec_scratch_point_free(scratch, &C);
+    ec_scratch_release(scratch);
+
+    return ret;
+}
+
+int ecdsa_verify_batch(const EcCtx *ctx, size_t count, const ByteArray *const *qx, const ByteArray *const *qy,
+        const ByteArray *const *H, const ByteArray *const *r, const ByteArray *const *s, int *results)
+{
+    ECPoint **q = NULL;
+    ECPoint **C = NULL;
+    WordArray **wr = NULL;
+    WordArray **z1 = NULL;
+    WordArray **z2 = NULL;
+    size_t *idx = NULL;
+    size_t point_len;
+    size_t i;
+    size_t n = 0;
+    bool all_ok = true;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(qx != NULL);
+    CHECK_PARAM(qy != NULL);
+    CHECK_PARAM(H != NULL);
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(s != NULL);
+    CHECK_PARAM(results != NULL);
+
+    if (count == 0) {
+        return RET_OK;
+    }
+
+    point_len = (ctx->params->ec_field == EC_FIELD_PRIME) ? ctx->params->ecp->len : ctx->params->ec2m->len;
+
+    CALLOC_CHECKED(q, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(C, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(wr, count * sizeof(WordArray *));
+    CALLOC_CHECKED(z1, count * sizeof(WordArray *));
+    CALLOC_CHECKED(z2, count * sizeof(WordArray *));
+    CALLOC_CHECKED(idx, count * sizeof(size_t));
+
+    /* Некоректні ключі та підписи відкидаються до пакетного обчислення. */
+    for (i = 0; i < count; i++) {
+        if ((qx[i] == NULL) || (qy[i] == NULL) || (H[i] == NULL) || (r[i] == NULL) || (s[i] == NULL)) {
+            results[i] = RET_INVALID_PARAM;
+            continue;
+        }
+
+        results[i] = public_key_to_ec_point(ctx->params, qx[i], qy[i], &q[n]);
+        if (results[i] == RET_OK) {
+            results[i] = ecdsa_verify_prepare(ctx->params, NULL, H[i], r[i], s[i], &wr[n], &z1[n], &z2[n]);
+            if (results[i] != RET_OK) {
+                ec_point_free(q[n]);
+                q[n] = NULL;
+            }
+        }
+        if (results[i] == RET_OK) {
+            CHECK_NOT_NULL(C[n] = ec_point_alloc(point_len));
+            idx[n++] = i;
+        }
+    }
+
+    DO(ec_dual_mul_batch(ctx, q, z1, z2, n, C));
+
+    for (i = 0; i < n; i++) {
+        results[idx[i]] = ecdsa_verify_check(ctx->params, NULL, C[i], wr[i]);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (results[i] != RET_OK) {
+            all_ok = false;
+        }
+    }
+    if (!all_ok) {
+        ret = RET_VERIFY_FAILED;
+    }
+
+cleanup:
+
+    for (i = 0; (idx != NULL) && (i < count); i++) {
+        ec_point_free(q[i]);
+        ec_point_free(C[i]);
+        wa_free(wr[i]);
+        wa_free(z1[i]);
+        wa_free(z2[i]);
+    }
+    free(q);
+    free(C);
+    free(wr);
+    free(z1);
+    free(z2);
+    free(idx);
+
+    return ret;
+}
+
+/* Пакет із трьох підписів, другий з яких зіпсований: відхиляється лише він. */
+static int ecdsa_batch_self_test(const EcCtx* ctx, const ByteArray* qx, const ByteArray* qy,
+        const ByteArray* hash, const ByteArray* r, const ByteArray* s)
+{
+    int ret = RET_OK;
+    ByteArray* ba_bad_hash = NULL;
+    const ByteArray* qxs[3] = { qx, qx, qx };
+    const ByteArray* qys[3] = { qy, qy, qy };
+    const ByteArray* hashes[3] = { hash, NULL, hash };
+    const ByteArray* rs[3] = { r, r, r };
+    const ByteArray* ss[3] = { s, s, s };
+    int results[3] = { RET_OK, RET_OK, RET_OK };
+
+    CHECK_NOT_NULL(ba_bad_hash = ba_copy_with_alloc(hash, 0, 0));
+    ba_bad_hash->buf[0] ^= 0x01;
+    hashes[1] = ba_bad_hash;
+
+    if ((ecdsa_verify_batch(ctx, 3, qxs, qys, hashes, rs, ss, results) != RET_VERIFY_FAILED) ||
+        (results[0] != RET_OK) || (results[1] != RET_VERIFY_FAILED) || (results[2] != RET_OK)) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
     }
 
 cleanup:
+    ba_free(ba_bad_hash);
+    return ret;
+}
 
-    wa_free(tmp);
-    wa_free(e);
-    wa_free(z1);
-    wa_free(z2);
-    wa_free(wr);
-    wa_free(ws);
-    wa_free(s_inv);
-    wa_free(r_act);
-    wa_free(t);
-    ec_point_free(C);
+/* Підписи з парами (k, kP) з пулу. Пул заповнюється синхронно, тож тест не залежить від фонового потоку. */
+static int ecdsa_nonce_pool_self_test(EcCtx* ctx, const ByteArray* d, const ByteArray* qx, const ByteArray* qy,
+        const ByteArray* hash)
+{
+    int ret = RET_OK;
+    ByteArray* ba_r[4] = { NULL, NULL, NULL, NULL };
+    ByteArray* ba_s[4] = { NULL, NULL, NULL, NULL };
+    WordArray* wa_k = NULL;
+    ECPoint* kp = NULL;
+    size_t i;
+
+    DO(ec_init_sign(ctx, d));
+    DO(ec_set_nonce_pool(ctx, 2, 0));
+
+    /* Заповнений пул віддає щонайменше depth пар. */
+    CHECK_NOT_NULL(wa_k = wa_alloc(ctx->params->n->len));
+    DO(ec_nonce_pool_fill(ctx->nonce_pool));
+    for (i = 0; i < 2; i++) {
+        DO(ec_nonce_pool_take(ctx->nonce_pool, wa_k, &kp));
+        if (kp == NULL) {
+            SET_ERROR(RET_SELF_TEST_FAIL);
+        }
+        ec_point_free_private(kp);
+        kp = NULL;
+    }
+
+    DO(ec_nonce_pool_fill(ctx->nonce_pool));
+    for (i = 0; i < 4; i++) {
+        DO(ecdsa_sign(ctx, hash, &ba_r[i], &ba_s[i]));
+    }
 
+    DO(ec_init_verify(ctx, qx, qy));
+    for (i = 0; i < 4; i++) {
+        DO(ecdsa_verify(ctx, hash, ba_r[i], ba_s[i]));
+    }
+
+cleanup:
+    ec_set_nonce_pool(ctx, 0, 0);
+    for (i = 0; i < 4; i++) {
+        ba_free(ba_r[i]);
+        ba_free(ba_s[i]);
+    }
+    wa_free_private(wa_k);
+    ec_point_free_private(kp);
     return ret;
 }
 
@@ -387,7 +627,7 @@ static int ecdsa_p_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(ecdsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(ecdsa_sign_internal(ec_ctx, NULL, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -398,6 +638,8 @@ static int ecdsa_p_self_test(void)
 
     DO(ec_init_verify(ec_ctx, ba_Qx, ba_Qy));
     DO(ecdsa_verify(ec_ctx, ba_hash, ba_R, ba_S));
+    DO(ecdsa_batch_self_test(ec_ctx, ba_Qx, ba_Qy, ba_hash, ba_R, ba_S));
+    DO(ecdsa_nonce_pool_self_test(ec_ctx, &ba_d, ba_Qx, ba_Qy, ba_hash));
 
 cleanup:
     ba_free(ba_hash);
@@ -463,7 +705,7 @@ static int ecdsa_b_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(ecdsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(ecdsa_sign_internal(ec_ctx, NULL, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -474,6 +716,7 @@ static int ecdsa_b_self_test(void)
 
     DO(ec_init_verify(ec_ctx, ba_Qx, ba_Qy));
     DO(ecdsa_verify(ec_ctx, ba_hash, ba_R, ba_S));
+    DO(ecdsa_batch_self_test(ec_ctx, ba_Qx, ba_Qy, ba_hash, ba_R, ba_S));
 
 cleanup:
     ba_free(ba_hash);
@@ -60,7 +60,7 @@ int ecgdsa_get_pubkey(const EcCtx* ctx, const ByteArray* d, ByteArray** qx, Byte
     }
 
     wa_change_len(wd, ctx->params->n->len);
-    CHECK_NOT_NULL(winvd = gfp_mod_inv_core(wd, ctx->params->n));
+    CHECK_NOT_NULL(winvd = gfp_mod_inv_core_with_alloc(wd, ctx->params->n));
 
     if (ctx->params->precomp_p == NULL) {
         int sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
@@ -90,7 +90,8 @@ cleanup:
     return ret;
 }
 
-static int ecgdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* k, ByteArray** r, ByteArray** s)
+static int ecgdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* k, const ECPoint* kp,
+        ByteArray** r, ByteArray** s)
 {
     WordArray* tmp = NULL;
     WordArray* e = NULL;
@@ -120,7 +121,7 @@ static int ecgdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const Word
     /* Шаг 3. Обчислити точку ЕК C = kP,
      * c = (cx, cy) та визначити r = cx (mod q). */
     CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-    DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, k, NULL, NULL, C));
+    DO(ec_sign_nonce_point(ctx, k, kp, C));
 
     CHECK_NOT_NULL(tmp = wa_alloc(q->len * 2));
     CHECK_NOT_NULL(wr = wa_alloc(q->len));
@@ -182,6 +183,7 @@ cleanup:
 int ecgdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray** s)
 {
     WordArray* k = NULL;
+    ECPoint* kp = NULL;
     const WordArray* q;
     int ret = RET_OK;
 
@@ -201,13 +203,16 @@ int ecgdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray**
 
     do {
         /* Шаг 2. Згенерувати випадкове число k (0 < k < q). */
-        DO(int_rand(q, k));
-        ret = ecgdsa_sign_internal(ctx, H, k, r, s);
+        DO(ec_sign_nonce(ctx, k, &kp));
+        ret = ecgdsa_sign_internal(ctx, H, k, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
     wa_free_private(k);
+    ec_point_free_private(kp);
 
     return ret;
 }
@@ -261,7 +266,7 @@ int ecgdsa_verify(const EcCtx *ctx, const ByteArray *H, const ByteArray *r, cons
     wa_change_len(e, q->len);
 
     /* Шаг 3. Обчислити r = s^(-1)(mod q). */
-    CHECK_NOT_NULL(r_inv = gfp_mod_inv_core(wr, q));
+    CHECK_NOT_NULL(r_inv = gfp_mod_inv_core_with_alloc(wr, q));
 
     /* Шаг 4. Обчислити u = ((r^-1)e mod q), v = ((r^-1)s mod q). */
     CHECK_NOT_NULL(u = wa_alloc(q->len));
@@ -353,7 +358,7 @@ int ecgdsa_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(ecgdsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(ecgdsa_sign_internal(ec_ctx, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
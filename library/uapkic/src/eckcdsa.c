@@ -58,7 +58,7 @@ int eckcdsa_get_pubkey(const EcCtx* ctx, const ByteArray* d, ByteArray** qx, Byt
     }
 
     wa_change_len(wd, ctx->params->n->len);
-    CHECK_NOT_NULL(winvd = gfp_mod_inv_core(wd, ctx->params->n));
+    CHECK_NOT_NULL(winvd = gfp_mod_inv_core_with_alloc(wd, ctx->params->n));
 
     if (ctx->params->precomp_p == NULL) {
         int sign_win_opt_level = (default_opt_level >> 8) & 0x0f;
@@ -111,7 +111,8 @@ cleanup:
  * 9. if s == 0, restart at step 3.
  * 10. return (r, s)
  */
-static int eckcdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, HashAlg hash_alg, const WordArray* K, ByteArray** R, ByteArray** S)
+static int eckcdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, HashAlg hash_alg, const WordArray* K, const ECPoint* kp,
+        ByteArray** R, ByteArray** S)
 {
     HashCtx *hash_ctx = NULL;
     ByteArray* hzm = NULL;
@@ -140,14 +141,16 @@ static int eckcdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, HashAlg h
      * c = (cx, cy) та визначити r = cx (mod q). */
     if (ctx->params->ec_field == EC_FIELD_PRIME) {
         CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-        DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, K, NULL, NULL, C));
-        CHECK_NOT_NULL(r = wa_to_ba(C->x));
-        DO(ba_change_len(r, (int_bit_len(ctx->params->ecp->gfp->p) + 7) / 8));
     }
     else {
         CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ec2m->len));
-        DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, K, NULL, NULL, C));
-        CHECK_NOT_NULL(r = wa_to_ba(C->x));
+    }
+    DO(ec_sign_nonce_point(ctx, K, kp, C));
+    CHECK_NOT_NULL(r = wa_to_ba(C->x));
+    if (ctx->params->ec_field == EC_FIELD_PRIME) {
+        DO(ba_change_len(r, (int_bit_len(ctx->params->ecp->gfp->p) + 7) / 8));
+    }
+    else {
         DO(ba_change_len(r, ((size_t)ctx->params->ec2m->gf2m->f[0] + 7) / 8));
     }
     
@@ -213,6 +216,7 @@ cleanup:
 int eckcdsa_sign(const EcCtx* ctx, const ByteArray* H, HashAlg hash_alg, ByteArray** r, ByteArray** s)
 {
     WordArray* k = NULL;
+    ECPoint* kp = NULL;
     const WordArray* q;
     int ret = RET_OK;
 
@@ -232,13 +236,16 @@ int eckcdsa_sign(const EcCtx* ctx, const ByteArray* H, HashAlg hash_alg, ByteArr
 
     do {
         /* Шаг 2. Згенерувати випадкове число k (0 < k < q). */
-        DO(int_rand(q, k));
-        ret = eckcdsa_sign_internal(ctx, H, hash_alg, k, r, s);
+        DO(ec_sign_nonce(ctx, k, &kp));
+        ret = eckcdsa_sign_internal(ctx, H, hash_alg, k, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
     wa_free_private(k);
+    ec_point_free_private(kp);
 
     return ret;
 }
@@ -427,7 +434,7 @@ static int eckcdsa_p_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(eckcdsa_sign_internal(ec_ctx, ba_hash, HASH_ALG_SHA256, wa_k, &ba_R, &ba_S));
+    DO(eckcdsa_sign_internal(ec_ctx, ba_hash, HASH_ALG_SHA256, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -509,7 +516,7 @@ static int eckcdsa_b_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(eckcdsa_sign_internal(ec_ctx, ba_hash, HASH_ALG_SHA224, wa_k, &ba_R, &ba_S));
+    DO(eckcdsa_sign_internal(ec_ctx, ba_hash, HASH_ALG_SHA224, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -87,7 +87,8 @@ cleanup:
     return ret;
 }
 
-static int ecrdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* k, ByteArray** r, ByteArray** s)
+static int ecrdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* k, const ECPoint* kp,
+        ByteArray** r, ByteArray** s)
 {
     WordArray* tmp = NULL;
     WordArray* t = NULL;
@@ -117,7 +118,7 @@ static int ecrdsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const Word
     /* Шаг 3. Обчислити точку ЕК C = kP,
      * c = (cx, cy) та визначити r = cx (mod q). */
     CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-    DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, k, NULL, NULL, C));
+    DO(ec_sign_nonce_point(ctx, k, kp, C));
 
     CHECK_NOT_NULL(tmp = wa_alloc(q->len * 2));
     CHECK_NOT_NULL(wr = wa_alloc(q->len));
@@ -182,6 +183,7 @@ cleanup:
 int ecrdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray** s)
 {
     WordArray* k = NULL;
+    ECPoint* kp = NULL;
     const WordArray* q;
     int ret = RET_OK;
 
@@ -201,13 +203,16 @@ int ecrdsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray**
 
     do {
         /* Шаг 2. Згенерувати випадкове число k (0 < k < q). */
-        DO(int_rand(q, k));
-        ret = ecrdsa_sign_internal(ctx, H, k, r, s);
+        DO(ec_sign_nonce(ctx, k, &kp));
+        ret = ecrdsa_sign_internal(ctx, H, k, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
     wa_free_private(k);
+    ec_point_free_private(kp);
 
     return ret;
 }
@@ -265,7 +270,7 @@ int ecrdsa_verify(const EcCtx* ctx, const ByteArray* H, const ByteArray* r, cons
     wa_change_len(e, q->len);
 
     /* Шаг 3. Обчислити e = OS2I(h)^-1 (mod q). */
-    CHECK_NOT_NULL(e_inv = gfp_mod_inv_core(e, q));
+    CHECK_NOT_NULL(e_inv = gfp_mod_inv_core_with_alloc(e, q));
 
     /* Шаг 4. Обчислити u = es (mod q), v = -er (mod q). */
     CHECK_NOT_NULL(u = wa_alloc(q->len));
@@ -360,7 +365,7 @@ int ecrdsa_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(ecrdsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(ecrdsa_sign_internal(ec_ctx, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
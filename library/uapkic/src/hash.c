@@ -42,6 +42,7 @@
 #include "dstu7564.h"
 #include "whirlpool.h"
 #include "gostr3411-2012.h"
+#include "sha2-internal.h"
 #include "byte-array-internal.h"
 #include "macros-internal.h"
 
@@ -377,6 +378,52 @@ cleanup:
     return ret;
 }
 
+int hash_multi(HashAlg alg, const ByteArray* const* msgs, size_t count, ByteArray** hashes)
+{
+    int ret = RET_OK;
+    size_t i;
+
+    CHECK_PARAM((msgs != NULL) || (count == 0));
+    CHECK_PARAM((hashes != NULL) || (count == 0));
+
+    for (i = 0; i < count; i++) {
+        hashes[i] = NULL;
+    }
+    for (i = 0; i < count; i++) {
+        CHECK_PARAM(msgs[i] != NULL);
+    }
+
+    switch (alg)
+    {
+    case HASH_ALG_SHA224:
+        DO(sha2_hash_multi(SHA2_VARIANT_224, msgs, count, hashes));
+        break;
+    case HASH_ALG_SHA256:
+        DO(sha2_hash_multi(SHA2_VARIANT_256, msgs, count, hashes));
+        break;
+    case HASH_ALG_SHA384:
+        DO(sha2_hash_multi(SHA2_VARIANT_384, msgs, count, hashes));
+        break;
+    case HASH_ALG_SHA512:
+        DO(sha2_hash_multi(SHA2_VARIANT_512, msgs, count, hashes));
+        break;
+    default:
+        for (i = 0; i < count; i++) {
+            DO(hash(alg, msgs[i], &hashes[i]));
+        }
+        break;
+    }
+
+cleanup:
+    if ((ret != RET_OK) && (hashes != NULL)) {
+        for (i = 0; i < count; i++) {
+            ba_free(hashes[i]);
+            hashes[i] = NULL;
+        }
+    }
+    return ret;
+}
+
 size_t hash_get_size(HashAlg alg)
 {
     switch (alg)
@@ -149,3 +149,13 @@ void ec_point_free(ECPoint *p)
         free(p);
     }
 }
+
+void ec_point_free_private(ECPoint *p)
+{
+    if (p != NULL) {
+        wa_free_private(p->x);
+        wa_free_private(p->y);
+        wa_free_private(p->z);
+        free(p);
+    }
+}
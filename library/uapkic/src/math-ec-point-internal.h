@@ -41,6 +41,16 @@ typedef struct ECPoint_st {
     WordArray *z;
 } ECPoint;
 
+/*
+ * Оголошує тимчасову точку ECPoint *_name з координатами довжини _len у буферах на стеку з _max слів.
+ */
+#define EC_POINT_STACK(_name, _max, _len)                               \
+    WA_STACK(_name##_x, _max, _len);                                    \
+    WA_STACK(_name##_y, _max, _len);                                    \
+    WA_STACK(_name##_z, _max, _len);                                    \
+    ECPoint _name##_pt = { _name##_x, _name##_y, _name##_z };           \
+    ECPoint *_name = &_name##_pt
+
 ECPoint *ec_point_alloc(size_t len);
 ECPoint *ec_point_aff_alloc(const WordArray *px, const WordArray *py);
 ECPoint *ec_point_proj_alloc(const WordArray *px, const WordArray *py, const WordArray *pz);
@@ -48,6 +58,7 @@ void ec_point_zero(ECPoint *p);
 void ec_point_copy(const ECPoint *a, ECPoint *out);
 ECPoint *ec_point_copy_with_alloc(const ECPoint *a);
 void ec_point_free(ECPoint *p);
+void ec_point_free_private(ECPoint *p);
 
 #ifdef  __cplusplus
 }
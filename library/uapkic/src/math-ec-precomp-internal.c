@@ -32,6 +32,18 @@
 #include "math-int-internal.h"
 #include "macros-internal.h"
 
+typedef struct EcPrecompStatic_st {
+    EcParamsId params_id;
+    EcPrecompType type;
+    int width;
+    size_t len;                     /* Довжина координати у словах */
+    size_t count;                   /* Кількість точок */
+    const word_t *xy;               /* Координати x, y точок */
+    const word_t *z;                /* Спільна z-координата */
+} EcPrecompStatic;
+
+#include "math-ec-precomp-tables.h"
+
 EcPrecomp *ec_copy_precomp_with_alloc(EcPrecomp *precomp)
 {
     int i, ret = RET_OK;
@@ -85,6 +97,18 @@ cleanup:
     return NULL;
 }
 
+static void ec_precomp_point_free(const EcPrecomp *precomp, ECPoint *p)
+{
+    if (!precomp->is_static) {
+        ec_point_free(p);
+    } else if (p != NULL) {
+        free(p->x);
+        free(p->y);
+        free(p->z);
+        free(p);
+    }
+}
+
 void ec_precomp_free(EcPrecomp *precomp)
 {
     int i;
@@ -93,7 +117,7 @@ void ec_precomp_free(EcPrecomp *precomp)
         if (precomp->type == EC_PRECOMP_TYPE_COMB) {
             if (precomp->ctx.comb->precomp != NULL) {
                 for (i = 0; i < (1 << precomp->ctx.comb->comb_width) - 1; i++) {
-                    ec_point_free(precomp->ctx.comb->precomp[i]);
+                    ec_precomp_point_free(precomp, precomp->ctx.comb->precomp[i]);
                 }
                 free(precomp->ctx.comb->precomp);
             }
@@ -101,7 +125,7 @@ void ec_precomp_free(EcPrecomp *precomp)
         } else if (precomp->type == EC_PRECOMP_TYPE_WIN) {
             if (precomp->ctx.win->precomp != NULL) {
                 for (i = 0; i < precomp->ctx.win->precomp_len; i++) {
-                    ec_point_free(precomp->ctx.win->precomp[i]);
+                    ec_precomp_point_free(precomp, precomp->ctx.win->precomp[i]);
                 }
                 free(precomp->ctx.win->precomp);
             }
@@ -110,3 +134,67 @@ void ec_precomp_free(EcPrecomp *precomp)
         free(precomp);
     }
 }
+
+EcPrecomp *ec_precomp_alloc_static(EcParamsId params_id, EcPrecompType type, int width, size_t len)
+{
+    const EcPrecompStatic *table = NULL;
+    EcPrecomp *precomp = NULL;
+    ECPoint **points = NULL;
+    ECPoint *p;
+    size_t i;
+    int ret = RET_OK;
+
+#ifdef EC_PRECOMP_STATIC_TABLES
+    for (i = 0; i < sizeof(EC_PRECOMP_STATIC) / sizeof(EC_PRECOMP_STATIC[0]); i++) {
+        if (EC_PRECOMP_STATIC[i].params_id == params_id && EC_PRECOMP_STATIC[i].type == type
+                && EC_PRECOMP_STATIC[i].width == width && EC_PRECOMP_STATIC[i].len == len) {
+            table = &EC_PRECOMP_STATIC[i];
+            break;
+        }
+    }
+#else
+    (void)params_id;
+#endif
+    if (table == NULL) {
+        return NULL;
+    }
+
+    CALLOC_CHECKED(precomp, sizeof(EcPrecomp));
+    precomp->type = type;
+    precomp->is_static = true;
+    if (type == EC_PRECOMP_TYPE_COMB) {
+        CALLOC_CHECKED(precomp->ctx.comb, sizeof(EcPrecompComb));
+        precomp->ctx.comb->comb_width = width;
+        CALLOC_CHECKED(points, table->count * sizeof(ECPoint *));
+        precomp->ctx.comb->precomp = points;
+    } else {
+        CALLOC_CHECKED(precomp->ctx.win, sizeof(EcPrecompWin));
+        precomp->ctx.win->win_width = width;
+        precomp->ctx.win->precomp_len = (int)table->count;
+        CALLOC_CHECKED(points, table->count * sizeof(ECPoint *));
+        precomp->ctx.win->precomp = points;
+    }
+
+    //  Заголовки точок посилаються на константні дані, що спільні для всіх процесів
+    for (i = 0; i < table->count; i++) {
+        CALLOC_CHECKED(p, sizeof(ECPoint));
+        points[i] = p;
+        CALLOC_CHECKED(p->x, sizeof(WordArray));
+        CALLOC_CHECKED(p->y, sizeof(WordArray));
+        CALLOC_CHECKED(p->z, sizeof(WordArray));
+        p->x->buf = (word_t *)&table->xy[2 * i * len];
+        p->y->buf = (word_t *)&table->xy[(2 * i + 1) * len];
+        p->z->buf = (word_t *)table->z;
+        p->x->len = len;
+        p->y->len = len;
+        p->z->len = len;
+    }
+
+    return precomp;
+
+cleanup:
+
+    ec_precomp_free(precomp);
+
+    return NULL;
+}
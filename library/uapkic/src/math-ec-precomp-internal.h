@@ -29,7 +29,9 @@
 #ifndef UAPKIC_MATH_EC_PRECOMP_H
 #define UAPKIC_MATH_EC_PRECOMP_H
 
+#include <stdbool.h>
 #include "math-ec-point-internal.h"
+#include "ec-default-params.h"
 
 # ifdef  __cplusplus
 extern "C" {
@@ -58,6 +60,7 @@ typedef struct EcPrecomp_st {
         EcPrecompWin *win;
         EcPrecompComb *comb;
     } ctx;
+    bool is_static;                 /* Координати точок розміщені у вбудованих таблицях */
 } EcPrecomp;
 
 /**
@@ -70,6 +73,18 @@ EcPrecomp *ec_copy_precomp_with_alloc(EcPrecomp *precomp_p);
 
 void ec_precomp_free(EcPrecomp *precomp);
 
+/**
+ * Створює контекст передобчислень базової точки стандартної кривої
+ * з вбудованих таблиць (без копіювання координат).
+ *
+ * @param params_id ідентифікатор стандартних параметрів
+ * @param type тип передобчислень
+ * @param width ширина вікна або гребеня
+ * @param len довжина координати у словах
+ * @return контекст передобчислень або NULL, якщо таблиці немає
+ */
+EcPrecomp *ec_precomp_alloc_static(EcParamsId params_id, EcPrecompType type, int width, size_t len);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,4248 @@
+/*
+ * Таблиці передобчислень базових точок стандартних кривих.
+ * Файл згенеровано tools/ec-precomp-gen.c, не редагувати вручну.
+ */
+
+#ifndef UAPKIC_MATH_EC_PRECOMP_TABLES_H
+#define UAPKIC_MATH_EC_PRECOMP_TABLES_H
+
+#if WORD_BIT_LENGTH == 64
+
+#define EC_PRECOMP_STATIC_TABLES
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_WIN_5_XY[] = {
+    0x29daf8a3f35823be, 0xd74ce983a5c42372, 0x00000002e2f85f5d,
+    0x3ff0e00ce2cd723a, 0x8c51d7b95284d9d0, 0x00000003826f008a,
+    0x2625375487bf1cae, 0xa6070f9f7dec70be, 0x000000036f7987b5,
+    0x8a3c3192f74f54a8, 0x2b296c48e0b7c5f2, 0x000000060cd3db30,
+    0x3cb5f02e8c1bb79e, 0xa8f5e1749009c57d, 0x00000001b595d676,
+    0xc13753d580a57980, 0x6edc03f54b7e7f8c, 0x00000001383fb223,
+    0x09492be4270acffb, 0xefc7ba26c836b4b4, 0x00000005d99f9c81,
+    0x010df88ea2da8c96, 0x2597248a701010ac, 0x000000073aab83ba,
+    0x6933dfc4e7ec3287, 0x5aa7213fa116b68d, 0x00000005cd5e5378,
+    0xd4a49fcf57662164, 0x19a2213a9b706c74, 0x0000000174fe484c,
+    0x770ca8552880e1f9, 0x096d08f407b90eaf, 0x00000002dda7c145,
+    0x87ded705a73c969e, 0x3adc49a4178c6c13, 0x000000033392a865,
+    0x90c47b22c3615894, 0x0e90859525964a4f, 0x00000004f40a5c62,
+    0xf6c158d5d487aa4c, 0x1b7b1c8f1b412264, 0x000000069c628e19,
+    0xe1e321837f1858ec, 0xc1c2e0212bf4376b, 0x00000005b3afcbb9,
+    0xc1a4fe6457647f5a, 0x4ae718645fc443e6, 0x00000003779d79fb,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_COMB_5_XY[] = {
+    0x29daf8a3f35823be, 0xd74ce983a5c42372, 0x00000002e2f85f5d,
+    0x3ff0e00ce2cd723a, 0x8c51d7b95284d9d0, 0x00000003826f008a,
+    0x23ebdeb1251c400e, 0x2574024f08f4ba84, 0x00000002a0c24318,
+    0x9e65e93584d813a0, 0x2c3fb7d9085ab29e, 0x000000015415bb5f,
+    0xef8697bfffc0a517, 0xfa7ccb5756a2ddb9, 0x0000000404b35227,
+    0xbae3fbe5189f51cb, 0xf9b5d10bb4f52c7a, 0x000000070eb15f2b,
+    0x302beab9b9bf507a, 0xfaf19c9cf4af82cf, 0x00000000beb82545,
+    0xdeec9b87f7e0d5f7, 0xb510af31401f8af2, 0x000000022be0953f,
+    0xbad66f6b47db6e5b, 0x51fbadcf29d89a4e, 0x00000004cf00766c,
+    0x6201a6541eb4f034, 0x0d6431952df62e36, 0x0000000128346132,
+    0xf7b1e8511335bccb, 0x4c13ffa5d1fdccf0, 0x000000038a2d83f3,
+    0x4193d536cb08b37a, 0x31904d664581eca6, 0x000000062dc165f6,
+    0xef02f2c9e5f0d0ec, 0xf6d3c26d9eb1fcb4, 0x00000006a6140e7d,
+    0xfe9714f9cc505c83, 0x368d0769504e0f11, 0x000000060ef3f6ec,
+    0x3e255b36176db3db, 0x091583b5f9e0bec4, 0x00000001dfbd7cf3,
+    0xe835f02c341dec0f, 0x9fcf5983a784a39f, 0x00000007b339b5b6,
+    0x967cc334591c3265, 0xa1cf4bfe6cdfcda4, 0x000000065a8ec3f4,
+    0xe42b84618046195d, 0xc325c65a16c6f206, 0x000000078ef3d2bb,
+    0x13dbcba01c110649, 0xbbca0ae6661c6a2d, 0x00000003cda50201,
+    0xc3f1fb07af561e78, 0xaadc9d86270b1308, 0x00000002493a1f8d,
+    0x84dc2258ec9112c4, 0xc7be1ac3b9fbc108, 0x000000072001cdd1,
+    0x5817e97b99c9a4d7, 0xc9742b1d21368780, 0x00000003597813a6,
+    0x842d903448195a24, 0xc24ce750f02cb402, 0x00000005e63f9dc1,
+    0x880b82c7a363d3b6, 0xe8c61840b84f060d, 0x00000007374f19d5,
+    0xddd5809e535997cc, 0xe56425f669868209, 0x00000001e50a6acf,
+    0x9cf6e7689ec8e86e, 0x7a149eb4095d90c4, 0x000000001c263f74,
+    0xb585769263d80ba1, 0x3505d8f62c0c5168, 0x00000002077c8038,
+    0x83a502c0d8bf1520, 0x394780db2aa0e57b, 0x00000006613ff410,
+    0xafd0bf0edeae4f61, 0x3228e2e890ea2308, 0x0000000609c15ffe,
+    0x504a58cf34245dc9, 0xd982f6d92f143fb7, 0x00000002ff26bcdb,
+    0x3b82b02a2fc89849, 0xe4f4ac46bd26493e, 0x0000000453811d28,
+    0x2c1a4958d96c9038, 0x291a9840d1af6e38, 0x0000000664069879,
+    0x913595c556caab18, 0xf057d7e448368363, 0x00000000b1532587,
+    0x701911462b3c9337, 0xb75705e754e392a3, 0x00000000a2c58ff1,
+    0x79857c72dca79b6b, 0x2f008e0b05c14656, 0x00000005caf1938e,
+    0x297efdfd34de51d0, 0x8261f55a86a163a4, 0x00000003610e8041,
+    0x9c41e0ff5c8bedcc, 0xdd4c7f39162d7115, 0x0000000225fd1aac,
+    0x3c00d70042ec965a, 0x202c8d197d45d1c0, 0x0000000032101053,
+    0xb835f47e1f2f0574, 0x4c04ac56b658226f, 0x00000007f1393eb2,
+    0x006b6979ea37565c, 0x084323e2aff8913b, 0x000000078744dc8f,
+    0xe18ce0cdc73a3fe5, 0x72fbb8e3d730a85e, 0x000000024cd0f4c2,
+    0x4debd78d88e41bdf, 0xe77a48bcf6402859, 0x000000026fc2b783,
+    0x19bda65430bd7846, 0x7458275d46982276, 0x00000003bc7c22df,
+    0x31ea8873d6ecd04c, 0xaa58ae9d3265f238, 0x000000077b013735,
+    0x49fdfa14ace343d5, 0xd55937c4f9a4dd11, 0x00000003947aab4c,
+    0xd79cd7960500b69b, 0x8d5894581cdca664, 0x000000053d664322,
+    0x4de19c27a02aed79, 0x61533351ee5a05a1, 0x00000003cec4eb39,
+    0xe3c309e70a4a1e20, 0xaea6197c757bd5b5, 0x000000021c47a805,
+    0xa73e544fa405fd26, 0x29bb1732d2d4f40c, 0x000000077aed81e6,
+    0x3a4ddc1abebb9ea9, 0x318ebde446f54c09, 0x00000001492d8ce9,
+    0x2267d47d55bcbbb9, 0x466e07869d4aa939, 0x0000000342ff6256,
+    0xad2ef895bc662ad3, 0x25f43b66bfa6955c, 0x00000001e924f746,
+    0x522c886c3720a620, 0x9c454e05f84b244d, 0x00000005be25fa74,
+    0x84ccbe91eb4812a6, 0xf203cfe9917302ba, 0x000000071ca775e4,
+    0xccbde048d41bc5d6, 0x2224ed3ce13ae926, 0x00000000b833f7c5,
+    0xff8fd49ed33327c8, 0x4232703f5a2eb57b, 0x0000000040384692,
+    0xa907aea5caec1d55, 0x7f7e612f6f55bf2e, 0x000000045bc39aae,
+    0x657b54e4149de697, 0xfcb0609cfcf7493c, 0x00000002379448d9,
+    0xf86a740804a52386, 0x4f7e3cbb6741b6a1, 0x00000006aa280508,
+    0xae1b54c79fac25da, 0x20995cc9869f82b6, 0x00000004f6566e92,
+    0x9266e686efea41c9, 0xb468711eb0a7d5ec, 0x00000005d6775fa5,
+    0x309edd2be20d9777, 0x2c5e55b4e93a68b9, 0x0000000291992093,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M167_PB_WIN_5_XY[] = {
+    0x30b2a2018b21cd54, 0x6a68192803910a3d, 0x0000007a1f665378,
+    0x8ed435e45fd59918, 0x1c0ec6b8909156d9, 0x0000005f49eb2678,
+    0x5f1eb400158dc211, 0x8f6d4a67cd551a0f, 0x00000020d81ce1bc,
+    0x547097746b28e9e8, 0xb18ddf6435869f59, 0x000000467401fab2,
+    0x32cd382564b58275, 0xac1ab2793ed049f5, 0x00000044e9432e8b,
+    0x6ad9af347ecc0202, 0xb365667af848c9a6, 0x000000277be679d1,
+    0xfac170cb40dfdafd, 0xbf136c2550d7967b, 0x00000065b373678f,
+    0x8d6a0685f648f217, 0xe28510cec3f798ce, 0x000000485487d000,
+    0x079ea8e14b36cc01, 0x0bcde4c39b10fbb9, 0x0000007945d0a160,
+    0xfa7ef4f2a20a7282, 0xc50fe8d408628b30, 0x00000053c3166622,
+    0x874a1fc839d05530, 0xc4e854ed35a0e9d9, 0x00000046bf629377,
+    0xacee23461afb9c52, 0x96835e91f518fca1, 0x0000003ae4881519,
+    0x3cd2a5c6945dfa21, 0xc7e672862e15132a, 0x00000059ce86665c,
+    0xe3c5da92e7ae8ba7, 0x82480e9b92a20e2d, 0x0000005d27bfc02e,
+    0x0b7c620d2cb2b3bf, 0xccfd39c8c980cfd1, 0x0000001c1dd7d2c8,
+    0x0b36dc5819d5e054, 0x80b9893d5401115a, 0x0000001833676bf8,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M167_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M167_PB_COMB_5_XY[] = {
+    0x30b2a2018b21cd54, 0x6a68192803910a3d, 0x0000007a1f665378,
+    0x8ed435e45fd59918, 0x1c0ec6b8909156d9, 0x0000005f49eb2678,
+    0x8814944617b9ac16, 0x24051135ef4312f9, 0x00000036bf9dd8c5,
+    0xa17af39a9b482f31, 0xc80029c0c89f70dc, 0x00000002874fe0d1,
+    0xd1192c45f8b609d0, 0x09cd3a10d8bdc13d, 0x0000001f5efe69f5,
+    0x74e674175336026e, 0x85144b8f4efbe5d5, 0x00000008e5543af0,
+    0x0bf1165fcb90e922, 0xe3fbcaf1ff9ee57f, 0x0000002e45169013,
+    0x67c19b5d880c1e9a, 0x38af0315f0f35e25, 0x00000005d86a4fc6,
+    0x07a40c79266444d3, 0xa82c4515d635928b, 0x00000048e86cfc5e,
+    0x0df9da702c9bf6d5, 0x888cd8a893c30ccf, 0x00000046e6611779,
+    0x7058bb8b831d4872, 0x2860cbbf5895b2e5, 0x000000361eae86f0,
+    0x67848bff3792578e, 0x150c25ce1ed1e31f, 0x00000069a64da49f,
+    0xcc4b0ae83ace716f, 0x444d38041b0a04d2, 0x0000001970f00b20,
+    0x90b7117858da2ef7, 0x671a18ad3ed9c147, 0x000000079ba08df8,
+    0xc673e835c4dd1185, 0x42648c49074dabef, 0x00000035622a712a,
+    0x5beace3a9bf944f2, 0x7deab3276819909f, 0x0000000041c52670,
+    0x88cab9e9e7689bfe, 0xd027a256b0635b59, 0x00000022a8841941,
+    0x2dfdc302d742267d, 0x595258e324e65bd7, 0x000000631785137d,
+    0xa858c18a12a07da4, 0xb077e2b1544501fb, 0x0000007b11c7cb8c,
+    0x05b4306dea551303, 0x6d643e2a87ee3249, 0x00000023027b56a4,
+    0x8774379d62603b86, 0x4c16122b7c3849b9, 0x0000001a997cdecc,
+    0x8b68c7e698beb87e, 0x7a3432bbf42a245f, 0x0000007686ee43bf,
+    0xcf3817db737cc4ab, 0x73ad826a47e340d0, 0x00000009240c74a9,
+    0xf5da3c4812b1e229, 0xc0913d7de6a8e481, 0x00000066414c3af5,
+    0xfc9221a4b17ae83e, 0x9ee6ca44c4111790, 0x00000032efacad9e,
+    0x5ac722e5db6b66a4, 0xa76c023f803d3b66, 0x0000006706cc31d3,
+    0xea11cda0b375592d, 0xce62ec49620f1298, 0x000000095d155175,
+    0x6d388aac9a51c8f5, 0x31f07ef974b2d0da, 0x00000040ac53c456,
+    0x36ce70d5840326f5, 0xfae31642c1acc2c5, 0x0000003d85dde0d9,
+    0x25d1ed0e0837254c, 0x71c72088a47293a5, 0x000000099a2c886a,
+    0x0432aa6af9baaf19, 0x90716cb44fefa973, 0x00000000d93f1bbf,
+    0x1ce70c78108f4770, 0x29c2e77299db1ebf, 0x00000060f916afeb,
+    0xff1ec861f6c26c73, 0xae26b278b27ad0dd, 0x0000006d3ebd42ac,
+    0x7e132f2d5276dca7, 0x737e826f8afd49a9, 0x000000567648576f,
+    0x9649ffdf55fa6907, 0xe9074e0c6eda1f2d, 0x000000017686a0c1,
+    0x3561d69a2c692840, 0x505601977186a7e3, 0x00000003a46eced4,
+    0x6b8c42d068df4bba, 0xa30816efe67a13b8, 0x00000057d0068397,
+    0xb88e128925211223, 0xd03a9dbeec0f0a95, 0x00000072a468a6ad,
+    0x526523b44008ee90, 0xf715dec70b096be2, 0x0000001b4e992c55,
+    0xaf5cdafc394d581f, 0x6bf432f3452ad77c, 0x0000006a1cf85457,
+    0xbfb2c08e29f23923, 0x29f0ce2a2c68af0c, 0x000000491e617b7e,
+    0xbeffdc9d155c4f28, 0xf6b393403dc4e884, 0x0000002d8b9249f7,
+    0xe5bb13d6720b4e30, 0x91dd9fcc7950e3d4, 0x0000002b4e26e07e,
+    0x356049df2d745b58, 0x8320036cbe63fff5, 0x0000003b88a85140,
+    0x6abf6ff0ff551a99, 0xf32c2e05d496425c, 0x00000030f25d0277,
+    0xbb2dd941f05f46ce, 0xee8a2d2a454925c0, 0x0000005278f9a25a,
+    0xf6408ca27bf60a6d, 0x787983ef66fac47a, 0x000000187d02d6b4,
+    0xd770b7da530eed2d, 0x253d7f4cae763c63, 0x0000001cd3e182d3,
+    0xd9dcff60b5ffb692, 0x783c2b670fba7d87, 0x0000005745fb356f,
+    0x50b818a245b52ae4, 0xa1365ad437d50b9b, 0x0000001606f702f8,
+    0x3e5e1c061d8bfb23, 0x802dc86cbb142774, 0x00000044b193acf0,
+    0x72ebe884b5aa9667, 0xd76cfc8629278a34, 0x00000014c81c921f,
+    0xfd0db42fe63dfcc9, 0x6c22913170374006, 0x00000050ccbab56a,
+    0xeb434cd36ade0190, 0x41ac18b0231349fc, 0x0000004b3fc8ed65,
+    0xb8f2871664da4437, 0xb101cff4779b7173, 0x000000303fa8547a,
+    0x42afabb98093bdbc, 0x127d8377e0207c16, 0x00000075d1973f17,
+    0xc2504a684dc72952, 0xcbfdb4af88e20574, 0x000000079547c411,
+    0xe5b643254a337049, 0x9d7106f55088fa74, 0x00000028fb33f3cd,
+    0xa9ae399455392f29, 0x002f170d76d91e29, 0x000000448230a47f,
+    0x6069ceaacac70e45, 0x90792383c718c60c, 0x0000000677ce382e,
+    0xcf17d96788dbf8dc, 0xcc4051dcfe94944a, 0x0000005ae861fa47,
+    0xdcd9d484299dda73, 0x068c9b82e66e72ad, 0x000000235fd2a67e,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M167_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_PB_WIN_5_XY[] = {
+    0x567a9181d37389ca, 0x6eadf0448fa22fad, 0x000004d41a619bcc,
+    0xf7ff5c1ce0d991a1, 0xb234c75e6dd2028b, 0x000010b51cc12849,
+    0x3cf1b9d73178cf85, 0xe294b5722b2fc905, 0x0000126d356095a0,
+    0x589fcd0acef9edbe, 0x8cc0a4a6a2a2d712, 0x00000df744a57b8a,
+    0xc804fad965f505e9, 0xea3e8457468df8d1, 0x0000171a0daab664,
+    0xba77f21bec14dc2c, 0xc01896cfab9beb37, 0x0000184ec25bfaea,
+    0xa0de7531601fae34, 0x9ef8238cb30f4c6c, 0x000009afb9984bc9,
+    0x61c72b241d3fd5da, 0x70b63506d8ef26e0, 0x000016cab4e1f5d6,
+    0x3ee524ec19ba3449, 0xfc9754a3048ed035, 0x0000073e858809f3,
+    0xadd48b0046d42f0d, 0x239a0dfea06b7713, 0x00000268109b5795,
+    0x89ac40ea1d7f2f66, 0x1d3ef11bebe747ae, 0x00001d0a4953c112,
+    0x98fbe2e61ea6d441, 0xd1345fe5d640aa3b, 0x000002f08d5beffc,
+    0xf325fdafd1f57c96, 0xb2e796318abdfa03, 0x0000065157f3a870,
+    0x7a6d6107443cf8fb, 0xeb383a030fe15691, 0x000018cfdab3b6cd,
+    0xc1ae604465e1e059, 0x80a92c66375448f9, 0x00001fb632e2d40b,
+    0x23eec640caac9200, 0x35b6ac4bff0ac523, 0x0000180c0b69968f,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_PB_COMB_5_XY[] = {
+    0x567a9181d37389ca, 0x6eadf0448fa22fad, 0x000004d41a619bcc,
+    0xf7ff5c1ce0d991a1, 0xb234c75e6dd2028b, 0x000010b51cc12849,
+    0xf6373accd7a3bdf1, 0x845755dbe2ee4ca5, 0x0000162f34aae781,
+    0x2b9390fc14ff65a2, 0x74db13f33e1f6381, 0x00001e7d3fc2672d,
+    0xd649d322a84b58ad, 0xe8e65272ecc35cb7, 0x0000134fc48e072c,
+    0x701ecd02690b0d4f, 0x4ef58bb02921a1eb, 0x00000d451e643555,
+    0xdaa8688dccbb276b, 0x37744be5b8d22266, 0x0000046ec96ff4cf,
+    0xda7e8a5eefe8dd39, 0xbd75b57ff2da9b6d, 0x00001b0763d309b0,
+    0x632f95b43d11d7ee, 0xd51fde3062752633, 0x000010e23cda6ed0,
+    0x51d24230478ca76c, 0x6bcbb62e475738f5, 0x00001f54d6f8be59,
+    0x8cfc768585e24c2f, 0x52c57665aaaf4b88, 0x0000170f4e0dbcd5,
+    0x24d4c4bc03ce620e, 0x6ee6412e869da030, 0x0000199864751e24,
+    0x5d0e0226836cd20f, 0x5c62b00870edbb51, 0x0000121cfd190bf0,
+    0xbb4d79ab0ff3b9c3, 0xdd9ad0a2798e717c, 0x000011b5ac97c587,
+    0xa24446bab237086e, 0x80c9dcdb058427cd, 0x00000364449bd354,
+    0xf4eb6b488567c01a, 0x38ab3e5affd7d7b6, 0x00001e9a8cb306c6,
+    0x62ca7dcd461583ee, 0x1d399f73d6940d97, 0x00000506e3657545,
+    0x6d7bcbcb6060f3fe, 0x41c8ab46d5a4736f, 0x00001ba6b44b7fe6,
+    0xc9e341c2482a4a62, 0xd68db6aa0c840f13, 0x00000e89d77cc086,
+    0xe5ee3dc76db4124e, 0x75e4df6dbdc862c2, 0x000015ae347a0190,
+    0x61d64a2acba2c86b, 0xcf815024017df18a, 0x000016de132e9071,
+    0x4b08e49e09c51dba, 0xcd17f55a83ca9e08, 0x000007c15ad20b8f,
+    0xf4b813284ddf7fe7, 0x1be969dec8fe3c7b, 0x000012e850c24c8f,
+    0xad811898526f34f2, 0xd5f3442207526c67, 0x000004d3d1b9dd1e,
+    0xc09a7d82f0f8f275, 0x2ba643e859603d7f, 0x000009c19b240bd1,
+    0xcbdc195ca5fad1b9, 0x3e3306a9e0628cf0, 0x00001c498f3fb1f0,
+    0x42980c2c1c67df47, 0x3ef2f7521d76ba24, 0x00000378aff2dfc7,
+    0x33e3f647c7b09a90, 0xc3e8702a40482f59, 0x00000e07d1b1827a,
+    0x403ac03fdac059de, 0x176b03b366cba06d, 0x00001c9ebc988d17,
+    0x83251f415e577cb9, 0xac73da7085fe9e75, 0x0000146776d66491,
+    0xd8201d496eecd521, 0x62e18f20b481347f, 0x00001f753334bc87,
+    0xde8b74c9a4165293, 0x1b67edbffbd0a9c0, 0x00001e19097971ab,
+    0x4340a2901b77cb40, 0x307b785cdcaeccf0, 0x00000959c849f477,
+    0xdefc00a93b2df2e4, 0x0acf5aa559be175f, 0x000006ba7417bad9,
+    0xe2761cbfccf1da94, 0x34130479b25e0523, 0x00001df97b0ce230,
+    0x4312e34204945109, 0x9c19e8d3b508f6ab, 0x00001d12f9f6e696,
+    0x5ef043870d8efbbc, 0xffb043210ae3b541, 0x00001efb18978d3f,
+    0xc769e265b6d7cb2b, 0x63f3e5af97fc1e69, 0x00000e23be98e7c0,
+    0xf26bcdcf5a478284, 0x9f7af3276fef4fe4, 0x000003a68bb059db,
+    0x839f88c2b6e18994, 0xe457cf79f1dcb42d, 0x00001d75bbc71d64,
+    0x6e806b999bbb3a42, 0x724e8aa919e2ab05, 0x000017232cea092d,
+    0xc10980c0f428e85b, 0x4084d84516f64d4e, 0x000010a8cb1127aa,
+    0x164e72767378c456, 0x9a22d37817bf5f87, 0x000015757b430c97,
+    0x669cd2e6459767d9, 0xeb8bb5a90b10326f, 0x000019ee8788760c,
+    0x9c4ea9dc6b40d427, 0x1da5f8fe55607461, 0x0000067bb401ea57,
+    0xd58ceeeeccb9d0d4, 0x455a32f2810d7c21, 0x000014a6590b6f9b,
+    0xb133f2a84277760e, 0x90bf3f92528f0d57, 0x00001331289bcec7,
+    0x6e93197a96f0f8f5, 0xd188396f580d8cbd, 0x00000326d81804e0,
+    0xecf6cbd0e465dc6c, 0x621879d52864cd6c, 0x00001507b242737c,
+    0xba41fff13d452317, 0x8c311d10585a2e73, 0x00000025b2b18e19,
+    0xb9ebfcfd14d02bee, 0xc5806a3eadf95bf0, 0x00001caa1c3cd01d,
+    0x492bc2ef02821fca, 0xa8030e03c4b029f6, 0x00001e9a42fd52f9,
+    0x99d6ce9f865e16f3, 0x2f5f467a5fd5f942, 0x0000042fe9c6c7df,
+    0xaf6bce8f20cb210f, 0xa370055449ee68d9, 0x000008a4ac090617,
+    0xb150fd9c2123eb1e, 0xc8cc57cf6241743a, 0x00000f492f71f91f,
+    0xe1d5c5aafd0fe0d1, 0x91f91b411eb0ca95, 0x000008a0f28985f6,
+    0xc593508baebf0bf9, 0x245de86ae97f8111, 0x00000a608babefde,
+    0x397f158efda23333, 0x6e0aa3229b4f9423, 0x00001e7000b3886d,
+    0x1a097247fabc9066, 0x27ed55865c032391, 0x00001563e1586d5c,
+    0xe353fbba64993d90, 0xb04e5d3af060d3d8, 0x0000059bd9832e4f,
+    0x7d8db0560b42b5b8, 0xba17ce6fb0600f48, 0x000015f20d7ddd9b,
+    0x2cbb2ee80433e687, 0x57b4b160b4469372, 0x00001077b9346b74,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_PB_WIN_5_XY[] = {
+    0xa9954667022c7d03, 0x2bd26dc57f48819b, 0x0006ba06fe51464b,
+    0xff09788a66dc3a9e, 0xec065080ca8287aa, 0x00025fbc363582dc,
+    0x41ec576d673c1e22, 0xfa39fdceae24d688, 0x0002433ad82a5db9,
+    0x49a2fc31be6c3e20, 0xa3cbf5ba02d7cec1, 0x0004f6906d92d907,
+    0x041d4e4ac2f3b11a, 0x1cf1f8bedce85ed0, 0x00066db47bb5ec31,
+    0x8d98c516c6fda9fd, 0x01fee096a9036df7, 0x0006e8cf2f9b343a,
+    0xca72f5d5a17c2432, 0xa32e23e8f72fc195, 0x0006603047105718,
+    0x251beae6e1f9a2ee, 0x6cbbd406822d19aa, 0x00015a322f8b2232,
+    0x1fd7139e0c7c04ba, 0xc045233cf2ee64f9, 0x00036d2ab991a07e,
+    0x5f7693d8e2160918, 0x26c619baadcfebe1, 0x0001ef4aae8ccfe3,
+    0x678aad20d463c87b, 0x10bad13b8904d304, 0x0005666468171a06,
+    0x841c8946515479ea, 0xc2cd176c244a83ad, 0x0003e8d806a6a827,
+    0x7202accb6298446c, 0x99af2b7afb677f25, 0x00008b3e555a28be,
+    0xdd766229b7ba38d2, 0x30b6c83fb344dbf0, 0x00037148761f428e,
+    0x8f39df35b383267b, 0x14268d5eb646490b, 0x0007d9b7322561b4,
+    0xa85f1e550168bdd5, 0x02733e3153caa50b, 0x00028eaf9c4eacbb,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_PB_COMB_5_XY[] = {
+    0xa9954667022c7d03, 0x2bd26dc57f48819b, 0x0006ba06fe51464b,
+    0xff09788a66dc3a9e, 0xec065080ca8287aa, 0x00025fbc363582dc,
+    0x3e638697af6c9d8a, 0x28d3d629d79ddb5c, 0x000278a2edc5cb47,
+    0xb3b740731bd9f9b2, 0xa3515f9aa550d12b, 0x00036b97ff9d3dad,
+    0x4478ea694cff7a8e, 0x1d54352765fef3a0, 0x000183498cbcfd4c,
+    0x7cf520ba5e33fdca, 0xc3a044ac5f29bf79, 0x00039d3e95a5102a,
+    0x3fac7b7c3d886c26, 0x5362b231f4d01ebb, 0x0006699a35b7ff68,
+    0x53aad10a18dc123a, 0x2ba07fac63b840d1, 0x0002ee4bc982d238,
+    0x5408f70156c4d295, 0xd98881e1070abbe2, 0x0002e503e756bca5,
+    0xc7838d3d6faf3e87, 0xbe0849a4c769ef34, 0x000042b5716fcc5e,
+    0xf58f19d44dfe6005, 0x95c04dec7dfb4288, 0x0007c187a3a6578e,
+    0xa7359a71a16fe70e, 0xd8037b0a37e28426, 0x00061760cb3329fb,
+    0x6e250d59ee2e0568, 0x3f2ed45a7558352a, 0x0000bc6a93178e92,
+    0xd443508d98785bb3, 0xfafa9536c6295237, 0x0007e143d0140cda,
+    0xdd2400d0034f4e55, 0xb3d5fa7b69458d87, 0x0002c468a634b3e3,
+    0x4afb812a06c8c1d7, 0xac3b0c83f668462b, 0x00046e6ab8c640fa,
+    0xf56ee10c30039a87, 0xc508df2751a3855d, 0x000388ee4767f050,
+    0x288f1cb095792777, 0x0f7cb19f2c151d1e, 0x0005895bd8729842,
+    0xfb0b9a04726423df, 0x26cd59a7ce012d4d, 0x0006dbfe6e864f3f,
+    0x0f41155f8a3d543c, 0x878dbacd218677e1, 0x000506b30b5558f6,
+    0x785bcdcc6c461465, 0x2e1830237f8ffcbb, 0x00069df5d4c81fe5,
+    0x6414298e95b08698, 0x6e95a94c78d5c4e6, 0x000527abec3e1a1f,
+    0xdec5a8ef948d770f, 0x3f62f7f009395ac0, 0x0003cc9463534093,
+    0x31dc223696ec599f, 0x5fafc5c2c8bb07fc, 0x0007915406c791da,
+    0x2f672258d5ff253c, 0x2e9ce2d0a405c57a, 0x000248ef05dcbc09,
+    0x2772447c4f5e20af, 0xfc18c2c098f36d7f, 0x000693a0398ad847,
+    0x96b0901353e84698, 0x4c0aa6af556b4134, 0x000363db97a69cac,
+    0x95c0cfdcf0aa0f85, 0xddc90d04ae91a317, 0x0001df5b21442f31,
+    0xd1f967c267c64f8f, 0xefe5bc4498eec748, 0x0002ade8203cf670,
+    0x68ff059b70413c60, 0xd4c97ae11183779d, 0x00030f859951d881,
+    0xe2e1c40587714b7e, 0xd621bd6a27165917, 0x00033b4e5bca91bc,
+    0xaa698f371d618c98, 0x6aa17ea8b3eeeb59, 0x0004b4d9f17e58f5,
+    0x5bffbc95d4c4fca4, 0x1470e620444b2e2a, 0x0003191b242583b6,
+    0xfa428494684e0b22, 0xf52a30f7abc05d01, 0x00074a62dd0fe778,
+    0xf275e7da504add76, 0x85abcfbcd7d1cc31, 0x000601a13be7548a,
+    0x61ef88966e2d799d, 0x1a7e8d073639a49e, 0x00000f1c84400b87,
+    0x4c7ce7936c015a99, 0x1be0e73f39e3cbce, 0x0002a8f3220e6256,
+    0x58f2471141b8c28f, 0xdcb227d0bbf24f9e, 0x000730e3eb2f2503,
+    0x1bff62b49f254b85, 0x1979c38c394f8540, 0x0007cf72fd685f74,
+    0x71c137c4e590aebe, 0xf326a83b7d94945d, 0x000424a38f71e7a2,
+    0xc02c18c4bb100b1f, 0xbde2bd396020e983, 0x00012ad8d895d34f,
+    0x933482f16fc560ad, 0x98f8a9957c0ec1ba, 0x00029309ce9ec22a,
+    0xee374cecb8e02f2b, 0x3d4f6aae926e49e3, 0x0005311d52bef357,
+    0x2e22abca82361650, 0x1a36d1eeecdd5b1e, 0x0006a4d4d9f54d62,
+    0x4b44e2e7372f132a, 0xbaa27c13ed2db7ba, 0x0004be5a90b6e45b,
+    0x76df9d025d7dedd4, 0x9965aad29f0e03e3, 0x00032368267792a9,
+    0x489c336f2fc9d0b5, 0x60be9c04cd135826, 0x00052607e1b341a6,
+    0x1c16d2899ab57ec8, 0x4ac24a7f15786fb3, 0x0005362ae07d9a97,
+    0x59d263216e5bfcc1, 0xc61ff0166d5db9f4, 0x00005ead84273ff3,
+    0xb330a313c4d2d6b6, 0x3f2d75145516a629, 0x00003a415538837d,
+    0x919b66e739a8545e, 0x2de0db3bdee8cc66, 0x0004e2bd3ccf5591,
+    0x8408cff34c7570a5, 0x4852479a8a2fc26f, 0x0001749711a59063,
+    0x69dcf467eb551be2, 0xd2e3a408769d2b74, 0x0004fa7744f00e2a,
+    0x1665a69416a218f7, 0x75f82e9cca32fede, 0x0002bc774f60d515,
+    0x398688eee78e2607, 0xe4c35d8f5b710432, 0x000470f4ec5c2aa2,
+    0x2ed0ad97d754cc58, 0x0d34b094bdf57326, 0x000322827dfc6635,
+    0x86c1eb6823fad8aa, 0x0bc4b4d61f3b455d, 0x000749f59dd096f4,
+    0xbc0291e416f15704, 0x323021c065d70c0c, 0x0007736ef71208b2,
+    0x7ca17a83b5478e26, 0x270cafcf47bd5ac8, 0x0003443291e47248,
+    0x9f4b043a55e82298, 0x92cfca800446104f, 0x0006888e315bd1ad,
+    0x4d6c6614777791b0, 0xf0ee3b4330cf94f1, 0x00074657dfa52aa8,
+    0xced80c4568f3f716, 0x723b5abe6d0e6858, 0x00008bdbe321aa70,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_PB_WIN_5_XY[] = {
+    0xc2fcfe76daeb7129, 0x7912a6d2ac58b9b5, 0x714114b762f2ff4a,
+    0x9613cd8d03db08da, 0xefe5902f11db96fa, 0x29c41e568b77c617,
+    0x8a464601c5a51ce7, 0x2d251ade41e6a80c, 0x113d419631c6ceed,
+    0xca2b7746c30b6cb0, 0xa83d83e42d67e0f5, 0x3ed0d52c1c402a2b,
+    0x2af97a46a01661e9, 0x0de9fcdccf49c847, 0x43e6857567b825c2,
+    0x1e45642b435b2bba, 0x3b620876088dd767, 0x5e2bdc9d5e48a66b,
+    0x67517f94e57571e5, 0xa2f002c7ef984b36, 0x7c0062351576385b,
+    0x0f30a0cd8f60da8f, 0x7d37314723e44502, 0x7ea26540824f1a63,
+    0xcc16d92dc72bef23, 0x909398fb235cb2fc, 0x034e78c08bf3a03f,
+    0xa3d20caef65d4961, 0xdb201845ce80a07a, 0x468fe3d3b20d4c5f,
+    0xc9ed31f6bb85400b, 0x3d7b2d09dc892295, 0x7443b604d2b9f9f9,
+    0xf9fb6c96edb5017b, 0xb31bc4e1719abb19, 0x63af220740540aac,
+    0x533279e76379c955, 0xc5a4e968b58f7ec0, 0x0b48fc325879312a,
+    0xa2bc07d47565aa25, 0x7f4a841b76545a30, 0x0ea2a22c97cde840,
+    0x29c58fa919ac09d1, 0xeba67f33f43be4cf, 0x7683defe7cebd22a,
+    0x299fc4cf73dccf74, 0xfd402c43c2ec5264, 0x00e8875fc1a4e8e5,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_PB_COMB_5_XY[] = {
+    0xc2fcfe76daeb7129, 0x7912a6d2ac58b9b5, 0x714114b762f2ff4a,
+    0x9613cd8d03db08da, 0xefe5902f11db96fa, 0x29c41e568b77c617,
+    0x047154bbfc596931, 0x106a86b3b89ceb4b, 0x5c2e33c04ed45376,
+    0x87e41ce395fdc08e, 0xe1f86555b35aa322, 0x593c973a35ede100,
+    0x781b601fe9a1eca9, 0x6ec8cc9719773706, 0x32290d2750d084d8,
+    0x5383fe04dbf997cc, 0x085e5e7e4ccf81a1, 0x5745a75d8de6ebbd,
+    0x7fecae226c34f2e1, 0x9dd84ce2f285600a, 0x5f07e1203a0e7402,
+    0xc56adb0a68e7350e, 0x9ff39f0467058b7a, 0x2422dbdfc45346b9,
+    0x116419c04f883199, 0xb94565caf9a7beec, 0x62f269076cdd5470,
+    0x650d82e39cf7ee2a, 0x02c18cfb3c1f82a5, 0x6aa03b57b01f38d1,
+    0x2bfcc8fadb76fb6f, 0x5b4c2547d9936388, 0x30f8fd7188941a88,
+    0x9feec384a3363ade, 0xa896dc27755c7b37, 0x56cf27837bfbf9f2,
+    0x1bad48787916da4b, 0x469dfd5007ba53da, 0x5f07a2e8140507e4,
+    0x614263d1e58be4d3, 0x60a0372b8d7b81fc, 0x4586b1e22aad1619,
+    0xafa2cde89bec82a7, 0xf41bbfbb70d88780, 0x766bfcc169827322,
+    0x981f8b01b0cf5ae6, 0xd0d746281540849b, 0x5ba5e105a4c54025,
+    0xde54484efd3ec4d7, 0x1d938364985a432a, 0x69d173594507b10b,
+    0x15cf213e92d1141b, 0xe6a20fb3d239166f, 0x2e8924c3c6192f1f,
+    0x5939f426ba209b4d, 0xc2c7312e3d9dc8ec, 0x29977887c14ff90a,
+    0x0f8b885352efb07a, 0x9488deb0d13198c8, 0x4104c45f8f16b406,
+    0xa69a5e4d34c442a5, 0xecd6cbbad10a32e4, 0x7a16aa6f464179fa,
+    0x1e246e41281f4287, 0x91296ba78fc21479, 0x24cd13e57ab08700,
+    0xdd4e1250710f14c1, 0x5048470e940396f4, 0x16a959a8405442c2,
+    0x895b0a81ce375cce, 0x4da3021b6332380c, 0x00aa36b5daf71c51,
+    0xb1e7803cfd3f4219, 0x409f8d4461de83ec, 0x1ae6d540b2d37fba,
+    0x41d79679a7ed933a, 0x47e7706902b2ecaf, 0x23850f301a71e809,
+    0xfecc2d028df7a3e5, 0x169a091e6f2d1bfb, 0x41494894a3c3d266,
+    0xe04045d807cb6fba, 0x8f1a4d2d073f48eb, 0x0a810f7ffd856911,
+    0x51a8a55012a59c53, 0x48f04e954b0ecb7c, 0x2b464e103440cdc9,
+    0xc88530a213444958, 0x73e240acc5abe418, 0x0b41554b73a8d5e3,
+    0x6a87e650b2953c1b, 0xf15af901a8c761d0, 0x04c33b3baf62f37d,
+    0x756b145bfce2b2cb, 0x30ae6bb0fd43cf4c, 0x7c8fd2ed7a69ce6d,
+    0x35ed84e9a4ea5321, 0xdac8c7106f19709a, 0x02c395f2de261862,
+    0xa22269729b3b95b8, 0xb473d8b710a83305, 0x47de96371099fb0e,
+    0xc752257410be1e51, 0x982a034ffa1260b8, 0x166421ff479f956d,
+    0x1e3f13298283627d, 0x5acf650a49621109, 0x5803873a7590efc6,
+    0xa060479d7d68cd11, 0xbd7a83abde215e86, 0x7bf601e2117cf08b,
+    0x397ef144b50a55c6, 0x8689a9a75f415b8f, 0x6dca8146dadc6d57,
+    0xaff08a85d4a30881, 0x0e0e49bc016e883a, 0x6de5a8b50b2708ec,
+    0x8fba47c76b1850d1, 0x5ab4a84dd3cd9739, 0x313bf6a84e87fd82,
+    0xb19db456f2415fcd, 0xb3ce235610ea2a18, 0x6a6653aad3893fa3,
+    0x74c2266b19e5cc8a, 0x38ab42e0d55ab2ea, 0x66aab39285feeba4,
+    0xdf04b3bb7ee36595, 0xf482f281cb2c6c6a, 0x128bae917010a28d,
+    0xc746ec8902877812, 0xf90056328421f640, 0x4f2fa57274843ee2,
+    0xc92f87153bd72699, 0xe579364350cc3f26, 0x3b5b255634b0babd,
+    0x455a65fb74c73533, 0x4db473234f529d48, 0x017a0668ddb9d165,
+    0xdf59a6bf74629555, 0x07b16a1cd9ba2e2e, 0x600e55e986417ee2,
+    0x6d36de947256d7a4, 0x504bc01cc61065f9, 0x448251a6de8391df,
+    0xd32003c88a986557, 0xe27fa5a7c82355b1, 0x409c5746aaec214c,
+    0xae185a36feaa0ea2, 0x267419c045501f90, 0x28aa872992ea5590,
+    0xc0f0027c9758e41f, 0x1dff0f650672cbdb, 0x47b9af2043984fc7,
+    0x59130852fbd798bb, 0x72d5e35617bc2f32, 0x3b11c24eed976351,
+    0xcdff261c6be95f79, 0x1d77ccf739599784, 0x7ba7318055564a3e,
+    0xd42736a879574f60, 0x5873ba4b01bf1641, 0x1030a47094743fde,
+    0xfde33bb52e502859, 0x4dc852d2002e907b, 0x658d13f500c867fb,
+    0xdb0f5d25e7644a68, 0xe0204c7ac444b2a2, 0x5727a02b1088b62b,
+    0x2f7e8817020be8fd, 0xd00884b7ce80d129, 0x3afe54edfb93a7f3,
+    0x5ca2582821c54021, 0x67b3489c6670d7a1, 0x6ee64325d109fb34,
+    0xced0fd63d3568f63, 0x67d805b130f7a5d8, 0x345e305028048aef,
+    0x74a0f835de3ed34e, 0x40d2383c51219c3e, 0x5d2e79826d15c021,
+    0x9f3febe848be56fb, 0x4e4b6d8bcbe1c56f, 0x5ff8fe2db2bfdb66,
+    0x58af986108f33f29, 0x99913b8bffa1ba5d, 0x683c0def6ce477b4,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_PB_WIN_5_XY[] = {
+    0x28d003eeb25efe96, 0x3c31761d3545f327, 0xcdf83ba1118df35b, 0x0000003fcda526b6,
+    0x32be0b9df96d8d35, 0xbad95e3b2e91c54d, 0x4c54deeda9e54a7b, 0x0000009ca8b57a93,
+    0x832c388daab0634c, 0xe8b346c757cd3c52, 0x9742a95d63788c1d, 0x000001e5a0430b75,
+    0xd4a04812f79540d3, 0x94491daecd297efd, 0x462e9424ff95539d, 0x000000cf3d46736c,
+    0x1207315166f73a35, 0x4752b2e9e5931902, 0x13f3a9bfcc7e5f98, 0x000000db4f8ff274,
+    0x46e1d7a3bac49936, 0x1a85b19ec348a242, 0xcc60196dfd6ea62e, 0x0000008337597cb1,
+    0x6b4f61adcbed0070, 0xc2ef5b7f7400f046, 0x44e45f584d26f46c, 0x000001a9a2f4ffd6,
+    0x2cfaff00a06e1342, 0xf454e74e23ad8dd2, 0xfcec67575e20c3b1, 0x00000131c27f4622,
+    0x3710ca5ef61628b0, 0xfc3fe2180316b596, 0xa1d9acb407cb4c7f, 0x0000012eded1b835,
+    0xb0fab5048bce079f, 0xb9b3ced34f5a7c4e, 0x37fe4a5a472fc717, 0x000000cb4e33bf44,
+    0x63d019f97b050c5e, 0xb82fac62c0a7388a, 0xd8d595bdf3ea2e12, 0x0000002e1a64a6ce,
+    0x22ce479278f03412, 0xb32ea134fe90e853, 0x1b0a7aa071ca8993, 0x000000db3f9bcd94,
+    0xb3dfcfc5d7f65632, 0x168b4b0ed092a83b, 0xbf7943cfd61b2e9e, 0x000001a9293d2afa,
+    0x4935edf549d4f085, 0xc122acddc483f72d, 0xe109a0993d734781, 0x000000817dfd4f15,
+    0x9a73e74cd8546dad, 0x249c9bac5198ccf0, 0x8db6c84db08480d3, 0x00000010a8bc1197,
+    0x2b8d2aef530e695c, 0xadb88e19cb6f60fd, 0x7902621aebb63485, 0x000000114bf69de3,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_PB_COMB_5_XY[] = {
+    0x28d003eeb25efe96, 0x3c31761d3545f327, 0xcdf83ba1118df35b, 0x0000003fcda526b6,
+    0x32be0b9df96d8d35, 0xbad95e3b2e91c54d, 0x4c54deeda9e54a7b, 0x0000009ca8b57a93,
+    0xfcb96dd1f03b06c0, 0xca30be02d3c1ef8c, 0xb1d9c3c7e9bc6456, 0x000000a33d0080aa,
+    0xb82a8fe8414380ac, 0xe7579221c6ba682c, 0x24bc9b399b99a58c, 0x000001da131a001f,
+    0xdbada480937a062e, 0xc9ef34fd7e9cce92, 0x0ca11f76f9b3ccb2, 0x00000077eb36ea12,
+    0xc82e30e9dd5e3c56, 0x13e6d5dbd1c76f9d, 0x43c9782e553a63d2, 0x000001c45d7f23c6,
+    0xd69747cfd6843c5a, 0xd07ca9d923e8d20e, 0x99713d67b75e54aa, 0x0000013cffeaf9a0,
+    0xa3139f8d33c7d7d1, 0x9c66d1b8f68da5a9, 0x8850f0eb482e946a, 0x0000010bcc09b185,
+    0xad96d51be676c8b7, 0x17a94834a7d9121b, 0xa3aaf608fd011866, 0x00000085023f7c57,
+    0x2c2d206d06e67872, 0xbba45f954d554437, 0xc3e3a46d7b5bfa3f, 0x000001b2208571c4,
+    0xab4dd2d247b46362, 0x5479271dd1a3d537, 0x34d1e3c1b4aa12b7, 0x000001fbb7c4c911,
+    0x1e9ee4c580b3fc72, 0x2df0b0882cf620d9, 0xae1ab9f7cd4993de, 0x0000003c215b8fd8,
+    0xec1a7ae374b18473, 0x3e6a969dd6e1701e, 0x907a568d13c9512b, 0x000000c4bce26172,
+    0xd973b7946d72e8f3, 0x4b197e15cd90e92c, 0x72100b2bc818ea49, 0x000001953fbd8ebb,
+    0x2fe9631609abb749, 0xaa227d4d158a88ac, 0x179e990892054f55, 0x0000008dfc81fa4d,
+    0x22f811b1a1a477b9, 0x1407417d5d338a0c, 0x63328719ec924e4b, 0x00000104192b0743,
+    0x2cce4c10c2b94af6, 0xa195ea4bb4e3b041, 0x116db6831ad7a3ec, 0x00000128b08940d5,
+    0x17776e09240978e6, 0xc6d018fa44475b69, 0x738ad918057a427e, 0x000000ab42a1cf93,
+    0x6b273c1a40c4335a, 0x1838a172e53c2d7e, 0x692bceb9957095be, 0x000000790f3e4096,
+    0xcf3bc698a7b6379c, 0x4a6b6b5c216ab536, 0xd9b871bdde1a10da, 0x00000085c9161660,
+    0x63285c16f330d41c, 0x4be9747d1f6c647e, 0xcdcc38a01e888006, 0x000001b7793c5709,
+    0x444d8e0b850243bb, 0xcb08bf9649479b16, 0xfbdb557f3fd58cbb, 0x00000136898474fe,
+    0x77a1e1b11188103d, 0x598fd52f6864aea5, 0x1d391487c486670a, 0x000001882341df92,
+    0xfab0501b91d9a80b, 0x67d9a2f8e96a7779, 0x0a43e40cd66e1d27, 0x0000013dbe0d68f1,
+    0xcfc3612a39df7dc1, 0x267e3cd23682ee49, 0x4af5eaae70781f18, 0x0000001feb0c2768,
+    0x4c61c2d7d4ddb1ea, 0x6e4cd7dd338298e2, 0x547df6aa32118faa, 0x0000018f1af7dd87,
+    0xe9460665c9672b33, 0x4be4f7795dd701c8, 0xcc3fac7d02609a67, 0x0000000d2a49034f,
+    0x59b6f8578c85dd52, 0x2f52188b2ad37f78, 0x52f976e046b35fda, 0x000001b60525e254,
+    0xc50634768693491b, 0x82fd44972eaa425f, 0x8bb058c3841bfab2, 0x000001460a177320,
+    0xbc1d320fe026ea03, 0x071d937cf23b65dd, 0xfd6d3ae0986d19cb, 0x000001e30568f614,
+    0x332c6b125dda1833, 0x5569ccf9a211741d, 0xb4759471bfabd61e, 0x0000005dd8c50766,
+    0x31b64ef2d7278494, 0x877eee03c0e79443, 0x1662e7266b2309a5, 0x000000365298897c,
+    0x0ce280053a50d1e7, 0x2b7bd1ad884d9f0c, 0xb6c3cf6fab35649b, 0x0000019c7848e21b,
+    0x45ef02edf753420a, 0x68b9723a317bc106, 0x35a285733fa70317, 0x0000000fb128e8cb,
+    0xd8a44c42b3a8a8bd, 0x48711c952b077386, 0xc8c049bb2c4dab32, 0x0000018da6f2a89e,
+    0x424055d9997111b8, 0x44ff6076216c1826, 0xd0cd5d6c8a4a83e8, 0x0000014072ec4d13,
+    0x0062120e41212cf3, 0x97d0b91ed3a0f64b, 0xe0995e0ebff37e45, 0x0000010e3a5f0c37,
+    0x03c03643bbab21ce, 0xcc90638dd9cc1191, 0xa5864a0a304905f0, 0x000000a3c65c6b86,
+    0x5167fb86d4a7d885, 0x65a9dbaf554e0b57, 0x744301ae0cc7bfcb, 0x000001913fc8a2f9,
+    0xa31b1f4e5376c0f3, 0xbc5ce12fc5bd1846, 0x5266158d87a6eeb7, 0x000000c72edfd725,
+    0x4b9773cf062f6c80, 0x6426691bd9743190, 0x06ca70dec8624bd6, 0x000000ff7b183310,
+    0x620a9bb82c637999, 0xab88d6d559691ee8, 0xa4f685fed3ea6319, 0x000001bd8502bff9,
+    0x5b10da9ddd0ac7d5, 0xfcc7141ea0a994cb, 0x6dd6d64dad2e13b2, 0x0000001f524401d7,
+    0x965e991498677690, 0x0ee4a10d9a6f7b20, 0xb19cfd8e38b7c681, 0x0000013966e1295a,
+    0x33ad2fa5707f4499, 0xbdf7f422433364a1, 0x515779b606bbb46b, 0x00000097327f223c,
+    0xc811b9fc1c2ff542, 0x4e7370f6fdd08805, 0xa9920932f656b268, 0x000000068117153d,
+    0xcd7ae3b05a2b6093, 0xf2452497467c9bef, 0x6a11dc7fcbda3fc9, 0x00000058f603e1d6,
+    0x292d4cdb52e49456, 0x965acf9e5f3a2f74, 0x970eb12f93806519, 0x000000a991fbd9af,
+    0xf830f67effb6f6a8, 0x0eb1d24ead10cb51, 0xbdc046e25d7ce109, 0x00000021541c29a7,
+    0x4a011f6652e9aca7, 0x43bb671072a09a61, 0xdad69e89756c5c96, 0x000001b581a7a186,
+    0xb37d8570d79c5a73, 0x074fc7ce0fc5e607, 0xe6ca74ae41e15fa7, 0x0000010e772b9232,
+    0x9e0ae4b3593fcf15, 0x4169031585b31bea, 0x5286878a0d67528c, 0x0000010a589089a3,
+    0x0378ab779980d027, 0x99f9e7c8db287965, 0x279a344626431336, 0x000001c20e5d2749,
+    0xd656417969254a12, 0x17f02cd4eab925e4, 0x5570e7cc429f6a15, 0x00000145c79f1977,
+    0x2cc48fca1a34337b, 0x77a02824de220d89, 0x46b9ee3c5c829e9f, 0x000001c6df147cdc,
+    0x1748ed16ad35cbc6, 0xc91fa896aad49c97, 0x3de77dd18a99bb32, 0x000000da27ce99bb,
+    0x8c68cbd1f7bb73bc, 0x84688cdd6e46282d, 0x7ff28dcbe21afcc5, 0x0000016687524e5f,
+    0x0e49a9e6cb7a8d66, 0x8bdf2b31e575fcdf, 0xf66ff42c8053241e, 0x000001b797b881b4,
+    0x696d1074515c08f9, 0xe978c36f4a85ebf9, 0x05823dca60dd6a96, 0x0000010cf23b20be,
+    0xf655b031269f8791, 0xc4f9002db16d9227, 0xa1e0f80d4d8938c4, 0x00000148bdb9ae22,
+    0xcfb40f8e7288e5f1, 0xdac3594b6f6ff2f9, 0x7e3b4921819e1374, 0x0000015a60333073,
+    0xb5f694becaf2ad25, 0xd98eecf213532d33, 0xa3d46e6721954e73, 0x000000f65838801f,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M257_PB_WIN_5_XY[] = {
+    0x34a9e8dcd8d20fb7, 0x7ac491ca1b10c623, 0x55cd260b306c7e00, 0x2a29ef207d0e9b6c, 0x0000000000000000,
+    0x8b702cf156d814ef, 0xe6812c93a9d60b97, 0x9fccf6d8eea03102, 0x0686d41ff744d444, 0x0000000000000001,
+    0x636abaa59bc4b6b2, 0xa3759c1c2438a1d4, 0x77714b57bf7533fa, 0xe18f95137669d9a5, 0x0000000000000001,
+    0xadf72463d81d91ce, 0x3b468eb8368cf2c1, 0x9e1038befa25964a, 0x23fed09ebc3d5710, 0x0000000000000001,
+    0x964abf3d510f8ba5, 0x518a2fe9d3699eee, 0x7397f97015040b42, 0xc9e491065372a057, 0x0000000000000000,
+    0x6e44c4b99ea00d6f, 0xe3c98e07679f7268, 0x9939c6d628ccd863, 0x430dcd97e5c19f23, 0x0000000000000000,
+    0xdf72e8de6cbe1621, 0x23e20b7134269335, 0x58066ff2c2fdcda0, 0x5cf66278e56bf815, 0x0000000000000001,
+    0xdeba5340372342b1, 0xb7314a4ca4bcaccb, 0x31459f1f63c41451, 0x0c8b810c8af2f17a, 0x0000000000000001,
+    0xd191a485ba540f06, 0x8fa6f559579415f3, 0x49b1f8be0b107a27, 0x6acfc38d54054768, 0x0000000000000000,
+    0x9d8a2ce339ce932d, 0x3bca870a50af52a7, 0x47e32778e0fa7f53, 0x43f7adc212536b7e, 0x0000000000000001,
+    0xafda7ab174a43329, 0xbba66d01939327fa, 0xb6a523c279dac26e, 0xe972c3c4ddf7473b, 0x0000000000000001,
+    0x439208e40a2133b7, 0x9bd831a5591ae564, 0x8d2c4561dc6a7198, 0x44249a1630170276, 0x0000000000000001,
+    0x31a0d8e5ccf7bc51, 0xe93bc3ee771fbf29, 0x441b782bdb719a98, 0x1aa8eeb77f56bbf6, 0x0000000000000000,
+    0x44f923dabc3f3b1d, 0x85d3c9ae7effa03d, 0x0d6a8f0718c7599d, 0xec16810eda1e2b57, 0x0000000000000000,
+    0x8173590dc8add4c2, 0x7323d4a612db1bed, 0x1657509d7aba837f, 0xb38537a8e4844d2b, 0x0000000000000001,
+    0x9e56f444960ad37b, 0x2ee846ea27b63a05, 0x97c7986b770dc90f, 0xae948562c26367d9, 0x0000000000000001,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M257_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M257_PB_COMB_5_XY[] = {
+    0x34a9e8dcd8d20fb7, 0x7ac491ca1b10c623, 0x55cd260b306c7e00, 0x2a29ef207d0e9b6c, 0x0000000000000000,
+    0x8b702cf156d814ef, 0xe6812c93a9d60b97, 0x9fccf6d8eea03102, 0x0686d41ff744d444, 0x0000000000000001,
+    0xc0d937df182d8894, 0x71b29ae18f15092f, 0x854e557901af3a2b, 0xc658f5bf834c0b69, 0x0000000000000001,
+    0x1d1b4bbf69aa1050, 0xba7eadfc231bec88, 0xd20727e8b4edc87a, 0x7b1a9fe766ff159d, 0x0000000000000001,
+    0x914fd763f7b7b564, 0x6cfe94a950fa4ec9, 0xd6ff570eec3772e1, 0xa44b156b05830811, 0x0000000000000000,
+    0xbdff0eb9bd8c819c, 0xbcfa2265a5e54baa, 0x9e76ae9ed5b7b186, 0x027d7a9a4dced01f, 0x0000000000000000,
+    0xd2175ebb6fc97a90, 0xd0d8d930aaaba843, 0xc24e4718ed79a7e4, 0xe54bc368bde22484, 0x0000000000000001,
+    0xd836327933e34595, 0x941ef341b8bd69ee, 0x1ad0fcdc42734e91, 0x82c001bc52b51319, 0x0000000000000000,
+    0x0d7839c34864fd5c, 0x922f2ebce6dcab9d, 0x162297db3b9dd887, 0x5cd4c2ddf291a183, 0x0000000000000001,
+    0xb97319fd88015ccd, 0x5909f64b9815e8c3, 0x0e2e381f4f54e4db, 0xd35b2e82e2994cc5, 0x0000000000000000,
+    0x917a925f053e3611, 0xd276ede140a7da92, 0x6c95decc37d6c427, 0xc463a2fc227f0d31, 0x0000000000000001,
+    0x1a73468555d9a746, 0x5f3d3b734d3910b4, 0x7a600d57f67563ad, 0x392df7205bb9975c, 0x0000000000000000,
+    0x0f406b169de285d9, 0x67f843bf18b14b2a, 0x4c4789975bb70ba1, 0x1723b30cbd18839c, 0x0000000000000001,
+    0x4c4c177a4021cce2, 0xcef4e852aba5770e, 0x21ba609ccb8dc7b4, 0xfe597f38889f11cc, 0x0000000000000000,
+    0x2741ec32bf636dce, 0x6473a08cbdb7326c, 0x44434b5c8beb58c9, 0x6113a97932c41d04, 0x0000000000000001,
+    0x1d6a3f62b2fc1f84, 0xb6b68e6921f99129, 0xf24098511266541d, 0x1c722f0b07735159, 0x0000000000000001,
+    0x147c9285599d6add, 0x943f664cac0193c3, 0xdc86f264b1d4570f, 0x9f762aaf8cbef774, 0x0000000000000001,
+    0x76b8fccc494cd6ee, 0x0217a01f809f8ce0, 0xabfab8a86484b305, 0x7cc8ae87acb8c78d, 0x0000000000000001,
+    0x402a44bd5869a04b, 0xe559335a6e0e4326, 0x7cf3cd81d74904c3, 0x89b1ce52c47831eb, 0x0000000000000000,
+    0x2c0f21716271c959, 0xe4353a34129b7950, 0x664fd77e0b429523, 0x5b9380f9162b14e4, 0x0000000000000000,
+    0x8da1130d78cb5066, 0x324a40d6b294e223, 0xdfc090d7a000d9de, 0xbfccc1d99aed69cc, 0x0000000000000000,
+    0xbaa9e27a03570ced, 0x2493e1e4d6dea516, 0xb6f61eafd125dc9e, 0xade74b574e61ba86, 0x0000000000000001,
+    0x76a36a59a2841a9a, 0xb209e0e55a14f3c1, 0xda4917d75334a514, 0x468d67f69c8abdd1, 0x0000000000000001,
+    0x1907a4e70eb9ba4b, 0xe0a4cec2907117b3, 0xd87b6cf791b0c7da, 0xf51f493348e00efc, 0x0000000000000001,
+    0x28e86e1c204a0409, 0x7e0f0d191b3eab63, 0xbe9316cde49edcb5, 0xc2b49dee520a815b, 0x0000000000000001,
+    0xd6a40c2e294c0c4a, 0xa6fa1560df5ad6dc, 0x0154394b9405de88, 0x78e3a02e20994970, 0x0000000000000000,
+    0x352498ac6b3e400e, 0x58eda8e44a4893b8, 0x8472437be8a4e853, 0xed9646e89a307f34, 0x0000000000000000,
+    0xa3f7ee8e3fbcc090, 0xc90ed7cce0ef0e14, 0x92685934d50d88c8, 0x31809f554141644f, 0x0000000000000001,
+    0x0b03be7b2d5c56d7, 0x175c90588caf847e, 0x36803a70788614c4, 0x2a7046d9d4513016, 0x0000000000000001,
+    0x571a96bbc284d498, 0x293f899fc8498316, 0x152faa7d325b38ea, 0xec6fb7cff22d1541, 0x0000000000000001,
+    0xfed5d20d85e7ed97, 0xc85d96773e1fe7c7, 0x5f76cb37434b8a88, 0xa1e3db1613121b8e, 0x0000000000000001,
+    0x0255f86c88730d3c, 0x0dc7359a361713cf, 0xf3baeae850e876d7, 0x2a4fa08b52942ccc, 0x0000000000000001,
+    0x0c2c6f4a10625458, 0x8b3e2ebffa807140, 0x4a31edead26a5acb, 0x3d885ee512120ad1, 0x0000000000000001,
+    0xd8719111c474c0f9, 0x41c8b6a0f4cfcb7d, 0x439d57fdd1394444, 0x2dfe5a3fe5ab46a5, 0x0000000000000001,
+    0x8b8a2146865e8d16, 0x777f31837985447d, 0x630eab4c711ae5d8, 0x510b2474b83e4746, 0x0000000000000001,
+    0x934ad5417c1047e4, 0x622b70f787b5c6d4, 0x83e2ac9462460a59, 0xcef9f50cd182b1d8, 0x0000000000000000,
+    0x9592490c19ba7fbb, 0x4ad847021e56b4ff, 0x13b918ec2dd3beaf, 0x14ea3fb2f92183f2, 0x0000000000000000,
+    0x9e239aa10b333788, 0x7c0d030c2f659d13, 0x0471148b3ec33c4f, 0xfc493159f820522a, 0x0000000000000000,
+    0x0e4fa8f0e7b9d380, 0xf76e59fe3b816e26, 0xf048dc187d7b4422, 0xb6d1584a249c7977, 0x0000000000000001,
+    0xb8d3b9932561a966, 0x06b67272a260f52d, 0xc19dba99a5ca6e9c, 0x34ee6db88dee6a58, 0x0000000000000000,
+    0x0b45088a1bedd5d2, 0x6a2ce6ef595d00f2, 0x4a1c5e31685aa8d3, 0xa1cdfda61e6014f7, 0x0000000000000001,
+    0x75e566465e7209d1, 0x223c0a9bed7a496b, 0xd1d1f3530f1da9e7, 0x8d29706ae4059276, 0x0000000000000001,
+    0x082ad854c473dea1, 0x9b60e95f1383d7d3, 0x3f8ad58909831add, 0x70ba30e817b77003, 0x0000000000000000,
+    0xa4a2f5a4a3525182, 0xdbf14e583af1c38e, 0x1c87f2dcde42779f, 0xa6e9a479bd205417, 0x0000000000000000,
+    0x24e14ef448424164, 0x9bfad6ffc6c8cf47, 0x8a719c2852e02ed5, 0xfa541d71a12a46a5, 0x0000000000000000,
+    0xb4d12780ab12f0d4, 0x345db6fb701dcde3, 0xf75b5d67877e1b97, 0x1309ef530b19ceca, 0x0000000000000000,
+    0xf61c8124c363d353, 0x23e3f6f7c8381b2e, 0x76b21cf3d5a38b5f, 0xf0290e25b066ef71, 0x0000000000000001,
+    0x21908a4e03d3c551, 0xa49de3675a5870f6, 0x409d3e9986528827, 0x0d48c5f66aacb01a, 0x0000000000000000,
+    0x573e82ce2e7e87ef, 0x2987da26f9db3938, 0xa454b2fe75f70814, 0x70bcfa192c5e4683, 0x0000000000000001,
+    0xc52eabf14a2aa777, 0x17d4db62ffed2808, 0x830b037d1f6fc22d, 0xea99aac0c913fc45, 0x0000000000000000,
+    0xd343b122cb81e873, 0xd835553833ff5cba, 0x476c3a4fcae4a560, 0xc336cf130198ca03, 0x0000000000000001,
+    0x13aeb308dcb9e42b, 0xbdb4ded60c1b47ca, 0x71f3042002601a61, 0x3c3ae9f18e3006d3, 0x0000000000000000,
+    0xdc59d30f82d059f6, 0x33985bcba2818937, 0x58291938d61e962c, 0x125e7fd4bfe59a6b, 0x0000000000000001,
+    0xc2487a8f6b15dba2, 0xccbc06313f6fb162, 0x7c5feb93e8f815be, 0x0271ba67a261c39a, 0x0000000000000001,
+    0x41f8d88cf64470e0, 0xaa5d0bbea7b1385d, 0x962aca4468dd73f9, 0xabc1b672f067afcf, 0x0000000000000000,
+    0xeceafba699f7e28f, 0x5c4782a4e29af424, 0xb917f4c26d173659, 0xc9c74a693f1770d8, 0x0000000000000001,
+    0xca655f51bc79f82d, 0xd25e2f8f2701712d, 0x294dcfe3dd05fa44, 0x363f502566dcb889, 0x0000000000000001,
+    0x664efa055ccede0c, 0x49d3c5bdf9df907a, 0x5d436d5ada54ddcc, 0x6268de609931e80e, 0x0000000000000001,
+    0xdf7ea3d1f65f6088, 0x3ff3e9affc57af54, 0x2d32aa53e485a272, 0xbd526e3f1622e013, 0x0000000000000001,
+    0xbff0ed2a11f347f7, 0x95a857c045e3c94e, 0xa48d0c3b99e15b06, 0xdccd9bd75413932b, 0x0000000000000000,
+    0xce6076943f38fc4c, 0x03f66fa7715ac667, 0x0137bb2a92f16801, 0x7695ed264ef3e001, 0x0000000000000001,
+    0x4dd708a2e6fad6cd, 0x002f446c475bd894, 0x2ab0851cf755e955, 0xdadf2163e378f280, 0x0000000000000001,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M257_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M307_PB_WIN_5_XY[] = {
+    0x3c52c02d6e7232aa, 0x7a239b276d316774, 0xd16bf75ccd825a08, 0x1a0224984c1e92f1, 0x000216ee8b189d29,
+    0x8340ab2237c7f2a0, 0xf2f2dc9a11c7f7be, 0x2866c5d1677762a8, 0x7faeb09d2e049c6e, 0x0005d9306bacd22b,
+    0x07175d982b5d05d3, 0x1ad22d3e474c3e8b, 0xa1aed02c8b9d610c, 0xcc82d3ce11075fb5, 0x000089d22501dd4c,
+    0x601bfdef2a944103, 0x32e77ef7344f9713, 0xa3f2c5663bdf8696, 0x08df320a6a59d8bc, 0x000060ec9ed9dbf1,
+    0x25849b757c1106fe, 0x4b64e9395ceb4f36, 0x9a6a786a6c264b89, 0x1ba17aec74769bc9, 0x00050f3239a20c10,
+    0xc60f161b1bf281f7, 0xd7d0e01a9d934f10, 0x7b49802f55ba38bd, 0x77fbe895dd4dcf40, 0x0005ac9e3077baa3,
+    0x4695323e301f78fd, 0x91741fde4514fe76, 0xf4c6a97685aec7cc, 0xef9d1675dea223a5, 0x000758a34624e795,
+    0xabd3632314118c9a, 0x101d4f03531d9d8a, 0xa290d5efec44ebda, 0xb7530c0d4a8a878b, 0x00008bebb1917e95,
+    0xf2ec8b0504687d2d, 0x88ee87f467f4ff92, 0xd472ca4a830b55a4, 0xa68bccf06cbd1273, 0x0005888e2f57dd6f,
+    0x3a39905cb8c4926a, 0x0955b1e377576538, 0x489b36fd94fd0d75, 0xf5590ffb7b743af6, 0x00056b062c4963ef,
+    0x9bdffcb8ba91296e, 0xba520f0d86e25a15, 0x3f601242f46b9f09, 0x800274d660fc15fe, 0x00062092995ac97d,
+    0xde33d4b58b4716ae, 0x269a58e1675d15d5, 0x7e1d52e44e4d45c1, 0xf65ecaf0528119a6, 0x000208b9b29d7f5d,
+    0xc49454ca134281e5, 0xc1f4720dd31cf4af, 0x0524b2df7efd7792, 0x2595ccea058af7c1, 0x0002d60ebc436a37,
+    0xce11adeb2acb1bd7, 0x478e369f120b6dd8, 0x2ad20b3e17bb88d7, 0x1c62c4227cc6d3c2, 0x00041850c0d4b932,
+    0x415207579c76435f, 0x21fd9ad71f2f2c7e, 0x85a1b99ae3410aea, 0x9643bf9911282e04, 0x0007781a4b992d63,
+    0x3dab804c4c2377a0, 0x05948b7751c3d503, 0x57fc32e6741e1e12, 0xa6b77d682f3621cd, 0x0001144d70590bc2,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M307_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M307_PB_COMB_5_XY[] = {
+    0x3c52c02d6e7232aa, 0x7a239b276d316774, 0xd16bf75ccd825a08, 0x1a0224984c1e92f1, 0x000216ee8b189d29,
+    0x8340ab2237c7f2a0, 0xf2f2dc9a11c7f7be, 0x2866c5d1677762a8, 0x7faeb09d2e049c6e, 0x0005d9306bacd22b,
+    0xff969a26b2199cd7, 0x86ac9ff2144f35de, 0xf09c99d30375621e, 0xe184a5bdb045a121, 0x0002593f98852643,
+    0xb833c1ddfb535bfa, 0xc88fe984f5a4785d, 0xa0b95e8643238447, 0xa4d1062cc7a90fcb, 0x0003faa08a5a8857,
+    0x3e1582d8fc5b6b88, 0x111f4416a28c599e, 0xaf3ff907752b2777, 0xb6e725c25276e45f, 0x0006af8fc34b69cd,
+    0xc67fa401cc2cf189, 0x3510982c4115c614, 0x6a24996ecf957f01, 0x72359ea6b92502f3, 0x00062ccc306f829f,
+    0x4c5f99a91aa3bb7d, 0x6ec9e38cb3e3d20b, 0x6016142fb7503d1b, 0x7acc958d503e429b, 0x0006381c592315a6,
+    0xb225f52ee8d829fe, 0x028a68732e21fb99, 0x0f62449817cbe332, 0xd805b65b1221bb5d, 0x00005f7a4a83f566,
+    0xf19f22906a50bd91, 0xbc3c9193d4d61bd3, 0xfd384e99f0778ed1, 0x50a98e374b29713f, 0x00076eb985dd5859,
+    0x8e3d9424e9181a42, 0xf9c15af2954977c1, 0x88e2a3ea77bc69fb, 0x74c9b95477cff390, 0x0001cd19c9ec8eef,
+    0x4fd881430734d6f7, 0xb255a9bac87f3e92, 0xaff997bc71a7ac08, 0xb58fad4f5ff28ce5, 0x000046451e0bea71,
+    0xb16547ff691c0d06, 0x3faf36f0313c858e, 0x9ed1040430d9fa3f, 0xb92f9f1ae1ca609d, 0x00059e6376265910,
+    0xc9ddad7a6c1f2621, 0x1cc76d1f04656439, 0xe9333aedd431bc4a, 0x79fb2bd7342a9d16, 0x00020eec50adb39e,
+    0x6529195625052953, 0x2720ae2a94cd64a4, 0xf0df9659800c6e0b, 0xe5be4c10027dc561, 0x00024ce99ffd7081,
+    0xd53a8376d0c6191d, 0xc36117ea84f3cac0, 0x4d7da029a60c29cd, 0x75d778e8ebbce883, 0x00025e01244416f6,
+    0x3ac187f8e6b7f269, 0x9633e870e8f587ec, 0x88262e9bd8f1d631, 0x379fa232a067b75c, 0x00043ae6bb2f50f6,
+    0xb70bc5de9c629b5b, 0x324fcebafbb17ea9, 0xd3072042c9fab3e8, 0x5a33d918f8bb26e4, 0x000783e70eb1b376,
+    0xb1b6a1cbdafb7188, 0x32f0719bdffc2deb, 0x4a2363ceb916d6c2, 0x598ad3654933f454, 0x0007bf467571b130,
+    0xac01e3027df5291b, 0xccf32e0e21edaf94, 0xa698391a00332fca, 0x00bd5c6271d28a7e, 0x0007c5cc8283450b,
+    0x68a1f5c882fa69b0, 0xdc01929a362f2d10, 0x92fa397f129e971c, 0x5b5393afb054aee5, 0x0006e8241fb68cf6,
+    0x60e63a586eccb280, 0xacb283cc958966e1, 0x00ccbfab0ce89017, 0xc8e78b513676994a, 0x000655ba9e5c96a2,
+    0xf022bbbbd5ebffbd, 0xf79f0241e2f34275, 0xd431aff7af17a671, 0x6efa19231d8aa979, 0x00058515c0fea7bd,
+    0x8e006c11ba6fa571, 0x9977d9de904627ce, 0xb4ccb4d0122a5e55, 0xec77e99fb5f9622a, 0x000050a30c5be0a0,
+    0xd1d67b4ac88a9d46, 0x4dcd360f625b24c9, 0x675742c0cfbf5470, 0xcc2973171dd4de90, 0x0004fd6775d2a51b,
+    0x8dc0d7b49becd6dc, 0x9ce3614da064e6fc, 0xdd305b7e1a509db1, 0xe374eaf2f8fa5560, 0x000085ccd6b61d24,
+    0xdeb0ad3c30e442e6, 0x26251b732cfe838d, 0x140970d49b484315, 0x216a0d959cb1d932, 0x00000c4069fb61d6,
+    0x43a73815adf30b60, 0x6af5ede54476aedc, 0x05cecac6cc429b99, 0xfacef576ca198e93, 0x0003eae90d271e87,
+    0x6582e16356318f99, 0x8849c5294578ab1e, 0x3abfb5ac51a7eb84, 0xfc0676dd79cfb461, 0x0001c91756204ff9,
+    0xb205a18e393b063d, 0x0ae6cc8b62b49b52, 0x9e5298532eb3a339, 0x01ddb358725147ae, 0x000466c39ab70c83,
+    0x9494b27f97cbd294, 0x6d8f9e965a8e08a5, 0x34a7e54d1801ac7f, 0x3237cb22e63f98b0, 0x0003c81215b7dc28,
+    0xc61adaaa1024182c, 0x7369ca42ae5fa75a, 0x09750fb5fae3b9ce, 0x9263ff799fe6cda6, 0x0006fb85288a86d0,
+    0x667c3a188bcfe9c8, 0x0f8d78f6ee6687f5, 0x37e7a6d0b0615357, 0xcc9c4995c3405575, 0x00039634a9c58d00,
+    0xeb5471446152f3ba, 0xb8296ccd26726111, 0x8a9dfc4139ffa3dd, 0x3ca533abc190d0db, 0x0007a8c03ce66f4a,
+    0xcca45ba920743795, 0x32459ffdcac612f2, 0xf1ffc5d88d140206, 0x803b5383785249b6, 0x0000687cf8c5fb58,
+    0x8f317557f9fb9aae, 0x0f127c649d60aaca, 0x022d5ea4dfae209a, 0xe30db2210778b828, 0x0007b936ff778151,
+    0x664233992204b45c, 0xb0468e21c66ef318, 0x4a65f298a1c376a8, 0x07831355e64c8368, 0x00009b1ac4e78b20,
+    0x824a5217dbf889a2, 0x70d6dd5c1081a48c, 0x185a28138f06e2d8, 0x7f86feaa48e5b8b5, 0x00040ada2f3d50bb,
+    0xb6092fe8db611c7e, 0xc1e6b5c846066b40, 0x877790474e08e68d, 0x7ddad1ccb9a1f2da, 0x00014090fc50761c,
+    0x35bbb562eecac763, 0x68624ff2fdef9afb, 0xf6fef0b2b4cbe829, 0x258186e02704355c, 0x00058e9cab62c586,
+    0x995cdce1b7eb5cbd, 0xee349bcff3ff6021, 0x60029332a96009e4, 0xcdab8ba488f02fde, 0x000708255ab6b51d,
+    0x136dfd781d819576, 0xbb7f9a786cc8fc8b, 0x232aad4c3d1306c7, 0x8f278a13950fbc36, 0x00039ee7e74934db,
+    0x665e0d7ff053b9b9, 0x1d0758b4ba530ff3, 0x4bb05ca03195501f, 0x6d80956e3bfdf076, 0x0000423b7915cd69,
+    0x8993dbd01e45f488, 0xc56e077c373c6896, 0x138b84ccb8c1b18b, 0xf5c500ca3f1f91ec, 0x0006ce86a76757a4,
+    0xe0750300ed05cbe8, 0xebd9f8f3e316eaa1, 0x9dedbcd73283fa49, 0x6fc5add79bd6afeb, 0x0000e19cc01234fa,
+    0x429ff0e352074e94, 0x44ee4337070735da, 0x2ffad419c4ae88e8, 0xbd7556d25b34a551, 0x000202f52813aed2,
+    0xbfbf4a40d1e6fa3d, 0xa5d6f0108f7db3be, 0x7f5ae8de6f704f51, 0xec1f25f4517970a5, 0x0007370adf5d0a5b,
+    0x45cf5d11af8bb2d8, 0xe9ac0f208bdf235b, 0xd230af65e17067a2, 0xe3a5c8f96702a355, 0x000700f58ad455ea,
+    0xd92568a756dc2504, 0x15fb668f91abbf14, 0x598f6642b8de5698, 0xb85022e2e72a2559, 0x0003f5b42c70efa2,
+    0x89856014387cf1e9, 0x67e867f43a477e0c, 0x5a138530d116cebc, 0xbdb195eb07558c29, 0x0001cf02375945aa,
+    0xbcd4527252482421, 0x21a9d26b7add9f2b, 0x03a6a67e4ea582e9, 0xcc18357781e05ff3, 0x0001dcbf653b16df,
+    0xfbd650159140be80, 0x462308860a2d46d2, 0xe293d41132138dc5, 0xae01a48013c097dd, 0x00013b70ba0ce192,
+    0x8c9221e012bef804, 0x8f6384a8db032ef6, 0xa22b002c0f500015, 0x3830509276aeddf8, 0x00058ccd2fb376ec,
+    0xa03ad26fe044eb07, 0xa34815fca26e61d0, 0xafa06bee3a26ab30, 0xba93fa4bc211f40a, 0x00024cc1419e147f,
+    0x3d263783801e48e3, 0x58d310b64bde2186, 0xf1f99bc34214553c, 0x0e007a244901d500, 0x00060bfef8e93d80,
+    0x113e3e8ae3c5c98b, 0x03cb2ae39f1b3725, 0x8dcbdcaad2e63dff, 0x29da14ddecf434bb, 0x000682b19a0f54f5,
+    0x6f5f508294d2bb3d, 0x323a2d5a6d5cb447, 0x55e9ea2b6c142e57, 0xe4ac1f475c47f9d6, 0x0002b6f8538940ee,
+    0x67e396462492951c, 0xb73c9916b812ffa6, 0xddfd2077b05362de, 0x4a0865b3d15245bf, 0x0002fa3669e2720e,
+    0x4ba41b228c78effd, 0xdb39cfa2298c1ec2, 0x5f2af429f06cca9e, 0xb24daa35b2d8898e, 0x0001dc4867324b0d,
+    0x0c5132f37681eee5, 0x9327d0587ba60cbf, 0xb766df2a1ab7aa0c, 0x4df73342422bf330, 0x0006a6b70f0c7955,
+    0x3fd0a78f14b4e301, 0x1be94869549174a4, 0xc49ae7fa6f01b5f6, 0xeec894c869331452, 0x0006d888cde7d2af,
+    0xbb26ab0e84328346, 0x415a1a6859d186a2, 0x8c6fc288e36546b2, 0x956f5c734976d12d, 0x0003ca6998bbb36a,
+    0x29093c87f28100eb, 0xa1fad6718733fe81, 0x1e2875208856e770, 0x8dcfb60c0ddf4425, 0x0002a34ff58b1d2e,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M307_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M367_PB_WIN_5_XY[] = {
+    0xbf4a373541b3b9a1, 0xb5fe12e59a109f78, 0x1a400ca681e09639, 0x61197a76413e7be8, 0xf08c49a99ae0d3f9, 0x0000324a6eddd512,
+    0x1f051626442b3c10, 0x3481aaf454cd41ba, 0x3a49c6b61984c3fe, 0xf977d1a567b92b04, 0x77f59e39539007c7, 0x000001ab597a5b44,
+    0xec3723894c252f2f, 0x26d444f467e3b5f4, 0xf6ed5093665a681d, 0x64906d5d084f073a, 0x5a49998e2947d6dc, 0x00006743690feedf,
+    0x98f7a0b37113a7b6, 0xfffcd22247612eb4, 0x325e8cff875dadc5, 0x095240dafada1482, 0x0945708c32fa668b, 0x00002339934f439e,
+    0x514e4d68fe34ae3d, 0x5a40328158199031, 0x5e3ed7e9ccd8b120, 0x6f7d66882383b3b1, 0x84022eaea78d6436, 0x00000e6029770496,
+    0xa90d6e67945e8de0, 0xf8b0bbb63d454675, 0x86d519cfef1d31c8, 0x298a892a3f85e797, 0x14cf9617b446dca2, 0x000038ef5fbe8683,
+    0x3ecf657e82c16683, 0x8eec5df1d61bdf9b, 0xb054346c986209db, 0xd4bc9e6268c42fbf, 0x2ff32b95aef91e4c, 0x00003b49de054efd,
+    0x27b039ed4926f829, 0xc5790443c11d5d43, 0x5e9ca80e0f7a71f1, 0x8912c91d67e082ce, 0xcb1a5e5f7841ca3a, 0x000000c6b585c3c7,
+    0xc22989be00af6d39, 0x390fdba447d4c5eb, 0xe3dcb2c0cc5a5419, 0x948e8815f1771cc4, 0x592848827aaefa70, 0x000009e47c17eb59,
+    0x82fb9535a752364f, 0x76796912a02cc49b, 0x79885324779bb1ed, 0x62246bc55758220c, 0x1c259a2061a5acc2, 0x000003c51a33b4d8,
+    0x08cd6ca0ad1d127f, 0x4177894484784519, 0x5cc4a63a0d8bcd19, 0xd828caefd9874fc6, 0xbf18e3aa6a29fd14, 0x00001cc7fd5dc687,
+    0x47160aff540dfc2c, 0x7066e96a5fe33320, 0x6ea64317dd8edbf0, 0xe6b158919abdc30e, 0xf764ec0407d36f26, 0x0000098e7fd79146,
+    0xeabbce5c66904535, 0xad8d84d32e9e4315, 0xba40ba9640b758c6, 0x5731603a8ddbea0a, 0x90418d500ba20130, 0x00003618050b737c,
+    0xa3b50e52f4cf6bb8, 0x8e1fb62c675c064c, 0x2b66af3d95112719, 0x40adeb9c57ac17b1, 0xdd13ab6eac5c5202, 0x00002c173d0ba582,
+    0x949f1f9e93330919, 0xd7e4ac20ff12b2fc, 0x018a6ebe1244be9f, 0x18abdf2758cff727, 0x9685ef6cd7e6601b, 0x000010dd5170ade8,
+    0xafe58ec6a1e59664, 0x3ead9863b4173d69, 0x1cca07d0230fa42c, 0x09ffa761957bfd8c, 0x47c05ff949b8ff27, 0x00002cc0321d5c49,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M367_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M367_PB_COMB_5_XY[] = {
+    0xbf4a373541b3b9a1, 0xb5fe12e59a109f78, 0x1a400ca681e09639, 0x61197a76413e7be8, 0xf08c49a99ae0d3f9, 0x0000324a6eddd512,
+    0x1f051626442b3c10, 0x3481aaf454cd41ba, 0x3a49c6b61984c3fe, 0xf977d1a567b92b04, 0x77f59e39539007c7, 0x000001ab597a5b44,
+    0xed70bbdf7132fb69, 0xe6702389b1bcd738, 0x5ab9079427c7cde9, 0x364675c90ebc7453, 0xf2166bc490fa7822, 0x00002731308feb10,
+    0x3ffd72b3b8b990d5, 0xcca4f47c6c690ac0, 0x6f971d453ce244e2, 0x9ff7597e500fc524, 0x2de8dc3dd5748f25, 0x00004959f1fa47b6,
+    0x4def5de9090c5bed, 0x35f3d2a05ab98194, 0x64780048c3c759f4, 0xdc0754f9329883be, 0x3859c7e2a6ef5730, 0x00002a493fdba8f8,
+    0x57469cfdad189cda, 0x09c48aab0f5fb6ed, 0xf8fed7acb92c8f21, 0x949462a6b5b43c40, 0x0c56acd4a3e68d22, 0x000051d296bdc8d1,
+    0x40e3030f316e0f61, 0x6b00cd73f05fcc15, 0x9f3181c88f8307ed, 0xbaed4c1b9a195078, 0xa507e13581d89444, 0x00004ea4a9f311c6,
+    0x1db03b0126ef197a, 0x1fd6fd88fa1765be, 0x1c5a717dd093aee9, 0x50265cee61f0f08c, 0xbfe1cb88026150fc, 0x00001da549d20b6b,
+    0x8a611c6c80219407, 0x32c097a7f1b9e8fd, 0xd134b42ac17b3612, 0xe2e30ef25675e466, 0xf7c449e5347ce172, 0x00000c6a03e0c56e,
+    0x22ca2d4c74174621, 0x054c6f079af6b901, 0x5bc777ace715e274, 0xd243430fa799c5ef, 0x64c9d044c355340b, 0x0000407c82e64c2a,
+    0x15fd853c79e3454d, 0x3f471bdfcadfaffd, 0x8c6061c24230e1bd, 0x115c37178d469c6a, 0xca9aeec8d6c9e4a3, 0x00006e1ab09c15a8,
+    0x02737cafdfd36489, 0x3e64cce00339a696, 0x903385ea49c56826, 0x9f0c21956c373e99, 0xd3d6b730dbbcf66b, 0x0000403139de6f55,
+    0x6b030f34934f2221, 0x25096b5fcee6095a, 0x810d36e8072f5df1, 0x4f7b92e68ca76961, 0x4f8893fd7f3bb291, 0x00002998ad12c8fd,
+    0x9cd1abd42b82971f, 0x6be59cd12426a678, 0x9b3b4a955d3a34e3, 0x9aa851bac2dc8783, 0xde3814c62d74a6c0, 0x00003d8f59ac0eb2,
+    0xd98aa303bc290337, 0xd544fcc78b134e6e, 0x7984457f9342ee98, 0x40fad99576c64fa4, 0x9caefc5236dbf700, 0x0000009a6a37f909,
+    0x47a36d9211c4676d, 0x014187873c264b29, 0xab578cef6f63bcb7, 0xa92d24e5c292025b, 0x6e7f5402739e1110, 0x000044254d10f7dc,
+    0x136ebbb7207d4669, 0x0e61306083df98e6, 0xb55fd989bfa97bc5, 0x25256b8a41f726c5, 0xf282529c91c97559, 0x00006fd515362224,
+    0xb1f677877e4cc57c, 0xce56e41a412381ef, 0xada08c1c82c09462, 0x0ecac85be6ec2c82, 0xfdd88653cce5aeeb, 0x000065e0e583d1bb,
+    0x316ee2bddc388691, 0x8b4b803d201f0946, 0xd0e64a3b8efca178, 0xdf0beb2397ab4783, 0x1526d98820261fa8, 0x000035b2e4311543,
+    0xade49dfc8058a671, 0x47712e6f66533a4e, 0x7e918fee30ea550d, 0x63c6cb20846696cc, 0xafd01bbc28548e83, 0x000003ea6328bd2b,
+    0x3ebf5a438a9e1855, 0xe667335a31a2d624, 0xcca7d24e3f7b1395, 0x6e74f163c0bbef90, 0x7857b40db67f6bea, 0x00004ef2b5a5212e,
+    0x1afcee4b6a38f323, 0x6141afa83fd2173f, 0x4c4152ff821f8775, 0xab381d265d1cfa0a, 0xad3d8ff80af2927b, 0x00007afe33448d48,
+    0x9112d8cf3e2b1281, 0xc281ebbc67305c9f, 0x288d92f3a24ee15e, 0xb7e477a94c77404c, 0x806e968712615b4a, 0x00003d1451e69082,
+    0x274acc624cf6f70c, 0x75fe317acb226db5, 0x1d84d8476fc08aee, 0xab0eddb9d716995b, 0x8063da0e1a14d7eb, 0x00006dfca5bc8091,
+    0x2aad452ec3a8353f, 0x7baa5a194444264a, 0xe34e184eff9dbfa7, 0xa2f3378e2f2a1eed, 0x7f5959c360ee160f, 0x00004626a6540e89,
+    0x84b75281ace647d5, 0xeb0186a2f8717172, 0xa605bd2db586fe03, 0x5cdb1b84119f53ef, 0x6e422686cb24dd76, 0x000064e9c67b74c8,
+    0x583dd0b3f06286a1, 0xc42fc1e1a6cd5f20, 0x1c392b594559eb22, 0xa79acf7a3f49ac37, 0x07fff408f4171e3f, 0x00007d67f4161162,
+    0xa5ee4bafd149a2e4, 0x3beb4d6b04073292, 0xf69775c4af38d293, 0x29b6c2197a1d77f1, 0xcccbd901eb0e2bac, 0x000019238a69da41,
+    0xc3bb2d9f0dee3067, 0xcde608cc0db5a331, 0x702b20895f88d686, 0x1cc9044d0b2c672c, 0x03cb6000ad5225f9, 0x00004cfe7b348b54,
+    0x2b13f2e02ac3cc12, 0x64838456879330b0, 0xe4c33066cf72145e, 0xedacfbd64280139e, 0xb97577ed410259d2, 0x000067cbfd2e7efd,
+    0xded49f026963dc0b, 0x0ff3564b0b10cd32, 0xb4aaedee1a8a92c0, 0x3624bfade1a3009d, 0xfe4cb039876465b9, 0x000041a04f90bc29,
+    0x57183b62f4b63e71, 0xbeac1ce74f309b86, 0x96af8260b4bc3585, 0x954647050c103d05, 0xa7ce74ab34d31774, 0x000023318abe97c9,
+    0x9d7d1bd73bc998cb, 0x3e4072f99709df4e, 0x06455f04d859be87, 0x9ce528d7ba71f468, 0xa809dfe7b7a89a4c, 0x00003ba6976aa89d,
+    0x8a46c718b29fd8c5, 0x944adadd982abc3a, 0x664d2e04de6a55b2, 0x0351d070ab6963fd, 0x7b44f49e85007de1, 0x00001dcea8e7f4be,
+    0x5a584ff316cf458f, 0x2c96fc0bf2cb5b67, 0x20a0ac129365a0c1, 0xb2e698bb557dfe77, 0x6159cef87b8836c9, 0x000012f1f6f87489,
+    0xae147ba579542b09, 0x09cd5df1f92f355f, 0xbcc11796d578b3d9, 0xc67667af0a250299, 0x771943ed6b3cc502, 0x00005e51b5acbea4,
+    0x8cf28f0843ce0243, 0x18e7343443c3e06f, 0xdcb32628f447371f, 0x5805aa14f8a80ecd, 0xb91f7f546441e79b, 0x0000402679925722,
+    0x7d3c06db891a0c10, 0x80a0f13fc41f578c, 0x4191749e491a9c46, 0xa37852257ebf93b4, 0x9d0cefa712668628, 0x000015af66d342fd,
+    0x139a227a46fb6e13, 0x3432ee95422b5ec0, 0x82e257b681b54a73, 0x44e137601acc5494, 0x8922c6e540276869, 0x000077e63bf4cd33,
+    0x12820fbe2181585f, 0xef7d994dd30f41f8, 0x0d158b0bd828d08d, 0x874caea7818296d5, 0x812a2e5c0558f9fe, 0x00007852c3e5f4fc,
+    0xc1c803b4b1b110d5, 0x1387fe6fedf8752b, 0x7f5473c632718b01, 0xdd28c3b97bad4c82, 0xbd7a0b60c3f989a8, 0x00001c3641a20de6,
+    0x0347a15a83de7d6f, 0xf731f5778844fc05, 0xac212ece1100e1e9, 0xbe7d7ae66f072747, 0x4e282074e1fd11f0, 0x00000f426cf4eea7,
+    0x9309c03c921699bd, 0x37840c2c0a3d4944, 0xbef9152eb6f8b0b8, 0x9ccd0587d0df192c, 0x1f14cf77636230db, 0x000013e485de2fb7,
+    0xcdb6877ba7700e07, 0x44c9a5b34e5904ed, 0x2cfa2ce0f468e6b8, 0x23a2cac2910cf688, 0x5481ae2ac948f0eb, 0x0000652fca1a6d06,
+    0xf32ee6834e3cea2f, 0xd3f1ec4e213435f4, 0x9ecd8be6fd4b70d5, 0x38124cf0083bc6f1, 0xa15899bc7c92aefa, 0x00000859e4f0ee88,
+    0x19b775cd7f02b9b8, 0xe23e16fde7ddafb5, 0xca363def0fef5b83, 0xc01fdab85e8b05cf, 0x860c9b85d65beb9f, 0x0000424f62b374ae,
+    0x007b3d53a679efdb, 0xd654c3837c6f8ca6, 0xbffcdf8df494be5a, 0xa13876ba65b4684d, 0x75aee0709c248fbd, 0x0000031f9ef1a634,
+    0xf15366027f675bf4, 0xcf5d8cccb9490de5, 0xa662df2ad952b6a2, 0xba45aac2424086e7, 0xdf3b79666c5829ee, 0x000040f9b51583b8,
+    0x4e97b66e5d97a7df, 0x09d24bd2de97d8e2, 0xf175dc52f28f63f0, 0x2c180be596effaaa, 0x5ad005f05b5cca4d, 0x00001cbfd33487eb,
+    0x7bfb1c3996c33bbe, 0xf9e413524efe31ab, 0xfcd4741657f94fc5, 0x6541f9568042b606, 0x2643686a8a25fa8a, 0x00002efc4706b166,
+    0xf7626611c089196b, 0xb2ccaf67aeb80228, 0x1665446b339ef8c7, 0x04963554a105e895, 0x637a3473fe590ece, 0x00001f2a2089fc09,
+    0xb4263b0799ffcfa1, 0x92a7788683070518, 0xe52c8c1d9a3f007a, 0x278f1fa17b4200bf, 0xa637e88afb9f035b, 0x000007c285678698,
+    0x18853cb441e266d5, 0x01e15de43a609e04, 0x0a9183d3c0a082f8, 0x3fe8223ecbc5be64, 0x5f911649fbc77273, 0x00003e42b4fa3785,
+    0x213452fc26b207cb, 0x9a7e7084c1cfc627, 0x36e1e98d25ef580e, 0x28527286ccee3441, 0x97fce586e6a06dbe, 0x0000556592aabcdc,
+    0x31b74b4a7f5ec275, 0xc99929b025fb8e19, 0x5ea8c700a5de0e11, 0xa7702763740b62a2, 0x38095a3600182aa8, 0x00002239836e3a6b,
+    0x52584eec7a45a128, 0xf38959519217090d, 0xf6f10c440c07e45d, 0x196e909a64dd4f22, 0xff7892d6c586a153, 0x000018f20476c2ba,
+    0x59d5ea95c2cf8ba7, 0x10c78a5e45aff3cd, 0x192a120d990acf57, 0xd3ebe3cf2f98c9f9, 0x3983d03c6f37c72e, 0x00007be080b06be2,
+    0x3cef68a293002a73, 0x43b1d4155ae89324, 0x469a5f93e30df54b, 0xe1f68a850f67909d, 0xbb5e987352f3c960, 0x000003ec6851fe9b,
+    0xae8ed35113c08311, 0xf511c9fd518903e6, 0x6ea7a7f5ab7cef26, 0xbf5baeb1dbf2f7e4, 0x8536456182621fcc, 0x0000104c1b61a1e4,
+    0xd34e4b2adf6995a0, 0x052ac53b13f695e6, 0xafad10930e4b920f, 0x92338404c15a504b, 0xfad17cb3edd0cdb4, 0x0000394f666ff994,
+    0x75044c9b3bf50923, 0x8460a7771338ce5d, 0x3249cef1a0a71549, 0xd94bfaa7738fff7a, 0x4ae13e78dd445bcd, 0x000063ec54a34ac9,
+    0x267042d38bdd84c7, 0x23ea93b4e062f097, 0xfefa675e96a538f9, 0x4203b4943fbec64f, 0x8b78f9719481a6b7, 0x000079d2a2fe1ab5,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M367_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_PB_WIN_5_XY[] = {
+    0xfd3b43c5947c857d, 0x58068426c2171e99, 0x49c27bed49a2a950, 0x72f88986874e5aae, 0x03c32e0824d57aef, 0x33a16bbae7ed9a8e, 0x00001a62ba79d981,
+    0x723724e090e02db9, 0x1ea14ba53308b5e2, 0x8d1839a855c1769b, 0x8da241f331aa396b, 0x66f451754b4ca5f4, 0xc1f70bbefe96bdde, 0x000070b5e1e14031,
+    0x8e7d41ee832b98b7, 0x0e867c2438693d28, 0x5b3d6f661b6aa2a3, 0x15e0163fe13b406d, 0x67cb30a298344936, 0x2cf41c2e86e5081b, 0x000065a4c3ea1ed3,
+    0x29eb9b75ed5a69ce, 0x18e5c8eacb1f3375, 0xb81920c3b83985ba, 0x913f9fc0478df02d, 0x8aad5f84c657919e, 0xd82a8616a817b4b4, 0x00003f6995266eb0,
+    0xcbf39d25aeef305f, 0xcc8e65ac84301660, 0xdcd1be23de4a4eae, 0xbfa81e447261cb1e, 0x15e008a9f9d20563, 0x1e89a20171103f2e, 0x00000667ab842ae8,
+    0x6f7a1bd741dfce8b, 0x5020c9c76d75a88d, 0xe2223a3d200cbc00, 0x96d956a7097569f3, 0x8b1db7c9093ef3b8, 0x82f17a9969334156, 0x00001d20f49ba500,
+    0x0763fc1f71d644cb, 0x6fc7b2c0d91fb7cb, 0x0f20e824122168ba, 0x1b391f9ec72c3fa2, 0xfa23c563165cf177, 0xbf29f5daee140839, 0x00006d5052729951,
+    0x263799761845f00d, 0x16b9f0792ef4e7ff, 0x3bdd0a09aef1089d, 0xb5917be6fd7a4666, 0x3cf411f6727c5144, 0x3a1fa7ccd6caca36, 0x00001d8121664dc2,
+    0x7995c1f7ee430567, 0xe1a00207beadc21c, 0x4860b0fc23b0e3c0, 0x49fb619de901213c, 0x431348057b27fbb3, 0x584a58cc3dd13832, 0x000022816b090bd5,
+    0x5346292cd7754c1b, 0xf41214eef9cb21b8, 0x738fedc44106d0ee, 0x689745a0a2b3fab2, 0xcf1c2bea411f9dd3, 0x7dea03f94359cc47, 0x00000e69cd1fa8ba,
+    0x15a79c6eb3c51c95, 0x00f5e73729573b1a, 0x7646ac3e2bdd3d98, 0xe56a91e77ce57dd5, 0x079acf671b903d26, 0x6033f1aed8d14a97, 0x000033d48bc066c4,
+    0x239b94b291d5244d, 0xb463de3f6386f070, 0x6cdb898ff018eed5, 0xd8bc310da12899b8, 0xa58e5583ce0efe2f, 0x238807cf6dbd0f55, 0x000017fbb29dd149,
+    0xb23c48f765c492ef, 0xd8f39de67a4aa685, 0x498741c1a3154763, 0x78dc83d6f634a5c8, 0xdaff1218904d1075, 0x1a4dc25d9b717ef3, 0x00003f0d621fcfd3,
+    0x3a1f540c229dfa75, 0x50c6edf3a8fab468, 0x0fb01ab439a1509c, 0x6c54437f0cc6b209, 0xe6421a47b7e91ec5, 0xcf2b1ffc61df4118, 0x000045c0f98fd1ab,
+    0xb06f3719640fc6d3, 0x2c5a468c6599a96a, 0x852e7d133e2a88a6, 0x328230c03aef38f7, 0x5c89e24ee84bffeb, 0xbb98113511996cdd, 0x00002cdc87425148,
+    0xa441964ac69d128b, 0x40b66c639e4746a6, 0x0b54c994da8916c9, 0x2e5574018fd148a4, 0x033b6d4d8ba66a3f, 0x7e906e78aac0a854, 0x00006c7c08bd876b,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_PB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_PB_COMB_5_XY[] = {
+    0xfd3b43c5947c857d, 0x58068426c2171e99, 0x49c27bed49a2a950, 0x72f88986874e5aae, 0x03c32e0824d57aef, 0x33a16bbae7ed9a8e, 0x00001a62ba79d981,
+    0x723724e090e02db9, 0x1ea14ba53308b5e2, 0x8d1839a855c1769b, 0x8da241f331aa396b, 0x66f451754b4ca5f4, 0xc1f70bbefe96bdde, 0x000070b5e1e14031,
+    0x185af7c7ffcacec5, 0x8e25cfdb2f26093b, 0xe59ef434a316cc1f, 0xe95f5b1f40954601, 0xf8576cac0395495c, 0x6a2fc05280f3bd32, 0x00003ef63da91161,
+    0x8d7589aa2b1b01d3, 0x5db9fb685d5d2493, 0x1641bd52a3999fdd, 0x63e7fc4df4f9de54, 0xd7c3109f244409e7, 0x71db7c407bd91e53, 0x0000702761043816,
+    0x3ed2aa62c8f40743, 0x23fe1e3c0c8ae875, 0xf54a32811169ab40, 0x4479306b3673151d, 0x73eedbbd1d96275f, 0x0544a2f998ebee57, 0x000028d4ef0a5d83,
+    0x30539c003b23cac5, 0xb84ed71d271b90a2, 0x1a2cf823eb58c718, 0x232ed32ba7de590b, 0x5ae3a2490f6e41e9, 0xe159befa4fe7c2ce, 0x00001e6c61419835,
+    0x1197064da8d9381d, 0xbc747e3b8b82d620, 0x1ac385183c167608, 0x97627863723ed9ee, 0xf8e96a0d9957fc55, 0x0a774dd6034863f3, 0x00003de165e962b0,
+    0xc6e7c179b5211e2e, 0x50deb3825b02ea2f, 0x274fa99420218408, 0x0b57361c4399f268, 0x2801be8a829911e1, 0x2419c6b4e8feac5a, 0x0000512bf71102a6,
+    0xa3eb0da6604485b7, 0xa5e1a0ef017fb6d0, 0x75da66bfa4e9471a, 0x2e734a9da13f0eb9, 0x772906b5757e3018, 0x912d4103eb0cd13d, 0x00001f2b65bf198c,
+    0x22f87e6b5430b4f7, 0x56c2f43c38d22dff, 0xb263d54eca181140, 0x1812e1812c40de0c, 0x0584019de2fd7040, 0xe264f4706c34b0da, 0x00000f74256ad3bc,
+    0xa551fa8cbef4fc75, 0x55eaa79d81557fda, 0x26faeb97a9b90816, 0x062663265dbc4bc8, 0x5d36173a46eb744c, 0xabe456fafa8a44b2, 0x00002daab25ab979,
+    0x95071f7e4ebc4e63, 0x20d7612f3bc19ceb, 0xff89253291f9905d, 0x637be406f343991f, 0xe9bd45424985299d, 0x73745d21d9d92cc8, 0x00000db774ee825a,
+    0xd773a4252404aead, 0xb49ceeaa360315b3, 0x92177bd88a0c88a7, 0x596042ab54603285, 0x0e39da14f138cd42, 0xf37e253a3679f732, 0x00006f6f20688f1a,
+    0xb3cc90e83ab446bd, 0x72162d0f92290dc8, 0xc1cb3233d933abcb, 0x6c4ca4ecb18962c0, 0x06d9d41f89c911bb, 0x47d07a7ea1513153, 0x00001b616e445134,
+    0x52df0ceb689b626b, 0xabd03d913b5190c8, 0xb62a1c8561fda3c7, 0xb87193445616b465, 0x9bce54b07610d82c, 0x8d82729ada11723a, 0x00002942eea15648,
+    0x229374a231b88145, 0xbcfd52b1724dab8f, 0x1c9389cbabb6ad29, 0xb1c43dad4b2b0bb3, 0x8b555cc504343b48, 0xdc01493ed049d79f, 0x000077e3a62d3972,
+    0xa645006d1a80b105, 0xc34b799f6263c318, 0xb05cd1ea3cba746d, 0x0cc2b130e19c6286, 0xb69408bcfd75b28f, 0xc04f2a9b5663dbc0, 0x000046b59ac7df06,
+    0xf8a34e1e13bcd35b, 0x8467fc386e20c602, 0xa4b8f1f2e71737d2, 0x9cdc3127fd0f03a7, 0x0a6ea636234524e8, 0xf12c15c225c31931, 0x00003d2115fc9657,
+    0xfaea3f743a3886cb, 0x20625030351296b6, 0x6b913f1db45c65fe, 0xb3cf3ed395532e19, 0xdcdffcecbcfe26fc, 0xedbab61c668e613d, 0x0000599bfc3a0ca7,
+    0x2f59e774b5a09589, 0xa30aa4ccfd3872e8, 0x81068e72cb1cafcf, 0x2b00531399f14ad6, 0x1fe08c7796aba68b, 0x0a0b59acd9934612, 0x000008041f1f9d7b,
+    0xb287839260414bb9, 0xebd54c60df0291ef, 0x8b706e1c3b149791, 0x1a2c7b3fef99c87b, 0x8c598a85a4c8f710, 0x4eca60d2068fe7ee, 0x00000c5ea5f902f9,
+    0x01e6e0ffea8ee2d1, 0x7369651c93c4cf77, 0xf5c61632fe4bd307, 0xd864dff708bb77cf, 0x644889b4ac0a077b, 0x55a6528f7bf4a1c7, 0x0000526341919894,
+    0x2c8f80c881eb1f47, 0x6fba6ee2aee1e51f, 0x293fdf31ec18d46a, 0x96d3300288b9480a, 0x8c87ad8c476ea4ba, 0x8243ba4049d310da, 0x0000590ecbd5ed8a,
+    0x196a222d1a55851c, 0x2bcd4d82c541c7eb, 0xa7b2e39727b0d970, 0xe9e3fe13345cfb76, 0x4e2c2d61bac7fbc2, 0x26da8d82a6668e2e, 0x00003adaace3619b,
+    0xd0cdcf58dcf452ab, 0x6f68939392600937, 0x88a7eb332216b38e, 0xb9aded67d0d3a10c, 0x5a9842d4dfa4626a, 0xfd94549a3bcea7a5, 0x00004314427bcd12,
+    0x37858c2aa5080021, 0xeb38343a16d0bf41, 0x36edf19707491bee, 0xc9c5e4aad7f69c3f, 0xb600daa42fd8fd6c, 0x5bc9ff619b79b83c, 0x00006dd994920bac,
+    0x3c6523c494dfc657, 0x6081f3d0faa63f59, 0x32669e746a9aa8ed, 0xd0537d04b63d6caf, 0xbe0ba67dc1e242cd, 0xf340fd5a5aac02a1, 0x00004a683e6ffa79,
+    0x4f65a0bd9f0de7b0, 0xaefbc00c62abe4f4, 0x4e2193eee3f57b9a, 0xdbf877b41b8be93a, 0x15273f4b659d3216, 0x5cb73806dc6c7b6f, 0x000076a05f6421b4,
+    0xf51100c47ad6162f, 0x6a66ecc9be6de265, 0xad5ac4b9a744b71e, 0x9b31ca3a93939057, 0xc800598066f7ee38, 0x319036a18fff37d2, 0x0000648e0c5959f3,
+    0xe658a2c2aa15f222, 0x9b19184166828400, 0xdb1c69e3f4c296ba, 0x4f3e40c686fcf68e, 0x2e89af051eafcfee, 0x5940def8a3644de0, 0x00000a521b680a1d,
+    0x6818995b5c11ddcd, 0x3585d2d8f750a7b9, 0x8cfc6194ffc1ca43, 0x39bd61ac286d2409, 0xa4a28ac6d9bbe8ba, 0xf3dbc5c1709c711f, 0x0000497225300e82,
+    0x94ba1974ad8a27fc, 0xf4438ab1c46555e6, 0xde3f6c67f2863b5d, 0xf4f414e942c99565, 0xc39c3ca1b33207ad, 0x1d8eadb61c2e4a87, 0x00000866771473ea,
+    0xc5a23f14b9f03629, 0xfed46c89b1e34152, 0x7b703edc5b634f7b, 0xd31dec5fa508ea1d, 0xd35bc16629593ef2, 0x416f5f5aea1e8872, 0x0000697def11e02b,
+    0x2f2410bf4f0590d6, 0xf515080e82d06d20, 0x76eac7c41aeb8009, 0x91ab8d9012fdb876, 0xe06c7432d1ef34d9, 0xbd55ad57aeb6e81a, 0x00006d236a0f8792,
+    0x570da0b026824523, 0x82bf338dbd44c7bd, 0x963ec9b3234cded9, 0xca7289b470493782, 0x6d0981db21dbe66e, 0x457862a84d8e654a, 0x0000324a8f792645,
+    0xc9aa7330f8c9c30b, 0xac8a509444255629, 0x34e4cdb5062aec93, 0x359de4611c2c49da, 0x16193a2ec7ebada9, 0x8676078c91e8245d, 0x0000288e59a5e059,
+    0xe56cf65958f5a035, 0x39f9c4f74ed385f1, 0x9eb980e054bac9e7, 0xd92e514470e4345c, 0x5164925105628461, 0x424d6410ede47a6a, 0x00004c051047f39c,
+    0xe55b1aef9ca40cd7, 0x12acb56858d91790, 0xf7a781d7709eede6, 0xb16d6c58d925b87b, 0xd054105775d0758b, 0x98bae72c9fd26faf, 0x0000644e56399c00,
+    0xac5f87b44f4386f5, 0xc00f0c6e686f3cca, 0x716e080eb9e33c76, 0x27e2fa437cbe7de0, 0x65cb2a5f49217ea0, 0x5f11f2f6233b7dfa, 0x00002548fc141dbc,
+    0x8cfd076f0c654acf, 0x1851c9c7658fbc4c, 0xd10bce2baeaaef17, 0x3514f96de0d7952b, 0x71b7b889ee3d8f6a, 0xca488048f7602cdd, 0x000012e6da680a37,
+    0x937eacbae222f92d, 0xbe69b29522aff4b9, 0x21cd604ccd99e3ee, 0x12cb307c024d9c33, 0x5fa6df0949ca2668, 0x893d809525afd468, 0x00003d843a1b55e2,
+    0xf998c1cab4074d7c, 0xf0500aa5d796c996, 0xad62cd04a2584348, 0x2cf26b7ade079002, 0xee905cd1b162599d, 0x44799730813fe3d7, 0x00004595c3c5d256,
+    0xd78aa6f730c6590b, 0x355906e053780ee0, 0x24b0e33fa563a944, 0xc54ea67980165365, 0xcc38d092445cfb74, 0xcbfb929c19f188f2, 0x00005dead4cdf344,
+    0x8ac65fecb7419da3, 0x9fcd39c2fb258f94, 0xa386edc19737781f, 0x9758d16ebd8d2b14, 0xde0c158c552e609f, 0x8831721a134f3e45, 0x0000669ad192e9d1,
+    0x75c30e658ffebc89, 0x462078ffd4cd4a35, 0xa69e1b5bc407358b, 0xa0061f5a73a7f739, 0x7f7594e72b7c4db8, 0x82329d6b4089dfa0, 0x0000521a5f162b38,
+    0xc08d818096c59633, 0xb18a9bbaff0f3d34, 0x1d90d4c640818815, 0xd20fecd0e9303d6a, 0xe83f0c4cd68bf914, 0xbb601780a33f8e64, 0x0000022221e2a6ac,
+    0x71745c446c58b4ed, 0x1d304aeaca14bb30, 0x7981c0288b57a5ab, 0x4e59ad819967e011, 0x663af3d53103e43b, 0x639857c7462d965d, 0x00003e9004c32d25,
+    0x2fd94dacf9edf47c, 0x3cebd7badf45a140, 0x9aa47d1bc6b45555, 0x481773a0505a9e0e, 0xfcf20e1e1b89e59d, 0xec592aa58892988d, 0x00002488f4b51c3d,
+    0x849f0a800c6b05e5, 0x6c904f68319bf257, 0xb76b7a9f80e9be80, 0x003beb9139488f9a, 0xcc5a77ab3415ea95, 0x90c3e1cef1077c81, 0x00002c489f2ed03d,
+    0xea82771059d7dc84, 0xb8cae5e326aedfca, 0x47cb34ea477d87ce, 0x318de086324124eb, 0xa894a1362b80ceeb, 0x2b243648bbd34119, 0x000054931d473e8c,
+    0xe35fdc2e5e5400ed, 0xcb5fbe1e3616be85, 0xbf21d720bea498d0, 0xb40d5d510c7b685d, 0xaf3640d128f99e9d, 0x387bf6070067f4ad, 0x000022022f6e114e,
+    0xa227c542a2345db7, 0x8fed9e3b3d5f6e03, 0x7f0f6a51b081b330, 0x2ba73d7982ef5a2a, 0x5544ceea8c846b56, 0xfb906a3a47068cf2, 0x00001325681f8682,
+    0x91038b255210cf13, 0x89b52be79493796f, 0x9cd695405abec5ad, 0x77d4d1aa32860e4e, 0x5d686ad85d49e1e9, 0x31e78f67db96be3e, 0x00004912dd2a4cf6,
+    0xb1847a81002a88be, 0x47304e21ad566595, 0xb995589e199d5889, 0x195bb5f059658a4e, 0x7bcd62ca6a10a260, 0x34c9157457b99c76, 0x00006bfe6da6aef0,
+    0x3490266e5cb7a9cb, 0xa8b282ddf6ff1a34, 0xf6dc11de3851b2ad, 0x432f6dd96d10ad40, 0x568afb2be0c5560a, 0xd537680b6cca5d04, 0x00006f1b12afedf3,
+    0xc0cb2ce29e0a1696, 0x51384d652921dc66, 0xf03cde43dac71101, 0x631ba4f3f4609ed4, 0x7a1da46d40417171, 0xb24d0e5e873836ec, 0x00004914f4884b55,
+    0xe5c1f60c760e70b9, 0x658baba82b3c4719, 0x99c3e9bb1a9ada1f, 0xfc9ee95880518476, 0x1be1c9619bfca77c, 0x54dc69c9278c244f, 0x00005bd7f7716d98,
+    0x505753efcd6a70ba, 0x7a31d1d47aacaddd, 0x12e9aa993ce91876, 0xb70e25fa330791e1, 0x92172e8aee0b086a, 0xb4ac2794d78c26b4, 0x0000142dca957d76,
+    0xe25a74b41be254a3, 0xd9ee1603392bc79f, 0xbd0cace00506c0c3, 0x1f73542d6119c8a3, 0x6a9b526a55efe763, 0x3ee9e4b1e9c36a1e, 0x00003e264ab47f96,
+    0x486468194a904337, 0x8aca8f928b0d9ff3, 0xea37ced50c4c5630, 0x6f064b4debe10f64, 0xa822cdf2dcc02da8, 0x207e48b355b58600, 0x00003abeb01a7dc3,
+    0x082847ad29be9399, 0x4af820884e1d743e, 0x7732dd7e28a4fabc, 0xe00788a9951a9d85, 0xf993e99e36a7c78e, 0x3794d8677b2f794f, 0x000059037c7c873e,
+    0xf2f9a2a6fa166f42, 0xc714a63549856a33, 0x6cea1c2bea3e5940, 0xfba9b5c41551bb4a, 0x0c10f39be9ad52d4, 0x2c2c0b3ffc1e41bb, 0x0000066d5505c551,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_PB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_ONB_WIN_5_XY[] = {
+    0x76b1714d88adbcc0, 0x256db2dd423893e0, 0x00001e79fa7f03f3,
+    0x26013e66167ef417, 0x2f50d1caf9163d35, 0x0000171f0f254d82,
+    0xa81d98a13f9c8f3c, 0xbf4d9522b5a2d030, 0x00000490b27a5978,
+    0x045ed78faa173c8c, 0xde7eb32fe6bb6c83, 0x0000012917c299ae,
+    0xba6398b3e3ab616a, 0x15a0d87ec7b21aa4, 0x000019cd626a2540,
+    0x24133587e4277b10, 0x7ea031aae443d3c3, 0x000002144b245934,
+    0x477bea7e73daa13a, 0xd5b2dca84de4341b, 0x000016b0f665ef30,
+    0xd1ce8a0ce9fee6f9, 0xafcef0d0aeaff2e0, 0x00001181ea0588e0,
+    0x21db553edc9e3567, 0x59205690f7165f8c, 0x000009a602a203a6,
+    0xa52444084039205d, 0xcff6ae425bc38aa2, 0x000007856f7187bf,
+    0x27277fe6c3eb37b2, 0xe954f3ee696d5c15, 0x00001f6ca3d5c4d3,
+    0x5c6aaa98adc2a60f, 0xf9af925d4af9a7a3, 0x00001446bce657ad,
+    0xb60fd98086b3a39c, 0xed3598efc5737cb0, 0x000017668b7f43a0,
+    0x0d971dbccd49e28f, 0x829f83927d3057d9, 0x00000631f677a825,
+    0xb6d7354b5b05dbb7, 0xde0616b83bc839e6, 0x00001d6263fee805,
+    0xdd810c7a41d92e45, 0x14f20aa450c23fae, 0x00000668d697de56,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_ONB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_ONB_COMB_5_XY[] = {
+    0x76b1714d88adbcc0, 0x256db2dd423893e0, 0x00001e79fa7f03f3,
+    0x26013e66167ef417, 0x2f50d1caf9163d35, 0x0000171f0f254d82,
+    0x16ee1114f137a963, 0xddf8dbbcce7cfae8, 0x00000d83cdf61027,
+    0x9a4b127e86612651, 0xb204fd86258e12d3, 0x00000b4e9607b8bc,
+    0x044d74e4b76a0293, 0xb213fbc9484d4fee, 0x0000112f9c52d1f8,
+    0xb98c3505f66e474e, 0xd0ec936b38f6d802, 0x00000572e8a17bf9,
+    0x2f88a5081bccd8e3, 0x426bd7118f9fda36, 0x000013e860724159,
+    0xdb315a71825db1bf, 0x54dc26e41c5a799d, 0x00000047378f5451,
+    0xaefd155c3ce98f18, 0x9d0f2f06e5190425, 0x00001fee3284311e,
+    0xab6631b64762c6a4, 0x95d5d7f4ec5c3fd2, 0x00000e88aa726a81,
+    0x510157c81c368364, 0x543120660c991d1d, 0x000008f8b89dce85,
+    0xd837de415c8f5fa7, 0x4f5ea75657c7ea0d, 0x000010f85249e6a7,
+    0xdbe5a47a9f71f7ef, 0x102f088ba9abde0c, 0x000014f8e6ac87a5,
+    0x6da9a05d8c405a6c, 0x3c91cae7fd7eb704, 0x00000332a7985df0,
+    0x2d07e57b6eefef22, 0xbad52eb24d05e650, 0x000011f6492f9918,
+    0xfba1d43fd2582bfb, 0x874de2a09d1cf6c2, 0x000000a8a03e2604,
+    0x2b01de2bbfe031a2, 0x4def6fab48938d50, 0x00001561f4db7ee8,
+    0x409f066e3149a530, 0x0547921b5b57c31a, 0x000015f992349f34,
+    0x98329c142fc819d8, 0x41175d0e127f2ccb, 0x000016e033377894,
+    0xf49e04d4e08151c2, 0x83cdf67f3ca7d4a6, 0x00001d5504da363b,
+    0x1d8abd17133c797c, 0x75a9a9e080cadd27, 0x00001a8faa4c2a95,
+    0xf7ac77bc06e4d843, 0x469876c249232e05, 0x000009031b729119,
+    0x52acb8e29d3657f6, 0xe9d82869edd12a93, 0x0000154488dd0899,
+    0x0f7a6ef9daf37db5, 0xba97be4832a9c417, 0x0000105630e3f823,
+    0x2eb0f098c962126c, 0xe28eb2ce32594ded, 0x000016641635570a,
+    0x07e47de1cf7fdb9e, 0xf46fa715909c9dde, 0x0000129c37f28d83,
+    0xa552d380b69354db, 0x3ce5f462faec2149, 0x00001974d4e9d733,
+    0xe1fe1623ec8d1eab, 0xc4f1ccb8559faeac, 0x00001efd9f4d1e76,
+    0xbd18028280c95df2, 0xab548ca2f93e1eae, 0x000001b106ebfb9d,
+    0xeccfb7cc9ceb80be, 0x2fa4d8d7215d8fd1, 0x0000051745cef2a8,
+    0x127d2b53c0c409cb, 0x2d4ecf9d3c4ec0d6, 0x0000054d7f7b4e2b,
+    0xbcb9b686d4486cca, 0x5fc1b5981d4574d0, 0x00000784060dcd19,
+    0xc653e614cc9b4305, 0x6654b5d25e2f3d90, 0x00000a67425ee264,
+    0xeaa2679ac2dae94a, 0x094b47c7ed0ec744, 0x000017f9b81cde64,
+    0x3f260f5fca75a2ed, 0xbc5b229049fecf98, 0x00000ab118466df4,
+    0x919a9cbb49b21967, 0x1841509fe258325a, 0x00001e5c9c6cb072,
+    0xe31604074adad0e2, 0xfa23df70953a398d, 0x000017a36371e0d6,
+    0xa93b2e85431b5a90, 0xd70eb5b6b0d54253, 0x00000309d1967f12,
+    0x212e4212f8da20f3, 0x9bab30fb9a9170ab, 0x000009b1faad3fe1,
+    0x7c9be0a90b95c7e7, 0xddd14740ce580cc1, 0x00001a9466b06e8a,
+    0x12756f13a3b02917, 0x4c9aa3a34129554c, 0x00000ee4610d1988,
+    0x77da4dc4b81d9c85, 0xf9af9277e2ad66e8, 0x00001866d1247ade,
+    0x252e574bcff5dccf, 0xeeb47d49d19a7998, 0x00001138320064ca,
+    0x8466903d308d661a, 0x9ff996be92088d66, 0x00000f87d3660993,
+    0x2f61e4ca6dc32d0f, 0x1e16638115319661, 0x00001902e31a32df,
+    0xacbefbc143470ff4, 0x03b3452de4875e45, 0x000004e1581bf365,
+    0x3b825fc0b352bc06, 0x96fac09a6a5bb8af, 0x00001beb0b76554c,
+    0xa49d6f8dad8571b2, 0x46797ca2bbb54310, 0x000009acf703a488,
+    0x54ac40d6e769e435, 0x659dd1501fe321f6, 0x000011cef5df45e1,
+    0x62dadc3b1416372e, 0x1f9a532e28804a4b, 0x00000f049f7e1318,
+    0xcc25fa4a1e6608ad, 0x2fe2faf97f863fd3, 0x00001fa3220ae885,
+    0xc383aca50e727016, 0x1bb3e144804e3b5b, 0x00001eeb63c42b9a,
+    0xfe363364fac4db25, 0xaa685e6ad5538ab5, 0x0000162ef9ae2be1,
+    0x90501cfdc0cd7a4a, 0x9e9c900d25c78dd4, 0x000015851d9560dc,
+    0x6c7b1ff662bcf636, 0xaff76d5887eb31ea, 0x000004b48c4fd39f,
+    0x896cb9a03737cdf7, 0x51949f0e80a32123, 0x00000dce8afe848b,
+    0x130d3dbc086c0b6c, 0x1684e0c686639dfd, 0x00000a2d958e3917,
+    0x19e612d3516e101b, 0xb9c8d04f57a5f0e2, 0x00000c5cc3676301,
+    0x260d50fca67565cd, 0x9882698b940b3f83, 0x0000009af9fb2a2f,
+    0x0234b644cbea7ede, 0x63193d8af9076a4d, 0x00001c5a03587f63,
+    0xdc9b1ab78ce8e84a, 0xd01a2e0b59534030, 0x000001f01a328a28,
+    0x9271be58171d41f0, 0xc6ba7fed5e1579d4, 0x00001c00c22b13ff,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M173_ONB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_ONB_WIN_5_XY[] = {
+    0xaade9c75be246a39, 0x8d437664f54e5983, 0x0007a4dec7d3ff29,
+    0xfe4aeb0e7d12fced, 0x48296007cade6765, 0x0002d8bc41e8334a,
+    0xccc00c5084bf41f9, 0x9448022cb91afc21, 0x00047adfd624e73e,
+    0x84c09244a84194fa, 0xd5a5177dda362068, 0x0007c039005281f0,
+    0x192ddff43a8095ec, 0x0d13b2348b0a9a27, 0x00060e93f2e4d610,
+    0xe4aad59aac9a4e2d, 0x15413618bbeed399, 0x0004814d010fa9dd,
+    0x9e0622e3b330fe1d, 0xa70029c7363df416, 0x000105434cbe62f9,
+    0x4e72398b936058aa, 0xe2e8a13f7feb1152, 0x0000b4ceea25d25d,
+    0x0e0243ef506ce039, 0x2e6266d8610be07e, 0x0002dc93e32a213b,
+    0xbe48115278b3b997, 0x9ab114be41e2e153, 0x0005ed01b7e3667f,
+    0x49b095048a7de630, 0x8112463efcd4ff16, 0x0005b89f94a74016,
+    0x818848599f4f2936, 0xd983b972d84cbfbf, 0x0001abcd4e82a56f,
+    0x08b8e80d86f6b133, 0x9112e05ed1deab3e, 0x00007267ec85a4f6,
+    0xc0b26429ce8ac556, 0xb7d7ae8dc584fc05, 0x0001873e5166f753,
+    0xb21cbb8b7b25a42b, 0x8b09ec791fd4957b, 0x0003cc5ca65afe56,
+    0x6aea55f15b0073b9, 0x80a00e74e479180d, 0x00021b9863e297fd,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_ONB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_ONB_COMB_5_XY[] = {
+    0xaade9c75be246a39, 0x8d437664f54e5983, 0x0007a4dec7d3ff29,
+    0xfe4aeb0e7d12fced, 0x48296007cade6765, 0x0002d8bc41e8334a,
+    0x06b8156e2936b140, 0x48b676c41f113071, 0x00019e498decd6cc,
+    0x1a36d0117593b377, 0xeb30230794337b9a, 0x0000f4a8176a9bb7,
+    0xce2c2a8769c07fb4, 0x5eb1f6793ba968ae, 0x0005e4047e261ef4,
+    0xa2a49ceba7d17467, 0x583c3acbd8b52dba, 0x0006c8f72c03f88b,
+    0x4d3f32d77deca4ad, 0x71c6c68fcca7f1f2, 0x0000537ce26368d0,
+    0x868e4712ca9e1644, 0xee345324c30a1595, 0x0001ca9db3a602a2,
+    0x9414c03e5ef1361b, 0x5f1db25d096f848b, 0x0000018a2f0cfaab,
+    0x68f758c6e4758b2d, 0x9d0124fcb5840cfb, 0x000334f9b5b802e0,
+    0x0d0920da4207f2e3, 0x8d7f179a9559398c, 0x0002adc0319f5c72,
+    0x498aaba0b4b0e02b, 0x1df20c5679151acf, 0x0002559eba521cdf,
+    0x7043fb8b3abd10f8, 0xa4904f09bb6e8ac3, 0x0000931ac967c0c9,
+    0x5b636469e2fafc89, 0xbc4ed824e8eaa8ca, 0x0002a336257ce946,
+    0xbad116627831a970, 0xda3df65cb7a1ec47, 0x000631d1b84996dc,
+    0x072de7197749f998, 0x3bcadc8f6ac93f00, 0x00032cd06e7e55b3,
+    0x8b26e5260ef3a330, 0xd67e4481b05b5ce3, 0x0000cc9dd0926bee,
+    0xfd38614cb193f6a8, 0x8527ebe9760b6e74, 0x00053653e5ea366b,
+    0xe8515d1ee0b03cd9, 0x1293788638d34412, 0x00042a9a1831b25b,
+    0xb72907373e645c14, 0x1fec2288b98d3516, 0x00031cc67971e349,
+    0x4eb3467458a2166d, 0x64ed33de70f5b6ea, 0x00007d4dae50dc48,
+    0x2ee3e30ad40700ed, 0xce2b389faf34ac91, 0x0000cd199b509568,
+    0x76c10500d73e5f8b, 0xd2c90da4a826f638, 0x00038defed41b939,
+    0x4fdce3fac16e6c32, 0xaae0c675e012c784, 0x0006d19068260bfc,
+    0xa6a76552ea1bd366, 0xb1b4853a96330107, 0x00059328540d8bb7,
+    0xa44dab35d0d0a061, 0x982540fa9b3b54da, 0x0006fbfc8fa032a4,
+    0x4df2a9b301cf7116, 0x0d4b06037238c99b, 0x00062c7acd805875,
+    0x72dfd172b511a82f, 0x016d17107aa0e0ad, 0x00040f3861261e81,
+    0x03dbe9a0264a9045, 0x7db7c332b0ca2559, 0x0001635eab867c74,
+    0x7aa4cf3da10be84e, 0xae318468d1436535, 0x0001787cf0b181b3,
+    0x37b1d104c920b15e, 0x3f1cc5b04537334a, 0x0000baa3c1352839,
+    0xb90008d6acb167ba, 0x7d24a500fc6c168d, 0x0007287fe25b44f2,
+    0xdc741668f21832b0, 0x4223aaefba3968a9, 0x0006560d27030981,
+    0x7c906adb459839b4, 0x7cab44d87995fd7d, 0x00040f1ca05d42f5,
+    0xa636695e55e2933a, 0x772a2c81f14452b1, 0x000249a120c11750,
+    0x94bc65cb354060f7, 0x92c229ef80f38f2a, 0x00015a27ad43feb2,
+    0x398e2fae4aed7796, 0xda794602837e7cc9, 0x00064f33d09d7bd2,
+    0x889890f95c338ee9, 0xc8dd5cb9fdb8e441, 0x0005cbbc9cbe7b9b,
+    0xaef4e4c42a33fc33, 0x00b7b2fa6f315e70, 0x0007b17fb478b48c,
+    0x58d01d69f1046508, 0xef79c75fc809d678, 0x00003496d8429b18,
+    0x19d8e5dd879fb1a5, 0x5a4bfd20eb3f38bd, 0x00028bba8fee5145,
+    0xe54e197b19336ff8, 0x385ad5391abb2064, 0x00055f488845cb4e,
+    0xf65b1cb4853d8efd, 0xf364c3bf7bb10936, 0x0002d1c88473f1c0,
+    0x94a1fb112663f941, 0x51556153def0cf28, 0x0004df421afbf852,
+    0x8b166c308e45cb73, 0xc5cd80fe3c1b4752, 0x0006ad7e20b2221e,
+    0xd9c57fa406058216, 0x554e1a3f4e990ac5, 0x0006c59669db6425,
+    0xdd70c3cef86c3feb, 0x87d378f770f08d55, 0x00015d89fad16dd2,
+    0x28c0d633a22daec6, 0x4e3c2d1b1ae67f82, 0x0000e763441cc378,
+    0x3084c35ad9101dc0, 0xe9e52dccdb66dfb8, 0x0003508b9a3ebf1a,
+    0xe7d696b3aaf45d92, 0x6eca9cd9cdc108f4, 0x00062ece63b2b65a,
+    0x7ae78e2510cac53b, 0x00aba5cf9575c7e1, 0x0002f342849627c9,
+    0xcf6d9c2d41474cff, 0xecb7ce680d791e44, 0x00036d465fa77389,
+    0x8a26f11df222e009, 0xc1a384c357140a12, 0x0004158946d00e5b,
+    0x14e95772a4685220, 0x9ca346accb7d2d98, 0x000761ce5060df79,
+    0xf528166bbed6c600, 0x85419488a66934b3, 0x0000d6468a5464b0,
+    0x77fdf02a0848c4fe, 0x1d09f16de3530002, 0x00019f45b092724a,
+    0x2f214953388fe1fd, 0x89ed189df05a5018, 0x00004381b45deb26,
+    0xcf90645f9c4f2e51, 0xb45674127772490b, 0x0000329c23dd1661,
+    0x9500ea799bf9c84d, 0x0eac1e06ccbc1e36, 0x00055df05510b5be,
+    0xe57b14f3f19c0494, 0xb219b4094ed574d0, 0x00000ba50e045998,
+    0x2a83e0c3b69a0c15, 0x67beec07df235e01, 0x0007f90b576477a3,
+    0x5afda4e4a0ab2095, 0x7badf4c31249b588, 0x00038150b04905cb,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M179_ONB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_ONB_WIN_5_XY[] = {
+    0x4b5c7979f3db2ed7, 0x85c39cbecf2939e8, 0x26ab60190fceb2d0,
+    0x5ce107c4352e3e83, 0x89219bcd9485c2cc, 0x2ebd9b0990359c64,
+    0x9b1cdf93deddae91, 0x3bfaf97a892edde5, 0x15c709d8bf438908,
+    0xc1f39d721ed70191, 0xe9f35d7ba9907397, 0x2c305ea78ca79d26,
+    0x10568a54788f6c67, 0x675c2dc14050e2b4, 0x542ce391f4c454d6,
+    0xeae728a7639b42cc, 0x1203144f3370f227, 0x42c0f2e7e6716615,
+    0x956732983fbd2bc7, 0x21a9e6122d06255a, 0x01c8fd98b028fe63,
+    0x4bfc1284bc625d24, 0x3bcca724beaaa0c8, 0x60608ef440e80cbd,
+    0x50ef79174f97dce5, 0x5e900e6505ec54b0, 0x228186e378d5189d,
+    0xa380dbdbc9c66e38, 0xa18feaba3e01aaa2, 0x270993c25dec16da,
+    0x414ea72612d0c0c3, 0x65cc77967c9ba0b8, 0x5ad18efe44b7db43,
+    0x6315d9501b5fecd3, 0x8bc2a16dd5a905f8, 0x012ad3cdc32853f7,
+    0x30c343062b5fde87, 0x8ca048b9eed28bf1, 0x329fe63d62b0aeb1,
+    0x1ce3ac84938aa405, 0xc78e2983651eac62, 0x06d7ca2e535b5979,
+    0x41b0c8b2f44e772b, 0xa9a88de5cd3e5cd9, 0x104c85995bd0ed99,
+    0xc80b378a68b643ac, 0xcfb1c027ce938899, 0x34afab24e6290d93,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_ONB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_ONB_COMB_5_XY[] = {
+    0x4b5c7979f3db2ed7, 0x85c39cbecf2939e8, 0x26ab60190fceb2d0,
+    0x5ce107c4352e3e83, 0x89219bcd9485c2cc, 0x2ebd9b0990359c64,
+    0x0b644b64337ebd2d, 0x4a0c967bfa3ac21c, 0x48cabbdd0460afc9,
+    0x491398fbfd7d6ff7, 0xac83f1019feeeb39, 0x169ee8e469797e45,
+    0x3d633acd0eca17af, 0xfe1b686e72452ec5, 0x28faafccb28615fd,
+    0xbc4973a957da82f8, 0x1909d68f3c2579c3, 0x70f1255c4b205b07,
+    0xc226098ec7d76843, 0x07e658f022fa5b00, 0x2f34d146724a2670,
+    0x95734da1d3b0283b, 0xe66ecf8d42e1f227, 0x75ceb459ed4a25c9,
+    0x049b2bd5b2cd3439, 0xdceaedc539bc87ed, 0x78da43c4037f6456,
+    0x939734f2ed44e606, 0xba067ce001288947, 0x6c23bfc8d5d84d1c,
+    0x70d2b4de6d89dfa5, 0x8decb8b73dfcb570, 0x4cab2af400c03282,
+    0xf887eca2742360bd, 0xf5bdaa8b9dae1b21, 0x63b6e021ab74714e,
+    0x84deda3b215c25ed, 0xe9b4b016ae863561, 0x7c0e456064cb3b2f,
+    0xa1c0f93f5c531bc2, 0xfb8da9ce38bceaef, 0x42a7e55877be1051,
+    0xbe1a7d0e9963b265, 0xafedaaea6b72a029, 0x4e278ccbeff27f3a,
+    0x9080cf7cc5b43aaf, 0xb6eaa5e4c269ba79, 0x75052d7262852c4e,
+    0x882476dff522157f, 0xb3a1debd9cbe0677, 0x6383da8a7027d52f,
+    0xbe6d827005e96186, 0x1963919cb7529362, 0x7fb757452d411d6c,
+    0xa47f01e54507bfc1, 0x96bc539807bb5848, 0x286b7d261b4218ec,
+    0x55ba5f92101de560, 0x326d6f03a54fc13e, 0x106bca81494a30a6,
+    0x5753cd0521906ee7, 0x52b2f8ae7a16194e, 0x2bedb7f351f6636a,
+    0xdbcbb268f943d3f0, 0x75f54a64231a1173, 0x74fdf27dbbd706d8,
+    0x521ca363de8f5383, 0x80806dd92c5d5902, 0x42f4b8f3ed560655,
+    0x2762bff2cf371bf7, 0x59edbaae52b5f812, 0x4afdf4a6c822fd93,
+    0xe4ddb5ef45428e03, 0x29ed2ba2f34fee47, 0x2ab82118f99e2def,
+    0xf4a84fce0495f378, 0x0f8c948b0b4619e2, 0x44815ce47553ae96,
+    0x782898f2252af669, 0xe5c17a0f95162418, 0x3a6282b70a347be0,
+    0xdfeb00603588b200, 0x5e2b6ecd317a9ff6, 0x1f4bae20fbca7dc9,
+    0x51bd79d4804f7d71, 0x8fa1cd5b3f84f28c, 0x643988e6c61df58f,
+    0xb4f91b38598a6670, 0xae2f62fe401ad6c2, 0x337023204df632ae,
+    0x9c51f062dd04df7d, 0xe7ec4437c30369b1, 0x7f36cdfedcfb88c5,
+    0x8429c57b86ade787, 0x339fdbf2728f08ba, 0x0edfc53a36ed24ea,
+    0xceb3e8b730eea877, 0x9ace75d3e17d2a81, 0x25fc82386da52c2b,
+    0x1f145118cea491ff, 0xc5aea795589387b1, 0x0cdb22f622e47af2,
+    0x8d75c01bab717297, 0x11f1e0344aef398c, 0x0440c32d6d9b451d,
+    0xbcc134acbddb5536, 0x4125dd94bf2066da, 0x0bf17c5281c7cca8,
+    0x02e10885f2cf793b, 0xca8bfddd0d834fa8, 0x66d98375f1613dd6,
+    0x6af647073d916695, 0x376751f8b0d4fa53, 0x3cb9f8af46e03571,
+    0xb21e74a4b6e1ba69, 0x4e8b53965b21cfa4, 0x24aabf6aeac96fa9,
+    0x1de526486f62f851, 0xf91d72e0e63d3e86, 0x33dee060ecba94ca,
+    0xa535d144a3c89645, 0x073954b67949342b, 0x4caa4b3264808c95,
+    0x404d1496748aa301, 0x441674b8fb780e0e, 0x0b0437f8683d6eb2,
+    0xfd20e9e957523a1d, 0x36d480d22c615d96, 0x007c0271212fb71c,
+    0xe6cab233b1122ae9, 0x1aec61341030e5c3, 0x797b8e779c6e3508,
+    0x29b55be3c0fad9f5, 0x8249037eaa27c005, 0x20ba17d3eda7447e,
+    0xf887f9a537d46f49, 0xe7695ffaf7ae73e6, 0x06a7a8d801d861c4,
+    0x0faaf3c6e676e681, 0xf94f7105cc325490, 0x3055fac2655f171e,
+    0xe107a1efed0fd14d, 0xd27dfa9b50506bda, 0x60834fd8f8ec22a0,
+    0xdfe092998a47ecc1, 0x657a30b3a0ddc8e6, 0x1bc6a984f881d57c,
+    0xbe829db655dd77ad, 0xe0a081e89b215c11, 0x6dca62fbf322a235,
+    0x7fe61431606c48cf, 0xa7723238942d80ea, 0x7e3dccb4e35979f8,
+    0x09f562a4c4efd4d5, 0x5422dd749a1dd701, 0x5473a9a125f56328,
+    0x5cadaa0a2c112a5f, 0x1b31267ec6697513, 0x2ea34a227ed44288,
+    0x34d3b1f34ed169c6, 0x7da5de525adfc94a, 0x1df0acfa70fd5b0b,
+    0xc0ee447beaa72d81, 0x20e18a9030674bbb, 0x35343d9a6407dcfa,
+    0x233ac88b64b9ca39, 0x1f7c85f9031d103d, 0x2e7b993bc17817f3,
+    0xdb3d0d4d8c8a22f9, 0x96df832d98a10edb, 0x0ab51baf639222d8,
+    0x3f9eee3916db7217, 0x57dbebdeee0c4122, 0x0b89619e36090b53,
+    0x8aeb70edbd3157bb, 0xb94dedfbc2304407, 0x52c4b6ad2707511a,
+    0x6970736aaa52c952, 0x7236a0038de95e61, 0x3cd961192e5d7a8c,
+    0x145fbcfa4f6c17d5, 0xfa16b30b8f5b0db6, 0x436230258e592198,
+    0x6d982f5ad1e4dcd2, 0x3dfa939556dbbc0a, 0x189a3605a9763f9f,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M191_ONB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_ONB_WIN_5_XY[] = {
+    0x4d6dc1d573405554, 0xcd5ea4b8e4b3bdf7, 0x0c0928efc7423541, 0x000001f9873c6e30,
+    0xf2f4291ac9df823b, 0x63245a26f32fc127, 0x4157834fe0a396f1, 0x000000bc1ed7db05,
+    0xccb3b766cf225bf6, 0x2292f84894d6cf99, 0x5efeb5c82e5608fc, 0x000000feebc25913,
+    0x1b5d6a5c536790a2, 0xc8ae8668a1064067, 0x39622f6dfa504759, 0x00000067a541a59b,
+    0x4ca94c8da00f1484, 0xeb3d0dea0463d7bf, 0x2c2e26d7868e1f6d, 0x000000fc242ff50c,
+    0x6718be0bd23396cc, 0xe2744bf5b22949f1, 0x42b176e33e4c2178, 0x0000016bd4adcd63,
+    0x14d2e8d2a8343706, 0x35aeec1e6c4d982f, 0x309a88637f69bd9e, 0x000000e40b66dc6f,
+    0xcc0599a9703a9681, 0x68153c260bd74fb0, 0x7671a248ccc680bd, 0x00000186eb650d23,
+    0x5995692221a6186f, 0xc7fe2a84257a5417, 0xca7fe970211bebf1, 0x0000001d588b52a6,
+    0xa12d03b588a77363, 0xf635987a4f39cfa2, 0x95b8eafc066eb069, 0x000001ade4bf6c22,
+    0x5c726d19e420684f, 0xf5d59208ce3eaa7f, 0x5d67d3440026e50a, 0x0000011a7bcad2cf,
+    0x8db86f38ec1acf94, 0xcdb3165aa3914b8b, 0xdd661e3c94255793, 0x000001810205d449,
+    0xf21bf94e34f4a31a, 0xa50a7538ff81398c, 0x2388a179ecf611ad, 0x0000016841439a15,
+    0x6208440a0d7b127e, 0x8f70b74d83366382, 0x66db4daa1030d2be, 0x000000b3f3533ce3,
+    0xa0b9257f454ee6db, 0xa93b5a0101117e5a, 0x13b81890543f2743, 0x000000d1b02f6e7b,
+    0x9c69b8452c4d7423, 0xecf0c3653fcbb867, 0x8fd485436a44cb44, 0x000001fc6e5acb77,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_ONB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_ONB_COMB_5_XY[] = {
+    0x4d6dc1d573405554, 0xcd5ea4b8e4b3bdf7, 0x0c0928efc7423541, 0x000001f9873c6e30,
+    0xf2f4291ac9df823b, 0x63245a26f32fc127, 0x4157834fe0a396f1, 0x000000bc1ed7db05,
+    0x63d2a7803b3b92ae, 0xd623b2a1659b6a77, 0x0312363301f669e4, 0x000000f7c1b2ec74,
+    0xca69543f1deac793, 0x780a937b64055feb, 0x377f6c40b54d48e0, 0x00000170464a5977,
+    0x6fa3bd7916af3367, 0x719e16984b2fd87e, 0x38ba741e52d5a235, 0x000000dbdcfc70da,
+    0x895865e449f37e44, 0x9a75b67173892df5, 0x318bc4407ee93546, 0x000001fb61b0b139,
+    0x4b6ea7f710f3cda2, 0xbd8eef42093ad2e6, 0xdfbff0267d544725, 0x000001e997944156,
+    0xdbae4a3125d2d843, 0xc844033d00cc2e78, 0x66c5a00d6227ee65, 0x000001da4accf557,
+    0x2ba8ac9e8df1557c, 0x4cf9645122b6e992, 0xfc469308e2345c0d, 0x000001ec3552db47,
+    0x9281cd9d3b09e4fa, 0xbdeaa40962c8a5c7, 0xe269bba9dea2dfee, 0x00000103c4924ce7,
+    0x8e74a11a2575b1a6, 0x05bf51417b68dfb3, 0xd64c13042f643cf6, 0x000000f8f35258e1,
+    0x77d472c23096860d, 0x41aa24d47b6c093a, 0x4fae3b14ae2d3976, 0x0000014b117c0d2a,
+    0xd8b9e4b47186551b, 0x97889dc83758effa, 0x0920aeed0b532373, 0x000001d905968a78,
+    0xe75d035119149028, 0x59ac088b4013599b, 0x832dc8ef262b451e, 0x0000019f44ee0c38,
+    0xe178912d0f4c3723, 0x153fa6fab3a1dfeb, 0x6aca112386a4a7b1, 0x000000ccfe1e1231,
+    0x74b098ce06e7aa77, 0x7d77849bd640d3ca, 0xe47be5fb8fa88b8a, 0x000000708c0d326e,
+    0x57c00a9c9d22d4a2, 0x049e51609d799dda, 0xa51b7ff4fbcda9c5, 0x000001ef408b56fd,
+    0xce278a79a9acfc72, 0x5bc08360ff38f75c, 0x4612477f21df2871, 0x00000197ae492d08,
+    0x1bc3d928e161cd60, 0x0d7fa2b00c55ea46, 0xb20ffcd8211e0d9f, 0x000000200e50c6e4,
+    0xa1561312af9eb610, 0x16d61a5c176e320c, 0x1cd1f739531425ef, 0x0000017bc6df8f37,
+    0x8acd89327224e48e, 0x2f681bb8c939098e, 0xcd27b57b6f97ae26, 0x000001eb188b42a1,
+    0xb52264a0bd2c953c, 0xb3a4fd3492d7c18b, 0xa24d989471f2aa69, 0x000001405a5e1152,
+    0x0301d952fcf3fd07, 0xaf905aade49e3b92, 0x252d6da6926c7c01, 0x00000013c785c34c,
+    0x2bd9f1f605bc871d, 0x7965fefd15721d9a, 0x56c8c4c5ec599767, 0x00000053ad1ebb35,
+    0xedb0c79bed63d02e, 0xb2a3978f38b0f6ee, 0xd5cff7586c2aab04, 0x000000b06a87d9bb,
+    0xa5ae70c1bcfc53a1, 0xec72d8576b76d24f, 0xff7d557a0fd1407b, 0x0000003bc8c48807,
+    0xae66fbb195108889, 0x7feceb3b590b46e1, 0xc10dbe7eca45840a, 0x00000053c6959d93,
+    0xa756f651f589d1be, 0xd4970ac50bdb027b, 0x8ed810d9be04edbc, 0x0000002daefb505b,
+    0xc523eb79a8b2c2e4, 0xe78e38d567e06662, 0x01ab86d890102d82, 0x00000022ff2bd31b,
+    0x6ed44649c56b9dcd, 0xa375aed78554b234, 0x92673a4d0eef3682, 0x000000a36384e746,
+    0x65e98e625dcacfd4, 0x0ba7d8c9b9709dbc, 0x6daa30e4760e09b7, 0x0000003f91922f7f,
+    0x36e8257d346dfa14, 0x131612dd5a08cf85, 0x035029aa41ea83e6, 0x00000089d8f4160d,
+    0x772ef35bf811252e, 0x4ffb1ff941c2394e, 0x521bed6cd4adcfa9, 0x000001b27ca9ca16,
+    0x8d26650ad5e7ad9d, 0xd88fc02737e2420e, 0xf1bc26dd800f441c, 0x000000809e43d570,
+    0xe9c24014f57cefe5, 0xe109fbce5548ffe1, 0xeec4d707699a3b21, 0x0000001ccd31170d,
+    0xec533a1f4bcd83fd, 0xbacec72f03a90272, 0x89cbc889432eb612, 0x00000057a36bb1a2,
+    0x2dcb4cfad8a96b3c, 0x85188767da92f9ce, 0x8cafc3bb92968fb4, 0x000001a100f965ca,
+    0xb05209aed35c61c6, 0x43b3d80c771aa37f, 0xc84b7633db3b9be8, 0x000001fc97ef74e5,
+    0x9bcc27c6de7c5e2b, 0x13bf4cede1bdde52, 0x32d135cc9c87577c, 0x000001dbf7cd24dc,
+    0xe5b03238df1bcdb8, 0x3db203372b441178, 0x9da01f7a1bd447b9, 0x00000060c093f7fe,
+    0xf2ca82f90c2020bf, 0x1a70db6e6a03cbc0, 0x09758b207de78b5d, 0x0000018444a4dc47,
+    0x75872503d5a20f0d, 0x35d312157d0bde43, 0x223ec387dd2a96f8, 0x0000002103625dff,
+    0x739b359516e5de61, 0x9179049d836a3791, 0xea41cac51ac99770, 0x00000141ac4f863f,
+    0xbfdd0375f64f952c, 0xa721bfb66af28f22, 0xaf86349e0d44f2c9, 0x000000214fee5b85,
+    0xe85899f613e122e4, 0x748e0f2bc693d853, 0xe83c4cc3a5887383, 0x000001a9a692b5e0,
+    0xb45eeb7ff48a5019, 0xd6db404858cdb263, 0xc874ae97da738ffe, 0x00000158e3c6d6cc,
+    0x4fd14780d079bb4c, 0x2b0275fb3da5b4e6, 0x852bf5844ee8dcc9, 0x000001ec3727feec,
+    0x92073fe661f5a51d, 0x1cbafba63a78deb8, 0x5be17275c5ca553d, 0x000000657e3ad09c,
+    0x1fc219fe438372ae, 0x9a639167d83a9a37, 0x2ea58785bcd06b1e, 0x000001f01294ca4b,
+    0x41600b058541135b, 0x12a43eb8291865fb, 0x55f8f02d27065526, 0x000001ccea6d6aad,
+    0xb8a8bcf674eebf41, 0x56c2b347db2b276e, 0xc015190ebe26d49c, 0x00000100dd1a850d,
+    0x18158a76a16d488b, 0x16d2e161538c461b, 0xf3234b0475c29863, 0x000001d0f8569c3d,
+    0x2bb2e410adf0192d, 0xf6a9103c78fb5e54, 0x56e519c041bcd9ea, 0x000000d0d0859472,
+    0x2e7b3e066c36d6fb, 0x58b5236aa3e00792, 0xbe868ce61ac5d912, 0x00000198a945c7ff,
+    0x2abf044879e3af7e, 0x5686b9752b0807e2, 0xd3063ea04899c9bc, 0x000001fc89ab3963,
+    0x77667f1fbe6c8ec7, 0x684b7a8c0bf8c436, 0x2d8df9619a92f28c, 0x000001607394ffd7,
+    0xbb1b73563cc164a6, 0xdcb74f1c03146645, 0xe182805817d588cf, 0x0000013955a0b59f,
+    0x587e289144720fd4, 0x94c88048b8b425a8, 0xc6b50403d66735c9, 0x000000dd5ca9dd6c,
+    0x7fde25100db1cdb4, 0x280d7b64eb9ffee5, 0x44c883066d390da4, 0x00000034dc193082,
+    0x695b52a29cf39d79, 0x769d39aefbdf8667, 0xe85b8cdc34ae35c5, 0x000000074edf3edc,
+    0xc6442097d8047c5c, 0x7449d2985ace5c62, 0x2fa0c12e822bbff9, 0x0000012eee066356,
+    0x8c3da80edee5dbf8, 0xd4ee22e08b68b85b, 0x44d27cf462aa3472, 0x0000015093a1748f,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M233_ONB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_ONB_WIN_5_XY[] = {
+    0xad74bd6ab039c555, 0xfc811f855f809959, 0xff954ebbb6214d8f, 0x3a62445616dead5e, 0x2baa23681c710d6d, 0x1bd3272265ef7ffa, 0x000068dfa13acadd,
+    0x6f76bddf634a2790, 0x145a9983ce65f69e, 0x2206841669910f28, 0x62e229c5c5655536, 0x5986038bf977d1ce, 0xa3bc401a86574d74, 0x00003b2f6a74a12c,
+    0xd70782ba2844df23, 0x87f13d82c9de5cfc, 0xc6e394c36e854f2a, 0x4eb45181be6de935, 0x3b75faa4eb18497c, 0x7c8aec736d3c2551, 0x000006083e9e042d,
+    0xa21611fb55e6fd45, 0xc17a96a3ae1b7657, 0xf5576a78fb43fbe0, 0xb5b5b7dea1266b9c, 0x921be8e0e6b863f8, 0x1320ef2f76810fa3, 0x00001d95b2b8aa4a,
+    0x0741ccfce504c331, 0xd742c7590ce5d4e3, 0xa8c31db37db253f8, 0x2474f126432d2786, 0x18994178649d7464, 0xeaf864fb4c2521a5, 0x00004dcc60128429,
+    0xed31766f009c3872, 0xd9571dfa0b92bfcf, 0x14dafff1f8d1e5e7, 0xa1952a464a442371, 0x8dca7103b21d3fc1, 0x57ca0d5955f51fe1, 0x0000135abdaf2652,
+    0x32b25b05e366253f, 0xde9fc0985cd58c4a, 0x85515e7823c03611, 0x4bfa059b549fd0db, 0x2b2b273e656234b7, 0x2dedaa1dae1e7c85, 0x00007d506acbc2d2,
+    0x8206c2914d376bf5, 0x8fb1f013bd377369, 0x7873ee4f33427d51, 0x186123b7c33af6ae, 0x976a19977805c4ef, 0x7e3d18a3a6f4c351, 0x0000272977a0b2ce,
+    0x96b41d9c6675fd2f, 0x8de8310f26a283c4, 0x960ae837748cdb6e, 0xb621dc30024f6d98, 0x26186b2ec593aa92, 0x209205ebf9b3c39a, 0x000030b48f733403,
+    0x2105dee91485b394, 0xc0943b233f90c55e, 0x6554cb869bd3ff09, 0xb26705c90998f1d1, 0x586e884fcacd6b55, 0xc3fe387cda19f7d7, 0x0000126c0f1ab2cf,
+    0x0406d9d525084601, 0x04cb591d0eae615b, 0x511e035f6d7b3c49, 0x3c635ab0bd707dc1, 0xb66709d0bd3789b6, 0x8bec6f79b86338e3, 0x0000623ab56a3932,
+    0x0c4b088650ff106c, 0x1cac06047dcff247, 0xf8b94ddca40003c6, 0xbb50881f1987e6cc, 0x127d5c654194b71d, 0x6e56da5cefe640f9, 0x000032cdd8a31d74,
+    0x010f41893f9d5cfd, 0x0a3aacc2b1d818f9, 0x6a838cd5fa844d3b, 0xeddf114009f10d3b, 0x338c2e6834cd2ef7, 0x5edce1724d937ccc, 0x000063d567d54cce,
+    0x0e08415bf6480182, 0x1301bd4bf7aaac10, 0x931c1a5574b270e5, 0x0c4174f2b8977d62, 0x5a71ae5ebcd451ba, 0xb1457693a7d3e3ab, 0x00004bbaea3a359d,
+    0xb367b570dfbd6565, 0x4b625b42cd7b8efc, 0x134c85d6e547b8b1, 0x8bb02840b7a941c6, 0x65edff601ac867c7, 0x5d0c4c51f2a9cc9c, 0x00002d15df35d10f,
+    0xb9cf1a486d0ea4d2, 0x52db6204ccd35117, 0xea8eadfefeba4a35, 0x030f7b7c48abf218, 0x2ef2f7bfdfa00616, 0x5131b082e63e8684, 0x000041bc3c82f5e9,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_ONB_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_ONB_COMB_5_XY[] = {
+    0xad74bd6ab039c555, 0xfc811f855f809959, 0xff954ebbb6214d8f, 0x3a62445616dead5e, 0x2baa23681c710d6d, 0x1bd3272265ef7ffa, 0x000068dfa13acadd,
+    0x6f76bddf634a2790, 0x145a9983ce65f69e, 0x2206841669910f28, 0x62e229c5c5655536, 0x5986038bf977d1ce, 0xa3bc401a86574d74, 0x00003b2f6a74a12c,
+    0xc0e15bddb226e495, 0xfc4f2c0d02504172, 0x84dd84cc913d0891, 0xccd0d6db7e3fa3bc, 0xf4a7025574b54796, 0x7f66d5c93593172e, 0x000052c755c4e272,
+    0xddfa1673dff3a285, 0x222fd7a263897fc4, 0x64b2c829764a7ab6, 0x211591cf02938f67, 0xebc2b980675b2e35, 0xd11450597852fb92, 0x000004dbfa882fab,
+    0x985152c4ca2c14ed, 0x7a5ae4bfa24f25e2, 0x60d9a1bfc1ea4315, 0xc855effce73c3e38, 0x8393204726879d0b, 0x2169f02f6e58cb20, 0x0000768a1eff3716,
+    0x96238fb1f506375c, 0xd64f73ea3ead3303, 0x0dabd5311c8a0418, 0x913da50d35d771b8, 0x9a6aa4d80dd004d6, 0xdd08d54513c29e3c, 0x00003e0e237cb5ed,
+    0xa0538169878bd8e5, 0x41443c293209f080, 0xed5cd37ce42b16c2, 0x31daacb69b1b80a2, 0xb8746e4d3e4273e6, 0xb7e811b6efaeb3a0, 0x00006d0eb85e9c97,
+    0x36b473bb2c13d1fb, 0xbf10f08df3e18d19, 0x1d91e3003710ad20, 0x4ee590199d5a2c7a, 0xdc60adbb9ffdab1a, 0x3cf14e7753895afa, 0x000042b34059fa97,
+    0x0df8b7158f9e42ff, 0xb8e6c9c27d4d0671, 0x2c34c92360644164, 0x6ade6dcb2f31a300, 0x40a5d046672d6a03, 0xc6d8fbb234fba7d8, 0x0000291f941880f3,
+    0xd23b6447ccbeef0f, 0x627e322d1ce34c5b, 0xa0cdb5a58f54f456, 0x40f7a1211c7ad57a, 0xd67f9cab31d0388f, 0xfd1c3fc236d1921e, 0x000037c825871e36,
+    0xc0374761e0131fd1, 0xf594c27edb73d058, 0x2ff23de509575a2d, 0x5a5b1fd458e9cfd3, 0xede5a0ac0367aad6, 0xd99096b0e4e56eab, 0x00002657486594e0,
+    0x859ff44faba901d8, 0x3341282833d2942f, 0x22814e432d1586f1, 0xf84e40315b438259, 0xe63fdd6c9da0accc, 0x854c1266a4f837b7, 0x000049e78c77acac,
+    0xc585cbba54f3c21f, 0xf2f3b4d3d2566d14, 0x6bb203185434550d, 0xe5b41561da90d577, 0xc4fbf51e8038142f, 0xa4aa48377d9a0664, 0x0000453e724049a8,
+    0x095a2f05b3680d8a, 0x05000ea00191dd73, 0xe315e5b07ad34f9c, 0xa07def04c311fe39, 0xc75962db8167f23f, 0x7d800f44092ebe01, 0x000003a3e4142165,
+    0x66e5d3dd4bc4e24d, 0x71e7875257c6f3fc, 0x4716e44a8b31f428, 0xb4a130c5be2f5ef2, 0x2230da16d0bcf9f4, 0x80d1b56cdfcb30e2, 0x00001832538985f5,
+    0xd2475ec7594cad69, 0x9ab14789edb35516, 0x8bd63401ff9b450b, 0x50b39e59e2f9a16c, 0xe97ee3a2fa93b39e, 0x7488defbec5470fe, 0x00003635ab461028,
+    0x913fea7c491f0c65, 0xf7d83500a6ded357, 0x629075bba9ef28a1, 0x8c56bd08a59d0f2e, 0x91997a123872b110, 0xaca02d6af3f0cd4a, 0x00007833888c5f83,
+    0xe690a69609a561bc, 0xe49b21f4ca53bfa0, 0xfdd32ef495d59886, 0xf154c73cd09409e5, 0xc8c492305552d384, 0x2388a184bc8c5607, 0x000031be299f471b,
+    0x93516d1975b0f3c7, 0x6096e1ec85e5b5ac, 0x8f80d4ddcc8ceaf7, 0xae9982934dfb8d4b, 0xe7ef176e5b9f6969, 0x6569fba6be363730, 0x00000a86343f5237,
+    0x205801788f481f73, 0x34227ad3e3ee6568, 0x735e5481b54c7156, 0xcb5521c8f3f062c8, 0x273b3f94f2ed7e2f, 0x285b224fa8784558, 0x00000bf7b98145c1,
+    0x847d5b3f9c1a46ff, 0x3d0e0f41311c40ec, 0x12a961e1faccf465, 0xd331b8320fbc5337, 0xd43871f637cf5533, 0xc9c24d5aeebc2767, 0x00001bb94bdf14b2,
+    0x8d4966e615383305, 0xc7069b54738c7a7d, 0x80a2426c79eeba29, 0x688d3e9375306195, 0x8b139e94dc918814, 0x7e8aa4539a028b8b, 0x000011003a523f8e,
+    0x78aab6d529e6043f, 0xb091a12b5ef7ba88, 0x1fe90f1269fdda6b, 0x0dc44ca7dd11c2fb, 0xba8f57b14be15d16, 0x918eb23cad08c9c3, 0x000074b881caa96d,
+    0xe17861ada40cd872, 0x72cf499571c908e5, 0x50f0c91499c53bfe, 0x6457ea8e4a0ffcd8, 0x44dc591db1e6b4df, 0x598c8072c6996532, 0x00006742c641eff2,
+    0x82aa1237765ba32d, 0x260ecbbaccac7b20, 0xf0d47303231d1f26, 0x9b0db63f19f2f617, 0xac501c2f084b90d8, 0x726aadd50bc81ce5, 0x000002de393abc9b,
+    0x9fdf7331555ad887, 0x3a6c267518ef88cb, 0xf5026d303e51bdca, 0x713ca260ed337312, 0x043122aa2e77973e, 0xf260d1692f7e41e8, 0x00002db7b9a3fd8f,
+    0x58f77c30e80fd7b9, 0xaf2f33dcf7c44d1e, 0xbc457aae13fdcc3e, 0xd38a4b73661a3172, 0x14f1aba867dd4e5b, 0x8e52e63c1df11528, 0x000051720d33193a,
+    0xc4b4b5c4056b7c20, 0x4a396bd9744c4026, 0x20ef5619cebfbbb7, 0x067fb9d0b41181f6, 0x5cb5e1637eadd735, 0x96dd5a68138cf9e6, 0x00007543ea0b615e,
+    0xd16605c4859d0055, 0x2c07e47e1540b45c, 0x1c0aa0c5451cfb07, 0xddbb6397d376b5c9, 0xaa1c98130eefd4d1, 0xdf44b33ce95be29a, 0x00002f16693550fc,
+    0x2e3c76da13d5ea74, 0x2849de105a19f841, 0x164b33fe99d3e41b, 0x04a794c24697f9be, 0xf86d4a169a451b57, 0xcf03b28541237f2f, 0x0000122ad4229186,
+    0x7a3db513502f16af, 0xc7e659454be65b43, 0xe8f52c2b07f554b0, 0xd41748b0e635d950, 0x2feb08ce40339ede, 0xe6d042570b762596, 0x0000569c26fd3afe,
+    0xce6fdc443ce394fa, 0x99d5fc0dc3387dc6, 0x00429f7ba7881c5e, 0xd5434d233a6c60d7, 0xa523b2207517b50b, 0x9d0e260812013dac, 0x00002a35cd0cd546,
+    0x068c7a823d0c9733, 0xb5f44bb1fe3a1a2e, 0x68e66e2c8b04ff68, 0x25c4021355afd09b, 0x86dbb24e7d07e4d8, 0xc9acc9796faf5464, 0x00000d24c2adc5d5,
+    0xe66a2108bb145474, 0x78f87db1d95d9f48, 0x59f0c6c14e8de516, 0xe89bd08b4a131484, 0x4965ca93b3577391, 0xbc51b6bf82003d8b, 0x000030bd88fedbff,
+    0xa614db54b1b780fb, 0x4e9ed51315e3abe5, 0xa02402daaba26c43, 0xf936afda3486b977, 0x6a79dd85763f4b0b, 0x7873b7a7a49cb26f, 0x000018eb967f6b4b,
+    0xb9b9bf977efcb7c1, 0x388cf47b8fe9e0f5, 0xed5f6290e34ac6a1, 0xee3523e645d77771, 0x6a863eaa0a734967, 0xa19c0d557cff4d7b, 0x00007292a363ad7d,
+    0x08109922ca75b5e1, 0x3c17c1a392017a55, 0x3c65b462e73c7951, 0xc5e7340fe22841e6, 0xbfea178b95536beb, 0xe90010dbd267437c, 0x000012686d01000e,
+    0xa85348fa6a8392af, 0xf5d33b29e2195b12, 0xd3c568f7a03accf5, 0x76111a3dff2fb7be, 0x8bb1b01c8a10de19, 0x5597c994f016518e, 0x00006e2260482928,
+    0x4c841ab5b7dccc09, 0x5f8e9192d6b6e352, 0xdf1c850a87bab54c, 0x3b59f0470ce35cd1, 0x885b5ff854d99dd1, 0xc9ae8ec5bc483b83, 0x00001600642b1705,
+    0x5f8132b058768660, 0x9d204ba8e3f11f96, 0xb2bb53cab733bc8d, 0x48783820955bb006, 0x21449c3f1066a745, 0xf3a605edd9041a8c, 0x00003d80b56bc2d8,
+    0xa46749bce491d7b1, 0xa79af279517e9aa5, 0x35beb52ee0cb9e53, 0x2dd3d8fce7d90bd8, 0xb322082c5646a951, 0x444d41d20e5fe0c4, 0x000006f05b37ae41,
+    0xdfad569da9daac9e, 0x4fcdbda6575473a1, 0x7253bce8ac075b41, 0x5f5c7401ed1d6f43, 0x5b2f566b0fc28db9, 0x9dd771844dbf1cec, 0x00004a043b0c43a0,
+    0xb8b97341345689f7, 0xb06a86c91f0b1fad, 0x41f015b60e46508c, 0xbaf5d0e4c8e22e59, 0x7a7b265fbea7b00a, 0x6cc8342a961b033b, 0x000007fad83c0154,
+    0x35db50525690bdef, 0xd17d9e4729ef2e51, 0xd1db421b929311f1, 0x3bd5ed3889ed28d4, 0xf63d393c2db2a8fe, 0xfeebd033e29d6b3a, 0x00003eecc1cd738b,
+    0x3e4fd54ca9f96681, 0xdbed908e7abad899, 0xe7eb6ca8c4d016ec, 0xc53181c38a5a14b0, 0xbd8899121d6fdee9, 0xc2846b38f0133609, 0x0000642c82e1d649,
+    0x26ecc96ca7312421, 0x664ad8b662042ec7, 0x50be10bfd132792b, 0xe2e19435be6fb503, 0x913b31d76cfbf9ee, 0x6b666fd13bf43d69, 0x000079fc8927354f,
+    0x4f0f9c8e94ba8451, 0xf3b2a2b795242bf1, 0x1d0ebafedcdba016, 0xef25f807a2c86849, 0x3c5da029933b509f, 0x23311ee317a7c1e6, 0x00002f133435dc3e,
+    0x5d478bc2a44798cd, 0x9956d583bbd000af, 0x665d2d5afe412e25, 0x6fa368d35478e0e9, 0xa73018fb9e926407, 0xe91023ba008b76ba, 0x0000741676197d90,
+    0x22669f5ca5fc8b8b, 0xf77272ff7394d526, 0xb7e2ba90499668b9, 0x824b5a0f251a72bf, 0x760fec83a460941c, 0x14a40ded134f9dc6, 0x0000361fb7399c83,
+    0x9fa3c00d8b94817a, 0x653478160fa833ff, 0x9c19850a98ef3263, 0xf30e113f8c0d9050, 0x080419ca26617a8e, 0xcd6bf13b2143c153, 0x00005351735c5db4,
+    0x7256b45760e9fed5, 0x0042462d378d5450, 0xc9ed52ab1661c041, 0x3ee978089d7f2912, 0xc302bccbd68aef3d, 0xa815af3b8edb8afc, 0x0000507e3e6f0d66,
+    0xdd688c06cbb28eb2, 0xf05f145c02144e19, 0xeb1fdd773c8cd0c9, 0x151da538354738ef, 0x634fbce9c6786f77, 0x9ac0960629fe66e2, 0x0000013095ac8c31,
+    0x930d6dd0ec9e9fc5, 0xd70d8b0217d78c2c, 0x543c3b4b6becfc84, 0xca1cd651aadd78c4, 0xcc5a5efd9c8c09dd, 0x7a009d364173ebbc, 0x0000220eeeeff0d5,
+    0x7e5004f7eaa57c7f, 0x5f56c3ef5eed2628, 0xc861354add490bea, 0xe8526e6d47d90134, 0x33200cd1a7d73d16, 0xb464433f0d1d6e8c, 0x00001e2c5a72b66b,
+    0x74c65c5b42f35aab, 0x9461369e71214796, 0xedbba8cd35d63bc4, 0x8600b32610de8f4f, 0xcf2cf3c09f448c01, 0x735c072c79c15c4a, 0x00005eb78a00f265,
+    0x6009e52d529e34d4, 0xed59ea942f6847f1, 0x55b4f0aeb3c504c7, 0x8848f9d1c113f1d4, 0x2000b44974527005, 0xfbb173bdbbf674ee, 0x000052554d769970,
+    0xc0bdf182e7e31001, 0xe4b340f12b0ed265, 0x2b82482305ab14f6, 0x94c6b3d70734f83d, 0x5059818f7355c8f1, 0x20d1d828c7a840f0, 0x00002df8f36244c9,
+    0x5f2af2be9f51e1a2, 0x018aefeb7e6cfdd6, 0x8b2031205cb156a1, 0x6bde20fd98848454, 0x5ea87071fc237854, 0x63cb75704a5ba1c0, 0x0000153b7b565f19,
+    0x2ad525cb141396e3, 0xf15c311e7e49fff9, 0x3de1c92f4eed3b40, 0xa74fd9060850708f, 0x222a8c1a3f57e315, 0x472814286fce6495, 0x00006070f9ca69e7,
+    0xb7655c6e1f06ffe5, 0x50d1ab802f1570f2, 0xf55040883e87dc67, 0xda34fdf1645d603d, 0x4a270d0fc6db3a94, 0xcbacae977dc4a6a3, 0x00004e6194f9e57a,
+    0xe4ec5eaf02584013, 0x74fbfc1fa71612bc, 0x152a44a16d5f39b8, 0x6d6fedeb8e1b2f18, 0x0f298cc21cac7392, 0xeb43352b7c14bbda, 0x00007353b222350b,
+    0xb1de9f42a742c7ac, 0x5a68acc7ac950122, 0xd9fffdc0fff2d91c, 0x9c203f5977bd6517, 0x746de679d54ca19e, 0x63ff14c5f9703ee2, 0x0000355085ce5309,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M431_ONB_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P192_WIN_5_XY[] = {
+    0x0d8cb30c332fa108, 0x8a4bd3f776d12909, 0x954cc8f9f3d218f7,
+    0x7b12a3371e422289, 0xde22b5248966f05e, 0x6a293d836aeda84d,
+    0x56b3fd7f230c0249, 0x3386809f42bebbf4, 0x53b5ad45770c581a,
+    0x6be17b497fb74b1e, 0x16445c4850d91fbd, 0x228f18e243dc19c0,
+    0x69bca7841d8490a8, 0xa7c435204d92a6ad, 0x4ec31c347012b11d,
+    0x6261825c843e401c, 0x102b7a936a65a2da, 0xdf00083f2d96f43a,
+    0xeb8ad91fe5efca73, 0x4c83fc441650b841, 0xeea07d43a63ebb45,
+    0x2c8262c8cc6ab309, 0x44a67081ca1e7327, 0x6fef6d8866147372,
+    0x9f27848b449ce446, 0xedc613b6ed6f60e4, 0xd028dc5c33ef2855,
+    0x32bbfe7f97566f06, 0xaee52dfc529bebe5, 0x7dfad9dadbd304ac,
+    0x44a299ccf19ed4f9, 0x5ce790e33ec18b4b, 0x34de50ac3898e8a1,
+    0xa2641e2f52948777, 0xa5037393538eff35, 0xf1b6bb3238e46331,
+    0x153f3b780f8904a9, 0x44a7bd9614a75349, 0x4093735fd85d4a3f,
+    0xed1d5ed03f7db015, 0x174975f71fff90b3, 0x9838d562dcd47496,
+    0xc373e084b0cf681b, 0x7da927376610b602, 0x46cadc98f098041b,
+    0xd3e0adf86cdec872, 0x50d43591a7842f28, 0xa35efdc3cdf46778,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P192_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000001, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P192_COMB_5_XY[] = {
+    0x0d8cb30c332fa108, 0x8a4bd3f776d12909, 0x954cc8f9f3d218f7,
+    0x7b12a3371e422289, 0xde22b5248966f05e, 0x6a293d836aeda84d,
+    0xd808389602fe620c, 0x277803e8de8984fb, 0x2698ed9f7058d34c,
+    0x00b9c0d3bce1dcc3, 0x356b310ebc2c1c85, 0x41e412dd67cacabb,
+    0xb096904994b2c90c, 0x675397776bd5869e, 0xa48ec61e0af1e807,
+    0x39a86bb13342a74d, 0x48f553c01338d1db, 0x2e2bd4d26aed6053,
+    0x98e5a9fd29a801e4, 0xfa4d3abbd84bf0a4, 0x8f4dc6f82c426bed,
+    0x9decebac1b83f02d, 0x2756317731afcc78, 0x25efdee028657c91,
+    0x3962cd5e8dd2ac55, 0x4d3bcc4380e9da11, 0x522b3d1163277311,
+    0xfa67e3176bdc28d2, 0x81e98d789314e04a, 0x9b92b88a360feeea,
+    0x16503524fa069e7b, 0x5b5eadabb31620ff, 0xb95ae5cc275d737f,
+    0x4da1c9e1920206db, 0x8e3bc7f1b4bd35d4, 0x50b87370538679c7,
+    0xb753573afbc266f2, 0x22473e4a93d83b30, 0x2d1f8718cd860612,
+    0x8f627538b8a6446b, 0x7ce9662b45ee5b83, 0x988d96a2f946e662,
+    0x2a3e44bcc3978c89, 0xbbc696413724d81a, 0x8cd0bcf68e42053e,
+    0x9a84e877ebd9205c, 0x6c153f898bbf687b, 0x730b14c7dee7732a,
+    0x059fd6233b6faae6, 0x5eab3c854dc1a6f9, 0x3063c117b2e53ce0,
+    0xad904bb476b507a3, 0xe73d878c1a523e7e, 0xec16e6803da2728f,
+    0xdf33985d48395e38, 0x2ec88aa6273b0488, 0x8c84ceb8a212588f,
+    0x68aae2b1442eda9d, 0x7c4ebd8109221d25, 0x526ed2ac77c901fd,
+    0x8097679010087a00, 0x6714bf56493ae017, 0x487e510bfb6906aa,
+    0x6c2f77d6f868c3c8, 0xf5a5ff7b3a5273ed, 0x65cc9e9ef3f88438,
+    0x5fd51626080084c5, 0x62ea30d1c1fc62ee, 0x1ae602a3b5233c9e,
+    0xa1c70e8270fb967f, 0x060c5778d4ef57bc, 0xd6c8ae026770dce3,
+    0x36468ff846025821, 0x4b4e45400b5845d3, 0x445c930b5985e3c9,
+    0x83a734337a065538, 0x366f89e6464ca0f1, 0x0821bb3cb977f9f4,
+    0x02c6962905335faa, 0xc1b7afb97dc8d2d2, 0x7eadfc41e1e4e116,
+    0x11635f79de9536c4, 0x70a9c3a48cd512f2, 0xf47340938732c246,
+    0xf3a5b6328a2508b7, 0x646e572da43204c3, 0x208360688960f9f7,
+    0xcf78e19e9a7e16d3, 0x15a834bec6d38542, 0x77dc51284355d516,
+    0x377d1c96c2e1ab9c, 0xc4d44912f02f335e, 0x91a1b45317483b67,
+    0xd87bfb050a35ed35, 0xda51aa7f06388074, 0xe8eded683bc985d2,
+    0x99e2376b217d86a5, 0xfe96cf612216abde, 0x31517799e77f99d4,
+    0x093a68d94595a214, 0x6d1151be84142277, 0xe714275eae9d2e45,
+    0x88e06f9a85e53b55, 0xe0c5d2e3b8a16c4d, 0x1891c9f2c95d7401,
+    0x6a73b3ddcb50d149, 0x58906ff52952e29d, 0x086a5779bfd97750,
+    0x14f59d22c54e6395, 0x7d099d480919bc31, 0x00683305555ea6a2,
+    0xf6bcf50fc5fd4e4e, 0xde9df70b779e91cb, 0xcce4c4b3c2fc3f24,
+    0x7bba18ab3420d0dc, 0xfc7def2b97f6c156, 0x3c1e33b80a3fefb2,
+    0xacc8eb234585a32b, 0xf17c6f93eda6ea11, 0xf6a15b627e8d6caa,
+    0xdfe7e6ed844ad972, 0x45307cd22d1ece91, 0x126b008406ada375,
+    0xff3333ddd80a3b46, 0x7c8bda3cd06c77e9, 0x8d57bd9c82c8ab11,
+    0x78281a43a37dad7b, 0xee33e17e4adc78b0, 0x14f2ee56e1041f32,
+    0xe6d9342d629d1866, 0xcfa4d472588abf86, 0x0aa7bf5fb254f91b,
+    0xc80ed5aff4721f6c, 0xa672c07fd68a1e2c, 0xbc169fadf8e15035,
+    0xbd8dcf09f2d8de3e, 0x1d9526807d9e6591, 0xea451bdca68ba739,
+    0x17f8b35d79ce383b, 0x02ae2ea16d9d868a, 0x043d901e850696fa,
+    0x42c4c0046be1a51c, 0x2fc958ad446ebc6b, 0x34f117f0087aaa4c,
+    0x7f6f9743d7561ee3, 0x6f46685fd7532c3b, 0x5610c0d0c3cd8813,
+    0x377e8fca990c2a1d, 0x4e8072d0bf45effc, 0x0e37429c229ff1c1,
+    0x60cf8db046f4e915, 0x0cbe5b60f8bf8439, 0x1754316661499362,
+    0x6482adef366d83e2, 0xf0e428c09ecebce3, 0x6cbe83dffd75c39f,
+    0x8ac21e00d0e4f9ba, 0x230926662fe5692b, 0xde03cecccc9099d4,
+    0x0d630e40998e922e, 0x0fac8922919aa9ab, 0x7378eaed87125c21,
+    0x16e2f8ff3bc55eba, 0x2f5b68bccea9d0f8, 0x5663f0e9710a9c34,
+    0x95911d0db881fbfb, 0xa6774acbc0332544, 0x6babaa15ffcd4cfa,
+    0x18bfa211669d58e3, 0x4b91b9dfa63e9c0d, 0x2fb74f50ac735087,
+    0x27e5023b4d9eddc6, 0xa659316f5890744c, 0x20c3a6bac59c3801,
+    0x8f0f9628005d8b22, 0x8497b232ae0cd816, 0xcc817c54fbe4b992,
+    0xfcce8282af1492ff, 0xf550d3f65a23206c, 0xc43c3951a15f149d,
+    0x1d103827f2adaf50, 0xbc2a4314f1775b82, 0xe752c2c49087db9d,
+    0xbc1ad0ffc96e240a, 0xcf2f0e30db6be29b, 0x2fb0083242e633ea,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P192_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000001, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P224_WIN_5_XY[] = {
+    0xbc9052266d0a4aea, 0x852597366018bfaa, 0x6dd3af9bf96bec05, 0x00000000a21b5e60,
+    0x2edca1e5eff3ede8, 0xf8cd672b05335a6b, 0xaea9c5ae03dfe878, 0x00000000614786f1,
+    0xe37710d786614a9a, 0x24c17ffce0b02223, 0x00505bb6c3cf1c5b, 0x00000000af8b6496,
+    0x9a73b17373e4e25d, 0x7050163204144e62, 0xafe10c35357940ac, 0x000000006dfa492c,
+    0x0b10cc50d42fac58, 0xd80cdd0af8dfc283, 0x39211b77975a451e, 0x00000000f7f4fe95,
+    0x2b552e7364fade9e, 0x5e5610f361a9e695, 0x42b54f7911bcf038, 0x00000000c858da82,
+    0x90462820899abac2, 0xc6adf68368646e35, 0xc81df8121e2526ba, 0x000000007ed50814,
+    0x610f21855dd6407c, 0x3f3879aa1fb32889, 0xce5eb25eed8ceeee, 0x000000000e5952e3,
+    0x1c1ecc777b94d3c7, 0x23767b5f743eda4a, 0x94f5e9ba2f993a50, 0x0000000079d4095a,
+    0xe07e55b68f776409, 0x2b57fa61909bf3f1, 0xe733d62777e1db6d, 0x000000005114ac9d,
+    0xac358ca86c6825d9, 0x71f50674e1bdd5ca, 0x0f060758d0dee306, 0x00000000d6d89093,
+    0x649ea142f1b7227e, 0x87d166a208181c2c, 0xc1182bf06c63713a, 0x0000000045e48d79,
+    0x489c8db23a1f6a38, 0x4943a5aeffbe563f, 0x68ade63cbc99fb0b, 0x00000000398eacf0,
+    0x83fdacb5ed549cc4, 0xb6ab4a8b800df824, 0xb4dc6bf8442ed616, 0x000000003f8060b4,
+    0x55bfd519e977f339, 0x5cd307d1b16ed1af, 0xc5e26f62d91345bb, 0x0000000064a35d22,
+    0x05015842a243f1ee, 0x6fa10db370203aa0, 0xdaf3972b05a83a63, 0x000000009422f10e,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P224_WIN_5_Z[] = {
+    0xffffffff00000000, 0xffffffffffffffff, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P224_COMB_5_XY[] = {
+    0xbc9052266d0a4aea, 0x852597366018bfaa, 0x6dd3af9bf96bec05, 0x00000000a21b5e60,
+    0x2edca1e5eff3ede8, 0xf8cd672b05335a6b, 0xaea9c5ae03dfe878, 0x00000000614786f1,
+    0x8a1c84ea050b6e45, 0xc2315710c38a15ff, 0x67d1f3e45b502e99, 0x00000000f85c7d6e,
+    0x7c34a744d3018572, 0x8b89ec4794062e0f, 0x35f7a2669579c983, 0x0000000063ed902e,
+    0xcc63737e73e89fc3, 0xe7ea972c7a8ad943, 0xd9f30d9dd18bc774, 0x000000006074f425,
+    0x371d911f4b75f9c1, 0xc54bbddcb367f509, 0x3368422e5abb75bf, 0x00000000b36cd789,
+    0xe4d85de62ef56139, 0xf2c33f4b0b0acedc, 0x04526cb66091bc19, 0x00000000ac1ce3ea,
+    0xb54024a624bfc4bb, 0x909d86a257196c24, 0x1b1d5d2a42e04322, 0x00000000bb31992a,
+    0xe4edeaf15691e35c, 0x89e26293a844f59a, 0x903a1978f7781238, 0x00000000aa50a64b,
+    0xc90d58a2df9054ba, 0xffdef256cb8805f4, 0x1494a71402793f49, 0x000000001d785dee,
+    0x44f54c5bf8dd749c, 0xa269412291af2f44, 0x7adde5f4828f26e4, 0x0000000022290a7d,
+    0xcb94674654ae096f, 0x99afc762862927e7, 0xd21fca4665f6bcc0, 0x000000003e954dfd,
+    0xf094200ede828eb1, 0x13f7d4cf744c771b, 0x80cf3b2492649785, 0x0000000070aed01f,
+    0xd837a0e55145337c, 0xbf45a5d0208d8bc8, 0xbadc120e2f77ede0, 0x00000000782d4288,
+    0x433a33e9f611c717, 0x5f8001f92417a7ce, 0x7a6ca2981d9155b1, 0x00000000d78e16eb,
+    0x3ab289c1c11dfcf9, 0x14996507ee48adb0, 0x8dd6fbf2c998c5c9, 0x00000000959f66af,
+    0x2ba2a9b709c9ba78, 0x7153f8aeeab0698d, 0x5c4c384947b668da, 0x000000000d0e7547,
+    0x0da53e247db0c9ff, 0x5c85a4e05a5689d8, 0x3da732960299a07b, 0x000000005aad3a87,
+    0xfdfeb38b9c36e9c1, 0x1f86c45c52412e8a, 0xdf23863473344088, 0x0000000017ff4430,
+    0x7528ad20b266b3b2, 0x4043a6fa874600b8, 0xbaad05acc963d97c, 0x000000007856f142,
+    0x316a3332261d7039, 0xc5ad8d51d27dc877, 0xfb7a14942edbfd8b, 0x00000000ddf232c5,
+    0xa6951b5390aa1301, 0xc711e6c7db4749f6, 0xb7e0dc2076301695, 0x000000006a7aa166,
+    0x6ee3943e88e156fd, 0xb0c385922d456997, 0x80142d1df2a99c70, 0x00000000306a14ea,
+    0x377f931b800c55a8, 0x37c61739ebe6465a, 0x71ec21d821c4c0c7, 0x000000007f669845,
+    0x2603943017fd2a5e, 0x48d0c60dde96cf39, 0xc85bbc26e1fc798f, 0x000000003ab0ab1c,
+    0xd69fba42bf02814f, 0xfee18ccc7137ab0c, 0xac20527c0fea1114, 0x00000000141a9cf5,
+    0x43d9f092c38f70e9, 0xa246934e7626ddd1, 0xe8e12a326dd48d9e, 0x000000008e4f3e63,
+    0x520edb7f6d80c575, 0xd5f1e139a22c38f3, 0xcd9c266bbc435fc5, 0x00000000afee6cb8,
+    0x1b8359768d60f421, 0x814c968af5b9a7ad, 0x99d1b82fd8199c7c, 0x0000000000090a66,
+    0xe0d33f9c466594d1, 0xfcb8542232f5b3af, 0x5c37c8c45de5560f, 0x0000000034058ab1,
+    0x8fa02752db846749, 0xc21478c8fcbae4b8, 0x22632d48cff78948, 0x0000000070d86a48,
+    0x00132e4fa8b86e1b, 0x0457eac23721a7ea, 0x0c2cbce2dcc0060a, 0x0000000038fb42c3,
+    0x536474716b7337fc, 0xec2e2ae0f353d46f, 0xc4090b2234c98d65, 0x00000000e3bd0642,
+    0x75f67d3a4852b9a4, 0xeb48379ba4b7bb4f, 0xe35fc85eb97190fd, 0x0000000046bd5fca,
+    0xa6574247958e4512, 0xbb0e0cb901b61b9a, 0x447951907925a8a4, 0x000000008e172f5c,
+    0x61e9c91484ee8b4e, 0x1f24f6b78eaa1df2, 0x9a88152ffa0a16d1, 0x000000007d93f329,
+    0x6da3965b0db4ad81, 0xcf4733a7460d37e9, 0x9fc2e4c3dfad0a25, 0x000000004d6546bf,
+    0xa66174de464cee24, 0x1a8e456f2190f3bf, 0x7175f5d91665e1b2, 0x0000000020e829ca,
+    0xec2b52500a4e720f, 0x840a8c1c9ff0d4b7, 0x79bc864920b95125, 0x00000000fa22edec,
+    0x3b455e15645cf441, 0xbaa0cd1f3f102fb5, 0x65d123b968f67cf2, 0x000000008e214718,
+    0xcc03148ca9ccc0ec, 0x80ae0cd017aa0745, 0x442db49f00c785fd, 0x00000000ac184346,
+    0x3fa45bbba7e413a6, 0xc15359cb98c60ecc, 0xaa72f96993c42209, 0x00000000f22afd48,
+    0xaca401dfbf1dc077, 0x8934cb6a2bd1eaf5, 0x7282f6d842f8e743, 0x0000000098539aeb,
+    0x870b0e1d21d8ed5e, 0x8b8e913966d3504e, 0xeddb5279ada349f3, 0x00000000a02d873a,
+    0xf685aa97455957b7, 0xb71751b4bf8c1c22, 0x285a8355cf56c448, 0x00000000d07460a7,
+    0xc6a1c3b586a80a58, 0x2af8ce59f088dadf, 0x2c101aa5d98e0944, 0x00000000ee9d852d,
+    0x0e9e978e56763449, 0x720dde4f1b43cc87, 0xb145646f30edaed2, 0x000000008caeddbe,
+    0x64d22579866ec5fa, 0xdf2f5f81da686843, 0x8ec8ed3caf6b647b, 0x000000001ec6647c,
+    0x36be9fcebc4a484c, 0x5bf5d0783e1da130, 0x5d2b1a546ec15bd4, 0x000000001e3d87ac,
+    0xa6efb9e3f42a8fcb, 0xc9cd091eccec94fa, 0x345b498060b39c87, 0x000000000ccbf8a8,
+    0xb792547579ccc865, 0x80c22c2aa695e905, 0x32f82566b1f67e0e, 0x00000000fbecef75,
+    0x2ec7e6ab1cba4321, 0x4530a349f8ee6a74, 0xdb87e6fe8ea6280d, 0x000000005ad928e0,
+    0xc37400f94a116042, 0x867a5bef3da62a21, 0xe8f8dd2ba8858834, 0x00000000a6c03072,
+    0xb6aca2fd7bf251b1, 0xbeb9e60c20dbd03a, 0xf821e49c054178ca, 0x000000004089db65,
+    0xe5a307de00f678d7, 0xb066ee04e9f851d2, 0x9c6557d9fb4e8078, 0x00000000f0713cd2,
+    0x06f4fec6284d5d28, 0xf7643cc5b38ce52a, 0x41557fcc96618724, 0x000000009ac45fde,
+    0xb843fa8370bf55ec, 0xe57b488857554208, 0x056936547091bdbe, 0x0000000071eece56,
+    0x3c749130dcd5fa8f, 0x974a2873be186a41, 0xc68a33a16c318744, 0x00000000ad851d17,
+    0xbae83c0c9c2032c4, 0x7f0602d01611c878, 0x4e6632982cc6cbc7, 0x00000000e08fa2f0,
+    0xa3cb3e4cf49318fc, 0xfbcc7a9e2abe5111, 0xc62aa57f5477fd76, 0x000000000e6fe35b,
+    0xe4fc8b2dfb29ac8f, 0x00bab351bc9b4e74, 0x17c70741e92f26de, 0x00000000a519030a,
+    0x03db001c066606b3, 0xf9ea47b83fdecd70, 0xb18b448c3c92a634, 0x00000000aebd17f2,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P224_COMB_5_Z[] = {
+    0xffffffff00000000, 0xffffffffffffffff, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P256_WIN_5_XY[] = {
+    0x79e730d418a9143c, 0x75ba95fc5fedb601, 0x79fb732b77622510, 0x18905f76a53755c6,
+    0xddf25357ce95560a, 0x8b4ab8e4ba19e45c, 0xd2e88688dd21f325, 0x8571ff1825885d85,
+    0xffac3f904eebc127, 0xb027f84a087d81fb, 0x66ad77dd87cbbc98, 0x26936a3fb6ff747e,
+    0xb04c5c1fc983a7eb, 0x583e47ad0861fe1a, 0x788208311a2ee98e, 0xd5f06a29e587cc07,
+    0xbe1b8aaec45c61f5, 0x90ec649a94b9537d, 0x941cb5aad076c20c, 0xc9079605890523c8,
+    0xeb309b4ae7ba4f10, 0x73c568efe5eb882b, 0x3540a9877e7a1f68, 0x73a076bb2dd1e916,
+    0x0746354ea0173b4f, 0x2bd20213d23c00f7, 0xf43eaab50c23bb08, 0x13ba5119c3123e03,
+    0x2847d0303f5b9d4d, 0x6742f2f25da67bdd, 0xef933bdc77c94195, 0xeaedd9156e240867,
+    0x75c96e8f264e20e8, 0xabe6bfed59a7a841, 0x2cc09c0444c8eb00, 0xe05b3080f0c4e16b,
+    0x1eb7777aa45f3314, 0x56af7bedce5d45e3, 0x2b6e019a88b12f1a, 0x086659cdfd835f9b,
+    0xea7d260a6245e404, 0x9de407956e7fdfe0, 0x1ff3a4158dac1ab5, 0x3e7090f1649c9073,
+    0x1a7685612b944e88, 0x250f939ee57f61c8, 0x0c0daa891ead643d, 0x68930023e125b88e,
+    0xccc425634b2ed709, 0x0e356769856fd30d, 0xbcbcd43f559e9811, 0x738477ac5395b759,
+    0x35752b90c00ee17f, 0x68748390742ed2e3, 0x7cd06422bd1f5bc1, 0xfbc08769c9e7b797,
+    0x72bcd8b7bc60055b, 0x03cc23ee56e27e4b, 0xee337424e4819370, 0xe2aa0e430ad3da09,
+    0x40b8524f6383c45d, 0xd766355442a41b25, 0x64efa6de778a4797, 0x2042170a7079adf4,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P256_WIN_5_Z[] = {
+    0x0000000000000001, 0xffffffff00000000, 0xffffffffffffffff, 0x00000000fffffffe,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P256_COMB_5_XY[] = {
+    0x79e730d418a9143c, 0x75ba95fc5fedb601, 0x79fb732b77622510, 0x18905f76a53755c6,
+    0xddf25357ce95560a, 0x8b4ab8e4ba19e45c, 0xd2e88688dd21f325, 0x8571ff1825885d85,
+    0x83f49167ceca9754, 0x426d2cf64b7939a0, 0x2555e355723fd0bf, 0xa96e6d06c4f144e2,
+    0x4768a8dd87880e61, 0x15543815e508e4d5, 0x09d7e772b1b65e15, 0x63439dd6ac302fa0,
+    0xf2675562a0be5d0e, 0x4b524d254d1bb068, 0xbc2c5ff2a9b75b8c, 0x4f326643d9a6f548,
+    0x50dd68441258835e, 0x7d21beee676090e0, 0xb0b62c65f4a17b42, 0x60dfae28b3cec3b0,
+    0x20d3c982cf7d62d2, 0x1f36e29d23ba8150, 0x48ae0bf092763f9e, 0x7a527e6b1d3a7007,
+    0xb4a89097581a85e3, 0x1f1a520fdc158be5, 0xf98db37d167d726e, 0x8802786e1113e862,
+    0x531e7b64b113f918, 0x26b5d70a920a681d, 0x04e52f8f24c37044, 0xbc7c9542bb7c375b,
+    0xb63a044bf2e26375, 0xd842a342e922a3d0, 0x9eed2ecaa9292d57, 0xfe27d2c249ac7832,
+    0xedbd7944f24aab7e, 0x56e51d9ecd1a1921, 0x11c63188962dae55, 0x37090565326acd14,
+    0xc436e587d71ed134, 0x3d96ac3aad89b461, 0xcdf570bcdcb718bb, 0xaaa490e9dcfabde2,
+    0xb0ab54010b639942, 0xa6e12f5719379664, 0xc535f8b41d040abc, 0xef255c54a75eef24,
+    0xb236f734aeceb0ea, 0x38fcc8c19d879e2f, 0x674d8fdc180cacab, 0x0a18bad4f624df06,
+    0x488f1185ca8d9d1a, 0xadf2c77dd987ded2, 0x5f3039f060c46124, 0xe5d70b7571e095f4,
+    0x82d586506260e70f, 0x39d75ea7f750d105, 0x8cf3d0b175bac364, 0xf3a7564d21d01329,
+    0x83fc809160530d0a, 0x58c24f527bc23dc8, 0xecde2f1fa653af5a, 0xb2e2a374b10e511e,
+    0xf0c54b329bebe1e4, 0x239c25dfade42270, 0xd866f55e9f22b433, 0x1e513ca2ed17efd3,
+    0x66313dc85bc98e0d, 0xb13fe4e69a256888, 0x74816589ecd6e280, 0xdee13cde5ba88474,
+    0xae4e1872c53bc78d, 0x9b79904a2f08a464, 0xef6e5ce29da51935, 0x9e58df82083c47ea,
+    0x4e066713f5a32632, 0x431f75d44b36f498, 0x40ae279f70bd5f07, 0x252cdb93239ec23d,
+    0xc18dddf87312a246, 0x5b77673c23a9e561, 0x020f09c31715fede, 0xabef6451a580cfc5,
+    0x3c8bc3bff2a0d962, 0x59f856ee3405a8aa, 0x2fb6590cb3dc5948, 0xc8aa740ced85740e,
+    0xf8081cfbe9aafe19, 0xf7d2e1f32534800d, 0x355148c28d78d247, 0xaf0dc5a4d1557399,
+    0x34dfbfc4c7f68782, 0x2c6a80d608ac2685, 0x5479e1bc08d0255b, 0x42eb9de09110c616,
+    0x97991dd810b4acba, 0xf36acc8f94d997c7, 0xd05ad78b69ddc036, 0x1ac7e528e68b4243,
+    0xdd9f8a00e82c8e2a, 0x104b85c621f80126, 0x1997228d5b17a522, 0x706e5ec3923d0bd0,
+    0x00c6af271dc33622, 0xb3bc76c8271f09e1, 0xec1b7c0be36e325a, 0x128200e268f12bfe,
+    0x8e86cb3da8636d07, 0xc79c42ac2be46da2, 0xed70e08aaa01e0e1, 0x773579fce3b69272,
+    0xbc0fe5554d8464c3, 0x9e87a057cf54e071, 0xda655b0a3913b1d3, 0x052774d49a55dba4,
+    0x75d9bc15adf7cccf, 0x81a3e5d6dfa1e1b0, 0x8c39e444249bc17e, 0xf37dccb28ea7fd43,
+    0xda654873907fba12, 0x35daa6da4a372904, 0x0564cfc66283a6c5, 0xd09fa4f64a9395bf,
+    0xb1f5c026e37542ca, 0x0b860cf372e01034, 0x3a7c10e4025289f2, 0xd2197d5f92901032,
+    0xfa06f835267ca2f6, 0x8fcb9a29bf6e43aa, 0x465f6c117ed9f8e7, 0x8a50a5b3e6077aaf,
+    0xad76c703d2b59e85, 0x0a2306459204c53f, 0x9bbc0bc44a9f1335, 0x71603515d0a967e9,
+    0x8b6d6d6ea0205375, 0x6310418351ad76de, 0x5abfbc21aabbd0ac, 0x61fb45c3c71f3060,
+    0x579345df1d323961, 0x45b79ead94cd3bc4, 0x50b664be423668d2, 0x19dd5b7542bc26ea,
+    0xc7c1fbaa3677ae8f, 0x7b2e711a5d033158, 0x8aecb50a8942ac93, 0xe255438b8a16718c,
+    0x8025364233396533, 0x82cb33a72c5ad150, 0x7c147998070ca168, 0x077912536aac6636,
+    0x160003ae7c78be24, 0xbba9fe68a30eeabf, 0x16c31c403073f0ed, 0xd329cd28789caeca,
+    0x840dbcbf7972bcdf, 0xb5c8444fbd11900c, 0x78b2b29016520cee, 0xe19f13a3be88d914,
+    0x052ddc8949d3c0df, 0xc9fc183ce0b4224b, 0x2c8dd074cf31e0bb, 0x872c7b95a26b1441,
+    0xed93585d74c8a327, 0xf2fb7d0806be87ca, 0x707d83ca84e36244, 0x037f499d3efa6833,
+    0xf3218d4299bf5dde, 0xbe0a81c069ff7ce3, 0x068fbbea9eb7d4c0, 0xf4ef6609e6938c78,
+    0x202e5c5acb22715e, 0x88e93d23288f8243, 0xdf1d1f52dc7eace6, 0xc6b38b3b373183f8,
+    0x77798b7f3eac9c4b, 0xa9d37dff6bfa9835, 0xaff4a447faac41c9, 0xf14fd13c0fcb6036,
+    0xef5ee27d49ccc093, 0x7ff3263d40d359a3, 0x885d1942c6d6c0ea, 0x925abba328c97fee,
+    0xd73834805d95f52d, 0x6979981c4eb691db, 0x6544e8ae553a29c6, 0x28324ef85043559f,
+    0xd6c8e4b7300c0e39, 0x37ad4a1a3e37f58a, 0x763330f5e5e8cdfb, 0x62bf8c2c870ea133,
+    0x03fbc63a763ccac9, 0xc889d8a5fb1886c0, 0xf0486de5be49d9fe, 0xaf9a877862c23338,
+    0x8a43a2a176aa81b3, 0x896021298a0cc3d2, 0x49d311e8821f6640, 0x8035608f5c734ae4,
+    0xa7be0561349adc3b, 0x328525b296a337b5, 0x575413c36bccf78a, 0x6c7292ec4854960f,
+    0x121e6a713c2943ff, 0x0468565c6374c47e, 0xd66fe9932826f138, 0x4e2cfaf17748e3ac,
+    0xe9baaa2c4708a6c8, 0xa3845c8c66ffb5b4, 0xad3e293eb77c8fac, 0x00b5cfa9440a35e8,
+    0x3f55f58c63e06277, 0x1a81de8a64ba6e8c, 0x85cfdc74f4cc043b, 0x7cbefb98048d26e0,
+    0x5bde4b3c82aba891, 0x863d8f7586db6f46, 0xc7af5c1f845186c5, 0x41d7d404cb527cec,
+    0x3b44699483e1a246, 0x11c5ced4f6b819a2, 0xc79d4660aff79a46, 0x423bbdc15f22411a,
+    0x22652251a964039d, 0x808d6753e738657b, 0xc0ca19e34e909dc8, 0x0e036e4734ab0d07,
+    0x233593e77a26f742, 0xddc1c79ffc0f14d9, 0xb33c89802d359358, 0x51df6155730aacfe,
+    0xa9a6066c0f2c0b8d, 0xb92122272e706f80, 0x3994a53296a5efe9, 0xcf3d168b52316b12,
+    0xbe47dd5027eafcc0, 0x23df1041ec7e66db, 0x18c977ff78a4dddd, 0xb51565d79d2d152e,
+    0x24f6a6d578f4a4de, 0xbbc15b207d86b2ca, 0xa064d39c1d3b43ca, 0x5524866752200839,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P256_COMB_5_Z[] = {
+    0x0000000000000001, 0xffffffff00000000, 0xffffffffffffffff, 0x00000000fffffffe,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P384_WIN_5_XY[] = {
+    0x3dd0756649c0b528, 0x20e378e2a0d6ce38, 0x879c3afc541b4d6e, 0x6454868459a30eff, 0x812ff723614ede2b, 0x4d3aadc2299e1513,
+    0x23043dad4b03a4fe, 0xa1bfa8bf7bb4a9ac, 0x8bade7562e83b050, 0xc6c3521968f4ffd9, 0xdd8002263969a840, 0x2b78abc25a15c5e9,
+    0x05e4dbe6c1dc4073, 0xc54ea9fff04f779c, 0x6b2034e9a170ccf0, 0x3a48d732d51c6c3e, 0xe36f7e2d263aa470, 0xd283fe68e7c1c3ac,
+    0x7e284821c04ee157, 0x92d789a77ae0e36d, 0x132663c04ef67446, 0x68012d5ad2e1d0b4, 0xf6db68b15102b339, 0x465465fc983292af,
+    0xbb595eba68f1f0df, 0xc185c0cbcc873466, 0x7f1eb1b5293c703b, 0x60db2cf5aacc05e6, 0xc676b987e2e8e4c6, 0xe1bb26b11d178ffb,
+    0x2b694ba07073fa21, 0x22c16e2e72f34566, 0x80b61b3101c35b99, 0x4b237faf982c0411, 0xe6c5944024de236d, 0x4db1c9d6e209e4a3,
+    0xdf13b9d17d69222b, 0x4ce6415f874774b1, 0x731edcf8211faa95, 0x5f4215d1659753ed, 0xf893db589db2df55, 0x932c9f811c89025b,
+    0x0996b2207706a61e, 0x135349d5a8641c79, 0x65aad76f50130844, 0x0ff37c0401fff780, 0xf57f238e693b0706, 0xd90a16b6af6c9b3e,
+    0x2f5d200e2353b92f, 0xe35d87293fd7e4f9, 0x26094833a96d745d, 0xdc351dc13cbfff3f, 0x26d464c6dad54d6a, 0x5cab1d1d53636c6a,
+    0xf2813072b18ec0b0, 0x3777e270d742aa2f, 0x27f061c7033ca7c2, 0xa6ecaccc68ead0d8, 0x7d9429f4ee69a754, 0xe770633431e8f5c6,
+    0xc7708b19b68b8c7d, 0x4532077c44377aba, 0x0dcc67706cdad64f, 0x01b8bf56147b6602, 0xf8d89885f0561d79, 0x9c19e9fc7ba9c437,
+    0x764eb146bdc4ba25, 0x604fe46bac144b83, 0x3ce813298a77e780, 0x2e070f36fe9e682e, 0x41821d0c3a53287a, 0x9aa62f9f3533f918,
+    0x9b7aeb7e75ccbdfb, 0xb25e28c5f6749a95, 0x8a7a8e4633b7d4ae, 0xdb5203a8d9c1bd56, 0xd2657265ed22df97, 0xb51c56e18cf23c94,
+    0xf4d394596c3d812d, 0xd8e88f1a87cae0c2, 0x789a2a48cf4d0fe3, 0xb7feac2dfec38d60, 0x81fdbd1c3b490ec3, 0x4617adb7cc6979e1,
+    0x446ad8884709f4a9, 0x2b7210e2ec3dabd8, 0x83ccf19550e07b34, 0x59500917789b3075, 0x0fc01fd4eb085993, 0xfb62d26f4903026b,
+    0x2309cc9d6fe989bb, 0x61609cbd144bd586, 0x4b23d3a0de06610c, 0xdddc2866d898f470, 0x8733fc41400c5797, 0x5a68c6fed0bc2716,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P384_WIN_5_Z[] = {
+    0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P384_COMB_5_XY[] = {
+    0x3dd0756649c0b528, 0x20e378e2a0d6ce38, 0x879c3afc541b4d6e, 0x6454868459a30eff, 0x812ff723614ede2b, 0x4d3aadc2299e1513,
+    0x23043dad4b03a4fe, 0xa1bfa8bf7bb4a9ac, 0x8bade7562e83b050, 0xc6c3521968f4ffd9, 0xdd8002263969a840, 0x2b78abc25a15c5e9,
+    0x6bd2c54d4cb89afa, 0xe78c8bfa36527751, 0x27f52654e3eee747, 0x56f205839598d907, 0x5f91c2d027cb3712, 0xc501819fa3e33c5b,
+    0x248490aa4eded738, 0xde7ac94427789065, 0x20138b3d74f7d38b, 0xae791f602fb60214, 0x6b4fb300bd033d4e, 0xc69c25d9bdfd1f17,
+    0xeeacf664b8557d82, 0xa57429a94c77cc70, 0x59a603b7696b990a, 0xb43391f64beac9a3, 0xd5c3a162c8d57758, 0x98017c1cf2f7c3b4,
+    0xff2cd9a2468332cb, 0xaedbd85892a2368d, 0x03f49686d52ec2e3, 0x84d8de683ee6933b, 0xac7ed137b7b6aca2, 0x5d2602277b48d6d2,
+    0xd25f650804926a41, 0x7236b475514045da, 0x0b36031108b9b08b, 0x16477aff3fe92e91, 0x6e5f6cb103189ddc, 0x81ff008ec698a38f,
+    0x02a09218c93adb23, 0x71fcecd3445d8fae, 0x55a15eac8fd6b76c, 0x1e37ec3611ef96b4, 0xd1b3b3fc30e433b5, 0x4951873351d174c3,
+    0x24e07819523a8bb4, 0x7b2772319833d8e5, 0x3c471ddcb04699b8, 0x33b27f71bd8508a4, 0x41731cca84e5dc2f, 0x46e02a9b0397e396,
+    0x2e70a031cc9f27fc, 0x542eb3d9a7c4152b, 0xb966c93047867367, 0x4387e233c0166702, 0xd3e8b42352195b20, 0x12b79efe825865f7,
+    0xf44626fa1f21ae46, 0x507a10427193c826, 0xc954dbd3332e4497, 0x0fc7e409011fe64e, 0xbf09d38535201839, 0x2aca87f8e3f14d65,
+    0x664824aafa84b3c2, 0x660357c6f4d30784, 0x46b5cab5760eb676, 0xa55d8983118a70ad, 0xec5b8d9eaa1d5a74, 0xae60a033d09ff302,
+    0x17763bec03b8929d, 0x20f9df436f4537d7, 0xb442a2783f50ef47, 0xf3450eda37bae3ec, 0xb2c15f200fb1329c, 0x0da364e545e635bb,
+    0x9d46f6eb475d7731, 0xa2fea526edaa9406, 0x486e559426571ef5, 0x6d401ce9d1b5b927, 0xf2b65ecd13da4190, 0xda91acf3974de435,
+    0x406a7e2116960728, 0xd03923f85597d8c4, 0xd4402eff020748ee, 0x7827442af39b58db, 0x77e3f2768d8cfb04, 0xf6eb49c8e45a978f,
+    0x9db0829949247f6a, 0xce71a74706669fe5, 0xe434ce47b82775f5, 0xe84995ef63910016, 0xa35e8b971e47792f, 0xc779cb3d7c6aaeb9,
+    0x17bcf9791d424a0c, 0x4b54b3ed8fefd7b7, 0x9f7741e71993315d, 0x82289c8fa5fc44fd, 0x8dd8bd79711c4b69, 0xe53aaa71722c2f98,
+    0x83fca7a8fea26a59, 0xaefc892caa73159a, 0xd5a3fb551633ce08, 0xf9db2796f51b137c, 0xadac646ec3a15474, 0xc8f4bccf487214b2,
+    0xf96de0a85cf00041, 0xe7d22cf3bf0a9b63, 0x004a9fd05db53399, 0xd6748c0f7b83975f, 0x7ed1adf83ac4997f, 0x0f0d6e5e845c29c7,
+    0x25b54b834a4b2fa3, 0xc20dcf306611b046, 0x4aa75a3e1b5eef89, 0x34a9ccc268e9c563, 0xef515f4f75f4e0a7, 0x074a9631abfc4949,
+    0x6a5c134e80e21ac0, 0x5b575f0f1d09e6cd, 0x7e706cc39fad109a, 0xf2d4b4d418a54de9, 0xaf89472f76d52417, 0xf853d14caa027ec1,
+    0xd0238fec1a9cc3e3, 0xc96dce810f41b4ce, 0xd8cf075406582da2, 0xd5144307c929e254, 0x0473761c6ad1a72f, 0x810efc024adcdbf8,
+    0x2871e6af60d9f404, 0xa643672aa63075f5, 0x21cf2466979a48ba, 0xf55a914b6c74ec64, 0xe3fc17135b549c86, 0x0e0852964a82b64a,
+    0x3392d5a0e029432e, 0x72f18333dd25ed6f, 0xa26000888f41a56e, 0x3f52ed20c993579c, 0x168e5da15a1059aa, 0x0d85a6437ef52b1a,
+    0x64b9c787f0fdba0a, 0x27889c73d2d72e13, 0x428d200d94c67aef, 0x7124acca0d57dae2, 0xa5b0e6ef7c13e8e2, 0x21446337c2060717,
+    0xc83b2175ae5b038f, 0x8c2456459271754b, 0x27bbcb0b150ecf0b, 0x819e31c701995fa7, 0xb55d0888e2ce0e64, 0xf6baffd5032d81bc,
+    0x12dee15308a0bb6e, 0x7ef969fa420c3f7d, 0xddab08ba9680a92a, 0xe40bc1edfce0bdea, 0x29c72e956fac2134, 0x277c5495bb6c0418,
+    0xaf288e3f6eb38e44, 0xd39db2da026e757a, 0x69d4fd06047c2172, 0x73781beb5e66032c, 0xfcfe4643651b635c, 0x2848bc61a086fcb6,
+    0xb04ace6c5dc9aef7, 0x80be1d0f3ee5cc6b, 0xab9eddcc173feb36, 0x03e943c59e8c5575, 0x2f6360002199a881, 0x7683f4b291f8477e,
+    0xc64af2318a7a5570, 0xdf464e4e8d485378, 0x394b6eeca8ca5639, 0x44c7ab2dad695607, 0x39f1e0876a00750c, 0x98debda976b8ff8f,
+    0x6858b674844626a2, 0x610cd40f0cbba6a6, 0x324e674e29d9194d, 0x2dc6fdf6dcb30a51, 0x3f3ecb77528aa549, 0x0721f8f923ffaa92,
+    0xd8efcbd627a77538, 0xf4e642bfd6162c9c, 0x04f2b0b74cf4a16f, 0xbc0bb49fbbf335fd, 0xc6b6e5bd5a928c36, 0x981b01f4d893dd45,
+    0x6fc651a5cc7288b7, 0x2231781f69470dcd, 0x2aa15b2a92a93fdb, 0x6eafb0268cdd7a14, 0x2af2a07585e28035, 0xe8c6303d29f2fbbc,
+    0x63a2bd809a4d68e5, 0x0f8cc5e681c70549, 0xe4b37730b6630ba8, 0x1717f787c506d3c3, 0xf3cfb275c90c4476, 0x897451d4aacf2b36,
+    0x2606938f14f47a5a, 0x059270a9cd29a96b, 0xd57c69d69d42a8ff, 0xf8bd35d927b148cd, 0xbe327acd320ae33e, 0x822559924240a328,
+    0xac0caddb7a929bbc, 0x7d07c83de7e596a4, 0x54c27dd7487ba67f, 0x65e205d84ebaa953, 0x5028c6739218b3db, 0x1438558f9616b4ce,
+    0x4e0fb44671f74c5e, 0x5994b6919cd7c0f9, 0x724119e35924f26e, 0x5e478acb5f65b033, 0x9279712187b8ad73, 0x48b4ba0999a9406c,
+    0x9e00e38fae43e531, 0x6353a1ae5eb84112, 0x15cbdb3e2f7f1b08, 0xf3c346af058474f8, 0x56d7372b172639b4, 0xb452981968ccbdd1,
+    0x3aa00680cda4aa1c, 0x236b1bd6cf590b9c, 0xf097f0d924e8543f, 0xd270ecda4a82fabc, 0xb474ed66981eebe1, 0x896654c1c87091eb,
+    0x06598a25347cccb3, 0x8a66764b1a39bd51, 0x5d39d7244521b103, 0x6e40cc84c241ae61, 0x684bd7bbc17b7e0c, 0x0205d53d55c2f43a,
+    0x3b9fab5c82aa754f, 0xede2acbcb63f2789, 0xe70a749af2e1bf1e, 0xbcdb8a8936bcbd2a, 0x97f9788460f0cdd5, 0x1e5a7693545741cf,
+    0x7774b94a5c387ea3, 0xbfc98d0a10b11fc5, 0x95d72afa1cc36c54, 0xc79301f73526ba51, 0x003659c3e8280d62, 0x3b8cc4d27e94410e,
+    0x6731cde789b404bb, 0xca01453e3d13be6f, 0x33f4fca55c45289a, 0x32406a7ebc3eddef, 0x9c62dad4df48c659, 0xe31057d9f77f6e46,
+    0xd64754a3e842a7c4, 0x4030038faca384bb, 0xbc06591e4c779c63, 0xf497cd7487333cd9, 0x214e23b2d99bcb32, 0x8c04d0dfc17e7b91,
+    0x764bfc297ee98cd8, 0x83d6ff922b3dfe54, 0x73f8cdffb6a14d72, 0xf26db00a52e4b958, 0xd8e093961a855031, 0xec65e759920709f6,
+    0xd8377f2c3c64b2e0, 0x8dc13be4247240f4, 0x5401171a8cbbbd67, 0x610ef2f53ab670eb, 0x98b544ff3bfc675f, 0x548cfcc2d259ffa4,
+    0x278dd1a38b800e7e, 0x9bbfdc668dc767b0, 0xdaf9524297ea976a, 0xe406a78db6e64692, 0x4b52bd3e83315a4e, 0x3f9baa35b78f2013,
+    0x7f2e5c4d03f9b999, 0x34c3d16e46693732, 0xd3acba57244e3140, 0x5a07c1a54bb75e8d, 0x2a7e4a32832d8b8f, 0xf63b74bff3a2f27c,
+    0xa0b4d7b3fe28811c, 0x5d05eccaef1a552f, 0x66fb43377f360449, 0xb210953e598aa6d4, 0x4be1df9bb6c1759a, 0x16376676e5c4ec1a,
+    0x7ab4af2b807bfaa2, 0xa6c43ef769ea556a, 0x928ebb6fac9f05fd, 0x8d6f436a0b0151a4, 0xb8aeed95f4e3448a, 0x9fcc0d549f7953a5,
+    0xd1670e87a907c752, 0xf780541c239d26c1, 0x0be42d52ca8c9d97, 0x2f32f6882e806104, 0x39276b792be876df, 0x263b768a8c86a4cd,
+    0xb3ef317006de686d, 0x5ecfee99a6b652f8, 0x506d7abbe4ee473e, 0x2174c181cecaa329, 0x60520a237eb51ed2, 0xd66712e4b39d6ebf,
+    0xf88a910f6ae4e3eb, 0x988f3bffa31342c4, 0x7baed96d79eeb886, 0xf3b6651159db12b9, 0x20314a0790638ffa, 0x1c0ffe17c88ef37f,
+    0xd852f9860b74180a, 0x6d68989b9fbb4924, 0x6c7dd8c5c078fa8d, 0x7bded43ce741e6a2, 0x78c2bb1a98b878a3, 0xad714af957eaf758,
+    0x8088d680272e2db3, 0x8ff19a332900ffee, 0xbf32bffc3d3816bf, 0xdae67e27133c5433, 0x9ae0cb219d09873e, 0x33a716aa0f23cf9b,
+    0xfb304095aa4f004b, 0x7223a55966a74777, 0x87d4255397ae25ba, 0x7548c9d393f48840, 0x1f09b4f42ea6c117, 0x2125c0e225e5a579,
+    0x73f810552a219e96, 0x64c908d90f7ff162, 0xb064cf59d6ad4c6f, 0x3369dafb620664db, 0x726b5b472746205c, 0x8cb469fe8318b089,
+    0x8cd34046d11c3476, 0xcb2d1330fcfc4dd9, 0x9b047d4f30b696f8, 0x95c268c2d4c18696, 0x4daaba707945a339, 0xda75e6ebc93a144a,
+    0xe7958aa865c7af2e, 0x9dcedd6271707194, 0x65d3ca5728c83ea1, 0x1741d2c1b90c08a1, 0x0b30c45f29f4efc3, 0xcc0efadbb3b6f4ef,
+    0x4e933280bf377698, 0x7ae10eb1d02bbbd3, 0x55fc031936af2a83, 0xc7e995616f788466, 0x4cb4d959dc367d35, 0x887c09498fb9c9cf,
+    0x6102ffcde90d88a4, 0xfd7d8998f91aabf0, 0x1892ad594dcc3324, 0xe79856b96838bb98, 0x4c507c9318ff21f4, 0x02db41d83c088e65,
+    0xd51364567a1a7b21, 0x2b4c8d12b838f844, 0x0389b4d2f9bfa274, 0x9f63c44798677986, 0xe0686040114b36f5, 0xe5acfc3ada4ac299,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P384_COMB_5_Z[] = {
+    0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P521_WIN_5_XY[] = {
+    0xf97e7e31c2e5bd66, 0x3348b3c1856a429b, 0xfe1dc127a2ffa8de, 0xa14b5e77efe75928, 0xf828af606b4d3dba, 0x9c648139053fb521, 0x9e3ecb662395b442, 0x858e06b70404e9cd, 0x00000000000000c6,
+    0x88be94769fd16650, 0x353c7086a272c240, 0xc550b9013fad0761, 0x97ee72995ef42640, 0x17afbd17273e662c, 0x98f54449579b4468, 0x5c8a5fb42c7d1bd9, 0x39296a789a3bc004, 0x0000000000000118,
+    0xa5919d2ede37ad7d, 0xaeb490862c32ea05, 0x1da6bd16b59fe21b, 0xad3f164a3a483205, 0xe5ad7a112d7a8dd1, 0xb52a6e5b123d9ab9, 0xd91d6a64b5959479, 0x3d352443de29195d, 0x00000000000001a7,
+    0x5f588ca1ee86c0e5, 0xf105c9bc93a59042, 0x2d5aced1dec3c70c, 0x2e2dd4cf8dc575b0, 0xd2f8ab1fa355ceec, 0xf1557fa82a9d0317, 0x979f86c6cab814f2, 0x9b03b97dfa62ddd9, 0x000000000000013e,
+    0xd5ab5096ec8f3078, 0x29d7e1e6d8931738, 0x7112feaf137e79a3, 0x383c0c6d5e301423, 0xcf03dab8f177ace4, 0x7a596efdb53f0d24, 0x3dbc3391c04eb0bf, 0x2bf3c52927a432c7, 0x0000000000000065,
+    0x173cc3e8deb090cb, 0xd1f007257354f7f8, 0x311540211cf5ff79, 0xbb6897c9072cf374, 0xedd817c9a0347087, 0x1cd8fe8e872e0051, 0x8a2b73114a811291, 0xe6ef1bdd6601d6ec, 0x000000000000015b,
+    0x01cead882816ecd4, 0x6f953f50fdc2619a, 0xc9a6df30dce3bbc4, 0x8c308d0abfc698d8, 0xf018d2c2f7114c5d, 0x5f22e0e8f5483228, 0xeeb65fda0b073a0c, 0xd5d1d99d5b7f6346, 0x0000000000000056,
+    0x5c6b8bc90525251b, 0x9e76712a5ddefc7b, 0x9523a34591ce1a5f, 0x6bd0f293cdec9e2b, 0x71dbd98a26cbde55, 0xb5c582d02824f0dd, 0xd1d8317a39d68478, 0x2d1b7d9baaa2a110, 0x000000000000003d,
+    0x1f45627967cbe207, 0x4f50babd85cd2866, 0xf3c556df725a318f, 0x7429e1396134da35, 0x2c4ab145b8c6b665, 0xed34541b98874699, 0xa2f5bf157156d488, 0x5389e359e1e21826, 0x0000000000000158,
+    0x3aa0ea86b9ad2a4e, 0x736c2ae928880f34, 0x0ff56ecf4abfd87d, 0x0d69e5756057ac84, 0xc825ba263ddb446e, 0x3088a654ee1cebb6, 0x0b55557a27ae938e, 0x2e618c9a8aedf39f, 0x000000000000002a,
+    0xecc0e02dda0cdb9a, 0x015c024fa4c9a902, 0xd19b1aebe3191085, 0xf3dbc5332663da1b, 0x43ef2c54f2991652, 0xed5dc7ed7c178495, 0x6f1a39573b4315cf, 0x75841259fdedff54, 0x000000000000008a,
+    0x58874f92ce48c808, 0xdcac80e3f4819b5d, 0x3892331914a95336, 0x1bc8a90e8b42a4ab, 0xed2e95d4e0b9b82b, 0x3add566210bd0493, 0x9d0ca877054fb229, 0xfb303fcbba212984, 0x0000000000000096,
+    0x1887848d32fbcda7, 0x4bec3b00ab38eff8, 0x3550a5e79ab88ee9, 0x32c45908e03c996a, 0x4eedd2beaf5b8661, 0x93f736cde1b4c238, 0xd7865d2b4924861a, 0x3e98f984c396ad9c, 0x000000000000007e,
+    0x291a01fb022a71c9, 0x6199eaaf9117e9f7, 0x26dfdd351cbfbbc3, 0xc1bd5d5838bc763f, 0x9c7a67ae5c1e212a, 0xced50a386d5421c6, 0x1a1926daa3ed5a08, 0xee58eb6d781feda9, 0x0000000000000108,
+    0xe9afe337bcb8db55, 0x9b8d96981e3f92bd, 0x7875bd1c8fc0331d, 0xb91cce27dbd00ffe, 0xd697b532df128e11, 0xb8fbcc30b40a0852, 0x41558fc546d4300f, 0x6ad89abcb92465f0, 0x000000000000006b,
+    0x56343480a1475465, 0x46fd90cc446abdd9, 0x2148e2232c96c992, 0x7e9062c899470a80, 0x4b62106997485ed5, 0xdf0496a9bad20cba, 0x7ce64d2333edbf63, 0x68da271571391d6a, 0x00000000000001b4,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P521_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P521_COMB_5_XY[] = {
+    0xf97e7e31c2e5bd66, 0x3348b3c1856a429b, 0xfe1dc127a2ffa8de, 0xa14b5e77efe75928, 0xf828af606b4d3dba, 0x9c648139053fb521, 0x9e3ecb662395b442, 0x858e06b70404e9cd, 0x00000000000000c6,
+    0x88be94769fd16650, 0x353c7086a272c240, 0xc550b9013fad0761, 0x97ee72995ef42640, 0x17afbd17273e662c, 0x98f54449579b4468, 0x5c8a5fb42c7d1bd9, 0x39296a789a3bc004, 0x0000000000000118,
+    0x8002b6d63dca9409, 0xd31714c1163b8124, 0xca655b42720a124a, 0x88388dbe9596636b, 0xa321822dc0b7dc61, 0xcdd952c85824e60f, 0x79ff44366cb4916a, 0xa115847e5f88dab8, 0x0000000000000009,
+    0x1eaf3d400aed0c43, 0x7a7196f7ea2a20a4, 0x4312341497781948, 0x856126d0e88d93fc, 0x96dac31fd5710224, 0xc23548f5243e6395, 0xf351df8b9613a79e, 0x0dae5d50626fb1fd, 0x00000000000000e2,
+    0x09afacbfbc2b444b, 0x7ce8f35e588f5f8a, 0xe1d23850377b4c4b, 0xe295aba8e838d769, 0x340b83eeb9355794, 0x0aea65b11950574a, 0x8325beec628ba4cb, 0xfd9bc30eab9c13aa, 0x000000000000015b,
+    0xf1c1504f5d1fffe1, 0x50842edce193e1f4, 0x06b7175146fed72d, 0xc93376ce4068b022, 0x19945ee2a5597aca, 0x7dd15c337a04dd55, 0x946d0a33e521cdb8, 0x58b1c23caa671ce1, 0x000000000000016a,
+    0x27068f87578b7a3f, 0x506446f1423a5346, 0xe9d9c75b58dac5e4, 0x8ebc86e561b8f695, 0x272ac14e611c51e3, 0x67863a1d4e24fb32, 0x270d4fdc02e5b539, 0x96d7b7a9a4186d8d, 0x00000000000000f4,
+    0x1a60ef0526627252, 0x31682a839bdc0f5f, 0x52a055ada112be82, 0x9c3a88484ecf7367, 0x5235087249e70680, 0x61b6b478b881b9cf, 0xbec16c5a887d3c1e, 0x8a8b2b82d598a671, 0x00000000000000ef,
+    0x0b64e83a2b194aa5, 0xb2e3334af7002fca, 0x401e469868df8a9f, 0xe8c32455a502e745, 0x32259a9cb781048a, 0xc13ef1954086327f, 0xbdfad47dcbd306f7, 0xd26a27dc3fc981e4, 0x00000000000001b5,
+    0xb5cf840d054ea3d9, 0x0764b7168640e369, 0x71b8c377caed4af7, 0x4879ceca666b4e6b, 0x858b6e578bb573b0, 0x3b0029dc0b16f991, 0xe48d75b4ac28a5fe, 0xc08f69a5bd7dbc6c, 0x00000000000001c1,
+    0x2e5fdec456f37bc5, 0x47d27ef1d8ed445e, 0x8dae4f2a118ed43e, 0x3d1ba76363c2e473, 0xdfe1c67d5b15b574, 0x2310bb650d3e2aec, 0xf14e57dc6654fff5, 0xc71bf1841597dd59, 0x000000000000018c,
+    0x860e953fc3718c09, 0x51037bb32d8c43fc, 0xf3b5ae55f9cbf663, 0xb5a79a614f563f6b, 0xaadb36613020107c, 0xe8a6262230056124, 0x4023463836a2adb1, 0xb866a5edb477a7a4, 0x000000000000004b,
+    0x41f3998e8ce5766c, 0xda265d9524938658, 0xf3b99d8421b105f7, 0xfb75b41dbf7a918b, 0x3bb1c2edfc2c4ffa, 0xbf194b7a03464e97, 0x1e6fe2b0c73a2041, 0xc1a1eb0022768a40, 0x00000000000000ed,
+    0x9000b05a375dcd3e, 0x12aeb1e92902b8e6, 0xd78a6ea3d6a61e1c, 0xca0c8810ff683e9a, 0x73a3b9a8010da77c, 0xb977886a575e41e6, 0x5918cf3f81138bd4, 0x0618c50a3800292d, 0x00000000000001f8,
+    0x1e2df23635210df1, 0x387b5c569aace566, 0xdd8152c9ee401323, 0x56fe9ec99cac0076, 0x88ed7fc1e1a9f782, 0x6551487d681f0428, 0xeaacc10197689006, 0x626bcad13b7e7fe6, 0x000000000000015e,
+    0xe1b3574a7acb23ca, 0xadda7c9e3636a1c2, 0xfc998cf89f3d947c, 0x38ee4df41ba0511b, 0x1f40cc1403e4694b, 0xccecf4e0800fb6d9, 0x021f708ae1665d06, 0x2bcd7975c492d329, 0x0000000000000063,
+    0x66bd9a0dcd698697, 0x0e7d8559bbbc1758, 0xe072a980ac76a88d, 0x3cf9af4de2c17874, 0x85b24bc4748e97ad, 0xe5522faff3f6d8ea, 0x60ed43eecef45795, 0x1859fd20de38467d, 0x00000000000001d7,
+    0xe62c76b958e8181c, 0x3731bcc7fee454ed, 0x2cb0b570ee89f8f5, 0x0a38b9539a262283, 0x46887e748c19a774, 0x1dbea5dae80adab4, 0x09fb720cb1f75c90, 0x91e0b746e723e278, 0x00000000000001c5,
+    0xfdd15a304a74fa02, 0x1c80d48f87b52f02, 0x0345d737336c5cbc, 0x5dfff6c47e074403, 0xe3e42f925f1c1ff3, 0x7b2c8dd81edbb019, 0x7f359db4d98a561a, 0x1f4418af588a781f, 0x0000000000000109,
+    0x899ccd2cd4ab4ab0, 0x2a3bb1313629c9f8, 0x250f4ec1d197b82b, 0x56ebee4d3e969845, 0x21b3794e7d1740db, 0x3398cd061c4527bc, 0xfbec1bad40892dbc, 0x3521a1de11b63064, 0x0000000000000075,
+    0xf7ea41c2bf0a9413, 0x1d183a1d4baa9929, 0xe2797b60ffbe72fc, 0x89d4630a44c2dffb, 0x8d3c34f79cc1e3bf, 0xa962bcf6e228f21d, 0x18cfa46c0d3db82f, 0xf1476bff826e9e5c, 0x0000000000000138,
+    0xec827d4e68c9d2c6, 0x9cfeb7de801e055b, 0x6f89bb4c6139505d, 0x79070bede11a3850, 0xf107cd01b4aa84e2, 0xa24e814d5d4cafd3, 0x01facae26cd6f300, 0x73a3606eef7295ec, 0x00000000000001f2,
+    0x48fbf30b4aad2e05, 0x06b5a20901fc9f6c, 0xb450e20a4b55569b, 0xf3fa8368265be251, 0x6a9a8e37d83c3526, 0xe55231f58ec85226, 0xd30720dec39c81a2, 0xdf9a84223475543f, 0x000000000000013e,
+    0x792c103568ef1d85, 0x14510a42131c0e8a, 0x4cce43359c67d5a1, 0xbd8e78daff403ac8, 0x1e942fe6c6f7550e, 0xe30a4227652848ba, 0x8b99925974633933, 0x9b93773cbeedef34, 0x0000000000000113,
+    0xe6635fb0e467d758, 0x86c5b514f33e4501, 0x09b5148af7761564, 0xbcf626430cc910bd, 0xd0fba0fd4bb22456, 0x2f89adcdf9540d29, 0xb301b82d7fb42444, 0x010506a820d47cff, 0x0000000000000142,
+    0xf548552abcd13738, 0x53d96bf7b4d34794, 0xf0436671b450d93e, 0x00312abc7559e61d, 0x2ca11a49665f5b92, 0x4900b235130db792, 0x1341c8882535a998, 0x6e67d221b537e36e, 0x0000000000000092,
+    0x7ec178bcb40195fb, 0x8d5d95d99e52ad96, 0x4156a28ff4b6c85c, 0xc399df9612836a87, 0x94fd84fd2c4e4a07, 0x862d09f900495484, 0x73cb6d97ba206c85, 0x08a1145fb52c5491, 0x0000000000000124,
+    0x9ce5c484d7f940c0, 0x85c46a0831634b53, 0xeb380764a3957e7b, 0x3fadf112bc29654a, 0xfde17190107163ca, 0xc0a2444ce37231f4, 0x7cd5e0230756fdb5, 0xc4c0ac59823c0888, 0x00000000000001d9,
+    0x8504a7aa3acea413, 0x989efe863795f859, 0xf433b891941e6e16, 0xaff91c12ff6e1d4c, 0xc873973b44860fe5, 0x101c9bb3a79f3a0c, 0x2d8a3e9c4fb48808, 0x60d5793627db49ff, 0x000000000000010c,
+    0xbe29d1a2c98e7235, 0x2ed8430233d0c003, 0x25bd54d2a3742d3c, 0x6ab844f2a9319974, 0xecd2e4bb8cf44b10, 0xb7e1e6473615be84, 0x76451db2d87c3ba5, 0x0187baff32d488af, 0x000000000000010b,
+    0xe12d8922cd5f918f, 0xec7c176349f73f1b, 0xcc5a3a14c744eb3d, 0x2b96f342782dbda1, 0x87284905ab68dde4, 0x647354b9e720668a, 0xe07da694739c4393, 0xbae499bf2cc145f9, 0x00000000000001ae,
+    0x74eeeaa477c16db0, 0x297624e8eb22ce92, 0x9d3944bc45098c91, 0x6ff31fa0fa4dc50c, 0x3c7fb6dacc40c211, 0x74d95dec96b4cd1c, 0x829423dba6388941, 0xaa2b7d45fc3123b5, 0x0000000000000119,
+    0x8901d9466177daff, 0xaee1304199543a5c, 0xc6ed8b6eb3d83a55, 0x832ef897ee021f9a, 0x23bc2700ec9bbb33, 0x9b78f0740508911a, 0x4c0acea03a003d2b, 0x76a114201fceff88, 0x000000000000019f,
+    0x7429453417394790, 0xce98d43693d8cdad, 0x23554f205a78db6d, 0x64c2c812b75946ef, 0x9c57516f6e2a8ac3, 0xa736ce2bde910e96, 0x940797c907dac2bf, 0xd67e6290ce2992d5, 0x000000000000011c,
+    0xd32251cee37a0eac, 0xba7d8ed273d21c0d, 0x8d9b008c4bf0f588, 0x3e623df4e7609c70, 0xc893bc1a85d3e628, 0xd3f4b042be7275f9, 0xbef19f58092f0fe8, 0x4022bd35a2921e5f, 0x0000000000000199,
+    0x99295b22dd6bf2eb, 0x3f0950bfe3e5713d, 0x88cbe0893f6cdf85, 0x6d6936cbb5fff9e5, 0xac9388b89fdf1190, 0xf184f01a759b4927, 0x9127290af9de1058, 0xe3c51086752bcc58, 0x00000000000000c3,
+    0x13f2bd66067abd94, 0xda610fd95cab3732, 0xde12bf7c737c6004, 0x93de1247ccc8ec18, 0x9de79f92e9e14c8b, 0x656a6085d5171a48, 0x888c900e65a7f194, 0xe335f5bd28d15206, 0x0000000000000051,
+    0x35f9dd5446dbc8fa, 0x7aa35063af10a90f, 0xe87e08ecd64378ac, 0xfa73cd910771319d, 0x406861cae41f404a, 0x0569e6ac6df2485d, 0xac8f0c3b0fdb2a45, 0x934094a17a031b95, 0x0000000000000182,
+    0x3e0a69adfbcefa44, 0x3c12960d0100f6cf, 0x1a0139e63304cea3, 0x33dcf3acce6c5c64, 0x69cca1c5f5a9ea5f, 0x9c46687b6fac7530, 0x67ef76efee01a338, 0x0c0beb8ac80f5b73, 0x00000000000000f5,
+    0xc3ea34f25635805a, 0xcdcbcf104e9dd72a, 0xd4aa28ea5dd81af9, 0xaf5d9b1896207553, 0x58e37175ceca79ac, 0x2ded6938423f16f8, 0xadb7d997617c789d, 0x377527d577a839ad, 0x0000000000000028,
+    0xa055542f8bd960c5, 0x9f9c46b9c4928fdf, 0xfbf34b7456db2c41, 0xa915c43bd7f96233, 0x343c4729886632a7, 0x021342c862055e0c, 0x6bead4a7c85200ca, 0xebe9f14aaba5d2a8, 0x0000000000000154,
+    0x879e160bf6a172a6, 0x0bcb9ac4c3019282, 0xc8f0dba2137ac022, 0xda0764f3507ad285, 0x4f02faefc48fc1ee, 0xbda9d705e4705d9a, 0x096f7ad67fab179b, 0xb7d02ff5f5715452, 0x000000000000010b,
+    0xa653a59898d2fcb7, 0x69f00a60bd022829, 0x73c15bddd0cbdc8b, 0x79e2d872c6f0df64, 0xcfb01d667ecdcc04, 0x0dd8cb5ca8a2efc9, 0x770786158bc083a5, 0xdbac11358bd2e53d, 0x0000000000000165,
+    0x5e9aa8cfe14ce434, 0xd86cc193facb65f7, 0x89c06903eee89a15, 0xfa0ea605140d65b1, 0xaa2764f1ca97272d, 0x32aa60b66d5a4b39, 0xb7d486f26ec03834, 0x0b78e04ba4ee49f4, 0x000000000000006b,
+    0x133bdb1f0b4a52c7, 0x44232ce4d3fb64f3, 0x060f9105aa669c3e, 0xe476083e8a1c78d2, 0x33302ffb2896ff21, 0x93f76ca9c9c0fec1, 0x6f45944cf52f62a9, 0x1d42893e51bcf781, 0x00000000000000a9,
+    0xef39f4c3603b185f, 0x83695bf9846d35fe, 0x87a0f5f76a9e521c, 0xff0a43b0f8a5ef9c, 0x8737d15cc6428d9a, 0x42cc547a2708ebe4, 0x96fa561103d29dc7, 0xd936aa1fe36121a8, 0x0000000000000123,
+    0x7bb05a71cbb19033, 0xc43c5fa893341615, 0x4372c014c9a24df8, 0x868a9cfccf5d5fc0, 0xbf7ab99290bf1a21, 0x02e5046ac77c1c58, 0x3f77507db9bc7316, 0xd457d2862b7394fd, 0x0000000000000077,
+    0xc5b7f0306c714189, 0xf2dd1b006643efb7, 0xd4abc4834db160df, 0x93c37db29fc6983e, 0xd700c267f288c237, 0x2768234e76d7aaac, 0xd0704caaca897b13, 0xe968e7f33a42793f, 0x00000000000000ee,
+    0x9e8be8fed3cf2135, 0xdc62670abc21af56, 0x59482d8d1eeea8c3, 0xe487d51a7e63e8ea, 0xe02a690d4db76010, 0xad6676961cba5a06, 0xc9b0e703ab2b720b, 0xba8987063d3a20e5, 0x000000000000008e,
+    0x2c5d534c51b9e2ec, 0x0f88c8a05135d2e0, 0xb48541300a10beb6, 0x41afcd3e00b9dbdb, 0x6977550155f895dd, 0xfcfacb48401fc8f7, 0x95ef57dba00f8c60, 0xcca4d80fbbcbc692, 0x0000000000000038,
+    0x285964aba17c1afc, 0x61e7f13347c4ee9a, 0x7d5b53b556e327cb, 0x6e89955f7cd52410, 0xd105866c9435cf51, 0x5159daa4a405f220, 0xf5f760750fae001e, 0x0f82cf532301dbb4, 0x00000000000001b0,
+    0xa6d7dcbb42667f53, 0x8eeff84d1dc41e07, 0x45c1eac4b62f6da6, 0xe1d3e57e57c16133, 0x4521e788c3e4868d, 0x277e2e9c59a0aae4, 0x84daa0f2ecd38228, 0xaf4dd2a6e99e7d86, 0x0000000000000198,
+    0x0dcf3400a5d3f11b, 0x4d4fc4a5003d085c, 0x5c60f7a80ea2d87a, 0x48e2946f626afd57, 0x04aab3b596a8e233, 0x1ea3b8223bdb8ff0, 0x5fe38c345f72f67d, 0x706510ead01d5426, 0x0000000000000081,
+    0xc3926f310a2ed4d5, 0x27da9ab2f709851e, 0xb86be0ac4d197d1d, 0x557fb682760df228, 0xab146fe0879f42ca, 0x8c413c558652ce70, 0x8d050d3d6e786d6f, 0xb0a37dac7f4dc473, 0x00000000000001c3,
+    0x292638ab81d5ed94, 0xabff07b58bdb117d, 0x8e100d95f426a8b7, 0xbcd36a3d638cbf9c, 0x09d3cd0bf8767ca7, 0x032a2bf1589ddca8, 0x6ad32cc67b29fe31, 0x8e6b8b2defcd41ea, 0x00000000000001b9,
+    0x57b2f98fdfa0d79c, 0x433a21fc03917faa, 0x7352e037bc1c6906, 0x49bad1068a32d9b8, 0xc603f6ce14837a59, 0x65f93ffdbd6f7e51, 0x96b06a3b8108ac74, 0x9a3f77c7562c97ec, 0x00000000000000ec,
+    0x51d18b4d2aa3e93a, 0x9ba6f06b1bd0a40e, 0xf204ac021e584084, 0x4b559d72f45ff136, 0xe60710c3dd163abb, 0xc5fb042698cc258b, 0x502996cc0865083c, 0x4ea6b12afce6703e, 0x00000000000001c2,
+    0xf5c17be620441fab, 0x973fce59ec8e7a6a, 0xf61fff2508d33ea1, 0xc328f560a39e549b, 0x9821243ea4b32471, 0x59bdfd2b9b4855c6, 0xac8d17c7426919bf, 0xcdabdec7762c86d1, 0x0000000000000107,
+    0x3eebe544a2bb38d4, 0xd5d491d38a475c85, 0x905f5691bffcb79c, 0xe34974c636366caa, 0x9a153142367e9c0a, 0x3aa1fb2e7a14bc32, 0x4508b4d91331b026, 0x29addc638852710d, 0x00000000000001d1,
+    0x8290dc1abd6b5abe, 0x6335cdf74fd3322f, 0x6e2f8d80a679b5e7, 0x81223c323a849122, 0x8ae27d52abcc883b, 0x52091cbffd8be4a5, 0x5dcb0d61a026fdba, 0x32c718b2d26d08c5, 0x000000000000010d,
+    0xf52b65143d5feb05, 0xea80d88dbfb8e1f2, 0x7d351dff638b1c1a, 0xcd28613a722d5a63, 0xb80f156f0b6cd30e, 0x1ce8a22b0606ac8f, 0xbd2457badc6d042d, 0xd886156633a1239c, 0x0000000000000157,
+    0x2b94bd24145455d3, 0x74cd5e62412ef83e, 0xaba141dd33286332, 0xaa182a93ab55f638, 0xc088eca8caa9cb3d, 0x9cfcc67a23bc7a6b, 0x4bfd6e1946d15e68, 0xdfdaf33b27664bf1, 0x00000000000001d7,
+};
+
+static const word_t EC_PARAMS_ID_NIST_P521_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B163_WIN_5_XY[] = {
+    0xd4994637e8343e36, 0x86a2d57ea0991168, 0x00000003f0eba162,
+    0xb11c5c0c797324f1, 0x71a0094fa2cdd545, 0x00000000d51fbc6c,
+    0x906691f6edd691fe, 0xf86aa315009d6f9b, 0x0000000634000577,
+    0x3587bd45dc2230be, 0x6c2ec014e6fba565, 0x0000000401a3de0d,
+    0x2764867da449f864, 0x3630522f4c657bb5, 0x0000000720589968,
+    0x007af3013550cb9c, 0x5dada096db01ca79, 0x0000000302537ff5,
+    0x1a0cf6abad87b13a, 0xea5a8c0a3eb105b3, 0x000000043eaaaf4b,
+    0x932b0bd27289a17f, 0xa9d7fd436c988c7a, 0x00000005fad8ce53,
+    0xabdfeebba9e7a7d3, 0x6ae7caa87f08815b, 0x00000004802fb730,
+    0xb6859c9f5aba0256, 0x573d8c5e2e54fa7f, 0x000000051887a199,
+    0xa2f5942a06f25bb5, 0xd49e19b15ed4240a, 0x0000000696e27054,
+    0x008ff6009343c77c, 0xf5e68efcaf26248a, 0x0000000213b6f9c3,
+    0x74392ac60036a5eb, 0x02bfbad2e0f3517f, 0x00000007c565f87a,
+    0xb3e3551409365955, 0xbd22e6a623bf4033, 0x00000002c556e1e3,
+    0xabdfeef475ae9483, 0x918aba057e6de329, 0x00000001880f725b,
+    0xb18090bf4a2e0516, 0x94aad1c937eb6143, 0x0000000220415ef4,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B163_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B163_COMB_5_XY[] = {
+    0xd4994637e8343e36, 0x86a2d57ea0991168, 0x00000003f0eba162,
+    0xb11c5c0c797324f1, 0x71a0094fa2cdd545, 0x00000000d51fbc6c,
+    0x4404c1c5a0047668, 0xaf5c51417063cbba, 0x00000001e39f0d81,
+    0x1edc06ca56c43183, 0x2a8041ff3ee3de0b, 0x000000011aa112db,
+    0x880caa5ebb6b3875, 0xd19b477117d44704, 0x000000001a3ae5a9,
+    0x4e9c3b1f7a4e0807, 0x806502d3f8f4975d, 0x00000000c9614844,
+    0xfbd8f018f6247969, 0xbd630ae0a86e640d, 0x00000005461bfd0f,
+    0xbfedc8f9476bc611, 0x58e014aca25330d6, 0x00000001bd72c89b,
+    0x4fcb3973e7f24549, 0x825bb70dc70cb84d, 0x0000000680f8f1be,
+    0xffca616bfb302668, 0x216d0254d89119e9, 0x00000005a99627b3,
+    0xe6e70acaa5fa3598, 0x46d4ce4c92a2b2a8, 0x00000005ee4c4b5c,
+    0x7daec28b4efebb8f, 0xedb506a2121c3199, 0x00000004a7809a10,
+    0x42366f4f9be596dc, 0x793cdcf3dd04a42f, 0x0000000070d6c621,
+    0x5893d7904da23881, 0x198739537d43ab81, 0x000000073fbcce8e,
+    0xb29172284bac9e39, 0x0b604177619b6899, 0x00000006cd360c76,
+    0x74c81a2d790717a4, 0x04520a50d185f7a9, 0x000000062dd41018,
+    0x6ffc2052664db8cb, 0x7f63023be84ed661, 0x000000058e274796,
+    0x37cbfd07c3006281, 0xe451b68cf0eea178, 0x00000000e191562b,
+    0x9a1961ebc5df5ab2, 0x804cc1117f6b2d97, 0x00000002633d531b,
+    0x28423b025cbcde73, 0x5452d570c7673fae, 0x00000001cdcd34c3,
+    0xd283dd375ad30234, 0x97543912dae7b4ad, 0x00000001f8b2533a,
+    0xaf515c526458b4d3, 0x992148506a1e0c82, 0x000000060569d4e7,
+    0xf93bd7578c628ed4, 0x7e34c1951808f812, 0x000000003163a933,
+    0x1eaf4bb4fc5e10da, 0x0956ae484e840a12, 0x000000033250fc98,
+    0xafef24b8465ef920, 0xf533fcb14776ced0, 0x000000003a82765a,
+    0x892ff8dc3d613eda, 0xf25609abdf3f7198, 0x0000000385a686d8,
+    0x1fd416e6b28d5cbb, 0xb99f0b199aa9b168, 0x00000007129d95fe,
+    0x9b418ea3d6058db7, 0x65fcde77d66d1404, 0x0000000410d46af8,
+    0x651f1a269aa6b226, 0x241006c71aa9a41d, 0x00000001a0f8c128,
+    0xfda63329c286ea92, 0xec169f2914ea0f58, 0x000000058115eb62,
+    0xc1d7ae289f71eea6, 0x94a28e639f1080da, 0x00000003a140250b,
+    0x040780b070f7d778, 0x362b9d645d8c64b3, 0x0000000440c4b808,
+    0x3af4aa04697e013f, 0xf0aa7a5558bf541c, 0x00000007468c482d,
+    0xbce3fba6b45397f9, 0xb608346438882c22, 0x00000002a321ce7a,
+    0x286a224afb16c789, 0xb8c6159cbc1dd260, 0x00000005536daa6e,
+    0x77df88722be3f210, 0xb362358291e935d9, 0x00000005e717324b,
+    0x21a7777147f8ab09, 0x169868284244ce11, 0x00000005061a61fa,
+    0xe49c7972304b3038, 0x5a1e8dfe9e9f0214, 0x000000002a88bc41,
+    0x6b5848ee399ee36a, 0xa2ca3061fcb16f89, 0x0000000520d6f547,
+    0x504df6244390cd50, 0x4b50ed141a44972f, 0x000000049b4b2775,
+    0x5d407909725d0bd6, 0x69a3a1b26c367262, 0x00000002b79ca15b,
+    0xd7a2a6322002981f, 0xac4f3c89a3d44565, 0x000000013c6229c6,
+    0xe65f239088790088, 0xc984cad3011fd148, 0x000000073eee9b83,
+    0x8babf15533d07802, 0xf290d1c518a16e4a, 0x00000006c696e4dc,
+    0x4ce14dd95bf06b5c, 0x668798ed3aecd9c2, 0x000000037e75fe29,
+    0x0cc6b57183ae8449, 0x77ea379f9e8550cc, 0x00000001936c8a28,
+    0x84e507c4a7ab2b40, 0xa0abcd362aa26efc, 0x000000003991c436,
+    0x530296dbae0dc5cb, 0x0a0aa0c45eac6e24, 0x000000045ba7f2fd,
+    0x926391321be1e31f, 0x279f7dd1455af1ec, 0x00000002c2c825fb,
+    0x270cc46102211ba8, 0x28c193189c90bd2c, 0x000000071043fd3c,
+    0x0bd1f2fb5c6cea4b, 0xe76aeb15f8744ae4, 0x00000004882c4e17,
+    0x3973094a3891f6a8, 0x3af82e08a15fba79, 0x00000003b0c8e9ac,
+    0xf1ad4460dc7974bf, 0x56ad9c4e38eed7b5, 0x00000003c4c5249f,
+    0xf4063790659f87d0, 0xf77cd72523b82f68, 0x000000046bc7505b,
+    0xc67a8381830cdafb, 0xd82c53d72d818bef, 0x000000028b17708f,
+    0x1711728fb396e12d, 0x2d497a7646d7629a, 0x000000032c9eaeb8,
+    0x903d919b3e616506, 0x16abc4aaf3718442, 0x00000004ff2ef0d0,
+    0x7519d9eaa881a6df, 0xe70214f5684d3be0, 0x000000016dc34296,
+    0xdc7b67e3ad11b31d, 0xb64bd1b5070d8852, 0x00000002d4ef7f18,
+    0x95604b57d4587836, 0x5eb9c36bd42807f8, 0x0000000534b2def0,
+    0x6e96fcba0b5d55d6, 0x7641b77064b4c9ba, 0x0000000637d0fcce,
+    0xb32e15d8a872f0f0, 0xfb38978dea3248a6, 0x00000005d00d8776,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B163_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B233_WIN_5_XY[] = {
+    0xf8f8eb7371fd558b, 0x5fef65bc391f8b36, 0x8313bb2139f1bb75, 0x000000fac9dfcbac,
+    0x36716f7e01f81052, 0xbf8a0beff867a7ca, 0x03350678e58528be, 0x000001006a08a419,
+    0xc0e3fb6ea0aef9ff, 0xb9f0158c4d02a85c, 0x11bd753a76364595, 0x00000080f50a3309,
+    0x3daf76901c9b8743, 0xc27104bd5c42bcbe, 0xeb52675e98e6432c, 0x0000017a49033f12,
+    0xb871c4a23ffec8c1, 0x6304a9f485f45032, 0x85e59e7c4b69f30c, 0x00000194ed0ca60c,
+    0xf09cd5a85d2698c6, 0xe1e115e1e01a98e4, 0xfab39c214061e272, 0x000000a52f9459c2,
+    0xb02e26c932b29f9c, 0x54bd8b7ec794d966, 0x367ed87eb63873c7, 0x000001f7d14c8236,
+    0x42e822556f72ceea, 0x8c1829baf50af0dd, 0x4b179486cfc7b565, 0x0000008f7c01df76,
+    0x29174e7b457e3d3d, 0xace71a521e9b327b, 0x1d69ec0e724d01d2, 0x0000015a95110dbf,
+    0xa4db6773737440b7, 0xa81a6f2f8622cd99, 0x5f4ad3e2bd7f577b, 0x0000016878ba13bc,
+    0x970432315955c643, 0x477d597fad3b400f, 0x6331f6a00c8ff0bd, 0x000001bab3a411af,
+    0xa1aedb58cfd8420c, 0x939805c8df75e210, 0x90825a1d2e4406bc, 0x00000133db88896a,
+    0x3d8ec38c04f12c5e, 0xf54e45e094b5c344, 0x54f7b787f81801b8, 0x00000109164d2f79,
+    0xc0225e81c98b60a1, 0x249b5652f513ecc1, 0xbf61332a380119a0, 0x00000166a9a8f96c,
+    0xdcb54e9374563493, 0x5902f94b20debab7, 0x1665e12062df52e9, 0x0000012d3a4ec04d,
+    0xc4a4adfc3d6e624a, 0x43731097057bea8c, 0x153692511bf856a6, 0x000000cd64a68a05,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B233_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B233_COMB_5_XY[] = {
+    0xf8f8eb7371fd558b, 0x5fef65bc391f8b36, 0x8313bb2139f1bb75, 0x000000fac9dfcbac,
+    0x36716f7e01f81052, 0xbf8a0beff867a7ca, 0x03350678e58528be, 0x000001006a08a419,
+    0x2694d287794a0836, 0xf3e27c1740c817a4, 0x72e3dac0af959890, 0x000001813e701063,
+    0x05ab47108c2b77fb, 0x04185bce4ccd1fc5, 0x26f395bc661e2c56, 0x0000001e939a1e92,
+    0xefcf499160cb4823, 0x72002426a7bfd3a4, 0xb0f7bd303d4ea7fa, 0x00000199a273118b,
+    0xefccd98f9d3182ab, 0x04cecb520741e6c5, 0x68dfa52fc919a584, 0x0000009ed530075f,
+    0xfa42e4d9f8ede831, 0xc1c098a8ff92bd64, 0xcf353d9324e8cd5d, 0x000001fa05f0f404,
+    0x446e2ba576e52abc, 0xebf2910743fff55e, 0xb740a8893b9d0f37, 0x000001cd0cb23dab,
+    0x0568509d1cbb0bb2, 0x1b9e6eddb49c7955, 0x23f99085b00b62cf, 0x000000baf5add027,
+    0xd27c07b7d62f6017, 0xc5989f1a219e42df, 0x403dd4b1f6871e83, 0x0000008a381ba53a,
+    0x4f823b9415c6aacd, 0x11a64711ec2bdc25, 0xdcd881fd0e2cb947, 0x00000091f5bf07d2,
+    0x3867b6ad8df8b00a, 0xffce75da4e22f6d8, 0x48730eead9d23c6b, 0x000000d1052887fe,
+    0x26dbe0781bb08d40, 0x6c18a2adf3307636, 0xe05c73b4d98a726e, 0x0000015b8d7c0875,
+    0x013e3fa80f27c65b, 0x7ad75121a10d859d, 0x9b024be1a75c01b0, 0x000001c5c6395285,
+    0x42756311f4c4ce29, 0x1bd49f3b88f2197f, 0x6d574a0214b90fbf, 0x000001dcb1871ebf,
+    0x08a6d0adb6a1fea9, 0x78e05101eeaa040a, 0x7f7ebd3f79aa63c0, 0x000000f8a3be1091,
+    0x1b83766f610f2eca, 0xb1a08646b9af1aa7, 0x6b467cc8edc1749b, 0x000000f21b2da842,
+    0x47b2cb3a4e41a121, 0x28a39fbdf74bcb8c, 0x3dac8087ae6a74cd, 0x00000013cc99ae9f,
+    0x08a14f48c6e5040d, 0xaaac865bcfd41b18, 0x1a9187a20ce82fc8, 0x0000008608a76df5,
+    0xaf7d49d945b090f8, 0x9cbdfedd5e1b96ce, 0x999881bc46051014, 0x000001e9c4165188,
+    0xd1c2d832e4a93949, 0x483e09f2551619b6, 0xd2d6e7264b1b6750, 0x000000193bd6190d,
+    0xcd520187956707ee, 0x862e758572ed8f0c, 0x11cab275a0f1da6c, 0x000001f86437b30a,
+    0x5a5bc5cc6de369c0, 0x075947825643db32, 0xa2a1c4f097be15c5, 0x000000f9dbe8b68b,
+    0xd49f98b62367de84, 0xb159d9877c8a0dba, 0x6c46dd1900f72ee5, 0x000000d52ba55944,
+    0x7e4895229721097c, 0x4b66629338a11e0f, 0xdb89e0c3f9d50f5c, 0x000001824b691b23,
+    0x031b8073b9d84370, 0x1148b1a6e205f031, 0xaf9aca972317c0b0, 0x000001a2633f1c61,
+    0x8f4be5ba627a56aa, 0x7bb6a7b83e6d58bc, 0x7394e818e1ae970b, 0x00000100b096dc21,
+    0x98be9b5346f88bc6, 0x64da38d191bb6c52, 0x473a51c6f46832dd, 0x0000000217d1aebe,
+    0x2014e4948f733e70, 0x8fcb78a1fa714838, 0x5ebeb501e0432b18, 0x00000072ad870c73,
+    0xe7375e423a68837a, 0x0b66f5787c8c98ce, 0xdae4b4fddc369186, 0x00000027c96cd453,
+    0xc4808f0d2d69ee2b, 0x7edff1484c0c037e, 0x5576859d119334b7, 0x000001777d04b0f5,
+    0xd02c50fbed30c5e2, 0x3de4cd77676f8651, 0x44aa39517e5b23d5, 0x000000634be55343,
+    0x97fb6f3a03e64cfc, 0xff5aab750ba6ddd3, 0x98aa0e14a6625bb6, 0x000000e20025dd1c,
+    0xca49982dd7c424ac, 0x127cb0c38db5919d, 0x1fd94a5c32ea250b, 0x000000dbf9e2c228,
+    0xe20c4f2ab2c65336, 0xefa322c59952e6be, 0x9d07cc74a2995dbc, 0x0000016acbf59399,
+    0x4513a35de7c97835, 0xa1ccb7a6c597fd87, 0x7555067391b14034, 0x000001c3b8a126ff,
+    0x4b7ed08f43e6e928, 0x7ff59a4da30dd6b6, 0x1b80add6b36f6682, 0x000001208a55cf6a,
+    0x7d18df4a32a32a48, 0xb55610f9fc861d06, 0x9edf7b236504b824, 0x000000846ba827e8,
+    0x0d4ef1ad3e95d7d3, 0x93161fd38ef4dd61, 0x09c8ea80288d8bc5, 0x000001df99c619d6,
+    0x0421e1d7e9e6ac34, 0xc5966d8df3c05266, 0xc07edf893bb55240, 0x000000bd90080675,
+    0x4c4cec953ec0c794, 0x28c5420a49aba14e, 0x79c3087ec4cc7689, 0x0000018f59e6b7e9,
+    0xa0067512c20ffb5e, 0x0b4022b586816c86, 0xe5f28a84010766c1, 0x000000f240b3355a,
+    0x84dea59ce2a2c212, 0x398c22d2db349059, 0xbd047df5a1a67b24, 0x00000091db7a5010,
+    0xfd13b534a67f9f0c, 0xb27deb0396965dbc, 0x127820ec26d0445e, 0x000000eee31e54ba,
+    0x1b6b795540c8d652, 0xcae0bfca39bab117, 0x021c49de9b31a85b, 0x0000015b8a60c44d,
+    0xae4b776ea236c70f, 0x603a84611f30aa29, 0xb231f0d534f685e4, 0x000001facf70ffe5,
+    0x96e99c76aa7e1baa, 0xb7f59d5d067391de, 0x0a7f3f2e954e83b1, 0x000000d6474cdb79,
+    0x9345f119426255fe, 0xbbe70e49a9548726, 0xf4d4277a4e688bd7, 0x0000007f26b88509,
+    0xee2756196c241afc, 0x5b8926ead17b26a5, 0x114f7f9afc471149, 0x000001261d7d7e46,
+    0x3df182614a682ef4, 0x09cc1f1f4bceef91, 0x3142baaa9e8848f2, 0x000001763247b35d,
+    0x7a59acf21487a1b6, 0x52d3e0b48450b594, 0x6d885310cefdce2f, 0x00000191d0db70fc,
+    0x3e4afd1c16ac2b15, 0x5cae2d8515525e37, 0xdcec4b846febed66, 0x0000004e22319cd8,
+    0x15f54fe79bded384, 0xf0fff0e052e56ee9, 0x5a5461cddcd6bce3, 0x00000003e1a4502c,
+    0x849530b59bcbfd93, 0xf07b3d106cdf9eb8, 0xdddd9e1564810689, 0x0000004202b91570,
+    0x184d5c37376248bd, 0xfd242e31c2512500, 0x914245074e7324d9, 0x000001062149202a,
+    0xdd7caf84f6f6d897, 0x092b7789fea1492d, 0xb11448bc78282710, 0x000000c5dc8d0e8a,
+    0x667265d3c17c8097, 0x1e10612a145b0768, 0xca3350bf27fb65fa, 0x000000d8b5bc4b15,
+    0xf437c14007f7eb73, 0xe2b4b534658634ba, 0x897c9d6ddfc2c075, 0x000001d59fcd71b4,
+    0xbcefcc5be3ea727e, 0xd73f8f400ae8f015, 0x37de3a34f93c9782, 0x000000488ce94c9d,
+    0xeb43ff7ee479f82f, 0x336c9cbd9a0677fe, 0xa4564f607c5a6bed, 0x0000004c543dce22,
+    0xf658677891d37d80, 0x721cce06732beb49, 0x11eebec8de9a661b, 0x000000784e62728a,
+    0x8507ac105d172236, 0xcb2b324e61d3309f, 0x1b8f990c6982a0f8, 0x000001eb40bb53a3,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B233_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B283_WIN_5_XY[] = {
+    0xf8cdbecd86b12053, 0x557eac9c80e2e198, 0x70b0dfec2eed25b8, 0x8db7dd90e1934f8c, 0x0000000005f93925,
+    0x13f0df45be8112f4, 0x350eddb0826779c8, 0xb20d02b4516ff702, 0xfe24141cb98fe6d4, 0x0000000003676854,
+    0x83b3a4df9de2bc0b, 0xeed2c51a90467a42, 0xa80d8338453a9a00, 0x25ba8bbf1a490a06, 0x0000000000d257a9,
+    0x2b1cbe3427c8e585, 0x6837b90f291feb73, 0x792106e995513d5f, 0x959069fbbc245bee, 0x00000000022a7592,
+    0xf00b1693048a7eb7, 0xc149b5a6bebabb04, 0xf6e875d73f3cb9fc, 0xbd3c81790a86e65f, 0x0000000001953364,
+    0x9c075d0bd7aa7b8b, 0xc8de42a991ee7390, 0x3dcf495fde66a9ee, 0xd437fd874dd2a755, 0x0000000005c852e3,
+    0xaac1bbaa1054c3ae, 0x7fc226d513d0506d, 0x751ebf36ff59ce01, 0x5319f8d324705749, 0x000000000118e955,
+    0x061126abd80f6d48, 0x101900a4b1b037d5, 0x7679d259ec5ea2e2, 0xab7a75114b964007, 0x00000000061d6f17,
+    0xbf60c7809df92e56, 0x2d603ec4985a2827, 0xdf8594c32224f8b8, 0xf563873ee65d780a, 0x000000000522e9e9,
+    0x9f6da59c67e77439, 0x79d02f32a6c04e8b, 0xc50a782451e96b6e, 0xfa6f8c715ae30b70, 0x00000000054776dc,
+    0xa474fbd67abcd526, 0x6cad2b7b3640244f, 0x36555264b0ce79cf, 0x624c6b40322d2bcc, 0x0000000002baa70f,
+    0xe310996cea0c057c, 0xaa5c6874e21708dc, 0x6813b4171c2dd4cc, 0x2a62984d55d73dc9, 0x0000000002c53c73,
+    0xe599c2c1cb9cd1b0, 0x26920a7f89482e96, 0xc849398269dd6cc1, 0xe8e7c03fd9edf08a, 0x000000000571a1c5,
+    0x59c4066319d7a000, 0xd7d16d56b1f994a3, 0xb4d8e6f369dfe1cd, 0xfc4d757f5c2c07b8, 0x000000000511ecc1,
+    0x4f61a3c310ee9afc, 0x805ffae9d01a1cc7, 0x6799d8b609eb46b0, 0xa13a2e1e01be27bd, 0x00000000032dec6e,
+    0x6e05e9f53f83d6fc, 0x8452c141ae08f862, 0x17e114d3d945d30f, 0x3795d9d6de0cacd2, 0x000000000344d5da,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B283_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B283_COMB_5_XY[] = {
+    0xf8cdbecd86b12053, 0x557eac9c80e2e198, 0x70b0dfec2eed25b8, 0x8db7dd90e1934f8c, 0x0000000005f93925,
+    0x13f0df45be8112f4, 0x350eddb0826779c8, 0xb20d02b4516ff702, 0xfe24141cb98fe6d4, 0x0000000003676854,
+    0x17d4c0ce16b55ba9, 0x448793ff87fe7461, 0x67c0a1567aba83ba, 0xb5d0a0e9f37471c8, 0x0000000001f07726,
+    0xa92fd86147dfb397, 0x8d3dbf328e86262a, 0x1ee58d97701c4a76, 0xf153ae414bc94101, 0x00000000016d3d96,
+    0x2b2117c29c566f3e, 0xb788f88c698aef83, 0xb730a596f7f405f5, 0xdb548d9427ef55c9, 0x00000000008de8b8,
+    0x34fa45e1e75b920d, 0x7e5d174f52d674c5, 0x7fda24bc86362a01, 0x9aafff155418ed94, 0x000000000688fb1d,
+    0xd6e5fd31ebb16877, 0x3c8f7cf4b4cbbf58, 0xe525a7660991d734, 0x8a8ae99486206ffd, 0x0000000005814b9f,
+    0xeaa3237f8b56f412, 0x54e65e84837094a5, 0x894b9daab7eeeb3b, 0xe87c476a7bc258a6, 0x000000000578c3a1,
+    0xcda94a94280b1333, 0x76d742b23512ef22, 0xa388443af806c4c7, 0xf0a6d33be2d8231c, 0x00000000078c67cd,
+    0x02f52ea5ee02b692, 0x47ef0525426a6348, 0xf46b1cf7bcc2c7ea, 0xcc2e38a4c54685d5, 0x00000000045f644c,
+    0xc97fd310c9c74965, 0x70a63242e7b64171, 0x41296824a50797f3, 0x8256bc8ff48202c9, 0x00000000007461b2,
+    0x1cf418f20f86dfac, 0xa65b3b55db7c9328, 0xfa909addf34b3281, 0xa7746e9201a044a8, 0x00000000020acc8a,
+    0xff37bde13c1ca023, 0x298755ddf54d8050, 0x97e1d280a9a4a338, 0x229ef6ad064c51cf, 0x00000000056613fe,
+    0x4a9cc3651bcb51be, 0x8bcd071427462b57, 0x68a6dd9ffb2c670e, 0xc31e8694c5fb832e, 0x0000000000453624,
+    0xd77812f34956bb31, 0x0577ea4d4d133dd3, 0xa5cdc41ce15ff53e, 0x133cfc40a7e0137e, 0x00000000040537c7,
+    0xc3414babe88bdfb4, 0xfc2b890fb7d4bd5f, 0x46122c76c7641e67, 0x09dd34d534c16677, 0x0000000006743899,
+    0x48a0e37881dd90d6, 0xd41c23772508c34b, 0xed8acb7e45e015e8, 0x64988a2ca695481d, 0x000000000107fe8e,
+    0x67ce31a6c949f8f2, 0x13abda9dc81900ce, 0xd74f6d41ffe2c33e, 0xa9151a410d908a84, 0x00000000070031b0,
+    0x846178c7ca73b936, 0xf8ac7161ff153b47, 0x9a9e90426422ffc8, 0xf1625d919788f24b, 0x000000000376dfd6,
+    0x35a9594bcda6d0ae, 0x178a24e6345ab7fe, 0xa47323f2d7148d50, 0x9fb6ceb962dc4692, 0x0000000005a3bcfd,
+    0x8a578c89391980f8, 0xd5055b46bc593380, 0x39450edbda7d3584, 0x46acf55a19ea8b6c, 0x000000000563fb13,
+    0x09e1b6d32f8fbf37, 0xd58aa4767c4ffdae, 0x4743d45cf0c3def0, 0xeee7e39a3a857a89, 0x00000000064a2e56,
+    0xc7dc0d1bc38cba99, 0x9632f3be1761184e, 0x4231d5e471681eeb, 0xb06f4255cddce5e0, 0x0000000007b22b10,
+    0xa526bec4c7a599b1, 0xeffb1043099b6c58, 0xd26db0ef6e314f21, 0xc51d6277fab66419, 0x0000000003cbc8c4,
+    0xf3895630b1b52016, 0xde5b7d466471f5fc, 0x7dfc912a720702f7, 0xaa69138c7cadd51d, 0x0000000002c5d696,
+    0x71b90a78bfb8f228, 0xff966678d6dc0a83, 0xd1e45a6c0c505f23, 0x608253f128b59a26, 0x0000000000fd35b4,
+    0x51dd92b6fdc0ad8f, 0x8898f1ddbc09c152, 0x02b70a44296cfe92, 0x1e50e44a9ed07476, 0x00000000068d482d,
+    0x0637c12dce5f0de1, 0x2ca7552ac370ddbd, 0xb233c1a0cd02ea17, 0x55a88e7eee85dd2f, 0x00000000021420f5,
+    0xf04450790d58bf3b, 0x02512cd40602b59b, 0xfd58cdb6e77da4ec, 0x042138eeeb2ab973, 0x0000000006f86459,
+    0x2e92ccbb698e1284, 0x853e664ac02a646b, 0xbca1ef5117cc506c, 0xdc62a13fb226c014, 0x000000000503f687,
+    0x9e5772d9564e2e75, 0xc5566b5e7a4ff377, 0xefb70a1ef1698f57, 0x50a47dd89dd1e7f1, 0x00000000036c261c,
+    0xd8ec6ae454510a5a, 0x2b048df4c1df9fa9, 0x1a35951d40bf4327, 0xe3d8a566fc4dc642, 0x000000000364ca8b,
+    0x4b8f7d190dce45f4, 0x47902ffafe835b88, 0x6be2623af22c2a50, 0xc9f8a2b66528d05c, 0x000000000664aa66,
+    0x9aca4e13530f9f11, 0x52fccc81d57976d6, 0xeda6ecdcc6c6223c, 0x694a339769a22700, 0x0000000007ee712e,
+    0x231394a8b9422cc3, 0x7a9624e77772424a, 0xa5bcc878115c6d81, 0xcfddd480b7542134, 0x00000000055c3ed1,
+    0x8286ca841b7e3638, 0xed85132af50c7f82, 0xff0997912ec8dc57, 0x047d84183d472248, 0x00000000011285b2,
+    0xe1105d2c64762f67, 0x60737f49454bc88a, 0x491e68d91f5c0770, 0xd8b9ca68f948ded0, 0x0000000003686192,
+    0x359fbb9f1a4496de, 0x89b203eac11e183a, 0x23f27a614d052979, 0xf0ef8bcdb81435a1, 0x000000000691280f,
+    0x0e936d2a10d28267, 0xf30d06ccfe52c864, 0x688ace0a891c1487, 0x7e2953047a4075d9, 0x0000000000126327,
+    0x7da5d0c17c154427, 0x12e66333ff92ba8c, 0x5ae3b70acbfd7b24, 0x7dccadb3ddb1e717, 0x0000000004ded952,
+    0xb8b31af43ca6d962, 0xd05cd5aca6cfd3fe, 0x9a9944e6e3c8c879, 0x09f59d358c57c9c0, 0x000000000419d164,
+    0x0c3938d6164ddb48, 0x5c91ab1397d749f2, 0x4a828f53eca1a9f8, 0x9def712263e64d0a, 0x0000000003e7f88c,
+    0x5b9577572d4e6bdd, 0x3485494d83660524, 0xa0608be1d9ab6e54, 0xb44ea293d725000b, 0x00000000062d303c,
+    0x746e462ac901269b, 0xf59f392ab095b5da, 0xfa7c5df1feb59927, 0x9caf81b3ac5b5ad4, 0x0000000004da4d3f,
+    0x4ac2872f9dc8a05b, 0xbc5fd960d4b7b1e0, 0x78bab9462ebf2cb0, 0x25dbbf1c6cfc633b, 0x0000000001e717bd,
+    0x60401e547675060f, 0x0fa9adc4df65274a, 0xa6fb4f71131a0ed2, 0x605b31837dfc9caf, 0x0000000001c433e7,
+    0x9ff54160b04368ed, 0x6a34747207282514, 0x76bbe8caff4cab8f, 0xc137b605b625a39b, 0x0000000000bf3ff4,
+    0x6a0751de5a500086, 0xc1309cf1425254c8, 0x11c88f72843bdecc, 0x2d603df54fba6537, 0x0000000002ee8a47,
+    0x070e75e23fb69013, 0xc3c7ac5b41d112c6, 0x1cd29e5e28b6bf3f, 0x37670ad7930ddaf6, 0x00000000043753b1,
+    0xca70ca980dfe8999, 0x8f2f4b39d9c763f6, 0x3654192b51b2e21f, 0x772fa7099463995c, 0x0000000001f9755f,
+    0xb04845a1d7c5d537, 0x3ba6d179c7b04ae6, 0x17438e4c41f3d365, 0x97c5177c560ceffe, 0x0000000007022c5b,
+    0x39e231a22b959d04, 0xf6a56a513f5aa9ea, 0x664b7fdb6958890b, 0xbdd059f33a2c70de, 0x0000000007d85149,
+    0xf6512ae8d3d618b0, 0x634d401f3238564c, 0x4384b82a934c84b6, 0xc0d1b52df248dc38, 0x000000000320f4de,
+    0x4813fb052204d1a6, 0x3414290998a7705e, 0x5a10beb98a143661, 0x4b2dc122e4327210, 0x0000000007870449,
+    0x3ade21c2d71e7ac7, 0xe1d6fb0af7d87fa4, 0xa4b0a9afd9ffcc0e, 0x580f56ea860c8d24, 0x0000000005294d41,
+    0x14320d97f7ac30c8, 0xa0b036f4d956495b, 0x19eaff895dc7aaec, 0x0aab340621e47d47, 0x00000000008dacfd,
+    0x8d0c166ba544702a, 0x8c8e1f53ec22e7dd, 0x7e5a203d0047181d, 0xd5b402ec196550ee, 0x0000000001ecfa87,
+    0xd4f39ac395c9cded, 0xa7f1fbb01a0dece7, 0xe5cb700a2e8a503b, 0x819014204e2e9ad6, 0x0000000007d0c054,
+    0x87cc6ee4bcb2f4c1, 0x8dcbbc613dcb176a, 0x93da8e043b393d19, 0x6de2997824e4cfb6, 0x0000000000902373,
+    0xbab3e40ce6998d58, 0xdc6e97f1a0c291ce, 0x40d4a15fba8ee341, 0x6e82333e880d01c6, 0x0000000001b56b19,
+    0xde0a351ae80a0801, 0x8115f3300c75059d, 0xa5af73dbd776900c, 0xe32566cee36ee224, 0x00000000078e5785,
+    0xde254e4db74b12d1, 0x3a46e27b48c7da0d, 0xbee0ccf302ac4003, 0x3c0eff83ab26dece, 0x000000000655c24b,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B283_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B409_WIN_5_XY[] = {
+    0x60794e54bb7996a7, 0x8a1180515603aeab, 0x34e59703dc255a86, 0xf1771d4db01ffe5b, 0x64756260441cde4a, 0xd088ddb3496b0c60, 0x00000000015d4860,
+    0x81c364ba0273c706, 0xdf4b4f40d2181b36, 0x5488d08f38514f1f, 0xa7bd198d0158aa4f, 0x24ed106a7636b9c5, 0xab6be5f32bbfa783, 0x000000000061b1cf,
+    0xb044ff458c40c415, 0x549a17e5dc6815a7, 0xbf314b91420749ef, 0x76e31f7666ba2ac2, 0x3a5cfb9dee62d633, 0x8b27d12d7a9dcea1, 0x00000000000d5f0e,
+    0x5390f0de885e90be, 0x2679690002fcef2b, 0x6ed31b816235f6d2, 0xa85e2e3589f02d46, 0xbd7e42537597b9ab, 0xd491e45cc58e9e44, 0x0000000001db5b78,
+    0xe3da8e257964a66d, 0xb43552c3982b03ac, 0x135b35340b9e607b, 0xecf7fdd4a5282deb, 0x4045cbe81c2b2490, 0xed823c1dd4869e73, 0x000000000004654f,
+    0x29ff878f571daee9, 0xc95832b1b68f59ba, 0xad6a56413c2d5ce9, 0xff94b7050e5c5223, 0x2572c40c3a85aabd, 0x935df4b06371efc3, 0x0000000000a2900f,
+    0xe6de38a979768e5f, 0x46903f022759ff34, 0x5cf1893aaf34b22b, 0x9307f87c5359bfae, 0xbaae876eb15b248a, 0x9c26f1da72fe4ac3, 0x0000000001374fde,
+    0xc03548f6e1cf4208, 0xf52003fbc7117a42, 0xb18daae556f69929, 0x396e4bbcc3600251, 0x2b1c7f395b101efb, 0xe32346bd72d2c317, 0x000000000187476e,
+    0x348d5bd66cc9f20d, 0x0a13d809e21854c5, 0xb4a9a3d55a6362df, 0xf6b082db90d26408, 0xd739b1fe62a5bac5, 0x93fadf1b3ca15af5, 0x0000000001c33332,
+    0x6456d85f408684be, 0x58885eec2b1c1745, 0x9ebc7cb1e1c56be2, 0xb9e1c53c0f2b53a0, 0x1de9033858e3c606, 0x72c3629df4985c96, 0x00000000019ca85d,
+    0xe7a0739fedb90665, 0xf5a453f2f28e7876, 0xbec97d5599b92671, 0x2a0476d3dfd44dca, 0xdd0d9dab993feb11, 0x847482748b5a831e, 0x0000000000e64395,
+    0x0804ffbcec5430ac, 0xd99bacf1780aab78, 0x95864cbc0e449b90, 0x785a134bdda9dad2, 0x719b4b7510da97e7, 0x5a0380571e62871a, 0x0000000001e130f5,
+    0x75c900134edc65bb, 0xe0dacf7426563c32, 0x7ae37b985293673d, 0x769bea6c16099a30, 0x58fba3b6d52ce189, 0x23b6e636b3f21660, 0x000000000116a5ce,
+    0xd0d91cf5d4cb009c, 0xd504eb7d091f2760, 0x5beba103646cc579, 0x6f5eeeb08079bcec, 0xb7bc2dbaf5273aab, 0x3b4b46d4992a80bd, 0x0000000001fe3662,
+    0xd5cf97d8531d89e3, 0xf3bdcf6fb9431b0f, 0x2369bb5367edb062, 0xaf3041ff3d1b24f5, 0x1fa79f8ca9bb6d22, 0x79fb8e1615419bff, 0x0000000001cb32dd,
+    0xed33595b050cd985, 0x03ae709d1ce435dd, 0xa107f7f7f246a18c, 0x3e37c229589d2061, 0x739b62d4dd752193, 0xa8e85889e0963078, 0x0000000000194915,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B409_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B409_COMB_5_XY[] = {
+    0x60794e54bb7996a7, 0x8a1180515603aeab, 0x34e59703dc255a86, 0xf1771d4db01ffe5b, 0x64756260441cde4a, 0xd088ddb3496b0c60, 0x00000000015d4860,
+    0x81c364ba0273c706, 0xdf4b4f40d2181b36, 0x5488d08f38514f1f, 0xa7bd198d0158aa4f, 0x24ed106a7636b9c5, 0xab6be5f32bbfa783, 0x000000000061b1cf,
+    0x805b169f4a2b5583, 0x82765ae22b0fbaaf, 0x3bec2dcb5e33614b, 0x4732ae5ed92e59b9, 0x326cb461d13e47a8, 0x69cfdb4c4b9a7e29, 0x000000000027f87d,
+    0x2fc5c3b2753a4ecb, 0x43ccdeed2a625628, 0xba27d0836b3dd06f, 0x58891514acf256fe, 0x6bd04f1c90b9ff5d, 0x85d5aa01e7428ba2, 0x00000000015f3494,
+    0x6f199ab99ef9e321, 0xed087ecc8ac6026f, 0x7fd5a966974fe355, 0x9f8dddf077505955, 0x106c82387169b94d, 0x05161a5ea1ca8c12, 0x000000000084609a,
+    0xb935f859c441d8de, 0x3c36bd24ea4240e6, 0x3f3f4a757590537b, 0x343a0e2b7f1e2f48, 0x9f30db80a3bd084c, 0x419de45fafbd2fc7, 0x0000000000a2a151,
+    0x934bd24bc192dc7f, 0x9171e907d5c4a9b0, 0x829c17aa7ac2946b, 0x95b0a4e645d34b86, 0xd501a2e187ed3e27, 0x7f3161e2dda63f22, 0x0000000001328528,
+    0x02859dace40ef6c1, 0xe9a5906488bfe9fa, 0xc2fb4c4b1c706cca, 0x629d21f39f89fc4d, 0x88e4a98e14e4373f, 0x83038b32a69ae6eb, 0x00000000014c0f2d,
+    0x09d9068cd5a32ddb, 0xeec612166f9ae1c7, 0x7516bfba45aac1bf, 0x76c9d72e9e20fff3, 0xa9780eb223bde833, 0x3b8f6968c4bccefe, 0x0000000000b3e183,
+    0x9b8929c22e9a1423, 0xaa78751d5966b45e, 0x7439bb8248d6c3f6, 0x22c850d9a3296401, 0x63fb98a4d4bcb6b7, 0x9d1cdbf8f0316d9c, 0x0000000001ee44f4,
+    0x682323877131e5bb, 0x91492eb1e3e52041, 0xc2cf913badef6bad, 0xc577365f9acdb4ae, 0xd02513b5626aff8d, 0x5987294620cbb812, 0x00000000002a937f,
+    0x7f3e576a81972c94, 0x00ece12214340cce, 0xe5cb47c58a22daae, 0xf2e5c59d5ef42cb9, 0xe94d0d750ce4d4e3, 0xa054cbdc46636414, 0x00000000004756db,
+    0x3f5aeb9e8616e193, 0x44ca6c48bddb6df0, 0xce778eed7cde3990, 0xdd59af6e3899d0ca, 0x51ff260546da1494, 0x2bf18e69e6d7a9a8, 0x0000000001f49897,
+    0xb46a68bc27828d25, 0x30c03da5191fe717, 0x4bdf406e97ba631e, 0x8cf002ed64b5e5c2, 0xf74cfa5e697e0c70, 0xbe0b952982455ab0, 0x00000000019679f4,
+    0x3cd6f80df505a891, 0x22d47239bc3e34fa, 0x009acb4d21a75cf2, 0x01e2f4b471140248, 0x7c44b66e73ad252d, 0xf480ab5bc13c3389, 0x0000000000d32612,
+    0xf823e9e8437ab4fa, 0xe19f8d5127d7db7b, 0x541b1eec25bc0c16, 0xc17e94ce7341a54b, 0x78ebf641cc432f38, 0x2c4150902da73b6f, 0x0000000001c71248,
+    0x40672c04b2fb0909, 0xeb906fa28adc1be1, 0xa72156dd5e77428e, 0x29585c3a5705162a, 0x64581102973f546d, 0xa4e103207b4d94bc, 0x0000000000195e90,
+    0x7e521707f8acda57, 0x6a90300b74b88271, 0x015683bd82961ddf, 0xb25c04345b84514b, 0x1c8a68474fabe607, 0x31faef6bfee9a89e, 0x0000000000ecb204,
+    0x8bf41395da3effb9, 0x2ae77c427646834d, 0x101ed90a41014b6f, 0xf11daf33d53d03b7, 0x7c713cd65c38edc7, 0x697444976c54f720, 0x0000000000275112,
+    0x1e64ac2896dc1751, 0x50f77ad8b98e29ee, 0xbb99fc198ea22c74, 0x41866fad4eea97da, 0xb782d46bb69cdcba, 0x8aad958578cdfcc3, 0x0000000000f1f0bd,
+    0x23a0d60f295422ab, 0x9251a600d9c48af5, 0xdee9e8bf5291432c, 0x366ea07b6d308d00, 0x92e2606ee5ce3816, 0x3f8f6d482e369ef0, 0x0000000000f38450,
+    0x1c93aa01d45d834c, 0x021125b6af428468, 0x75bf0b8bf4030951, 0xb5b4257bf8c21ee6, 0x29e7b203338638a6, 0x0cdd0203b6571863, 0x0000000001e82406,
+    0xc4121c506dd5dd27, 0xd6695c55582a193f, 0x4b8925913cc94810, 0x85edfd432e69c31e, 0xa88a0f0be336985b, 0x7a153e831192fff0, 0x0000000001f4b2cc,
+    0x8260ce2718d30ac0, 0xe60103b8774b9251, 0x1103ad3b20222574, 0x7cc8e287fe074670, 0xe7e669cb9335adb0, 0x2dadb96e9db01c98, 0x0000000000e82cc6,
+    0x979e6a74b902cc13, 0x538441dec7fd7f51, 0x8b2e5288d90ac76d, 0x94be196c62ebbac7, 0x2a5f00a322af5994, 0x7151369a9f38f60f, 0x000000000046a424,
+    0x56b2247589047011, 0x04aed3e1bd5936ae, 0xce72a530d85933ce, 0x27f2c7138fdad269, 0xc2f6b99102628f0d, 0x83406a1aaaaaaae1, 0x0000000000319cea,
+    0x88b935cc70a48727, 0x6dfa528679964c59, 0xebbbf9729cca4da3, 0xac2911c4c3d2d0f9, 0x5266a920cd47cb86, 0x4b0ee83609881221, 0x00000000000c6b3a,
+    0x828af0ba05ef2b4b, 0x720fbd9110817002, 0x9f42ed9ef0d722bc, 0xc3c596134be4edd5, 0xd49186fd71c95588, 0x4ec6a1c6cb7b9737, 0x0000000000ff409d,
+    0x8547b35c5445d38f, 0x23da48235bf5e2aa, 0x64bc9e2b27ae2b2c, 0x0b1bb8620eb2a906, 0x726239ecdbe1feee, 0x186fba5ddac191c7, 0x0000000000c2112f,
+    0x48c7bc61347a8168, 0xa285a3360ed849c3, 0x190995b6188b1817, 0x25c53703c0d4875a, 0x340bb28961bde138, 0x2a418d8b95bd6f75, 0x000000000130d755,
+    0x64d97e4430118e75, 0xf271c54a5f7c7021, 0xb54b21a959be55bb, 0x0bf130abcfc12351, 0xced69128e03be08b, 0x7e7cbbb432564f0c, 0x00000000010e1f73,
+    0x09a5f239d8fdc9c7, 0xbd96bfa1db7cd19b, 0x89e1eae99667416b, 0x3453a94eceedae7c, 0x4e85ecda244cccf0, 0x3e72369548245077, 0x0000000001ea9c75,
+    0xce508d45797cfd77, 0x413f284b5d45f108, 0x967a2eb13e13cdaa, 0xcaaff11620fa5b16, 0x85e8c60bb44b9e31, 0x0210a5fd10ba0ae1, 0x0000000001eda335,
+    0x7c691441c2e24f27, 0x0f332efd97304683, 0x2ae561757b616a56, 0x172be0b18a255ba6, 0x24ef60d2a0e8163c, 0x3f28d07cd9d2c01b, 0x000000000165396d,
+    0xe19d85394e5cea17, 0xa41948ac32356c79, 0xeffbb9574a4267fd, 0x033600fba9a175d2, 0xbd6b651caa52dfd1, 0xa04674d2a0e449dc, 0x0000000001d07cbc,
+    0xd51fdc3e02ba2feb, 0x4b630c127fa8f80a, 0xbf6f1127c0427f06, 0x3b79199ad2ac0943, 0x67e02aec2a755921, 0x33d95a35990193c0, 0x000000000127c109,
+    0xe1b271df5e08d175, 0x4d8c70190c2bef75, 0xa68a01ddf2a37f9a, 0x51cc6306db2e87c2, 0xbfcaac7e9041ec6f, 0xf440ef2e07ad2323, 0x0000000001c0a94a,
+    0xdb0b3a8669ae1a42, 0x6d11940db0e4fc03, 0xcf07d4f2f8ae766e, 0x636fda52183175b2, 0x0c76b7d3c125a4ea, 0xac5b0aeb1797792d, 0x0000000000962d0f,
+    0x32c9373625b3c18b, 0x20f6c859a8a42c07, 0x0462b0b28de45ab3, 0xf60a9353db308bdf, 0x18f5b8af999187b1, 0x90f27eaccf35c7da, 0x00000000004c8b26,
+    0x5fb6495bb4bf189d, 0x939cca8bd106dabe, 0x1c3c4c1171f9b7f1, 0x852b8d3e1758fc7e, 0x346192eb31b8058e, 0x4cbf7c0fb24db18c, 0x0000000001ce2cc6,
+    0xdb21fb09eb8bd3df, 0x15065403cef792a8, 0x1b6fa0a7a872d755, 0xf34edae0c734056c, 0x6eb487cb8e57722f, 0x7bbe46e8103cfd75, 0x00000000000e029a,
+    0x5b23750da7c6a715, 0x9d3a299bd79c954c, 0x69482b15ac08baa4, 0x69f94dab3b35a811, 0x06065530aabad898, 0x7f44974c446aeb32, 0x0000000001a64cd8,
+    0xb0ba28353214b441, 0x5e4a824c4a203c09, 0x2bfda84922410f26, 0x6284351221ef33a7, 0x7ea64f34b4bb890a, 0x73ff96d2d2402b80, 0x000000000130159c,
+    0x11c5be441c665d2e, 0x147769a5cb8a01e2, 0xa3f6c435afd0ba1e, 0x969c167eeb6404dd, 0x38731c19d1aaf904, 0xb974895971787bf8, 0x000000000140072b,
+    0x1e7bd890a6408c7f, 0xb09eccbf1c2f576b, 0x6d8cca57898bb240, 0x752646d25797d15d, 0xe6333b1629b06fce, 0x7871ea8a5861416e, 0x0000000000d21562,
+    0xa807026421db0940, 0x3ba63cc85a7f958b, 0xcec682bb5d403f8e, 0x452393aea77f0a78, 0x9649d8f27524ca5a, 0x9de8cd256c58ef55, 0x000000000077714f,
+    0xaf217db9e8ff3c8d, 0x9abf9926a361dc1b, 0xbcd45d49eadbed44, 0x806ea5ea42ee08d3, 0xe071ee6bbc42b694, 0xcb5591f8a2a99c22, 0x0000000000ee7c9f,
+    0xbcb8342721c057ec, 0x6f4c02cd1ab3a968, 0xf116ce1a4cc39128, 0x7b3005c9f3438712, 0x75d08a9fb3a5aeb0, 0x6ed23488af05d786, 0x00000000013939f2,
+    0x30443bce92027b31, 0x85eb1886bb967df7, 0xac77e9ccc10fd4c1, 0xf916159a50d9cb2e, 0x909346a06c13cc89, 0xec9b82f76b4a5738, 0x00000000002f734a,
+    0xff1839265f0ff30e, 0x5a6c60a1028abe23, 0x94e46e6fee189115, 0x2a59b78098aa956b, 0x03902f5e0cd7f776, 0x84ee5ddd8d507468, 0x00000000003b685a,
+    0x14d3b62f13d138d7, 0xca1d226d95df5175, 0x84e9ad15580f4196, 0xf7fa2c764c616614, 0x006afa137ab88360, 0xa72c773966cc85bf, 0x0000000000f9764c,
+    0x19358dc915555dc3, 0x1cfd03ee6811fcb0, 0xb5d53785b6042e6e, 0xb8418970838f3b81, 0x1d03f2b3789b39d6, 0xe85ba16066d784c7, 0x0000000001d15aa5,
+    0x1a8e18797ee7f111, 0xad3fc7ab0be39ca1, 0x89964002f9e68f0a, 0x8e379cd2c2b661e8, 0x4282970e4f7d6765, 0xbeab60794e70a05c, 0x0000000000d6a63e,
+    0x8e11af599a11b6c3, 0x0ad2d61e801e07f8, 0xb25951a6be7af662, 0x1e0532e7a4f79006, 0xfe5f0d39fe3fefab, 0x581572a682ff6e45, 0x00000000000f811d,
+    0xddfbe6cd00b5d2bd, 0x5a883f8a4ff02020, 0x79cd65ecdc9a0034, 0xb66bfc876af849ad, 0x940de83a2be05dc0, 0x007ed04c70de1d17, 0x00000000002adcda,
+    0xe8a82f7e8e25cd24, 0x5a4d2c6ee940486a, 0x07015836592d277f, 0x975946f727984eff, 0xecbc01844d853598, 0x9903b8b049aef3a6, 0x0000000000fdbea9,
+    0xa1c9be8efa390e4b, 0x0a2518beb09d4b34, 0x428a87f03edcdbb5, 0x9763c57e2cf27c0e, 0xfc114fd2920cc71e, 0xda2709f7286fa00c, 0x0000000000a87b78,
+    0x8ec3211c0bf85d60, 0xba185c51e5f93ec2, 0x5d881b8d1e8559ee, 0x0ad5596c095f98f2, 0xc954e8bf7ffa97f4, 0x12281ead23e069a5, 0x00000000005017b8,
+    0xa631aaa5276c1abf, 0xd3d7103f63d2d45a, 0xb4aed6d082bc3a7e, 0x42a3148aae40e1a7, 0x5049be16e94652e8, 0x54e5cd930f333cf0, 0x0000000001113a72,
+    0xa2740faf3b28d724, 0x98cee06b74048f0b, 0xc964015dca5b60c9, 0x2f72a6e9ac6d5fd2, 0xc1c43fb61cdb0367, 0x6ef982fe5be84545, 0x0000000001cfeb59,
+    0x8864812567e50ac3, 0xb9ce3ec7cb64f4ce, 0xb86e77140d176dae, 0xe42416ef931b093a, 0x993c4846e4b922b7, 0x2d55eb813d595868, 0x00000000014fac11,
+    0x2817814e9d894651, 0xc52b60ee01316a6e, 0x8cb6f5c835c92714, 0x4773251189ae014a, 0x5259b3500d07c43f, 0x6def58bff95edcb0, 0x0000000000a15793,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B409_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B571_WIN_5_XY[] = {
+    0xe1e7769c8eec2d19, 0x4abfa3b4c850d927, 0x99ae60038614f139, 0xcdd711a35b67fb14, 0xbde53950f4c0d293, 0xa5f40fc8db7b2abd, 0x0a93d1d2955fa80a, 0x6c16c0d40d3cd775, 0x0303001d34b85629,
+    0x1a4827af1b8ac15b, 0x16e2f1516e23dd3c, 0xb3531d2f0485c19b, 0x6291af8f461bb2a8, 0x84423e43bab08a57, 0x1980f8533921e8a6, 0x8c6c27a6009cbbca, 0x6dccfffeb73d69d7, 0x037bf27342da639b,
+    0xd6eb9738ce0d26f8, 0x1020fbaf55580cf4, 0xdab0e03149de396b, 0xe73b746911780505, 0x80442dea747eab06, 0x969dd1c91e75a9f6, 0x97bba7fd88a25bae, 0x14c28f1f6689af9a, 0x072d033e612ca6dd,
+    0xb1e4433638d87dda, 0xc89f704c6eba6722, 0xe82fbb0bad45f2d5, 0xa77771f0df01bffe, 0x3fa37b6e39baad54, 0x8dfeb90152230aa5, 0xd4d5bd139b372561, 0x97e89f3ea55de5ae, 0x0494ba50070ca0fc,
+    0x7e10c1c768c8d209, 0x6559ad2dab43338e, 0xb8ce613cd800e167, 0x22eedaa849397809, 0x5599a42d9dd55290, 0x32f3815f4d017308, 0x6e29adb61b6aa83c, 0xf8c383a000b6457a, 0x077aac79dc0d8891,
+    0x601152d2b57c5a7e, 0xd232d6df42795efa, 0x9904dbfd62c1d534, 0x961c76beb380a729, 0xd58798fc0ea22336, 0xfbc222bf513871a7, 0x3a66116e11dd7a08, 0x38270bbea69ac967, 0x0131f402bf46187d,
+    0x345b0cde067075e8, 0x85c277eccbd2c2ee, 0xfd2cb6a7987f7cc4, 0x1e3a9b00d69e6dd5, 0x7b909e3612e91660, 0x927a607a0b03ac84, 0xa13f2e74908678c1, 0xcc94055288c2d30d, 0x055323d3ee8d3d62,
+    0x94b73efc11a2a662, 0x44153f64ffcc2f88, 0xa0fcf4dbeabb3ce7, 0xebba6ba145c24a4c, 0x6c20faf7c847a038, 0xbb25b959b8cbd210, 0x8e92fb1f2a71a8b8, 0x3b3fd3969720c6b8, 0x04e1a011452c7a54,
+    0x2795d2d15ea19671, 0xc41eb3a5fe84a85e, 0x403db2c5ab647673, 0x7a33c159c07d6310, 0x1b51043bac7d67c5, 0xd539b851f6df2e14, 0x0dee5f63973a8538, 0xe6af8722219bfc7e, 0x02e28eb85c4db405,
+    0xa8c1817e10a4524d, 0xede66b7ec459aafe, 0xf305a082abf9b62a, 0x8f2910d6de27bd07, 0xc31b345f9c83dfb6, 0xc1cf2056b2b26e22, 0x9135ba288747d302, 0xf9dd128eeb7945ea, 0x0639755a25dc91ff,
+    0xb2ec2c8ec8e0476d, 0x2dda285763c0b2f9, 0x48fd71b6d6008819, 0x078c883727b711d7, 0xa042d6dc0dd31f93, 0xef0c3033e804e5e5, 0xd145402cdc614cec, 0xbdec8f0bd8767372, 0x020f60ee1c635708,
+    0x9d5c579a33a8c025, 0x8dcf521961c2a581, 0x9c6e0c8742bf376b, 0xcdf4100d529951b9, 0xff77e17b4216b11c, 0xdd95ea575867c092, 0xf38cce90623cb3a9, 0x0d10b22547810642, 0x0050b43ddcae1667,
+    0xb21e094a6c3ce7ef, 0xfd43f3997b21cb74, 0xe03dd064dcd0f199, 0x6072a80116f2781f, 0x1069c6eca2c309db, 0x1ae95b8438fc927b, 0x636c252a8f4b3139, 0xd60751d6510d6706, 0x0554ef00bc8894c9,
+    0x7eccca4e4bd38c63, 0x007ed8e7001c4ca7, 0x50919e78b555867c, 0xb7162ecbf2614275, 0x7135727dbbc4dee1, 0xbd6c22696520e79a, 0x21fc53e4b94570ba, 0x55127d8cc18adec2, 0x01199f942e4da8cd,
+    0x77fd5fc7e92ed19a, 0x0c739ced2e1fd872, 0x5d3545cec6739f50, 0x35251aab28355d66, 0x8a7976c7395dd210, 0xcc31c1290380b747, 0x7f23fa4235f8a27c, 0x751e02ddad50ecc5, 0x038ccbefc042385c,
+    0x99fd299721ea21c8, 0xebc59e1db84a841c, 0xc3011fc57b3800d2, 0xaba178ea17d22ff1, 0x0e9fd41b20ea2b6f, 0x93c805dd805f8021, 0x428e5ea5d8ab627e, 0xf9c54489ad3f33e6, 0x07c7b76eae12a050,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B571_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B571_COMB_5_XY[] = {
+    0xe1e7769c8eec2d19, 0x4abfa3b4c850d927, 0x99ae60038614f139, 0xcdd711a35b67fb14, 0xbde53950f4c0d293, 0xa5f40fc8db7b2abd, 0x0a93d1d2955fa80a, 0x6c16c0d40d3cd775, 0x0303001d34b85629,
+    0x1a4827af1b8ac15b, 0x16e2f1516e23dd3c, 0xb3531d2f0485c19b, 0x6291af8f461bb2a8, 0x84423e43bab08a57, 0x1980f8533921e8a6, 0x8c6c27a6009cbbca, 0x6dccfffeb73d69d7, 0x037bf27342da639b,
+    0xbbbe6cf92892b17b, 0xcf3cc290ff36c0b8, 0xb0fbb94fd19f5d0b, 0xa50c7dab8b2ed136, 0xd9cbe3b08f80f695, 0x23caeffc73638e03, 0x9dcf960810629d21, 0x1f9087064078d302, 0x029efa1d31f110f5,
+    0x2f36d6b1796d0f3f, 0xec7a2be434f6aad8, 0x2ddeff44a764eff0, 0x97cf4d1298f5100e, 0xef847cb4ae6a120b, 0xba56a1a349b6904a, 0xaa97d63a5f9e3fa2, 0x50d3e9da434b1abb, 0x052dd38432185c75,
+    0xee637bd69d304e7d, 0x974e47cede9b69a2, 0x22de254457e16167, 0x1f48751f350ad06c, 0xeee8318562f80745, 0x0789bfd2430b608f, 0xff69f8344d60f308, 0xbe66a541c9e660f2, 0x0039aedec07ca3ad,
+    0xb55eb64eedfeac07, 0xf2589daf23c95782, 0x2c6bfbc9df76826b, 0xce5c81b95d09aedd, 0x350723fb17da1693, 0x0bc66bd66e4a5cea, 0x779a35965ba8f9c8, 0xc9fa69b646540889, 0x065cb763e6d8018e,
+    0xbb47faef190580dd, 0xd0f0b21446e572b2, 0x77341729567f414f, 0x3628d41022f929f5, 0xaa1211c44f721ca6, 0x917a12f9e8489365, 0x7c3a2a554ea43fab, 0xe431f7b7c077bdc4, 0x03836933e0024fae,
+    0x74f26855a45d250e, 0x0eb7e74c0395bd3f, 0xe59ca365a44137b7, 0x5da77378b74e90d1, 0x35a8e34d427a9763, 0x7f487e8e795d9168, 0xa207503feb506ac6, 0x400a0879c331b1eb, 0x00cb8bde755f378e,
+    0xdd820dd8c8345a02, 0x27f7ad3f1b523425, 0x2520ae5825628fd0, 0x91b14131ecae8a63, 0x9dcff879fbf3a357, 0xd470659e0d4f738b, 0xdff35300ebc296ab, 0x21d4198c01066bea, 0x03694bbfe68eee59,
+    0xe27864d4b6f68405, 0x9f68f087b47219f6, 0xad9e01e796c383f5, 0x56eda759ffa3dac7, 0xf7c5b050c14454e0, 0xd8ae3671f07c7e21, 0xf7a194152dcf62ff, 0xf3d40f028cb33aa2, 0x02f7cdb6540c6645,
+    0x8fa472c758b453ec, 0xa283604f3f872408, 0xd9334c683d86cdae, 0x8f27809e3a128314, 0x2682d18ddb90a61f, 0xda2658ca651b5aee, 0xb6404a5335a17024, 0x97031de896e0bf18, 0x00830086d79a690a,
+    0x174e0504d1e3ae11, 0xe6dfb53cf1e19cec, 0x7281d6ac2fa70ab6, 0x56aa11b4134d4a24, 0x346d6668d314fde7, 0xb343830a364943b7, 0x36e32f5cdcca2091, 0xb27c209cd6c067f1, 0x058447538f68c7f6,
+    0xa2833ae90abcd78c, 0x8f3a6361512cbd0b, 0x1f2169e393daa6e6, 0x59f25f4a5cd8e926, 0x184a9c24aaff015b, 0x917d1ae5a7d1f160, 0x03a25175dccb5b00, 0x6effd63419007ebf, 0x00e7a5e65d528bd8,
+    0x95da92b203505e7e, 0x557212cc1214e198, 0xb0f6b61f1be207d1, 0x4123c61192772167, 0x80721d62f0d55b47, 0x523b9bcccad0d1da, 0xd6880bb07c416e4b, 0x742084d477a508e6, 0x0637fc8d009e5042,
+    0x6412e8b5a8c1ee89, 0x26e121948eedae27, 0xb7b87b76f8eb3e94, 0x5fc6ace3df8fa985, 0x18234c02f76c499b, 0xb4386ffaa402e0ae, 0xe02523f5feef65bb, 0x09a4da13fecee98a, 0x052106e19f5dfd01,
+    0x1bb610b2dcd7bd77, 0xd6815ecc6485ef5b, 0x91b690db63328e0e, 0xc4725a43c390a9e8, 0xdcdb249667291731, 0xacace5049755b1cc, 0x2f03281db7c927d7, 0xde1cdb5277100c01, 0x0768a34673ef75ee,
+    0x4e7abb0c19611a62, 0xcacbd3b3fb417542, 0x8474f60498bf3860, 0xc7df7cdcd9403f5d, 0xf799a27c11c94f1d, 0xad5f6ce91910fd5e, 0x79419475bcbf6e9c, 0xe713244e92156acf, 0x01661af4d8b2f075,
+    0x7f3b257f76d81e5d, 0x56c710e9ec645a06, 0xd71d57739fea87c4, 0xce6d2e96f5cad5f0, 0xd05a474c30627740, 0x5dafb93d472955b7, 0x6ca5dbe260415a0e, 0xb9756271faa4388d, 0x04f98c1ed9632648,
+    0x4693278cbcbe5b43, 0x368c82419aced74a, 0x2e935d768271d28b, 0xdd66ab253ac14341, 0xe07248b2abbcbbf8, 0x3553839041df2879, 0xc5042e86bf9ac67c, 0x3f6d95674e5377b7, 0x0099848eeccab696,
+    0x11fa691bda744a55, 0x468806c70960a164, 0x4921131cefcd0331, 0x139c9abd642a65d9, 0xb379dbf24a305f9d, 0x346ba228a894056d, 0x6c6202c4ee46532e, 0x15341b6598ff2b18, 0x05ca9420b4b3ed14,
+    0x936b2897954a7b4d, 0xa5c413c8df1619fa, 0x18a45418f07c6da3, 0xd2a81d95fb74bff1, 0xf31ee54720899d86, 0x4f786b7b2739ec4f, 0x3db83c70be3355c4, 0x2bfe9fabf977396e, 0x00d9b720bec765df,
+    0x9b93c8438f05c954, 0x1ecb93e1e21d60bb, 0x0048d564f7a69769, 0x78841d5dea1e8624, 0xf68b64a8c6ebb3e3, 0x163bf30ca8248b00, 0x411282e5626c0482, 0x08d778771ea26d08, 0x004d089960956f8d,
+    0x82b3edc393ea8a13, 0x9956999cc5f844da, 0x7b56c7924d07d88e, 0x9827bbd92949b030, 0x90dc86070ddc4a1b, 0x28883dec34704828, 0x4ea351f1b07f5575, 0x2ba9e9072ceea19a, 0x00dc7f77acb2b41d,
+    0xee8edbe1154f17c8, 0x604d7ee0fffd6e72, 0xb75c658ca990080f, 0x4203dceb1af84d5c, 0x2dc2eb4aed4ccae8, 0x233194f88de6da43, 0x2c0babf9ad9b2eca, 0xcae3960fa224616c, 0x04505224b94adc3e,
+    0x1d4878b52e2f5274, 0xfdfa1292d8966b8c, 0xaa4a57bc58f1782b, 0x6ff6fe0d7eb06a63, 0xa753c765f8f1622c, 0xe0b22b492dd6475e, 0x8a96aadfbd0a8f19, 0xfffd7f0ccc8c7eaf, 0x03c81d834ff14da6,
+    0x217313d692c6d535, 0x8944f449e6416a7a, 0x7133acd265a3a787, 0x34240df60092ef8c, 0x65ffddf3fd409891, 0x3addc11d92ecc6ee, 0xc34756fca4ca1cb0, 0x4caa4e67bc3414f5, 0x01c45aec35602253,
+    0x59f8ae6481e02db0, 0xb956347dcefdc3be, 0x7f358bb11bca6a32, 0x4f2ae9a15ddf6dfb, 0xa4b2b03094978c4c, 0x0010ee2cda5ffcb2, 0x6b7f4b5f3568c456, 0xb8d3e92ee4df077d, 0x0755a8025bfc3908,
+    0xc29fe5ce08abb73c, 0x01077e603f47f8b7, 0x558666e20ee854fc, 0xe0088632b91b5611, 0x1262e579604ff294, 0x4ea50a97b9dbefb2, 0x935825234a34c43b, 0xb2c924c3888a2ed1, 0x00274e94a05cbc96,
+    0x4437deb2d876c5e7, 0x237a5ba6d4cfd60c, 0x0e90798ddd2fab0d, 0x88575b1f4edadb4e, 0x86e4ec625e7fefcc, 0x409e49ee093d402d, 0x395da1bbe1aaf3fa, 0x479a5b8408b3b3fd, 0x0018ffc84027aac6,
+    0x29df90b0a4e4f172, 0xb63ab0f384f2956f, 0xa4f51a7132e4d94c, 0xfcde60d9bc7bdbef, 0xe60cddeadcb17300, 0xc14ec9267f0a67e1, 0x5909df39e1641761, 0x7bc6d92cb8cba00d, 0x00d98e89e732f371,
+    0xc229b319f37f2b7e, 0x4dcbc2b68e2f3a16, 0x85ac7f0a71674373, 0xb2307bf837b73844, 0x74d49850d726cc1e, 0x539dd83a70f58132, 0x39cb352e598a7bf7, 0xb7d56a8ee200eba7, 0x02d8685ae010ecbc,
+    0xb6cf332c665e7232, 0x60e39f12d35bece1, 0x4884a8773aa1208f, 0x0319bdd7e8a39f62, 0x38c92dc8a6f1fd51, 0x01a762c011d0ddca, 0xbd8de05d84749934, 0x192869194fe7ce06, 0x05801b5f8e504754,
+    0xde5838f39bd3c3de, 0x549e4a156612330d, 0x232499ac8b764d28, 0xc2ffb2028b2bb03e, 0x575e8fb27bad9f94, 0x33dc61d36f061aea, 0x48b62fa414f728cc, 0x90a2c9011f73f156, 0x014e8a33d10ddcc5,
+    0x63f8165fa8019aa7, 0xb0ebd70c2f975295, 0x62040149dfe4cef2, 0x4e59f22a6fada851, 0x5f6baa76c81e2bc7, 0x9aa4d9b53dec790a, 0xd942c71b33bf0f0c, 0x09162391d0cf7ccb, 0x07c40b3371ab9a3e,
+    0x964c8c93ea29b20e, 0x856b65c4d610842f, 0x4d457649b3e68008, 0x97bbefb05a62460b, 0xec9f72242dc45f51, 0xf17656282feb8e05, 0xc98e4a02ca5b5cf7, 0xc5205e4b6e3cdabf, 0x032d7a2ea9077601,
+    0x3323c5ee0786aeb0, 0xa30d0f3e7b22750a, 0x7d6e1cdad8705505, 0x130dcb67c1a66743, 0x5de99b4ad4840552, 0x1e8d8e1b97cae517, 0x83997ae97521260f, 0x662f9adfa18c05e9, 0x0429a2b6f7780cfe,
+    0xb68bc7eb78f3e08d, 0xfdcd490a8eff3c41, 0x7ee4f731e0cf3cd3, 0xb04cc9dcbb07506e, 0x7bd74c12014194f6, 0xfffcc9eb41e5e5cc, 0x7e8002c730c977a0, 0x19ee4b1d86ef9ec2, 0x031a788cca5274a4,
+    0x241079ff8630eef3, 0x1ed23e5818bdec69, 0x824cf06e4a668a22, 0xf1fa352cb1dddff1, 0x3197a4803fde9aa1, 0x6e93037ced995ef7, 0xaca5014c00c02a63, 0x84dfdf94970ae548, 0x052bb2704ab1fa72,
+    0xa3be03b9df78c279, 0x36194c396287bb51, 0x7ce6bd2df42dd2a4, 0xa0634391b09e6ae1, 0x147a4b97a1308a18, 0x30b41f701483102b, 0x96f4049a0cfda81c, 0xf7dd6ce1079d2a72, 0x0682bd9a3ec7c9a3,
+    0x4a525bb16b615ca1, 0x7882e7d359407088, 0xe5e343736c50bdf2, 0xefa56c3d3db97df8, 0xabefb5d6dd8b9060, 0x847963851872eada, 0x295080dd435687e0, 0x6cf6b994034ffc80, 0x07d0ffb323b9e2ac,
+    0x695ab074f5e96671, 0x36cde2ae2a84c534, 0xf16dcebe2333c484, 0x11ae39742d409235, 0x23066ff642eb2522, 0xdd1bf931916017e0, 0x22766cb771c1ba7f, 0xeee4b80d84fae751, 0x016996cc9eaa91eb,
+    0xb62d61156bca140c, 0x29b8d93198b68c23, 0x71c1a2374ce1a8e9, 0x4cd8aa8379323306, 0xb3d22e936fcb83b0, 0x6ea967d5426251b5, 0xce0ab67e3706f047, 0x5ce1cf887eefb6f0, 0x05fd5eb8cc0ab324,
+    0x57e587b3a4286633, 0x2f1b6112c6a2ca0b, 0xbe9addffbc6beb0f, 0x6d9e5ece51958008, 0x50f92109539890b5, 0xa0516024071d8f42, 0x7c3d28aa6e854188, 0x7e2220f8736fa7ac, 0x00c4ebedf4fb9c3e,
+    0xf6467bd44f5f47c3, 0x569e46b81ba97bb9, 0x820785d7aee0165f, 0x8394e06a99ecd47d, 0x84615a7c8eaa6473, 0x772e214bb412be40, 0x1ec23731d7144096, 0x2ac99fc6860568c9, 0x0784c043b5caf46f,
+    0x7353050884a6051a, 0x72edfa94870c5823, 0x8bbc3c67e762c488, 0xfda691f1bea35026, 0x727252524ede25ae, 0x73c2cc6bf6dfd106, 0x7e152974be6ceb00, 0xa516714f2e6358b5, 0x04de94ef37ee1a76,
+    0x8f978dd07150dac4, 0xc73864b8bec872b3, 0x3871a89241db57dc, 0x279978d535d907ab, 0x2b94fabf956f1429, 0x549be31ae7305103, 0xbd74bcb1e56bad2a, 0x59cac34c17ad34d8, 0x01fab272c24ad1a6,
+    0xedea54b1e9014bc7, 0xf072c10b683f207d, 0x2c9266adec60ba4f, 0xef9c6b3fb0819920, 0xbd6fb10f86525cb9, 0x7746b028570c0b7b, 0x4091c2511a3ccc4f, 0xc66c00e94d3c9a7d, 0x04350f6093393dfa,
+    0xf90f9d93c898a2ff, 0xf6268e7fc00a6939, 0x47579ff19e1e390c, 0x16cf397ece420cea, 0x44c518222a7443aa, 0xd2761a4407a61890, 0x9338ec21a1e7a098, 0xf5afaec91fd7f1d3, 0x058344aba9589a28,
+    0xefdafec1766618b7, 0x85f6b3f1397b6e86, 0x2427b409c72c8bff, 0x2a2a0ebf42f4dfae, 0x2f52b6097a5448b1, 0x6f13e17410816283, 0xe4d5813ce606da3c, 0x051e6789724e8b1d, 0x032730e614596915,
+    0x7d6c2c7e8e4d14b1, 0xf1c9b1c4e846fbf5, 0xef395d6bfb96922f, 0x19f7a0d02b9afee6, 0x10e5ff45d766fe48, 0xe1d0600c9e2c7723, 0x614ca5f49a588b44, 0x07413caec200521a, 0x00cd6f4ec33581ba,
+    0x1c0fa58d49252e4d, 0x536d9da58f8c736b, 0x1a9b675f07cb4ccc, 0x865c40e1fd95a57a, 0xff0d9658db1d377c, 0x14d2d96c8f540347, 0x703503758d07dacc, 0x0839cdf978860582, 0x024ae7c191651169,
+    0xa75babcf78787439, 0x3d7b0be2f64c10d9, 0xbefb1457384d51e8, 0xd40a31bb979166a5, 0x800252ff0a8bea22, 0x79960490581da15c, 0xab5afbe10b2cf75c, 0xd658aaab9e447f86, 0x0700063237cbfdec,
+    0x4681c2aaa2bd1e25, 0x4a8b3536baf36ae9, 0xf155d8b5c48fc694, 0x74ab2654a2b19789, 0x64d97caca1ea18aa, 0x4a909f7e8ce6ba72, 0xff3fe221bd203244, 0x79aaf1c45674dda5, 0x03933533ac4e2ba1,
+    0x8e66788e4fe42a37, 0x885130daae425958, 0xc4fb9da769a65e36, 0x34c0db5df68bf6e0, 0x8318bab4f4658c5c, 0x5ed1fd76f80302eb, 0x3bcf67ff6c5fa4e3, 0x6cadcff36edef547, 0x00dc0d00d4892a64,
+    0x834cc1bdca7928da, 0x39e96267dc358da5, 0x3552d6b7ba4235ce, 0x0b98f503c0daa864, 0x464955dfd1449c07, 0x695afc24328e3d5c, 0x45a426479561a353, 0x6447af7917f1d6e1, 0x0608042a6eb8d3c0,
+    0x4a16f5d027f767e1, 0x0b2584341ee87494, 0xab13d0e3f8184c9e, 0x815c10f2ba9de834, 0x577b8648c7f0a186, 0x4487176d7b7e5ce2, 0xaa09915f682d884c, 0x40891eec60118472, 0x038a89affe7527be,
+    0x958ada26ac55c8e4, 0x8130c7c3fc5fff4b, 0x1db7935034c4f781, 0xaddc8e3dc26fbf31, 0x95cda36978a2ad17, 0xfe8eadf0363a460a, 0xda8d28d92fd0611a, 0x302be128048c2486, 0x01fae93853be0f70,
+    0xc07dc3bd7abe4e60, 0x4c5b987aeb916441, 0x4729cde623a3a8dc, 0x0e444e96252da80e, 0x60bbd4c127e7e909, 0xafdb2a22c53dd251, 0xa95a82353df1fb6e, 0x44d743d7f394107a, 0x022d734a064b3ad4,
+    0x261e1ccbfb5227d8, 0xec976a8a5fc76d50, 0xa945dc9a6ebc0aba, 0xa650316923dfd1a3, 0x0e7ee9d1d1ed4144, 0x800007796cdd97e7, 0x14ac260df8a5ad3d, 0xc75b76db78e40c85, 0x0329cbc18360865e,
+    0x1cec7f0db5ccb70f, 0x20ff0157e57f2576, 0x13195c6f72102eac, 0x15677644064a2cbb, 0x40f2a0da7130da00, 0xb4a853f4d12a94ca, 0x4595c64102d8c8b7, 0x493b0c6fa9cc9158, 0x001dee92aa49657c,
+    0xc8bd29af78cd54bd, 0xdd7548c74c5a9161, 0xbd8e3c898012266e, 0xda109c46defc8646, 0xa56e4b34fe8abf82, 0x32bea21500467c77, 0xe572e8fa25c26602, 0xbe904750505aa0c5, 0x02371a8adfe5e160,
+    0x4707db40eb990a49, 0xfb0fa9247864a899, 0xb44f50f32ba77845, 0x66fb1e3833e4cbf1, 0x2fa1c5cecf281aac, 0x46cfd1673c7e7f2e, 0x345c8100dc9f545b, 0xb5004e46a8cba277, 0x02d1f966877c13a5,
+};
+
+static const word_t EC_PARAMS_ID_NIST_B571_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K163_WIN_5_XY[] = {
+    0xde4e6d5e5c94eee8, 0x7bbc11acaa07d793, 0x00000002fe13c053,
+    0x0536d538ccdaa3d9, 0x5d38ff58321f2e80, 0x0000000289070fb0,
+    0x820033db20f69520, 0xa2af8e3f2828024f, 0x00000002acfcfcc9,
+    0xe5804109ffecdfe4, 0x15badc7b4c17df14, 0x00000005729c47f9,
+    0x8884a04e107b6b6c, 0x423edff60294e828, 0x00000003799f22e9,
+    0xa4cc4b30d471ead8, 0x934512ce56e7d77c, 0x0000000682c9197f,
+    0xa51b7d385c6ba200, 0xd05b617b11464326, 0x00000007be052cca,
+    0x56c319ddcaff804e, 0x4f8021100f0bb33b, 0x00000004520ce860,
+    0xe06b8962b642970c, 0x7aad87d368fbc781, 0x000000016576d3f8,
+    0x9b64f38ba2f52736, 0x603226313845e0b9, 0x00000000b640e3e6,
+    0x40ca04d2f7657c5e, 0x228b4a54255735dc, 0x00000005e9fb531d,
+    0xc5d7c626b4f94c5d, 0x59c5dcde8b925df6, 0x000000029f47b646,
+    0x90c7d87f7698ee48, 0x33e0710be6975775, 0x00000006edce85ea,
+    0xd73cdd6a59d9dec0, 0x7aa85845c729fdfd, 0x00000001b3943984,
+    0x7640142a14baabb6, 0xdf7fa7172dd2a57a, 0x0000000661a293e9,
+    0xd99cb69b31071153, 0x93e3f7a42ba36fa4, 0x00000002309b6964,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K163_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K163_COMB_5_XY[] = {
+    0xde4e6d5e5c94eee8, 0x7bbc11acaa07d793, 0x00000002fe13c053,
+    0x0536d538ccdaa3d9, 0x5d38ff58321f2e80, 0x0000000289070fb0,
+    0xd05611e3b750b440, 0xd13622335c4c02ae, 0x0000000566a2e740,
+    0xb4e0bda9295f3152, 0xab0da04bd976a6ca, 0x00000002892b7baa,
+    0x86f85b548fc1b3e8, 0x82ec12930aa53830, 0x00000002e136d595,
+    0xd444e4503c368369, 0xb2c3887e049adc04, 0x00000003abfc4ceb,
+    0x4af33c89f4b4a6a1, 0xd8570bec52c8b598, 0x000000065a5fa2dc,
+    0x3e7d74d6bf71fe6a, 0x3931cbc1a3c86cff, 0x00000003fdd7d9e9,
+    0xe36d467db4ac38f5, 0xb888b3151855060f, 0x000000025757b80d,
+    0xd56cd01baf35aaee, 0xe660c828078e73ab, 0x0000000220d54ce8,
+    0xf7d4c5ee62e37af5, 0x719c17191945c432, 0x000000038cdf9623,
+    0x1be0b53aeb61250f, 0x45a6baafd0b3952f, 0x00000007f750269c,
+    0xd938cf974da2aac6, 0x758daed642eabac8, 0x00000006eea9cd1a,
+    0xaad7a001f013df4a, 0x9670c6b664daafa9, 0x00000001f422e1c6,
+    0x3cdaf5b11089e447, 0xa47905f4066eacb1, 0x000000024fae3c40,
+    0xcebaac2a14c9776d, 0x456209c240683dcd, 0x000000010056b4ec,
+    0xc0e1fac70c8fa30b, 0x18f3f18661f6d24b, 0x00000004517ab688,
+    0x148439ec580ee20a, 0xf011eb03e24853f2, 0x00000006df95c2b7,
+    0xcf541298b9651559, 0x19dd36869c8e743d, 0x00000007cbd3c76d,
+    0x31ed0d901eb0f639, 0xca67d69fc97e7ee6, 0x00000006f078880f,
+    0x47d91717032f204b, 0x63a45a632bc4fac2, 0x0000000682b0a432,
+    0x6e6682734d8dd4c9, 0x27a144124b6faf4c, 0x0000000687a9f84a,
+    0xcd3a017f383fe063, 0xcd72bc627306306c, 0x00000002c242173a,
+    0x2447cdc25468c07f, 0xb235ae6eee760173, 0x0000000475be5151,
+    0xd863185037302ace, 0x44109fd0effbe0ca, 0x00000004ee030746,
+    0x8f2c74933babfa2f, 0xdac47209d705262b, 0x0000000455976f06,
+    0xd1c471c09e8abcbc, 0x61db88e862face16, 0x00000001b9081440,
+    0x3438989b9ce8707f, 0x370298e520737bc6, 0x00000000cb259df4,
+    0x076770deaad252f1, 0xeb49ab1788f5f020, 0x0000000507f6235e,
+    0x30698f1657beaa56, 0xe6ce1e36845bc484, 0x00000002b6feb448,
+    0x735a93cfdd457f73, 0x0410d7e4212afbea, 0x00000004139c2a76,
+    0xf41bb8a2354eb5fd, 0x576b49d2ca8b14f8, 0x0000000126874ce9,
+    0x62946ac3045422b0, 0x63832013d324c205, 0x000000042eeed30f,
+    0x63bc663396a8229b, 0x2959c02cc3e31b5e, 0x00000002cf842ed8,
+    0xcf2f7d12a6cf8fda, 0x6d784345f10e2aea, 0x00000005f9f260a9,
+    0xd6ddb2339f4c05df, 0x965a035eaa09e165, 0x00000006636e8904,
+    0xae36ed427ec3ad0d, 0xb1cdf9b4d0a084a1, 0x00000003079f24d6,
+    0x711cbf7cfb2a5814, 0x51df21f9529671c0, 0x00000003f966a508,
+    0x4b060da2981fb473, 0x52f6b35fdb3c23aa, 0x0000000105ab18d8,
+    0x6759ac0177d59fae, 0xf097319c39ba5c10, 0x000000035bb4d7aa,
+    0x9cddf45acb1cce3c, 0xff4e5fc9e58d9f83, 0x00000005eb36e453,
+    0x547dba6f72e637d0, 0x272766df238fe1f7, 0x000000067a79964a,
+    0xb4472d57945330ca, 0x39245f147233930f, 0x000000072b350319,
+    0xeda1b021fb5f217b, 0x1d067e8eae6fed05, 0x00000002013527e0,
+    0x5814f829e9c5defd, 0x637ccd3ceb52cd07, 0x000000011fd81288,
+    0xc988c10df7fd5f50, 0x146e4f24433f5e21, 0x00000001393f3aae,
+    0xd282af78cf44ab4e, 0xc2740435bdd459cc, 0x000000067dfa4137,
+    0xacb8b8dbcdd4ba54, 0xce24a08ff4b374c2, 0x000000063c73bade,
+    0x289c2b2da74ff69c, 0x6885413147d3f9ed, 0x0000000173770ee9,
+    0x861ed7ba9c080e6d, 0x5261efdf7ceb1a4e, 0x00000002256b3e98,
+    0x13b52cf091b7f780, 0x8d48250ef311643e, 0x000000052c5348b3,
+    0x1ad21345f64546ad, 0xc7d8df85c25a3bfd, 0x00000007df0fa0c0,
+    0x153a29e0a6252c20, 0xa37b95cc2cd1e66e, 0x00000000a1e92ab1,
+    0x0a34c5d33f68d61d, 0xcb17360848117caf, 0x00000006da0d9a62,
+    0xab272cb4a0da17b5, 0x8261c300802930e8, 0x00000001c8b3d06e,
+    0x1800b25291a58477, 0xe4135c450c57edff, 0x0000000667bc7d8d,
+    0x427c72c605a1fd5a, 0x05c5f4168fb644d2, 0x000000012177cc74,
+    0xafd562979f966e3c, 0x14b483ab35ebb642, 0x000000058fadc4d5,
+    0xd11c4390a839c5f9, 0x38c656990484c0b8, 0x000000069dbbe000,
+    0x42f0c1c00c8e4709, 0xa7ba38c7f770bd1f, 0x00000000eecf24c8,
+    0x0846e6c6814e8650, 0x3dfeed1391736334, 0x00000004a0651d22,
+    0x2611bfe4f73450a1, 0x4feab2c27b525d0f, 0x0000000668136308,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K163_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K233_WIN_5_XY[] = {
+    0x0a4c9d6eefad6126, 0x149563a419c26bf5, 0x7e731af129f22ff4, 0x0000017232ba853a,
+    0x56e0c11056fae6a3, 0x27a8cd9bf18aeb9b, 0x19b7f70f555a67c4, 0x000001db537dece8,
+    0xc29bfa27e53a7a46, 0xac287b41baa1f789, 0xe341407715ca4a7f, 0x0000004656e0aabb,
+    0xaa562e9862bc00ce, 0xe97ebcc078638eba, 0xa513df787a64c618, 0x000000f79a7245fb,
+    0x854d4d562aec4c81, 0x1d665f96701728b7, 0xfe2c1facb632dcb1, 0x000001e6203d117f,
+    0xb89ee35c54d396f8, 0xf0742d0dd725e5f5, 0xa23771c693f0ea1f, 0x0000013bf8ef521f,
+    0x1ae0dc23c5afeb2d, 0x8df31f4c2bfe2801, 0x252ebc579d408206, 0x000001f6a2c4d6b9,
+    0xa936e640edb96e76, 0x9c0c423e43a21484, 0xa0afd7741d70c26d, 0x000000a3410a3bb6,
+    0x95ad3531043c4008, 0x867aec806bffdba3, 0x46f13cf46acb3234, 0x000000127a261bcb,
+    0xa1dd78780fbaaf41, 0x403e89e0091a6d04, 0xb07a8e7c05c55421, 0x00000096bc73ab4d,
+    0xc451ce3d89b8ae9e, 0xf864773043f15fd4, 0xdac776f160da456d, 0x0000000fcb44858c,
+    0xa2cfae21fa4044f9, 0x51c651afaab038f6, 0x8301f44683363684, 0x000001247083bcdd,
+    0x888d5cea206057b5, 0x20f39b9d96ec9897, 0xea895bffea3898e9, 0x000001de706e8a45,
+    0xe069c2e74804bc96, 0x6ddb6c4bf0d2eed6, 0xeafcd07f8d1c2b37, 0x000001f4bf62b2c6,
+    0x3998f9c5c6701cb5, 0x1adc22badcd3d1b6, 0xc7a8b52b949143db, 0x000001f21d16dea9,
+    0xd09c4697e1b15c39, 0xaee3a6e9e30e4ad6, 0x28504d309c13bf9f, 0x00000045ce28219f,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K233_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K233_COMB_5_XY[] = {
+    0x0a4c9d6eefad6126, 0x149563a419c26bf5, 0x7e731af129f22ff4, 0x0000017232ba853a,
+    0x56e0c11056fae6a3, 0x27a8cd9bf18aeb9b, 0x19b7f70f555a67c4, 0x000001db537dece8,
+    0xe569573ce058ccfb, 0x86d1428d846fe958, 0xbcd3b694c6576253, 0x000001ab69fc1ed4,
+    0xb7de85875e24ef91, 0x296b9fdd3310ba3a, 0x66fdef4326d57c72, 0x000000dcd4dbf11a,
+    0x77a4865bd26e61fa, 0x4e1e326c608ca927, 0xe1a487f419df1584, 0x000001f1f2ec7eb1,
+    0x8ad9f453f7db526b, 0xbec4961d54f974d6, 0x40bd57dd971cb443, 0x000001d75d95ba5d,
+    0x158993a2e41070fe, 0xee3606205e9c225a, 0xcf13ec9061541661, 0x0000005ae44b2d56,
+    0x88ab55aa328406fe, 0xba23989163c606b9, 0xfbe5c7f74f701bdd, 0x0000007df1488589,
+    0xc37aaf424d3265d3, 0xd484fce1ae090204, 0x048fc2f2fdb534cf, 0x000000366eed7f71,
+    0x0dae3bf3e4d95fc8, 0xa26d6423c92d668b, 0x84b5eaad464c92c0, 0x0000012af259ed2f,
+    0x4450b9674a7150d1, 0x6cf7404ad82cedc3, 0x9e22e47e99290eca, 0x0000003b17665731,
+    0xaa4e34006573180f, 0x3b85c22905f9d45f, 0xef02fd2dbc40265e, 0x000001f76ca3b173,
+    0x8505afd7402a1234, 0x09b37764530c77d2, 0x082addc92db0cf3e, 0x000000fb20472013,
+    0x81de0d636cf87c24, 0x14328c37d970bbe3, 0x3e4aea3a84e7bb79, 0x000001da441e0231,
+    0x29894b951be65fdb, 0xce899f22cc546dbb, 0x00e0d227e6b84b79, 0x000001832bd064e4,
+    0x70a8ff512627900c, 0x0d0a9dfb0083d2e5, 0x6001842a2a0b6bf7, 0x000000a0b80aea72,
+    0xe20d7ff52ae5acf3, 0x33ce4cf73bf86789, 0xf32a1feb92bfb77e, 0x000001898a9008d4,
+    0xa751287bccf155a4, 0xf0832386a4ed8a4d, 0xbfc0ca44dd3d197e, 0x0000012a7bf58b99,
+    0xc37166fce473f007, 0xad78066ccc15988b, 0xaf68fa6edb83645c, 0x000000ebac01e351,
+    0xadb54e75517446ca, 0xd07082ba8506529d, 0xf408ca73371cb1cd, 0x00000088f35eeecf,
+    0x0e831e4ff91236b9, 0x3a824a548af18cf1, 0x5063428be4689b56, 0x0000019fb5b6ecc0,
+    0xca412c130c6c6fab, 0x39d9e902ed1275ab, 0x9d811ede5c7961f5, 0x00000157458324cf,
+    0x9c8edbc4d72c75c8, 0x8c360de2a75dcf2f, 0xf664f15a57c2a45b, 0x000000291c69097a,
+    0x0236c20cc200fa1d, 0x04460cf069298055, 0x9ac0ad5c980b160a, 0x000000be5331d4bf,
+    0x2e662de8174bfd8e, 0xe34acb523b365003, 0x3b5504a044bec472, 0x000001f91dfbbf1a,
+    0xc5d41fb465f74e49, 0xd1ab177366d4a33d, 0x7fb0d6810f2cb368, 0x0000009a82df366a,
+    0x4d9e25233e6c8573, 0x4c7dc8024cad14bf, 0x854a9d08c8c1cfae, 0x00000087e6e2633c,
+    0xdae56121e6ea8aed, 0x05e94a94c38d8394, 0x7e934d38dfd03251, 0x0000012be565f782,
+    0x05f96fc159d6031d, 0x1a91f662b2ee3bed, 0x724d2ee3d8d1cc28, 0x000000726831d98b,
+    0xdac7982cd064d7ef, 0x9beab2e1c54a1d70, 0x2b6ff26c5359d13d, 0x000001622e7afa21,
+    0x18fc7747c65c3025, 0x643f452d113d31ae, 0xe4e1bf1ed72adf32, 0x000001ec464ccfb2,
+    0x7374f22efc1a6ad9, 0xcdb014f94f770941, 0x78cc257d3c1b1bb3, 0x000001929f112fcd,
+    0xc046f99a9c7fe313, 0x283e087d4a48a063, 0xb47041f2aa784e46, 0x0000006885006ab4,
+    0x2cff84a4c2a6eb3f, 0x0259ddeada096979, 0x2b1b5b68f8a7f5bf, 0x000000c391b91e69,
+    0xeeddf6178a65ae4d, 0x5497460a4fcd07b7, 0x33d6ee61905f39a9, 0x000000a63270b6d2,
+    0xb00342f6954e6f65, 0xeb7b77eac0f50740, 0x445a9a43334879da, 0x00000119021580e5,
+    0xa63ca8804a40ec78, 0xd2f35f8457db73ec, 0x794283ab15aebbd3, 0x0000019bb93467a1,
+    0xde33d3d51ec23001, 0x89d2c826fbf5513a, 0xeecd74ce4c092680, 0x000001cdecc68ea6,
+    0xacd8ce54ef2234c1, 0xf4ddd3339015f94b, 0x053ceb5df7496375, 0x000001c058ba3b7d,
+    0x5f8d6503eff9bc43, 0xf2069d1018441f8b, 0xe3cbdcc396cd9c48, 0x0000017900bb1cad,
+    0xe34b74061346e11e, 0x771b722f64f3ffd7, 0xc7257d2214367d2d, 0x000001d1f9d10ba2,
+    0xd8308bfc307c1362, 0x468fa68fb865d620, 0xccce86ef37059617, 0x0000018a40e963e1,
+    0xc1e6bcc6b2cb3439, 0xb3c2a899d6f086ff, 0x3f60f0a1aa069c73, 0x000000f992d29d88,
+    0xcf8f235a5f45b8f3, 0x541a586c08f9c94f, 0x5fad181eacb3cc08, 0x00000091c7c85aaf,
+    0x342f5e3c8249923a, 0x78e74a7a80f653c1, 0x5c25197b5e181df9, 0x000001c97c469a92,
+    0xceeaf8147e517ac6, 0x2c1ccde2a4fc9396, 0x8ddfef764da0725d, 0x000000dc758a6773,
+    0x7f33525c4d3436ab, 0x79afd22a4647adb3, 0x1d8f23b1b3fd4390, 0x0000017fa9a57dd1,
+    0xa2d8dbc520b21da2, 0xf1e4a5bd537820ad, 0x59b1fc312bebdd2a, 0x000000f98772fec5,
+    0xc38955c79b5b68de, 0x6ecc5cf67faedfa0, 0x506ee2885859f16f, 0x000001de6941d2e0,
+    0x13e7beaed2053307, 0x24077df66330422e, 0x1dd3d50f25a801dc, 0x0000001e6a64e676,
+    0x4cbc87fc4d850ebd, 0xe449756865f2772c, 0x48cb0437ed6987b8, 0x000000b9ceb250f6,
+    0x1b0f67d21bbab5a5, 0x7eea7b718cdce061, 0xf9676e5aebe34f9f, 0x000000f6161b362c,
+    0x2ba6189c50e0bae6, 0xba762ed805bee0be, 0x9e7adb5f62565100, 0x000001734c27a4a8,
+    0x11b91712118a7639, 0x0682e3b6fe4d2e3f, 0xd771d8adc9b690fd, 0x000001b28758fd18,
+    0xed2c8223131d7e5a, 0x7f5a0f856e803eae, 0x9e1eafdc7b09ef32, 0x000001bb3dcaf0cf,
+    0xe7b325b017fef26d, 0x12010374ee7422ac, 0xd2e397e85aad9c02, 0x000001cfc0473b83,
+    0x3906ab4beeb35f79, 0xef1c98d32f078375, 0xa00d6fd88c243cd0, 0x000000360066b04d,
+    0x8b3043099843303c, 0x00f38c67b2009ece, 0xda5d30c22c2d148e, 0x0000006f53b49214,
+    0x38c93d39b9fe4e84, 0x482a74a66982c87b, 0x9d9734b50c3349e3, 0x000001cb7e8ed8a2,
+    0x42284f799d2adbf9, 0xfdd0b902720228c5, 0x87e3eb9a42b11ed2, 0x000000d5d1c529ed,
+    0xcbb4f91f469eccab, 0x15f13d1431992548, 0x0dabe341f6ac9a0c, 0x000000e94902b7b9,
+    0xc3a120fb0ef6ddbf, 0x964498711e916279, 0xa6514aaf64a251c2, 0x00000073c1a30d0e,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K233_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K283_WIN_5_XY[] = {
+    0xb0c2ac2458492836, 0x23c1567a16876913, 0x62f188e553cd265f, 0x78ca44883f1a3b81, 0x000000000503213f,
+    0x4e34116177dd2259, 0xe8184698e4596236, 0x07e5426fe87e45c0, 0x0f1c9e318d90f95d, 0x0000000001ccda38,
+    0x5912e280124fe3b5, 0x08aac521391ad36c, 0xfec3377410903214, 0x0a8b1f5146412d51, 0x00000000015dccc3,
+    0xd979d5b4d279f192, 0x5fbafe28898e9213, 0xa98c4c7ac1b42163, 0xd137312952ad97f6, 0x00000000053fc9be,
+    0x9ec2e8f524a2b90d, 0xd02ff0ab92234819, 0xcfc15e85022bad17, 0xc3bd1a1a0f42683a, 0x0000000007879d57,
+    0xb848691abd2d7df8, 0x2ee749aeb9f1b0ac, 0x5653fbb4fc2487e2, 0x30769fb467205fc9, 0x0000000007459506,
+    0x4c72dd4d641474be, 0x15edf4c189b5eb2b, 0x4dfee6eb538535b2, 0x4be2d17e2a4b035b, 0x00000000016316c8,
+    0xf81cefd51fa1096a, 0xa81488b2b177f000, 0x855b4028a3faa8f6, 0xfe3b6b8a8f32928f, 0x0000000002119b23,
+    0xbc4158d78d2ff4a2, 0x42142a1272ac4c4c, 0x8315456d96d0e33a, 0x736c15821ef55e38, 0x00000000018c2e3a,
+    0xafc9ee2836f48398, 0xdc06930e2b8d14d7, 0x1b68b4f66f7bbec3, 0x8d00f0b5a682cd16, 0x0000000003131b75,
+    0x5f1ac1f398203b03, 0x9f0c09416749cc2a, 0x7d5b082d12271846, 0xd923d855677cb0da, 0x0000000004c8ab19,
+    0x83b9044b65a9f8f2, 0xeedc5bfaa8105978, 0x52569f8d2d2b1c7a, 0xad4de2d102ed15b4, 0x00000000079e758d,
+    0x563c2bd1110bb8bf, 0xc0939333b6a4320e, 0x95130f2266e8d5a1, 0x1c7ceb27a034adf6, 0x000000000532ada5,
+    0xbcd048105f37bc32, 0x800dca0b85955c35, 0x54983287b3c40578, 0x963d2bb943f3ce07, 0x0000000001a4addb,
+    0xdcd84e613d99fde1, 0x100045b074b9c346, 0x036c5a03b29a53c3, 0x234db4eaf633a7d4, 0x00000000058eee5d,
+    0xdddb986d5948fcc7, 0x184ecea98eee00b5, 0x95611d4ab17cc141, 0xf5a91831e3940afa, 0x00000000048d3971,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K283_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K283_COMB_5_XY[] = {
+    0xb0c2ac2458492836, 0x23c1567a16876913, 0x62f188e553cd265f, 0x78ca44883f1a3b81, 0x000000000503213f,
+    0x4e34116177dd2259, 0xe8184698e4596236, 0x07e5426fe87e45c0, 0x0f1c9e318d90f95d, 0x0000000001ccda38,
+    0x098ffd5566b64c1a, 0x0eb1931831d54e10, 0x3c5b380d0608bf95, 0x275a93487b72887a, 0x0000000003e24743,
+    0xd1997506e71b69b4, 0x090518288d3afc24, 0xfb7f25efdc5fc96f, 0xb3e37354add1fad8, 0x0000000003e36356,
+    0x8c63671e2baad7b0, 0x58255559b9d94cf5, 0xa65edb4bd6b0f4db, 0x41ecaf6f56f19116, 0x0000000000137e27,
+    0x9041cf8f640af127, 0x43632760dda4d950, 0x8264209e87effc90, 0x3d8815c9fd739f37, 0x0000000005e7838d,
+    0x1fe9612cd2c45779, 0x85eb8edd46fadc2c, 0x87477f880ba94255, 0xddd3d74a3c0db0f0, 0x0000000006519857,
+    0x6b7da6320fbdf46f, 0xc89499c7e031849b, 0xbca8780edc0d92a3, 0x606265a532fa883b, 0x00000000060d8b21,
+    0x4c6a2605cfc45549, 0x1081697a1491a800, 0x56f1cbaac0dd1949, 0x6ece06482ba02b33, 0x0000000004cff278,
+    0x0ba6148e264c0460, 0x6a59e423c92f375b, 0x11f560f32e864977, 0x4481db4b9dcb9d18, 0x000000000046ed1d,
+    0x934dabeeb277ad8c, 0x895fb6f038c7abf1, 0x64fd27b3b302b2b9, 0xc51ca0d04138e575, 0x00000000006b1d96,
+    0x92accb4734c5c059, 0x66c99c342e5c8ced, 0x29578bd2ba39386e, 0xf9b01144fc6eb4cc, 0x0000000001954cf7,
+    0xeeb8202d642f8d2f, 0xc4c09ef32346e047, 0x4fe9dd7c9ba1ef64, 0xafb87811aebc5182, 0x00000000033fe3b2,
+    0x6b1a6678cbe80ded, 0x7505ff7fa3baa61b, 0xc8cb5e10dc9cdc9c, 0x07528cf39d07b049, 0x000000000531da39,
+    0xf552157b286c38d0, 0xd351773819d93cb0, 0x2c7d3fe6dfdba856, 0xa29839fd9e6171b9, 0x00000000049d0e48,
+    0xeb4487596274dab0, 0x146772d692542bf9, 0xe1630bfd3161f674, 0xe471408f464883fc, 0x000000000667a6ad,
+    0xb23d09f7157dc7f0, 0x9376b80a5d4d9a97, 0x1d3e53b4f4a2cd3e, 0xffc18bcedac18f6b, 0x00000000049869cb,
+    0xf8c0299f4ebd3a07, 0x6c0f5d1a4fd4a562, 0xa07a1ba6ada1bdab, 0xad4041c91b48f238, 0x000000000743aa1e,
+    0x1b47213136d19bf8, 0x2f85169105be2272, 0x8e261e36bd478284, 0x410015694d45f6e1, 0x0000000000110c29,
+    0xb19af79ef12f2bec, 0x53e5bbf995f22128, 0x9149fe67c96d5898, 0xab87fdff5a6db4b0, 0x0000000000d89a4d,
+    0x023a07c12a4cb7f2, 0x104fb1f2728a619d, 0x15716a47550bb5b7, 0xb658f813cd8bfb6a, 0x00000000026d0d23,
+    0x547978d833956b41, 0x632fc545ae672b4e, 0x64af912bdf9629d1, 0xa20266c7890d5f63, 0x00000000079d460e,
+    0x53ff0a1af45fa30c, 0x15663a32955fc845, 0xbedf07f4d6e54f93, 0xa890cf748793186a, 0x0000000005401740,
+    0xd156b57d99492a07, 0xe94f72619f9d46c9, 0x1ed4b86fe35ffa80, 0x354f685927a3a9f4, 0x0000000007f76883,
+    0xe1cebccc0c8e27eb, 0x044b3af7df4f445a, 0xe711fe0eb8798c3d, 0xc3950c7975bed94f, 0x0000000001c484c0,
+    0xb8f391f84c770ab0, 0x22d84afcc1ca8811, 0x0dbec33e6972e7ef, 0xf9a2a43f0d7321e7, 0x000000000396a0e4,
+    0x7ce077aa127990ef, 0x18e437fb3b78c3d4, 0x71fdfdde87a4ed95, 0x292d94401e71a254, 0x00000000012694d2,
+    0x8e56d97e8f81ce0e, 0x197ede9d0f474e8f, 0xdde2b27f21266cf2, 0x3a67f2c55e963988, 0x00000000027c74fa,
+    0xf870731dcfb21da7, 0x66d3a7346d505c0d, 0x3272557588714494, 0x8cc668144be099c2, 0x00000000067c9b7f,
+    0xa20a28240700cc37, 0xfa47c39896f9b188, 0x6843dd13394f190f, 0xb052e48f4343ca8b, 0x00000000021fb459,
+    0xe3a19763a1627230, 0x63ae155f77750eb1, 0x4b1d4068e3ff5f88, 0xf642340062816b0c, 0x0000000003cf4d11,
+    0xe1a670c90dc151a3, 0x73ac4de522b17763, 0xa450f337fbe18504, 0x4d3fae04e782bfa9, 0x00000000041fa849,
+    0x5fcf643c1e36d9f4, 0x7928188fcd73796a, 0xab34188ffe7ae3f9, 0x90a404eadb3b45e9, 0x00000000016d77ad,
+    0x11d9560ec49e1c13, 0x50b25800424bac36, 0xfb533752cec205b3, 0x7a366724cc7ab127, 0x0000000003134f3f,
+    0x2467ca19ec673fba, 0x6d7d8606b8345a30, 0xec7f9796dc3a033f, 0x4aab41f4bc74260d, 0x00000000010a269e,
+    0x029688428e20a154, 0x88677202d546587a, 0xb7fd3473dd57a64c, 0x302a0dc7fe94618b, 0x0000000001f66a53,
+    0x300ed16bb10e9df3, 0x56221d38362e3cbc, 0x670b1ec1a0687764, 0xc40b85c0ef7d7055, 0x0000000000549e5d,
+    0x3a6af749355a37d9, 0x36ac1efc32a170a4, 0x15a29ab10c749489, 0xd247d1d3d4744691, 0x0000000004309ba3,
+    0xfc30765353d6ba9e, 0xf37fd90ff34c47fc, 0x3254af24d42186c8, 0x56c995a8ada2aa07, 0x0000000006cf6d6e,
+    0xd8e3a1c80676b29e, 0xe8a7b9e18e0a1be6, 0xa40ec0c6432b663d, 0xea36a769341d4ab1, 0x000000000795ced8,
+    0x48f10d710d721628, 0xdaf5b8af71bfefb1, 0x162346c587a554b8, 0xf47ca62bac4f281c, 0x000000000252341f,
+    0x3a3c3ac61ccfb8c3, 0x6fe99028a6b65a73, 0x5b68c85ebf713b30, 0xa60b89335dbc4923, 0x000000000504e0f1,
+    0x7f3026697f88c7bb, 0xa007aef3f3753a15, 0xb09670a50292c206, 0x693b5fada85da478, 0x00000000040ace5b,
+    0xbdb1b39c8f50d62b, 0xf8c71b52be6b2dc9, 0xd77a63a85b178f1a, 0x55748decbd01a06b, 0x00000000023a4c24,
+    0x7ff8aa1c24341617, 0x6dee833f7557b891, 0xbaac99e00372aef3, 0x92c98e51b881d1ea, 0x000000000374e8d0,
+    0x2752d77c4b685422, 0x84c328ec9bd76f49, 0x4b4048eb628d688f, 0xdcc64f3f005e8356, 0x00000000009bc382,
+    0xb78f6745975a5131, 0xe25a2342ca94cede, 0xb0b858a580361b31, 0xf182e61fa9abf681, 0x00000000036c9ca4,
+    0xcab44f364ab1318c, 0x10ebdf44a3b49519, 0x87ae6c6cb8664056, 0x0a19cb81ee5b69db, 0x0000000005a58d33,
+    0x1786245668bd497c, 0xf6df9ab6de67dc3e, 0x91303522a055e6d7, 0xf1b44534c0c79ead, 0x0000000007396b86,
+    0xd8f4f06c36e33e79, 0x5da8fba54dd84eae, 0xa52aebd12cb88b33, 0x9d32e53de6e834f2, 0x000000000532a5ad,
+    0xc5e39d2e70fa13f4, 0xc783ac3e44f1f5ad, 0x0db466278dd6cc43, 0x0a9c6e68ca52798a, 0x0000000006ed533f,
+    0x44d2acaa0c1090be, 0x9d293088795539bc, 0x4f313c1cbede29ac, 0xb75bd21df8184ba5, 0x0000000002c0c279,
+    0xbc23bb9222fe966a, 0x3691a33ab02c2d96, 0x6c37abf6ec6335f6, 0x7e4625452dd3878d, 0x00000000061b48f9,
+    0xac8697753f5d77ae, 0xe3a626ec45f859b4, 0x8dc2e714418f5cdb, 0x8e4d577bf2ab5542, 0x00000000075b10db,
+    0xbeef0aad43152663, 0x3886b2a08ec50c5a, 0x7234e8bcf4de52da, 0x3627339a73d8682a, 0x0000000000dffae3,
+    0x2f1ad1d5ff573f36, 0x5d07b052846a23de, 0xc5d0db19c3c3a586, 0x0a8905610be95fd9, 0x000000000446088f,
+    0xef8e55ede39b6df3, 0xa2537a0219efc52e, 0x0a8b9e2acaa01178, 0x3fe2660ac7894cc6, 0x000000000185b04f,
+    0x5e89fd6c550ab221, 0x4f9dda3d89dc3993, 0xcb9c2cf5c3ffc1eb, 0x6eaccaf70eda765d, 0x0000000005ffc173,
+    0x6eb9689d354bbf37, 0xf5ef04f79cf38d78, 0x3a6963b8b75a403b, 0xfdf5e5c7ad1104b0, 0x0000000006caf9f2,
+    0x9aa613fb9eee66af, 0xf33c3954c3060c44, 0x3d303fd1756fa2bc, 0x7fd9da831992f621, 0x000000000054f518,
+    0xc4e722afb09ad8b9, 0x78b50e0e5e9b376f, 0x6968f450004dbe48, 0xe2f273b61da2f577, 0x000000000589d44a,
+    0x26ecc64749f7cdbd, 0x3a615e44346a9e5f, 0x4210dd8e758245fa, 0xef25848a8981ed5d, 0x000000000059a8a4,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K283_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K409_WIN_5_XY[] = {
+    0xb35540cfe9023746, 0xb5aaaa62ee222eb1, 0xf9f67cc2c460189e, 0xe307c84c27accfb8, 0x0f7184210efd0987, 0x658f49c1ad3ab189, 0x000000000060f05f,
+    0x5863ec48d8e0286b, 0xe9c55215aa9ca27a, 0xe9ea10e3da5f6c42, 0x918ea427e6325165, 0xbf04299c3460782f, 0x0b7c4e42acba1dac, 0x0000000001e36905,
+    0xc92a2eca614f2fa2, 0xc7decd27453215a5, 0x1eebfbae63aacd6c, 0x27ad22796b099252, 0x259a4973fc82fe6c, 0x3fc75049adc9ac4b, 0x00000000015cdee8,
+    0xd05952a7d4d06d16, 0x1bde3779a5d833a9, 0x976d3b34db7ed365, 0x31a8c8638f96e859, 0xfc9127619d5d1901, 0xe9c9e2eb4cf9d70c, 0x0000000000973314,
+    0xde273f98e0ab18b2, 0x6da151b685cbba54, 0xe7f5ea482a3347d8, 0xd87156646871d5d0, 0xfeda37a92ec82523, 0x8d081b0855a5ec01, 0x0000000000147f22,
+    0xa00b8fd3b6a4103a, 0x8c6d11e7d49160bb, 0x0c2d3f1eed954f61, 0xe51d5f23a8e01db0, 0x60c311e3e8530509, 0x1c8d15eadccc1ecb, 0x0000000000240f7a,
+    0x8950559385c18ca0, 0x2a7f47775f5af3f3, 0x40e8273d28659783, 0x56fb0744691a0e9c, 0x1248c312c1088714, 0x845ab818f713128a, 0x0000000000561576,
+    0x987826a8d4e54a9f, 0x9a0284175040e612, 0x449fc5eda7edea99, 0xef12a20a6506dc7a, 0x47fd4ec31809d501, 0x3ebce20f99faedb1, 0x0000000001c9491c,
+    0x19a829d91f4480b0, 0xe71df6e39f0c40c3, 0xa3a88580661413cd, 0xa268d5369787dcab, 0x7e4d6d7ae1bf0729, 0xb2908d856092a635, 0x0000000001d0a22c,
+    0x6b7eb4cea1fd410b, 0x3c5aeb9530bbdd3b, 0x854c4b6122ea5147, 0x48e44b8ead2899fd, 0xcf46a1081ce75213, 0xa658750557e9b733, 0x0000000000f9dede,
+    0x34cf47aea5f44502, 0xe8d9b4b1fdf20b09, 0xe264d2ee7aa174c3, 0xfeca2052a5eb78d6, 0xb5d3515b42d06c17, 0xc3c6773a595494c0, 0x00000000013d94c9,
+    0x2e33e2adff3e0ad7, 0xf757a02cebce2593, 0xe7dfd6ad39346b2c, 0x646fb3bb801e6426, 0x99881355478d676b, 0x3e92195036932f37, 0x000000000000eab6,
+    0xbb181951fcb0294c, 0x8b23cdbf3208f8e9, 0x28816e6bdcf02d69, 0x92aac1be6ad81a06, 0x975578373da53c97, 0xa232dcec4e512bba, 0x000000000079b538,
+    0xc0c2e68899605301, 0x185772377418f046, 0xe4cd38e4f6c9a8fd, 0xcf3a003db233b97c, 0xd63f874d472ef379, 0x55808eb579577072, 0x000000000063db56,
+    0x856e5c332897a716, 0x93b3f1bb819408ac, 0x35cfb9356c4333d4, 0x974beb4183528ccc, 0x9ed167712dcc9222, 0x3c4d2a8741fec5c1, 0x0000000000a37177,
+    0x215809778c1ac0dc, 0x02ab0303f7159afa, 0xdc12b5025d0962a4, 0x3efa58864c081a48, 0x7201bb3c0213b112, 0x7d9004544f45d008, 0x0000000001e26c43,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K409_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K409_COMB_5_XY[] = {
+    0xb35540cfe9023746, 0xb5aaaa62ee222eb1, 0xf9f67cc2c460189e, 0xe307c84c27accfb8, 0x0f7184210efd0987, 0x658f49c1ad3ab189, 0x000000000060f05f,
+    0x5863ec48d8e0286b, 0xe9c55215aa9ca27a, 0xe9ea10e3da5f6c42, 0x918ea427e6325165, 0xbf04299c3460782f, 0x0b7c4e42acba1dac, 0x0000000001e36905,
+    0x774d39864e715b4c, 0x5e043efd0e9cddf8, 0xfaa00ec7c3464718, 0xdad6dba35d0790f1, 0xe199fdc6ccda2562, 0x92e789ba8dddbaaf, 0x000000000065e0d2,
+    0x32c5f25754f68233, 0x547ea1e1242ffb26, 0xf1ff68ac712e1bd3, 0xfcd3b4ee03e4e4f2, 0x07effe802d1fc0bb, 0x7bca7e87cfac305c, 0x0000000001711f54,
+    0x4c0f218df738592a, 0x2ff88f889544fe9b, 0xce3eec2c75d8939a, 0x96c87968e7c68f8e, 0x77b45f0cf92b1b79, 0x55b61c65bc1dab90, 0x0000000000d8e785,
+    0xe7f7790e2398a4d8, 0x0ec59bafed0f8bae, 0x56edeebc23c3cbf2, 0x7af21492dc3d7430, 0x72b0b5119009b760, 0x98631dca244fdfa0, 0x00000000014a23a3,
+    0x5191167c6eb4ddc8, 0xc3b2b20531d0c5e6, 0xb4f2d32cf50af948, 0x1d70f5d26400dcbd, 0x44ea7bf2475a1c04, 0x4c1a23b12ef62b73, 0x0000000001d7cb58,
+    0xecd155db026093ba, 0xd6caa9bf88931132, 0x79cf11dad941a783, 0x8a3e58e8baa82a14, 0xd2e2dc1558bd6cb6, 0x8d6a50b0b12981ed, 0x0000000000bdcbce,
+    0x2213b4377f00a6b0, 0x79bf7759785c1ea5, 0xb5921224fe74edaa, 0x4c9405c474e6a487, 0x50170c690ef09f61, 0x3b530c01b10894e2, 0x0000000000bd9f4f,
+    0x4cffb3caafb81007, 0xb126bd18e608d99e, 0x5d179d4d72c77f29, 0x2b0a7f09225fa2f9, 0x23ca84ff8eb1f705, 0xcb20678a4d405032, 0x0000000001ab87af,
+    0xae5b711575a6f2de, 0x3d1f96303333c231, 0x954d866f9ed0156f, 0x9916f95d8d72c158, 0x3838894a7f220cc0, 0xd56850266e8d712a, 0x00000000015356bf,
+    0xad19148992e29b78, 0x9c9d65dd3067ef99, 0x551ae74e5c968f9d, 0x33a9aa348ea98904, 0x3bd748f5ceb42d67, 0x17af11cad1d0702a, 0x0000000000fde59a,
+    0xafbfb762ffbddcea, 0x4946d50c8809c432, 0x9bc9bb97f2fa2195, 0x8ac5baae7d324c20, 0xfa1ad90de9cd47db, 0xc6657387d7822ff2, 0x0000000000d904bc,
+    0xb0c87a031ab28387, 0x547dc379d44c0858, 0xf9959e072a5f9de0, 0xb032ed245f5caee2, 0x94f2e9169b6f1a79, 0x7275c06e457a3239, 0x00000000007acf3e,
+    0xff0b78fb828d68d6, 0x3b1e5416db4c8a00, 0x5ec8903da920eb0e, 0x9444d23725849ff8, 0x8b92e912879d2316, 0x1b6267b396f77589, 0x0000000000e7bdfc,
+    0xa1bed8aeb67e7fd7, 0xe4c0fc4f98796f8a, 0x219d55fd111ca52a, 0x2cf0f65e8f215237, 0xc10e0bb23d9e41b7, 0xe6870f7cb43360ff, 0x00000000000621ff,
+    0xa3531b94c1d20f8c, 0xe6fd4fc36d7d628d, 0x437b331174307ce5, 0x06f2850289d89b96, 0x250885ea68c363b3, 0x725958f6834336f5, 0x0000000000fffa00,
+    0xfc2b05b017c57848, 0x5dcb346a1d7c97d6, 0xdc14eecf94370db3, 0x8cfd727dd8972487, 0xb06a22d07d96f58f, 0x6da6623d733852cc, 0x00000000017cea20,
+    0xb288c061ee5ba7ec, 0x891753309b774952, 0xccba4d504fd0576d, 0x2e406c8c493c1b43, 0x8af0345563d135c0, 0x6daaea30398b2e04, 0x000000000091318c,
+    0xae6b3de049df7aaf, 0x66607a8b95392223, 0xa8694fcb383c2c42, 0xaac1c2b061c1b0e8, 0x478900cae71a18af, 0x201263b5f83078c9, 0x0000000001e30371,
+    0xf8a1c3fa09956750, 0x52c9c6faf85d327a, 0x52c865d9fc04258a, 0xa1b1854e3bf5d7d8, 0x0e8c2a2e6d452ce3, 0x7fbd9aad5a4ba0b6, 0x000000000182551d,
+    0x1689d582962d636c, 0x74f31b24ff2b9e27, 0x1055c8734d948b21, 0x8bb4ca2fa6d49189, 0xb5777891337287c7, 0xcd7c1bfaf47641ea, 0x000000000079f3fe,
+    0x643097e228f9732a, 0x27f2d95e11cc3b2a, 0xcbe0f07089ae11d1, 0xd7b729ecd56e8b7c, 0x82203e178feb190c, 0xdbc9b6d7d248fadc, 0x00000000013814e8,
+    0x85a81756ecb78f46, 0xf9b2eb32e393228c, 0x11f8c8b6b6408714, 0x9b6f9dbdf52eacd3, 0xde39b2a7e4b6bfaf, 0xed2cdfab1d509296, 0x0000000001478f73,
+    0xa996ec07459bb5a4, 0x11a23151bc89290c, 0x588ccadb42b70dc6, 0xf72bd60767cccf62, 0xd2fb484842cf2a84, 0x46a80734c101fec1, 0x000000000077bca8,
+    0x3faf1b145ee91891, 0xa96d5f46a999750c, 0xf27756ef4e4e2efa, 0xe12b81764ce463d9, 0x35347746ac453820, 0x4e159d28965c0e9a, 0x0000000001b6b22c,
+    0x8265ac2f9d05ad0a, 0xa78c0b129c95c8a3, 0xcaa11ed4df4f3a99, 0xdc91146a19831c54, 0xf7e77f20bd0eb90a, 0x0cfc37dfe2695657, 0x00000000000c3306,
+    0x26ee28d99f6bc4c3, 0x97278b36bb647818, 0x61671dd61581a727, 0x04d8187e241cf170, 0xe58bdce06f4cd32a, 0x15cb280cdba1b3d0, 0x0000000001a38b62,
+    0xc7d449836c991c44, 0x4f5c388caf7539cc, 0xfec786fae4202593, 0xffdfbb674b50b8f7, 0xb8d837ba84c28c0c, 0x528437b42bcac4ac, 0x0000000000a4c1c7,
+    0xfa2ee2f36dbfa5ee, 0xe733aa762bc85298, 0x4f2fe0934ba8ccc9, 0xb3d074b8176fa062, 0x0e1311745cedf706, 0x013dd7001ad5eace, 0x0000000000562c20,
+    0xf7252fbc32dece4c, 0x1cd434556acb4d01, 0x25c4f40229ab1506, 0x0b8e7f4ba305fd84, 0xe5bd71a807df32d8, 0x55f41aa96396ad82, 0x000000000035275b,
+    0x517ba490773d2e5e, 0x340f52d58af73225, 0x5f5df52374ba0403, 0x4a18edfb8efcb90f, 0xe218cbe535ebac39, 0xec7c2664e8158451, 0x00000000003199e2,
+    0x14d18c06c262fcdc, 0xdfbd1a623f7b6e43, 0x050f29340b79da47, 0x4cc80f1a8c7619de, 0xd0c7a97a27727c19, 0x31d572ad40cb0409, 0x0000000000255353,
+    0xa9012ebfd70ae844, 0xcdcbf59423bcc3a6, 0x5f2fa0ffa0681cd7, 0x28386577b4de9ec9, 0xeb61f1dd28692b05, 0xf623c6218ff0e1c2, 0x0000000001d885e7,
+    0x33bc0bbb49039d88, 0x2f2abb89ba22af8f, 0xeb27a3285c2cb59c, 0x862f74f27afecaaf, 0x82cfb40e7c4a533c, 0x8babc67d34326ab8, 0x0000000001eafeba,
+    0xe620fb2c3f847c36, 0xe1fad34745c865a7, 0x3bb739f5ab877eb8, 0x727097caedb1b736, 0xaf5f717f0cb65136, 0x69057002a818ecec, 0x0000000000d915e8,
+    0xef22ba23bacc7bb8, 0x4aa83a6d38d4c39e, 0x3706b2ead2f07c43, 0xfbf049a261fb71a5, 0xfb6e337e92e7025b, 0x4b654fc3d0c15388, 0x0000000001df60c2,
+    0x568ee4ea29bb8384, 0xe33d1c574ab5c633, 0x75dffd66721315b0, 0xdfebf4c52b8854ec, 0x95dc3dc337c7d9cc, 0x27dfd2abc419a3bb, 0x000000000105502e,
+    0xb8adcc8dd146cfd8, 0x8f8ce06d7bb881d2, 0x516a87333f4a4e4b, 0x19c955655e1d8685, 0xd9b3f2ac9ee0c75d, 0x6e961a1ebb471024, 0x00000000012ce5fd,
+    0x3913c747cac61556, 0x688555c8aafd347a, 0x65bb23d72528399d, 0x7e878265f012b6c0, 0x7a244f1185891829, 0x2a3097d4c27a83f0, 0x00000000015af320,
+    0xf96795b670124d8a, 0x46ebee936dc6c659, 0x7fc93043533f93d6, 0xc460618df625bf63, 0x04102a30aaa3aa04, 0x515255b9d376d177, 0x000000000087ddbb,
+    0x93aab7f72521fdc8, 0xf3b6cccf94befd37, 0xa8b87328dbb0968c, 0xd2aa772790ca2da4, 0xe05589b77d7bbe7a, 0x9cbab8dc89454cd0, 0x0000000001d417a3,
+    0xaf4078313bdf0c32, 0x7c9d7ddee3b949ec, 0x737591c49b559016, 0xeece2fd8712c2b2b, 0x69474ae5f06bc393, 0x7dce3ec90e82d88e, 0x00000000009f4302,
+    0xef79817b0c9fc13b, 0xad943791a4c03b86, 0xae612ccee669ce25, 0x72da3be2bb6a86c3, 0x93aed3706ba8abde, 0x5df0b8098c642530, 0x00000000019a2c13,
+    0x31238df10b4784f2, 0x5a3280b26bdf09f3, 0x85bc0f7556882d80, 0x3ad9837dafa26e19, 0x94618a1ef961241a, 0x42538e9cd8576ed5, 0x00000000014d1984,
+    0xeea5f7e250aa947b, 0xa3f5c8956f525062, 0x496dd8005ea6644a, 0x52aebdab110cff55, 0xbd8be5a77e7426e7, 0xa25e9fa6e65952ae, 0x0000000001c1bf7c,
+    0xb963debdee33d9ba, 0x2c742c1e1035c74c, 0x6434221c6da65044, 0xdb25956af12c730d, 0x50b585b9564ca873, 0x64eab7dcfc7e248b, 0x000000000063b305,
+    0x2f3ad49ddcd8dff0, 0x04c21f19bba32011, 0x610eb8fdee153049, 0x4f6eb74cd115978c, 0x5dab3aa11c7df6e0, 0x4c0ada855749471a, 0x0000000000e73cb3,
+    0xf6c8465e00f7e5ee, 0x1a9b2da81845feb7, 0xdc3d3f51dccf4171, 0xb670a0111b09f87f, 0xb317c5fb0efdf310, 0xa37ca3f25f70ad1e, 0x0000000000c802cb,
+    0xf2d9ba9e44a560a9, 0x586d9909ff286d9a, 0x1b6fbd0a0aa7ae3c, 0x7275cb7f082d13e9, 0x988d94456b7148a2, 0xb74f09ed986380e5, 0x00000000000e164d,
+    0x3f90a90c628809ea, 0x5a6e9ac2b4b8457b, 0xb93626d58f99f834, 0xb1fb6e33e474975e, 0xfe2208f65e87d71c, 0x8db1864423fcd601, 0x0000000000ae9e3f,
+    0x305d85cc25ba188c, 0x5ea56894fdc7d690, 0x1f916ce54cba234a, 0x6f73e6c93e572dc1, 0xb8943aa8bdc485eb, 0x3847be06f7a2cc40, 0x0000000001710a47,
+    0xec67f0e98223038e, 0x5dc4c52b8ba194b4, 0x7a57c45e59f34e79, 0xffe9c4f88ad264eb, 0x6dd48889a975fdb5, 0x2ff9e2376885f182, 0x0000000000311210,
+    0xd9960ed044f245d0, 0xc6065463b786855c, 0x7cd9cc9475d3c2b0, 0xd8cbf1698a3bf2ba, 0x6d1fa7287b540d23, 0x42385d18e12e2dfe, 0x000000000011c98e,
+    0xab7a600b3dc150b8, 0xd9c006ae5fe8d934, 0x23193bd2ef46d0b8, 0x40852d097213907e, 0x589ccfcddd87820b, 0x93393c6deca91466, 0x0000000001ae6ebd,
+    0xe5b624134bf9ef91, 0x3591950a01d0b64b, 0x3019364500a04c32, 0x0348d3cab7fa998e, 0xf3faf36b7c979c38, 0xd56de4d4373b14d6, 0x000000000124a224,
+    0xb8dc41077c5e76c2, 0xb8f6b8043525ebf2, 0x1e45aa338f9def93, 0xa163633cbcf35dfd, 0x2caada3f6cae8ca5, 0x170df75aa14d6989, 0x00000000000a17e7,
+    0x1a3cb2b4a120c557, 0xdf1ddab3353de871, 0x4b12fbcc9ed2d0b4, 0x9feae646b77a20f8, 0x8bf1fdfa40524a5e, 0x6d958caa054d889d, 0x0000000001d9bff4,
+    0xb48e618e5ae0642e, 0x131bd8a68641c8f3, 0xee224c28092ab722, 0xc1766c9f2af29251, 0xf3731b14f005d1b4, 0x7467525151ffcd33, 0x0000000000ebe1a7,
+    0x331092ccbb675002, 0x1fa4973e752f2e58, 0x213bafa8ee6ad935, 0x4cbb16afd320b724, 0x98612e9f32287d80, 0x3f74a25c48486fe3, 0x0000000000ef37e9,
+    0x17dbf3e2d40a3c92, 0xf1ae4fdae06d834d, 0x1288c4c3546e9bc3, 0xc85bd6a3db0e0aa7, 0xc8a73f4cc27a1534, 0x2d1df1beae349263, 0x0000000001627b49,
+    0x64ed6d5c57a9126e, 0x039f0b26708c1b80, 0xc20aba2ef39469f7, 0x9e880e516ed00d07, 0xe9a74932ad7bcf44, 0x26fd4a682c48857b, 0x0000000000392522,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K409_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K571_WIN_5_XY[] = {
+    0xe2945283a01c8972, 0x988b47174dca88c7, 0xbbd1ba39494776fb, 0x47da304db4ceb08c, 0x4370958493b205e6, 0x6024804801841ca4, 0xac9ca2970012d5d4, 0x82189631f8103fe4, 0x026eb7a859923fbc,
+    0x01cd4c143ef1c7a3, 0x320430c8591984f6, 0xb620b01a7ba7af1b, 0x4fbebbb9f772aedc, 0x9d4979c0ac44aea7, 0xffc61efc006d8a2c, 0x4dd58cec9f307a54, 0x4f4aeade3bca9531, 0x0349dc807f4fbf37,
+    0x50ad4a749a68199a, 0x809d10bbfd4e0166, 0x48970333c3906a61, 0xe2111cd8a1283edf, 0xb8be7b6130bfcd60, 0x1084c563d37c6536, 0xc8a05a351d2b7067, 0xccb56f10afea9090, 0x0287b0ccbb649860,
+    0x0f31d6ce787cbd41, 0x1629fd7916809413, 0xe4224614eba64f2f, 0x9710cccee24286c3, 0x2c0b43f4a2c9d2f2, 0x007e2da3045ac8ab, 0x2b3cc9ce59ef83f0, 0x8ff3f8f5689aeacd, 0x02264fc0cb1b8396,
+    0xc4c0c9bf2b03f581, 0x804b5081cc5f4b47, 0xa83f15ae6a61dd7e, 0x02299f5aaf99df5e, 0x90c372f624913bf3, 0x484bef21fc4d8cc6, 0xf77cd429ac196e3e, 0x51c400f4cfd93e17, 0x02541a1c26f233f7,
+    0x0508889d4983ec59, 0x77ffb9ea5e2cc597, 0x14080bc2d0aa0604, 0xd90a4b9b7d5bf7d5, 0x82f7d2bf54e7bc50, 0xae0c497a09aa702c, 0x2ffb3ec40daa4378, 0xf683e0b7df6657d7, 0x04f83758585f9d7f,
+    0x9bf415772f9325ab, 0xaf2ccfea125b488c, 0x42f75f4b1cf1fec0, 0xb2a4283a7e7c5741, 0x2cf648b6d6b3bee9, 0x4010489c7c6e368e, 0x3ab9f7494ee9c9d1, 0x2d0272b3ad51cb99, 0x025cbb972b6dca6f,
+    0x8b89b11e04320fd1, 0xcdeb97004001d19a, 0xcf455fa7fdce9ad7, 0x9637e55354550992, 0x93b6aefaabf25a33, 0xdf20b976c6ecf2c7, 0xa05a519c0f51409b, 0x60ecee4d501d0e5b, 0x05755e3f910a7ae0,
+    0xbc9c6148575d66b7, 0xe0aac637a12469fe, 0x725c6be620d15ed9, 0x614b9f3a50c88372, 0xadc9458cfc68dbe1, 0xab89e7894520b06f, 0x6cd8c8201cf04aee, 0x4e1cbbc69250ebb2, 0x00ee7006d88130d1,
+    0xfaef54e5b759234c, 0x2ccc971024253d5a, 0xff190938440d9d5b, 0x61d60dd5a5de4dd2, 0x6750f5637bc4f66c, 0x869ce7860788f87e, 0x425c336da09e70b8, 0xe18c8f9c902b48d1, 0x0644696f86562048,
+    0xffdd3c1929ef58a8, 0x572063ce7110f2be, 0x72ee242da16b9eb6, 0x8025a3a79e90c743, 0x6cbe7f953c8bcf89, 0xbdab8593137ca9ce, 0x3147fbcaddde8443, 0x21580d00be9a194d, 0x067be688698d0117,
+    0x37a2c49390693ba5, 0x0fafe0ab754a3450, 0x32d730b0675e515d, 0x8312857eda456efe, 0x283d5b8e5497c728, 0xa4126f16dd3ab4a5, 0xc04ff0fd7fa683f5, 0x155c604f4335ce77, 0x05be5f3029adea31,
+    0xd4f2780a2039d42d, 0x574293a8caf96122, 0x624280b58a20d070, 0xd4a9c11446759b4c, 0xea16c00e47f5ee61, 0x60aae6209a3011a0, 0xdc5fcdaf0364b00d, 0x9f712774fb257158, 0x01a3c1f431d85475,
+    0xc05ade4ecc56410a, 0x611cd9cfdc1244b5, 0xf26adfbccc4d9255, 0xe8d0b1b9fe179c4c, 0x3562511d0c55a5f5, 0x37a8ae8c16815e42, 0x0abf204f4c8ff57a, 0xb14bb79384e79503, 0x003a7d03e8d80c59,
+    0x40b8a8775ec4a811, 0x209d378f4b536694, 0x1cb75024787a9697, 0x9706a80e58e6458a, 0x04902f5cecafb1da, 0xf7ab020e9a543f64, 0x9fde3fc231dec8eb, 0xd95b2a4a839dd09c, 0x000f29804fb396bb,
+    0x7c864422175bb9af, 0xb5ff51b74d031fe3, 0x4303c3a005298560, 0x06bcf5ca1b0b8422, 0xe1a3d772d1003af2, 0x106ebbc26dc5555a, 0x0d07511b3d5f81c0, 0xe3d3c888ebe6c509, 0x0675d6b5d5e408fa,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K571_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K571_COMB_5_XY[] = {
+    0xe2945283a01c8972, 0x988b47174dca88c7, 0xbbd1ba39494776fb, 0x47da304db4ceb08c, 0x4370958493b205e6, 0x6024804801841ca4, 0xac9ca2970012d5d4, 0x82189631f8103fe4, 0x026eb7a859923fbc,
+    0x01cd4c143ef1c7a3, 0x320430c8591984f6, 0xb620b01a7ba7af1b, 0x4fbebbb9f772aedc, 0x9d4979c0ac44aea7, 0xffc61efc006d8a2c, 0x4dd58cec9f307a54, 0x4f4aeade3bca9531, 0x0349dc807f4fbf37,
+    0x124e346dc0ed9392, 0xa75fd61addfd4b36, 0x8e3ea07e4a988cc3, 0x1e739ba9e4cc40ed, 0x1d50ea47c6bce5a0, 0xb1aaf09d605906f6, 0xb944427946c8aa33, 0xcbd630bf76e536d4, 0x050ce524e48e4d2d,
+    0x5250923a06bf79b7, 0x0ba5540ee4eda658, 0x0fe13c9421eb7acc, 0x4d44bcc271673e7f, 0x91e8ea55a0c3b143, 0xd2e05792ecb398c5, 0x57a3c2a003c4941e, 0x9bbe8a423fd65915, 0x0106fa3e1219c135,
+    0x169962c9900d28c1, 0x3829cce1dd7538d1, 0x61a10d41daaee1ae, 0x95ccad68eccb2cc0, 0x5314facc8047806d, 0x1f7f4f73a8221457, 0xb9835601ba6de8c7, 0x1c18707e615a3d24, 0x03c51ff508f7461b,
+    0x5b858e39515cbbec, 0x06b05b9132c8be80, 0xad81794a53efbea6, 0x95c1b4bf3f265ed7, 0x2e7c3dee4a7d21c9, 0xee792145a42fad1c, 0x5965b2e7c7fb1429, 0x8c2dd8900a49198d, 0x00ac211f31675431,
+    0x39e546faa04e43d6, 0xaddc776a1dc6e213, 0x13d67cf12b925e09, 0x1fd394269e283e2a, 0x861a68fdeb133734, 0x45f7ca64891e4b23, 0xdbe53fc930202c4d, 0x99cbd5e3c94d1dbc, 0x077ae15cab857b12,
+    0x4e4589cc4f2d7dc2, 0x6302bb7ce7c30b8e, 0x5d9b9afef1afe41d, 0xa8c2151e5a7b6bf7, 0x8e3b5ad4266563a1, 0xfba3bb00ca97b296, 0xcc9e3a7055f91422, 0x19eea205a3e3ec6b, 0x03240628d3efd3a8,
+    0xd197ce76e1564f19, 0x4d421f94e3dd1f26, 0x3bebb012843dacf5, 0x7bca3ce3bef7683c, 0x3ac57325b2545b1b, 0x6da5eab145daba50, 0x2b32c809bdc71311, 0x3fa3cb7000036138, 0x07bc268288cff987,
+    0xb5dabdaeb980c332, 0x7bdddf43b78b7773, 0x70f0d126e3e362bf, 0x0a803efc78a591e0, 0x07e4ea8f24f9a137, 0x0452d6d2d892ee1f, 0x3c8797b27b4724ba, 0xafbadc25e40981b4, 0x004bd8f3f4327da6,
+    0x442709586de1849c, 0x77761b96f5ca8cfc, 0xab6ff15db0082a71, 0x4a4b02fc38ff85d2, 0x220f32ed8d712155, 0x9928b68e03765137, 0xc777f484493eec26, 0xa210c4a2950a89fb, 0x06db805287d5ba61,
+    0xd73d7a8665a73e14, 0x682cefa7fa3fb048, 0x6eb1806031eb0c43, 0xabd6172d45c7a68b, 0x327e822c51680ddd, 0x05715f35315340ed, 0xd1559b9fce616d59, 0x1170776676a052e9, 0x05634aae59224786,
+    0x82c8f4a89a75def5, 0xa38011f39ff305c3, 0x4e45b34a4787bc57, 0xeb61fc99805e1ead, 0x4c6c8c7ac31b89ac, 0x4f3ca696bc767e28, 0x2919506ead0269d1, 0x3d912546822b7714, 0x067c517631695380,
+    0x9f18c57535246b5e, 0x214cfe7ad4c68588, 0xa07142e8623146a7, 0x862538d097e5ae7b, 0xe90e8c763f807af8, 0xb89ccacc08f7b761, 0x1712a53c9efabe3f, 0x59907b9b3555ad91, 0x046d071d654e04d5,
+    0x6a527af6e1de9dfd, 0xe98aaea5c829e7b8, 0xb94b01ad32b39a44, 0x3de95e524b507c76, 0xfec20f5a6e413a75, 0xe4066e692f497dc8, 0x3f3b0f8c97a2f9ac, 0xe91412c8be0241a7, 0x0349dd578e80aa3a,
+    0x1f80a26336acf4b3, 0x1dceb7e78a3b4bd4, 0x5a60023d76738cfd, 0x4fc9863b5cb9dc34, 0x5803eb629bcb93f6, 0xf43557b3e0b3c87e, 0xf8d7912b76807d95, 0x43e4fca0f93eae1f, 0x027827c39499c685,
+    0x63ffd620648ccab3, 0xeca60e5e4b8c795c, 0x5693b5b99d288022, 0x9c1bc4f1594bae10, 0x89d11592ba7720cf, 0xcb060e4e3a6d6f72, 0x6b777fb4a67df27b, 0x6e51a98c19cad2ce, 0x051aeed258dd0e03,
+    0x79d2c1d7c11f1cdb, 0x30f9cf73784d8640, 0xc3ffb8bbff5eca74, 0x9b4bd0b99a117c22, 0x83d3fc04a2051f82, 0x76330f575dad4929, 0xe2c72f47470ae8d0, 0xe4c05f76c9b7408d, 0x04320a796022de40,
+    0x383b97438e60ea77, 0x34cf42646a136977, 0x1e18ff3c870142e4, 0xd29d745b20c83dde, 0x110e43d4300df3c2, 0xbe4cfe1a9fa676f4, 0x54edbdf460212a3c, 0xffb75915b1ca7bb7, 0x028d8020b75a9851,
+    0x4aa76b29c4999344, 0x67801453ea779723, 0x94b0835284c5ed51, 0x90474d7d2359cb26, 0x814c5b603b2814fe, 0xd6ac9143bd09e1c8, 0xc6f01d2d27135672, 0x0e3bbfce0fbe9cae, 0x0117903382767301,
+    0xc414044734a560a5, 0x486c88b8b3b4604e, 0x9727228550e97176, 0xd94e63f7b83c8202, 0x02adbc12bc2b368b, 0x9aab447566a9e8ca, 0x82c41cb519c51604, 0xa5ffc8ea74f554e5, 0x01736337ae8dd491,
+    0x9751a8c58f4269b7, 0xe667979025e1d37d, 0x01d68cf08c81a69e, 0xef4f8db6a2621375, 0x1d5f6fd8f1e9943a, 0xdc7185ccd79defc9, 0xb5ac6e69e0e7db12, 0x6382d424f23e27b2, 0x07d016edb294d02e,
+    0xf4eda2566d3d146b, 0x957c49f5547c31be, 0x622a23b1d73e2130, 0xae74fae5405547dd, 0xae7f1fbe7644016c, 0x4f6449bbe8d72908, 0xbbc3449ad14abe8c, 0x5f7611bd8d45cc43, 0x02357b7035ca0f55,
+    0x24b23ab97637c5c5, 0x0c080fab8ff8da14, 0x4fbce85ee327292f, 0xf92d7a86f2add8a8, 0x754466fcd8914280, 0xa2c4c860d883c8dc, 0x204a458f977d2e7a, 0x07ebead62cdd9cee, 0x016dff1d11617f86,
+    0x6e7b94a37e3c8e34, 0x022b73924e198f94, 0x349e2cfa6401e038, 0x89f6bfd2dfa0cae4, 0xe3d9aeefaf042583, 0x317c5f3799466e87, 0x710bdf0c840b2503, 0xb4fb13662d37bf89, 0x03526268e321e7db,
+    0x4d1533437f4de9e4, 0xfc51e4ccddb62241, 0x68c7a88a193e3540, 0xbfaabd9d212b429f, 0x1f581fa2bbfb3c95, 0x5c379dc38cd00847, 0xd70b2de5a7f373cd, 0x33396008a759009d, 0x003891b026245544,
+    0x95ae1c52af76faf2, 0x36d09115076eadab, 0xb95024f721e72788, 0x2a1b540242bad793, 0xe76b98195e35d10e, 0xb4558bfb862bfc41, 0x2b12d14ba6c32d7d, 0xcae2dfa9adda81f2, 0x06b3cb1db98c4f12,
+    0x0ab4133b5b72fac4, 0xdb7d8d4144a3707d, 0x3b3841146ec85c59, 0x4f83c6a25b1d59ca, 0xd06c657b0c9acfc7, 0x93a8ba7ca12a6274, 0xcca0029837f0b6ff, 0x38a5bd37156e76b8, 0x02b8bf5aa4c2ec4a,
+    0x98de24bf4db4cdb1, 0x291bd97efba0e285, 0x9ab8d65f3169d8e8, 0xd8f4d359c202aceb, 0xb196fb643a80816a, 0xb8a99109728f8412, 0xcc0c090277dc7262, 0xc4759f91e8f33cd7, 0x048af2c14fbdd048,
+    0x3ed244c82f0dd428, 0x37aadf782dbc1439, 0x370bc60cdfbfb386, 0x9fb8daeabb1dede3, 0x7105381547f5fd0a, 0xa4fdac1474b323a5, 0xb12f7ff3467b03bd, 0x30463733f1f72017, 0x02b2ab3bd91316b3,
+    0x9c4b9acd96acf949, 0x4d215fa24a3d4c24, 0x4ae10c0c2de24ce2, 0x7c3a378fbb43983c, 0x0645ab5396386c51, 0x403162dca8ab0729, 0xaf3b660a62285465, 0xa96640ae7a6260b1, 0x02dcd38d8e2088e7,
+    0xbe9a700e56b1e596, 0x06d7f511428b6d12, 0xd37253df26efb9b6, 0x471a2785cdb70d7f, 0x8ab4b7b61746734c, 0xcdcf57a76bb19578, 0x8a983b1b222d7b3a, 0xc961790d9489cf5e, 0x07695ab6587ff291,
+    0x61c811815bcdd970, 0x296ad2edf12db98d, 0x85c887686c59a9a8, 0xeb25d16958b075b8, 0x3c17d5faaac7733d, 0x5d9cd0d5a98ca8f5, 0x220e8651f3ffbe6f, 0xd0860f4a15ac52ef, 0x0471c3e6ece4191e,
+    0xe1e9a354a4fedbef, 0x2409d587f41bfc3e, 0x415a4babafab7e13, 0xf6b1b61115c49b61, 0xc18bc527f956ba20, 0x3775a83f72e1c01d, 0xea25f4bb2d305cc2, 0xbe7a79ca3cdb54c7, 0x028bb26b36b48e7f,
+    0x6c3e8be463482a80, 0x3bbe720f7dfeb860, 0x36319a1c70b017cc, 0xe33155b3ffa24d82, 0xe177918487214dc6, 0xbfad66377fff9747, 0x5ca432e409a74d71, 0x8f8d62735e423b3d, 0x03ba89fdfc48666e,
+    0xd4de3745a77581bd, 0x54e38b67796665d5, 0x6abe53bd8147850e, 0x67476df6922cd963, 0x846c91177b2bc407, 0x0826e499f247f9fc, 0xc678fd491bb77add, 0x5d273bc753ee0308, 0x03ab15cbdda45efe,
+    0x5c8b019c8377932e, 0x93410b20caaf102a, 0xb2d2f2095426f30c, 0x4709a74f2ac7466e, 0xf4a2ff043adc226d, 0x702224ac82c044bc, 0xba455ac7aec68f23, 0x6fe3effe1ae30a8c, 0x0014fdf77862e4f9,
+    0x849d6d08227b40ab, 0xf39688020aa3c352, 0x6c4f03abd1fb42cf, 0x37c8ef1224d0c689, 0x954850f7f2f986a7, 0xf857b7d71ac36132, 0xb790cc132603b4e7, 0xbff72a5d2f34040d, 0x009eca16f9124d3a,
+    0x98dfc496fdadffc6, 0xf014e56824afa0e6, 0xd34a1c2346e2e77d, 0x2a8ee189f5f0bc0a, 0x67d9d164bea1b79b, 0xb777dbacf203450e, 0xb8772a8d60980ab1, 0x53afabfdf00a2538, 0x0019142943f4b19a,
+    0x74a86f60a2093be4, 0xded50c5b8c5b139e, 0x01a704b32a443d33, 0xe6644e01d83f3f1d, 0x4cbf89ae2d84ac30, 0x522ccda7eb249801, 0x8c706bb6eb2fcfa3, 0xa6d3f25ca5c43208, 0x018b354168ee512c,
+    0xde8394c1306c9242, 0x950f6cc5ebfaec04, 0x4a073b307e338c3b, 0x46a1c5bfd83efcd0, 0x48b59163d59acadc, 0x49a9155ca9c6fa89, 0x722b089c8608308e, 0x6d031f3a39e20889, 0x04b1891ca58db710,
+    0xfa777e0116ff6853, 0x59cd6b744fdf8812, 0x6f35c774bf7daa28, 0x81188c67170e3668, 0x44e41faaf448c942, 0x432e92a67d06bc0e, 0x54011285cd20e9ce, 0x8b072cdd2fed09f6, 0x03f3a566a65f9a6b,
+    0x5989b413bcc3aefe, 0x28482d5edf932ceb, 0xdf97092acb6c5e80, 0x4f197231d3e03b34, 0xcbe32dcd5766990c, 0x26b5953690228a22, 0x4e2edadcaa5b959e, 0x846f56bc879e863b, 0x0529dc1cf7a49820,
+    0x1f35d648a84dc449, 0x6fcae348286bb08e, 0x94157e7559553e64, 0xe21c98fffa3895bc, 0x2eff428835957194, 0x5a4ad563cf442dee, 0xbcce1a74cd84d137, 0x8c72a9b3f157fcd6, 0x036f165ed35f5f7b,
+    0xb55d48e61be8b17c, 0xc0fbaf32b30a9473, 0xd773f1052a9d5dc1, 0x1506bedc68f55389, 0x8e4eee55185bba21, 0x165218db01ec66bd, 0x38b505b91b6d33c7, 0xb80fc26d8a705159, 0x01bca1c3b9ee11b3,
+    0x7f70d125f6a04fff, 0x0c9bd25dfdc2e890, 0x488d93ad8576db1a, 0xa220306eb2182074, 0x9a085c953411fb39, 0x7f8e64319a0d03a4, 0x38536cefbea8eef7, 0xa82dc705d8bdc506, 0x00f9a6ec928ae8d1,
+    0x3a1ee85d0c842101, 0xb0ee25ae623953bf, 0x8ef1c50b9395e868, 0xe8ca252e30f72ac8, 0x515049a4c608af49, 0xefef9c25a5d3af7f, 0xe5ad5fb556a680ac, 0xae585181dd43f7d7, 0x019f89d5652ada5b,
+    0x0cf0c916b6a7d05a, 0x166d60546f60bdee, 0x2b1175cfb85d6a2d, 0x3a1e00b230e0d388, 0xdfd42dc2e1c04084, 0xc8f3b97f34c6a7b9, 0x71810844acc3f68b, 0xeaa0afc9e18ad704, 0x075724f2552e2b47,
+    0xedb9c35c7b0f700c, 0x017e843aafa4a2ca, 0xe5de3c21e2fe5fa7, 0xc04fbee3c595520f, 0x58f3dfc00b9dad94, 0x6ad13b03846fd05e, 0xe04ffbeb1a7cdb60, 0xf768383aaf9395c1, 0x07072716feaaf6ff,
+    0x00abdafe1224fa3c, 0x948692bcc5e82558, 0xfd48297f595b494e, 0x7dafe96a8917abf4, 0xb79c22daad1b10a2, 0xef065a236490fd59, 0xc257c1ac8b8b7be8, 0xe080bb46dbf37570, 0x002061ecbf465c1d,
+    0x1fd736192319b4ae, 0x2e906467b09c4c6d, 0x03a7891d4af5fdc5, 0xd1022d79bd5ed7fe, 0xe51351ea8a74b733, 0xf196af05acdc04fc, 0xd59c72f65c7dfc42, 0x34e9566769cebe0b, 0x031b5dd89a243b4c,
+    0xaf8562144793f210, 0xa9f4fa349969f3df, 0x5c65edcf22802bcc, 0x2cc5d8240f583a84, 0x0d21951cf61f79b1, 0x4476ef33133640f9, 0xbdc9aaf700a53148, 0xcc7abb5e26100973, 0x04f550dbc0ee8f33,
+    0xb9dfab2523ff0ba5, 0x76e6da61917edf8b, 0x019248d23e0dc763, 0xb5c568108a744aff, 0xedf2a2cc64a9774e, 0xff1ebde9011a2e66, 0xafd32e8bea02845b, 0x63e5d72eeb83f580, 0x033d482efcd4927f,
+    0x84a3aaaa964a6860, 0xe076574f02e81a63, 0x44fae2b07e9891a0, 0x662fd12151c8ff83, 0x08cdd00e6cef4b7d, 0x0c4bd9a43c09863b, 0x0df1f48bccf6a4e8, 0x82e9d21b3b69c9d8, 0x061c4de81eb8459e,
+    0xdb6624ccffe68212, 0x97eab81d71f159a5, 0xe5c63e641bcb6b3d, 0x4b17117de8117f1a, 0x1872f4ed54295328, 0xacc2036d642e65e0, 0x58c062b718b58ab0, 0x77a50239664c8d06, 0x0323c8915f867583,
+    0x1b3a3e7297158630, 0x07eba05befbe0e7b, 0x439e1a092749c0ac, 0x68564dc9b5c9eeeb, 0x1d261abac33dcdad, 0x9104ed8d44788cb1, 0xa721e99785aaa0af, 0xfa8058260eea6525, 0x0406f8b184eebe56,
+    0xcd18ec0390473713, 0x066d8f03a355b9a7, 0x9a963774518695c7, 0x6130c7eb9bbea491, 0x851244fd08c62861, 0x5ebcecd5706159e6, 0x880c16474bf5cfd3, 0xea5bff02a00ff983, 0x01b2ee867bde2adf,
+    0x9d7dbb54e0c55e50, 0x3c3d003a394c1e16, 0x439804ebe7fb9cc1, 0x26ba0f2becc5aeae, 0xe283d45374f85b77, 0x856704f5931ad0ff, 0x31be9cb6f970c28f, 0x64785d00d76c8702, 0x02dcf4a24857ca75,
+    0x4d7f315f26531afe, 0xb7d8fcb53e31e715, 0xdce79b8fb6aa5175, 0x9c08d809bd446fdd, 0x323f72aad278f6f9, 0xdc73f103a6fbab61, 0x7f35d144a116940b, 0xa7354bb5ddb4e7d3, 0x05d5ad40d90095b0,
+    0xff92144d7f69a8da, 0x2f58244ab88c6baf, 0xc1a29e7154027a18, 0xaba92d7cce486974, 0x3ae1d7303b09ad6f, 0xb9b804b523541129, 0x6842dbf12dff3136, 0xce65501c4218edc5, 0x06af520a69200aa7,
+    0xce38fad33f3f92fc, 0xc45455333f3d2500, 0x353cc4eee496313c, 0x3418e7f81e3ede94, 0xd379eea5d2b30263, 0x549f5252a76a33a3, 0x7835d5bda8621135, 0x72e1cd20a73aceaf, 0x0316894e4dd801ab,
+    0x7ef4898e3f81a991, 0x0467992b8196c947, 0xa75a0bd58ee811f2, 0xe3695bc20150ac39, 0x00de4aef8d232ed8, 0xbb4a2548212edd7b, 0x9c01d50fb8616b8e, 0x16aade230c5eb300, 0x037ccdb7b55c08e1,
+};
+
+static const word_t EC_PARAMS_ID_NIST_K571_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_SEC_P256_K1_WIN_5_XY[] = {
+    0x59f2815b16f81798, 0x029bfcdb2dce28d9, 0x55a06295ce870b07, 0x79be667ef9dcbbac,
+    0x9c47d08ffb10d4b8, 0xfd17b448a6855419, 0x5da4fbfc0e1108a8, 0x483ada7726a3c465,
+    0x8601f113bce036f9, 0xb531c845836f99b0, 0x49344f85f89d5229, 0xf9308a019258c310,
+    0x6cb9fd7584b8e672, 0x6500a99934c2231b, 0x0fe337e62a37f356, 0x388f7b0f632de814,
+    0xcba8d569b240efe4, 0xe88b84bddc619ab7, 0x55b4a7250a5c5128, 0x2f8bde4d1a072093,
+    0xdca87d3aa6ac62d6, 0xf788271bab0d6840, 0xd4dba9dda6c9c426, 0xd8ac222636e5e3d6,
+    0xe92bddedcac4f9bc, 0x3d419b7e0330e39c, 0xa398f365f2ea7a0e, 0x5cbdf0646e5db4ea,
+    0xa5082628087264da, 0xa813d0b813fde7b5, 0xa3178d6d861a54db, 0x6aebca40ba255960,
+    0xc35f110dfc27ccbe, 0xe09796974c57e714, 0x09ad178a9f559abd, 0xacd484e2f0c7f653,
+    0x05cc262ac64f9c37, 0xadd888a4375f8e0f, 0x64380971763b61e9, 0xcc338921b0a7d9fd,
+    0xbbec17895da008cb, 0x5649980be5c17891, 0x5ef4246b70c65aac, 0x774ae7f858a9411e,
+    0x301d74c9c953c61b, 0x372db1e2dff9d6a8, 0x0243dd56d7b7b365, 0xd984a032eb6b5e19,
+    0xdeeddf8f19405aa8, 0xb075fbc6610e58cd, 0xc7d1d205c3748651, 0xf28773c2d975288b,
+    0x29b5cb52db03ed81, 0x3a1a06da521fa91f, 0x758212eb65cdaf47, 0x0ab0902e8d880a89,
+    0x44adbcf8e27e080e, 0x31e5946f3c85f79e, 0x5a465ae3095ff411, 0xd7924d4f7d43ea96,
+    0xc504dc9ff6a26b58, 0xea40af2bd896d3a5, 0x83842ec228cc6def, 0x581e2872a86c72a6,
+};
+
+static const word_t EC_PARAMS_ID_SEC_P256_K1_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_SEC_P256_K1_COMB_5_XY[] = {
+    0x59f2815b16f81798, 0x029bfcdb2dce28d9, 0x55a06295ce870b07, 0x79be667ef9dcbbac,
+    0x9c47d08ffb10d4b8, 0xfd17b448a6855419, 0x5da4fbfc0e1108a8, 0x483ada7726a3c465,
+    0xeff959f43ad86047, 0x79b53a043a9b8bca, 0x719cca7764ca9067, 0x8e7bcd0bd35983a7,
+    0xea10047e8460372a, 0x79e88e2e47fd68b3, 0x940310420ca95145, 0x10b7770b2a3da4b3,
+    0x743286671ed7eee7, 0x7827ccd5a9b17323, 0x7392fe7101110e1f, 0xc0a609726d6328c6,
+    0xc3752c3edc69e1ce, 0x8edf3c26303fb7e5, 0x145ee80e5db9be3d, 0xfc24d5b7d605c301,
+    0x3ab150242bcbb891, 0x8f7cc643df26cbee, 0xe8281baa743f8f9a, 0xc738c56b03b2abe1,
+    0x17e735d9699a84c3, 0x82314eef7880cfe9, 0x7f718f2eacbfbbbb, 0x893fb578951ad253,
+    0x9d39c3cddc7bcf13, 0x9147a764e5b9da42, 0x58eb23f661a84676, 0xbfc2d555e4ffc15c,
+    0x2a4a132459b9bec9, 0x56ef4fbade124564, 0xbc0aaa66c1bf08be, 0xb4a786315530fe36,
+    0x3d67d1469e41f197, 0xb20a8ff6d73ee44a, 0x86d7af294a910719, 0x9bc2130133e599e0,
+    0x10a2660defbde3d6, 0x0e8fde5419c01401, 0x6a7b55377aa49bec, 0x9f33812e7508c0e7,
+    0xbd4227678118bf1d, 0x50d357dda4830508, 0x7cd07090e4ab6320, 0x541ccfefa0fd5d71,
+    0x9057bc09f6e48013, 0xf2516e54886e9f21, 0xaa4a3e84fb855ff5, 0xced807c955f519a8,
+    0x8e8bd373fd054c96, 0xeec4143ba8d1ca88, 0x6d51dfdbe5fee5dc, 0x4df9c14919cde61f,
+    0x92ebac06cad10d5d, 0xb5d506cdc2884901, 0x050974c23a1d85d4, 0x0035ec51092d8728,
+    0x90d4a05cd9c3b41a, 0x8504f89b59af300d, 0x8539c37b66fda64d, 0x9ea471e9c2f0bfe0,
+    0x78bef12888b92d14, 0x346601b90e1af314, 0x53aad005f4a4a777, 0xc0c868e5471e3900,
+    0x0a41f308a972062f, 0x8ac28fc0b39c65c3, 0x373fddf531a0c1b2, 0x3bb654b0479312a4,
+    0x8b7e7a84ee38dc58, 0x16d8652917b92cff, 0x084ac6edb4d59215, 0x6c348ea7895148a6,
+    0x967d8a33e0fcb9dd, 0x6eb4165553a5934f, 0xda7152299bea5fe9, 0x9ba0b77db824f0b2,
+    0xe0a273dfb22700c2, 0x32237ade7c4d2e1d, 0x22a41e97c76065ac, 0xe136cb59775b13cd,
+    0x5ccad733de38f5a1, 0x852f8c5d61f3c3c3, 0x7a360fa20769092a, 0x7a7959ed88b5339f,
+    0xe56b35bee83e937c, 0x95a97c26312c851d, 0x7e1538c1f178b17b, 0x0d6a910eeec9ee05,
+    0xa82a532d9e9fbc99, 0x77e6191a9f645f87, 0xd58485dbd2397b9e, 0x15523f6e580dc783,
+    0xfb1ec9680b196821, 0x25cc553d49214ed2, 0x0fb145544525f9f5, 0x0504a480cdf7b3a9,
+    0x543492fb26b32bf1, 0x585365e24c5cc067, 0xdcf2a1a9b53ab969, 0x993995f4ceb7ae1e,
+    0xdad4cd082ca07632, 0xc8320c9a043a9b4d, 0x78b40e14b4dc6db5, 0xcdd3a29980ebfe8c,
+    0x457e18aac4881ed4, 0x5d71c0a1b2d9ac4b, 0x866c5fa615f1a2a9, 0x724ec6b7bc055b4f,
+    0xe2e12a205cf8801d, 0x5feb7f82682e487c, 0x42884d32db253ba2, 0x2278626db6a66eee,
+    0x6d76a8793180eef9, 0x8d0012209a28b977, 0x7e3acebb1aa07b12, 0xfa50c0f61d22e5f0,
+    0x38cd8d7d3f4f2811, 0x5e683293a57a213b, 0xb72cd2872281a68a, 0x6b84c6922397eba9,
+    0xbaebc358863e4d1f, 0xe79b1d211833891a, 0xf888c179c3ff9d0b, 0x1621ade85348d428,
+    0x7c1739d8cbde7bf5, 0x8ac8bc5cf203f3d3, 0x8693a416b04cae27, 0x7e3e9ad7dc6b8b71,
+    0xc396fab3958d7470, 0x2115d12aba3f73c6, 0x1960303e3ce86ea7, 0xbe82a87f87ac3f60,
+    0x57114695e504673b, 0x6d0925a633a7be96, 0x80504f4b44fa3e96, 0xa623715dd552f9a3,
+    0x82a20559d27a2dd6, 0x72e3e8f132095657, 0x1918fbf02ee5ca03, 0x0e1f311523a985ba,
+    0xd38d6eb986b1e576, 0xd2893fa3c9fc776c, 0x5441c7b025dc6adb, 0x2dd46211a66b1102,
+    0x9b836c6eea47f3eb, 0xb2c40446bfff1840, 0xaa376a687e4a5106, 0xfe1ca893c8bc0888,
+    0x350171a09f7cbdf6, 0x8605a84f3e03619e, 0x82458d0743db48a5, 0x2595e886acabd83e,
+    0xaa377f20b3347d19, 0xeac5e9c2e845d4bd, 0xe7af797e253b325a, 0xd04e35be7154e43f,
+    0x75ddc2b58fdd94b0, 0xc649082f1ce94907, 0x6715b86f8803b677, 0x0179eba5f31cd3a4,
+    0x46f632342e8fdb15, 0x46f098d23ab6dc53, 0x07b57d9f4d15b80b, 0x4c963df9929c91eb,
+    0xe79be64d945dd325, 0x523e3fe2eb47bcdb, 0xea7931dcd9269aa2, 0x9be4c88ca3130d78,
+    0xea060d898843f925, 0x05b1f63298f52d02, 0xe70a27502b8f7323, 0x1293c80516bde3a7,
+    0x2f5fde3de3f76a0a, 0x5d36333c229ca347, 0xae147845694c2420, 0x25a1c0b8bfd4f859,
+    0xa41ca8fcf523f145, 0x5ec3b1abde5a5710, 0xfb15f7405d14de5e, 0xb9b003841ced5c38,
+    0x85b845476c3394c8, 0x980a386a33d05ca3, 0x47cf9ee4e48c40fe, 0xfe6f7db6e8d7b34e,
+    0x2bb3eb0391e1887e, 0x7dc40d14efa1115c, 0x195c33961d0dd4fe, 0x9b0457e61a2a4570,
+    0x8d9793e980a7b570, 0x432657c9a07cb95d, 0x9a1bf666da56ef9e, 0x2b65a9e0916b891f,
+    0x47ab77150fedd437, 0xfa46e33abc968ecc, 0x7c8db828937945f7, 0x374642a9e1b2571c,
+    0xdf83151c8bcfb8db, 0x5fb1702f86e3d903, 0x9adaf51884f65c3a, 0xeae7c34881c7aee9,
+    0x5a5e7d069b969891, 0x9d9437195fc1fa0a, 0x9fbfe4051a6bbecf, 0x64f751b4355dcd84,
+    0x596361f2db96ef6c, 0xb9941b9fc98804cb, 0xb85fe7247e7930db, 0x0fbb2594b790b83f,
+    0xeb62cd0a2e2f7365, 0x6b84e815b4ec24a2, 0x0c958d61a17c7dd1, 0x2cb6ece5cae10452,
+    0x5fbd20bec16df050, 0x6c776e20b06c74dd, 0xf35f76650de237e7, 0x0d041a6cae607168,
+    0x57186dc0adea7962, 0xe6b3958d2a58a4e9, 0x2be2790d12c2c4c8, 0x0720a44d97be6f02,
+    0x1feb91a6c67131ca, 0xaae177e74aa89bb4, 0x8cef30943dd306a9, 0xc9f828f5facadfe7,
+    0x0d3c7550d48a3e80, 0xd7d73bf65461aeb3, 0xdf88f4815193c24b, 0x561745cf86afa641,
+    0x5f058be232d71193, 0x84142782f0e52906, 0xbcd76f6734092867, 0x574823ccab15b33f,
+    0x11f8813efd32e1cc, 0xcc0fc9191d4bf2cd, 0x566b058b228ab159, 0x892a09ec30ef2135,
+    0x4c3c6c07464a8415, 0xf2b2f5ccf43a18dd, 0x95bdf49c0acd8f4f, 0xab3a52b18a7f8937,
+};
+
+static const word_t EC_PARAMS_ID_SEC_P256_K1_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P224_R1_WIN_5_XY[] = {
+    0x7993ea716ad29d1b, 0x4d402109cf9a7441, 0x5ddc6352bebd634f, 0x000000000211cad8,
+    0xc4e76c808e956e51, 0x8f3e2bd5f943b361, 0xcac7fbecf98919fa, 0x00000000285b6e63,
+    0x929caf015f363d4a, 0xebfd3ec8bb2fe170, 0xf81289b151f8ae31, 0x000000001a81c1fc,
+    0x833e51a0e68b4258, 0x925921a6f8efd4fd, 0xcd540e0bd249f2c6, 0x000000008e3e3682,
+    0xdbbe8a9c6f4fb1bb, 0xa34777c76a8098e4, 0xed3269d56907192b, 0x00000000bd078750,
+    0xaf65dad4cfcfb971, 0xa9f5b81b773da6b8, 0x7a901d4bc3543acc, 0x0000000021ba7b85,
+    0xeb37b68c1b6c8469, 0x6c6e664fe9bd4564, 0xec6b495532ab74ae, 0x000000009a2a984c,
+    0xc530680eacae8fd4, 0x0de26e4dd9f89777, 0x3e229debee52646c, 0x000000007912bb5e,
+    0x9e41952526224992, 0x9a3adad6206cd132, 0x7548bf73bf3c9672, 0x000000009fc109c1,
+    0x3206212b83541135, 0xb77294bc83ad3e36, 0x5e0e646b36f9c3ff, 0x000000001009a828,
+    0x550d584fc31728c7, 0x739638cb62a05845, 0xe30fcb65ea60f3a4, 0x000000009c33bba5,
+    0x307c0777459ced23, 0x4b7b7375e6ddce9d, 0x1a78078f7f1896c1, 0x000000005930885a,
+    0x7c041693fc7f350a, 0x0c003d3380b6f524, 0x4f5fad1a0baf8521, 0x00000000be34acc9,
+    0xad8f1e98ce2a027f, 0xfce621cd5733c501, 0xa14b0e5c16d9dbad, 0x0000000061a162e6,
+    0xb7c981623327d9ba, 0xb86447dff54885c8, 0xf305828d768c19ac, 0x00000000b587f0fe,
+    0x699b7cf3e16afaee, 0x89a95d59830910af, 0x8cd3d2f455a07ae7, 0x00000000366fba9b,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P224_R1_WIN_5_Z[] = {
+    0xd682785e20b562f7, 0xa8e8428f5cbf0389, 0x1c3fb2447b576cf5, 0x0000000079360611,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P224_R1_COMB_5_XY[] = {
+    0x7993ea716ad29d1b, 0x4d402109cf9a7441, 0x5ddc6352bebd634f, 0x000000000211cad8,
+    0xc4e76c808e956e51, 0x8f3e2bd5f943b361, 0xcac7fbecf98919fa, 0x00000000285b6e63,
+    0x7aecdc34ca0d8480, 0x28c1035831142082, 0x761adfa5a2acaa24, 0x000000006d1c0136,
+    0x321ccdc9363c5552, 0xfb82f82dc4aaccb7, 0x32fb9857d1ed98c9, 0x0000000073c53092,
+    0x9efc881ef4eae4b2, 0x44b168cc6c871b06, 0x03719589154257ba, 0x0000000067453a06,
+    0x3868ec4dee4249ae, 0xd1212fdd3e47ad42, 0x15655632c86a4dc0, 0x000000003ff10bc0,
+    0x1aed2ce1a7ba18c5, 0x470f7c0fd58dfae3, 0xc2b5d522b163c1a1, 0x0000000024140b30,
+    0x206f6ada5189842b, 0xd5088dc80e7ea8c8, 0xd4ace266e1d22ee4, 0x00000000ce9810e1,
+    0x1e1f427438b50731, 0x192f38680cd8f7a8, 0xfdd387175a24af13, 0x000000004131ff73,
+    0xee1f1ad1ac263a96, 0xf29dfc9136cfd528, 0xc44793080fbf2ee3, 0x000000006366b157,
+    0x8ba658547625d9c5, 0x02df47334083a74c, 0x33c92391cfc6e6bd, 0x00000000bd866de6,
+    0x00b00cc94a1e8fd3, 0xcd1217d5e03c3e5f, 0xd286ce3bf8a6f9b7, 0x00000000a8a31ac4,
+    0xdd7f85378cf00c83, 0xc5ec2824e981e978, 0x860591484c795c94, 0x000000003ddb617e,
+    0xf0d26681691826cf, 0xe6c7c44143f48d34, 0xab07a08f1288eb5e, 0x0000000053698758,
+    0x8b525823791993f3, 0xab7f6856a2cb079c, 0x2d6accb402f81d39, 0x0000000011d55991,
+    0xeedfdef10272f812, 0x09fdf801701db1c4, 0xc1a7544ee2d13e92, 0x0000000010aa8e03,
+    0xe6ab979daf07eff1, 0xed96f1ecf51a7191, 0x4f0e0d1f01079935, 0x0000000060a66495,
+    0x34a65fee19792a0f, 0x2b4dfaae8299a8ec, 0x71ee6ab62b3f69ae, 0x00000000a52f93d0,
+    0x96552a9622cc92bf, 0x3bd6fc7a966d8c1a, 0x874d994b825bb6d5, 0x00000000b9c8df7f,
+    0xa9e375cef73b4ec0, 0x324f7d205b43842b, 0x7389e296314f2d4f, 0x000000009f8295c0,
+    0x0b021325727155bb, 0x36dbba907bf71453, 0xb7d464e8ea88333d, 0x0000000023dcea81,
+    0x6d6e97033ef831a1, 0x29a9861f67f29f09, 0xb4b9e75fa713b078, 0x00000000bef705b1,
+    0xe2fdb1baf01c707e, 0x5d028346657416f2, 0x42b259aa9fc24274, 0x00000000b4a8c7b8,
+    0xc2b18df7fd7b7104, 0x840b5200b44c4aa4, 0x21585fb870cdc203, 0x00000000a894e688,
+    0x985dc3cfa2c4ee1d, 0x67390cbbaf8725fd, 0x77e57963f0a450f6, 0x0000000065a00c2d,
+    0xc196f8486d608663, 0x4c9bc38376cf153c, 0x1e25ebe0a548bef6, 0x000000001c0b1098,
+    0x9ff477d4947eb68b, 0xbf6592b033a80835, 0x7237d6a43abcbf91, 0x0000000006ec3de6,
+    0xa22e71a3a17367d1, 0x267bc5aa24f621ed, 0x62f9f44775fb2d3d, 0x0000000094a81cce,
+    0xb901699ba1695e17, 0x28e7d83a73df0fd0, 0x4ec7f2d131c5b46f, 0x00000000bca6aa5e,
+    0x1e37acc68c1589b3, 0x8a8563bbc2efb1e8, 0xe4fe25cb3fec4f96, 0x000000000d1d96a9,
+    0x543055b7be301bbb, 0xcc34476a04134215, 0xa3f1598c5b0b8a74, 0x0000000034517117,
+    0x56e220071d970bd9, 0x3c535da437da8384, 0x166c66999a4ca6f4, 0x000000000d84d23e,
+    0x2f0d81ca0ba3f032, 0xc81e3f5139e33587, 0x47cecb1c9b5c2e61, 0x000000008bf5845a,
+    0x47552bea2d00ff27, 0xc9d65185de082b5a, 0x56521869e4910957, 0x0000000078b81953,
+    0x7a011f520c58b1ad, 0x87da0e035bcd8264, 0x7902138b842dd77b, 0x00000000d45eef64,
+    0x7457c82f3d41ad3f, 0x36159e40a83198e1, 0xda532835cb99eec4, 0x000000006b76a050,
+    0xaf8d15b56122fa1e, 0x98efa6e17d83720a, 0xa3b939877c18b022, 0x00000000905b4dd3,
+    0x3fae6a449c1eff7e, 0x0fa568f6fc41ce63, 0xb25c4a4e8b4638f9, 0x000000006555caf9,
+    0x0dfa7379819b9cd4, 0xd5795eb7e277fa61, 0x217637f03799f5c7, 0x00000000a53eda43,
+    0x4891d6c87be7bfa6, 0xf9148cb0d1a0cfdd, 0xd33aee239629d004, 0x0000000094cc4e09,
+    0x3e3b8064e9b54e13, 0x7ac84d249ad5b32b, 0x153bd685bc498231, 0x000000005824d453,
+    0xbea09827234060ae, 0x5c6949eedadb615d, 0x9378f55bbd4609de, 0x000000009c06d498,
+    0x648920b5b1ad179e, 0xdfd11975f9df3f7a, 0xfcf6c7b15e66cfb9, 0x00000000925271d4,
+    0x0c9fe6aee9804158, 0x5c9b3dadaeb65e16, 0x9ff6bf99700ec41f, 0x000000001d673458,
+    0x62f65a890614bef1, 0x4fbae1d1d9ecb87a, 0x681c835edd0fb7db, 0x00000000b5fcf032,
+    0x0d6f2b72af8d3479, 0xfb06bf573baa2bda, 0x9345f05cc9f0c2ae, 0x000000006c6c52b2,
+    0xbd612f82f242e5fb, 0x5c5b33c930a10beb, 0x74e58274da8a0e0b, 0x000000008637c9a8,
+    0xd81f7e3376b145ff, 0xc7d78a277a4156a4, 0xc8d633296f6d88ab, 0x0000000035c944e1,
+    0xc7cf6d67442add62, 0x6bba180f873ff325, 0xb38530e94b1acbad, 0x000000004a15f7b0,
+    0x1bdf4d56653d9854, 0x9c86fe4fd821caa2, 0x104fefdbd316c56d, 0x000000003f62d398,
+    0x70fac6ed32d798a7, 0xd7b401765b37e8cd, 0x1c604eecb7cd72bc, 0x00000000a46e5d4c,
+    0x2479b916b09b4530, 0xa342e55b34440b6d, 0x9068cac1fc28b6e3, 0x00000000c1d045c3,
+    0x653d8105320e7ea2, 0x9f36fd237054f36e, 0x963aa5b05b577d30, 0x0000000059c6c19f,
+    0x38676dda6545d520, 0x9b42ffdab4a0787f, 0xb70c3f56695a328c, 0x00000000430aa7f1,
+    0xb8c61a440e1d8933, 0xc93f0d26a64513be, 0xbfa2bbe99bc7cc2a, 0x000000007be6486e,
+    0x7f349427a0573d55, 0x6b9670b0f6a53d3f, 0x0dc5fdbb8c315130, 0x000000009a9075c1,
+    0xea8f694866e1330d, 0x82e1c798889e1f7d, 0x149dc0f95170392c, 0x00000000aecdffe6,
+    0x32f55b08da7bb43f, 0xc8e068eca6503c24, 0xef86b555432e6820, 0x00000000bff3906f,
+    0x923ca11710565e14, 0xf1f0a8085eb4074b, 0xba26e36f260353cc, 0x00000000b113e4ba,
+    0xf59d73d18dc3e20e, 0xf5e7d92a8ff59ddc, 0x28a81368445f3ba4, 0x000000006881b90d,
+    0x443b76ff53061fa7, 0xf1a8ea0cf7d2b372, 0x8ca4705673545ed8, 0x00000000a63206aa,
+    0xbfac1a2627dd419c, 0x3ed73a53ed18cc0f, 0x804a3246f30e3d68, 0x00000000969a740e,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P224_R1_COMB_5_Z[] = {
+    0xd682785e20b562f7, 0xa8e8428f5cbf0389, 0x1c3fb2447b576cf5, 0x0000000079360611,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P256_R1_WIN_5_XY[] = {
+    0x27c0d92d351fd10c, 0x80de4d9ab97cf30a, 0x704c311d6b892ad3, 0x8e1f767a9e119bdf,
+    0x9a4fe948a0917a17, 0xa618f259cd950162, 0x16fdf6e8dfbd8b03, 0x14eb78c6026eb0a2,
+    0xaa507f5cfa406636, 0xe517f879886aa273, 0x4f660096a8eb1afa, 0x8f8f3eec9755935e,
+    0x849dff286297f4e2, 0x2bb4487ecd0ed256, 0x8b19494dc6abd8ed, 0x3516f65c464340db,
+    0xe74500cb345c1284, 0x729f8232134e92cf, 0xb9fcffbd6686a595, 0xa0ab5ddae6838b67,
+    0x2a6ab774f9a5f7a4, 0x0f9d609261dd9e56, 0x5663e73d8b25b304, 0x11742af4bd639ade,
+    0x01ce34a7f2fd1b8a, 0x6edc83eed18dc9f7, 0xbfeb8f85e2dd5f00, 0x1e03b6ef1fe3dda2,
+    0x49dc8184d7366bf7, 0x91225523930a87db, 0x5c283cba6afc3baf, 0x09de2cbc78fba28d,
+    0xa4ea2b45f77b8821, 0x7a69e7e18fa9bc50, 0xf8c396e79e035008, 0x63c9a8386f4f43db,
+    0x8174716a362876a6, 0xd8b9f0a4049bae5c, 0xfde5604ad5c671ef, 0x84e49f6a21b4721f,
+    0x74bf8246fceaa339, 0xf3cf7204fa6486f3, 0xc9009944edac98a7, 0x11a9e27dbacc3348,
+    0x1f19bf74307f4ab1, 0x15821bdb3671c086, 0x34a20009be634c5c, 0x4f6e11be4ce431f6,
+    0xb281261783c9c95e, 0x1c0e92062c9e7c3e, 0xc60e9a7f7d11072d, 0x8ac66c9179879b49,
+    0x0d8058c31473fd6c, 0x77480d4afa62d061, 0x4cf615d41aebc5ff, 0x3f04f1f713df5fd5,
+    0x2caa81c4c5e7e832, 0xb6bb1a3e3010ef7e, 0xb7f0406534cf426c, 0x2097833ebbc098a2,
+    0x15e01042f6af51cc, 0x60f4ba3aac4bbb9b, 0xe91961b785817239, 0x6628b3235363c415,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P256_R1_WIN_5_Z[] = {
+    0xdfecb7e2e091ac89, 0x91c409dc2ad9dfd7, 0xc199f56f627c728d, 0x5604a8245e115643,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P256_R1_COMB_5_XY[] = {
+    0x27c0d92d351fd10c, 0x80de4d9ab97cf30a, 0x704c311d6b892ad3, 0x8e1f767a9e119bdf,
+    0x9a4fe948a0917a17, 0xa618f259cd950162, 0x16fdf6e8dfbd8b03, 0x14eb78c6026eb0a2,
+    0x464ae09d4f8ebc9d, 0x53afce7f43d14d74, 0x7c6b58a52acf9183, 0x5e04820d77a57c44,
+    0x9a7a54cf1234fd48, 0xc9b739c6b5f0e878, 0x5a6f3bb0cb668d53, 0x11fe006c42622ddb,
+    0xcffe53d50cc82da9, 0x097e7b49ba5b2a9a, 0xcd8aa55f5968539d, 0x5c05ee2362349c5d,
+    0x1a4783c5b9a82642, 0x6edafe50963b0e43, 0x59d38ea34374ea7f, 0x9231bb546c12fdba,
+    0xf0e266981e62413a, 0x9dd68c8b738d94d7, 0x49b1a6389b09ff7e, 0x479c397fdcb0c57d,
+    0x6b5d4b32c9e90fb7, 0x1aac89be5ec05b4b, 0xd24c310a86dbe4ed, 0x786bbceb2416dc82,
+    0xd9e4c4f1651ae684, 0xb357bcc5727e334c, 0x9d5088039343093f, 0x1fa96dabe33ccc88,
+    0x26f4465ef904126b, 0x4b48b55931f5c4c8, 0xf7fc6ffac3c6756b, 0x24839942afc21c8c,
+    0x098fa96e8c7a6fc6, 0xbbc9ade13309bc02, 0x75812e01b100fb07, 0x30b400ca8d4e34b7,
+    0xc937b8ca8f1ad62e, 0x68e4f452d462a8b2, 0x659acff40e28e49d, 0x9c404e2cf95621f2,
+    0x37923e2508f6bd58, 0xe3153aa823ed25f0, 0x1f7a1ccdac0c3d37, 0x2c71bc6a846256a5,
+    0x404650c8aef552fd, 0xbc56c72995f93056, 0x4dc6c7bf92bcc4e5, 0x0ecda9ff7722abe0,
+    0x239ea3a27672c18b, 0xa495f97e651006d1, 0xc57eebb2348c2577, 0x26fc74d650360b83,
+    0xec54ccd92f0e5918, 0xc036d4344aecadef, 0x2477bc9aa8155664, 0x2c6927254e1cf37a,
+    0x3f6c107fcbfdfc1b, 0xfbdab7c72471a410, 0x92155b014a99fa23, 0x0871e9cefe1db402,
+    0xa03d1f199617a266, 0xbfd08180aeb37eb5, 0x84c8b0e2eb72fbc5, 0x4a885c728785628f,
+    0x839d40d64d255da7, 0x600721eae05fc022, 0xf225390acb28add1, 0x8e4cc0fe3336ed73,
+    0xe7b372dc413f99f4, 0x40308cad8a745522, 0x9ab2ec185b7f0ce8, 0x716d64772ffaab41,
+    0xb02b17d6142c3976, 0x090ec045a44f2335, 0xeab3961158eece08, 0x12eb81527b6021fc,
+    0x70fcb3e96327c1ba, 0x74ba08b263cc6ef5, 0x5103f0b3ccfcfc7e, 0x3a53c55413d47b13,
+    0x2436d67da54fb0be, 0x61ab2640182321df, 0x9ae2075ce35a0ced, 0x12c6086ffe06c966,
+    0x9bf0974a9feb3ebc, 0x0d89ee7cb97e5a08, 0x699f5daaacae9906, 0x22a78e43e587371d,
+    0x181da861eb61e4d4, 0xf0b0776298318db3, 0x303f2ac1207fc575, 0x06f33a9b48a52716,
+    0x62e6b1c44721d6b2, 0xb02fceeca7f7f2f0, 0xf25a9f85d3070426, 0x89b000e630914a21,
+    0x3013b6dc58717aff, 0x63b75f04482d605b, 0x38bdf1328f57b1c6, 0x0077a6e3cb0f4f89,
+    0xaa75376a2e9c0011, 0x43fbcc7c4fe9e919, 0xbc99054d7372eb54, 0x5459c120167ed56a,
+    0xf1736ee806a530e7, 0xb005e596023b50f7, 0x114d9087a7706b55, 0x1b2d002584fb6c3d,
+    0xc5e75aa9b2f9bd5c, 0xe19dd65900f3fa72, 0xd364abc706ff1fde, 0x5923e35874950da1,
+    0x80b4d5f56f76b8e9, 0xddb90fd5ceb8c160, 0x3cacd7d6d516aa7c, 0x863838342ad0fb1f,
+    0xac7b293d41563832, 0x7e2ee8293105333f, 0x8b39ecf3b7bd98e3, 0x1cf61724ab10f79e,
+    0x4e1b426272821748, 0x10f13245d64a604d, 0x8df398aa47fc1431, 0x09d3a5c2cbf2be2b,
+    0x176a5370fd7d3b82, 0x9c32dde65d64d531, 0xd96f6d5402660bca, 0x11b3b7aad0e4d736,
+    0x1436bce036d23fd3, 0x735dd0c24666083b, 0xaf02d4ff525638e7, 0x43078796ce5aa73f,
+    0xd86f3c025637c2bf, 0xe572c1bba0da5d37, 0x8205361e5a0aa206, 0x88e4457f39c333e8,
+    0xf3ba63649f2a91b5, 0x2ac621c6bb9cff09, 0xf86c170637fa5965, 0x0aef9d822c72396d,
+    0xb2f088426ae61c87, 0xd4eb71a41cfce155, 0xb293aae2a66f8842, 0x2ffdc7b6154bcd99,
+    0x6a4a1baf918f8757, 0xc7541f7ad135eb05, 0x2c14b7c3ed810621, 0x8d7592c06458d9fe,
+    0xb649263fa87adb11, 0xd6d4fa857973ee4d, 0x4be7909ab9f86748, 0x2157bdae1944d473,
+    0xfef8eb148e354d40, 0xeb4a0d68d3a43d23, 0x33f4925be48df936, 0x5aa88225eb2e72b4,
+    0xd1fcbfdfe009ed8b, 0xdb41e06021373a68, 0xbdd405f219fd80c6, 0x139fe71e3418a2a8,
+    0xb9bc8e58bf1b6ec5, 0xbd083198a4c11b0c, 0xdf8e056c744926e8, 0x37fdff97030d9054,
+    0x7671bd69276283d6, 0xa135d72daeb0e79e, 0xbb3db38d1a9824b3, 0x9d23c75a9cbd5b6d,
+    0x1e441681d5bfb371, 0x35579c7cea11350c, 0xdc1a1c5595dd28b3, 0x889a86d8dfe7cf05,
+    0x911450857be7b375, 0xc3faa8f67a3818bb, 0xc8efdbfb97ba5239, 0x116c9c32fd250efe,
+    0xa63566f6deedf6ba, 0x1a05721df211cc85, 0xa1ff71f856f28fcb, 0x1f7f4c2b70e7d286,
+    0x9757653934107d63, 0x129035bc3999a475, 0x6c14621278ffb68d, 0x8bbb6e4db9f7577e,
+    0xc745b8cb7b275ba4, 0x4d9ce4233b35fa8b, 0x244abc32d23e9acf, 0x06a623a3500bb623,
+    0xc26dae3b678df7f9, 0x92b5df577883c979, 0xcef4a8078f2b93ba, 0x9ff4b622c4b0fa3e,
+    0x9b2a4fe85a5408df, 0x85dd71b303fb5595, 0x37b80d0f9f9c8ed2, 0x8c932a3cfddf9480,
+    0xea014920fc720482, 0x578de8771a13451c, 0x115349e18bc429c7, 0x682a2997a7efb210,
+    0x481b308f27166111, 0x38c86f4877f609b4, 0x272a9123ece5aa7f, 0x9814b86410f2b1da,
+    0x4ed381bdb8f05067, 0x6d171bd2cd1e91e9, 0xb0829e3bdf0cdc8a, 0x6651476068dd318a,
+    0xf9c5cd9646ba14af, 0x8d4e921ae329bce4, 0x24f3eb5981be02a9, 0x7b6874beed5f6af1,
+    0x2b390ce9035b6265, 0xaf280b1e7b75ff06, 0xa730591d231f933e, 0xa78ca16bdc86399f,
+    0x27d92ae7c950ee36, 0x11d1e214f0279b41, 0x79843bf63e7b0046, 0x30e9a228e16dfc08,
+    0xaee8f532fce044ac, 0x9b2df981afaa86f6, 0x7aaea11ef96ba2de, 0x17411b7cd5af779a,
+    0xe1fbef9f7524f092, 0xa4c76a56eefae22c, 0xcf398ed6bb98e9f0, 0x1a2851a3cad4359f,
+    0x94fc58577d75652e, 0xb13f1ffbc33507fb, 0x0999aa1a4ac94ed4, 0x0f85fd61092c61c5,
+    0xf7477333642277bf, 0x97ac546dcad27c68, 0xb21d09b750628f95, 0x2bc5c3182acc61d7,
+    0x6073e59a3b1a2029, 0xc0ffb0450c6b4bfd, 0xf53133da055f87b7, 0x7bd2476f43048e07,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P256_R1_COMB_5_Z[] = {
+    0xdfecb7e2e091ac89, 0x91c409dc2ad9dfd7, 0xc199f56f627c728d, 0x5604a8245e115643,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P384_R1_WIN_5_XY[] = {
+    0xa189deebd438fbc1, 0x66fc80e8d5a886bf, 0x94c378e99d202f23, 0x068b264ef95c2164, 0x9cdd0dcfbacd0099, 0x8500753388f53fc1,
+    0xe738b3310de140a5, 0xf5e0d246c7996f55, 0xf88309a38f0737fc, 0xa180acd4d5719217, 0xc61625664f21ddb6, 0x2cf4a062458968b5,
+    0x2e87b6b5ce7d7224, 0xad2c4af75a72461a, 0x3a5656812ced5d1d, 0xc7e3c8556d3d9c10, 0x93e8454e7f326e2f, 0x4bd131bd7606782a,
+    0x744eeef4576498af, 0x463253b57dd5d130, 0x148579c7ddfd1d1d, 0x1c61f51394ab2f14, 0x6d85b8ee9fe98583, 0x42b06ef36abef61d,
+    0xb41f442ad8ce9c49, 0x74989913f2c28de5, 0x3ccf2b6ec0e32761, 0xa4bc3eecc78ef5b1, 0xf17642077106ddb6, 0x01ef19cba3a80cfc,
+    0xdeb8cd3c92d1018d, 0xbc9bba0ee0af7013, 0xb31eadb3f6e97434, 0xdff2df918101041f, 0xa14e010330cacb07, 0x40db7c90ca03a002,
+    0x768422bff6835c16, 0xd4d9a16888742837, 0x5f0d3ec25a8fa33a, 0x0cc3ed0b2661924d, 0x98857089a9902452, 0x091be5a4a48e18bd,
+    0x04b8bd3717ef7556, 0x1dad241b002db12e, 0x099ca996a0566f74, 0x077aa1f32c5117aa, 0x1830b286165a0713, 0x48116bda93701b12,
+    0x0066aa18923440de, 0xa3b775c63364d7d5, 0xcbc1a12427c58e01, 0xac2ad5a583d2dff0, 0x39d8efce43620769, 0x8802607da6501595,
+    0xa2aa414b7e3b2101, 0xe7cd4887f0597f95, 0x392d8a2c9dc8df84, 0xedd53d57a93a3ada, 0x8b57c36c8ae63e94, 0x80c18d38b31a5c75,
+    0xf9cd0728edb12cd2, 0x6eaca41bdffddb84, 0x79f5c417bf3e8831, 0x119e9f8dc798afce, 0x528a6f859111fe9e, 0x21d8ef4ebee8180c,
+    0x75362a33dcaff317, 0x023e4bb8af3c4ff7, 0x3b5e01b474aaf7ae, 0xf321ef25cb04ef2b, 0x5c2268589e886c70, 0x2528faa003941651,
+    0x3b6a1968b89357cc, 0xbe74477bb7232c2e, 0xa76e871e80b79318, 0xc9c1678ed49cb174, 0x1f139b238168c1b7, 0x850e6136a145267a,
+    0xf62495c5da4e01a2, 0xd38b4f0116389a64, 0xa7d3478530dc4590, 0x617067491e8e8f55, 0xe40157b1b83eda1b, 0x546e48bc32e2ebb2,
+    0xcf37576fa216bcfe, 0xf0b7726338c71258, 0x14f5e71a268e074c, 0xf06395a1578c607e, 0x351c810092dcb441, 0x09d85c457724cb80,
+    0xd3ac38673a3ab69a, 0x2cf4d2e544ce2e34, 0xeb2ea010956c6dee, 0x784c963e04ac5a40, 0xd0de76aae553ff54, 0x0f5e7fee0c7df359,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P384_R1_WIN_5_Z[] = {
+    0x78b8ffeccef813ad, 0x532c58d66fe2e58e, 0xed4e25e68048eedc, 0xead08ef612aba94b, 0xf0a29081af19be20, 0x7346e17d5cc792d7,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P384_R1_COMB_5_XY[] = {
+    0xa189deebd438fbc1, 0x66fc80e8d5a886bf, 0x94c378e99d202f23, 0x068b264ef95c2164, 0x9cdd0dcfbacd0099, 0x8500753388f53fc1,
+    0xe738b3310de140a5, 0xf5e0d246c7996f55, 0xf88309a38f0737fc, 0xa180acd4d5719217, 0xc61625664f21ddb6, 0x2cf4a062458968b5,
+    0xdfa4fef32f2ef39e, 0x3e1c2b2e07d0c738, 0x4188a0136b4d31bd, 0xd8e1405f25f290aa, 0xc924383fa3428a7c, 0x7d1f5d5778bf2ba2,
+    0xc86b279672f191c0, 0x9ea99f95c6350047, 0xa0e509c820b3ce0d, 0x016e78c28a5f5c67, 0xa65b1662fcd05200, 0x235215c419fe4984,
+    0x2c4091876d233d0d, 0x607b2cdb928d6cc9, 0xbab4da1d29a5ae92, 0x10cfce725edc18da, 0xb85292cea4c2cf15, 0x4ccb5a6b2b0138b2,
+    0x006336c310d2dc96, 0xc7028bd23435028b, 0xa5c575ef33a52f46, 0xd901981121020c68, 0x8c9e4848f6244f4b, 0x261dfdb03f302877,
+    0x44a80bb69ee5611b, 0xe58f5b313eed1657, 0x774332709e0cd674, 0xc4f1bfeff20125c8, 0x04a63ee8fed03efb, 0x395fb8cbae77730a,
+    0xb77fdad15e87a776, 0x4c2fa2a0131535c6, 0x6e724f451864262e, 0x3e4753d8bcf0c324, 0xe706b29c6cea03a3, 0x00e9d92e5ddfa923,
+    0xe46a73d4a249bfc4, 0x87d5ce0fc3e9e1e7, 0xde6a14ea78716057, 0x644f112ff7b225bc, 0xa68ba18a14338cf9, 0x8777457645581e15,
+    0xec922ff16b709ef9, 0x55ba5b792f9a484a, 0x5c939c0abb5b2488, 0x1300e0fb3cfc0c90, 0x0a0a6cf48faac6c5, 0x89fdaf11c0e460e6,
+    0x34bac58ccc652adb, 0xc96824ee625f1df3, 0x3c7a04bd54be9d0d, 0x1e6dbac6651059ef, 0xb357a1a0350e1282, 0x69fb212f858a53a1,
+    0x7aea2209d468775c, 0xa0b1975fe1699d6b, 0x31af33425edca548, 0x09d2e7febaf56bcc, 0x4a8bfb3cfb4b93f3, 0x14cf747023f839b7,
+    0x1a1a1ae58cef7128, 0x147ab1b7553787d1, 0x1fc506e1924f8ab6, 0x14e270c8019d7500, 0xbea91f80b20a9589, 0x35a968b9b881ad1a,
+    0xef3c65b3e4728a97, 0xad03a32ede3a378f, 0xe6dfb6aac4e1a9dc, 0xbb80932a373930e2, 0x7beff3d6d9c1c2d4, 0x1a83c13bac58eea5,
+    0x96e9e384e4b01187, 0x6d733bceae4e9c63, 0x0513c3de0ba08dec, 0x4051d75e2a06d844, 0x267bddb27b9165fa, 0x14c545f660969638,
+    0xfb07b31cc9f2bfbc, 0x39ccee0f99192259, 0x74f5e07a6707bd99, 0x61a56bf16c96c809, 0x7f514164f254d3df, 0x6905275afa312912,
+    0x5ed4f7034d69aa2b, 0x7939901bf8896652, 0xfbc931ec7d4be443, 0xfe022dc883fd773e, 0x8cdb9682394a3480, 0x1abf51908fc8d219,
+    0xbd062c3f6c79a11a, 0xc60a48cd3099086e, 0xf7d379fbfb441e97, 0xc9d1c7907f1efe57, 0x32ec003b77b431d2, 0x7c86487668365c77,
+    0x9fd1a5910b9113de, 0x532df9eff410833f, 0x13baea337d2a6b82, 0xdef2cb3ae759e08b, 0x0b4ac36d255bb706, 0x54eadfb2f2c8cfa4,
+    0x27c0e69ac9cc5af6, 0x7c368b840217979f, 0x009b98b837f371a4, 0x27fbbdf1f6017e50, 0x78e8e69693363f51, 0x181d8dcbaf67755e,
+    0xc22227c7e8788441, 0xf31d3a08c14374ba, 0x7833be39cc8cd205, 0xf9eb2fac1febd2e7, 0x45c7472052d09788, 0x6a0f1cd747edf1a8,
+    0x786f5b9ceb8144a2, 0x0db008b6eea1b877, 0x31be9a6f5f5c13d5, 0x588aed1b3dc85f10, 0x97010ad65f7c7f8e, 0x2d69fbcd0a32f932,
+    0x9553e30abd203d16, 0xc8c1c0cb314dca22, 0x67fa5def2cdb84af, 0xa644da401e3e4638, 0xbbe367f7784d2003, 0x355b99975716f1a9,
+    0xa1335b4427824221, 0x572e1a5987714d42, 0x703f99d7b0d27dfb, 0xf0ddcae77ed77f8f, 0xd64c7cd53eb403b1, 0x11e5f58d65830438,
+    0x40a3104e560b55f5, 0xa83f87219b983119, 0x42e97eaef284426d, 0x8cd167dd4e1f22ac, 0xc28e612609e36fc4, 0x2144fa44aa793892,
+    0x7b3d91baedf1bf85, 0x26395e719e6101c1, 0x22fb78a8f2e126fb, 0x3d83afcbfadcfe48, 0x9471cba24baa66b6, 0x15aba48a754e3e28,
+    0x51f8ee8322e41b33, 0x4a3f93da2494b5c6, 0xd933927ba8ad5c93, 0x4238d65e178f2472, 0xaee0352cead295fb, 0x5a066d1f400a7f4a,
+    0x49ed2a4ce916fa80, 0xef4abbfa4d5219e0, 0x66ddeeb1a2acafbb, 0x43cfee75cc15b354, 0x486043967ccbb5a2, 0x6c143b264770bbda,
+    0xfeb3289bf20c60be, 0xc1ee262ea8ecd221, 0xf2dc21a4fff61130, 0xce51855e00e5c174, 0xad91cb28d1b52f30, 0x22dee8aad519d4a7,
+    0xbe5a64e71a77a312, 0xc8f40c0d67032bcf, 0xadaa38fcb8805ccc, 0x37df7e89dd6368d1, 0x1671ed926627e2fe, 0x5f16d5d58b2a54f7,
+    0xe97b76e376160696, 0xc17ba43a89863441, 0xe99cc3054fb4e84a, 0x8321b60cde9de4d1, 0x2eae800b63deb16d, 0x7bb4c71c5e6fac04,
+    0xab5dd9021b443ef2, 0x940f62cde9855981, 0x12bfbe0c26be8363, 0x5a6fa8f0babd2f0c, 0xca54e30ab561dfab, 0x7a894c04d390b33c,
+    0xfaf7336c3d66c4bd, 0xdf927989a59fd940, 0x317a1868bdc1f5d1, 0xf5b48c5342999b89, 0x08dd569ff3a0e1b2, 0x80682da3469a3bf6,
+    0x3f1e0f9e1b9bc320, 0x6a2df88d9862c3bc, 0x4d9eda1d618ebdc7, 0xf132da8aabc0757a, 0x5a42b66b13c3afb4, 0x3dbe232bcf164386,
+    0x442e520f55c12725, 0x9c3d5cb0ffc7e5f2, 0xcf27149726ca3a7e, 0x7369c707faeb8ed6, 0x27e9f1279d84eec9, 0x525e77b48bfeb007,
+    0xda60d28946718a37, 0x7368932ddfd47418, 0x1a3b2155ba0b94e6, 0x0cb5c01c3d5fa133, 0x2dac7598b8f7d059, 0x301e12333de41762,
+    0xbd2269a31704a754, 0x359df5b7f6078dde, 0xce6c5d1dae21a8ef, 0x34b4c1307274434a, 0xc0bebedf192aeea6, 0x5f9e7a72019791e9,
+    0x2960a12dbc573abc, 0x1af483cf3dc5740e, 0xeb605004574a805b, 0x7e592f333c94e6a8, 0x08215c5fa6a512e4, 0x78aa72cf5b070963,
+    0xaedc55923cfba752, 0x81662746365882cd, 0xae175e43ee8294b5, 0x16a7a632c4ab6f5d, 0xeb2132dd126a604d, 0x03d47d77779dc2ee,
+    0x26a345007508aad0, 0x6e31ab2f1ee40a46, 0xdf81f47c0b5ee1c6, 0xb06b528f1bc595d8, 0xcd39164c992bcf2c, 0x6686507f306ba17a,
+    0x5effe972d906965a, 0xf038b1c420e83063, 0xa2586497b112a441, 0x561abfeff25f5eb5, 0x312e73c1fdff36fe, 0x48a68dc8ca0a65a6,
+    0x3ff0b1994a906d96, 0xc290b987a40f62cc, 0x42aaddd1436ec1b4, 0x612f0119ef89d37f, 0xecb58e188687a2c3, 0x8aa1f451d4908e59,
+    0x9ef61ef959d0f69b, 0x277991308f57a020, 0xb9094d92e8354e9d, 0x2378844fcc16b047, 0x0590376378260198, 0x136d6fba20ade339,
+    0x9c1079df7bd9a81e, 0x7261973760cc6845, 0x0bfc61ab77cc82b9, 0x4f86e5abf8715f83, 0x75ee1e21e407687a, 0x35db25fb4e5f0d54,
+    0x05fec8537b81f6bc, 0x0c89a8212a3645d2, 0x5ac8ccdba59946c4, 0xf4e50d62e497ee47, 0x0b6446bf505d5cf7, 0x620850dcab6b61d7,
+    0x26311a25896afd78, 0xabb845f849cef2b6, 0xddcf54665a9b5e4d, 0xdefee4804b177675, 0x9eb38d84329d5d85, 0x6c800139380f3585,
+    0x44da9b14925b57b0, 0x9e9ad8cfebb5602a, 0xfb7e622a47e0eab5, 0x2279b39374eb720f, 0xa2177af4ae3f0020, 0x4e8a4f0fd7e0d230,
+    0x591b0f8764fc04ee, 0x0f9744b76f2eb998, 0xbf7d4e9128ff6e61, 0xe8455d87e3a3de36, 0x8b62a0e27445f640, 0x626e5c6a7d38df52,
+    0xab5bf8d9b8a4f8e1, 0xb89e588044166d91, 0x713fcb1a439fbb59, 0x25735791b1cbe034, 0xa3df5ed51683c1c7, 0x208dc3f0956dc1cf,
+    0xb99c88a4d82d426c, 0xaa3664564093215b, 0xcd70d8cce03d69de, 0xa2c27e569593fb6d, 0x84e6de4856b916b2, 0x3fe5d273bfe70d9c,
+    0xfcf42d822e682041, 0xe86f352b44ce9a47, 0xa03650c7dfd64827, 0xd129b204ec109fc7, 0x32c464eeefe4c011, 0x0d3d79a1f0fa0079,
+    0x1ef2a07c1edbee1a, 0xe560c34ef3b00704, 0x2b740426e36af662, 0x8c2311848b333223, 0xbed80b26175a25e3, 0x774fe1998e7c353e,
+    0x47cd7eec002814a1, 0xa9cdc62921b5eaea, 0xb319fd8f7a249950, 0x3c1483b0f72fbde1, 0xf9d75b0f79afff65, 0x4f544e37817b6ba2,
+    0x38dc8eb47feb8eab, 0x742d374334e6e9c6, 0x49a1407faaa88103, 0xdcf90b0de25342dd, 0x29c4ebb15d295250, 0x2fd5315ee32a1a40,
+    0xfe2890962313d6ec, 0x0efdef978c62b02e, 0x9d12d0138225c5dc, 0x4aaab885af3a3095, 0x80707aa37f81d045, 0x0ebf5e0b8e3d5bf2,
+    0x9d0d221bdba99f1a, 0x1eaf7e457c974e99, 0x044720ccb1ba0190, 0xc72afb9d11c97770, 0xb3207937c86be5fc, 0x14174abfe0947d19,
+    0x28114c326bd99e1c, 0x4dce68b7fe3dd747, 0x98563ce0dc9599db, 0x62e81e1bda68c574, 0xf4d8765600901057, 0x61e21eac7dc5001a,
+    0x935b30b83f2bdef2, 0x6ff930de487ce34f, 0xde964b2483040aff, 0x5c3f5bd28e6e28c0, 0xbb7bf552300bc2f0, 0x54e7555379f31772,
+    0x27d554f9362dc866, 0xee9e675da199a199, 0x03c22abee3f37dd1, 0x28cb680ce499e173, 0x4be9e42e0616bfd5, 0x4afda67e56737839,
+    0x7930adc83fe2d84b, 0xe147d302d30739b1, 0x55dd784ac5d89490, 0x566fc8a67d0c7d7d, 0xe413f13e19f1324f, 0x5b463267ba69db2d,
+    0x035f9f8dd47c972a, 0x63bc0d24fb89259a, 0xc098d4683e9e57cc, 0xf9ca28180d50f412, 0xf0e35490e806b473, 0x7859979a9500a01a,
+    0x9c393825a3ddd683, 0xfd74f0db60d3cf00, 0x2611a95c4df78fdd, 0xacd81123c22aed30, 0x49667fd3dca8938d, 0x26910d88575b057d,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P384_R1_COMB_5_Z[] = {
+    0x78b8ffeccef813ad, 0x532c58d66fe2e58e, 0xed4e25e68048eedc, 0xead08ef612aba94b, 0xf0a29081af19be20, 0x7346e17d5cc792d7,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P512_R1_WIN_5_XY[] = {
+    0xc4ce96095161d9d3, 0x683e4d64272c02a4, 0x34ab04146df55e8f, 0x8550539514c01fc8, 0x2433d76f905c8737, 0xb2b6ea37f36d3cf7, 0x871cb5ca006d4573, 0x5a2ba14c0994e981,
+    0x2f90662925042a6d, 0x7518df6f4742f325, 0xbf8455534c859490, 0x360ec775598ecc3e, 0x7c170b888fe62fdc, 0x585d2b77cd9d3f8c, 0x9a5ed7da870f3f9b, 0x8c50c9d12acb7281,
+    0x3268d7bbcb0d8637, 0x92da56dc40df5b05, 0x442130c80827a868, 0xdafb3eda039303bc, 0xd6fdb6ec7a5d9f35, 0xf0d8962dea8731cd, 0x4dd3948303ab788e, 0x5bc5646e75319656,
+    0x85096254bb99cc94, 0xa2cf949e38d72780, 0x50622be900dff70c, 0x70aeeea25bdba693, 0xcf882ecb4c30e348, 0x4062151a27559c49, 0xe0e46caac924cbb6, 0x89cdcbd93a486f6f,
+    0xfad0299b772c3539, 0xb7b38c1e97895fbb, 0x2a432f403f5d91c6, 0x8c11e21f68b5ecaf, 0x4183a7232736d040, 0x163face685b80667, 0x8ea7c40934a7280a, 0x7bff0e10a75544a0,
+    0xc1fd6edcbf0f4503, 0x8bb5f2f9ca09252c, 0x06c2616d275ae481, 0x663169eb7a4eefb6, 0xda4693ef09e0b9f8, 0x38ce89161d132626, 0x4637c39a9e57e3c4, 0x2753741fd5254403,
+    0x28c2f620f7ada902, 0x744ea1f769ba0274, 0xb76d01983279c77a, 0x114bd98ba29af32c, 0xda43d2d0bc566a94, 0xd19954e0e23e2942, 0xa63186e8fd6f6880, 0x1332b24a388dafb7,
+    0x29bd2318f3ff92e1, 0xed05887cb3deb540, 0x83ad0b4ba7c3a0be, 0xddea71719d48e7ac, 0x1e39af8235c41d61, 0xedf1ae72603f5da9, 0xd902d4bd73e95335, 0x5fe552f888dec030,
+    0xc2e9955562a71e83, 0x2cfff414989b6387, 0x067dadec08f3b023, 0xac9ba4c5ca1ec374, 0xa6d48f9cd5120d40, 0xa228e7f1af63395a, 0xd27f719844c36207, 0x67f90ca413d73ad6,
+    0x00032e6becc4b389, 0x4c311fed43774a08, 0xc7f78d5107927d82, 0xdc19f486d3a074c4, 0xbf22ff9b5b2600c1, 0xedbb095b87797110, 0xda3305dae1a0f016, 0x9fb1bb3360f6521f,
+    0x5d1cabb2c62a7560, 0x07f0d6b7be963232, 0x6c9d3640a38257c4, 0x2d100493a51221e1, 0x92affa8fcc662506, 0x07cfb3f0516a9bd4, 0x738d68dc6742c553, 0x2b270cab60276031,
+    0xfa1a3c0ba58281a7, 0xd62e30750c425744, 0x2c6f1cf28ad5f944, 0x7ec349b6bc132154, 0xcb7d1ad757fd4b5f, 0xb2a3e3873c301a2c, 0x258d9e108c12f4d7, 0x9f9f045b8180a7ed,
+    0x470ce5def304f233, 0xc0e290082da24861, 0x9576221bc2428f53, 0x4f2a1e268b97d540, 0x50a88a7b9a023a77, 0x9023ac994a66529f, 0xcc4984a7f5aad75f, 0x9841f6216f7780a7,
+    0x05cb1fc35fb2bf2b, 0xb0cf1abafef00376, 0x6ff197bb9fd0e022, 0x8e65364fbbe0c4d4, 0x9ea0bf8da3973feb, 0xb95842a93e6f8e66, 0xc82fd3207ba1dbd5, 0x92602e44e2c8495c,
+    0xf555480b34a32c3d, 0xac5f3192a814fcef, 0x62393bfaf2e73758, 0x035d11be25aaa89f, 0x68f7172d33d269ea, 0x8ea0689f384d88a9, 0xa5d5bc2d799a4fc4, 0x8aa8cea67b95e487,
+    0x92300bdc2919db9a, 0x8dfe8f658bfe1dd2, 0xf6cb0ae80753b9e7, 0x619e4ced59b9d3e6, 0x6401717e370fec1d, 0x4d61a50f61869a04, 0x8b51fda7e0a331c0, 0x9ea097b869ffe00d,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P512_R1_WIN_5_Z[] = {
+    0xd7559fa9a7c5b70d, 0xd77e00d0d27d397a, 0x51325ed5195c7f19, 0x82b264ff643997bd, 0x299c63358fccf78e, 0x34cf724c4c362df1, 0xc02b1951cc3603f8, 0x5522624724163b74,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P512_R1_COMB_5_XY[] = {
+    0xc4ce96095161d9d3, 0x683e4d64272c02a4, 0x34ab04146df55e8f, 0x8550539514c01fc8, 0x2433d76f905c8737, 0xb2b6ea37f36d3cf7, 0x871cb5ca006d4573, 0x5a2ba14c0994e981,
+    0x2f90662925042a6d, 0x7518df6f4742f325, 0xbf8455534c859490, 0x360ec775598ecc3e, 0x7c170b888fe62fdc, 0x585d2b77cd9d3f8c, 0x9a5ed7da870f3f9b, 0x8c50c9d12acb7281,
+    0xed270f7cf6d6d745, 0x1d82e5445549fa19, 0xf009f82707376c6f, 0x6e536a75b31fd599, 0x76baa0a6b4c6b18f, 0x6f1b2a08c78e2001, 0xa94a42b0479a58bc, 0x6f113b275dbb2551,
+    0xf522555bcb9b6650, 0x956eb65da267d994, 0x987bc62d889ebf07, 0x24554fb3c80455de, 0x50ca9a121a41cc52, 0x9670e30dbddcd460, 0xba8926ff4a89ffc9, 0x36058c64a93f71a8,
+    0x7cf93662a5d4847d, 0xf04e1929717db753, 0xc17eb9bd1f684edd, 0xed83ccbda8779c04, 0x0a0edb0f65808de3, 0x1d0d1e581478702c, 0xac6adb1cf6dc67b2, 0x15a30c1502b61d1d,
+    0xe551dd654e192192, 0x4701aaca00552d7e, 0x88bf6a21018a349f, 0x31326bc17a4f31de, 0xb7af5702f7c6f8a3, 0xb6f996523dd5a6ea, 0x806bd7740be5e00b, 0x8400805b46460d54,
+    0xf50415ec162c8976, 0x68d8aa5e602b313f, 0xa8dd3c252126da32, 0x056727a8dbd81059, 0x7cdaae9542b6d567, 0xfc993b491db72073, 0x0f12959cffda3aad, 0xa04c07427b8daa3c,
+    0x31d9ff5b1602d8a8, 0x2f0a3053a55d445d, 0x3ae388ec86e0171e, 0x0941398027775abd, 0x8beaa32e9e512567, 0xd387e39a75ac5fd7, 0xffcb70a79597c2fd, 0x5b83dd74d51c4989,
+    0x057745f3ad3dc851, 0x0c16c184a7ad824c, 0x304209c6f86bbcbe, 0x6fe48d3eb0ef98b2, 0x26926f66cc646421, 0x9018ae3cb38e81fa, 0x7347f6b43f184584, 0x605aa102f3c26e04,
+    0xe95e62546376d272, 0xce463b9519718602, 0xbff73a532c5596a4, 0xfc1615d9eee4d6fa, 0x0f70b524d82877bf, 0x4c9964926cdb7c26, 0x2b42e9f473267b5c, 0x088103f4af740ced,
+    0x15e77144f17b84a5, 0xd4264b62959cfea0, 0xca764b5e8bba9c7d, 0xe7f3e0a35b2a8e44, 0xbba1ec6f7ee58e96, 0xa89e9430183ca5fb, 0x6eae0635c6f509f2, 0x4d9e7c4aa3e8bda6,
+    0x75bba6cc4e32f947, 0x3addd650ee10775f, 0x23e5dd20e225acd8, 0x8bd9644328d19dd9, 0x8e9b6bb0ebc0977a, 0x03387bd60b177504, 0x7f66fe6c3e75b593, 0x02498ad0958d3ab3,
+    0xcdca62b08e8d3281, 0x9f3079c9841f206c, 0x6db60f42e30bf90d, 0xe8146991a953b537, 0x5e5c166473459236, 0xc61a04cd97cf3c8c, 0x09a819b8e9ad5dec, 0x3c48ee6e09b91e74,
+    0xee7860ebba52211c, 0x6aebbeab352b114b, 0xfc65340f5882d026, 0x1be488d5d37e5b74, 0x98f4fe88e4478b84, 0xfcf244328d100214, 0xf5d5bf069d8f7305, 0x11db62648113f097,
+    0x0abe05a7f3adbb40, 0x44cbee9c214969e9, 0xb2f25a59d4c30e87, 0x9126d4a715e9b3df, 0x17d22a16a59a4080, 0x13a056f78317b7fd, 0x51b01e7f78ee9772, 0x81ee58de39e23103,
+    0xde8c64c51fd45b87, 0xbd9ab49eb28b3dee, 0x791b4cc320ceb77b, 0x1e92384260ec2c18, 0xf5d194bb2d7ee31c, 0x733936aef8bdf6d2, 0x7a2d3e977b256739, 0x0fa350a1dcc286af,
+    0x6b92f2d800002e53, 0xe2dca2eb8978a1a6, 0x3446804befe1b9d8, 0x0bdc59e4caf6e9df, 0xab8d601054908489, 0xfc0603ff829ee514, 0x8db56332115e5dce, 0x741a4ab1a9118179,
+    0xbf2e184cd6c9c923, 0x64e248b8ee24ee0c, 0xd86e36dd33f2f64d, 0xc93f01a931f427b2, 0xaa3d303af2ad9e99, 0xc20fef979dcd5883, 0xc344a63e55f2d031, 0x070d4869f9a5ab31,
+    0xaac0141aba57a2a1, 0x69d38e73b904c122, 0x92b6317800e940a1, 0xde739ca5550cbca3, 0xf389b3f91efe778e, 0xa05fca75f296acb4, 0x0c204ebbca0ecefe, 0x955b3afee4e4a87d,
+    0x201789ab37dff638, 0xb04f5d9eee186bc9, 0x784d3bbb701b2728, 0xca882cd411422f62, 0x3fc05a7b98178426, 0x6d517b7fa58842d5, 0xd2643b98ddf1db3c, 0x89aa9ebd8abb7f4f,
+    0xb410521748f024a5, 0xa51faadd9b513ca7, 0x32f772126e962003, 0x7f4f9017830f5b23, 0xa70e482a9d71bf9e, 0x8ef2884e87bc081a, 0xd85069769ac3550c, 0x088759efccd03b60,
+    0x19cc29c3e6b97b95, 0xc7470eeaaa49611d, 0x319ce2c2b4e2c2fe, 0x4e92a6bc9c0120eb, 0xa6f0d21693dd686c, 0x0f00e361192d7f6d, 0x3714c5d9c027cf5f, 0xa4d24a6045d028ea,
+    0x2aa30889b2516e28, 0x454f050519189cd5, 0x4b102f31d0f8594e, 0x6d039209a2e6a6c0, 0xd453ccb716fdc3d5, 0xde249e78a8df86be, 0x967898cd81b68dab, 0x6f7c23fc7e4db66c,
+    0xd591b4ce6da5f491, 0x475a5996d75863d0, 0xc3f77a4e68ca159b, 0x8b401bab278fb0cb, 0xa160032da259adb0, 0x813c3ed3b6aef56b, 0xdb65ce182f3a8663, 0x2bc4a5dab9242a39,
+    0x211bf6ef95cfa4b5, 0xc61f81101fa49d66, 0xa2879cdd44375070, 0xcd45ce6450a9096d, 0xfaeeffb57d4f8ad7, 0x5c5ca72235f8982b, 0x55bf639a00880520, 0x4ea1355cc8e4dcef,
+    0xe0536e3c62f59d72, 0xb41cf27f439bae8e, 0xade7f720d9af8e15, 0x2e106027ae42f078, 0x9e0c185ee1c06a5a, 0x444b9f653f2c9a65, 0x7feb2e9111bda52e, 0x7eef3c3081f94bc8,
+    0x80725ca5773c6467, 0x75a5f3b730fab82c, 0x6ee481558e6a56e3, 0x277759a1623dc24e, 0xd87398d7a45a244a, 0xf7e81b54cdb7b280, 0xb4e8b452c1f2524d, 0x35355038a9db2ec1,
+    0xc32612493465944b, 0x199ac07c0a1bdb91, 0xe9df5b7583961f45, 0xd75fec28ffc95bd1, 0xf997dd77f6bd94b4, 0x7b0ee3bf00479aa9, 0x8a67ba8cf404fb4c, 0x506965bd07e39fbd,
+    0xee1689f916a68ff7, 0xe1ce789f80f2cd31, 0x524ebe627a1b3331, 0x3808f78fe637316f, 0x2d633f079130551e, 0x1b252756cc933c23, 0xac67cde360323c50, 0x93b2f9050cfc7fbc,
+    0x6b89f277733cf848, 0xef56489cafd62296, 0xc440b4d32bb961bb, 0xf5b5eb3d10d7237b, 0xf200ef971d26a428, 0x7e77bc12dd6aa0bf, 0x3ff265ff1edd5fd9, 0x5362e37d49c0eb00,
+    0x8b907e47e0e4f6da, 0xd8e3a391da5c76d4, 0x3d7cc9b267a3aadb, 0x7c05f11473454a52, 0xa3aef05153e15b2d, 0x67dc8d1cf35f39c5, 0xa0cc2a064e3b78a5, 0x81e3382a266272f8,
+    0x3510801e2c37aa76, 0x2763ea6159299293, 0x9a20d8e021b14aa0, 0x5fc33d9fc24eb2bb, 0x7a677e73c8ee1f5b, 0xdea51a3d35d2495a, 0x5b3e782a999b78fe, 0x52557c24693e6b3e,
+    0xc7c2e2d474826001, 0x5d3931f374a924f5, 0xb248185cef576b95, 0xa1faa17e05709f12, 0x21af291453a47006, 0xc78073ab8d1b60ae, 0x47478df86afbe2fc, 0x93453c44cebeb8b9,
+    0xaff1cb4cf92ed753, 0xa73bc7ff90d0a1bf, 0x5050682b684e58c0, 0xf1893aaa5e663836, 0x13195bd1f2c44c80, 0xba80734a6c380a03, 0xbfdd1b30a83e916b, 0x087798a51a4549ba,
+    0x7c1ef322b1b21354, 0x7a12a43c655b7128, 0x1a5d4d3c6dbfee85, 0x70dc2e67b0b23a29, 0x786a3f25795eb1cf, 0x35384c74b10a8ce8, 0x95cd0a71eb6510cf, 0xa2df3df96fff7732,
+    0xb1fff466b20067d1, 0x4a63281af90ddce8, 0xfb8ae1e7db06fa79, 0x63d7827844245a32, 0x5cc139af891d778f, 0xcf45da0c52a9af67, 0x7398b8792288e079, 0x66b193dda375ea77,
+    0xcea855e05424d6c9, 0x22cab3cf5616dd3a, 0x66048a9a05a18bc3, 0x9449b3a682539456, 0xaf2544563efba538, 0xb6679474eb38a2f5, 0xf7f1efadf8cb0412, 0x72a7175534e6d515,
+    0x2d0092ad7417eb70, 0x59c1ab6cab96c3b2, 0x56589baa4072333f, 0xe4ebf423dd90ddac, 0x4438a908ca32c095, 0x3992a0967729f015, 0x63508d6316904ccb, 0x232bfe9688f840a6,
+    0x11a2688b568981a3, 0x51771ac279afcad8, 0x0ba986cc2ef3f743, 0xc6c9b83d30a9f40d, 0x9af0f2ef2aa24996, 0xb746be2c52b585b4, 0x7d18bea621b5ea33, 0x2694d5e448506fa3,
+    0x7fdf7a75c45b0d84, 0xe6504630552e1809, 0x4ee5198f0b933b32, 0x6e6ee766a5dc35df, 0x12de8b7d547d364f, 0xbe366fad4d23be83, 0x5942870af058dc8e, 0x2228b703c3fd1bb0,
+    0x136bb1b0436e11bc, 0x3af94e507275732e, 0x2d9e5af5922025f1, 0xa1945fcd8a26f28e, 0x0774205da31c486a, 0x3af90ac38465c51a, 0x0a4d8a1bc88b7d7e, 0x624adb2c152065a9,
+    0x16370cde5d4dc00b, 0x29c8219bfe1c1264, 0x000685158c81f89a, 0x5419605ca938b9e0, 0xc7e43ec492d8e056, 0xa20c27a25a8fa947, 0x2185a5b55d214839, 0x4af2516184265e8d,
+    0xac83fca7bf3dbad5, 0xb3598806c3525d6c, 0xccafc9549dfeb7f9, 0x16ac83985686e37f, 0x65665196e932cb6c, 0xf6cda6f71f243c6a, 0x5c5ae640d685e3ae, 0x683fb3b0f2e0b6a7,
+    0x1690d1593aa7f3a4, 0x2369dc8721f8de47, 0x8bc1b66531394b23, 0x5b3fd9c7f67749b0, 0x572bb916b4fe1cbf, 0x73533ed4ac6f25d4, 0x72f9512a8fc61a22, 0x68c2bc074155b305,
+    0x35125686fea88107, 0x4404be4f53ed0561, 0xa95fd18173d6762e, 0x80a3783de08adcbb, 0xd2d8c15aaa326596, 0xe9e157242fcb9c36, 0xb1c6f41072b2c1a0, 0x3b164edf9080d75b,
+    0x9b3a2331ec08e13b, 0x90b6b6ce41655e86, 0xe57437dea631e1ff, 0x6021b33b94c891e7, 0x2d9996561560da72, 0x813b7366d4669e34, 0x67bab2f2bec10ef7, 0x45fc674ae07ea193,
+    0x6330d773bd88940e, 0x4485a27223cf2306, 0x9000790b79e43352, 0xc4824d8bb6273ba0, 0xae34a01998c060e8, 0xfaa6b80bac52369b, 0x3334466306b1f320, 0x6ca64509beb0667f,
+    0x909148ac59c198fb, 0xd4d411f2ca56b985, 0x811a1568f3e6015f, 0x694c83668f189ca8, 0x2be0f5a46b1a2b28, 0xefe7265bdb802957, 0x537cea8364cfa0ba, 0x4b28dd79399a980c,
+    0xd642bee98db633bb, 0xe078cea951856226, 0xc7a01d7aad07846a, 0xd24bc9d41ea372ab, 0x14f9d6ef5296ac26, 0x152a51aee1c27f3a, 0x2ad887ac94ce333f, 0x7b7a6e4c5ca286ac,
+    0x110d060470771e79, 0x438d0645cedccba1, 0x4c8173c8cc9a19fe, 0xb63935cc1e7b258d, 0x3619fd6a3e52ab70, 0x1c9329fa3d9e593c, 0x13da865a65cf53e1, 0x54d0ba5de4e1d31c,
+    0x3eda2cd13e009dcf, 0xf1951a4c10db251c, 0x9e9ca979ad3cf39e, 0x1a1cbbace24f7d32, 0x804cd8384fae97d2, 0x04d56503ba434b79, 0x59d0a572c81be99a, 0xa98507c3d809b632,
+    0xa1fa3e669a078d63, 0x3095e188224a775b, 0xb5cc718ea8fa797a, 0xc34b9425a6e3c243, 0xc30e1cd61b8586d1, 0x788a2b99571a0a17, 0xa934ba5c0fbdb8a9, 0x1611367081e978b0,
+    0xddd0a4fd841a3c55, 0x707cf34e50aef96b, 0x19c2a51a6ee7edb6, 0xf302ae66bcd98b67, 0x0ee0ac8dca139788, 0x1c47f744a07d1554, 0x5826711b933dbc29, 0x720dc7c3d5cb2537,
+    0x1e0cddef8572ebf6, 0x195b913532005570, 0xd46b3162c81dddfb, 0x6ebde65e6ca7f0c0, 0xecc43379f00d588c, 0x1cf27b1afd70e7fc, 0xca883be5cf2d0a64, 0x67367c1a71871a13,
+    0x8613d341041a1bc3, 0x5f276931256282b1, 0xedc2b0c0ab064495, 0x342d92cc707fc918, 0x3aed22689821518c, 0x3573af78798d03b0, 0x07b5a94ec75a187e, 0x9acfc209b69a6e11,
+    0x553d5672318780dd, 0xe9cd48d222b2fade, 0x64df17a3ed0cd010, 0x4acca3a0cdb781f1, 0x83fe75d6e5244aa4, 0xfba7660218c380b1, 0x903ddfd36a7a337b, 0x00a121c408b3ba0d,
+    0x0857b8267b93d267, 0xddd414290cb8e452, 0xde2138bdd88c06b3, 0x9bb9afa7bc5c059b, 0xed46a2a43de5a66e, 0x57e644acd6b987a3, 0xd1d6a55da9e53a20, 0x2a1a8f8b27e5135c,
+    0xe605936c629db54e, 0x4950edb5abd96982, 0x862bef7171876988, 0x642f2ad14a4b7adc, 0x4fbe3477b6e8befc, 0x3cd7c5a92f984ae1, 0x1f70717e7b33848c, 0xa1bac9ee1f6473fa,
+    0xceb1302662863b81, 0xd476a404fd47f1db, 0xe8dcd04b9b47e8b2, 0x7bc98574fa2551e9, 0xe46fbe8716136b5f, 0xbe18c82e6b17ccf2, 0x4f7b309f52ca03d2, 0x64d1ee76c76cf59f,
+    0xa168397766631ac5, 0x3a928d5c89937af9, 0x3e9f7e813c57377d, 0x99c2a95570b8fc23, 0xaee5e80166e522bc, 0x0942d688529d6d62, 0x3234c6c5d2b417f6, 0x634ce48fdd5512b1,
+    0x5f2c3eca15ddae5b, 0x51974f15ab901568, 0xed6865e4fcea9fdb, 0x076156e2fd4ae6b1, 0x1078de2909b26c4d, 0x37aef9989eff73a5, 0xd7a50783ee7a7316, 0x2748192e61a1d356,
+    0x2397fa2f042aaa5d, 0x9e92272a8aad46c5, 0xa50007a9688a7f11, 0x9c08eca38d657e9e, 0xa19bb934e3f000a6, 0xe068140abfc42c5b, 0xbfa3efdbb643b193, 0x4446f166095926a5,
+};
+
+static const word_t EC_PARAMS_ID_BRAINPOOL_P512_R1_COMB_5_Z[] = {
+    0xd7559fa9a7c5b70d, 0xd77e00d0d27d397a, 0x51325ed5195c7f19, 0x82b264ff643997bd, 0x299c63358fccf78e, 0x34cf724c4c362df1, 0xc02b1951cc3603f8, 0x5522624724163b74,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_A_WIN_5_XY[] = {
+    0x0000000000000269, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x9271ea7a4d82b411, 0x208fd58ecd7fc5ec, 0x1938a990e53fbfe6, 0x349f96764fd209ca,
+    0xc71c71c71c727752, 0x1c71c71c71c71c71, 0x71c71c71c71c71c7, 0xc71c71c71c71c71c,
+    0x720193a405880e87, 0x5bd70969015bd7d6, 0x00c3988f71054e7e, 0x2d15a14d8003ceaa,
+    0xbd6404096d94698d, 0xb9f78337541e1b28, 0xf97bd923c7a9867f, 0x2c6695a8fb6a8171,
+    0xe48de042cb04f17c, 0x501fcaa014b44834, 0xea31dac35fdc8628, 0x7c4ea3233852bb3c,
+    0x861bfe8ec14d5174, 0x29f545afeda32b6f, 0xd631b4700e07e306, 0x5d03dfa2fe2fa8f1,
+    0xce1146a597c52dd7, 0x9462e7eb99cf63b6, 0x4a0591a2353116e5, 0xaecc8b4586292f22,
+    0x4f8b3090e381c253, 0x6cb3beaa390b6151, 0x6fd2f6c74c6b4837, 0xff0a7931ba0ca69d,
+    0x421d097f458deea8, 0x00fb40a2d68714f5, 0xd4bccd5a2ff41724, 0x5854ba90e8a5d2f9,
+    0x4e13da44e658c566, 0x626bfce355c7c0e1, 0x372f4e7262fc00ce, 0xae526b6f275a9171,
+    0x5924ec0c88fe5ed6, 0x0b8cc67c58a8a158, 0x3dc73c8576a3476d, 0x29f3ce0eebcb779d,
+    0x22b6373960a27279, 0xab50632a553fa196, 0x2e0f74b438e8f476, 0x7c30db4dfd112cba,
+    0x48792ae9a5995b4d, 0xc60e609a40695008, 0x4a78e447deb15168, 0xe254922ee9655386,
+    0x37fe56a552b5e97a, 0xf1291e7e00ada563, 0x23dc8be1bcdbf050, 0x1b6346d28e05375e,
+    0x0fb8d35c87f9b04e, 0x96628216ef980205, 0xecec0036b7ae1006, 0x0e5170b43937166c,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_A_WIN_5_Z[] = {
+    0x0000000000000269, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_A_COMB_5_XY[] = {
+    0x0000000000000269, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x9271ea7a4d82b411, 0x208fd58ecd7fc5ec, 0x1938a990e53fbfe6, 0x349f96764fd209ca,
+    0x38a5d0827a309645, 0x0f890eda6c09b793, 0xe575f075bf0d38ed, 0xe328a9d88f06126e,
+    0x831ff3c365bbd60a, 0xcb28d2ce26fe38ea, 0xc0cac3c7f87f26fc, 0xf4ad1e363dc86152,
+    0xe5e7ec47a32a92dd, 0x6f0ebd138a77d767, 0xbc714f58947c4cf1, 0xe1fec25e81afe4df,
+    0x0a36d50a9d19d02b, 0xaec4a180873cc616, 0x2f0690b8f724fd2f, 0xa0ffbf096861f38d,
+    0x1b0b9e029fbde685, 0x12af08e72446185d, 0xd8454fa75cdead0b, 0x3dbba07a63c1b016,
+    0x11e3c7ae066823dd, 0x9c51dcb09de9e973, 0xe821d6b52d78c230, 0xff85bd15d2fda907,
+    0xef99cd02a2b53e47, 0x14b167b84b8802bd, 0xf35eb3212879ceea, 0x8dd8872b405ec33b,
+    0x4641196b8c5a51e2, 0x5ac38062f171b3b2, 0x8fc2b0f4a3e8cccd, 0x449dfd6438329121,
+    0xedaf9f0b0e1e474e, 0x003511c294192f05, 0x0069af047e4c377c, 0xafd4bacd6891e9ad,
+    0xcfd6197e6c7bf30e, 0x54c072aee683524e, 0x9fd1249b979e0695, 0x95a18584c71577cb,
+    0xe4be477764229115, 0xa8ddc010bd76e420, 0xabe5340598c0b7f5, 0xe1f20a4c370c6ba6,
+    0x9fef1d0fb534032f, 0x409ab8a5678eff69, 0x263050fd6c466162, 0x0cc6804fbb874ae9,
+    0x7b67d02c86b8939c, 0xce5201ac231444f1, 0x67e8648156ab9db5, 0x4475fcc70aec8c18,
+    0x17c4749565d53480, 0x2097f579515c19b3, 0x34d4cad385ed203a, 0xe36a625db1f3b906,
+    0x793e3c37a9702c3a, 0xb4c8999bac504dea, 0xf2e0b86cd3049047, 0xe57e813e9ecca5fa,
+    0xe1e08d35d38bd670, 0x1f590b5ac60ef70d, 0x4f46b1bcd953fab7, 0x3e6ee4026bf416a8,
+    0x8fe84261620062ea, 0x74c8e0a82328d4a7, 0xc2e00a12b8340873, 0xbdb02fed5f4ca228,
+    0x93fc5e04c0da4166, 0x963ac71a11c7cdde, 0xf2de67bf894bcb87, 0x89c2710f89945978,
+    0x5df3f1ba91260855, 0x717363b6f7394fbb, 0xd8f366710cbd76e9, 0x50b586a4357509f0,
+    0xe059ef2b1836e6ec, 0x3d1d6a5ad8d6bcd8, 0x75d42934e0fc0811, 0xf4f7a4ceef3c6a5d,
+    0x7fed6a05eb51d38e, 0xc8051891ca03e117, 0x5c13fe33cced8982, 0xeb440cf609bdf74d,
+    0x4cc7d982326bb557, 0xedfa6fd16130adb9, 0x4196b7a095b38c47, 0x430d1b40afb38aff,
+    0xddcb18539c72d9fc, 0x0bf32b8787418992, 0x08b14f5cc8ae05c6, 0xf8f6a342562bb04c,
+    0xacf3ab317958130a, 0xfba507858650bc30, 0xfa29024f29d3680e, 0xb70292f9d399ef79,
+    0x6162aedf7670dc38, 0xc0d643660388e3c2, 0x6dbd42e582578db9, 0x52562d0a8227f1bf,
+    0x62f0993380fb7a8d, 0x68476d65df54bb0c, 0xa8fd15070cd20896, 0xc368aac3d41fb2a5,
+    0x6f045ff387833c27, 0xf1e956d2245947c9, 0x66f3a11542473438, 0xb970166bf68d16a8,
+    0xf7b2a607be64c058, 0xfd4526d232c838a0, 0x5d365694f77d072d, 0x44ae42ffd8d8ec6e,
+    0x9e1df0066d00dc4e, 0xfd283177f53baab6, 0x27ee03abbce8e18f, 0x735c30c33c4899fb,
+    0xa82267a584d9690a, 0xcccdbbaeb523a11a, 0xc9b5799945e90fb8, 0xea782b20f4fd22ce,
+    0x0f1e82cca32244df, 0xb7c3e9ac3c3ec247, 0x59181fddd68e8727, 0xdf298caadc1fc521,
+    0xe907005dbcabc1e9, 0xafc16236163dc086, 0xd438c27867e88e00, 0xf9274575da828fad,
+    0x4a05c3b5e647dff2, 0x8ab0032ddea8240f, 0x5cc23e1e825b48b6, 0xfca146ec0d316f84,
+    0xe7f0424d979caf29, 0xdb8820c8624cf4f0, 0xbbf7e878c793b753, 0xc159de1ca48a7f09,
+    0x200feaed7dedade5, 0xffe0385c54bfec03, 0x4700d5f34d8048d1, 0xca628cfc9827987b,
+    0x1b4049da458b79f4, 0x5179ad2cd53c2098, 0x58194f8ac603ec3d, 0x73271d5f79311bfe,
+    0xfedd34d5b65d01cf, 0xb69398d11c529238, 0x00cec3dcce0d9910, 0xff90216643509eff,
+    0x5064b0846a264b82, 0xdcae5f443e64561d, 0xc79b78261a6a8daf, 0x5dfda8156382cebd,
+    0x511d3153101316c7, 0xbf4596f8db482b00, 0x3d5375d0894e7d3b, 0x76c9c9d49508bf93,
+    0x46c10f3abeba2911, 0x84ece522c2dcf732, 0xbcfa0ef027bffa03, 0x91f10c0bd487b239,
+    0x45d1bd7598cda911, 0x19192b547d7fb017, 0x2456bbe8e0a1a100, 0xe5bbabf563b90f01,
+    0xc743dcc97e07d3b7, 0xff1d7f0035186a96, 0xfbdf1b816dbbc4c7, 0xeec893b1a393181b,
+    0xb0f0261fac1e2f29, 0x21b5acd3ea592a26, 0x7df66b231fa62695, 0xb3b3149d57f526d9,
+    0x548c272af6996c7c, 0x3da9f9f536af1903, 0x9064f81b21aa26e1, 0x6a93c7de5ff13134,
+    0x1c617ee48195bfa3, 0x8d385ab29715964e, 0x5361a7afa2dcffa8, 0xcb4d7e861c07fba5,
+    0xf1a5e17b9c009a7f, 0xb20b063a7075a284, 0x7836cf40793b938f, 0x06cd2a8a5c3951d3,
+    0x933c24be19a8be46, 0xef3117d428ec55c3, 0x6c211c36780f071d, 0x078ab7c23a6054ee,
+    0x4cdf8cc2eac40413, 0x028860f0247054b4, 0x112ae78d8f36049e, 0x18c1c730b35ae41b,
+    0x185012f179427038, 0xa660e65d4db0abbb, 0x84589f0295350cbe, 0xae5a8144c3eaad8d,
+    0x86e07e16e768188c, 0x35648c6b932b7175, 0xca4be3a1fb843bc3, 0xa319965c7160afe1,
+    0x81a289535a531a81, 0x959375ec45071e59, 0x56808619f5b7e83f, 0xd8cf3b43e7c77a69,
+    0x280da463fc3426de, 0x1f828ea24dc45572, 0xbcbe2357b726f4e3, 0xd8a298bcd3aa3215,
+    0x75798304dd91c2a1, 0x57b172b1bd673636, 0x404bbb7671726618, 0x99a4bd44105765aa,
+    0x0fe6eefe73ac0103, 0x36ee0a828e97ddd2, 0x9e8f6bb9dc19c62b, 0xed4ab96d7e100608,
+    0x487ed6d43d965c94, 0x6e8b636584803317, 0x2970525b986a5fda, 0xe270b77442ac560b,
+    0x2a695ccb6adcd4fc, 0xf42497ef2965d398, 0x83694954fc855479, 0xaba2d2fc1cdcd7cf,
+    0xf60c9b59d97612d7, 0xaf9de291895c1862, 0xbd59376d0c133d02, 0x0490726dde555f9b,
+    0x0df2d62a84ae4402, 0x2c5a4bf799550b53, 0x2211a2d42f02e52d, 0x7053cc21db3b744c,
+    0x6d65add11ed07414, 0x885c4c2c41c67c45, 0xa574575427312d48, 0xbc1dcf09eca8016a,
+    0xe236ca348c7f9f08, 0x1804e7721265825a, 0x067fc9796d3a6b57, 0x3d4bea1139055801,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_A_COMB_5_Z[] = {
+    0x0000000000000269, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_B_WIN_5_XY[] = {
+    0xfffffffffffff367, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0xdddc64b3570c7410, 0xa7b0992513172887, 0x0c4e5c4c4b6382db, 0x2763db0f124768de,
+    0xcd3e57b68457d15d, 0xeb688f7fbea56e83, 0x235a123c6a13c5ce, 0x0cd7eb9d50f57a6d,
+    0xc0124e91544c1965, 0x4d9c172962afa35e, 0x0f92f2c30037c554, 0x1d8998680a3f2665,
+    0x9de4b21355f43eff, 0x2e110a425c9e63f5, 0x9350a9c31ce5a6df, 0x377cbf0ba332315e,
+    0x2805dd4820f0d1b5, 0x3b1975660f9723e5, 0xa1cca78c84b79937, 0x4f87bb1b94d5e03d,
+    0xe428fbfb5652c96f, 0x2e9a14d2d261bdd1, 0x082d82967453b76a, 0x61ea580e7ac87b02,
+    0xa0f8c2bacf368fdb, 0xdf093380d73b2a28, 0xfa0928b2ea8fe5d2, 0x77a674925f86d38a,
+    0xdffab41027670451, 0xebc3d0171200ad3a, 0xf68324f325f4f6c4, 0x4a24cd5f7d0eafd0,
+    0xf8fbd489d3f6bd1c, 0x0f6b56d567b473de, 0x6fb063decacf0d6b, 0x27f2e7e996dc574b,
+    0xa6a1064593937228, 0xab7550b4a9165bbb, 0xd682d4f1cb0edbe8, 0x2261fcec40e5ad8d,
+    0x9f2119c6ccbd4e18, 0x2fd094e9aab09697, 0x00331713e700929e, 0x6c5f2efe54338fe1,
+    0xd631401742fff78a, 0x38f23a912087e055, 0xe30e809c10ef1cac, 0x3bcb0a542432ff74,
+    0x2b4b5b97b31509e6, 0x117fe9d73e54af47, 0xe513c0be52f63aca, 0x41ed8adab1c80a6b,
+    0x61a31837e0a79fcd, 0x8f742b5751d3de38, 0x10635fcd41354b55, 0x61f30c61946510be,
+    0x9183d6776c416dac, 0x391b7b42345431cb, 0xe3d6f0847c254a8d, 0x777e1f6219d320d8,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_B_WIN_5_Z[] = {
+    0xfffffffffffff367, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_B_COMB_5_XY[] = {
+    0xfffffffffffff367, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0xdddc64b3570c7410, 0xa7b0992513172887, 0x0c4e5c4c4b6382db, 0x2763db0f124768de,
+    0x69d361a770d40373, 0x630d90a8e93941a9, 0x0ea4ecca20a73f5f, 0x4f3a3eca7b2ccb43,
+    0xe7006dae791eb098, 0xaf462930544cace7, 0x3c12389f87ed343c, 0x1e5646d82c48ca6f,
+    0x61847436ba057ea9, 0x3a55eb39bb892cb1, 0xdc8880604cbeb7de, 0x3698a658ae205fdd,
+    0x25eda914db64f874, 0xe2faf047c3ac622a, 0xf5445e9a5dccb1f0, 0x55ced73e9ac34e16,
+    0xa218560bdeffb56e, 0xd28a02c9b53d4014, 0xdba85bb5598c8750, 0x7aded651afdbfa51,
+    0x9bbbd14a498c6db0, 0x7f2ce1bd2ee11f18, 0xde039a39555211ee, 0x633da24fe8c3b27e,
+    0xb5f3e64a14f0307f, 0x8ce176716b8d7d16, 0x7c19171153edba7e, 0x4bb73fdb1fb53d41,
+    0x313936cb30c5915d, 0xdd04c973b3178471, 0xd0aed04902e4a848, 0x4e7c7318dd39ba33,
+    0x4319ffadb9112459, 0x4c76a270dc35f8f4, 0x32f54383ef738ba5, 0x6c0940eb407e2f8f,
+    0x2894edf79a23e3bd, 0x30dc75ab77bbfd74, 0x21f24ad437a6faa5, 0x7b24e2e556a53281,
+    0x776bbcf7950a108c, 0xb35f3f27bd4865c0, 0x1b0384a4907b84a9, 0x1f9a2fc73699639d,
+    0x8a005fdea1d3a67c, 0x7a5b43091836545d, 0x26618dcabd359d77, 0x65bece990f75adcf,
+    0x7d042bb3ef232c36, 0x2a1c7c638f53ae78, 0x7b742009ca6fe4ef, 0x7a4d07a3a66aaddd,
+    0xcd01ff7c532f6146, 0xf8a43ecb5d907bed, 0x8e3698a649cb40e4, 0x051f5451980251b7,
+    0xb673fe4705fb7f5e, 0xddb52f0eb6c8b08b, 0x333d9bbbddcaed0a, 0x6966b1756b6a553e,
+    0x75ced787675f4e5d, 0x4747e76d6ffa1c83, 0x1bcf939668d2704a, 0x35612378ffec89d6,
+    0x6cbf3d92a4963f70, 0x6b1c272b00398dff, 0x7ffc6e1e608aeef6, 0x3fa3aaf0dfd0f446,
+    0xf89d2fd7050acd13, 0x1f77e7798b708c71, 0xf70b0811bae00b61, 0x09b886e45742fe00,
+    0xfdf104c8af7cd9ee, 0xcae17cae5d9c4fa2, 0xde23f37306df239e, 0x22d9619c3f8a3b6b,
+    0x89768b309c42deb3, 0x4624f910e93507b4, 0x2f970a19ff87fe33, 0x1a18e0bca1e77040,
+    0x4f30a8356c406854, 0x9f219adfa3b89482, 0x9c3d0cf93b43e82f, 0x6c5be08192df8f5d,
+    0xb54a3d2fc32a5d5b, 0x3f2c6439e5b539de, 0xc9aea7d510c4ade6, 0x0bfa2e824bcbbf71,
+    0x7020a1b063c656f4, 0x9ed969ea316fb9a1, 0x5e4c63384763d8d3, 0x0a7e89dd2c57c8df,
+    0x3350c2f3f61d7a90, 0x36039bcdfd941ee9, 0xc7ff5f2865a5f46b, 0x3088772bef969c3b,
+    0x06269332492db708, 0xda10a52ee397db52, 0x7468c58c8ad47951, 0x70d0490d5f437b24,
+    0x7af592ffad57a88a, 0x66339b853e70dece, 0x28053c0125158a1d, 0x3cb635d82cfaba5d,
+    0x8be0dde77ff122a3, 0xbfc6ac63591dbdeb, 0xab07c3b271eb6fb6, 0x32adc924c63d61a6,
+    0xd085955a4ead0d69, 0xef3d9e02bc97fbce, 0x23d7aefadc1a8941, 0x55075d3715451199,
+    0xa81dd90d7d825726, 0x2299312a6b54ce39, 0xc4c86e7e1236c660, 0x4d90fd22143a1d14,
+    0x807f71a18cd05ffd, 0xca04110d5a124ec0, 0x036518c01d1895bd, 0x472314073356c960,
+    0xfb142927539a1538, 0x7d33c4f54dde8d3d, 0x213a4a0f0c13a8e9, 0x4ab2a38e2c38cab3,
+    0xee238da0e9618932, 0xa9a830821da4639f, 0x3b4cfb5a8f9081ec, 0x33eb71406fb360db,
+    0x6fa8d51df88a10d7, 0xa5f94409387e585d, 0x22565f3825bf9d75, 0x35403658f6c91674,
+    0x04576313ce5a0e1d, 0x3d73a2a350b3dc5b, 0x6f0cc6ca0e1f2412, 0x67e5d3e3b253df32,
+    0x57f3bc6c49f6f10e, 0x1191c4be9151565c, 0x11e483734a23c450, 0x378b5ba4ed4e697e,
+    0xcae67d0f46a74b5b, 0x47486a23d03dcbef, 0x64537174d33fbc15, 0x38637a9b42f85340,
+    0x3a8be6a96e21e52d, 0xe1bd96bf02a86d37, 0xb3982af6c42a8abb, 0x0ace91574764afc6,
+    0x042d1e1233715e12, 0x100e76d37db7eaeb, 0x682716d88b22e69a, 0x4ea61ef8c147f1d4,
+    0x26c794e20c170a3d, 0x95b49fd3fef13e12, 0x235675ddee9cd4c1, 0x0c1b855cdbb05301,
+    0xb4e91f9bd0dbb4a2, 0xeeb6433d1838ee4f, 0x9aedb4a13a7fa4dd, 0x54f510058658e2b2,
+    0x0877c2b5f381af91, 0x185b1b683fa5a0bd, 0x3baa51cf3e9cec4c, 0x23cc766ed3587c90,
+    0x786d9b4b1f2bb2b6, 0x003c7f61bf4e4c78, 0x1b5ece53f951d13e, 0x78d7b3ac608c46c8,
+    0xe29660a48425d0b2, 0xaa6929dfd36196f0, 0x5bd6a513e08d842e, 0x01127d83a54de440,
+    0x0d978f79ccd50ea4, 0xdf83077e4d662d77, 0x320d86a2af8dfd9d, 0x203cdea49a601989,
+    0xa36edd245af4539c, 0xb6d4681e15e0192f, 0x3a916404db86effc, 0x7fe14a98fcfae158,
+    0x50eec3b7b5c24cc9, 0xfcea12d0c537c3e6, 0xfb22b8ce72a7e725, 0x1f8c06c11825d283,
+    0xe05fbd8feb9d10a7, 0xe75f4e8db9381cab, 0xdc2bf3ae8c9a5b13, 0x5f11f919b89d066c,
+    0x3cddf48895e1081f, 0x99e9ad254a2939d8, 0x82b954b410e096c6, 0x10e4db39e139cf02,
+    0x89370e2e54804a24, 0x6b82daf6f47616ea, 0xc8318cc60512325a, 0x3f1f32b641fbf8d1,
+    0x6194d51385043458, 0xea89f051a68d0896, 0x82b68b10b16fe6a7, 0x0a8e88dbbdf0f6e1,
+    0x346d66e1fa9ae451, 0x8d3851c4e8fb2f04, 0x0f5eee816a166eed, 0x31b982e64bc1580e,
+    0x4bf8d64255fb5aea, 0xb13602de941e06de, 0x808e038ddde28b2e, 0x29da6792651a0319,
+    0x50ebd4028a2d3d7f, 0x0b8c96771624644b, 0x0a527472a2919135, 0x63f8a5f652783c43,
+    0x8a5264992077a230, 0xe4f48ca01981f555, 0x21a15d06c930668f, 0x1850b6855cf3efce,
+    0x866addb4f5b9d396, 0x39b8ccd5f0915ceb, 0xca24913269cbe18c, 0x161b014d2361c6ab,
+    0x9a48fdf600aa1640, 0x585b446f2247c1b7, 0x3cc9af12e3f43d99, 0x709ebdbe02c0590b,
+    0x4d3f184afb352042, 0xb5d473f10e2f0f47, 0x06eebc00c3d7eecd, 0x0a96eea212e4a691,
+    0x5bfd9b1da90df5d0, 0x13f37a0d189d75a5, 0x57c8f503caadd9ed, 0x19a4597da8f35bba,
+    0xec4184039c9a81f4, 0xdb3357fdff66f05e, 0xecbe1ef60d6c107f, 0x3d464278b238976e,
+    0x2c28827b6d89d1d9, 0x5a67e4210c8494a9, 0x808654673f49eecc, 0x52dc064905b7f242,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_B_COMB_5_Z[] = {
+    0xfffffffffffff367, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_C_WIN_5_XY[] = {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xd082e00700254f12, 0xc5ba8184eb1f1421, 0x4ec9e7d0f010780d, 0x7846b5b72794c8d5,
+    0x870fb0417225a595, 0x6cafae705fd57f04, 0xfec1c2ac2e7db9ba, 0x9230823e127a5862,
+    0xf6cfdb6de4464836, 0x3d79631b9a945ac0, 0xa1fcf2df3d0c880d, 0x17c83e500ee6a611,
+    0x3c79c11ae42734fd, 0x1614b2beac4040c3, 0xdd1437252c3a23a5, 0x1a02da838af4f7cd,
+    0x23d588d6e7d6991a, 0x5f332676d2b3e364, 0x353826809134ba88, 0x08eca826d27090e5,
+    0x231f8dc826761106, 0x7363050e3d78b14b, 0xc3b9a1b8c05c4381, 0x29727635b8acd9ac,
+    0xdd416ae92ed54e6c, 0x546084350b48a87c, 0x2c8deea497093d22, 0x87d2924c0d716baf,
+    0x43281d30619206d6, 0x4a8ffc8768744e44, 0xb1011a3d708208d5, 0x2fe86e7ba035b0b9,
+    0x82f43088a3762860, 0x67b5a303b33595d4, 0x262f16ebb477becd, 0x1d38d4a723e2816a,
+    0x91bba3c0ad83c032, 0x7dbc2eb6234f2ff3, 0xe2c00c156d18a737, 0x71d1ae8bccf6dc2d,
+    0x6183816a2db77239, 0xc545a5120e228c41, 0x3b96d6bc0f49a679, 0x9831d683e49e39c2,
+    0xeeaa17a920da13d9, 0xee3130fb8abecade, 0xbfb2ce6aa6e3d089, 0x22bcdceee627a07c,
+    0x86d7a50c955a1d9e, 0xcd60a425e4e00b9e, 0x5407a6f8615b9e91, 0x7f17b1714f1ca93d,
+    0xbc351de00db59f2c, 0x1470e6a19cdaf8af, 0x461ed28960d3b27a, 0x122c8f4b49c7f789,
+    0xab56e614069fc8ce, 0x9836b010c34e487c, 0x9ee067033fe009eb, 0x88c8dc64aa019563,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_C_WIN_5_Z[] = {
+    0x86670846fdd28a65, 0x307b9179876fae2c, 0x54e137a194be3755, 0x64609fa0a57a7ef8,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_C_COMB_5_XY[] = {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xd082e00700254f12, 0xc5ba8184eb1f1421, 0x4ec9e7d0f010780d, 0x7846b5b72794c8d5,
+    0xefdf66bedc3b2392, 0x467829445e67b0c7, 0xca02ad84902d9344, 0x2c322569685023f9,
+    0xaa97b6d01d12e38d, 0xdb03b844066152b7, 0x72e16976957c527a, 0x373068482ece41c3,
+    0x2d83b719f275e029, 0xa6ca1bf1ae743e06, 0x6e0a2709c7597eb1, 0x18762be26ef955ab,
+    0x5cf0d379a93d074b, 0xca0b6c045b6b88b1, 0x5deac65050b35358, 0x91ff6459bd7d90cc,
+    0x02c86350258b1218, 0x33093fc699f84764, 0x2078c8add4e81f0b, 0x3e7d325923d1d991,
+    0x6615b3d23432229b, 0x612defe2f412efb3, 0x4525c08b0f2c93f8, 0x5a33aa89c9c068cf,
+    0x3e68a5ae1776231a, 0xa2f6ec8a2ce2a440, 0xdaa005a08a61760a, 0x3e3056485e2d610e,
+    0x50d6a5c32afdb856, 0x8b19d80ed7ab3f90, 0xe3189eac1ea8624d, 0x912a323ee4f13efd,
+    0xd153839175fcf86c, 0xde9453ee8848449a, 0x3062406215b92903, 0x48bee65be5e45f55,
+    0x2ea9544c011384de, 0x867c91ae6e52ca89, 0x273ee9e0c27091a5, 0x46839ff414ef58a6,
+    0x379f244ae38dbfb3, 0xcacdbba352b7699f, 0x94ebc174117a0586, 0x813cc013be2659e7,
+    0xc020b9ddc862b53b, 0x2a3349be4da6821f, 0xca241c82555a6dc1, 0x0bfa5959667e9775,
+    0x053bb63c12fa627e, 0xf903bff36c192c07, 0x4b82248240c9502d, 0x43624db4cc5fb488,
+    0x3f169c5f3baa97d7, 0x0f03e79333e6fdf6, 0x28452bc400ed6654, 0x395fcec09d50a2e8,
+    0xd020e3d006d07099, 0x4aa09374bd9112da, 0x7848b18d805ec6ea, 0x66c165d019f099bb,
+    0xb308cfe706ef6c90, 0xa029671b8f07c121, 0xd0d46db1af16b606, 0x4f7fff7467a53aec,
+    0xc816296256da5a07, 0xd8b235eb70b92cdf, 0x0d6736de9b0e4e6f, 0x39c3a98550c21629,
+    0x3aa52b48fb4f900d, 0x80c129c136a0e2c3, 0x6dfa2db57dfb0bab, 0x5fb327a920178906,
+    0xf4e6c79534bdaa13, 0x6a7191ef36e48920, 0xb3bcd30babfe3638, 0x104242f20a05949c,
+    0x09a46d07584c3bab, 0x8ab1119ee7fcd5b4, 0x84b383f434d90f44, 0x834adc18e95ff475,
+    0x1acee803a0cf1b46, 0x0594f496ae5c84fc, 0x481a58434cf15e24, 0x57cd8b8c7c4a2e25,
+    0xb5723d1b07e8692a, 0x5e19f81913249a74, 0x97aea5cedecd07b6, 0x93673348481c2a03,
+    0x3b95e56ce8237a9c, 0xa6593765f5b7922f, 0x37ee3bef3d641abb, 0x09cfe15474071ed6,
+    0xcc82288ee17d27a6, 0x1077e46e7bb0f433, 0xfd35ee93847c9324, 0x36c055e61c5603c5,
+    0x50f93c7e8bcb6e7b, 0x14f55c3519793672, 0x9abfe36cad9a897b, 0x471c3e5933e9bb58,
+    0x993e3773366d4762, 0xa946dea94ac7e33f, 0x6f98bc888e2c2ecb, 0x308af3c388d355c1,
+    0x4edead350af98d5f, 0x72fccb51e3d05b3b, 0x905f1f29b27f47fa, 0x676f68bc79d8798f,
+    0xbdbcf35fa60d7810, 0xc822556700f14a88, 0x46564c2ea264a048, 0x6ad8bf3a722dc6cf,
+    0x98849cf17f216524, 0xb17fc16b64617fa4, 0xe8c85038697df23f, 0x2e9ecb3286ac5c06,
+    0x5d3908d4f05a7005, 0x6c48e7a441891703, 0x0829964a21d31030, 0x79f2cbb5664a82c1,
+    0x79eaa02217b56791, 0xc5ba0cd98c115028, 0x2767a948566815bb, 0x9331648f812e2b5f,
+    0x96df1fd925afce95, 0xc6466da1ea6b9289, 0xb9a8ccb8ea32d278, 0x7c74e580033f1a95,
+    0x76aa8e238ff949f6, 0x6bafdca0945fbe74, 0xb265e7c6327c98a8, 0x344e70a7e5b7a616,
+    0xb79f5bd2d786ccfb, 0x5eacd88aa6f2b350, 0x2580ac2da241e4e9, 0x4afac7b9a624e6f0,
+    0xd04474d2ce2a45a9, 0x28c9f6c97a1d65c7, 0xaac352d95beab25f, 0x42b1e18ccb0ed725,
+    0xa94846ec8371fac7, 0x7f2c48a050d3b6bc, 0xf3712f8b853f8afe, 0x810171d4967c4fd5,
+    0x0bd66988ec9fcb0b, 0x519b9308b62bab4c, 0xc2e038c030613a9b, 0x4a62e97ffd536cd4,
+    0x8fb0de1d99443958, 0x5ae796c0c7ce134b, 0xb41a57fcbdb8901e, 0x81da1fbdd74d01a8,
+    0x9a2458f012359d7e, 0x3d286b48d913020f, 0x2b57638a1c4fbc56, 0x3b63fcea0cfa6fef,
+    0x311d1f4742088b2a, 0xcf183dbb5dad75aa, 0x06d44b27f52bde06, 0x3219ef138582f1a3,
+    0x72a5beaf072a84f7, 0x2857c09d9963fbd4, 0x16d2b2a8f874a9f8, 0x209ff185aba81737,
+    0x2319a3a16104b265, 0x07278aa6a5e7af64, 0xc7553d337032acfe, 0x20f300c032dfb3c1,
+    0x0582d216f5047b3c, 0x622ff16427356db8, 0xab7f7d4b1b6ffb3d, 0x5f633cb465fe7346,
+    0x2f1ce611f34ac25a, 0x61e1d778b7e5f021, 0xd46ecdcbcf0c323b, 0x950c4fbaafe72918,
+    0xaebb2bc71b5a7db8, 0xea35ad866ffae01d, 0x330c3fd9533ea16d, 0x5cc11534957b1e1c,
+    0x5d401fd1c61fc953, 0x0ac78381afed35e4, 0x2d5c38391b223105, 0x7df1d274e6f7d2c9,
+    0x71a16aae1df8f063, 0x0f508c2ee7cceb41, 0x32bc917a9ea7f0d0, 0x54c79a73f40da799,
+    0x81449d422e7ed41f, 0x4a598bdb134a8059, 0x20e98cd286531a59, 0x796b2a18a374da48,
+    0x2437152b16336bab, 0x4ff2cbde834c8a66, 0x22c5446c47dfc779, 0x180d91bd23187695,
+    0x05c72a85650b1fe4, 0x04ecf08f3c1a6e86, 0x99f78ceec56df514, 0x3033ffa1fc74c966,
+    0x4efe767e6853edb9, 0x021a4354e04711a5, 0x53058e5f86effe77, 0x63a2474e72df1ddb,
+    0xcf9297d9f4c042a4, 0xa27e003a12e6338e, 0x51e418ab2f78b94d, 0x83c7609671b9de5d,
+    0x98591ccdb5889fb0, 0xb81971e2f72120d6, 0x218ae179b87a635a, 0x1b39eef4c3eb1605,
+    0x3a2c8ceab748daba, 0x35423e1936a99de7, 0xd5f62eaf9c865413, 0x2990388c1c7e119f,
+    0xf07f4c5334678bf8, 0xbe66b4c3cf8b0882, 0xd6f19a6304773113, 0x9687ae2193545c48,
+    0x806c874e804aa93f, 0xb64dc0e614006a19, 0x3c665ad7931c5527, 0x1a5ec8c5b8e535d8,
+    0x6c197106f2131608, 0x1715166a66ea1fb7, 0x4851c9ef57287059, 0x536c5e0e6dd7a508,
+    0x30eba5ec65efabfe, 0xf1c42780a2a2da86, 0x23e1aaaf1cc69640, 0x401f6dcc8310fd33,
+    0x4cf04645f1953342, 0x6cb8fb94a5884cdb, 0xf61d62e78a80a6d9, 0x1b1157e8b9dde684,
+    0xedf72df6775e2808, 0x47b2a9ff342b0269, 0x0e282a2504f69052, 0x40a4e020d205d2a0,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_C_COMB_5_Z[] = {
+    0x86670846fdd28a65, 0x307b9179876fae2c, 0x54e137a194be3755, 0x64609fa0a57a7ef8,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_A_WIN_5_XY[] = {
+    0x00000000000006ab, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xf0ef44e972ca9068, 0xdb1d62d6a9ef2729, 0x9b0da4dc9f7c7ffd, 0xd83c1cff65ca0c69, 0x9c60781a47aeec48, 0xaf2d843b6526c102, 0x33317add0d67d100, 0x15791bb84e1893fc,
+    0xda8d7c3d6063e093, 0x4abab48e4b628396, 0xed1c39ecee092137, 0xbee77d1e8adacabb, 0xb2f6248c84775253, 0xaf29eb80d9818e0c, 0xcc28b9c8bca416e4, 0x1002569d86af8fa0,
+    0xd05bec4143a8157c, 0x8efdb2637b2d4077, 0xe795b67d8ae01dec, 0x9f810ff4a451ef87, 0x6b18ba78e8209c02, 0xe72f8be806e940f2, 0x2aeecdb216e95817, 0xf0013592c28125b2,
+    0xb0f236a7de8c2be7, 0xf857f4bb674c1334, 0x1f87c0b378b35460, 0x6a6b7365c0e247c3, 0xb1e8080f7b8f9530, 0xaa726a4e9d6f5699, 0xb4c99a7e435e98cb, 0x59da89e9c76a8624,
+    0x0c627687be1d3ec2, 0xe75a1660eda25aaa, 0x932455259cde4252, 0xd2684601129cd9e8, 0xf43e6e0fa3dccaf5, 0x0f40473ddda46e1a, 0xd79eff8c12bcbc6b, 0x956f385c426410ed,
+    0x6a64359192856953, 0x9973b183295766a6, 0x94a2987dd36d855e, 0x01a95b03f26fa696, 0xfb4799961ccfd9f4, 0xeec024b3bd2234a6, 0x8717c0b41544cd2e, 0xb6afef16d3fd8c2a,
+    0x490166477ce14c64, 0x11e08cebef40593c, 0xb1a31cad342e8b40, 0x796cadd8eba4a815, 0xe7084b709ebc5649, 0x1f4ead1c43cf274f, 0x870a722f0b6afd1c, 0xa8bc38878a8a9ef3,
+    0xee915fdb759cae33, 0xc4a196a6032b0e93, 0x108d03f1f65a8521, 0x1cecd865470bc7e1, 0x026fc3c74defb500, 0x4d5747b7b2517769, 0xe116bdb9d3d4f1e0, 0xf8de51de4a40d4d6,
+    0xcee12f6c5bc6949b, 0xa58cee503ba49592, 0x9a936b10ea4bd917, 0xfbdc161594f4ca15, 0xbbd68446f857d49a, 0xeb61e4cacddeb8c0, 0xac17a3f0cc6a3093, 0xb1997812254a7471,
+    0xedd8341a9a0a2d06, 0x06b5a376633c46d3, 0x71c45eab58fe2259, 0xb91b776624e860ba, 0x48c21c27439adf7b, 0xe8e76e1ac14e55ad, 0xfacd18dc9640fe98, 0xa033f1f69a177905,
+    0x7c07068e9c2b9e30, 0x76d5ca19341693dc, 0xf9face5cc77e23f2, 0x7d2321868e916013, 0x5ed7f249aa08cf52, 0xe242352c1105ba27, 0x84afbb05458a1967, 0xf3ad0c0d480e7ff7,
+    0x89d4c1256cd0cf83, 0xe17ae4632176bd92, 0x7676aad3c74d1186, 0xaebcdd44b7e50b2c, 0x9a435eab9d3815af, 0xd801c9c6d80a3760, 0x30fc4f9e7a4069fa, 0x613e987c3a707741,
+    0x06f98dd365b08c65, 0x841e0f2a7b50e31f, 0x9248b38b2963f93e, 0xc2dd522a5e142e39, 0x7ab1f54b6691f477, 0xdd7d26cd4e9ab5ac, 0xfb9d6ef1f342c47b, 0x6a0f237fbb6689a5,
+    0xdbbc0ba0e4c5ac30, 0x1f5b15998153fc58, 0x0707ecf951ebb919, 0x1dde86ae5819147c, 0xc0ba4a5cd92f5d84, 0x515518365db4f003, 0x02844300b3d91959, 0x3812aaa58794a77d,
+    0xb7a0e694ac438fb6, 0xa33f386c030b0ff4, 0x0bfef983b066dfe7, 0x106f56cf030660e8, 0xa0c18bf254cef7fa, 0x6b9e1435db7ab154, 0x2398a98f12f2676e, 0x7bd3f22dbdbcc3e3,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_A_WIN_5_Z[] = {
+    0x0000000000000239, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_A_COMB_5_XY[] = {
+    0x00000000000006ab, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0xf0ef44e972ca9068, 0xdb1d62d6a9ef2729, 0x9b0da4dc9f7c7ffd, 0xd83c1cff65ca0c69, 0x9c60781a47aeec48, 0xaf2d843b6526c102, 0x33317add0d67d100, 0x15791bb84e1893fc,
+    0x73d54df67bb086b7, 0x8fee49200b252fc2, 0xdb0ee03d7bafbc9c, 0x224759dd7c2ef7d0, 0x34d09994afb47ac3, 0x092543e2193f2ead, 0xd30ace54164eaeb5, 0x3d036f501700cad0,
+    0x13df88d11854ef2e, 0x67e1a116c2f0bca7, 0x8be3b44e80aced1f, 0x4b68a1525a6f3946, 0xa1b2e60929f57fda, 0x5baf33f2aaf4598d, 0x9b3160dd145b5aae, 0xae17647553b7e1b7,
+    0xc28c7e0772b4eb29, 0x8e86c423084a5aa2, 0xc10817b9f0810c14, 0xfdfa95d8794d19a8, 0xeefc07cfa74a5ecf, 0xab4961db0f72c819, 0x7a11d42f9a8c1e29, 0xb97e419093050fc4,
+    0xba5a06c0bde08382, 0x166cc5e3409c6bfd, 0x6aa46ef3882b108a, 0x3c74897904119b58, 0xcbe7ef11398f4848, 0x676b5c77c7e128c1, 0x9f760ee7af7a0ee3, 0x36a83666564277b4,
+    0xd8481ff308a7bf23, 0x8b07edfcb78472a4, 0x474a0bb093ac8322, 0x38d3c1a94abf18a9, 0x7f5471cc6d30afd2, 0x5c8452f93c1c4ff3, 0x57106c40e360291b, 0xe4f905fce8fe9178,
+    0x7391c922a3a331dd, 0xc17d67ff0b2132bd, 0x97cb90edd88e89b2, 0xd183baedd84709e3, 0xbf5b274581153652, 0x6c05f9930dce2b98, 0xc0ba6892e46057cd, 0xda441ab66ac6720e,
+    0x5cbbfa4877a56816, 0xaa9092fddb4c4cf4, 0x10fb2e7a2f7a737b, 0x1f86980befc6a839, 0xd18441e32fc41d99, 0x2c90411bc2d18e48, 0xd33482a038a8a587, 0xeec97b8e6c98fe3d,
+    0x236cc44c9bf5f3f9, 0xa446582839ab2eae, 0xc5e80cd4c838fae6, 0xb79678dfa0811857, 0x426a96479287cad1, 0x22984dd345a416fd, 0x56c2f981d43e1bf0, 0xdac4b7cb5cdfad18,
+    0x75f8543a5f5b96a9, 0xeb1412fa0ec77fed, 0x494841f9ae4492b1, 0xcc702411246c81cb, 0x51738706b5a59efe, 0x928d7e7c5f757c30, 0x8efbda9d34a58ceb, 0x993d0d40cfa8db13,
+    0x2aa21ae41da6e038, 0xe1db18bcb5a5529b, 0x28b2175fb9eaad44, 0x447d715c48fec6a9, 0x57b5bd3220a791c4, 0xbd1f010d5d66ea22, 0x378a625d14f31956, 0xb8f7f752808327a3,
+    0x12235429d1b1b92b, 0xacba08f509a9a0e2, 0x7d90ac1e04dd799f, 0x0df33378d312cefa, 0x69b3285700accc37, 0xba980a4eaeebc75f, 0x6e67753f589edcb7, 0xdd7c90657ae5b88d,
+    0xdc67c47ad0b733c0, 0x680ece55678a39cd, 0x2cfc150acccc54bc, 0x22493b280eb085bf, 0xdc16dc42dd24a533, 0xb1b371a41d298620, 0x94b3517f5d399628, 0x1cd4d7e8e3d78652,
+    0xc4799df1d67ef868, 0x2072f65cc6b574a9, 0xfa9313bbd02f4202, 0x0211a91da13ef848, 0xc1dcd1196face3c3, 0xbb5aa8f8a1fb3c36, 0x4c5d12b96a8dba59, 0x2d2da2d5c3bc2222,
+    0x39b504676a722c4b, 0x6cffc3ba4dd0a19b, 0xd7ae18798f095882, 0xd1d456901d50872c, 0xae35b7e795b99d58, 0x90fe3eda80f39600, 0xf63479e679e0e3f3, 0x3f60c60264c4ec5d,
+    0x567ed299b9264baa, 0xbddf0dcda9afbec8, 0x0568f6ea042297b2, 0xf78d70fa3eed1dba, 0x4616b7711f69ef4e, 0xa0287d357d92969e, 0x01dc15eecf96d582, 0xd42b05ce781f0ce5,
+    0x5b360060b930ab36, 0x133b64c46fd5a79c, 0x001462387897a5b1, 0x0acc4b6452721916, 0x81704f238476c3c5, 0x59a8a1cf188b57f6, 0x11cd5c87fbdc608a, 0x1b687c1fe5aa8695,
+    0xc0f15ee1936d7e96, 0x372af1f5a466ed82, 0xf7f5dd1f37549ebf, 0xf1eda04af2c5c48a, 0x83122aa8c2ebd800, 0xe16448454b400416, 0x047ce4fa4962af31, 0x506886f6191933c4,
+    0xbe54b6704392c2d5, 0x2fcd5224beaea70e, 0xa54ceea291d550d9, 0xd48366c1ff9815d2, 0x31634b3c3153b8f3, 0xd843bd7fcd883de0, 0x53967e71327787f3, 0xd31e29ed37c9167a,
+    0x6c11181bfc82d637, 0xba612a460176da9a, 0xc5ee3e3a69699099, 0x0bd98720bbd4260b, 0xdecb30efc928cdf6, 0x39432eed0ea36782, 0xdfda42fb607cc89c, 0x86ddbb8e5caad069,
+    0x6e6d5eba8487bc08, 0xa32965484be44558, 0x486cc2672cb6e533, 0x668d0d0567e57882, 0xb174b6246be0421f, 0x9f1523ee852f9ade, 0xc2b55de9f7e56ec3, 0xe48304c78932cbb1,
+    0x99294a4deec44a96, 0xf77cae2a9ef9b5b7, 0xf0e4a4224c358138, 0x5e941d50cd833de3, 0xe82849af29f9832b, 0xf5f5bed7c94ae6c1, 0xe5bbc038906e379d, 0x2ef11b5522e4b6b6,
+    0xc5e6904dda1b6430, 0x8eed3e64ec3fb643, 0xd3025a686f13ec3d, 0xdada918614d0b4ab, 0x6ea3377ded31315e, 0x4b37e662c9412aaa, 0xcdb833d39acb0ce9, 0x27d80fd0168f8021,
+    0x9538b2fb818d3a1c, 0x990b486f1fc298f9, 0x02d370a47cfda702, 0xdbc07450a0cc871c, 0xc142229cbd7e0a16, 0xea654923aeb1eab5, 0x04f8193ae72401b8, 0xdce520675e2a34d0,
+    0x56af3c91d4493b76, 0xc6a401ee3c955af3, 0x6593536a8e5023d6, 0x1ca1ac09665b59db, 0x1f9eec8f6d52dc94, 0xa9e9af0b954fa668, 0x8ad8046006d057c4, 0xfbdd3a827b01bd7a,
+    0xea32fa7f56fe56c6, 0xd24b3984475c6a3a, 0x0ab050e30b01b7af, 0x68c6f8b514709cf1, 0x471240e07e5f364f, 0xaa1c70c6cdb02340, 0xa1c294f79c4ca66c, 0x5952554c2df9bea5,
+    0x303187ab10cc4532, 0x6375787fabecfa0e, 0xf94dd53791e5c2e9, 0x81fbca8aead95ab0, 0x2dc0eb813be76865, 0x114b8b4f0ba39d96, 0x71d951c49f425dda, 0x2534bbd357bb19d1,
+    0x87b7d8505adb3a43, 0xff0c554967761f70, 0x857f4dd4d0bdea70, 0xaa0e9d54fe798e9b, 0x830834d02fb1a78b, 0xf73f5ffb0153aaf4, 0xede20c2330525bce, 0x2580b4af3450c5a9,
+    0x1008d78f20895db1, 0xb747969bb91a775c, 0xe51b62634ec6b793, 0xced144dcb6a1da64, 0xb1442e353ab2e8e3, 0x49726fe10e972927, 0x964017652410ac09, 0x9aef79ae4dc47980,
+    0x1c5f385a3414a6bd, 0x2be9d65a03e412f0, 0xf4b2126a35b74e25, 0x557e51d58844c052, 0x36d39a0b57b0acd7, 0x384fd396f4024add, 0x9dc195d3f7ab58cb, 0xb4eef51c6ac374cc,
+    0x974944695ce2abc4, 0xb50f500b792152dc, 0xb599a40493535306, 0x5b8b4f0ea6319617, 0xdfda6dc7ca7be144, 0xe9eac9676861916b, 0x7c1a745da3a26193, 0xa2cf98b4fd4f18b2,
+    0x6fbbf34a1f61c041, 0xffcb5dccdf8a7409, 0xb054215b6c32e823, 0xcdd19531049e05e2, 0xd9292ce0dbb7f4d6, 0x320dc27f9cb2333a, 0x9663f43b7fd536a4, 0xcd7db946f6405fd5,
+    0xc56f0d55d656d168, 0x37a657cb893fec1e, 0xd088b5746b18a8a4, 0xb8ed85c0140c1ab0, 0xe4c1f9df0c4ab51d, 0x0f8fff8e31df77c9, 0xd027ac87634cf2f7, 0xfae7b852a258eece,
+    0x50350ed153b300f3, 0x45e81d0e8d9b328c, 0x7e36e1205a112455, 0x4cdfb3a0b1df5a7a, 0x56853bb009e10179, 0x91c69bfc168e2043, 0xb823103d63cc9a39, 0x1d5f699631f19e06,
+    0xaa62b23eb50337a6, 0x99f90f499d7be36d, 0x92266a928e8ceaed, 0x0080f208499ca1da, 0x36308ce483673d08, 0x3b9437de4320d7e4, 0x092f8a19acf2bfe3, 0x1421796b43f8b2bb,
+    0x0dd90ecd75bf436a, 0xa796856e88fee830, 0x02fae39f03b5a577, 0x224abae756e274d1, 0x70aaa4c608c7c31e, 0x323a3462fa8a335c, 0x78a985332e2ba9ae, 0xe3d26fcd1dbba9aa,
+    0xd89cf0726e0b088b, 0xaf1d9e3989dbfe28, 0x6a48f20bdb2bc392, 0x3490b9580ee79991, 0x148aa63323e0c76f, 0x5233bcda8aa5e4f2, 0x73e998e0dcf5a9cb, 0x8810f9daa4ae7155,
+    0x5e4fc718efa6a027, 0x5bf3d6f1a89cb3ed, 0xcc2e421d06ce8ec8, 0x34c9568970aaaeef, 0x7240838c4f2aeabb, 0x16239f51a9787618, 0x9f76262faacdac5d, 0x879d9e01fe5cbdab,
+    0x3dff69dbbec78d71, 0x2067287beff7b52b, 0x149273dff465c928, 0xb154b43539403db4, 0x5c7b12b473f1e9ee, 0x403834492f23e791, 0x0e21cb40e8873e46, 0x177bbc72339a78ba,
+    0x6d01e3658710e6a7, 0x8bd508a7065fb9f9, 0xe4131dc1c9e59c1f, 0x01ccb62fd68f11c7, 0x2edc4cb8e9204080, 0x81030ddad1df32ec, 0x5ba4f07c360ae7f0, 0xab4f7e92a40de197,
+    0x84c6fae772f0f1ab, 0x3be85b09aafc23e2, 0xded71217f8e82179, 0xa919ae027334eee2, 0x6f99d7bf7762ef26, 0x56090c75e538c4cd, 0xdaf573096da65261, 0x00ee5ab67e9ce882,
+    0xee7d79af4bbd4d4f, 0xa41cd4db4442ab0d, 0x56ff0847b662ac0f, 0xb5d0f59258763e55, 0x013b0ce19301f5dd, 0x43e0f477b9599a40, 0xbd69f2d3212f5eaa, 0xe03e399dce78a5b3,
+    0x306c2d5aba9b56fc, 0x14d096235d434f6f, 0xfa246eaa6f341042, 0xa4c9daee67a76db1, 0x87fb8cdbc22b912e, 0xb67c5cc0630a4aba, 0xb06f6de30503da27, 0x0d2fb90263e0870a,
+    0xbab6a66df3d7d8fc, 0xdb48ffe42d56d070, 0x1c5c598fce976933, 0xcef1d93d95d03193, 0x08d906d37fd9542d, 0xf78e1322a1b24d2d, 0x084759ca2d121176, 0x0576136f8a73f538,
+    0x60a0d364e5f578e9, 0xb6ccee88c2d3e53e, 0x2294737423095ebb, 0x144d630563e6f6de, 0xc2bded3cb50337ac, 0x448c0beb46275e30, 0xa4256b345d6e4fe7, 0x08690adace909d26,
+    0xff3fba00d3057ee2, 0xe181b8a8ca5dceeb, 0x69142e2bb85ce052, 0x5168923311585ab8, 0x3171afab82296609, 0x65fa7f8af1c2ed7a, 0x1d3a3bcfcec66d81, 0xcc1eb1ae946d7bfc,
+    0x1b49cf4c77d51a79, 0xa4da78533e4353f8, 0xde1287e87928affe, 0x8102b79b0c2a9233, 0xdc0bf02de412032f, 0x6c41eef7c1bb537a, 0xc5370f160a9127fa, 0x3d3e2a87bcfda94a,
+    0x90a6dd9ef2543e22, 0xea0da5725fc8013c, 0x7765d55a7fcb399c, 0x16082d8758cb05ee, 0x936d4d77ba2b6d51, 0xc5fd88659aa00a23, 0xd40436e8d2db28d5, 0xaa8fad08deab060e,
+    0x054b4688d3031671, 0x97f1b5509a1ae6ea, 0x80012b4e3821ea91, 0xe04467512d453c2b, 0x3a06531e97234ac6, 0x233639914b51e6c5, 0xd46121fec16d1d3d, 0xfc55bd5604050702,
+    0x361b614cff0dc74b, 0x0c2c019e12687867, 0xcc1fbba207294c8b, 0xea407c0c1e9adf76, 0x49672bf23fe8b29c, 0x0172e4dd69cefe30, 0xfa342652695e8c9f, 0x9c407f4bb0bea103,
+    0x1ebebaf1a50673e7, 0x7ded29f7d4589edd, 0xca0361bcab5e16c6, 0x430704c01d8d45ca, 0xb8c7c93f2808c7b7, 0xf61ad475a704c43b, 0x662aa7b653790a5d, 0x55d39f9c0b2bad96,
+    0xe37b761272e5a39c, 0x55d6c51ed4205301, 0xaf67464c167fc4e3, 0x9e3887c5567ee717, 0xb6220fa5f5143382, 0xe03cbe76b1b0f569, 0x2ddb3ae32350bc23, 0xa8df36de36362214,
+    0xcc76bce7904367b9, 0x1a63030ca220128c, 0x2934ac4478871799, 0xf7db16018be15954, 0x6c8db41524e915b8, 0xd3a891e0a0148acb, 0x53fa636537e76d65, 0x9b2dbca8a27ee09d,
+    0xeda3d6bd34ab8ab5, 0x5534fcffba7bca8e, 0x33f1e6105e827be8, 0xcf9ec3baa4348990, 0x989e930ef4bb0422, 0xd8991993e5394cb9, 0xefc34d7388ba178f, 0x485a83b0bb02d403,
+    0x29f02a1479ad9072, 0x4969641e006e2f6c, 0x8950e029983b1572, 0xe15e5b094ff2025b, 0x9ee9d8b5b1a6f7f1, 0x99410acdf6e665b2, 0x5208ac1266676ef7, 0x20d94a9e78a71fa3,
+    0xc631df5c532fa1ba, 0xf4ddb5dde3451f40, 0xbc0dff6b0f88c2dc, 0x209ef69dac4e18cc, 0xe7e2d4c1245cb438, 0x470d5114e79bff1f, 0x5a578ed6d99f7e3f, 0x295e29d0952b7e0d,
+    0x51621eeb418d3b62, 0x6af184edd15a044a, 0x6064bda7673c754e, 0x0d22496e5e456b3d, 0x49df16b84361e341, 0x21f4d199e3e57931, 0x4431d44934f60c5a, 0x883df1ac6c725a2b,
+    0x1debdf00f745ad01, 0x5d6c9579a2c01db0, 0x2998fa275090da06, 0x09d67bc6d532c6c9, 0x28918d73b012e90d, 0x97e4557412af00e6, 0xeca1c3471efeb63f, 0xb056dded83b6c2e2,
+    0xa2ab259149ccf6b3, 0x835e575560488071, 0xb4d3c3a0edbc07c7, 0x58e9cdbe84596efb, 0xb9efd2192367754f, 0xb20afd905f1b36fb, 0x511cb0484cb50622, 0x508261aa9dc54c26,
+    0x31aa5c4b6c01badf, 0xb5ced77860118a4a, 0x43539e85e597ded4, 0x83ea0a6a78c6ce0c, 0x16921e13d3867c62, 0xd19b3c3abae9dbe6, 0xb30be1dff2e1020f, 0x31cc867d377e3e8f,
+    0x8bde381cc0113a26, 0xde190f3c65ca2c37, 0x9e39b5caef4127d9, 0x9ce69d2539b1339d, 0x9eb1efab80a574ac, 0xc5b430518020fed7, 0x93377153a036c137, 0x1e07e2b4cfac266f,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_A_COMB_5_Z[] = {
+    0x0000000000000239, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_B_WIN_5_XY[] = {
+    0xfffffffffffffeb3, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0x9f34e17e2383127b, 0x4c79d571cf48ceea, 0xa33463bc494e1bed, 0x9d80747f3a5da27f, 0xdcbd09ddc2f4174a, 0xe8307a8c2147b2e0, 0xd1d3cceddbcf9ac9, 0x778ffec2e98deff1,
+    0xce514e6bb67da584, 0xeb51443be19c2094, 0xc8e8f54b9b071a6e, 0x239c53fdbed2a243, 0x67d47b7b2ae8e157, 0x046de3b75550826e, 0x2f7dd21e17723575, 0x0e6eabdd11e8e247,
+    0xf204f0d648600734, 0x04b3054c343d6475, 0x707bd9d8f7e6d181, 0x535cec326b353e20, 0xa185fa95108c5fe7, 0x7033ebfab573367f, 0xec54e36b46552d77, 0x235e6c1a729c9eba,
+    0xecdcee638b28c0dc, 0xd4e35b4036ae99a1, 0xdacc813d464a3d2f, 0x8d92802adbaf282e, 0x652cff9c7d8757f2, 0x2c1bcbd97f5a8471, 0x010192e216c3679a, 0x562694967529db85,
+    0x7480bb90d5f89b94, 0xe01fe3d81e46ede6, 0xc18431634e57e6f5, 0x5f8c688491c2df63, 0x42e01ed65fa2dc4d, 0x629c95cd8ff5a769, 0x0e8c16376eab4807, 0x1c41fb660abd9bb6,
+    0x6b509b4f6ed32e5f, 0xc62afb2567c95f17, 0x352d4b7a5ce4762a, 0x331358159afa6acc, 0x168b565406d550b2, 0x254dcce0b528df40, 0x422adb9a222c9415, 0x6fc0f2ce3d2f923e,
+    0x3cc0872359359ce7, 0x1779c0cd91a4dc50, 0x1205971ec8b9922d, 0x199f8198c13192a7, 0xa43fbdbf492db7aa, 0x9e173427e82beec8, 0x1e9014993850d54e, 0x603774b7f761ec57,
+    0x23b79c802bdef3a9, 0x2217119ad19a5f2c, 0x49194ce156b09a50, 0xee7d88a221329201, 0x1c45a959d0bbed28, 0x1ba5dad5780fa0d1, 0x17d7c7946959608d, 0x7da394237e4e9b1f,
+    0x435f5c5547508ca7, 0x84583489516ad549, 0x09ddc49d02bae814, 0xcd566b6e260b4d97, 0x8c11211ee38df931, 0x7d5fc8d005d473f8, 0x48c9d7cd865c76f2, 0x2d4517372a6d5599,
+    0x5f8b137b29c4eacd, 0x5cb8477c99075883, 0xbc6736a750a641c4, 0xf96b6d0e81b0881d, 0x8e9c2612e561fc8f, 0x8f742744284e20b7, 0xbc8c5be7d4dd11ee, 0x414709e782b2ef56,
+    0xe4d6bc0a6df555f2, 0x916e0a8038ee529f, 0xbbe312733414117e, 0x2d7bf9cd3154234a, 0x79b9cfa91852e8ee, 0x62653e8c1bd9c07a, 0x35fe04f67c7aff7e, 0x746c1e87e70ae283,
+    0x1f5857a198366ba5, 0x96781d84414decad, 0xb39dd88866cf983e, 0xde1050accac19b5f, 0x5a58bfa88b2aa408, 0xa0a6e9613c440ded, 0xbaaec3dfc67d0412, 0x0e37c0e06759674e,
+    0x1e623e7563880d22, 0x3be27cf8f0acb4b6, 0x5e6abd4f4f69642e, 0x3e92d34d13cada08, 0x56c644290127c48b, 0x620fc35b7f3c5746, 0x6870f3deef94c612, 0x219c5a5a2606f4a4,
+    0x0ad4acaa1625fe00, 0xd7dee6bb9bee03ff, 0x72a27d3b2e594a2c, 0x471efd78aab1c0e5, 0xbde8465e37857650, 0x1ca721c2bd9f5885, 0x361e6f8a6073dcef, 0x2ba435e30a7cf8e9,
+    0xc7b032bd1c6893fa, 0xfa9c30e809d4e403, 0xb03af5bd20293a47, 0x21ebc61be008f02d, 0x0a50151d73d59e63, 0x18d1a3f678d260db, 0xe8e3c3f47d79ba96, 0x51faed3775a06f31,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_B_WIN_5_Z[] = {
+    0xffffffffffffff91, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_B_COMB_5_XY[] = {
+    0xfffffffffffffeb3, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0x9f34e17e2383127b, 0x4c79d571cf48ceea, 0xa33463bc494e1bed, 0x9d80747f3a5da27f, 0xdcbd09ddc2f4174a, 0xe8307a8c2147b2e0, 0xd1d3cceddbcf9ac9, 0x778ffec2e98deff1,
+    0x28cfedee02fe3a42, 0x0d42977517821ab1, 0x7adb140fb084a486, 0xfaf3153b225f4b8d, 0x7b080101c7c27207, 0xc36f7f8887942b31, 0x33726647b8ef81c4, 0x63b2536521f2217d,
+    0xab9409fcc32f16f6, 0x24a1ce9fc7bea55a, 0x6fcac908e181422c, 0x96f6edc885f9f0d0, 0x2587de670cc3f3db, 0xf9f2bf626b41c812, 0x333a5d0b26ca9399, 0x282acbee5ffa406d,
+    0x4e3258632af30584, 0xea4efbf63696f2af, 0x46292da0a234e1da, 0xa772be5a94617d3c, 0xfacbef320acbc3ef, 0x0d053104d57e113b, 0x32cc29b13c03c0d6, 0x608cd445f13061cb,
+    0x1f1fd648b4324c63, 0x631e7580b98a4cce, 0x07d4be39c31b314d, 0x40af38aee3da90fa, 0x0bd14793090fcd92, 0x6901699d5afe0441, 0x4b8785162764b147, 0x06d316a99255f416,
+    0x55f629a24160f8fc, 0xbe5bdde15969af1f, 0x01675dc8d5040f60, 0x53d126f0f3cdac53, 0x2b28ec62f25823ae, 0xb899c6e98722ed2b, 0xfb6216d55637a785, 0x21c99872871e65f6,
+    0x3028514f5b87e0ee, 0x8c7b18020680b14a, 0xd4bbae78973da510, 0xd947d7ed8c459b13, 0x1228690e92ec8b21, 0x166c4898462aa2ac, 0x3e2613fdb339489c, 0x5531dd1be453ffcd,
+    0xa29e81b71c780535, 0x127dcc577e7dae76, 0xe4d4058603d0431f, 0xfe437f5052856a0d, 0x6c93c93c54693507, 0x2aba2e30f0b3ff40, 0xd69ac6f2913c7574, 0x3bbd9dbb399077c4,
+    0x6995a79b37ed69a9, 0x884af5c584569439, 0x5a73d1ad0d4b65f2, 0xcf15ef99798b4f6f, 0xf1650abc38353868, 0x1557debc3cf029b5, 0x156c3d3bfdec83f6, 0x26ff17ccc5df36cd,
+    0xb253558afe31831e, 0x6794ef18d051ca41, 0x987ddb040e7d2d1e, 0xf3c48aa5777b4a28, 0x15b4f30ff3946b41, 0xd187d33baf968c09, 0xe1a28ff6d6f3ae34, 0x7fe1fdfbf2da2bb5,
+    0x22a042267b45ceee, 0xc757bc8804e795cf, 0x12faa8fb31249402, 0x2798d878561de898, 0xb1ec70b38db04ffd, 0x883005eb58f14aeb, 0xa6b3ed4562d39bc0, 0x06d07743cec70475,
+    0x8a1f6072e1904793, 0xf59de1d6e0f607fb, 0x949f495862a5ccef, 0xdb576da831addaa0, 0x4d396671347ae843, 0x7de2bb8c0b16f607, 0x703034a83497b71b, 0x4ca0d2d735005bee,
+    0xffb576046d3a43c3, 0x4bb9aafcb8147d3f, 0x86479ce5926b053f, 0x90850656dc8dc506, 0xa7c7d9120423b75b, 0x14cbf5cbc5c6999e, 0xabec3066ac0306c9, 0x2a16d8f4f752a702,
+    0xd8833991b62f1d6e, 0x4d1fd30e8d04c06d, 0xf2e2e0fb75bd2d29, 0xef1a0e5a311cb510, 0x970fc4a3aa29887c, 0x6426d9ae3abafde3, 0xad78b89b836679e9, 0x5735a72a1660222b,
+    0x54a64d8fc7e0dba7, 0x0ef2c3bf011a17c2, 0x7a7f2e977889c807, 0xf28bcc8e7da56611, 0xccb16f7a5205f373, 0xdaea0fc351082cf2, 0xf0f088efcae82f38, 0x79dad9bd4482a3f6,
+    0xe97c97bd35d4ed68, 0x5e49b01b262e44fb, 0xcd7293cf4c53cea8, 0x62d367874b4ca98d, 0x4f2d1c773139b714, 0x348f1eb721c1d25a, 0xa61d94d0eb84ea69, 0x310e5cf4909dd88b,
+    0x199b7b193f7e509a, 0x27352970e678083b, 0xbd1bafa474944c54, 0x1e462cf0baf5aff1, 0xf2652fba47c06953, 0xf6ef1ea67e5dc4a3, 0x14fc722765e10935, 0x02accf2c801e1a16,
+    0x48d999244c93b076, 0x7654a9a8abf1dec8, 0x5793384d577f4b7d, 0xcc6d17eb385d45a1, 0x922a5f64de8b112f, 0xa3e64453d6bdd110, 0x9c11bf81b2f5d86f, 0x1cf516ada25f447f,
+    0x4cc2c988d50e02a1, 0x6cc039f1f05ba2e3, 0x6e13765cd7351c2c, 0x1fc527923e71df5c, 0x2975751aa0590344, 0xfd60d54a0a469536, 0xa90597efe1849d87, 0x69a594f1a244f76b,
+    0x9f6c3241532d5783, 0xfd2bd80a0e608fff, 0x33e9bce5c47ec477, 0x23239c54528372aa, 0x295dc96ab50fbe5b, 0x9d36f25e4cb41369, 0xe7f6800338fd8470, 0x5f32f8a9e258fa70,
+    0x09e5cde864b3cc2c, 0x9c07801012a6ee77, 0xde9556e6bd83e30d, 0x575483faabe1355f, 0xd3523cc7ff6dcec2, 0x50238ad349cc69df, 0x4ce96892e02657aa, 0x1ba94bc3391397df,
+    0x6d9fed6509f0a51a, 0x18b5fdb1a258b135, 0x7a8f48ab8d9b8b75, 0x57bd6c468836d24e, 0x9d72724efaa37365, 0xdbdbbf9f78ce29b3, 0xbf523f9fe9275041, 0x189ed3064c166b2e,
+    0x140a8d3d268eb6f9, 0xc20c9ecff13aac15, 0x131e872c4350359f, 0xee57d1827d441075, 0x6ff98936c64f9799, 0x9a4b933196e938db, 0x2b89031c212368cf, 0x2577102efd04bdd0,
+    0xa6faee75d8ab6fd6, 0xf52b7030a0660e15, 0x3ca1f4742eb2fad2, 0x61fd03060373d102, 0x26e0c09f2e8d3d9a, 0xa3b1bf50786a1467, 0xa37f435d03487a2f, 0x2dd18cb4b2d6e75c,
+    0xf2c38b40a473ec55, 0xca7fe2af8b512953, 0x8aee31e0b1288883, 0x18d1e3ebbdd59643, 0xde469b2f7ee83996, 0xfc6238c51eaa7a02, 0xf92eb96f6ef4def3, 0x7504290259bb9d13,
+    0x670e9d493d9ce4dc, 0xc199cf86494516e4, 0xee6e160d1d46ecd6, 0xca02c169f5afd3da, 0xd86527490ee7bf07, 0x0d01911a1c6e3194, 0xa67a1af2d594670d, 0x1cc20ae014d3e70d,
+    0xde20044b455e009d, 0x6f5e30fa4bbb4460, 0xd5be6e2ef142f20e, 0x89d1c6e31fa5e302, 0x5d1e7989a8558c4e, 0xf13cc4634575ef5a, 0x140688998e09c1e2, 0x6a4aaea07fcc80b5,
+    0x3d612bbe562aee37, 0x5ffa2f96e91c803c, 0x6535656a313c5726, 0x923f9de5cfebdd4b, 0x6427dd4e42f9806b, 0x38c998cbcd63251d, 0xa91900fdad5217cf, 0x39a6ef2fbdbb7b91,
+    0xf817539bc30731af, 0x3250e40fde4bd949, 0xa4065c0ffd5275f9, 0x4f6e712562abf374, 0x322e48b6e4445902, 0xa6f4a4151c3ba2bf, 0x497138a689a02396, 0x6348e70f85d61e9a,
+    0x1dbc88aaafbc0c5c, 0x5d6b924d4e77f7de, 0x1293ab49d0c46bfd, 0x07954b14022ad7c2, 0x540811ae8434d3ba, 0xa1ab6157aef6791f, 0x56c0716f5d91cd31, 0x4b92a0f9e87c1e8c,
+    0x590f4bc76954963e, 0xae1067bc54f76523, 0xae0413f72b1564d6, 0x04ba000417d5ad0b, 0xb01fe746294b5194, 0x140ecd4f49129ab4, 0xa126c5bf1f795163, 0x7417727b7fa1fb6b,
+    0x61fa862e5cd8074d, 0xdda82c9986e44ebe, 0x9b7a45db83344d69, 0x95acf2efeb7dd5f0, 0x1f525cf69e3d3b10, 0x143f905dad7701c0, 0xb72a51559b7aa81a, 0x67f74f49eb732bb4,
+    0x3e6d61e51a296138, 0x22b4bd2cc3f00790, 0x709b1c543358788a, 0xfd824a240822835e, 0x430a7fdd696b57a2, 0xd1111a9e0e120a7d, 0x451b96b7aa5bd199, 0x21bbccfc1fae49e9,
+    0xae0794bfccbb7903, 0x9946323cf6d5155a, 0x520dc0890ad17044, 0x02b4172dd305e86a, 0x89ca9a7fcad428eb, 0x16b8838caf3d2ac1, 0x7806a6e88400240e, 0x636470e18812fadc,
+    0x30629af114ca426e, 0x0e35300a305a7571, 0x12a52ae26f061d3b, 0xa41ecec6057f219c, 0x774a68892ef4df06, 0xb5afc003f757e528, 0x14c899c3fddfea83, 0x4e629fdce84d0940,
+    0x081475728770e014, 0xceb480e14f266c4f, 0x6b25d49f476b8e95, 0x66e4dabc9bc96042, 0x59512407ba4f66b1, 0xac6bdb52e8bcfd98, 0x163da41a755404b9, 0x13a6fc835f9a46a9,
+    0x35d9aea14fab1536, 0x3ae8c8909e6d9d3c, 0x7fe8dbacd84909e0, 0x6b17b57b8078b212, 0xed244504457c9246, 0x89dfb1bbc92c4003, 0x4cb2875f449f6a6e, 0x0cad4f8be4672324,
+    0x839a6b33481d1ab9, 0xee283c07eceff0a4, 0x1b15cbf110eb406b, 0x71523cd9089251f0, 0x0cf02a470405b033, 0x665fda0a21f18294, 0xf79d9f1326a0ff7f, 0x08bbe3bd304948ba,
+    0x63e1ca0fdd8cd320, 0xe8408b778b91acc5, 0x94a77b858c6987d8, 0x952257fe33e44425, 0x3cef0ad233b122f8, 0xedc55e3470b426e7, 0xac1f2f61f8757f0e, 0x06e053b457178b5e,
+    0xc108a2a1b43886e8, 0xd68fdbc0aedbf7c7, 0xbf9287240ef05c10, 0x0585278ec7830e24, 0xd3638116d12b7d87, 0xbb164b9fc400685e, 0x0e5e51488f0848d6, 0x631faa27768cb775,
+    0x3f34331d961d6bcc, 0xaf0c254d06fbd5c1, 0xe4036f8c6b925329, 0xbdd45245892c2aa8, 0xf6a580dfb221e2fa, 0x2bd613d6e15fc344, 0xc7524782769182b8, 0x0913ecadedf50358,
+    0xb5325ba7c98db65c, 0xb1141ffd92934065, 0x90428745f80ad95a, 0xcbbc9f361a232342, 0x8712a810fe6ef618, 0x701d1b7a000ddd4f, 0xbe53767f92080b77, 0x081f1f85c02a3d36,
+    0x51512c0a827db4cc, 0x22c5dd84bf8dbbdc, 0xfb4bbedf39f7d4c9, 0xfdd86e7d834784db, 0xf93882c2f141ed61, 0xa4a9d2341acd60f1, 0x674788b33dbca48d, 0x718cddb75c24b256,
+    0x5bf179e127d7c36d, 0xe6fcefaf42e46595, 0x589c35be4058b99d, 0x04c54c2627fc5fd5, 0x299d314b4a338eb2, 0x68c1728faa67f323, 0x1e726cdd7b2f45e6, 0x76999401f42584ba,
+    0x731891959d338d27, 0xa93897316a525341, 0x1dbaea24dbc75344, 0x37473f0d3afa5d2a, 0x24ecc3ff6397117a, 0xef903f5580a986cc, 0xaeb4e8d1cfadad6f, 0x0effade428f65292,
+    0x603561a9f67e44c3, 0x6d23a72f81a3dacb, 0x6e1caf7f4474fe7e, 0xcd1d0e31f66212e7, 0xaea90051a9823597, 0xc3a849a4db27cd61, 0x00c662c6a60bc3be, 0x379337601a308ed3,
+    0xcf703f6ee5dd7bc9, 0x2987246fa457c55b, 0x1789cbda9626a816, 0x3f05f6a6ae687c8b, 0x880386d2cbb97342, 0xec27b4a0ef2e0dc9, 0x5a6594f385587363, 0x14eb497197d31bfc,
+    0xc1895f5f5968acdd, 0x29121b127067726f, 0x653d467433e23859, 0xb1dfe9b1ba99d1ad, 0x20738b879c40fc78, 0x65c3a64f7a323603, 0x8f6f596e394386da, 0x29f809e0770131ed,
+    0x9c75ddf2ba541293, 0x779d86a82b637eaa, 0x86fb278034561fb7, 0xdedede693657eb71, 0xab61a1b6f6b5ccb5, 0x3033b3fc9e0bcdda, 0x4e8379b7fbfddf99, 0x44a6a3a743cef899,
+    0x34cd1d93e10c3c82, 0x7842cf881cb7a628, 0x10c50ef823f2c6d8, 0x3380e1d3c1bedce4, 0x0a70f41c0a98bf1d, 0xc71e7abc4b7a769f, 0xf471ed914b125f58, 0x55bb485ad68cfbf0,
+    0x2146721aae07acd7, 0x9d29e44744e84c19, 0xb94837c4c67d1f7e, 0x9e2878dc6d646bbb, 0xb157cd135e008976, 0x3de7d9384359aff8, 0xcef7d56ed7e568ad, 0x47cde57210fa5765,
+    0xa6b9a158a6dfac92, 0x1c3e40aba5895d1c, 0x376868fb30814f0d, 0xe6f9696fcfc5df9e, 0xd2447fbe2db6656c, 0x3104cffd91e38269, 0xeb83be92901e5400, 0x148db97a846e2142,
+    0x80156fe6fa4c0eff, 0x0431f9451201d970, 0x180dbec1b3de4540, 0x1d5d99c78648b1dc, 0x2abc438eb4e6d89d, 0xef9b4c520fc6d568, 0x8be2629103356363, 0x0681260431357dd6,
+    0xa6f165599dfee758, 0x02bb02e27d867232, 0x06c5369527171d95, 0x1ef5ccc8733b85a6, 0xe82c9e3101532f09, 0x55fd81bb1a9a8080, 0xbb0040a40b8523dc, 0x49dbf4a2f89f8f39,
+    0xa49aa829afa88c61, 0x34c55853d882c737, 0x25bc4e502a546921, 0x5c67a693c3065bdf, 0xe5387d85b0dd3d9a, 0x7837422d6117b441, 0xcd2323b5e15a4018, 0x79df9c0431c9df34,
+    0xb2963fbab3275438, 0x2d5e743ef1ff7418, 0xc8f052299f4dd075, 0x3a905e2b7201981f, 0x01288ea09bc52aef, 0xf2ba180d9d375135, 0x67cc282ef8c132d7, 0x2680bbf0859aa256,
+    0x0d011dd310e7eb3e, 0x308c798fe91f3c8a, 0xdc549631d7f1a275, 0x41901ab7c25b0c04, 0x3ca7a7549aa228e2, 0xc7b8793776b0e173, 0x544252bb26f8fa9e, 0x0a3fa29b5002e137,
+    0x9698725be82318b8, 0xf442ed83af49ad80, 0x48959ca2cf40b961, 0xaa0f2400df48662f, 0x4cf9b5888d6af508, 0x7409ce3023149fc7, 0xdf0268a6d523b5ee, 0x1331a6ea1216e6b0,
+    0xc9ef263895098aa0, 0xd9c979434082fc23, 0xcd26cebf5789f8ae, 0xcf75a5ce587e7ab8, 0xc4af71474e7169f9, 0x3428ee5e4e8bac60, 0x28c875425cb65bf1, 0x232c41cf223aa97f,
+    0x7458b3babb538a18, 0x3fd1c6fd9e6d29b9, 0x76d7e89ab9a8cef2, 0x9be1cf04d6823eb9, 0xf5a8a6287ca472f5, 0x54f745050abce1d0, 0xa9e630ee76cb382d, 0x544cba4b03323414,
+    0x6a262d67f40247c4, 0x1fa6ca9c530563e3, 0xffb71fb6aaf3cbcf, 0x3df89ff248b75701, 0x7f5b9f0db3542ee9, 0xb592d96df66dde3c, 0x543c5ffe913203c3, 0x3abdadd43055f120,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P512_B_COMB_5_Z[] = {
+    0xffffffffffffff91, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const word_t EC_PARAMS_ID_SM2_P256_WIN_5_XY[] = {
+    0x61328990f418029e, 0x3e7981eddca6c050, 0xd6a1ed99ac24c3c3, 0x91167a5ee1c13b05,
+    0xc1354e593c2d0ddd, 0xc1f5e5788d3295fa, 0x8d4cfb066e2a48f8, 0x63cd65d481d735bd,
+    0x1cda54fdab589e4a, 0x26765289db4f0a0d, 0x0a265a308ceb4a0a, 0x3019fd6bfe887c64,
+    0x0a10fbe94b2fc190, 0xf40aa52b87cbce60, 0xcc496bfa6dc13c97, 0x28ad34785bb3fbb4,
+    0x9a5756336a9c8162, 0x15aa58f221dfcc53, 0x7ad354bf1ef5f4c5, 0x0f443ef363f875b9,
+    0x2e81d68fd3450133, 0xb30f4bbde3607d18, 0xb1826a4c362258ef, 0x7b415276142a6768,
+    0xaa3531c781f06784, 0x0b89419307132520, 0x84ee5b69acfe18c5, 0xbbf492e0d9fbec28,
+    0x313a35c1e5f6186d, 0x0e449a2e757a01b8, 0x96c9b9922bd99baf, 0x2ba05a8f3b84d777,
+    0x98e795c330fbde86, 0x8e5e0495ab21af8f, 0x3925bf83b48669b4, 0x77d88740469522c8,
+    0x8fbf8b5b987b04ce, 0x63c563a83aff4428, 0x5dc1116553a6e969, 0x822a6c2432697f4c,
+    0x2b252ad03421e115, 0x7557c8c7c6affc01, 0xd90c19fd8a509267, 0x483da168e0d871c8,
+    0x72d6f9b3c10729bf, 0x5dd8402115b7061e, 0x9bfea2db9f2c587d, 0x528398a798641ec2,
+    0x34e51c6a8000fe4e, 0x7da2bdfd89c46941, 0x667ba91de1bc2b2e, 0x3c80c9d010a73e5c,
+    0x4fadebbec7f5c64d, 0xaef09eb43ea35052, 0x167ee11b26ec55f9, 0x45fa508a85189260,
+    0xf3489343dde97d4d, 0x9c14e38abbb2ce1f, 0x25866911cfddf221, 0x0df89411460efef1,
+    0xf713f30e73ae8326, 0xd9be66a8cdd274a1, 0xdf915ae236885947, 0x2c5c1e9e7878b781,
+};
+
+static const word_t EC_PARAMS_ID_SM2_P256_WIN_5_Z[] = {
+    0x0000000000000001, 0x00000000ffffffff, 0x0000000000000000, 0x0000000100000000,
+};
+
+static const word_t EC_PARAMS_ID_SM2_P256_COMB_5_XY[] = {
+    0x61328990f418029e, 0x3e7981eddca6c050, 0xd6a1ed99ac24c3c3, 0x91167a5ee1c13b05,
+    0xc1354e593c2d0ddd, 0xc1f5e5788d3295fa, 0x8d4cfb066e2a48f8, 0x63cd65d481d735bd,
+    0xbfe5c43b153adbf7, 0x07a66edf80351fec, 0x3d8042353b109e60, 0x4dc97176a832c162,
+    0x03fec75fb1db1e5c, 0x6aa02da6a15b9900, 0x5f9e808f4faa1cff, 0x90aa28bda6412a26,
+    0x11f0308d09e3d929, 0xd04d737d3ffa0f23, 0x533bbffd13f4f854, 0x4b4b17280bdd57a1,
+    0x9bd8e516506fdcb7, 0x38497a20c64eb372, 0xa44725f5f5f2b98e, 0xbdf4e8376d73a463,
+    0x40372d2d4919affe, 0x2d4a2ea3a009bd16, 0x48f1e7f8c1a62eb1, 0xce083725587a1124,
+    0xe874261be7ebadd3, 0x7ca5c156057b93e9, 0xe8b381e5fe39e6ff, 0x2d16b32fd30815c3,
+    0x0588d8ef8c1e04a7, 0x96e08f5dac5f0275, 0x686a85a8269752e2, 0x85628ba8b563a93b,
+    0x26e5e38a53297287, 0x9d1fe9bd3a4cacd9, 0x73d574056d090c03, 0x0d8232f6ef3c3885,
+    0x23bc88953d89318b, 0x04c1f3f8de5111b5, 0x3869bed97e312ff0, 0xaa189a1b607f321c,
+    0x9f8e068c24b22513, 0xe5a3a0fe4d1e4025, 0xc920927a36a606b8, 0xb9e4e429cfeb7c0b,
+    0xd339c6c1f9ba6006, 0x30c75494dbfbc4bf, 0x757b75a85edd9426, 0x763cd131bc1f6e88,
+    0x99fa4c4deb5df487, 0xf5a6cad2cefb951e, 0xd8aab6f257eb960e, 0x4bb44bfe0595d7f6,
+    0xa433bd2e5a26a1d4, 0x1148bb1dd1c2d78c, 0x4aae419e64102515, 0xd03b993966489384,
+    0xe21d58b1d61a9919, 0x17618c364a0ef3d4, 0x2519020d6fe8c0dd, 0x48d837d600b87a75,
+    0xab0c2fd1b9e7aa39, 0x27ce03ac5b82fbe4, 0x3805c023087236ad, 0x342d79d4d59c0b55,
+    0x4cb784d94723327f, 0xcb63a0fcee21426d, 0x409ba71b35b2cd3e, 0xb7556e24d7128982,
+    0xfe30ec1e25b4bad2, 0x3d039d1bfb088160, 0x929aa2cdfdbd46fc, 0xa6f9de076a3f4a43,
+    0x5489e38f334afcfb, 0x801254281141835b, 0x104c941a7c9a9037, 0xd3212f4741fd822e,
+    0x9a0ddaee1f4c9f4a, 0x1ddab735bc6f95b3, 0x445f830ab90cb1a7, 0x23630e7b3fd27b37,
+    0x4b0035e7f6c08358, 0xca9356355f27418c, 0x14f832abbf3f7c98, 0x12cdbd50b0c02cbb,
+    0x416016c266b9e077, 0x6e12d726e84493a4, 0x1bcc0a6cc62d6981, 0x7a4ba34963a649e0,
+    0x818ef33c1cb42bb2, 0x016d4e8d0ad3eeca, 0xec600704e089bcb0, 0xb5a84e74839946f2,
+    0x4c9a555abf326d27, 0x31d7a5d276521537, 0xce817d026717b4e8, 0x0c9edad7bfd78ed4,
+    0x0e3c551fef2da351, 0x7bd730c80fb1e7f1, 0xb7104849e166f66f, 0xbf325859b83fed99,
+    0xe7a62b5f1a186285, 0xb66ae5ccf1a714c4, 0x8c276f6825e33254, 0x8e7ddf8e322de1ff,
+    0xbbc02efca196c7ed, 0xbeb977a1af9a1cf4, 0x17992fed07dbf417, 0x25439f177d39db72,
+    0xcda3dff05e99f694, 0x93adb821f846fe52, 0x46362a35c637b2ee, 0x91c6f04548887e92,
+    0xa8eda91a1dd8b907, 0xa104d6660d49ad8c, 0x6901eef86001c220, 0x306e3c15703bc1e6,
+    0x22de997917a86e18, 0xe2ac2321be029111, 0xbfd3439735cc5a17, 0x7a93461f525e13cf,
+    0xd433542c5122d6f1, 0x41d2d9de833982c7, 0xe9f1f29a8ec24d27, 0x4ae251f3f3b99d58,
+    0x18606b2eb299370a, 0xec767de5ed0376fb, 0x1fbedd59253e687a, 0x7b64bf31e7220114,
+    0x47c41b729a452141, 0x1e9b859aa099d296, 0x0eb0c5539551db66, 0x3f774c405e1c944e,
+    0x7471db6c96fc6fdd, 0xbea05b6c447e71ed, 0x60b43b35cf1a3ac9, 0x975223dd68466b09,
+    0x3e9124cf1e447acf, 0xd2cd7a7e1b3dfe11, 0x4bba27844abc22c2, 0x0d98a8f211c1dad8,
+    0xcb7fb17901600957, 0x4016bc3f5635ac27, 0x4caad66e1facf435, 0xacd3861911bb656c,
+    0x0bcdad5b3e730c5d, 0x1f8755707b0d7ac4, 0x0f56aca5ca344d6b, 0xb72b3edcb9cb9cf7,
+    0x89f5d589a7e62c11, 0x7ea1bbb1794c7a17, 0x3d83c1897bf151c4, 0xc870eb56becdf511,
+    0x33daaf801877e328, 0x61774cc0bef25329, 0x18276cc3b764cad3, 0x3f1e93988cb81538,
+    0x4cec5bff8009a7ef, 0x7ad288440ccc8432, 0x804c70b610ba13b4, 0xa8c1ff70171a92b7,
+    0x89432392cf9c0663, 0xaa66c456ae52a436, 0x1b833ab1fd8cfc7f, 0x6a1d284d7f5f4566,
+    0x4a56235da60df28f, 0xecf32d88b823bd46, 0xbeb882f134dfa06d, 0xf6b32ead88dad03f,
+    0x2960b1da5866ed62, 0xe883526c1d015ae8, 0xe79b19747396476d, 0x7b26098200f63b88,
+    0x6a76d2d18659f00c, 0xb405588f770c8e21, 0xaf90921c90613699, 0x17068afbfe28507e,
+    0xed21f315e6363a54, 0x7fca8d6316ad586a, 0x0bac7182b1072bf0, 0x4aafbbf87cb66eaf,
+    0x3cf6707ff0f16576, 0x7eb989e404c53df6, 0x20889da360873af1, 0xce803e186a3176ea,
+    0x9d0d3e9b970abc63, 0xc44fa547e8c0b770, 0x377f93b143d645e0, 0x28c007cb44c59faa,
+    0xba08d940143cfadf, 0x0c9ddf4b726ed444, 0x3db12d77d8756c00, 0xb2554158252d4b79,
+    0xbd75cd2954e64ed2, 0x2fd47750bae8b381, 0x70b40b39255e3b23, 0x512428a5b2c3ac53,
+    0x55549e408effb24e, 0x9fd1bd76cfda9f4d, 0xf01b58e84c46cb4d, 0x9ffb67f76db4a28a,
+    0x77902368c3ef2b77, 0x0348851f4c75d56d, 0x6e5eaf73ea22e27c, 0x33ea7e89a73178cc,
+    0x10421ee731ad6fb5, 0xac4b83cc5e8b4a59, 0x6a078719acedcb8c, 0x33135c94b99d7170,
+    0x3977233de5f3bc69, 0x4cec3aa05de16c7c, 0xf5f502da5730826d, 0x0eafc4a750ed1c01,
+    0x49ad5e92ef6d8ca5, 0x37040c301006469d, 0x0d173b6ba8cb2a19, 0xb5158cb463839c57,
+    0x4c17a2daab8cd421, 0x327b4643b33ecd2d, 0x38284dded649ff48, 0x1959e77e44a75d45,
+    0x9c0b13201a6b616d, 0x78f34ff01cf00471, 0x48a8aa84d931f8f3, 0x049877386b100112,
+    0x8c833997b612ae46, 0x3561db7821f4160f, 0xf066a60cbeff0437, 0x8de23b406006ff4d,
+    0xe1ed4112e1cd16ad, 0x4782cbc421c06e39, 0x6110d77a3ed4b0fd, 0xf6067b6cce17b1c3,
+    0xac013761bba672cc, 0x3a431bd88794910a, 0xe5b4f53cee6fbd58, 0x72a272a11230f3a1,
+    0x7782cd1edfd1e1d9, 0x45e1cccda8caa6c1, 0x0ad6656b3e2df055, 0xf770828464e57f41,
+    0x8547322a83a2fab2, 0x728e04aac4722504, 0xef434bb7949c6561, 0x88b0146656d92cd8,
+};
+
+static const word_t EC_PARAMS_ID_SM2_P256_COMB_5_Z[] = {
+    0x0000000000000001, 0x00000000ffffffff, 0x0000000000000000, 0x0000000100000000,
+};
+
+static const word_t EC_PARAMS_ID_CN_P256_WIN_5_XY[] = {
+    0x00d82731f368870c, 0x9d12c0a0a0105395, 0x98681543b6f56b25, 0x4ec8e57d36e75430,
+    0x7cc6691743006ada, 0xc6f62c40da122cde, 0xfa7e55ca0749bd88, 0x5ff1658dad3ab75c,
+    0x7a6edaafa364ec6b, 0x9af82006e1471b03, 0x438d47445ed6a7d6, 0x2c423183f0a714aa,
+    0x57c4b0d02b5a11dc, 0x5e980d6fbc03f9b5, 0x37d6e45c4000b7a6, 0x37770191381b969c,
+    0xa97e78e2a9a87903, 0x77230b5ed9769103, 0x039a95676b43f982, 0x1e2d5345a428cf7e,
+    0xbebbaf59fe50459b, 0x6ed4c0327b05d55e, 0xa1f7c1d50e3be628, 0x13350ca2ace4ab5e,
+    0x28a3adb8dab7e77e, 0x948a7b8a58f8f4e3, 0x711789f2b8d2df43, 0x2e209ae4e2f68ce0,
+    0x0f477ccffbc639fa, 0x19c7c184510962c4, 0xd05cc93a4a4291f8, 0x656ef9dd36d022e0,
+    0x2862a4e689ccb7b7, 0xd415a752f522fd89, 0x7a36b7641930e415, 0x0ade8e4cf1bdda3e,
+    0xf55c8452fac0583a, 0x561d9f9d82dd5006, 0x644e82aba9856024, 0x6d8f919826d71737,
+    0xbd6f1b0d2ff3756f, 0x8755e019f05e555d, 0x8cb03031c9d1f1f5, 0x489ee09d30685e9d,
+    0xba054a97379611e4, 0x1f70945fc83d687c, 0x9448742d3ab6323d, 0x2a193abb16cb7719,
+    0xde03fbf404723dc1, 0x00651f23a023ab72, 0xf227a6c148803929, 0x7520ed673a1a2608,
+    0xf5a2010c6e05c133, 0xd053339cf1b22168, 0xfabff086669f1fbb, 0x221cb9b3d7b4c923,
+    0xacb41ccdfe118daf, 0x92be3a3e5fd84ec2, 0xc8bd8ccd29eff650, 0x457f11c231f6bd26,
+    0xf829540c20f41993, 0x52c3b0d99b46ce24, 0x88af76b38a23605b, 0x0c444df10d0dd3f7,
+};
+
+static const word_t EC_PARAMS_ID_CN_P256_WIN_5_Z[] = {
+    0x8dd12474f70e203d, 0xba8d7c6ea3baae82, 0x1746dbca40900821, 0x7abd2961b3fbb0e7,
+};
+
+static const word_t EC_PARAMS_ID_CN_P256_COMB_5_XY[] = {
+    0x00d82731f368870c, 0x9d12c0a0a0105395, 0x98681543b6f56b25, 0x4ec8e57d36e75430,
+    0x7cc6691743006ada, 0xc6f62c40da122cde, 0xfa7e55ca0749bd88, 0x5ff1658dad3ab75c,
+    0xfec6f28a2fcf6157, 0xfe0c772f67ab6c4d, 0x9f259fd77f78dc30, 0x1b9da0ff87947ea4,
+    0xdd9869962ac5863e, 0xa9979290c17f69b9, 0xb2ca275e7e4e4ef9, 0x530ef3086f0890a7,
+    0xa501f6ebddbcbac5, 0xc9bc63a4ad8a1b0d, 0xe0bcf54d7dd16851, 0x5051bdeba5214355,
+    0x9698ef5e191c3f03, 0x2b23368104710515, 0x7bc464f14b45de5a, 0x667c0ed59e6d2a6d,
+    0xb820fb230209292a, 0x163557df662e6c82, 0xa4ea0c78f0663fae, 0x23ab8ece7497bb86,
+    0x348d1ba8a2cfaa7c, 0x42988071cbc648c0, 0xca97ee70d85eee56, 0x3535e51886c9f5a1,
+    0x2070069c92445185, 0xfb42594d218c9db6, 0x60d5a35577f0454a, 0x182e68a8244664cb,
+    0x14742e6f6e8e18c7, 0xd5a278e03983d0f9, 0x419002dfb6f824dc, 0x13eafab7b14c6b6d,
+    0xff722d35e4faaa5e, 0xf64134abc691514c, 0x401d2cd2c116b6e7, 0x7d67220eb4ea24c7,
+    0x9aaaf66083b7f3e3, 0xa01718636ef37d2b, 0x138b07810c83ce90, 0x61390c970eb0c0eb,
+    0x2f4466457a2ce6f3, 0x07128d05029346ba, 0x507d7cc51b6e0702, 0x1c566fb22ea36fee,
+    0xdc3b17b07bea8155, 0x8ba1c9b7c18fa14a, 0xdb6961ca50d2f91f, 0x1b3fcd502d287302,
+    0x95fad274a375a923, 0x8776dfed8e29141c, 0x47541885c911cda1, 0x56454bbb3abb4f5a,
+    0xd525118bb85ad4c4, 0x4cd6a6d31941be69, 0x5d1e03da294ac0bc, 0x7e28fbda6399065a,
+    0xab27f89f1f437c1c, 0x1626be0f801f71a2, 0x5c838c16bab554eb, 0x002f5a615672db15,
+    0x9f91eb4a0f08021c, 0x8ecce82ba36f50e3, 0xe4f940b69cc0b805, 0x6ff5b928681fb054,
+    0xc66d3b570ded0b7b, 0x6f95b1e97bfc5113, 0xcd438d07a827fa3a, 0x443bd9765b51faa8,
+    0xb841aebd87b41d1f, 0x2da6bd5f46563683, 0xd60e2a6f2e89e527, 0x7d18e2a58fae075b,
+    0xf3207fa303fdcdc7, 0x201bbeaa08fdd030, 0xec5d283cf58f759a, 0x63ca88fa9d926577,
+    0x02b3a381207b76f7, 0xa050140098032fda, 0x37b3e45970e2dab3, 0x557ccc93d11b3e56,
+    0x9cb5e91e78f9b3b6, 0xe8df654a365db8f8, 0x7be64c2967724b94, 0x51d1a9575474b339,
+    0x0997b7361ba0e83c, 0x1c6cdff4c11efbbb, 0xd22a44da950e398a, 0x35a27d1a35d680f2,
+    0x7d322024814f9a3e, 0x7982b60468f20d79, 0xa3a25d2f81bf5013, 0x5dafb32a9ca7155b,
+    0xb4edb32e2f7f58d4, 0x835452b146f4ff69, 0xc4f91532c68d6fa9, 0x5f44463efeaceb85,
+    0x8a1cc0bbd8ca0b3d, 0x59bd2b9053e63340, 0xf0132940d07ca71d, 0x015ee0f673390ff2,
+    0xf680953c8b6ee4b7, 0x8c10e896e04a30b8, 0xa2fd618c25ad6abf, 0x07b302b7c6276c48,
+    0xe172d4734c25dfc9, 0xd0b9bc84f897aaed, 0xb97fa10142b26e66, 0x681462adc4221d7b,
+    0x4dc0f22ec87aedbb, 0xb44944a9d0155872, 0xc060ce33726ac652, 0x29123068207cba3f,
+    0xe854a137e8b2a7e1, 0xb5042dbd41f64bb0, 0x3cd623007afb7412, 0x2896f29e8f4d5ee4,
+    0x5cf1bc644542e259, 0x77f3b057b609ee19, 0xcbc59fa9e3b940b4, 0x20b8c3d9a00f1611,
+    0xf39ecba095b8b73a, 0x779557d284dd0e73, 0x8800c8a44da10eaa, 0x17fc06f1939f07a6,
+    0x0f08f953191d0aca, 0x243e346ff8a8bfb9, 0xfe688db910aa28b9, 0x22b32c28bff730c1,
+    0x19c423bd7bc9bc28, 0x361beebfc5067c27, 0x6acda9be95089a2b, 0x154791e1ba3403cc,
+    0x85445d10b88d5455, 0x62e85a17280ac426, 0x95b6807f735c5300, 0x2f76e355c0265873,
+    0xad54526018e90814, 0xbc395e4e07e9269e, 0x789c1288c78329b2, 0x16a19b66fc8e6c79,
+    0x2346a834ea6eba44, 0x5d4afe5a16cc2b87, 0x6069a1f8236feff6, 0x069b7526267ec3b4,
+    0x828ed1550be53b99, 0x9cc362846f18dba2, 0xe9bed2fda1514c64, 0x805b7ff771ded451,
+    0x5fca9fddd86fdb08, 0xf31fbe3850f4db1c, 0xfd7e699885713f37, 0x12ac16bc03c4bff9,
+    0x145e1049395a6005, 0x02221913c91a3603, 0x0e7bae0cfead4285, 0x66b2599e29325fdb,
+    0x0fe86387715bd6fd, 0xd61f99f3be40b63e, 0xd1a4749f8cfe3271, 0x261c7c2f159ec203,
+    0x63c21ca6129a8545, 0xd8670732defd0e2b, 0x76111076c055b962, 0x00e8c87d79d0647c,
+    0xaa3baf0db1242c7e, 0x3bd157953aab71f5, 0x5233e84a3e69d606, 0x72942ac2bbd9a87d,
+    0x1a76fc6d96cd9819, 0xfeb560b77db12be1, 0x9ede590ac0c335c9, 0x475a74d97a4c2289,
+    0xac355649429fea6f, 0x5b578d395a426756, 0xbb019cbb1144295a, 0x7ed5b32840098041,
+    0xe26572e92f774d92, 0x74392726552f1196, 0xf59184529df389a1, 0x66209308bd910b60,
+    0xe3faa0360d04398c, 0x9c90264bac87d2f9, 0xdd9f4926e6f30824, 0x2f65e32baf862418,
+    0x0c7b70d6a521d590, 0x87f1d0236d4a948e, 0xad123f621e79e6d6, 0x7bef01be18e9fb55,
+    0x2ce498ee05ae173b, 0x508d970aa82d7587, 0xee7ce34c61277456, 0x1a4c20d6237da9a0,
+    0xb264650557129b54, 0x6b47f84c3147d9aa, 0x4d02852da007db71, 0x30dac10cc67b84eb,
+    0x64b931d205f6530a, 0x98f9d3c08adfd868, 0x73f730749ae609b0, 0x4a831a0274fcd16b,
+    0x3ec5a27f28b65280, 0x5796d357c3a91e23, 0xfc9db4ca2f9a181d, 0x5779c71fd33446c5,
+    0x1cfc8b032adab71c, 0x8b044dc085e8ec19, 0x55e953c98b61602e, 0x81fd80dfcc519c78,
+    0xb0c3223ff971dfe9, 0xf66d12e2b0ace4c1, 0x46745ddec2256ac7, 0x633ef3c834930524,
+    0xdb85d9e0dbb7b174, 0x3e33b0b332d95464, 0xf1a513879acdf032, 0x77e33c3182d26a25,
+    0x317b389ba7aa573e, 0x67728d18412d5124, 0xa064bfeba28d7c84, 0x3555e1f6b113b09c,
+    0xa080dd84907de4b0, 0xc5d60b005cd5e43e, 0x2aad683672a09f5a, 0x77d9a1dd7a18178c,
+    0x8c637ffa393c9945, 0xac3130753f645ab3, 0x3181a1016bd0109c, 0x02b5c340182da5b7,
+    0x22a584e32a6f8c8a, 0x2c589861a42d274c, 0xfa963d1bf1125dd0, 0x16583755e11ca460,
+    0xdaf9de158c382a03, 0x3806e9cae5c9fa37, 0xce42ea457e095988, 0x60ed6c6722764b2e,
+    0x4a8d3dfbc8c84793, 0x6a2d2d2916c33a66, 0xa43d6525d0b500bc, 0x3d9a26a55dc1f128,
+};
+
+static const word_t EC_PARAMS_ID_CN_P256_COMB_5_Z[] = {
+    0x8dd12474f70e203d, 0xba8d7c6ea3baae82, 0x1746dbca40900821, 0x7abd2961b3fbb0e7,
+};
+
+static const word_t EC_PARAMS_ID_CN_B257_WIN_5_XY[] = {
+    0x62e7a7485735fadd, 0x0ef9b6491082400a, 0xf658343f4b10297c, 0xcdb9ca7f1e6b0441, 0x0000000000000000,
+    0x75951dc8060c2b3e, 0x611b1c38bae260b1, 0x6dc89220d5f7777a, 0x3de74da65951c4d7, 0x0000000000000001,
+    0x4795b1fa4420ca0d, 0x6376f4ed5f047361, 0x434495922b03dce2, 0xfce8cf9d9fdd63fc, 0x0000000000000000,
+    0xa5cfde112a0de2b0, 0x4bc3ecbcf534bc25, 0xaeddedd75ddf05f8, 0x668a903f2092b5aa, 0x0000000000000000,
+    0x2c5c88fc803af5d5, 0xf8fe93da13cf140b, 0xc087ec99b5cc0db2, 0x98af29ed064112d0, 0x0000000000000000,
+    0x2f62869a1c4a0169, 0x0ff4cb8df5b5ad35, 0x72c92a25b5931114, 0x911231319af0a1af, 0x0000000000000001,
+    0x3914fffc98b07b5d, 0xdb0e5b336442549d, 0x6e656a6970525ea2, 0x72f667db99971a9c, 0x0000000000000001,
+    0xa7dd408ed83a256b, 0x3d987c572e710997, 0x24abc0b0428f3159, 0x5690c8257ca59472, 0x0000000000000001,
+    0x7803e7c1794524b8, 0x7ca2b320f08ddfab, 0xe654c53065bb0c6d, 0x909609a10dec50eb, 0x0000000000000000,
+    0xfa779c28b4c1327a, 0x1691e007c909fa54, 0xc76b274a0f165d2c, 0xa3e2a80f0f210499, 0x0000000000000001,
+    0xd0446caee82facae, 0x65d4844b85e1fcf9, 0x19f90723f5bdcafb, 0xe146c870f1bd1a19, 0x0000000000000000,
+    0xb7b37b1642c67ce1, 0xef6949c94c076581, 0x93c2f7851c6f04b0, 0x123990743ff826a9, 0x0000000000000000,
+    0xf619497132cacf59, 0xb7f4cf12f788bb28, 0xca6a8e5ecd1ea22c, 0xf82963e99566e0e4, 0x0000000000000000,
+    0x4726ecce6dc40814, 0x8b40c2f612e0253e, 0x758f4f0a450d25fd, 0x00144dcd8c30bdef, 0x0000000000000001,
+    0xb5250fd84f4aab63, 0xa79f83f588981c46, 0xbd41981cd6b56494, 0x8dff0d2fa4325b1a, 0x0000000000000001,
+    0xb1b326a01bf33a53, 0x0b04095d8b1ed37b, 0xe2776b8ba931b0ca, 0x3e3e736cf05bd617, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_CN_B257_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_CN_B257_COMB_5_XY[] = {
+    0x62e7a7485735fadd, 0x0ef9b6491082400a, 0xf658343f4b10297c, 0xcdb9ca7f1e6b0441, 0x0000000000000000,
+    0x75951dc8060c2b3e, 0x611b1c38bae260b1, 0x6dc89220d5f7777a, 0x3de74da65951c4d7, 0x0000000000000001,
+    0x4d0b5b8c097f16a1, 0xe065983d83efa8cc, 0x64377f344872cfa7, 0x22b57b4a88581752, 0x0000000000000000,
+    0x0b321107b27674cd, 0x119b55123dff0018, 0xacf8b0b5c7b24d81, 0x9d1a4d85a404c8aa, 0x0000000000000001,
+    0xc4a488c5c527c3cd, 0xb9917929a372d627, 0x552b0d62b64b0a4d, 0xb33f72ea78a45ee2, 0x0000000000000001,
+    0x2769e99ee3b7f823, 0xaf3b844c60776d3f, 0xfab7753d3ff78f5d, 0x9ce88dc03ffdc247, 0x0000000000000000,
+    0x87cf1b355f06576f, 0x47d1d761fad2ea21, 0x4dff6394edacb49f, 0x2cfce15405bff918, 0x0000000000000001,
+    0x534eb2ef9d872636, 0xc1ff903b4b8e98a7, 0xfc5bf596262933d9, 0xdfd1ec640d8c71a8, 0x0000000000000001,
+    0xf602cd54e5420e7d, 0xf06a4472937239da, 0x69e070b9eb5c02e0, 0x9e7642069947b59c, 0x0000000000000000,
+    0x717e68c989de7f1c, 0x453257580bef754a, 0x6399b02a0beae024, 0x10484c0d6f426a00, 0x0000000000000001,
+    0x31c44f38e93c8e40, 0xdf344b33cf7e4e84, 0x075c3fef32f7e49b, 0x22457639ef0fa0bb, 0x0000000000000001,
+    0xe366771b0739d00f, 0x6cdeacb7fa378eb2, 0x8b13258d00ca1464, 0x7f3a7770682f479c, 0x0000000000000001,
+    0xe19a3d7e46a1f47e, 0xf0585c70f591292d, 0x2e5cf44afcdfdc97, 0x40dd5efe4ec8cda1, 0x0000000000000001,
+    0x23d26156656d47bb, 0xcd7d7ccebc9f464a, 0x25751023b26e908a, 0xf23cb7bf39eb6476, 0x0000000000000000,
+    0xe197e4a89919a68d, 0xd35b6c34e08352a8, 0x624b82fa3fd8bc93, 0x04fc30ad66d3e732, 0x0000000000000001,
+    0x67e2c1f792d84ce9, 0xe27f9ee8ce95fe35, 0xeb5439a955cf70bb, 0xf8d7f75b29d4db12, 0x0000000000000001,
+    0xc0c6588849ebba17, 0x334937a53ab14a39, 0xf4634823f9e2a49c, 0xaaac3ebb45f8c1a0, 0x0000000000000000,
+    0x3939a2f08a407d9f, 0x6b6cd79bcc338226, 0x4d6f0b9026d1f0dc, 0xf630de81ee0edfea, 0x0000000000000000,
+    0xffabf610b5a59b59, 0x392bb090c05506fb, 0x60db5e5fa0bef425, 0x2b60e0fa972f6113, 0x0000000000000001,
+    0x35491098b088eab9, 0x8885722a7bc7ba12, 0x7ca133dc69fefd3a, 0x3eaf1cc750888b32, 0x0000000000000000,
+    0x69cebdb64bd082b6, 0x7f03bc3fe7b3082a, 0xbeca6307a72e468d, 0x56d4cb924ad6e0c4, 0x0000000000000001,
+    0x62f37c0c0648a179, 0x216c4f5ad9aeaa83, 0x2f5aa8f28f9c1c31, 0x007f1801e5cdf02b, 0x0000000000000001,
+    0x996a720348da2522, 0x8368122d73cb139e, 0xd3e438809e0e98ee, 0x6206a609055e4a88, 0x0000000000000000,
+    0x6d1132bfa5e0ba4e, 0xbfb839af99a30feb, 0xcd14692db484763d, 0x2032f69dd9a44b40, 0x0000000000000000,
+    0xcf19bc1330d12926, 0xd62f94e78e1241c1, 0xa0bf3f153b5c910b, 0x45110527568d92d9, 0x0000000000000000,
+    0x2b966f6e03165b35, 0xe844f8bdf5d5c505, 0x1f7316abf033858a, 0x08b44f3f261ee2f5, 0x0000000000000001,
+    0xfa24a928e16faa8a, 0xccb688df2448808d, 0xa5dc3a99d84b2b38, 0xc249ac0a8e011477, 0x0000000000000001,
+    0x886f962338aaf487, 0xa0ad6a371033057b, 0x82c52a5f82d1eb27, 0x51d9783ae90ed5d0, 0x0000000000000000,
+    0x05a586ee93ebde6f, 0xbb42155a7766ce11, 0xad7a7c32b85b4c21, 0x55be65b921ecda71, 0x0000000000000001,
+    0x6de16d66f881b1ec, 0x1c12743691f42384, 0x7629393c44b606e9, 0x161396aa0c528b17, 0x0000000000000001,
+    0xe219e08bd1075fbf, 0x25d1bd17bfab8859, 0x4870697be651d3ff, 0x472fc13bb4a79559, 0x0000000000000000,
+    0x6d9d128a3befe7a9, 0x3db6a997cc705e0a, 0xbcd6acc8ae3d4237, 0x1780a79b6b0490c2, 0x0000000000000000,
+    0x603d7bcd4e1c4485, 0x79ab73f84a320d98, 0x0018ee2aaf1c9e33, 0x1b6890163304dd67, 0x0000000000000000,
+    0xf7be2550588e4fcc, 0x0bc49138af83965b, 0x702f09adf009d6d5, 0x15d8f38de0175abc, 0x0000000000000000,
+    0x4152e2842186c15d, 0xa53e3751ae6e3df8, 0xfb07742603942801, 0xa63f8f3ffb92f6f8, 0x0000000000000001,
+    0x066a5fecd52af088, 0xc48c66469818fba0, 0x65b6157bfb122ab8, 0xb9e7b43f5c0f2d5f, 0x0000000000000000,
+    0xb0d6051a5c5022c8, 0x93704e33a171b5e7, 0x531e1f78fabfcf3a, 0x2450976e72ef3297, 0x0000000000000000,
+    0x0ba569870995d123, 0x78fe6fe56c75263e, 0x99483689123e5982, 0xfe9bc27cff06e27f, 0x0000000000000001,
+    0x0e49618537b212d9, 0x13656e907e50edaa, 0xd8d9bf9509a7ece6, 0x9ebb326e7937aa88, 0x0000000000000001,
+    0x46cf93921d99ecfb, 0x9ebae99826e68460, 0xbdec12d33c658d1f, 0x18a239d3bd16fd36, 0x0000000000000000,
+    0x567f0e5784ce0be4, 0xa10d4218e122e263, 0xbc9b1bb44a2c3f74, 0x73115e81b11b3811, 0x0000000000000001,
+    0x1e27ea7d576c6bd1, 0xd4ef345ad8606294, 0xa0fdd0e34c390fd9, 0x70ef0b2e669911df, 0x0000000000000001,
+    0x7e041a62d4d8df09, 0xabf2a38902f8618a, 0xcd39130e1adfc9d3, 0x2ba5da76f73ce01a, 0x0000000000000000,
+    0xa7e536b8f6c78b64, 0x7f6281e186eb040a, 0x622be56edc476676, 0x0dcb76b570a37a37, 0x0000000000000000,
+    0xd7b719bb1b687a54, 0x5c9a50b9fb768c2f, 0x8559047252274ffe, 0x058d3712a5f2a7e6, 0x0000000000000001,
+    0x1b52fb7714c6c3b5, 0x94b55e37edde6ea0, 0x60329953af732761, 0xe196ae079f165f44, 0x0000000000000001,
+    0x54003305c5bcebe5, 0x5b465d04fe9671ce, 0x0cf154d7e6801586, 0xa6b5f9e06dab817d, 0x0000000000000000,
+    0x4441e3a2008bd46f, 0x791d0c8d951607e2, 0x5465a3b437963e7c, 0x4c144c0c959612a2, 0x0000000000000000,
+    0x38a1f0bc9465d027, 0x1d430f47d8c23088, 0x5b90754d877fdfc9, 0x4f71c851b5d7a957, 0x0000000000000001,
+    0xef8ab07f50016ade, 0xa2a223f1b8e89c9f, 0xc8c590c2e32b9a38, 0x176d9854ff94493d, 0x0000000000000001,
+    0x8c0ab1c599078ebd, 0xec21da33b5a377d0, 0x861911ab5f92de0b, 0xe36cac2558175e1c, 0x0000000000000000,
+    0xa9133ba6b9b62714, 0x2a30e303114f288f, 0xb9c9a751fa3ed8e2, 0xc18cb1580c6d931b, 0x0000000000000000,
+    0x26a8fdd7454bf731, 0xb3fd510f72002c1f, 0x66b2177fe18a33de, 0x0fbb4d026ee01a24, 0x0000000000000000,
+    0x8ef218d9dd95a441, 0x7b6a9ab3888d94b9, 0x9a08bdb99bc9c54f, 0xf6f1c352b887487f, 0x0000000000000001,
+    0xc56ca16319139baa, 0x0082b14a3dc236e4, 0xb9cbe8ad239415fc, 0x01dab1d5a68477c0, 0x0000000000000001,
+    0xdd90740755cbf121, 0x2b23663dc1bae1d9, 0xbfc43dfa67e69d9f, 0x4337e5099e840d3d, 0x0000000000000001,
+    0xbc38d3a0422b8785, 0x4051ed4496a43851, 0x456fb9fdf4c9defd, 0xefe4481c3719c0c5, 0x0000000000000001,
+    0x9fb991e4b5ee94a2, 0x0adf7b168f6632cd, 0x3e1e40b27551da33, 0xe88f73ea575403bd, 0x0000000000000000,
+    0xb9f8d6206c01d254, 0xde8081d4b21ec6eb, 0x3ffecfc87190a300, 0x6f0872dcd973688e, 0x0000000000000000,
+    0x30e7d1b8a05e0ce9, 0x35abe307179fa533, 0x09948a3683f6b6e9, 0x14b1e55c862d3099, 0x0000000000000000,
+    0xce206b39108df43a, 0xb9eb50329813102c, 0xebeaf5880fe18261, 0xf88dea6c7892be54, 0x0000000000000001,
+    0x941aafdb7fea907f, 0x19f9490b9e1d23c4, 0x2b1ff6e97c7e2549, 0x2f06133a9a84f476, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_CN_B257_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_TEST_WIN_5_XY[] = {
+    0xfe74885c8c540420, 0xa93ac27df9ff01af, 0x000000072d867f93,
+    0x4ab81122adc3fd9b, 0x47852b97c5599d5f, 0x00000000224a9c39,
+    0xd469465d033ede07, 0xda324607bffcc1ea, 0x000000061da3389d,
+    0x3a1f4be543b393e9, 0xb08662634682d26d, 0x0000000142b39f71,
+    0x51cecfec3388bc28, 0xfa7df9ab2621effd, 0x0000000568e8c173,
+    0xc9a9ce66966c6a30, 0x4d5722eb3f6669d6, 0x0000000376f556dd,
+    0xf15149e4452bed1b, 0xca70e500be1fcf71, 0x00000002df45df6f,
+    0xc4afdc4ec56eb4b7, 0x1258b5e80469386f, 0x000000026dcc783b,
+    0x4213b92793095ee0, 0x60467e9e0edbd0cd, 0x000000066fac4fe9,
+    0xb5e38441e2a870e8, 0xb38c5fe2210bd6d6, 0x00000002f850455b,
+    0xe7d828ac414e78e0, 0xb78a0c5c01d4152c, 0x00000003e81da79a,
+    0xa03af2c519b5453e, 0xbf509357f13e0092, 0x0000000687a60e4b,
+    0xcdb9668d6bce801f, 0xd8835b05fdc5c676, 0x000000038ec1c2d7,
+    0xe8ea01d3fb14160d, 0xe539e0686f87a2b6, 0x0000000400ff1fb0,
+    0x633fceb7c3675996, 0x8b5d312431f768d3, 0x00000002a40009c7,
+    0x74ef74d6b8c596be, 0xde473997fefcf31e, 0x00000001ab78e0ad,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_TEST_WIN_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_TEST_COMB_5_XY[] = {
+    0xfe74885c8c540420, 0xa93ac27df9ff01af, 0x000000072d867f93,
+    0x4ab81122adc3fd9b, 0x47852b97c5599d5f, 0x00000000224a9c39,
+    0x5afb1df649a9a47e, 0x11c01bf4a1c1779a, 0x00000007ea9391d9,
+    0x941e5d2499f88a6e, 0xa0a9b22f462f049a, 0x0000000356e6f28a,
+    0x4780bc7e5eae4bbf, 0x3db96aa990a76722, 0x0000000345e2fbd5,
+    0xd8d84c7504dd78f7, 0x0736d43d442f507d, 0x0000000481d89595,
+    0xf5462b2115aa15aa, 0x5c7d023af713514b, 0x00000007ed058efb,
+    0x1b79e4a0ee8d8b9a, 0x14a72a75d5a32949, 0x000000055b79dde4,
+    0x3745120c7084e526, 0x388249e70aa9c6fc, 0x0000000270b9064b,
+    0x82a0d74009552cf8, 0x376c462a2f3a14be, 0x000000057c5e6c83,
+    0x831c801eb6375e65, 0xf2a580ec52e7b4b6, 0x000000011deac5aa,
+    0x98f2f9713c6a26c9, 0xfe0de83aeec2941c, 0x000000067ee56e5c,
+    0x62ee2d773b7d29b1, 0xf3e69f5c0ffb5d7f, 0x00000001882cd0c3,
+    0x56b50f6e8dcaebd2, 0x2e929883c6b1c4de, 0x00000005eb014b7d,
+    0x657c01b693dcf94e, 0x21e224c21ffc9dfe, 0x00000005e384546f,
+    0x8c9e152d53570c85, 0x756f685af395ff4a, 0x0000000684f38f81,
+    0xdb61c3816ea46a15, 0xf783ed3a5e7d78b7, 0x00000005989c16ec,
+    0x537904ca4ad89294, 0x167e5b02d79f13a6, 0x00000004dac9e6f4,
+    0x318caf03940932e4, 0x1e0c8904f96c06cd, 0x000000067acd85d2,
+    0x4c9b9e27505647ba, 0xdbec11211fc2134e, 0x00000005ce765a03,
+    0x74ac3366d8399098, 0xc6a4ae70ba2a5a0b, 0x0000000123d447fb,
+    0x99811b0630a3fdde, 0x88c9a4fbcbdb281f, 0x0000000078aa2f25,
+    0x8034d5412f243b0b, 0xc5bf5183bb453594, 0x000000068a737576,
+    0x1c6dd51b784cd49a, 0x3b88129470941414, 0x00000006c63cc565,
+    0x74875f1842ec8b71, 0xe128fddd01a4ce7e, 0x00000004521c63e6,
+    0xf81cbcf516c03a05, 0xeb5efcf944d0f532, 0x00000006e94f0fec,
+    0xac61de98ea2520bc, 0xa1fb5631e10fad17, 0x00000001760f3fcd,
+    0x9db1a8e12931af8c, 0xf071a7434ca7b91f, 0x00000007dbbf2022,
+    0x3ea4c87e5f0260a8, 0xb001d04779a91c0c, 0x000000007dbb360a,
+    0x432fd562a3b89693, 0x0678fbc58bc79162, 0x0000000317720a5b,
+    0xff1bf284e557f99e, 0x12a303401e8afbc2, 0x00000004e37b77ab,
+    0xc671faa445033368, 0x697b508ee217461e, 0x00000004fe3491a5,
+    0x3c1378ae0d4c794c, 0x8fb50d04de4c1bc5, 0x0000000324e1032a,
+    0x80fc2c5e07109dce, 0x410efdb29d5aa8f2, 0x000000002be0ac1f,
+    0xacfdb93b6abb488e, 0x2864f4ddc9216b0a, 0x00000007f5450e57,
+    0xad3700b5e3d45db0, 0x2b851b086a6c8cd3, 0x0000000285786caf,
+    0xc87ede1b91713e09, 0xddf1ca25b6a69b37, 0x000000048d01e434,
+    0xfe719a67b8879fb0, 0x1662645e252ce5d5, 0x000000023fce37b6,
+    0xe2223c5e04819ccc, 0xa074f62bd103d8de, 0x00000004a9ab49f5,
+    0xa74627c4acedb5d7, 0x3365956938acd2af, 0x00000006a5c8750e,
+    0xd9842a37332de6c8, 0x423ffa439cd118b0, 0x00000003bbc36c4a,
+    0x3b4b91324b5c7d95, 0x4eb17d7300528ef6, 0x00000006c743e57f,
+    0x86719e54d29ec10f, 0x359983cf17e47713, 0x00000005c10f23a1,
+    0x2f647b7a1e7c82ee, 0x7dd86fe24dce8fbe, 0x00000007bb0efe13,
+    0xea5384dcc31aa492, 0x2d1d29bfb6ea8a5d, 0x00000002ef83d154,
+    0x65b3e870b9b9b270, 0xc5355d1460c8f0ea, 0x0000000295fb79f7,
+    0xf8399121d8e54468, 0x2c26c7537f76d578, 0x000000063bfffde2,
+    0x330f0519badce6fa, 0xb16c04d21a4ea652, 0x000000062b18e710,
+    0x62a02c52d24eafd4, 0xf115c1d3bed13765, 0x0000000765b65dbb,
+    0xd99f2d22257ba446, 0xb98024a828f98b8b, 0x000000014d6fc562,
+    0x8147369fb829c18f, 0xf519a8737dfea7db, 0x00000003dfe3e771,
+    0x338ad472f1f91964, 0xd77c0dc993408add, 0x0000000719f9b7e6,
+    0xd690dfc59e0cd908, 0x7662032d55bfcdfa, 0x0000000321d12354,
+    0x3897f8f5bf50a0f6, 0x85e5a0edd6fdafa7, 0x00000003b2ece49d,
+    0x13e2a27247e58718, 0x6bed75eef558dedd, 0x00000007b6f1da97,
+    0xb963cfa4cfeaceaf, 0x11331da9c324d1c7, 0x000000065dd1047b,
+    0xa1e81192872280fb, 0x88a9eb1e55a11b64, 0x00000000d365bf8c,
+    0xcdf08ad8581db886, 0x0a53da91c523b044, 0x00000002e049a86c,
+    0x25880355b7d2413b, 0xeb07afa7a843ff84, 0x000000010c161897,
+    0x9d1abe522745e618, 0x8df7a6dda85a8da2, 0x00000001774736f9,
+    0x473c0c4a21c74688, 0xbb030bf839ec0603, 0x000000037645c6a5,
+    0x4fe5ba1babf2d032, 0x481fc8593c916d37, 0x000000035aad0c9b,
+};
+
+static const word_t EC_PARAMS_ID_DSTU4145_M163_PB_TEST_COMB_5_Z[] = {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_TEST_WIN_5_XY[] = {
+    0xfffffffffffff36d, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0x9af45a5a471125f5, 0x7ce5090af69bf9ae, 0x67617a63e4b6dde6, 0x03f66b354aa3daa4,
+    0xb39bdc16149b5d15, 0x87ce978a7309454f, 0xd22f32ef315a7a56, 0x4c7de232b69a6b57,
+    0x9e2daf6d466dc64d, 0x758c27b14b1c8a55, 0x74a0cb23bd647f1a, 0x27e748682c2f4c70,
+    0xf2d8f32e55a62594, 0x8323d57036bc547a, 0x497679eb98d4b25a, 0x061167f2b87e0534,
+    0xe1fffdce223e4df8, 0x7c83ae78dcd891e9, 0x743985863c1b95d0, 0x11d7320574b3f5ab,
+    0x34b9c048acb97f7c, 0x8232e73ce3b9bcc6, 0x81f4b63fda2db71d, 0x4eee5393a2df4c84,
+    0xca6e63aeac469c69, 0x27bc807c428e4f01, 0x4a2c23ba5f4ec124, 0x74847cfcaae2668b,
+    0x4435585f6716af4e, 0xb872d8b71cdb965f, 0x662f1962746ffad0, 0x52761a24db5d0187,
+    0xf6a09922a57e0e3d, 0x86c69342a9c12b63, 0x91ff20b65af190c5, 0x10db7a2a4eeee1ae,
+    0xbb464a5374628b90, 0x6e7a1227057a4f25, 0x4c309d690b0fa41f, 0x7548260777fe7b93,
+    0xf2583ec70b612421, 0xff2cfc835e2b15ed, 0x1e97a7db8cabc5cf, 0x1ec08faa925c149f,
+    0xba0170e30e9fcba9, 0x8976df7c70d9939b, 0xeae6e74b21af14dd, 0x09f098680d0861f9,
+    0x4f7fe26e21a781ff, 0x1725b8d0d73dcef7, 0x9da632177e743498, 0x0f51d42c1b828b99,
+    0xbabb076b9afe09bd, 0x4ac8922317c4050d, 0xca3ea6e3da3e57e8, 0x20aaa384a33242c0,
+    0x6d3a1f2def929bf5, 0xb34e2605e751a62d, 0xe1ac629fb8cf1f99, 0x7152d4e3f0bba01a,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_TEST_WIN_5_Z[] = {
+    0xfffffffffffffbcf, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_TEST_COMB_5_XY[] = {
+    0xfffffffffffff36d, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+    0x9af45a5a471125f5, 0x7ce5090af69bf9ae, 0x67617a63e4b6dde6, 0x03f66b354aa3daa4,
+    0x7691f138833070ef, 0xfcadb4ba6b8d5916, 0x9f88dfae4ad685b1, 0x62919b433b6f2d47,
+    0xc2c76639bce58ef9, 0x8716bf9d5204890b, 0x382860cdabd892f3, 0x7209efc60ee42400,
+    0xc48d5cf1381079dc, 0x98ba3bacf65acedc, 0x504d3a526a7cd747, 0x0aa872e6a9948d55,
+    0x874dfa52d14c014e, 0xe9316e161e570454, 0x02c228b07f5eb5e4, 0x336f20022350ee1c,
+    0x0f83f05b95cbb324, 0x304b4165b4ab6ebb, 0xbd6564d5d025326e, 0x7f617d016c06203f,
+    0xaca6fa64ecfd5618, 0x288e3f9101c9021b, 0xac5ed8b521388ffe, 0x3fee7d0a899812c5,
+    0xcb9babb6fef6cf2b, 0xae0f6794edf22c55, 0x55ba91d65a94c94e, 0x63a5f9c9d42d5887,
+    0xbaf53abec3dfae6e, 0x782f960d2ab156f0, 0xbbd442c158ea26e8, 0x691ccfa0214b2727,
+    0x43d19024f91d50b3, 0x171eef2ddeefa7d9, 0xe20a7f05ca7b6e51, 0x3a1941d0b58e276c,
+    0x99eeedda313ad58e, 0x6f86a0d0cbd01fbb, 0x4a768cc1f54aea1a, 0x322401c46b5d2baf,
+    0xe2731996f9deee61, 0x1a0d22b70e087324, 0x8696c230e462e91c, 0x0736daf709c385f3,
+    0xd22a730de3e0f819, 0xcf8fa65bcacf3b2f, 0x329dfbf885e7d72c, 0x23f0d9465194d238,
+    0x68175625ec70d85e, 0x558bd88375461779, 0xfe9006cc19bd9c11, 0x108da0ca34a9c604,
+    0x97d0a40686025489, 0x271282f4e03702ba, 0x13abea0511a620af, 0x4bba48635dbd2fb7,
+    0x13ad20351e3e35d9, 0xe89b5f1f3eef513d, 0x1d9e428a749aa73a, 0x698f4800653b61bb,
+    0x2287603f54d41e58, 0xd6e707cfe5d2ca9f, 0x11f7bb4cb3176ab5, 0x7deb81287087a43d,
+    0x4966511405836a8f, 0xf6661195e2f50123, 0x95a1bf6acf6194d3, 0x5f6e3a9bb0b60cae,
+    0x67096a3be6a02612, 0x8786078e82d3dfff, 0x4f35b853e01158b8, 0x3cbc888e614eccf1,
+    0x4cba08dccaaa792a, 0x352579d1f8832649, 0xfdd5d2eeca70905c, 0x53a5df481c246ed1,
+    0x349e639cbcc0554f, 0x80f24b278a866e9c, 0x5fdbae12c3451d38, 0x0cf208e34573bf60,
+    0x855c36ac37f0b651, 0x49c4a8ffe1392464, 0xd3c3e0efdab3f513, 0x75980cd61f4d674e,
+    0xcccf1d154d25b3a6, 0x454b698142556180, 0xaadf701f5ad6374b, 0x737538dd6a25b414,
+    0x6117d526ed23e12a, 0x2cadc652508df4fe, 0x2b3d4ce1473d22ce, 0x78cf6ec4d7fd2b30,
+    0xf7d759b26b6abb89, 0x3b624d6ba2694f24, 0x2e41a49ac6ea8679, 0x5ac86a73176acee1,
+    0x50347ccca56e326b, 0x668098de84504a0f, 0xf41ac24b03b444cb, 0x75f4d27769dbc2d5,
+    0xcca00fe647073216, 0xf120270278bbee75, 0xcec36761ac60b86e, 0x2dd018754b7d6a6a,
+    0x2a9d9825afdd881f, 0x0915ac03b739c7b9, 0x523f0e016d2c8478, 0x69d33a18fb5c1b6c,
+    0x167c336c8701c19b, 0x5c7b7a058d97e2bb, 0xbfb47966020be541, 0x271b9348df8fbe78,
+    0xc389fa3123522dfa, 0xb3b4086bd7ba45e5, 0xcc876f19f2587ed9, 0x16f8ad71f39af88f,
+    0xe88418952a260f7a, 0xeea9e833785dcc9a, 0xed2b2b24d4c31cab, 0x515e45ac3fb28b7b,
+    0xce213750fc26a285, 0x31b9d842a09acff6, 0x1e067bac794af6eb, 0x5fedc3f464caafe0,
+    0x01b415d5d01f4434, 0xeea3562dcebc0bab, 0x38f46f816ec45041, 0x2f37fd2651a7dd66,
+    0xbb4d39225d5bf4da, 0xe75ee8b8ac2443ec, 0xca1278c5b0cbc1dd, 0x1607602aa25eaf0d,
+    0xdc70136fcc58c031, 0x2f74fc91953986a0, 0x696563d5edbcb280, 0x6706d2658211ceda,
+    0xaf53342348d97e7d, 0x4eadc23357558855, 0x9d572c4a901ad610, 0x3ea876d23d6a2cbc,
+    0xfbbceaf1e6b83543, 0x81a5c79e8975b9da, 0x43790ad901f698a0, 0x330907857edbc905,
+    0x554c6ee6dae13396, 0xe2f8c6711775ce6d, 0x5aaed8da3f78002b, 0x7c3aba3b8300a1c1,
+    0x3f2af1fc3817fcd5, 0x2010d529162cb7d1, 0x8e9cd98c131e7f64, 0x06809f40f4c7814c,
+    0x5f17f909efb4d34e, 0xc2419248b9496efb, 0x7f5dadadd88f1e6f, 0x4e8260558ea5e068,
+    0xdc4c627c24a25608, 0x3b0369de76be3ea8, 0x2be1281ac9059216, 0x655a934557bf1c28,
+    0xc8f20fdad2fc1786, 0xdd83dc4a42ac5bf2, 0xfbac8b5850e08671, 0x66990e2bce38be43,
+    0x284a7170a25a89ed, 0xd78c9b1af4ecdc92, 0x60b41bae2c1992a1, 0x3e63d6dacf92e90a,
+    0x0480152ba914e2eb, 0x9c4ece2be81a8380, 0xfbed045c1aa2ac1f, 0x0c94af97d4a52c1c,
+    0x42851bce61c53116, 0x837466e2603a25dd, 0x50cf6478e8f84089, 0x1b051c1d3ecfa35a,
+    0xd825735a4912013e, 0x0a615ab058c5dd43, 0xe7c9da6c48dbcee8, 0x0ee7db87720dc947,
+    0x8862af47f46212aa, 0x662c2c3ea0581483, 0x8acb7e0c1e78139a, 0x1770d7366c3300ed,
+    0x514302dea1bdb6ae, 0xa02a6643dba86763, 0xb370496c255df3f3, 0x05ad42e02bcdd3bd,
+    0xb474b7c7ba74137c, 0x0f64718249fd5bac, 0xf8c12c09a8a555a4, 0x0028579c9b770612,
+    0x5ec21dee2741ebec, 0xcfa22b275fee8c03, 0x18250af506b0b549, 0x30ae21c5534725aa,
+    0xff68cea52e086b10, 0x15b9b5f224ba30c2, 0x78535e0ad2ba64ee, 0x7f2a536237971cb8,
+    0x32e755f75e060997, 0x62431101a007cbb9, 0x936c590178d3b5e1, 0x12f277693a415b82,
+    0x653c2d9d20485034, 0xeaaee2a46f4a189d, 0xfd840ab499cb93ef, 0x1e44422b669bd3ff,
+    0x26877433d413ae6b, 0xdc9c103aeddaeaa9, 0xce8f19ddd20ba121, 0x28579be3927beb95,
+    0xdbe32c00bea2e55d, 0x8bfadad0425c61e3, 0x0c246398959bef00, 0x45da57f70695ced9,
+    0x32461f009a7d60ad, 0xc975b6156aed32fd, 0xfea1ecf7974e5abe, 0x184e0f9e790dd873,
+    0x8abc2adaa3851a03, 0x0dca1a3e8caa940a, 0x631444642ae22cec, 0x5b99ca48487a3016,
+    0xc1a7caf1af1cdab7, 0xe87d8695b869e8bd, 0x6c5dfcaba02dfed4, 0x0ecf14077fdaba07,
+    0x4e6a9472500f2d0d, 0x6a0ed4502556948e, 0xd01ac47e46dc0898, 0x4d0509286f25d4a3,
+    0x4aa58159bf50e562, 0xc84c14828d9bd7c8, 0xf33261f6b0cb84a0, 0x446b1758dba9b170,
+    0xc3af1ec8186b1db1, 0x6f65b13ee1176a2f, 0x4fd0068bcc594eac, 0x1cc33da2f37d1a78,
+};
+
+static const word_t EC_PARAMS_ID_GOST_P256_TEST_COMB_5_Z[] = {
+    0xfffffffffffffbcf, 0xffffffffffffffff, 0xffffffffffffffff, 0x7fffffffffffffff,
+};
+
+static const EcPrecompStatic EC_PRECOMP_STATIC[] = {
+    {EC_PARAMS_ID_DSTU4145_M163_PB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M163_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M163_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M163_PB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M163_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M163_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M167_PB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M167_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M167_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M167_PB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M167_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M167_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M173_PB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M173_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M173_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M173_PB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M173_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M173_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M179_PB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M179_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M179_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M179_PB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M179_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M179_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M191_PB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M191_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M191_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M191_PB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M191_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M191_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M233_PB, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_DSTU4145_M233_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M233_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M233_PB, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_DSTU4145_M233_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M233_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M257_PB, EC_PRECOMP_TYPE_WIN, 5, 5, 8, EC_PARAMS_ID_DSTU4145_M257_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M257_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M257_PB, EC_PRECOMP_TYPE_COMB, 5, 5, 31, EC_PARAMS_ID_DSTU4145_M257_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M257_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M307_PB, EC_PRECOMP_TYPE_WIN, 5, 5, 8, EC_PARAMS_ID_DSTU4145_M307_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M307_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M307_PB, EC_PRECOMP_TYPE_COMB, 5, 5, 31, EC_PARAMS_ID_DSTU4145_M307_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M307_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M367_PB, EC_PRECOMP_TYPE_WIN, 5, 6, 8, EC_PARAMS_ID_DSTU4145_M367_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M367_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M367_PB, EC_PRECOMP_TYPE_COMB, 5, 6, 31, EC_PARAMS_ID_DSTU4145_M367_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M367_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M431_PB, EC_PRECOMP_TYPE_WIN, 5, 7, 8, EC_PARAMS_ID_DSTU4145_M431_PB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M431_PB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M431_PB, EC_PRECOMP_TYPE_COMB, 5, 7, 31, EC_PARAMS_ID_DSTU4145_M431_PB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M431_PB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M173_ONB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M173_ONB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M173_ONB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M173_ONB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M173_ONB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M173_ONB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M179_ONB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M179_ONB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M179_ONB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M179_ONB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M179_ONB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M179_ONB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M191_ONB, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M191_ONB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M191_ONB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M191_ONB, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M191_ONB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M191_ONB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M233_ONB, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_DSTU4145_M233_ONB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M233_ONB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M233_ONB, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_DSTU4145_M233_ONB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M233_ONB_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M431_ONB, EC_PRECOMP_TYPE_WIN, 5, 7, 8, EC_PARAMS_ID_DSTU4145_M431_ONB_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M431_ONB_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M431_ONB, EC_PRECOMP_TYPE_COMB, 5, 7, 31, EC_PARAMS_ID_DSTU4145_M431_ONB_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M431_ONB_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_P192, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_NIST_P192_WIN_5_XY, EC_PARAMS_ID_NIST_P192_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_P192, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_NIST_P192_COMB_5_XY, EC_PARAMS_ID_NIST_P192_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_P224, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_NIST_P224_WIN_5_XY, EC_PARAMS_ID_NIST_P224_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_P224, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_NIST_P224_COMB_5_XY, EC_PARAMS_ID_NIST_P224_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_P256, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_NIST_P256_WIN_5_XY, EC_PARAMS_ID_NIST_P256_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_P256, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_NIST_P256_COMB_5_XY, EC_PARAMS_ID_NIST_P256_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_P384, EC_PRECOMP_TYPE_WIN, 5, 6, 8, EC_PARAMS_ID_NIST_P384_WIN_5_XY, EC_PARAMS_ID_NIST_P384_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_P384, EC_PRECOMP_TYPE_COMB, 5, 6, 31, EC_PARAMS_ID_NIST_P384_COMB_5_XY, EC_PARAMS_ID_NIST_P384_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_P521, EC_PRECOMP_TYPE_WIN, 5, 9, 8, EC_PARAMS_ID_NIST_P521_WIN_5_XY, EC_PARAMS_ID_NIST_P521_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_P521, EC_PRECOMP_TYPE_COMB, 5, 9, 31, EC_PARAMS_ID_NIST_P521_COMB_5_XY, EC_PARAMS_ID_NIST_P521_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_B163, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_NIST_B163_WIN_5_XY, EC_PARAMS_ID_NIST_B163_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_B163, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_NIST_B163_COMB_5_XY, EC_PARAMS_ID_NIST_B163_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_B233, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_NIST_B233_WIN_5_XY, EC_PARAMS_ID_NIST_B233_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_B233, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_NIST_B233_COMB_5_XY, EC_PARAMS_ID_NIST_B233_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_B283, EC_PRECOMP_TYPE_WIN, 5, 5, 8, EC_PARAMS_ID_NIST_B283_WIN_5_XY, EC_PARAMS_ID_NIST_B283_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_B283, EC_PRECOMP_TYPE_COMB, 5, 5, 31, EC_PARAMS_ID_NIST_B283_COMB_5_XY, EC_PARAMS_ID_NIST_B283_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_B409, EC_PRECOMP_TYPE_WIN, 5, 7, 8, EC_PARAMS_ID_NIST_B409_WIN_5_XY, EC_PARAMS_ID_NIST_B409_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_B409, EC_PRECOMP_TYPE_COMB, 5, 7, 31, EC_PARAMS_ID_NIST_B409_COMB_5_XY, EC_PARAMS_ID_NIST_B409_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_B571, EC_PRECOMP_TYPE_WIN, 5, 9, 8, EC_PARAMS_ID_NIST_B571_WIN_5_XY, EC_PARAMS_ID_NIST_B571_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_B571, EC_PRECOMP_TYPE_COMB, 5, 9, 31, EC_PARAMS_ID_NIST_B571_COMB_5_XY, EC_PARAMS_ID_NIST_B571_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_K163, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_NIST_K163_WIN_5_XY, EC_PARAMS_ID_NIST_K163_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_K163, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_NIST_K163_COMB_5_XY, EC_PARAMS_ID_NIST_K163_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_K233, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_NIST_K233_WIN_5_XY, EC_PARAMS_ID_NIST_K233_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_K233, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_NIST_K233_COMB_5_XY, EC_PARAMS_ID_NIST_K233_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_K283, EC_PRECOMP_TYPE_WIN, 5, 5, 8, EC_PARAMS_ID_NIST_K283_WIN_5_XY, EC_PARAMS_ID_NIST_K283_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_K283, EC_PRECOMP_TYPE_COMB, 5, 5, 31, EC_PARAMS_ID_NIST_K283_COMB_5_XY, EC_PARAMS_ID_NIST_K283_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_K409, EC_PRECOMP_TYPE_WIN, 5, 7, 8, EC_PARAMS_ID_NIST_K409_WIN_5_XY, EC_PARAMS_ID_NIST_K409_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_K409, EC_PRECOMP_TYPE_COMB, 5, 7, 31, EC_PARAMS_ID_NIST_K409_COMB_5_XY, EC_PARAMS_ID_NIST_K409_COMB_5_Z},
+    {EC_PARAMS_ID_NIST_K571, EC_PRECOMP_TYPE_WIN, 5, 9, 8, EC_PARAMS_ID_NIST_K571_WIN_5_XY, EC_PARAMS_ID_NIST_K571_WIN_5_Z},
+    {EC_PARAMS_ID_NIST_K571, EC_PRECOMP_TYPE_COMB, 5, 9, 31, EC_PARAMS_ID_NIST_K571_COMB_5_XY, EC_PARAMS_ID_NIST_K571_COMB_5_Z},
+    {EC_PARAMS_ID_SEC_P256_K1, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_SEC_P256_K1_WIN_5_XY, EC_PARAMS_ID_SEC_P256_K1_WIN_5_Z},
+    {EC_PARAMS_ID_SEC_P256_K1, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_SEC_P256_K1_COMB_5_XY, EC_PARAMS_ID_SEC_P256_K1_COMB_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P224_R1, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_BRAINPOOL_P224_R1_WIN_5_XY, EC_PARAMS_ID_BRAINPOOL_P224_R1_WIN_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P224_R1, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_BRAINPOOL_P224_R1_COMB_5_XY, EC_PARAMS_ID_BRAINPOOL_P224_R1_COMB_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P256_R1, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_BRAINPOOL_P256_R1_WIN_5_XY, EC_PARAMS_ID_BRAINPOOL_P256_R1_WIN_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P256_R1, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_BRAINPOOL_P256_R1_COMB_5_XY, EC_PARAMS_ID_BRAINPOOL_P256_R1_COMB_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P384_R1, EC_PRECOMP_TYPE_WIN, 5, 6, 8, EC_PARAMS_ID_BRAINPOOL_P384_R1_WIN_5_XY, EC_PARAMS_ID_BRAINPOOL_P384_R1_WIN_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P384_R1, EC_PRECOMP_TYPE_COMB, 5, 6, 31, EC_PARAMS_ID_BRAINPOOL_P384_R1_COMB_5_XY, EC_PARAMS_ID_BRAINPOOL_P384_R1_COMB_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P512_R1, EC_PRECOMP_TYPE_WIN, 5, 8, 8, EC_PARAMS_ID_BRAINPOOL_P512_R1_WIN_5_XY, EC_PARAMS_ID_BRAINPOOL_P512_R1_WIN_5_Z},
+    {EC_PARAMS_ID_BRAINPOOL_P512_R1, EC_PRECOMP_TYPE_COMB, 5, 8, 31, EC_PARAMS_ID_BRAINPOOL_P512_R1_COMB_5_XY, EC_PARAMS_ID_BRAINPOOL_P512_R1_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P256_A, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_GOST_P256_A_WIN_5_XY, EC_PARAMS_ID_GOST_P256_A_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P256_A, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_GOST_P256_A_COMB_5_XY, EC_PARAMS_ID_GOST_P256_A_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P256_B, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_GOST_P256_B_WIN_5_XY, EC_PARAMS_ID_GOST_P256_B_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P256_B, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_GOST_P256_B_COMB_5_XY, EC_PARAMS_ID_GOST_P256_B_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P256_C, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_GOST_P256_C_WIN_5_XY, EC_PARAMS_ID_GOST_P256_C_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P256_C, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_GOST_P256_C_COMB_5_XY, EC_PARAMS_ID_GOST_P256_C_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P512_A, EC_PRECOMP_TYPE_WIN, 5, 8, 8, EC_PARAMS_ID_GOST_P512_A_WIN_5_XY, EC_PARAMS_ID_GOST_P512_A_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P512_A, EC_PRECOMP_TYPE_COMB, 5, 8, 31, EC_PARAMS_ID_GOST_P512_A_COMB_5_XY, EC_PARAMS_ID_GOST_P512_A_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P512_B, EC_PRECOMP_TYPE_WIN, 5, 8, 8, EC_PARAMS_ID_GOST_P512_B_WIN_5_XY, EC_PARAMS_ID_GOST_P512_B_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P512_B, EC_PRECOMP_TYPE_COMB, 5, 8, 31, EC_PARAMS_ID_GOST_P512_B_COMB_5_XY, EC_PARAMS_ID_GOST_P512_B_COMB_5_Z},
+    {EC_PARAMS_ID_SM2_P256, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_SM2_P256_WIN_5_XY, EC_PARAMS_ID_SM2_P256_WIN_5_Z},
+    {EC_PARAMS_ID_SM2_P256, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_SM2_P256_COMB_5_XY, EC_PARAMS_ID_SM2_P256_COMB_5_Z},
+    {EC_PARAMS_ID_CN_P256, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_CN_P256_WIN_5_XY, EC_PARAMS_ID_CN_P256_WIN_5_Z},
+    {EC_PARAMS_ID_CN_P256, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_CN_P256_COMB_5_XY, EC_PARAMS_ID_CN_P256_COMB_5_Z},
+    {EC_PARAMS_ID_CN_B257, EC_PRECOMP_TYPE_WIN, 5, 5, 8, EC_PARAMS_ID_CN_B257_WIN_5_XY, EC_PARAMS_ID_CN_B257_WIN_5_Z},
+    {EC_PARAMS_ID_CN_B257, EC_PRECOMP_TYPE_COMB, 5, 5, 31, EC_PARAMS_ID_CN_B257_COMB_5_XY, EC_PARAMS_ID_CN_B257_COMB_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M163_PB_TEST, EC_PRECOMP_TYPE_WIN, 5, 3, 8, EC_PARAMS_ID_DSTU4145_M163_PB_TEST_WIN_5_XY, EC_PARAMS_ID_DSTU4145_M163_PB_TEST_WIN_5_Z},
+    {EC_PARAMS_ID_DSTU4145_M163_PB_TEST, EC_PRECOMP_TYPE_COMB, 5, 3, 31, EC_PARAMS_ID_DSTU4145_M163_PB_TEST_COMB_5_XY, EC_PARAMS_ID_DSTU4145_M163_PB_TEST_COMB_5_Z},
+    {EC_PARAMS_ID_GOST_P256_TEST, EC_PRECOMP_TYPE_WIN, 5, 4, 8, EC_PARAMS_ID_GOST_P256_TEST_WIN_5_XY, EC_PARAMS_ID_GOST_P256_TEST_WIN_5_Z},
+    {EC_PARAMS_ID_GOST_P256_TEST, EC_PRECOMP_TYPE_COMB, 5, 4, 31, EC_PARAMS_ID_GOST_P256_TEST_COMB_5_XY, EC_PARAMS_ID_GOST_P256_TEST_COMB_5_Z},
+};
+
+#endif
+
+#endif
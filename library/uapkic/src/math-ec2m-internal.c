@@ -31,50 +31,32 @@
 #include "math-ec2m-internal.h"
 #include "math-int-internal.h"
 #include "macros-internal.h"
+#include "byte-utils-internal.h"
 
 static int ec2m_points_to_affine(EcGf2mCtx *ctx, ECPoint **array, int off, int len)
 {
-    /* Получить a0, a0*a1, ..., a0*...*aN. */
-    WordArray **k = NULL;
-    WordArray *t = NULL;
+    WordArray **z = NULL;
     int i;
     int ret = RET_OK;
 
-    CALLOC_CHECKED(k, len * sizeof(WordArray *));
-    CHECK_NOT_NULL(k[0] = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t = wa_alloc(ctx->len));
-
-    DO(wa_copy(array[off]->z, k[0]));
-
-    for (i = 1; i < len; i++) {
-        CHECK_NOT_NULL(k[i] = wa_alloc(ctx->len));
-        gf2m_mod_mul(ctx->gf2m, array[i + off]->z, k[i - 1], k[i]);
+    CALLOC_CHECKED(z, len * sizeof(WordArray *));
+    for (i = 0; i < len; i++) {
+        z[i] = array[i + off]->z;
     }
 
-    /* inv = (a0*...*aN)^(-1). */
-    gf2m_mod_inv(ctx->gf2m, k[len - 1], t);
-
-    /* k[i] = ai^(-1) i = 0, 1, ... */
-    for (i = len - 1; i > 0; i--) {
-        gf2m_mod_mul(ctx->gf2m, t, k[i - 1], k[i]);
-        gf2m_mod_mul(ctx->gf2m, t, array[i + off]->z, t);
-    }
-    wa_copy(t, k[0]);
+    /* z[i] = z[i]^(-1). */
+    DO(gf2m_mod_inv_batch(ctx->gf2m, z, len, z));
 
     for (i = 0; i < len; i++) {
-        gf2m_mod_mul(ctx->gf2m, array[i + off]->x, k[i], array[i + off]->x);
-        gf2m_mod_sqr(ctx->gf2m, k[i], k[i]);
-        gf2m_mod_mul(ctx->gf2m, array[i + off]->y, k[i], array[i + off]->y);
-        wa_one(array[i + off]->z);
+        gf2m_mod_mul(ctx->gf2m, array[i + off]->x, z[i], array[i + off]->x);
+        gf2m_mod_sqr(ctx->gf2m, z[i], z[i]);
+        gf2m_mod_mul(ctx->gf2m, array[i + off]->y, z[i], array[i + off]->y);
+        wa_one(z[i]);
     }
 
 cleanup:
 
-    for (i = 0; i < len; i++) {
-        wa_free(k[i]);
-    }
-    free(k);
-    wa_free(t);
+    free(z);
 
     return ret;
 }
@@ -87,6 +69,7 @@ EcGf2mCtx *ec2m_alloc(const int *f, size_t f_len, size_t a, const WordArray *b)
     CHECK_PARAM(f != NULL);
     CHECK_PARAM(b != NULL);
     CHECK_PARAM((f_len == 3 || f_len == 5));
+    CHECK_PARAM(f[0] < GF2M_MAX_LEN * WORD_BIT_LENGTH);
 
     CALLOC_CHECKED(ctx, sizeof(EcGf2mCtx));
 
@@ -159,25 +142,21 @@ cleanup:
  */
 void ec2m_double(const EcGf2mCtx *ctx, const ECPoint *p, ECPoint *r)
 {
-    WordArray *t1 = NULL;
-    WordArray *t2 = NULL;
-    int ret = RET_OK;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(r != NULL);
     ASSERT(ctx->len == p->x->len);
     ASSERT(ctx->len == r->x->len);
 
+    WA_STACK(t1, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t2, GF2M_MAX_LEN, ctx->len);
+
     if (int_is_zero(p->x)) {
         /* точка на бесконечности */
         ec_point_zero(r);
         return;
     }
 
-    CHECK_NOT_NULL(t1 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t2 = wa_alloc(ctx->len));
-
     gf2m_mod_sqr(ctx->gf2m, p->x, t1);
     gf2m_mod_sqr(ctx->gf2m, p->z, r->z);
     gf2m_mod_sqr(ctx->gf2m, r->z, t2);
@@ -196,9 +175,6 @@ void ec2m_double(const EcGf2mCtx *ctx, const ECPoint *p, ECPoint *r)
     gf2m_mod_mul(ctx->gf2m, r->x, t1, t1);
     gf2m_mod_mul(ctx->gf2m, r->z, t2, r->y);
     gf2m_mod_add(r->y, t1, r->y);
-cleanup:
-    wa_free(t1);
-    wa_free(t2);
 }
 
 /**
@@ -213,11 +189,6 @@ cleanup:
  */
 void ec2m_add(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *qx, const WordArray *qy, int sign, ECPoint *r)
 {
-    WordArray *t1 = NULL;
-    WordArray *t2 = NULL;
-    WordArray *t3 = NULL;
-    int ret = RET_OK;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(qx != NULL);
@@ -228,6 +199,10 @@ void ec2m_add(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *qx, const
     ASSERT(ctx->len == qy->len);
     ASSERT(ctx->len == r->x->len);
 
+    WA_STACK(t1, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t2, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t3, GF2M_MAX_LEN, ctx->len);
+
     /* Q == O ? */
     if (int_is_zero(qx) && int_is_zero(qy)) {
         ec_point_copy(p, r);
@@ -249,10 +224,6 @@ void ec2m_add(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *qx, const
         return;
     }
 
-    CHECK_NOT_NULL(t1 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t2 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t3 = wa_alloc(ctx->len));
-
     gf2m_mod_sqr(ctx->gf2m, p->z, t1);
     if (sign == -1) {
         gf2m_mod_add(qx, qy, t2);
@@ -268,13 +239,13 @@ void ec2m_add(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *qx, const
     /* P == Q ? */
     if (int_is_zero(t1) && int_is_zero(t2)) {
         ec2m_double(ctx, p, r);
-        goto cleanup;
+        return;
     }
 
     /* P і Q взаимно обратны. */
     if (int_is_zero(t2)) {
         ec_point_zero(r);
-        goto cleanup;
+        return;
     }
 
     gf2m_mod_mul(ctx->gf2m, t2, p->z, t3);
@@ -306,39 +277,180 @@ void ec2m_add(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *qx, const
 
     gf2m_mod_mul(ctx->gf2m, t1, t2, t1);
     gf2m_mod_add(t1, r->y, r->y);
-
-cleanup:
-
-    wa_free(t1);
-    wa_free(t2);
-    wa_free(t3);
 }
 
 void ec2m_point_to_affine(const EcGf2mCtx *ctx, ECPoint *p)
 {
-    WordArray *t = NULL;
-    int ret = RET_OK;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(ctx->len == p->x->len);
 
+    WA_STACK(t, GF2M_MAX_LEN, ctx->len);
+
     if (int_is_zero(p->x) && int_is_zero(p->y)) {
         wa_one(p->z);
         return;
     }
 
-    CHECK_NOT_NULL(t = wa_alloc(ctx->len));
-
     gf2m_mod_inv(ctx->gf2m, p->z, t);
     gf2m_mod_mul(ctx->gf2m, p->x, t, p->x);
     gf2m_mod_sqr(ctx->gf2m, t, t);
     gf2m_mod_mul(ctx->gf2m, p->y, t, p->y);
     wa_one(p->z);
+}
 
-cleanup:
+/* Умовний обмін значень a та b без розгалужень, mask = 0 або ~0. */
+static void ec2m_wa_cswap(WordArray *a, WordArray *b, word_t mask)
+{
+    size_t i;
+    word_t t;
+
+    for (i = 0; i < a->len; i++) {
+        t = (a->buf[i] ^ b->buf[i]) & mask;
+        a->buf[i] ^= t;
+        b->buf[i] ^= t;
+    }
+}
+
+/**
+ * Сходи Монтгомері у x-координатах Лопеса-Дахаба з відновленням y.
+ * Кількість кроків дорівнює бітовій довжині порядку базової точки і не залежить від k,
+ * на кожному кроці виконується однаковий набір операцій (6M + 5S).
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p точка еліптичної кривої в афінних координатах
+ * @param k целое число
+ * @param r результат k * P в афінних координатах
+ */
+static void ec2m_mul_ladder(const EcGf2mCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r)
+{
+    const Gf2mCtx *gf2m = ctx->gf2m;
+    size_t bits;
+    word_t high = 0;
+    size_t w;
+    word_t swap = 0;
+    word_t bit;
+    int i;
+
+    ASSERT(ctx != NULL);
+    ASSERT(p != NULL);
+    ASSERT(k != NULL);
+    ASSERT(r != NULL);
+
+    WA_STACK(x, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(y, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(x1, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(z1, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(x2, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(z2, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t1, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t2, GF2M_MAX_LEN, ctx->len);
+
+    if (int_is_zero(p->x) && int_is_zero(p->y)) {
+        ec_point_zero(r);
+        return;
+    }
+
+    /* x = 0: точка (0, sqrt(b)) порядку 2, формули сходів для неї вироджуються. */
+    if (int_is_zero(p->x)) {
+        if (int_get_bit(k, 0)) {
+            ec_point_copy(p, r);
+            wa_one(r->z);
+        } else {
+            ec_point_zero(r);
+        }
+        return;
+    }
+
+    /* Скаляр, довший за порядок, обробляється на всю довжину масиву. */
+    bits = ctx->order_bits;
+    w = bits >> WORD_BIT_LEN_SHIFT;
+    if (w < k->len) {
+        high = k->buf[w] >> (bits & WORD_BIT_LEN_MASK);
+        for (w++; w < k->len; w++) {
+            high |= k->buf[w];
+        }
+    }
+    if (bits == 0 || high != 0) {
+        bits = k->len * WORD_BIT_LENGTH;
+    }
+
+    wa_copy(p->x, x);
+    wa_copy(p->y, y);
+
+    /* (x1 : z1) = O, (x2 : z2) = P, різниця завжди дорівнює P. */
+    wa_one(x1);
+    wa_zero(z1);
+    wa_copy(x, x2);
+    wa_one(z2);
+
+    for (i = (int)bits - 1; i >= 0; i--) {
+        bit = (word_t)int_get_bit(k, i);
+        ec2m_wa_cswap(x1, x2, (word_t)0 - (swap ^ bit));
+        ec2m_wa_cswap(z1, z2, (word_t)0 - (swap ^ bit));
+        swap = bit;
+
+        /* (x2 : z2) = (x1 : z1) + (x2 : z2). */
+        gf2m_mod_mul(gf2m, x1, z2, t1);
+        gf2m_mod_mul(gf2m, x2, z1, t2);
+        gf2m_mod_add(t1, t2, z2);
+        gf2m_mod_sqr(gf2m, z2, z2);
+        gf2m_mod_mul(gf2m, t1, t2, t1);
+        gf2m_mod_mul(gf2m, x, z2, x2);
+        gf2m_mod_add(x2, t1, x2);
+
+        /* (x1 : z1) = 2 * (x1 : z1). */
+        gf2m_mod_sqr(gf2m, x1, t1);
+        gf2m_mod_sqr(gf2m, z1, t2);
+        gf2m_mod_mul(gf2m, t1, t2, z1);
+        gf2m_mod_sqr(gf2m, t1, t1);
+        gf2m_mod_sqr(gf2m, t2, t2);
+        gf2m_mod_mul(gf2m, ctx->b, t2, t2);
+        gf2m_mod_add(t1, t2, x1);
+    }
+    ec2m_wa_cswap(x1, x2, (word_t)0 - swap);
+    ec2m_wa_cswap(z1, z2, (word_t)0 - swap);
+
+    /* k * P = O. */
+    if (int_is_zero(z1)) {
+        ec_point_zero(r);
+        return;
+    }
+
+    /* k * P = -P. */
+    if (int_is_zero(z2)) {
+        wa_copy(x, r->x);
+        gf2m_mod_add(x, y, r->y);
+        wa_one(r->z);
+        return;
+    }
 
-    wa_free(t);
+    /* t1 = (x * z1 * z2)^(-1). */
+    gf2m_mod_mul(gf2m, z1, z2, t2);
+    gf2m_mod_mul(gf2m, x, t2, t1);
+    gf2m_mod_inv(gf2m, t1, t1);
+
+    /* t2 = (x1 + x * z1) * (x2 + x * z2) + (x^2 + y) * z1 * z2. */
+    gf2m_mod_sqr(gf2m, x, r->y);
+    gf2m_mod_add(r->y, y, r->y);
+    gf2m_mod_mul(gf2m, r->y, t2, t2);
+    gf2m_mod_mul(gf2m, x, z1, r->y);
+    gf2m_mod_add(r->y, x1, r->y);
+    gf2m_mod_mul(gf2m, x, z2, r->z);
+    gf2m_mod_add(r->z, x2, x2);
+    gf2m_mod_mul(gf2m, r->y, x2, r->y);
+    gf2m_mod_add(t2, r->y, t2);
+
+    /* x3 = x1 / z1 = x1 * x * z2 * t1. */
+    gf2m_mod_mul(gf2m, x1, r->z, x1);
+    gf2m_mod_mul(gf2m, x1, t1, r->x);
+
+    /* y3 = (x + x3) * t2 * t1 + y. */
+    gf2m_mod_add(x, r->x, r->y);
+    gf2m_mod_mul(gf2m, r->y, t2, r->y);
+    gf2m_mod_mul(gf2m, r->y, t1, r->y);
+    gf2m_mod_add(r->y, y, r->y);
+    wa_one(r->z);
 }
 
 void ec2m_mul(EcGf2mCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r)
@@ -355,6 +467,11 @@ void ec2m_mul(EcGf2mCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r)
     ASSERT(ctx->len == p->x->len);
     ASSERT(ctx->len == r->x->len);
 
+    if (ctx->use_ladder) {
+        ec2m_mul_ladder(ctx, p, k, r);
+        return;
+    }
+
     if (p == r) {
         CHECK_NOT_NULL(p_ptr = ec_point_copy_with_alloc(p));
     } else {
@@ -600,24 +717,36 @@ static void ec2m_dual_mul_opt_extra_addition(const EcGf2mCtx *ctx, const EcPreco
     }
 }
 
-int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
-        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r)
+/**
+ * Обчислює m * P + n * Q, залишаючи результат у проективних координатах.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p_precomp предварительные обчислення для точки P
+ * @param m число на яке умножается p
+ * @param q_precomp предварительные обчислення для точки Q
+ * @param n число на яке умножается q
+ * @param r = m * P + n * Q
+ * @param blind буфер для додаткових операцій, які вирівнюють час для "слабких" naf ключів, або NULL
+ *
+ * @return код помилки
+ */
+static int ec2m_dual_mul_proj(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
+        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r, ECPoint *blind)
 {
+    int n_naf_buf[INT_NAF_BUF_LEN];
+    int m_naf_buf[INT_NAF_BUF_LEN];
     int *n_naf = NULL;
     int *m_naf = NULL;
     int iter_max = 0;
     int iter_q = 0;
     int i = 0;
     int ret = RET_OK;
-    ECPoint *tmp = NULL;
 
     ASSERT(ctx != NULL);
     ASSERT(p_precomp != NULL);
     ASSERT(m != NULL);
     ASSERT(ctx->len == r->x->len);
 
-    CHECK_NOT_NULL(tmp = ec_point_copy_with_alloc(r));
-
     int iter_p = 0;
     int m_bit_len = ctx->gf2m->f[0];
 
@@ -629,7 +758,8 @@ int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const Wo
             ASSERT(ctx->len == p_precomp->ctx.win->precomp[0]->x->len);
 
             iter_p = (int)int_bit_len(m);
-            DO(int_get_naf(m, p_precomp->ctx.win->win_width, &m_naf));
+            m_naf = m_naf_buf;
+            DO(int_get_naf(m, p_precomp->ctx.win->win_width, m_naf));
             for (; (m_naf[iter_p] == 0) && (iter_p > 0); iter_p--);
         }
     }
@@ -642,7 +772,8 @@ int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const Wo
             ASSERT(ctx->len == q_precomp->ctx.win->precomp[0]->x->len);
 
             iter_q = (int)int_bit_len(n);
-            DO(int_get_naf(n, q_precomp->ctx.win->win_width, &n_naf));
+            n_naf = n_naf_buf;
+            DO(int_get_naf(n, q_precomp->ctx.win->win_width, n_naf));
             for (; (n_naf[iter_q] == 0) && (iter_q > 0); iter_q--);
         }
     }
@@ -666,16 +797,122 @@ int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const Wo
     }
 
     //Дополнительные операции для размазывания времени у "слабых" naf ключей
-    ec2m_dual_mul_opt_extra_addition(ctx, p_precomp, m, m_naf, tmp);
-    ec2m_dual_mul_opt_extra_addition(ctx, q_precomp, n, n_naf, tmp);
+    if (blind != NULL) {
+        ec2m_dual_mul_opt_extra_addition(ctx, p_precomp, m, m_naf, blind);
+        ec2m_dual_mul_opt_extra_addition(ctx, q_precomp, n, n_naf, blind);
+    }
+
+cleanup:
+
+    if (n_naf != NULL) {
+        secure_zero(n_naf, ((n->len << WORD_BIT_LEN_SHIFT) + 1) * sizeof(int));
+    }
+    if (m_naf != NULL) {
+        secure_zero(m_naf, ((m->len << WORD_BIT_LEN_SHIFT) + 1) * sizeof(int));
+    }
+
+    return ret;
+}
+
+int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
+        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r)
+{
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(r != NULL);
+
+    EC_POINT_STACK(tmp, GF2M_MAX_LEN, r->x->len);
+    ec_point_copy(r, tmp);
+
+    DO(ec2m_dual_mul_proj(ctx, p_precomp, m, q_precomp, n, r, tmp));
 
     ec2m_point_to_affine(ctx, r);
 
 cleanup:
 
-    ec_point_free(tmp);
-    free(n_naf);
-    free(m_naf);
+    return ret;
+}
+
+int ec2m_dual_mul_batch(EcGf2mCtx *ctx, const EcPrecomp *p_precomp, WordArray *const *m,
+        ECPoint *const *q, WordArray *const *n, size_t count, int width, ECPoint **r)
+{
+    ECPoint **dbl = NULL;
+    ECPoint **tab = NULL;
+    EcPrecompWin q_win;
+    EcPrecomp q_precomp;
+    size_t tab_len = 0;
+    size_t i;
+    int precomp_len;
+    int j;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(p_precomp != NULL);
+    CHECK_PARAM(m != NULL);
+    CHECK_PARAM(q != NULL);
+    CHECK_PARAM(n != NULL);
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(width >= 2);
+
+    if (count == 0) {
+        return RET_OK;
+    }
+
+    precomp_len = 1 << (width - 2);
+    tab_len = count * precomp_len;
+
+    CALLOC_CHECKED(dbl, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(tab, tab_len * sizeof(ECPoint *));
+    for (i = 0; i < count; i++) {
+        CHECK_PARAM(ctx->len == q[i]->x->len);
+        CHECK_NOT_NULL(dbl[i] = ec_point_alloc(ctx->len));
+    }
+    for (i = 0; i < tab_len; i++) {
+        CHECK_NOT_NULL(tab[i] = ec_point_alloc(ctx->len));
+    }
+
+    /* Вікна для всіх Q_i будуються разом: одна інверсія для 2 * Q_i і одна для таблиць. */
+    for (i = 0; i < count; i++) {
+        ec_point_copy(q[i], tab[i * precomp_len]);
+        ec2m_double(ctx, tab[i * precomp_len], dbl[i]);
+    }
+    DO(ec2m_points_to_affine(ctx, dbl, 0, (int)count));
+
+    for (i = 0; i < count; i++) {
+        for (j = 1; j < precomp_len; j++) {
+            ec2m_add(ctx, tab[i * precomp_len + j - 1], dbl[i]->x, dbl[i]->y, 1, tab[i * precomp_len + j]);
+        }
+    }
+    DO(ec2m_points_to_affine(ctx, tab, 0, (int)tab_len));
+
+    q_win.precomp_len = precomp_len;
+    q_win.win_width = width;
+    q_precomp.type = EC_PRECOMP_TYPE_WIN;
+    q_precomp.ctx.win = &q_win;
+
+    for (i = 0; i < count; i++) {
+        CHECK_PARAM(ctx->len == r[i]->x->len);
+        q_win.precomp = &tab[i * precomp_len];
+        DO(ec2m_dual_mul_proj(ctx, p_precomp, m[i], &q_precomp, n[i], r[i], NULL));
+    }
+
+    DO(ec2m_points_to_affine(ctx, r, 0, (int)count));
+
+cleanup:
+
+    if (dbl != NULL) {
+        for (i = 0; i < count; i++) {
+            ec_point_free(dbl[i]);
+        }
+        free(dbl);
+    }
+    if (tab != NULL) {
+        for (i = 0; i < tab_len; i++) {
+            ec_point_free(tab[i]);
+        }
+        free(tab);
+    }
 
     return ret;
 }
@@ -691,6 +928,8 @@ EcGf2mCtx *ec2m_copy_with_alloc(EcGf2mCtx *ctx)
 
     ctx_copy->a = ctx->a;
     ctx_copy->len = ctx->len;
+    ctx_copy->use_ladder = ctx->use_ladder;
+    ctx_copy->order_bits = ctx->order_bits;
 
     CHECK_NOT_NULL(ctx_copy->b = wa_copy_with_alloc(ctx->b));
     CHECK_NOT_NULL(ctx_copy->gf2m = gf2m_copy_with_alloc(ctx->gf2m));
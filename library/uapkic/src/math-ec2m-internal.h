@@ -45,6 +45,8 @@ typedef struct EC2m_st {
     size_t a;               /* коефіцієнт еліптичної кривої a (0 або 1). */
     WordArray *b;           /* коефіцієнт еліптичної кривої b. */
     size_t len;
+    bool use_ladder;        /* Множення точки на число сходами Монтгомері. */
+    size_t order_bits;      /* Бітова довжина порядку базової точки, кількість кроків сходів. */
 } EcGf2mCtx;
 
 EcGf2mCtx *ec2m_alloc(const int *f, size_t f_len, size_t a, const WordArray *b);
@@ -85,6 +87,26 @@ void ec2m_mul(EcGf2mCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r);
 int ec2m_dual_mul_opt(const EcGf2mCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
         const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r);
 
+/**
+ * Обчислює r[i] = m[i] * P + n[i] * Q[i] для пакета точок Q[i].
+ *
+ * Вікна для Q[i] будуються з width і нормалізуються спільно,
+ * результати переводяться в аффінні координати однією інверсією.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p_precomp предварительные обчислення для точки P
+ * @param m числа на які умножается p
+ * @param q аффінні точки Q[i], відмінні від нескінченно віддаленої
+ * @param n числа на які умножаются q
+ * @param count кількість елементів пакета
+ * @param width ширина окна для точок Q[i]
+ * @param r результати
+ *
+ * @return код помилки
+ */
+int ec2m_dual_mul_batch(EcGf2mCtx *ctx, const EcPrecomp *p_precomp, WordArray *const *m,
+        ECPoint *const *q, WordArray *const *n, size_t count, int width, ECPoint **r);
+
 /**
  * Вычисляет сумму двух умножений точек еліптичної кривої на число.
  *
@@ -31,6 +31,7 @@
 #include "math-ecp-internal.h"
 #include "math-int-internal.h"
 #include "macros-internal.h"
+#include "byte-utils-internal.h"
 
 EcGfpCtx *ecp_alloc(const WordArray *p, const WordArray *a, const WordArray *b)
 {
@@ -40,6 +41,7 @@ EcGfpCtx *ecp_alloc(const WordArray *p, const WordArray *a, const WordArray *b)
     CHECK_PARAM(p != NULL);
     CHECK_PARAM(a != NULL);
     CHECK_PARAM(b != NULL);
+    CHECK_PARAM(p->len <= ECP_MAX_LEN);
 
     CALLOC_CHECKED(ctx, sizeof(EcGfpCtx));
 
@@ -61,6 +63,7 @@ EcGfpCtx *ecp_copy_with_alloc(EcGfpCtx *ctx)
     CHECK_NOT_NULL(ctx_copy->a = wa_copy_with_alloc(ctx->a));
     ctx_copy->a_equal_minus_3 = ctx->a_equal_minus_3;
     CHECK_NOT_NULL(ctx_copy->b = wa_copy_with_alloc(ctx->b));
+    CHECK_NOT_NULL(ctx_copy->a_mont = wa_copy_with_alloc(ctx->a_mont));
     CHECK_NOT_NULL(ctx_copy->gfp = gfp_copy_with_alloc(ctx->gfp));
     ctx_copy->len = ctx->len;
 
@@ -88,12 +91,14 @@ void ecp_init(EcGfpCtx *ctx, const WordArray *p, const WordArray *a, const WordA
     CHECK_NOT_NULL(ctx->gfp = gfp_alloc(p));
     CHECK_NOT_NULL(ctx->a = wa_alloc(len));
     CHECK_NOT_NULL(ctx->b = wa_alloc(len));
+    CHECK_NOT_NULL(ctx->a_mont = wa_alloc(len));
 
     int_sub(p, a, ctx->a);
     ctx->a_equal_minus_3 = (int_bit_len(ctx->a) == 2) && (ctx->a->buf[0] == 3);
     ctx->len = p->len;
     wa_copy(a, ctx->a);
     wa_copy(b, ctx->b);
+    gfp_mont_to(ctx->gfp, a, ctx->a_mont);
 
 cleanup:
     return;
@@ -143,79 +148,66 @@ cleanup:
  */
 static void ecp_double_point(const EcGfpCtx *ctx, const ECPoint *p, ECPoint *r)
 {
-    WordArray *t1 = NULL;
-    WordArray *t2 = NULL;
-    WordArray *t3 = NULL;
-    WordArray *t4 = NULL;
-    int ret = RET_OK;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(r != NULL);
     ASSERT(ctx->len == p->x->len);
     ASSERT(ctx->len == r->x->len);
 
+    WA_STACK(t1, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t2, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t3, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t4, ECP_MAX_LEN, ctx->len);
+
     if (int_is_zero(p->y)) {
         wa_zero(r->x);
         wa_zero(r->y);
-        wa_copy(ctx->gfp->one, r->z);
+        wa_copy(ctx->gfp->mont_one, r->z);
         return;
     }
 
-    CHECK_NOT_NULL(t1 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t2 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t3 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t4 = wa_alloc(ctx->len));
-
     /* t1 = p(y)^2, t2 = 4 * p(x) * p(y)^2. */
-    gfp_mod_sqr(ctx->gfp, p->y, t1);
-    gfp_mod_mul(ctx->gfp, p->x, t1, t2);
+    gfp_mont_sqr(ctx->gfp, p->y, t1);
+    gfp_mont_mul(ctx->gfp, p->x, t1, t2);
     gfp_mod_add(ctx->gfp, t2, t2, t2);
     gfp_mod_add(ctx->gfp, t2, t2, t2);
 
     /* t3 = 3 * p(x)^2 + a * p(z)^4. */
     if (ctx->a_equal_minus_3) {
         /* a = -3 => t3 = 3 * (p(x) - p(z)^2) * (p(x) + p(z)^2). */
-        gfp_mod_sqr(ctx->gfp, p->z, t4);
+        gfp_mont_sqr(ctx->gfp, p->z, t4);
         gfp_mod_add(ctx->gfp, p->x, t4, t3);
         gfp_mod_sub(ctx->gfp, p->x, t4, t4);
-        gfp_mod_mul(ctx->gfp, t3, t4, t3);
+        gfp_mont_mul(ctx->gfp, t3, t4, t3);
         gfp_mod_add(ctx->gfp, t3, t3, t4);
         gfp_mod_add(ctx->gfp, t3, t4, t3);
     } else {
-        gfp_mod_sqr(ctx->gfp, p->x, t3);
+        gfp_mont_sqr(ctx->gfp, p->x, t3);
         gfp_mod_add(ctx->gfp, t3, t3, t4);
         gfp_mod_add(ctx->gfp, t3, t4, t3);
-        gfp_mod_sqr(ctx->gfp, p->z, t4);
-        gfp_mod_sqr(ctx->gfp, t4, t4);
-        gfp_mod_mul(ctx->gfp, t4, ctx->a, t4);
+        gfp_mont_sqr(ctx->gfp, p->z, t4);
+        gfp_mont_sqr(ctx->gfp, t4, t4);
+        gfp_mont_mul(ctx->gfp, t4, ctx->a_mont, t4);
         gfp_mod_add(ctx->gfp, t3, t4, t3);
     }
 
     /* r(x) = t3^2 - 2 * t2. */
-    gfp_mod_sqr(ctx->gfp, t3, r->x);
+    gfp_mont_sqr(ctx->gfp, t3, r->x);
     gfp_mod_sub(ctx->gfp, r->x, t2, r->x);
     gfp_mod_sub(ctx->gfp, r->x, t2, r->x);
 
     /* r(z) = 2 * p(y) * p(z). */
-    gfp_mod_mul(ctx->gfp, p->y, p->z, r->z);
+    gfp_mont_mul(ctx->gfp, p->y, p->z, r->z);
     gfp_mod_add(ctx->gfp, r->z, r->z, r->z);
 
     /* r(y) = t3 * (t2 - r(x)) - 8 * p(y)^4. */
     gfp_mod_add(ctx->gfp, t1, t1, t1);
-    gfp_mod_sqr(ctx->gfp, t1, t1);
+    gfp_mont_sqr(ctx->gfp, t1, t1);
     gfp_mod_add(ctx->gfp, t1, t1, r->y);
 
     gfp_mod_sub(ctx->gfp, t2, r->x, t1);
-    gfp_mod_mul(ctx->gfp, t3, t1, t1);
+    gfp_mont_mul(ctx->gfp, t3, t1, t1);
     gfp_mod_sub(ctx->gfp, t1, r->y, r->y);
-
-cleanup:
-
-    wa_free(t1);
-    wa_free(t2);
-    wa_free(t3);
-    wa_free(t4);
 }
 
 /**
@@ -231,12 +223,6 @@ cleanup:
 void ecp_add_point(const EcGfpCtx *ctx, const ECPoint *p, const WordArray *qx, const WordArray *qy, int sign,
         ECPoint *r)
 {
-    WordArray *t1 = NULL;
-    WordArray *t2 = NULL;
-    WordArray *t3 = NULL;
-    WordArray *t4 = NULL;
-    int ret = RET_OK;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(qx != NULL);
@@ -247,11 +233,16 @@ void ecp_add_point(const EcGfpCtx *ctx, const ECPoint *p, const WordArray *qx, c
     ASSERT(ctx->len == qy->len);
     ASSERT(ctx->len == r->x->len);
 
+    WA_STACK(t1, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t2, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t3, ECP_MAX_LEN, ctx->len);
+    WA_STACK(t4, ECP_MAX_LEN, ctx->len);
+
     /* P = 0 ? */
     if (int_is_zero(p->x) && int_is_zero(p->y)) {
         wa_copy(qx, r->x);
         wa_copy(qy, r->y);
-        wa_copy(ctx->gfp->one, r->z);
+        wa_copy(ctx->gfp->mont_one, r->z);
 
         if (sign == -1) {
             int_sub(ctx->gfp->p, r->y, r->y);
@@ -265,22 +256,17 @@ void ecp_add_point(const EcGfpCtx *ctx, const ECPoint *p, const WordArray *qx, c
         return;
     }
 
-    CHECK_NOT_NULL(t1 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t2 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t3 = wa_alloc(ctx->len));
-    CHECK_NOT_NULL(t4 = wa_alloc(ctx->len));
-
     /*
      * t1 = q(x) * p(z)^2 - p(x)
      * t2 = p(z)^2
      */
-    gfp_mod_sqr(ctx->gfp, p->z, t2);
-    gfp_mod_mul(ctx->gfp, qx, t2, t1);
+    gfp_mont_sqr(ctx->gfp, p->z, t2);
+    gfp_mont_mul(ctx->gfp, qx, t2, t1);
     gfp_mod_sub(ctx->gfp, t1, p->x, t1);
 
     /* t2 = q(y) * p(z)^3 */
-    gfp_mod_mul(ctx->gfp, t2, p->z, t2);
-    gfp_mod_mul(ctx->gfp, qy, t2, t2);
+    gfp_mont_mul(ctx->gfp, t2, p->z, t2);
+    gfp_mont_mul(ctx->gfp, qy, t2, t2);
     if (sign == -1) {
         int_sub(ctx->gfp->p, t2, t2);
     }
@@ -290,9 +276,8 @@ void ecp_add_point(const EcGfpCtx *ctx, const ECPoint *p, const WordArray *qx, c
     if (int_is_zero(t1) && int_is_zero(t3)) {
         wa_zero(r->x);
         wa_zero(r->y);
-        wa_copy(ctx->gfp->one, r->z);
-
-        goto cleanup;
+        wa_copy(ctx->gfp->mont_one, r->z);
+        return;
     }
 
     /* t2 = t2 - p(y) */
@@ -301,65 +286,56 @@ void ecp_add_point(const EcGfpCtx *ctx, const ECPoint *p, const WordArray *qx, c
     /* P == Q ? */
     if (int_is_zero(t1) && int_is_zero(t2)) {
         ecp_double_point(ctx, p, r);
-        goto cleanup;
+        return;
     }
 
     /* r(x) = -t1^3 + t2^2;
      * t3 = p(x) * t1^2;
      * t4 = t1^3;
      */
-    gfp_mod_sqr(ctx->gfp, t1, t3);
-    gfp_mod_mul(ctx->gfp, t1, t3, t4);
-    gfp_mod_mul(ctx->gfp, p->x, t3, t3);
-    gfp_mod_sqr(ctx->gfp, t2, r->x);
+    gfp_mont_sqr(ctx->gfp, t1, t3);
+    gfp_mont_mul(ctx->gfp, t1, t3, t4);
+    gfp_mont_mul(ctx->gfp, p->x, t3, t3);
+    gfp_mont_sqr(ctx->gfp, t2, r->x);
     gfp_mod_sub(ctx->gfp, r->x, t4, r->x);
 
     /* r(x) = r(x) - 2 * t3;
      * r(y) = p(y) * t1^3;
      */
-    gfp_mod_mul(ctx->gfp, t4, p->y, r->y);
+    gfp_mont_mul(ctx->gfp, t4, p->y, r->y);
     gfp_mod_add(ctx->gfp, t3, t3, t4);
     gfp_mod_sub(ctx->gfp, r->x, t4, r->x);
 
     /* r(y) = t2 * (t3 - r(x)) - r(y) */
     gfp_mod_sub(ctx->gfp, t3, r->x, t4);
-    gfp_mod_mul(ctx->gfp, t2, t4, t4);
+    gfp_mont_mul(ctx->gfp, t2, t4, t4);
     gfp_mod_sub(ctx->gfp, t4, r->y, r->y);
 
     /* r(z) = p(z) * t1 */
-    gfp_mod_mul(ctx->gfp, p->z, t1, r->z);
-
-cleanup:
-
-    wa_free(t1);
-    wa_free(t2);
-    wa_free(t3);
-    wa_free(t4);
+    gfp_mont_mul(ctx->gfp, p->z, t1, r->z);
 }
 
-void ecp_point_to_affine(const EcGfpCtx *ctx, ECPoint *p)
+static void ecp_point_to_affine(const EcGfpCtx *ctx, ECPoint *p)
 {
-    WordArray *t;
-
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
     ASSERT(ctx->len == p->x->len);
 
     if (int_is_zero(p->x) && int_is_zero(p->y)) {
-        wa_copy(ctx->gfp->one, p->z);
+        wa_copy(ctx->gfp->mont_one, p->z);
         return;
     }
 
-    t = gfp_mod_inv(ctx->gfp, p->z);
-    ASSERT(t != NULL);
+    WA_STACK(t, ECP_MAX_LEN, ctx->len);
+    gfp_mont_inv(ctx->gfp, p->z, t);
 
-    gfp_mod_mul(ctx->gfp, p->y, t, p->y);
-    gfp_mod_sqr(ctx->gfp, t, t);
-    gfp_mod_mul(ctx->gfp, p->x, t, p->x);
-    gfp_mod_mul(ctx->gfp, p->y, t, p->y);
-    wa_copy(ctx->gfp->one, p->z);
+    gfp_mont_mul(ctx->gfp, p->y, t, p->y);
+    gfp_mont_sqr(ctx->gfp, t, t);
+    gfp_mont_mul(ctx->gfp, p->x, t, p->x);
+    gfp_mont_mul(ctx->gfp, p->y, t, p->y);
+    wa_copy(ctx->gfp->mont_one, p->z);
 
-    wa_free(t);
+    secure_zero(t_buf, ctx->len * WORD_BYTE_LENGTH);
 }
 
 static int ecp_points_to_affine(EcGfpCtx *ctx, ECPoint **array, int off, int len)
@@ -376,23 +352,24 @@ static int ecp_points_to_affine(EcGfpCtx *ctx, ECPoint **array, int off, int len
 
     for (i = 1; i < len; i++) {
         CHECK_NOT_NULL(k[i] = wa_alloc(ctx->len));
-        gfp_mod_mul(ctx->gfp, array[i + off]->z, k[i - 1], k[i]);
+        gfp_mont_mul(ctx->gfp, array[i + off]->z, k[i - 1], k[i]);
     }
 
-    t = gfp_mod_inv(ctx->gfp, k[len - 1]);
+    CHECK_NOT_NULL(t = wa_alloc(ctx->len));
+    DO(gfp_mont_inv(ctx->gfp, k[len - 1], t));
 
     for (i = len - 1; i > 0; i--) {
-        gfp_mod_mul(ctx->gfp, t, k[i - 1], k[i]);
-        gfp_mod_mul(ctx->gfp, t, array[i + off]->z, t);
+        gfp_mont_mul(ctx->gfp, t, k[i - 1], k[i]);
+        gfp_mont_mul(ctx->gfp, t, array[i + off]->z, t);
     }
     wa_copy(t, k[0]);
 
     for (i = 0; i < len; i++) {
-        gfp_mod_mul(ctx->gfp, array[i + off]->y, k[i], array[i + off]->y);
-        gfp_mod_sqr(ctx->gfp, k[i], k[i]);
-        gfp_mod_mul(ctx->gfp, array[i + off]->x, k[i], array[i + off]->x);
-        gfp_mod_mul(ctx->gfp, array[i + off]->y, k[i], array[i + off]->y);
-        DO(wa_copy(ctx->gfp->one, array[i + off]->z));
+        gfp_mont_mul(ctx->gfp, array[i + off]->y, k[i], array[i + off]->y);
+        gfp_mont_sqr(ctx->gfp, k[i], k[i]);
+        gfp_mont_mul(ctx->gfp, array[i + off]->x, k[i], array[i + off]->x);
+        gfp_mont_mul(ctx->gfp, array[i + off]->y, k[i], array[i + off]->y);
+        DO(wa_copy(ctx->gfp->mont_one, array[i + off]->z));
     }
 
 cleanup:
@@ -406,10 +383,37 @@ cleanup:
     return ret;
 }
 
-static void ecp_point_zero(EcGfpCtx *ctx, ECPoint *p)
+static void ecp_point_zero(const EcGfpCtx *ctx, ECPoint *p)
 {
     wa_zero(p->x);
     wa_zero(p->y);
+    wa_copy(ctx->gfp->mont_one, p->z);
+}
+
+/**
+ * Переводить аффінну точку у представлення Монтгомері.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p аффінна точка у звичайному представленні
+ * @param r точка у представленні Монтгомері
+ */
+static void ecp_point_to_mont(const EcGfpCtx *ctx, const ECPoint *p, ECPoint *r)
+{
+    gfp_mont_to(ctx->gfp, p->x, r->x);
+    gfp_mont_to(ctx->gfp, p->y, r->y);
+    wa_copy(ctx->gfp->mont_one, r->z);
+}
+
+/**
+ * Переводить аффінну точку з представлення Монтгомері.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p аффінна точка у представленні Монтгомері
+ */
+static void ecp_point_from_mont(const EcGfpCtx *ctx, ECPoint *p)
+{
+    gfp_mont_from(ctx->gfp, p->x, p->x);
+    gfp_mont_from(ctx->gfp, p->y, p->y);
     wa_copy(ctx->gfp->one, p->z);
 }
 
@@ -445,7 +449,8 @@ int ecp_calc_win_precomp(EcGfpCtx *ctx, const ECPoint *p, int width, EcPrecomp *
             ecp_point_zero(ctx, precomp_win->precomp[i]);
         }
 
-        CHECK_NOT_NULL(r = ec_point_copy_with_alloc(p));
+        CHECK_NOT_NULL(r = ec_point_alloc(ctx->len));
+        ecp_point_to_mont(ctx, p, r);
         ec_point_copy(r, precomp_win->precomp[0]);
 
         ecp_double_point(ctx, r, r);
@@ -500,7 +505,8 @@ int ecp_calc_comb_precomp(EcGfpCtx *ctx, const ECPoint *p, int width, EcPrecomp
             ecp_point_zero(ctx, comb->precomp[i]);
         }
 
-        CHECK_NOT_NULL(r = ec_point_copy_with_alloc(p));
+        CHECK_NOT_NULL(r = ec_point_alloc(ctx->len));
+        ecp_point_to_mont(ctx, p, r);
         ec_point_copy(r, comb->precomp[0]);
 
         for (i = 1; i < width; i++) {
@@ -534,8 +540,10 @@ cleanup:
 
 void ecp_mul(EcGfpCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r)
 {
+    ECPoint *pm = NULL;
     int len;
     int i;
+    int ret = RET_OK;
 
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
@@ -548,27 +556,35 @@ void ecp_mul(EcGfpCtx *ctx, const ECPoint *p, const WordArray *k, ECPoint *r)
     ASSERT(ctx->len == p->x->len);
     ASSERT(ctx->len == r->x->len);
 
-    wa_zero(r->x);
-    wa_zero(r->y);
-    wa_copy(ctx->gfp->one, r->z);
+    CHECK_NOT_NULL(pm = ec_point_alloc(ctx->len));
+    ecp_point_to_mont(ctx, p, pm);
+    ecp_point_zero(ctx, r);
 
     len = (int)int_bit_len(k);
     for (i = len - 1; i >= 0; i--) {
         ecp_double_point(ctx, r, r);
         if (int_get_bit(k, i)) {
-            ecp_add_point(ctx, r, p->x, p->y, 1, r);
+            ecp_add_point(ctx, r, pm->x, pm->y, 1, r);
         }
     }
 
     ecp_point_to_affine(ctx, r);
+    ecp_point_from_mont(ctx, r);
+
+cleanup:
+
+    ec_point_free(pm);
 }
 
 void ecp_dual_mul(EcGfpCtx *ctx, const ECPoint *p, const WordArray *k,
         const ECPoint *q, const WordArray *n, ECPoint *r)
 {
+    ECPoint *pm = NULL;
+    ECPoint *qm = NULL;
     int len;
     int mlen, nlen;
     int i;
+    int ret = RET_OK;
 
     ASSERT(ctx != NULL);
     ASSERT(p != NULL);
@@ -579,9 +595,11 @@ void ecp_dual_mul(EcGfpCtx *ctx, const ECPoint *p, const WordArray *k,
     ASSERT(ctx->len == q->x->len);
     ASSERT(ctx->len == r->x->len);
 
-    wa_zero(r->x);
-    wa_zero(r->y);
-    wa_copy(ctx->gfp->one, r->z);
+    CHECK_NOT_NULL(pm = ec_point_alloc(ctx->len));
+    CHECK_NOT_NULL(qm = ec_point_alloc(ctx->len));
+    ecp_point_to_mont(ctx, p, pm);
+    ecp_point_to_mont(ctx, q, qm);
+    ecp_point_zero(ctx, r);
 
     mlen = (int)int_bit_len(k);
     nlen = (int)int_bit_len(n);
@@ -590,14 +608,20 @@ void ecp_dual_mul(EcGfpCtx *ctx, const ECPoint *p, const WordArray *k,
         ecp_double_point(ctx, r, r);
         ecp_point_to_affine(ctx, r);
         if (int_get_bit(k, i)) {
-            ecp_add_point(ctx, r, p->x, p->y, 1, r);
+            ecp_add_point(ctx, r, pm->x, pm->y, 1, r);
         }
         if (int_get_bit(n, i)) {
-            ecp_add_point(ctx, r, q->x, q->y, 1, r);
+            ecp_add_point(ctx, r, qm->x, qm->y, 1, r);
         }
     }
 
     ecp_point_to_affine(ctx, r);
+    ecp_point_from_mont(ctx, r);
+
+cleanup:
+
+    ec_point_free(pm);
+    ec_point_free(qm);
 }
 
 static void ecp_dual_mul_opt_step(const EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m, int *m_naf,
@@ -665,16 +689,31 @@ static void ecp_dual_mul_opt_extra_addition(const EcGfpCtx *ctx, const EcPrecomp
 }
 
 
-int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
-        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r)
+/**
+ * Обчислює m * P + n * Q, залишаючи результат у проективних координатах
+ * (представлення Монтгомері).
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p_precomp предварительные обчислення для точки P
+ * @param m число на яке умножается p
+ * @param q_precomp предварительные обчислення для точки Q
+ * @param n число на яке умножается q
+ * @param r = m * P + n * Q
+ * @param blind буфер для додаткових операцій, які вирівнюють час для "слабких" naf ключів, або NULL
+ *
+ * @return код помилки
+ */
+static int ecp_dual_mul_proj(const EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
+        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r, ECPoint *blind)
 {
+    int n_naf_buf[INT_NAF_BUF_LEN];
+    int m_naf_buf[INT_NAF_BUF_LEN];
     int *n_naf = NULL;
     int *m_naf = NULL;
     int iter_max;
     int iter_q = 0;
     int i;
     int ret = RET_OK;
-    ECPoint *tmp = NULL;
 
     ASSERT(ctx != NULL);
     ASSERT(p_precomp != NULL);
@@ -682,8 +721,6 @@ int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray
     ASSERT(r != NULL);
     ASSERT(ctx->len == r->x->len);
 
-    CHECK_NOT_NULL(tmp = ec_point_copy_with_alloc(r));
-
     int iter_p = 0;
     int m_bit_len = 8 * (int) ctx->len * sizeof(word_t);
 
@@ -695,7 +732,8 @@ int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray
             ASSERT(ctx->len == p_precomp->ctx.win->precomp[0]->x->len);
 
             iter_p = (int)int_bit_len(m);
-            DO(int_get_naf(m, p_precomp->ctx.win->win_width, &m_naf));
+            m_naf = m_naf_buf;
+            DO(int_get_naf(m, p_precomp->ctx.win->win_width, m_naf));
             for (; (m_naf[iter_p] == 0) && (iter_p > 0); iter_p--);
         }
     }
@@ -708,7 +746,8 @@ int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray
             ASSERT(ctx->len == q_precomp->ctx.win->precomp[0]->x->len);
 
             iter_q = (int)int_bit_len(n);
-            DO(int_get_naf(n, q_precomp->ctx.win->win_width, &n_naf));
+            n_naf = n_naf_buf;
+            DO(int_get_naf(n, q_precomp->ctx.win->win_width, n_naf));
             for (; (n_naf[iter_q] == 0) && (iter_q > 0); iter_q--);
         }
     }
@@ -731,16 +770,126 @@ int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray
         }
     }
 
-    ecp_dual_mul_opt_extra_addition(ctx, p_precomp, m, m_naf, tmp);
-    ecp_dual_mul_opt_extra_addition(ctx, q_precomp, n, n_naf, tmp);
+    if (blind != NULL) {
+        ecp_dual_mul_opt_extra_addition(ctx, p_precomp, m, m_naf, blind);
+        ecp_dual_mul_opt_extra_addition(ctx, q_precomp, n, n_naf, blind);
+    }
+
+cleanup:
+
+    if (n_naf != NULL) {
+        secure_zero(n_naf, ((n->len << WORD_BIT_LEN_SHIFT) + 1) * sizeof(int));
+    }
+    if (m_naf != NULL) {
+        secure_zero(m_naf, ((m->len << WORD_BIT_LEN_SHIFT) + 1) * sizeof(int));
+    }
+
+    return ret;
+}
+
+int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
+        const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r)
+{
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(r != NULL);
+
+    EC_POINT_STACK(tmp, ECP_MAX_LEN, r->x->len);
+    ec_point_copy(r, tmp);
+
+    DO(ecp_dual_mul_proj(ctx, p_precomp, m, q_precomp, n, r, tmp));
 
     ecp_point_to_affine(ctx, r);
+    ecp_point_from_mont(ctx, r);
 
 cleanup:
 
-    ec_point_free(tmp);
-    free(n_naf);
-    free(m_naf);
+    return ret;
+}
+
+int ecp_dual_mul_batch(EcGfpCtx *ctx, const EcPrecomp *p_precomp, WordArray *const *m,
+        ECPoint *const *q, WordArray *const *n, size_t count, int width, ECPoint **r)
+{
+    ECPoint **dbl = NULL;
+    ECPoint **tab = NULL;
+    EcPrecompWin q_win;
+    EcPrecomp q_precomp;
+    size_t tab_len = 0;
+    size_t i;
+    int precomp_len;
+    int j;
+    int ret = RET_OK;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(p_precomp != NULL);
+    CHECK_PARAM(m != NULL);
+    CHECK_PARAM(q != NULL);
+    CHECK_PARAM(n != NULL);
+    CHECK_PARAM(r != NULL);
+    CHECK_PARAM(width >= 2);
+
+    if (count == 0) {
+        return RET_OK;
+    }
+
+    precomp_len = 1 << (width - 2);
+    tab_len = count * precomp_len;
+
+    CALLOC_CHECKED(dbl, count * sizeof(ECPoint *));
+    CALLOC_CHECKED(tab, tab_len * sizeof(ECPoint *));
+    for (i = 0; i < count; i++) {
+        CHECK_PARAM(ctx->len == q[i]->x->len);
+        CHECK_NOT_NULL(dbl[i] = ec_point_alloc(ctx->len));
+    }
+    for (i = 0; i < tab_len; i++) {
+        CHECK_NOT_NULL(tab[i] = ec_point_alloc(ctx->len));
+    }
+
+    /* Вікна для всіх Q_i будуються разом: одна інверсія для 2 * Q_i і одна для таблиць. */
+    for (i = 0; i < count; i++) {
+        ecp_point_to_mont(ctx, q[i], tab[i * precomp_len]);
+        ecp_double_point(ctx, tab[i * precomp_len], dbl[i]);
+    }
+    DO(ecp_points_to_affine(ctx, dbl, 0, (int)count));
+
+    for (i = 0; i < count; i++) {
+        for (j = 1; j < precomp_len; j++) {
+            ecp_add_point(ctx, tab[i * precomp_len + j - 1], dbl[i]->x, dbl[i]->y, 1, tab[i * precomp_len + j]);
+        }
+    }
+    DO(ecp_points_to_affine(ctx, tab, 0, (int)tab_len));
+
+    q_win.precomp_len = precomp_len;
+    q_win.win_width = width;
+    q_precomp.type = EC_PRECOMP_TYPE_WIN;
+    q_precomp.ctx.win = &q_win;
+
+    for (i = 0; i < count; i++) {
+        CHECK_PARAM(ctx->len == r[i]->x->len);
+        q_win.precomp = &tab[i * precomp_len];
+        DO(ecp_dual_mul_proj(ctx, p_precomp, m[i], &q_precomp, n[i], r[i], NULL));
+    }
+
+    DO(ecp_points_to_affine(ctx, r, 0, (int)count));
+    for (i = 0; i < count; i++) {
+        ecp_point_from_mont(ctx, r[i]);
+    }
+
+cleanup:
+
+    if (dbl != NULL) {
+        for (i = 0; i < count; i++) {
+            ec_point_free(dbl[i]);
+        }
+        free(dbl);
+    }
+    if (tab != NULL) {
+        for (i = 0; i < tab_len; i++) {
+            ec_point_free(tab[i]);
+        }
+        free(tab);
+    }
 
     return ret;
 }
@@ -751,6 +900,7 @@ void ecp_free(EcGfpCtx *ctx)
         gfp_free(ctx->gfp);
         wa_free(ctx->a);
         wa_free(ctx->b);
+        wa_free(ctx->a_mont);
         free(ctx);
     }
 }
@@ -39,11 +39,21 @@
 extern "C" {
 #endif
 
-/** Контекст для работы з группой точек еліптичної кривої. */
+/** Максимальна довжина елемента поля у словах, тимчасові значення операцій над точками зберігаються на стеку. */
+#define ECP_MAX_LEN WA_LEN_FROM_BITS(2048)
+
+/**
+ * Контекст для работы з группой точек еліптичної кривої.
+ *
+ * Внутрішні обчислення над точками (у тому числі передобчислення EcPrecomp)
+ * виконуються у представленні Монтгомері поля GF(p), вхідні та вихідні точки
+ * ecp_* функцій задаються у звичайному представленні.
+ */
 typedef struct EcGfpCtx_st {
     GfpCtx *gfp;            /* Контекст поля GF(p). */
     WordArray *a;              /* коефіцієнт еліптичної кривої a. */
     WordArray *b;           /* коефіцієнт еліптичної кривої b. */
+    WordArray *a_mont;      /* коефіцієнт a у представленні Монтгомері. */
     bool a_equal_minus_3;   /* Определяет Виконуєся ли равенство a == -3. */
     size_t len;
 } EcGfpCtx;
@@ -143,6 +153,26 @@ int ecp_calc_comb_precomp(EcGfpCtx *ctx, const ECPoint *p, int width, EcPrecomp
 int ecp_dual_mul_opt(EcGfpCtx *ctx, const EcPrecomp *p_precomp, const WordArray *m,
         const EcPrecomp *q_precomp, const WordArray *n, ECPoint *r);
 
+/**
+ * Обчислює r[i] = m[i] * P + n[i] * Q[i] для пакета точок Q[i].
+ *
+ * Вікна для Q[i] будуються з width і нормалізуються спільно,
+ * результати переводяться в аффінні координати однією інверсією.
+ *
+ * @param ctx контекст еліптичної кривої
+ * @param p_precomp предварительные обчислення для точки P
+ * @param m числа на які умножается p
+ * @param q аффінні точки Q[i], відмінні від нескінченно віддаленої
+ * @param n числа на які умножаются q
+ * @param count кількість елементів пакета
+ * @param width ширина окна для точок Q[i]
+ * @param r результати
+ *
+ * @return код помилки
+ */
+int ecp_dual_mul_batch(EcGfpCtx *ctx, const EcPrecomp *p_precomp, WordArray *const *m,
+        ECPoint *const *q, WordArray *const *n, size_t count, int width, ECPoint **r);
+
 void ecp_free(EcGfpCtx *ctx);
 
 #ifdef  __cplusplus
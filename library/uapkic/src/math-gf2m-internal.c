@@ -33,8 +33,21 @@
 
 #include "math-gf2m-internal.h"
 #include "math-int-internal.h"
+#include "cpu-features-internal.h"
 #include "macros-internal.h"
 
+#if defined(CPU_X86_64)
+# include <immintrin.h>
+#endif
+
+static void gf2m_mul_soft(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1);
+#if defined(CPU_X86_64)
+static void gf2m_mul_clmul(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1);
+static void gf2m_mul_vclmul(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1);
+#endif
+static Gf2mMulFunc gf2m_select_mul(void);
+static Gf2mModFunc gf2m_select_mod(const int *f);
+
 /* Таблица предварительных вычислений для возведения у квадрат. */
 static const uint16_t GF2M_SQR_PRECOMP[256] = {
     0x0000, 0x0001, 0x0004, 0x0005, 0x0010, 0x0011, 0x0014, 0x0015,
@@ -89,6 +102,8 @@ static void gf2m_init(Gf2mCtx *ctx, const int *f, size_t f_len)
     memcpy(ctx->f, f, f_len * sizeof(int));
 
     ctx->len = (f[0] >> WORD_BIT_LEN_SHIFT) + 1;
+    ctx->mul = gf2m_select_mul();
+    ctx->mod = gf2m_select_mod(f);
 
     CHECK_NOT_NULL(ctx->f_ext = wa_alloc_with_zero(ctx->len));
     for (i = (f[2] == 0 ? 2 : 4); i >= 0; i--) {
@@ -109,6 +124,8 @@ Gf2mCtx *gf2m_alloc(const int *f, size_t f_len)
         return NULL;
     }
 
+    CHECK_PARAM(f[0] < GF2M_MAX_LEN * WORD_BIT_LENGTH);
+
     CALLOC_CHECKED(ctx, sizeof(Gf2mCtx));
     gf2m_init(ctx, f, f_len);
 
@@ -131,7 +148,7 @@ void gf2m_mod_add(const WordArray *a, const WordArray *b, WordArray *out)
     for (i = 0; i < a->len; out->buf[i] = a->buf[i] ^ b->buf[i], i++);
 }
 
-void gf2m_mod(const Gf2mCtx *ctx, WordArray *a, WordArray *out)
+static void gf2m_mod_generic(const Gf2mCtx *ctx, WordArray *a, WordArray *out)
 {
     ASSERT(ctx != NULL);
     ASSERT(a != NULL);
@@ -239,6 +256,135 @@ void gf2m_mod(const Gf2mCtx *ctx, WordArray *a, WordArray *out)
     wa_copy_part(a, 0, ctx->len, out);
 }
 
+/* Переносить слово zz, що стоїть у позиції j, на d бітів униз. */
+static inline void gf2m_fold_hi(word_t *z, size_t j, word_t zz, int d)
+{
+    const size_t q = (size_t)d >> WORD_BIT_LEN_SHIFT;
+    const int r = d & WORD_BIT_LEN_MASK;
+
+    z[j - q] ^= zz >> r;
+    if (r != 0) {
+        z[j - q - 1] ^= zz << (WORD_BIT_LENGTH - r);
+    }
+}
+
+/* Додає zz * x^k. */
+static inline void gf2m_fold_lo(word_t *z, word_t zz, int k)
+{
+    const size_t q = (size_t)k >> WORD_BIT_LEN_SHIFT;
+    const int r = k & WORD_BIT_LEN_MASK;
+
+    z[q] ^= zz << r;
+    if (r != 0) {
+        z[q + 1] ^= zz >> (WORD_BIT_LENGTH - r);
+    }
+}
+
+/**
+ * Пословна редукція за модулем f = x^m + x^k1 (+ x^k2 + x^k3) + 1, k2 = 0 для тричлена.
+ * Викликається лише з константними параметрами, тому компілятор розгортає всі зсуви.
+ * Потребує m - k1 >= WORD_BIT_LENGTH, що виконується для всіх стандартних полів.
+ * Час виконання не залежить від значення z.
+ *
+ * @param z многочлен довжини 2 * len слів, результат у молодших len словах
+ * @param len довжина елемента поля у словах
+ */
+static inline void gf2m_mod_fixed(word_t *z, size_t len, int m, int k1, int k2, int k3)
+{
+    const int b = m & WORD_BIT_LEN_MASK;
+    word_t zz;
+    size_t j;
+
+    for (j = 2 * len - 1; j >= len; j--) {
+        zz = z[j];
+        z[j] = 0;
+        gf2m_fold_hi(z, j, zz, m);
+        gf2m_fold_hi(z, j, zz, m - k1);
+        if (k2 != 0) {
+            gf2m_fold_hi(z, j, zz, m - k2);
+            gf2m_fold_hi(z, j, zz, m - k3);
+        }
+    }
+
+    zz = z[len - 1] >> b;
+    z[len - 1] ^= zz << b;
+    gf2m_fold_lo(z, zz, 0);
+    gf2m_fold_lo(z, zz, k1);
+    if (k2 != 0) {
+        gf2m_fold_lo(z, zz, k2);
+        gf2m_fold_lo(z, zz, k3);
+    }
+}
+
+#define GF2M_MOD_FIXED(_id, _m, _k1, _k2, _k3)                                      \
+static void gf2m_mod_##_id(const Gf2mCtx *ctx, WordArray *a, WordArray *out)         \
+{                                                                                   \
+    ASSERT(ctx->len == ((_m) >> WORD_BIT_LEN_SHIFT) + 1);                           \
+    ASSERT(a->len == 2 * ctx->len);                                                 \
+    ASSERT(out->len == ctx->len);                                                   \
+    gf2m_mod_fixed(a->buf, ((_m) >> WORD_BIT_LEN_SHIFT) + 1, _m, _k1, _k2, _k3);    \
+    memcpy(out->buf, a->buf, ctx->len * sizeof(word_t));                            \
+}
+
+/* Поля ДСТУ 4145-2002 та FIPS 186. */
+GF2M_MOD_FIXED(163, 163, 7, 6, 3)
+GF2M_MOD_FIXED(167, 167, 6, 0, 0)
+GF2M_MOD_FIXED(173, 173, 10, 2, 1)
+GF2M_MOD_FIXED(179, 179, 4, 2, 1)
+GF2M_MOD_FIXED(191, 191, 9, 0, 0)
+GF2M_MOD_FIXED(233, 233, 9, 4, 1)
+GF2M_MOD_FIXED(233_74, 233, 74, 0, 0)
+GF2M_MOD_FIXED(257, 257, 12, 0, 0)
+GF2M_MOD_FIXED(283, 283, 12, 7, 5)
+GF2M_MOD_FIXED(307, 307, 8, 4, 2)
+GF2M_MOD_FIXED(367, 367, 21, 0, 0)
+GF2M_MOD_FIXED(409, 409, 87, 0, 0)
+GF2M_MOD_FIXED(431, 431, 5, 3, 1)
+GF2M_MOD_FIXED(571, 571, 10, 5, 2)
+
+typedef struct {
+    int f[4];
+    Gf2mModFunc mod;
+} Gf2mModFixed;
+
+static const Gf2mModFixed GF2M_MOD_FIXED_TABLE[] = {
+    {{163, 7, 6, 3}, gf2m_mod_163},
+    {{167, 6, 0, 0}, gf2m_mod_167},
+    {{173, 10, 2, 1}, gf2m_mod_173},
+    {{179, 4, 2, 1}, gf2m_mod_179},
+    {{191, 9, 0, 0}, gf2m_mod_191},
+    {{233, 9, 4, 1}, gf2m_mod_233},
+    {{233, 74, 0, 0}, gf2m_mod_233_74},
+    {{257, 12, 0, 0}, gf2m_mod_257},
+    {{283, 12, 7, 5}, gf2m_mod_283},
+    {{307, 8, 4, 2}, gf2m_mod_307},
+    {{367, 21, 0, 0}, gf2m_mod_367},
+    {{409, 87, 0, 0}, gf2m_mod_409},
+    {{431, 5, 3, 1}, gf2m_mod_431},
+    {{571, 10, 5, 2}, gf2m_mod_571},
+};
+
+static Gf2mModFunc gf2m_select_mod(const int *f)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(GF2M_MOD_FIXED_TABLE) / sizeof(GF2M_MOD_FIXED_TABLE[0]); i++) {
+        const int *t = GF2M_MOD_FIXED_TABLE[i].f;
+        if (f[0] == t[0] && f[1] == t[1] && f[2] == t[2] && (f[2] == 0 || f[3] == t[3])) {
+            return GF2M_MOD_FIXED_TABLE[i].mod;
+        }
+    }
+
+    return gf2m_mod_generic;
+}
+
+void gf2m_mod(const Gf2mCtx *ctx, WordArray *a, WordArray *out)
+{
+    ASSERT(ctx != NULL);
+
+    ctx->mod(ctx, a, out);
+}
+
 void gf2m_mod_sqr(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
 {
     ASSERT(ctx != NULL);
@@ -247,11 +393,8 @@ void gf2m_mod_sqr(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
     ASSERT(a->len == (unsigned int)ctx->len);
     ASSERT(out->len == (unsigned int)ctx->len);
 
-    WordArray *sqr = NULL;
+    WA_STACK(sqr, 2 * GF2M_MAX_LEN, 2 * ctx->len);
     size_t i;
-    int ret = RET_OK;
-
-    CHECK_NOT_NULL(sqr = wa_alloc(2 * ctx->len));
 
     for (i = 0; i < ctx->len; i++) {
 #if defined(ARCH64)
@@ -272,10 +415,6 @@ void gf2m_mod_sqr(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
     }
 
     gf2m_mod(ctx, sqr, out);
-
-cleanup:
-
-    wa_free(sqr);
 }
 
 #if defined(ARCH64)
@@ -837,7 +976,141 @@ static void gf2m_mul_128(const word_t *x, const word_t *y, int len, word_t *z)
 #endif
 }
 
+#if defined(CPU_X86_64)
+
+/*
+ * Множення через PCLMULQDQ: z[k] накопичує 128-бітні добутки x[i] * y[j] з i + j = k,
+ * слово k результату дорівнює lo(z[k]) ^ hi(z[k - 1]).
+ */
+CPU_TARGET("sse2,pclmul")
+static void gf2m_mul_clmul(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1)
+{
+    __m128i z[2 * GF2M_MAX_LEN];
+    __m128i yv[GF2M_MAX_LEN];
+    __m128i xi;
+    __m128i prev;
+    size_t n = x1->len;
+    size_t i, j;
+
+    ASSERT(ctx != NULL);
+    ASSERT(y1->len == n);
+    ASSERT(r1->len == 2 * n);
+    (void)ctx;
+
+    for (j = 0; j < n; j++) {
+        yv[j] = _mm_cvtsi64_si128((long long)y1->buf[j]);
+        z[j] = _mm_setzero_si128();
+        z[j + n] = _mm_setzero_si128();
+    }
+
+    for (i = 0; i < n; i++) {
+        xi = _mm_cvtsi64_si128((long long)x1->buf[i]);
+        for (j = 0; j < n; j++) {
+            z[i + j] = _mm_xor_si128(z[i + j], _mm_clmulepi64_si128(xi, yv[j], 0x00));
+        }
+    }
+
+    prev = _mm_setzero_si128();
+    for (i = 0; i < 2 * n; i++) {
+        r1->buf[i] = (word_t)_mm_cvtsi128_si64(_mm_xor_si128(z[i], _mm_unpackhi_epi64(prev, prev)));
+        prev = z[i];
+    }
+}
+
+/*
+ * Множення через VPCLMULQDQ: x[i] множиться одночасно на пару (y[j], y[j + 1]).
+ * Лінії z[k] містять суми добутків для слів k і k + 1 результату.
+ */
+CPU_TARGET("avx2,pclmul,vpclmulqdq")
+static void gf2m_mul_vclmul(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1)
+{
+    __m256i z[2 * GF2M_MAX_LEN];
+    __m256i yv[GF2M_MAX_LEN / 2 + 1];
+    __m256i xi;
+    __m128i lo, hi, prev;
+    size_t n = x1->len;
+    size_t m = (n + 1) / 2;
+    size_t i, j;
+
+    ASSERT(ctx != NULL);
+    ASSERT(y1->len == n);
+    ASSERT(r1->len == 2 * n);
+    (void)ctx;
+
+    for (j = 0; j < m; j++) {
+        yv[j] = _mm256_set_epi64x(0, (long long)((2 * j + 1 < n) ? y1->buf[2 * j + 1] : 0), 0, (long long)y1->buf[2 * j]);
+    }
+    for (i = 0; i < 2 * n; i++) {
+        z[i] = _mm256_setzero_si256();
+    }
+
+    for (i = 0; i < n; i++) {
+        xi = _mm256_set1_epi64x((long long)x1->buf[i]);
+        for (j = 0; j < m; j++) {
+            z[i + 2 * j] = _mm256_xor_si256(z[i + 2 * j], _mm256_clmulepi64_epi128(xi, yv[j], 0x00));
+        }
+    }
+
+    /* Слово k: lo(z[k].0) ^ lo(z[k - 1].1) ^ hi(z[k - 1].0) ^ hi(z[k - 2].1). */
+    prev = _mm_setzero_si128();
+    for (i = 0; i < 2 * n; i++) {
+        lo = _mm256_castsi256_si128(z[i]);
+        hi = (i > 0) ? _mm256_extracti128_si256(z[i - 1], 1) : _mm_setzero_si128();
+        lo = _mm_xor_si128(lo, hi);
+        r1->buf[i] = (word_t)_mm_cvtsi128_si64(_mm_xor_si128(lo, _mm_unpackhi_epi64(prev, prev)));
+        prev = lo;
+    }
+}
+
+#endif
+
+/* Реалізації множення, від найшвидшої до загальної; остання не потребує розширень. */
+typedef struct Gf2mMulImpl_st {
+    const char *name;
+    uint32_t features;
+    Gf2mMulFunc mul;
+} Gf2mMulImpl;
+
+static const Gf2mMulImpl GF2M_MUL_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"vpclmulqdq", CPU_FEATURE_VPCLMUL, gf2m_mul_vclmul},
+    {"pclmulqdq", CPU_FEATURE_PCLMUL, gf2m_mul_clmul},
+#endif
+    {"generic", 0, gf2m_mul_soft}
+};
+
+static Gf2mMulFunc volatile gf2m_mul_selected = NULL;
+
+void gf2m_dispatch_init(void)
+{
+    uint32_t features = cpu_features();
+    size_t i = 0;
+
+    while ((GF2M_MUL_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+
+    gf2m_mul_selected = GF2M_MUL_IMPLS[i].mul;
+    cpu_dispatch_set(CPU_PRIMITIVE_GF2M_MUL, GF2M_MUL_IMPLS[i].name);
+}
+
+static Gf2mMulFunc gf2m_select_mul(void)
+{
+    if (gf2m_mul_selected == NULL) {
+        gf2m_dispatch_init();
+    }
+
+    return gf2m_mul_selected;
+}
+
 void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1)
+{
+    ASSERT(ctx != NULL);
+
+    ctx->mul(ctx, x1, y1, r1);
+}
+
+static void gf2m_mul_soft(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1, WordArray *r1)
 {
     word_t xPoly[32];
     word_t yPoly[32];
@@ -845,11 +1118,6 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
     int n;
     int s;
     int i, j;
-    int ret = RET_OK;
-
-    WordArray *x = NULL;
-    WordArray *y = NULL;
-    WordArray *r = NULL;
 
     ASSERT(ctx != NULL);
     ASSERT(x1 != NULL);
@@ -859,15 +1127,19 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
     ASSERT(y1->len == ctx->len);
     ASSERT(r1->len == 2 * ctx->len);
 
+    WA_STACK(x, GF2M_MAX_LEN, x1->len);
+    WA_STACK(y, GF2M_MAX_LEN, y1->len);
+    WA_STACK(r, 2 * GF2M_MAX_LEN, r1->len);
+
     n = (int)ctx->len;
 
     if (n > WA_LEN(64)) {
         int y_len = (int)int_bit_len(y1);
-        WordArray *ash = NULL;
+        WA_STACK(ash, 2 * GF2M_MAX_LEN, 2 * x1->len);
 
         wa_zero(r1);
-        CHECK_NOT_NULL(ash = wa_copy_with_alloc(x1));
-        wa_change_len(ash, 2 * x1->len);
+        wa_zero(ash);
+        memcpy(ash->buf, x1->buf, x1->len * sizeof(word_t));
 
         for (i = 0; i < y_len; i++) {
             if (i != 0) {
@@ -878,13 +1150,10 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
             }
         }
 
-        wa_free(ash);
         return;
     }
 
-    CHECK_NOT_NULL(x = wa_alloc(x1->len));
-    CHECK_NOT_NULL(y = wa_alloc(y1->len));
-    CHECK_NOT_NULL(r = wa_alloc_with_zero(r1->len));
+    wa_zero(r);
 
     /* XXX */
     wa_swap(x1, x);
@@ -895,7 +1164,7 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
         gf2m_mul_256(x->buf, y->buf, n, true, r->buf);
         wa_swap(r, r1);
 
-        goto cleanup;
+        return;
     }
 
     /* Степень полинома, порождающего полиномиальный базис равна 257. */
@@ -920,7 +1189,7 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
         /* XXX */
         wa_swap(r, r1);
 
-        goto cleanup;
+        return;
     }
 
     /*
@@ -993,12 +1262,6 @@ void gf2m_mul_opt(const Gf2mCtx *ctx, const WordArray *x1, const WordArray *y1,
 
 #endif
     wa_swap(r, r1);
-
-cleanup:
-
-    wa_free(x);
-    wa_free(y);
-    wa_free(r);
 }
 
 void gf2m_mod_mul(const Gf2mCtx *ctx, const WordArray *a, const WordArray *b, WordArray *out)
@@ -1011,23 +1274,66 @@ void gf2m_mod_mul(const Gf2mCtx *ctx, const WordArray *a, const WordArray *b, Wo
     ASSERT(b->len == ctx->len);
     ASSERT(out->len == ctx->len);
 
-    int ret = RET_OK;
-    WordArray *out2 = NULL;
-
-    CHECK_NOT_NULL(out2 = wa_alloc_with_zero(2 * a->len));
+    WA_STACK(out2, 2 * GF2M_MAX_LEN, 2 * a->len);
 
+    wa_zero(out2);
     gf2m_mul_opt(ctx, a, b, out2);
     gf2m_mod(ctx, out2, out);
+}
 
-cleanup:
+/**
+ * Інверсія Іто-Цудзії: a^(-1) = (a^(2^(m-1) - 1))^2.
+ * Ланцюжок додавань для m - 1 береться з його двійкового запису:
+ * b_2k = b_k^(2^k) * b_k, b_(k+1) = b_k^2 * a, де b_k = a^(2^k - 1).
+ * Потребує m - 1 піднесень до квадрату та O(log m) множень, час виконання не залежить від a.
+ */
+static void gf2m_mod_inv_itoh_tsujii(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
+{
+    word_t m1;
+    int k = 1;
+    int bit;
+    int i;
 
-    wa_free(out2);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+    ASSERT(a->len == ctx->len);
+    ASSERT(out->len == ctx->len);
+
+    WA_STACK(beta, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(t, GF2M_MAX_LEN, ctx->len);
+
+    m1 = (word_t)(ctx->f[0] - 1);
+    wa_copy(a, beta);
+
+    for (bit = word_bit_len(m1) - 2; bit >= 0; bit--) {
+        wa_copy(beta, t);
+        for (i = 0; i < k; i++) {
+            gf2m_mod_sqr(ctx, t, t);
+        }
+        gf2m_mod_mul(ctx, t, beta, beta);
+        k <<= 1;
+
+        if ((m1 >> bit) & 1) {
+            gf2m_mod_sqr(ctx, beta, beta);
+            gf2m_mod_mul(ctx, beta, a, beta);
+            k++;
+        }
+    }
+
+    gf2m_mod_sqr(ctx, beta, out);
 }
 
 void gf2m_mod_inv(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
 {
+    ASSERT(ctx != NULL);
     ASSERT(!int_is_zero(a));
 
+    /* Без спеціалізованої редукції піднесення до квадрату надто дороге для Іто-Цудзії. */
+    if (ctx->mod != gf2m_mod_generic) {
+        gf2m_mod_inv_itoh_tsujii(ctx, a, out);
+        return;
+    }
+
     if (int_is_one(a)) {
         wa_copy(a, out);
         return;
@@ -1036,6 +1342,56 @@ void gf2m_mod_inv(const Gf2mCtx *ctx, const WordArray *a, WordArray *out)
     gf2m_mod_gcd(a, ctx->f_ext, NULL, out, NULL);
 }
 
+int gf2m_mod_inv_batch(const Gf2mCtx *ctx, WordArray *const *a, size_t n, WordArray **out)
+{
+    WordArray **k = NULL;
+    size_t i;
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+
+    WA_STACK(t, GF2M_MAX_LEN, ctx->len);
+    WA_STACK(u, GF2M_MAX_LEN, ctx->len);
+
+    if (n == 0) {
+        return RET_OK;
+    }
+
+    /* k[i] = a[0] * ... * a[i]. */
+    CALLOC_CHECKED(k, n * sizeof(WordArray *));
+    for (i = 0; i < n; i++) {
+        CHECK_NOT_NULL(k[i] = wa_alloc(ctx->len));
+    }
+
+    DO(wa_copy(a[0], k[0]));
+    for (i = 1; i < n; i++) {
+        gf2m_mod_mul(ctx, a[i], k[i - 1], k[i]);
+    }
+
+    gf2m_mod_inv(ctx, k[n - 1], t);
+
+    /* t = (a[0] * ... * a[i])^(-1), out[i] може збігатися з a[i]. */
+    for (i = n - 1; i > 0; i--) {
+        gf2m_mod_mul(ctx, t, a[i], u);
+        gf2m_mod_mul(ctx, t, k[i - 1], out[i]);
+        wa_copy(u, t);
+    }
+    wa_copy(t, out[0]);
+
+cleanup:
+
+    if (k != NULL) {
+        for (i = 0; i < n; i++) {
+            wa_free(k[i]);
+        }
+        free(k);
+    }
+
+    return ret;
+}
+
 void gf2m_mod_gcd(const WordArray *a, const WordArray *b, WordArray *gcd, WordArray *ka, WordArray *kb)
 {
     ASSERT(a != NULL && b != NULL && a->len == b->len);
@@ -1177,6 +1533,8 @@ Gf2mCtx *gf2m_copy_with_alloc(const Gf2mCtx *ctx)
     memcpy(ctx_copy->f, ctx->f, len * sizeof(int));
 
     ctx_copy->len = ctx->len;
+    ctx_copy->mul = ctx->mul;
+    ctx_copy->mod = ctx->mod;
 
     CHECK_NOT_NULL(ctx_copy->f_ext = wa_copy_with_alloc(ctx->f_ext));
 
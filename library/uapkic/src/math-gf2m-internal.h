@@ -36,12 +36,30 @@
 extern "C" {
 # endif
 
+/** Максимальна довжина елемента поля у словах, тимчасові значення зберігаються на стеку. */
+#define GF2M_MAX_LEN WA_LEN_FROM_BITS(2048)
+
+struct Gf2mCtx_st;
+
+/** Множення многочленів над GF(2): out = a * b, out має довжину 2 * ctx->len. */
+typedef void (*Gf2mMulFunc)(const struct Gf2mCtx_st *ctx, const WordArray *a, const WordArray *b, WordArray *out);
+
+/** Редукція многочлена a довжини 2 * ctx->len за модулем f, a змінюється. */
+typedef void (*Gf2mModFunc)(const struct Gf2mCtx_st *ctx, WordArray *a, WordArray *out);
+
 typedef struct Gf2mCtx_st {
     int *f;
     WordArray *f_ext;
     size_t len;
+    Gf2mMulFunc mul;        /* Реалізація множення, обрана за можливостями процесора. */
+    Gf2mModFunc mod;        /* Редукція, спеціалізована для стандартних полів. */
 } Gf2mCtx;
 
+/**
+ * Обирає реалізацію множення для нових контекстів за можливостями процесора.
+ */
+void gf2m_dispatch_init(void);
+
 Gf2mCtx *gf2m_alloc(const int *f, size_t f_len);
 
 /**
@@ -84,6 +102,19 @@ void gf2m_mod_mul(const Gf2mCtx *ctx, const WordArray *a, const WordArray *b, Wo
  */
 void gf2m_mod_inv(const Gf2mCtx *ctx, const WordArray *a, WordArray *out);
 
+/**
+ * Обчислює зворотні елементи для масиву ненульових елементів поля
+ * однією інверсією (метод Монтгомері).
+ *
+ * @param ctx Параметри GF(2^m)
+ * @param a масив елементів поля
+ * @param n кількість елементів
+ * @param out масив буферів для обернених елементів, out[i] може збігатися з a[i]
+ *
+ * @return код помилки
+ */
+int gf2m_mod_inv_batch(const Gf2mCtx *ctx, WordArray *const *a, size_t n, WordArray **out);
+
 /**
  * Виконує поиск наибольшйого общйого делителя двух многочленов.
  *
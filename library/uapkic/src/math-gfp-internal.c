@@ -28,9 +28,456 @@
 
 #define FILE_MARKER "uapkic/math-gfp-internal.c"
 
+#include <memory.h>
+
 #include "math-gfp-internal.h"
 #include "math-int-internal.h"
 #include "macros-internal.h"
+#include "byte-utils-internal.h"
+
+/**
+ * Обчислює -p^(-1) (mod 2^WORD_BIT_LENGTH) методом Ньютона.
+ *
+ * @param p0 молодше слово непарного модуля
+ */
+static word_t gfp_mont_calc_n0(word_t p0)
+{
+    /* p0 * p0 = 1 (mod 8), кожна ітерація подвоює кількість вірних біт. */
+    word_t x = p0;
+    int i;
+
+    for (i = 0; i < 5; i++) {
+        x *= 2 - p0 * x;
+    }
+
+    return (word_t)0 - x;
+}
+
+/**
+ * Віднімає p від (top, t), якщо (top, t) >= p, без розгалужень.
+ * Значення (top, t) має бути менше за 2p.
+ */
+static __inline void gfp_words_csub(const word_t *t, word_t top, const word_t *p, size_t len, word_t *out)
+{
+    word_t borrow, diff, lo, mask;
+    size_t j;
+
+    borrow = 0;
+    for (j = 0; j < len; j++) {
+        diff = t[j] - p[j];
+        lo = (t[j] < p[j]);
+        out[j] = diff - borrow;
+        borrow = lo | (diff < borrow);
+    }
+
+    mask = (word_t)0 - (top | (borrow ^ 1));
+    for (j = 0; j < len; j++) {
+        out[j] = (out[j] & mask) | (t[j] & ~mask);
+    }
+}
+
+/**
+ * Множення Монтгомері (CIOS): out = a * b * R^(-1) (mod p).
+ * Вхідні значення мають бути менші за p, out може співпадати з a або b.
+ */
+static void gfp_mont_mul_words(const word_t *a, const word_t *b, const word_t *p, word_t n0, size_t len, word_t *out)
+{
+    word_t t[GFP_MONT_MAX_LEN + 2];
+    word_t c, m, lo;
+    size_t i, j;
+
+    memset(t, 0, (len + 2) * sizeof(word_t));
+
+    for (i = 0; i < len; i++) {
+        /* t = t + a * b[i] */
+        c = 0;
+        for (j = 0; j < len; j++) {
+            word_mul_add(a[j], b[i], t[j], c, &c, &t[j]);
+        }
+        t[len] += c;
+        t[len + 1] = (t[len] < c);
+
+        /* t = (t + m * p) / 2^WORD_BIT_LENGTH */
+        m = t[0] * n0;
+        word_mul_add(m, p[0], t[0], 0, &c, &lo);
+        for (j = 1; j < len; j++) {
+            word_mul_add(m, p[j], t[j], c, &c, &t[j - 1]);
+        }
+        t[len - 1] = t[len] + c;
+        t[len] = t[len + 1] + (t[len - 1] < c);
+    }
+
+    /* t < 2p. */
+    gfp_words_csub(t, t[len], p, len, out);
+
+    memset(t, 0, sizeof(t));
+}
+
+/**
+ * Добуток t = a * b довжиною 2 * len слів.
+ */
+static __inline void gfp_words_mul(const word_t *a, const word_t *b, size_t len, word_t *t)
+{
+    word_t c;
+    size_t i, j;
+
+    c = 0;
+    for (j = 0; j < len; j++) {
+        word_mul_add(a[j], b[0], c, 0, &c, &t[j]);
+    }
+    t[len] = c;
+
+    for (i = 1; i < len; i++) {
+        c = 0;
+        for (j = 0; j < len; j++) {
+            word_mul_add(a[j], b[i], t[i + j], c, &c, &t[i + j]);
+        }
+        t[i + len] = c;
+    }
+}
+
+/**
+ * Квадрат t = a^2 довжиною 2 * len слів: перехресні добутки обчислюються один раз.
+ */
+static __inline void gfp_words_sqr(const word_t *a, size_t len, word_t *t)
+{
+    word_t c, w, hi;
+    size_t i, j;
+
+    memset(t, 0, 2 * len * sizeof(word_t));
+
+    for (i = 0; i < len; i++) {
+        c = 0;
+        for (j = i + 1; j < len; j++) {
+            word_mul_add(a[i], a[j], t[i + j], c, &c, &t[i + j]);
+        }
+        t[i + len] = c;
+    }
+
+    c = 0;
+    for (i = 0; i < 2 * len; i++) {
+        w = t[i];
+        t[i] = (w << 1) | c;
+        c = w >> (WORD_BIT_LENGTH - 1);
+    }
+
+    c = 0;
+    for (i = 0; i < len; i++) {
+        word_mul_add(a[i], a[i], t[2 * i], c, &hi, &t[2 * i]);
+        t[2 * i + 1] += hi;
+        c = (t[2 * i + 1] < hi);
+    }
+}
+
+/**
+ * Редукція Монтгомері (SOS): out = t * R^(-1) (mod p), t < p * R, t займає 2 * len слів і змінюється.
+ */
+static __inline void gfp_mont_redc(word_t *t, const word_t *p, word_t n0, size_t len, word_t *out)
+{
+    word_t c, m, s, top;
+    size_t i, j;
+
+    top = 0;
+    for (i = 0; i < len; i++) {
+        m = t[i] * n0;
+        c = 0;
+        for (j = 0; j < len; j++) {
+            word_mul_add(m, p[j], t[i + j], c, &c, &t[i + j]);
+        }
+        s = t[i + len] + top;
+        top = (s < top);
+        s += c;
+        top += (s < c);
+        t[i + len] = s;
+    }
+
+    gfp_words_csub(t + len, top, p, len, out);
+}
+
+static void gfp_mont_mul_generic(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)
+{
+    gfp_mont_mul_words(a, b, ctx->p->buf, ctx->mont_n0, ctx->p->len, out);
+}
+
+static void gfp_mont_sqr_generic(const GfpCtx *ctx, const word_t *a, word_t *out)
+{
+    word_t t[2 * GFP_MONT_MAX_LEN];
+
+    gfp_words_sqr(a, ctx->p->len, t);
+    gfp_mont_redc(t, ctx->p->buf, ctx->mont_n0, ctx->p->len, out);
+}
+
+/*
+ * Ядра фіксованої довжини: з константною кількістю слів компілятор розгортає цикли.
+ */
+#define GFP_MONT_FIXED(N)                                                                           \
+static void gfp_mont_mul_##N(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)      \
+{                                                                                                   \
+    word_t t[2 * (N)];                                                                              \
+    gfp_words_mul(a, b, (N), t);                                                                    \
+    gfp_mont_redc(t, ctx->p->buf, ctx->mont_n0, (N), out);                                          \
+}                                                                                                   \
+static void gfp_mont_sqr_##N(const GfpCtx *ctx, const word_t *a, word_t *out)                       \
+{                                                                                                   \
+    word_t t[2 * (N)];                                                                              \
+    gfp_words_sqr(a, (N), t);                                                                       \
+    gfp_mont_redc(t, ctx->p->buf, ctx->mont_n0, (N), out);                                          \
+}
+
+#if defined(ARCH64)
+
+GFP_MONT_FIXED(3)
+GFP_MONT_FIXED(4)
+GFP_MONT_FIXED(5)
+GFP_MONT_FIXED(6)
+GFP_MONT_FIXED(8)
+GFP_MONT_FIXED(9)
+
+/* NIST P-256: p = 2^256 - 2^224 + 2^192 + 2^96 - 1, -p^(-1) = 1 (mod 2^64). */
+static const word_t GFP_P256_P[4] = {
+    0xffffffffffffffffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL
+};
+
+/* NIST P-384: p = 2^384 - 2^128 - 2^96 + 2^32 - 1, -p^(-1) = 2^32 + 1 (mod 2^64). */
+static const word_t GFP_P384_P[6] = {
+    0x00000000ffffffffULL, 0xffffffff00000000ULL, 0xfffffffffffffffeULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+
+/* secp256k1: p = 2^256 - GFP_K256_C. */
+static const word_t GFP_K256_P[4] = {
+    0xfffffffefffffc2fULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+#define GFP_K256_C 0x1000003d1ULL
+
+/* NIST P-521: p = 2^521 - 1. */
+static const word_t GFP_P521_P[9] = {
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000001ffULL
+};
+
+/*
+ * Для P-256 та P-384 модуль і n0 - константи, тому множення на нульові слова p
+ * та на n0 = 1 зникають після розгортання циклів.
+ */
+static void gfp_mont_mul_p256(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)
+{
+    word_t t[8];
+
+    (void)ctx;
+    gfp_words_mul(a, b, 4, t);
+    gfp_mont_redc(t, GFP_P256_P, 1, 4, out);
+}
+
+static void gfp_mont_sqr_p256(const GfpCtx *ctx, const word_t *a, word_t *out)
+{
+    word_t t[8];
+
+    (void)ctx;
+    gfp_words_sqr(a, 4, t);
+    gfp_mont_redc(t, GFP_P256_P, 1, 4, out);
+}
+
+static void gfp_mont_mul_p384(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)
+{
+    word_t t[12];
+
+    (void)ctx;
+    gfp_words_mul(a, b, 6, t);
+    gfp_mont_redc(t, GFP_P384_P, 0x100000001ULL, 6, out);
+}
+
+static void gfp_mont_sqr_p384(const GfpCtx *ctx, const word_t *a, word_t *out)
+{
+    word_t t[12];
+
+    (void)ctx;
+    gfp_words_sqr(a, 6, t);
+    gfp_mont_redc(t, GFP_P384_P, 0x100000001ULL, 6, out);
+}
+
+/**
+ * Редукція за модулем secp256k1: 2^256 = GFP_K256_C (mod p), t < p^2.
+ */
+static __inline void gfp_k256_reduce(const word_t *t, word_t *out)
+{
+    word_t r[4];
+    word_t c, hi, s;
+    size_t j;
+
+    /* r + c * 2^256 = t_lo + t_hi * GFP_K256_C, c < 2^34. */
+    c = 0;
+    for (j = 0; j < 4; j++) {
+        word_mul_add(t[4 + j], GFP_K256_C, t[j], c, &c, &r[j]);
+    }
+
+    /* r = r + c * GFP_K256_C, перенос hi з останнього слова означає r < 2^68. */
+    word_mul_add(c, GFP_K256_C, r[0], 0, &hi, &r[0]);
+    for (j = 1; j < 4; j++) {
+        s = r[j] + hi;
+        hi = (s < hi);
+        r[j] = s;
+    }
+    word_mul_add(hi, GFP_K256_C, r[0], 0, &hi, &r[0]);
+    for (j = 1; j < 4; j++) {
+        s = r[j] + hi;
+        hi = (s < hi);
+        r[j] = s;
+    }
+
+    /* r < 2^256 < 2p. */
+    gfp_words_csub(r, 0, GFP_K256_P, 4, out);
+}
+
+static void gfp_mul_k256(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)
+{
+    word_t t[8];
+
+    (void)ctx;
+    gfp_words_mul(a, b, 4, t);
+    gfp_k256_reduce(t, out);
+}
+
+static void gfp_sqr_k256(const GfpCtx *ctx, const word_t *a, word_t *out)
+{
+    word_t t[8];
+
+    (void)ctx;
+    gfp_words_sqr(a, 4, t);
+    gfp_k256_reduce(t, out);
+}
+
+/**
+ * Редукція за модулем P-521: 2^521 = 1 (mod p), t < p^2.
+ */
+static __inline void gfp_p521_reduce(const word_t *t, word_t *out)
+{
+    word_t r[9];
+    word_t c, lo, hi, s;
+    size_t j;
+
+    /* r = (t mod 2^521) + (t >> 521) < 2^522. */
+    c = 0;
+    for (j = 0; j < 9; j++) {
+        lo = (j < 8) ? t[j] : (t[8] & 0x1ff);
+        hi = (t[8 + j] >> 9) | (t[9 + j] << 55);
+        s = lo + c;
+        c = (s < c);
+        s += hi;
+        c += (s < hi);
+        r[j] = s;
+    }
+
+    /* r >= p  <=>  r + 1 >= 2^521, тоді r - p = (r + 1) mod 2^521. */
+    c = 1;
+    for (j = 0; j < 9; j++) {
+        out[j] = r[j] + c;
+        c = (out[j] < c);
+    }
+    c = (word_t)0 - (out[8] >> 9);
+    out[8] &= 0x1ff;
+    for (j = 0; j < 9; j++) {
+        out[j] = (out[j] & c) | (r[j] & ~c);
+    }
+}
+
+static void gfp_mul_p521(const GfpCtx *ctx, const word_t *a, const word_t *b, word_t *out)
+{
+    word_t t[18];
+
+    (void)ctx;
+    gfp_words_mul(a, b, 9, t);
+    gfp_p521_reduce(t, out);
+}
+
+static void gfp_sqr_p521(const GfpCtx *ctx, const word_t *a, word_t *out)
+{
+    word_t t[18];
+
+    (void)ctx;
+    gfp_words_sqr(a, 9, t);
+    gfp_p521_reduce(t, out);
+}
+
+static bool gfp_equals_words(const WordArray *p, const word_t *q, size_t len)
+{
+    return (p->len == len) && (memcmp(p->buf, q, len * sizeof(word_t)) == 0);
+}
+
+#endif
+
+/**
+ * Обирає ядра множення для модуля.
+ *
+ * @return true, якщо для модуля використовується редукція без представлення Монтгомері
+ */
+static bool gfp_select_kernels(GfpCtx *ctx)
+{
+    const WordArray *p = ctx->p;
+
+    ctx->mont_mul = gfp_mont_mul_generic;
+    ctx->mont_sqr = gfp_mont_sqr_generic;
+
+#if defined(ARCH64)
+    if (gfp_equals_words(p, GFP_P256_P, 4)) {
+        ctx->mont_mul = gfp_mont_mul_p256;
+        ctx->mont_sqr = gfp_mont_sqr_p256;
+        return false;
+    }
+
+    if (gfp_equals_words(p, GFP_P384_P, 6)) {
+        ctx->mont_mul = gfp_mont_mul_p384;
+        ctx->mont_sqr = gfp_mont_sqr_p384;
+        return false;
+    }
+
+    if (gfp_equals_words(p, GFP_K256_P, 4)) {
+        ctx->mont_mul = gfp_mul_k256;
+        ctx->mont_sqr = gfp_sqr_k256;
+        return true;
+    }
+
+    if (gfp_equals_words(p, GFP_P521_P, 9)) {
+        ctx->mont_mul = gfp_mul_p521;
+        ctx->mont_sqr = gfp_sqr_p521;
+        return true;
+    }
+
+    switch (p->len) {
+    case 3:
+        ctx->mont_mul = gfp_mont_mul_3;
+        ctx->mont_sqr = gfp_mont_sqr_3;
+        break;
+    case 4:
+        ctx->mont_mul = gfp_mont_mul_4;
+        ctx->mont_sqr = gfp_mont_sqr_4;
+        break;
+    case 5:
+        ctx->mont_mul = gfp_mont_mul_5;
+        ctx->mont_sqr = gfp_mont_sqr_5;
+        break;
+    case 6:
+        ctx->mont_mul = gfp_mont_mul_6;
+        ctx->mont_sqr = gfp_mont_sqr_6;
+        break;
+    case 8:
+        ctx->mont_mul = gfp_mont_mul_8;
+        ctx->mont_sqr = gfp_mont_sqr_8;
+        break;
+    case 9:
+        ctx->mont_mul = gfp_mont_mul_9;
+        ctx->mont_sqr = gfp_mont_sqr_9;
+        break;
+    default:
+        break;
+    }
+#else
+    (void)p;
+#endif
+
+    return false;
+}
 
 static WordArray *gfp_mod_inv_ext_euclid(const WordArray *in, const WordArray *p)
 {
@@ -116,26 +563,21 @@ cleanup:
 
 /**
  * Вычисляет обратный элемент в поле GF(p) используется бинарный алгоритм.
+ * Проміжні значення a, b, c, d надає викликач.
  */
-static WordArray *gfp_mod_inv_binary(const WordArray *x, const WordArray *p)
+static void gfp_mod_inv_binary(const WordArray *x, const WordArray *p, WordArray *a, WordArray *b, WordArray *c,
+        WordArray *d, WordArray *out)
 {
-    WordArray *out = NULL;
-    WordArray *a = NULL;
-    WordArray *b = NULL;
-    WordArray *c = NULL;
-    WordArray *d = NULL;
-    int ret = RET_OK;
-
     if (int_is_one(x)) {
-        CHECK_NOT_NULL(out = wa_copy_with_alloc(x));
-        return out;
+        wa_copy(x, out);
+        return;
     }
 
     /* a = x; b = p; c = 1; d = 0. */
-    CHECK_NOT_NULL(a = wa_copy_with_alloc(x));
-    CHECK_NOT_NULL(b = wa_copy_with_alloc(p));
-    CHECK_NOT_NULL(c = wa_alloc_with_one(x->len));
-    CHECK_NOT_NULL(d = wa_alloc_with_zero(x->len));
+    wa_copy(x, a);
+    wa_copy(p, b);
+    wa_one(c);
+    wa_zero(d);
 
     /* Пока a != 1 і b != 1. */
     while (!int_is_one(a) && !int_is_one(b)) {
@@ -182,35 +624,80 @@ static WordArray *gfp_mod_inv_binary(const WordArray *x, const WordArray *p)
         }
     }
 
-    out = (int_is_one(a)) ? wa_copy_with_alloc(c) : wa_copy_with_alloc(d);
+    wa_copy(int_is_one(a) ? c : d, out);
+}
 
-    CHECK_NOT_NULL(out);
+int gfp_mod_inv_core(const WordArray *x, const WordArray *p, WordArray *out)
+{
+    WordArray *a = NULL;
+    WordArray *b = NULL;
+    WordArray *c = NULL;
+    WordArray *d = NULL;
+    WordArray *res = NULL;
+    int ret = RET_OK;
 
-cleanup:
+    CHECK_PARAM(x != NULL);
+    CHECK_PARAM(p != NULL);
+    CHECK_PARAM(out != NULL);
+    ASSERT(!int_is_zero(x));
+    ASSERT(!int_is_zero(p));
 
-    wa_free(a);
-    wa_free(b);
-    wa_free(c);
-    wa_free(d);
-    if (ret != RET_OK) {
-        wa_free(out);
-        out = NULL;
+    /* Если p четное - необходимо использовать базовый алгоритм поиска обратного элемента на основе расширенного алгоритма Евклида. */
+    if ((p->buf[0] & 1) == 0) {
+        CHECK_NOT_NULL(res = gfp_mod_inv_ext_euclid(x, p));
+        DO(wa_copy(res, out));
+        goto cleanup;
     }
-    return out;
+
+    /* Для чисел розміру ЕК проміжні значення розміщуються на стеку. */
+    if ((x->len <= GFP_INV_STACK_LEN) && (p->len <= GFP_INV_STACK_LEN)) {
+        WA_STACK(sa, GFP_INV_STACK_LEN, x->len);
+        WA_STACK(sb, GFP_INV_STACK_LEN, p->len);
+        WA_STACK(sc, GFP_INV_STACK_LEN, x->len);
+        WA_STACK(sd, GFP_INV_STACK_LEN, x->len);
+
+        gfp_mod_inv_binary(x, p, sa, sb, sc, sd, out);
+
+        secure_zero(sa_buf, x->len * WORD_BYTE_LENGTH);
+        secure_zero(sb_buf, p->len * WORD_BYTE_LENGTH);
+        secure_zero(sc_buf, x->len * WORD_BYTE_LENGTH);
+        secure_zero(sd_buf, x->len * WORD_BYTE_LENGTH);
+        goto cleanup;
+    }
+
+    CHECK_NOT_NULL(a = wa_alloc(x->len));
+    CHECK_NOT_NULL(b = wa_alloc(p->len));
+    CHECK_NOT_NULL(c = wa_alloc(x->len));
+    CHECK_NOT_NULL(d = wa_alloc(x->len));
+    gfp_mod_inv_binary(x, p, a, b, c, d, out);
+
+cleanup:
+
+    wa_free_private(a);
+    wa_free_private(b);
+    wa_free_private(c);
+    wa_free_private(d);
+    wa_free_private(res);
+
+    return ret;
 }
 
-/**
- * Вычисляет обратный элемент в поле GF(p).
- */
-WordArray *gfp_mod_inv_core(const WordArray *x, const WordArray *p)
+WordArray *gfp_mod_inv_core_with_alloc(const WordArray *x, const WordArray *p)
 {
-    ASSERT(!int_is_zero(x));
-    ASSERT(!int_is_zero(p));
+    WordArray *out = NULL;
+    int ret = RET_OK;
 
-    /* Если p четное - необходимо использовать базовый алгоритм поиска обратного элемента на основе расширенного алгоритма Евклида. */
-    return ((p->buf[0] & 1) == 0)
-            ? gfp_mod_inv_ext_euclid(x, p)
-            : gfp_mod_inv_binary(x, p);
+    CHECK_NOT_NULL(out = wa_alloc(x->len));
+    DO(gfp_mod_inv_core(x, p, out));
+
+cleanup:
+
+    if (ret != RET_OK) {
+        wa_free_private(out);
+        out = NULL;
+    }
+
+    return out;
 }
 
 GfpCtx *gfp_alloc(const WordArray *p)
@@ -244,6 +731,14 @@ GfpCtx *gfp_copy_with_alloc(const GfpCtx *ctx)
     CHECK_NOT_NULL(ctx_copy->one = wa_copy_with_alloc(ctx->one));
     CHECK_NOT_NULL(ctx_copy->p = wa_copy_with_alloc(ctx->p));
     CHECK_NOT_NULL(ctx_copy->two = wa_copy_with_alloc(ctx->two));
+    CHECK_NOT_NULL(ctx_copy->mont_one = wa_copy_with_alloc(ctx->mont_one));
+    if (ctx->mont_r2 != NULL) {
+        CHECK_NOT_NULL(ctx_copy->mont_r2 = wa_copy_with_alloc(ctx->mont_r2));
+    }
+    ctx_copy->mont_n0 = ctx->mont_n0;
+    ctx_copy->mont_plain = ctx->mont_plain;
+    ctx_copy->mont_mul = ctx->mont_mul;
+    ctx_copy->mont_sqr = ctx->mont_sqr;
 
     return ctx_copy;
 
@@ -273,7 +768,36 @@ void gfp_init(GfpCtx *ctx, const WordArray *p)
     two_power_plen->buf[int_word_len(p)] = 1;
 
     int_div(two_power_plen, p, NULL, two_power_plen_mod_p);
-    CHECK_NOT_NULL(ctx->invert_const = gfp_mod_inv_core(two_power_plen_mod_p, p));
+    CHECK_NOT_NULL(ctx->invert_const = gfp_mod_inv_core_with_alloc(two_power_plen_mod_p, p));
+
+    /* Представлення Монтгомері: R = 2^(p->len * WORD_BIT_LENGTH). */
+    if (((p->buf[0] & 1) == 0) || (p->len > GFP_MONT_MAX_LEN)) {
+        CHECK_NOT_NULL(ctx->mont_one = wa_copy_with_alloc(ctx->one));
+        goto cleanup;
+    }
+
+    ctx->mont_plain = gfp_select_kernels(ctx);
+    if (ctx->mont_plain) {
+        /* Спеціальний модуль: R = 1. */
+        CHECK_NOT_NULL(ctx->mont_one = wa_copy_with_alloc(ctx->one));
+        CHECK_NOT_NULL(ctx->mont_r2 = wa_copy_with_alloc(ctx->one));
+        goto cleanup;
+    }
+
+    wa_change_len(two_power_plen, p->len + 1);
+    wa_zero(two_power_plen);
+    two_power_plen->buf[p->len] = 1;
+
+    CHECK_NOT_NULL(ctx->mont_one = wa_alloc(p->len));
+    int_div(two_power_plen, p, NULL, ctx->mont_one);
+
+    wa_change_len(two_power_plen, 2 * p->len);
+    int_sqr(ctx->mont_one, two_power_plen);
+    CHECK_NOT_NULL(ctx->mont_r2 = wa_alloc(p->len));
+    int_div(two_power_plen, p, NULL, ctx->mont_r2);
+
+    ctx->mont_n0 = gfp_mont_calc_n0(p->buf[0]);
+
 cleanup:
 
     wa_free(two_power_plen);
@@ -329,6 +853,15 @@ void gfp_mod_mul(const GfpCtx *ctx, const WordArray *a, const WordArray *b, Word
     ASSERT(a->len == b->len);
     ASSERT(a->len == out->len);
 
+    if (ctx->mont_r2 != NULL && int_cmp(a, ctx->p) < 0 && int_cmp(b, ctx->p) < 0) {
+        /* a * b = REDC(REDC(a * b) * R^2). */
+        ctx->mont_mul(ctx, a->buf, b->buf, out->buf);
+        if (!ctx->mont_plain) {
+            ctx->mont_mul(ctx, out->buf, ctx->mont_r2->buf, out->buf);
+        }
+        return;
+    }
+
     ab = wa_alloc(2 * a->len);
     if (!ab) {
         ERROR_CREATE(RET_MEMORY_ALLOC_ERROR);
@@ -348,6 +881,14 @@ void gfp_mod_sqr(const GfpCtx *ctx, const WordArray *a, WordArray *out)
 
     ASSERT(ctx != NULL && a != NULL && out != NULL && a->len == out->len);
 
+    if (ctx->mont_r2 != NULL && int_cmp(a, ctx->p) < 0) {
+        ctx->mont_sqr(ctx, a->buf, out->buf);
+        if (!ctx->mont_plain) {
+            ctx->mont_mul(ctx, out->buf, ctx->mont_r2->buf, out->buf);
+        }
+        return;
+    }
+
     aa = wa_alloc(2 * a->len);
     if (!aa) {
         ERROR_CREATE(RET_MEMORY_ALLOC_ERROR);
@@ -361,37 +902,21 @@ void gfp_mod_sqr(const GfpCtx *ctx, const WordArray *a, WordArray *out)
     wa_free(aa);
 }
 
-WordArray *gfp_mod_inv(const GfpCtx *ctx, const WordArray *in)
+/**
+ * Вычисляет обратный элемент в поле GF(p) для нечетного p. Проміжні значення a, b, c, d надає викликач.
+ */
+static void gfp_mod_inv_odd(const GfpCtx *ctx, const WordArray *in, WordArray *a, WordArray *b, WordArray *c,
+        WordArray *d, WordArray *out)
 {
-    WordArray *out = NULL;
-    WordArray *a = NULL;
-    WordArray *b = NULL;
-    WordArray *c = NULL;
-    WordArray *d = NULL;
-    int ret = RET_OK;
-
-    ASSERT(ctx != NULL);
-    ASSERT(in != NULL);
-
     word_t carry = 0;
     size_t k = 0;
     size_t len;
 
-    /* Если p четное - необходимо использовать базовый алгоритм поиска обратного элемента на основе расширенного алгоритма Евклида. */
-    if ((ctx->p->buf[0] & 1) == 0) {
-        return gfp_mod_inv_ext_euclid(in, ctx->p);
-    }
-
-    if (int_equals(in, ctx->one)) {
-        CHECK_NOT_NULL(out = wa_copy_with_alloc(in));
-        return out;
-    }
-
     /* a = in; b = p; c = 1; d = 0. */
-    CHECK_NOT_NULL(a = wa_copy_with_alloc(in));
-    CHECK_NOT_NULL(b = wa_copy_with_alloc(ctx->p));
-    CHECK_NOT_NULL(c = wa_alloc_with_one(in->len));
-    CHECK_NOT_NULL(d = wa_alloc_with_zero(in->len));
+    wa_copy(in, a);
+    wa_copy(ctx->p, b);
+    wa_one(c);
+    wa_zero(d);
 
     while (!int_is_zero(b)) {
         if (int_get_bit(b, 0) == 0) {
@@ -438,17 +963,297 @@ WordArray *gfp_mod_inv(const GfpCtx *ctx, const WordArray *in)
         k--;
     }
 
-    CHECK_NOT_NULL(out = wa_alloc(in->len));
     gfp_mod_mul(ctx, c, ctx->invert_const, out);
+}
+
+int gfp_mod_inv(const GfpCtx *ctx, const WordArray *in, WordArray *out)
+{
+    WordArray *a = NULL;
+    WordArray *b = NULL;
+    WordArray *c = NULL;
+    WordArray *d = NULL;
+    WordArray *res = NULL;
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(in != NULL);
+    ASSERT(out != NULL);
+
+    /* Если p четное - необходимо использовать базовый алгоритм поиска обратного элемента на основе расширенного алгоритма Евклида. */
+    if ((ctx->p->buf[0] & 1) == 0) {
+        CHECK_NOT_NULL(res = gfp_mod_inv_ext_euclid(in, ctx->p));
+        DO(wa_copy(res, out));
+        goto cleanup;
+    }
+
+    if (int_equals(in, ctx->one)) {
+        DO(wa_copy(in, out));
+        goto cleanup;
+    }
+
+    /* Для полів ЕК проміжні значення розміщуються на стеку. */
+    if (in->len <= GFP_INV_STACK_LEN) {
+        WA_STACK(sa, GFP_INV_STACK_LEN, in->len);
+        WA_STACK(sb, GFP_INV_STACK_LEN, in->len);
+        WA_STACK(sc, GFP_INV_STACK_LEN, in->len);
+        WA_STACK(sd, GFP_INV_STACK_LEN, in->len);
+
+        gfp_mod_inv_odd(ctx, in, sa, sb, sc, sd, out);
+
+        secure_zero(sa_buf, in->len * WORD_BYTE_LENGTH);
+        secure_zero(sb_buf, in->len * WORD_BYTE_LENGTH);
+        secure_zero(sc_buf, in->len * WORD_BYTE_LENGTH);
+        secure_zero(sd_buf, in->len * WORD_BYTE_LENGTH);
+        goto cleanup;
+    }
+
+    CHECK_NOT_NULL(a = wa_alloc(in->len));
+    CHECK_NOT_NULL(b = wa_alloc(in->len));
+    CHECK_NOT_NULL(c = wa_alloc(in->len));
+    CHECK_NOT_NULL(d = wa_alloc(in->len));
+    gfp_mod_inv_odd(ctx, in, a, b, c, d, out);
 
 cleanup:
 
-    wa_free(a);
-    wa_free(b);
-    wa_free(c);
-    wa_free(d);
+    wa_free_private(a);
+    wa_free_private(b);
+    wa_free_private(c);
+    wa_free_private(d);
+    wa_free_private(res);
 
-    return out;
+    return ret;
+}
+
+void gfp_mont_to(const GfpCtx *ctx, const WordArray *a, WordArray *out)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+    ASSERT(a->len == ctx->p->len);
+    ASSERT(out->len == ctx->p->len);
+
+    if (ctx->mont_r2 == NULL) {
+        wa_copy(a, out);
+        return;
+    }
+
+    if (int_cmp(a, ctx->p) >= 0) {
+        int_div(a, ctx->p, NULL, out);
+        ctx->mont_mul(ctx, out->buf, ctx->mont_r2->buf, out->buf);
+    } else {
+        ctx->mont_mul(ctx, a->buf, ctx->mont_r2->buf, out->buf);
+    }
+}
+
+void gfp_mont_from(const GfpCtx *ctx, const WordArray *a, WordArray *out)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+    ASSERT(a->len == ctx->p->len);
+    ASSERT(out->len == ctx->p->len);
+
+    if (ctx->mont_r2 == NULL || ctx->mont_plain) {
+        wa_copy(a, out);
+        return;
+    }
+
+    ctx->mont_mul(ctx, a->buf, ctx->one->buf, out->buf);
+}
+
+void gfp_mont_mul(const GfpCtx *ctx, const WordArray *a, const WordArray *b, WordArray *out)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(b != NULL);
+    ASSERT(out != NULL);
+    ASSERT(a->len == ctx->p->len);
+    ASSERT(b->len == ctx->p->len);
+    ASSERT(out->len == ctx->p->len);
+
+    if (ctx->mont_r2 == NULL) {
+        gfp_mod_mul(ctx, a, b, out);
+        return;
+    }
+
+    ctx->mont_mul(ctx, a->buf, b->buf, out->buf);
+}
+
+void gfp_mont_sqr(const GfpCtx *ctx, const WordArray *a, WordArray *out)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+    ASSERT(a->len == ctx->p->len);
+    ASSERT(out->len == ctx->p->len);
+
+    if (ctx->mont_r2 == NULL) {
+        gfp_mod_sqr(ctx, a, out);
+        return;
+    }
+
+    ctx->mont_sqr(ctx, a->buf, out->buf);
+}
+
+int gfp_mont_inv(const GfpCtx *ctx, const WordArray *a, WordArray *out)
+{
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(a != NULL);
+    ASSERT(out != NULL);
+
+    /* (a * R)^(-1) * R^2 * R^2 * R^(-2) = a^(-1) * R. */
+    DO(gfp_mod_inv(ctx, a, out));
+    if (ctx->mont_r2 != NULL && !ctx->mont_plain) {
+        ctx->mont_mul(ctx, out->buf, ctx->mont_r2->buf, out->buf);
+        ctx->mont_mul(ctx, out->buf, ctx->mont_r2->buf, out->buf);
+    }
+
+cleanup:
+
+    return ret;
+}
+
+/**
+ * Вибирає з таблиці елемент з індексом idx, переглядаючи всю таблицю,
+ * щоб доступ до пам'яті не залежав від індексу.
+ */
+static void gfp_pow_table_select(const word_t *table, size_t len, size_t count, size_t idx, word_t *out)
+{
+    size_t i, j;
+    word_t mask;
+
+    memset(out, 0, len * sizeof(word_t));
+    for (i = 0; i < count; i++) {
+        mask = (word_t)0 - (word_t)(i == idx);
+        for (j = 0; j < len; j++) {
+            out[j] |= table[i * len + j] & mask;
+        }
+    }
+}
+
+/**
+ * Ширина вікна для піднесення до степеня з показником заданої довжини.
+ */
+static int gfp_pow_win_width(size_t bits)
+{
+    if (bits > 768) {
+        return 5;
+    }
+    if (bits > 192) {
+        return 4;
+    }
+    if (bits > 64) {
+        return 3;
+    }
+    return 1;
+}
+
+void gfp_mod_pow_win(const GfpCtx *ctx, const WordArray *a, const WordArray *x, int width, WordArray *out)
+{
+    WordArray *am = NULL;
+    WordArray *t = NULL;
+    word_t *table = NULL;
+    size_t len;
+    size_t count;
+    size_t digit;
+    size_t i;
+    int bits;
+    int off;
+    int j;
+    int ret = RET_OK;
+
+    ASSERT(ctx != NULL);
+    ASSERT(ctx->mont_r2 != NULL);
+    ASSERT(a != NULL);
+    ASSERT(x != NULL);
+    ASSERT(out != NULL);
+    ASSERT(width >= 1 && width <= GFP_POW_MAX_WIN_WIDTH);
+
+    len = ctx->p->len;
+    count = (size_t)1 << width;
+
+    CHECK_NOT_NULL(am = wa_alloc(len));
+    CHECK_NOT_NULL(t = wa_alloc(len));
+    MALLOC_CHECKED(table, count * len * sizeof(word_t));
+
+    /* table[i] = a^i у представленні Монтгомері. */
+    gfp_mont_to(ctx, a, am);
+    memcpy(table, ctx->mont_one->buf, len * sizeof(word_t));
+    memcpy(table + len, am->buf, len * sizeof(word_t));
+    for (i = 2; i < count; i++) {
+        ctx->mont_mul(ctx, table + (i - 1) * len, am->buf, table + i * len);
+    }
+
+    /* Фіксоване вікно: width піднесень до квадрату і одне множення на кожне вікно показника. */
+    bits = (int)int_bit_len(x);
+    off = ((bits + width - 1) / width) * width - width;
+    wa_copy(ctx->mont_one, out);
+    for (; off >= 0; off -= width) {
+        digit = 0;
+        for (j = width - 1; j >= 0; j--) {
+            digit = (digit << 1) | (size_t)int_get_bit(x, (size_t)(off + j));
+        }
+        gfp_pow_table_select(table, len, count, digit, t->buf);
+        gfp_mont_mul(ctx, out, t, out);
+        if (off > 0) {
+            for (j = 0; j < width; j++) {
+                gfp_mont_sqr(ctx, out, out);
+            }
+        }
+    }
+
+    gfp_mont_from(ctx, out, out);
+
+cleanup:
+
+    wa_free_private(am);
+    wa_free_private(t);
+    if (table != NULL) {
+        secure_zero(table, count * len * sizeof(word_t));
+        free(table);
+    }
+}
+
+/**
+ * Возведение в степень у представленні Монтгомері.
+ */
+static void gfp_mod_pow_mont(const GfpCtx *ctx, const WordArray *a, const WordArray *x, WordArray *out)
+{
+    WordArray *am = NULL;
+    WordArray *tmp = NULL;
+    int len;
+    int i;
+    int ret = RET_OK;
+
+    len = (int)int_bit_len(x);
+    if (gfp_pow_win_width((size_t)len) > 1) {
+        gfp_mod_pow_win(ctx, a, x, gfp_pow_win_width((size_t)len), out);
+        return;
+    }
+
+    CHECK_NOT_NULL(am = wa_alloc(ctx->p->len));
+    CHECK_NOT_NULL(tmp = wa_alloc(ctx->p->len));
+    gfp_mont_to(ctx, a, am);
+    wa_copy(ctx->mont_one, out);
+
+    /* Метод удвоения сложения. */
+    for (i = len - 1; i >= 0; i--) {
+        gfp_mont_sqr(ctx, out, out);
+        if (int_get_bit(x, i)) {
+            gfp_mont_mul(ctx, am, out, out);
+        } else {
+            gfp_mont_mul(ctx, am, out, tmp);
+        }
+    }
+
+    gfp_mont_from(ctx, out, out);
+
+cleanup:
+
+    wa_free_private(am);
+    wa_free_private(tmp);
 }
 
 /**
@@ -468,6 +1273,11 @@ void gfp_mod_pow(const GfpCtx *ctx, const WordArray *a, const WordArray *x, Word
     ASSERT(x != NULL);
     ASSERT(a->len == out->len);
 
+    if (ctx->mont_r2 != NULL) {
+        gfp_mod_pow_mont(ctx, a, x, out);
+        return;
+    }
+
     /* Метод удвоения сложения. */
     tmp = wa_alloc(ctx->p->len);
     wa_copy(ctx->one, out);
@@ -702,6 +1512,8 @@ void gfp_free(GfpCtx *ctx)
         wa_free_private(ctx->invert_const);
         wa_free(ctx->one);
         wa_free(ctx->two);
+        wa_free(ctx->mont_one);
+        wa_free(ctx->mont_r2);
         free(ctx);
     }
 }
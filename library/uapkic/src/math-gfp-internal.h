@@ -37,11 +37,29 @@
 extern "C" {
 #endif
 
+/** Максимальна довжина модуля у словах, для якої використовується множення Монтгомері. */
+#define GFP_MONT_MAX_LEN (8192 / WORD_BIT_LENGTH)
+
+/** Максимальна довжина модуля у словах, для якої проміжні значення інверсії розміщуються на стеку. */
+#define GFP_INV_STACK_LEN WA_LEN_FROM_BITS(2048)
+
+struct GfpCtx_st;
+
+/** Множення (піднесення до квадрату) у внутрішньому представленні поля, out може співпадати з a або b. */
+typedef void (*GfpMontMulFunc)(const struct GfpCtx_st *ctx, const word_t *a, const word_t *b, word_t *out);
+typedef void (*GfpMontSqrFunc)(const struct GfpCtx_st *ctx, const word_t *a, word_t *out);
+
 typedef struct GfpCtx_st {
     WordArray *p;
     WordArray *one;
     WordArray *two;
     WordArray *invert_const;
+    WordArray *mont_one;    /* R (mod p) - одиниця у представленні Монтгомері, R = 2^(p->len * WORD_BIT_LENGTH). */
+    WordArray *mont_r2;     /* R^2 (mod p) або NULL, якщо представлення Монтгомері недоступне (p парне). */
+    word_t mont_n0;         /* -p^(-1) (mod 2^WORD_BIT_LENGTH). */
+    bool mont_plain;        /* R = 1: для спеціального модуля ядро виконує редукцію без представлення Монтгомері. */
+    GfpMontMulFunc mont_mul;
+    GfpMontSqrFunc mont_sqr;
 } GfpCtx;
 
 GfpCtx *gfp_alloc(const WordArray *p);
@@ -52,11 +70,67 @@ void gfp_mod_sub(const GfpCtx *ctx, const WordArray *a, const WordArray *b, Word
 void gfp_mod(const GfpCtx *ctx, const WordArray *a, WordArray *out);
 void gfp_mod_mul(const GfpCtx *ctx, const WordArray *a, const WordArray *b, WordArray *out);
 void gfp_mod_sqr(const GfpCtx *ctx, const WordArray *a, WordArray *out);
-WordArray *gfp_mod_inv(const GfpCtx *ctx, const WordArray *a);
+int gfp_mod_inv(const GfpCtx *ctx, const WordArray *a, WordArray *out);
 void gfp_mod_pow(const GfpCtx *ctx, const WordArray *a, const WordArray *x, WordArray *out);
 void gfp_mod_dual_pow(const GfpCtx *ctx, const WordArray *a, const WordArray *x,
         const WordArray *b, const WordArray *y, WordArray *out);
 
+/** Максимальна ширина вікна для gfp_mod_pow_win(). */
+#define GFP_POW_MAX_WIN_WIDTH 6
+
+/**
+ * Підносить елемент поля до степеня методом фіксованого вікна у представленні Монтгомері.
+ * Послідовність операцій і доступ до таблиці не залежать від значення показника.
+ *
+ * @param ctx контекст поля, представлення Монтгомері має бути доступним
+ * @param a елемент поля
+ * @param x показник степеня
+ * @param width ширина вікна (1..GFP_POW_MAX_WIN_WIDTH)
+ * @param out a^x (mod p)
+ */
+void gfp_mod_pow_win(const GfpCtx *ctx, const WordArray *a, const WordArray *x, int width, WordArray *out);
+
+/**
+ * Переводить елемент поля GF(p) у представлення Монтгомері.
+ * Якщо представлення Монтгомері недоступне, копіює елемент.
+ *
+ * @param ctx контекст поля
+ * @param a елемент поля
+ * @param out a * R (mod p)
+ */
+void gfp_mont_to(const GfpCtx *ctx, const WordArray *a, WordArray *out);
+
+/**
+ * Переводить елемент поля GF(p) з представлення Монтгомері.
+ *
+ * @param ctx контекст поля
+ * @param a елемент поля у представленні Монтгомері
+ * @param out a * R^(-1) (mod p)
+ */
+void gfp_mont_from(const GfpCtx *ctx, const WordArray *a, WordArray *out);
+
+/**
+ * Множить елементи поля у представленні Монтгомері без виділення пам'яті.
+ *
+ * @param ctx контекст поля
+ * @param a елемент поля у представленні Монтгомері, a < p
+ * @param b елемент поля у представленні Монтгомері, b < p
+ * @param out a * b * R^(-1) (mod p)
+ */
+void gfp_mont_mul(const GfpCtx *ctx, const WordArray *a, const WordArray *b, WordArray *out);
+void gfp_mont_sqr(const GfpCtx *ctx, const WordArray *a, WordArray *out);
+
+/**
+ * Обчислює обернений елемент у представленні Монтгомері.
+ *
+ * @param ctx контекст поля
+ * @param a елемент поля у представленні Монтгомері
+ * @param out a^(-1) * R (mod p)
+ *
+ * @return код помилки
+ */
+int gfp_mont_inv(const GfpCtx *ctx, const WordArray *a, WordArray *out);
+
 /**
  * Вычисляет один из квадратных корней элемента поля GF(p).
  *
@@ -69,7 +143,17 @@ bool gfp_mod_sqrt(const GfpCtx *ctx, const WordArray *a, WordArray *out);
 
 void gfp_free(GfpCtx *ctx);
 
-WordArray *gfp_mod_inv_core(const WordArray *in, const WordArray *p);
+/**
+ * Обчислює обернений елемент за модулем p.
+ *
+ * @param in елемент
+ * @param p модуль
+ * @param out in^(-1) (mod p) довжини не менше in->len
+ *
+ * @return код помилки
+ */
+int gfp_mod_inv_core(const WordArray *in, const WordArray *p, WordArray *out);
+WordArray *gfp_mod_inv_core_with_alloc(const WordArray *in, const WordArray *p);
 
 #ifdef  __cplusplus
 }
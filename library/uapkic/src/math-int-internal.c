@@ -34,6 +34,8 @@
 #include "math-int-internal.h"
 #include "math-gfp-internal.h"
 #include "macros-internal.h"
+#include "byte-utils-internal.h"
+#include "pthread-internal.h"
 
 static size_t words_len(const word_t *a, size_t len)
 {
@@ -286,27 +288,6 @@ static void word_mul_64(word_t a, word_t b, Dword *out)
     out->hi = ab_hi + WORD_HI(ab_mid) + WORD_HI(ba_mid) + carry_bit;
 }
 
-void words_mul_64(const word_t *a, const word_t *b, size_t len, word_t *out)
-{
-    size_t i, j;
-    Dword c;
-    Dword aibj;
-
-    memset(out, 0, 2 * len * WORD_BYTE_LENGTH);
-
-    for (i = 0; i < len; i++) {
-        c.hi = 0;
-        c.lo = 0;
-        for (j = 0; j < len; j++) {
-            word_mul_64(a[i], b[j], &aibj);
-            word_add_word_64(&aibj, c.hi, &c);
-            word_add_word_64(&c, out[i + j], &c);
-            out[i + j] = c.lo;
-        }
-        out[i + len] = c.hi;
-    }
-}
-
 void words_div(const word_t *a, size_t a_len, const word_t *b, size_t b_len, word_t *q, word_t *r)
 {
 #define DIV_MAX_A_LEN (16384 / WORD_BIT_LENGTH)
@@ -438,8 +419,6 @@ void words_div(const word_t *a, size_t a_len, const word_t *b, size_t b_len, wor
 
 #ifdef ARCH32
 
-typedef uint64_t dword_t;
-
 static int words_add_32(const word_t *a, const word_t *b, size_t len, word_t *out)
 {
     dword_t sum = 0;
@@ -511,29 +490,268 @@ void word_div_32(dword_t a, word_t b, dword_t *q, word_t *r)
         *r = (word_t)rh;
     }
 }
+#endif
 
-static dword_t word_mul_32(word_t a, word_t b)
+/* Довжина (у словах), починаючи з якої множення виконується методом Карацуби.
+ * Значення отримано за допомогою uapkic-int-mul-bench (x86-64). */
+#define INT_KARATSUBA_MUL_DEFAULT_THRESHOLD 24
+#define INT_KARATSUBA_SQR_DEFAULT_THRESHOLD 52
+#ifdef UAPKIC_INT_MUL_BENCH
+size_t int_karatsuba_mul_threshold = INT_KARATSUBA_MUL_DEFAULT_THRESHOLD;
+size_t int_karatsuba_sqr_threshold = INT_KARATSUBA_SQR_DEFAULT_THRESHOLD;
+#define INT_KARATSUBA_MUL_THRESHOLD int_karatsuba_mul_threshold
+#define INT_KARATSUBA_SQR_THRESHOLD int_karatsuba_sqr_threshold
+#else
+#define INT_KARATSUBA_MUL_THRESHOLD INT_KARATSUBA_MUL_DEFAULT_THRESHOLD
+#define INT_KARATSUBA_SQR_THRESHOLD INT_KARATSUBA_SQR_DEFAULT_THRESHOLD
+#endif
+/* Максимальна довжина множників для методу Карацуби, довші множаться методом Comba. */
+#define INT_KARATSUBA_MAX_LEN (16384 / WORD_BIT_LENGTH)
+#define INT_KARATSUBA_SCRATCH_LEN (6 * INT_KARATSUBA_MAX_LEN + 64)
+
+/**
+ * Додає добуток a * b до трислівного акумулятора (c2, c1, c0).
+ */
+static __inline void word_mul_acc(word_t a, word_t b, word_t *c0, word_t *c1, word_t *c2)
 {
-    return (dword_t)a * b;
+    word_t hi, lo;
+
+    word_mul_add(a, b, *c0, 0, &hi, &lo);
+    *c0 = lo;
+    *c1 += hi;
+    *c2 += (*c1 < hi);
 }
 
-void words_mul_32(const word_t *a, const word_t *b, size_t len, word_t *out)
+/**
+ * Множення методом Comba: стовпці добутку накопичуються у трьох словах без проміжних записів у пам'ять.
+ *
+ * @param a велике ціле довжиною len слів
+ * @param b велике ціле довжиною len слів
+ * @param len довжина множників
+ * @param out буфер для добутку довжиною 2 * len слів, не співпадає з a і b
+ */
+static void words_mul_comba(const word_t *a, const word_t *b, size_t len, word_t *out)
 {
-    size_t i, j;
-    dword_t c;
+    word_t c0 = 0, c1 = 0, c2 = 0;
+    size_t i, k, i_min, i_max;
+
+    for (k = 0; k < 2 * len - 1; k++) {
+        i_min = (k < len) ? 0 : k - len + 1;
+        i_max = (k < len) ? k : len - 1;
+        for (i = i_min; i <= i_max; i++) {
+            word_mul_acc(a[i], b[k - i], &c0, &c1, &c2);
+        }
+        out[k] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+    }
+    out[2 * len - 1] = c0;
+}
 
-    memset(out, 0, 2 * len * WORD_BYTE_LENGTH);
+/**
+ * Піднесення до квадрату методом Comba: кожен перехресний добуток обчислюється один раз і подвоюється.
+ *
+ * @param a велике ціле довжиною len слів
+ * @param len довжина a
+ * @param out буфер для квадрату довжиною 2 * len слів, не співпадає з a
+ */
+static void words_sqr_comba(const word_t *a, size_t len, word_t *out)
+{
+    word_t c0 = 0, c1 = 0, c2 = 0;
+    word_t t0, t1, t2, cy;
+    size_t i, j, k, i_min;
+
+    for (k = 0; k < 2 * len - 1; k++) {
+        i_min = (k < len) ? 0 : k - len + 1;
+        t0 = t1 = t2 = 0;
+        for (i = i_min, j = k - i_min; i < j; i++, j--) {
+            word_mul_acc(a[i], a[j], &t0, &t1, &t2);
+        }
 
-    for (i = 0; i < len; i++) {
-        c = 0;
-        for (j = 0; j < len; j++) {
-            c = out[i + j] + (dword_t)a[i] * (dword_t)b[j] + (c >> WORD_BIT_LENGTH);
-            out[i + j] = (word_t)c;
+        /* (c2, c1, c0) += 2 * (t2, t1, t0). */
+        t2 = (t2 << 1) | (t1 >> (WORD_BIT_LENGTH - 1));
+        t1 = (t1 << 1) | (t0 >> (WORD_BIT_LENGTH - 1));
+        t0 <<= 1;
+        c0 += t0;
+        cy = (c0 < t0);
+        t1 += cy;
+        cy = (t1 < cy);
+        c1 += t1;
+        cy += (c1 < t1);
+        c2 += t2 + cy;
+
+        if ((k & 1) == 0) {
+            word_mul_acc(a[k >> 1], a[k >> 1], &c0, &c1, &c2);
         }
-        out[i + len] = (word_t)(c >> WORD_BIT_LENGTH);
+
+        out[k] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+    }
+    out[2 * len - 1] = c0;
+}
+
+/**
+ * Обчислює out = |x - y|, де y доповнюється нулями до довжини x.
+ * Виконується без розгалужень, що залежать від значень.
+ *
+ * @return маска з усіх одиниць, якщо x < y, інакше 0
+ */
+static word_t words_abs_diff(const word_t *x, size_t x_len, const word_t *y, size_t y_len, word_t *out)
+{
+    word_t borrow = 0;
+    word_t carry;
+    word_t mask;
+    word_t yi, d;
+    size_t i;
+
+    for (i = 0; i < x_len; i++) {
+        yi = (i < y_len) ? y[i] : 0;
+        d = x[i] - yi;
+        out[i] = d - borrow;
+        borrow = (x[i] < yi) | (d < borrow);
+    }
+
+    /* Від'ємна різниця замінюється доповненням до двох. */
+    mask = (word_t)0 - borrow;
+    carry = borrow;
+    for (i = 0; i < x_len; i++) {
+        out[i] = (out[i] ^ mask) + carry;
+        carry = (out[i] < carry);
+    }
+
+    return mask;
+}
+
+/**
+ * Множення (піднесення до квадрату, якщо a == b) методом Карацуби:
+ * a * b = z2 * B^(2k) + (z0 + z2 - (a0 - a1) * (b0 - b1)) * B^k + z0, де z0 = a0 * b0, z2 = a1 * b1.
+ *
+ * @param a велике ціле довжиною len слів
+ * @param b велике ціле довжиною len слів
+ * @param len довжина множників
+ * @param out буфер для добутку довжиною 2 * len слів, не співпадає з a і b
+ * @param scratch робочий буфер
+ */
+static void words_mul_karatsuba(const word_t *a, const word_t *b, size_t len, word_t *out, word_t *scratch)
+{
+    size_t k = len - len / 2;
+    size_t m = len / 2;
+    size_t i;
+    word_t *da, *db, *t, *mid, *next;
+    word_t mask, carry, sum;
+    bool sqr = (a == b);
+
+    if (len < (sqr ? INT_KARATSUBA_SQR_THRESHOLD : INT_KARATSUBA_MUL_THRESHOLD)) {
+        if (sqr) {
+            words_sqr_comba(a, len, out);
+        } else {
+            words_mul_comba(a, b, len, out);
+        }
+        return;
+    }
+
+    da = scratch;
+    db = da + k;
+    t = db + k;
+    mid = t + 2 * k;
+    next = mid + 2 * k + 1;
+
+    words_mul_karatsuba(a, sqr ? a : b, k, out, next);
+    words_mul_karatsuba(a + k, sqr ? a + k : b + k, m, out + 2 * k, next);
+
+    /* t = |a0 - a1| * |b0 - b1|, mask - чи від'ємний добуток різниць (тоді t додається). */
+    mask = words_abs_diff(a, k, a + k, m, da);
+    if (sqr) {
+        words_mul_karatsuba(da, da, k, t, next);
+        mask = 0;
+    } else {
+        mask ^= words_abs_diff(b, k, b + k, m, db);
+        words_mul_karatsuba(da, db, k, t, next);
+    }
+
+    /* mid = z0 + z2. */
+    carry = 0;
+    for (i = 0; i < 2 * k; i++) {
+        sum = out[i] + carry;
+        carry = (sum < carry);
+        mid[i] = sum + ((i < 2 * m) ? out[2 * k + i] : 0);
+        carry += (mid[i] < sum);
+    }
+    mid[2 * k] = carry;
+
+    /* mid = mid - t або mid + t: t замінюється на -t доповненням до двох, якщо mask == 0. */
+    mask = ~mask;
+    carry = mask & 1;
+    for (i = 0; i < 2 * k + 1; i++) {
+        sum = ((i < 2 * k) ? t[i] : 0) ^ mask;
+        sum += carry;
+        carry = (sum < carry);
+        mid[i] += sum;
+        carry += (mid[i] < sum);
+    }
+
+    /* out += mid * B^k. */
+    carry = 0;
+    for (i = 0; i < 2 * len - k; i++) {
+        sum = ((i < 2 * k + 1) ? mid[i] : 0) + carry;
+        carry = (sum < carry);
+        out[k + i] += sum;
+        carry += (out[k + i] < sum);
+    }
+}
+
+/**
+ * Верхній рівень методу Карацуби. Буфер для проміжних значень оголошено тут, а не в words_mul,
+ * щоб множення методом Comba не резервувало його на стеку.
+ */
+static void words_mul_karatsuba_top(const word_t *a, const word_t *b, size_t len, word_t *out)
+{
+    word_t scratch[INT_KARATSUBA_SCRATCH_LEN];
+
+    words_mul_karatsuba(a, b, len, out, scratch);
+    secure_zero(scratch, (6 * len + 64) * WORD_BYTE_LENGTH);
+}
+
+/**
+ * Множення великих цілих: метод Comba для коротких множників, метод Карацуби для довгих.
+ *
+ * @param a велике ціле довжиною len слів
+ * @param b велике ціле довжиною len слів, для піднесення до квадрату b == a
+ * @param len довжина множників
+ * @param out буфер для добутку довжиною 2 * len слів
+ */
+static void words_mul(const word_t *a, const word_t *b, size_t len, word_t *out)
+{
+    word_t *tmp = NULL;
+    word_t *res = out;
+
+    /* Результат не повинен перекриватися з множниками. */
+    if (out == a || out == b) {
+        tmp = malloc(2 * len * WORD_BYTE_LENGTH);
+        if (tmp == NULL) {
+            ERROR_CREATE(RET_MEMORY_ALLOC_ERROR);
+            return;
+        }
+        res = tmp;
+    }
+
+    if (len >= ((a == b) ? INT_KARATSUBA_SQR_THRESHOLD : INT_KARATSUBA_MUL_THRESHOLD) && len <= INT_KARATSUBA_MAX_LEN) {
+        words_mul_karatsuba_top(a, b, len, res);
+    } else if (a == b) {
+        words_sqr_comba(a, len, res);
+    } else {
+        words_mul_comba(a, b, len, res);
+    }
+
+    if (tmp != NULL) {
+        memcpy(out, tmp, 2 * len * WORD_BYTE_LENGTH);
+        secure_zero(tmp, 2 * len * WORD_BYTE_LENGTH);
+        free(tmp);
     }
 }
-#endif
 
 bool int_is_zero(const WordArray *a)
 {
@@ -707,11 +925,7 @@ void int_mul(const WordArray *a, const WordArray *b, WordArray *out)
     ASSERT(a->len == b->len);
     ASSERT(2 * a->len == out->len);
 
-#ifdef ARCH64
-    words_mul_64(a->buf, b->buf, a->len, out->buf);
-#else
-    words_mul_32(a->buf, b->buf, a->len, out->buf);
-#endif
+    words_mul(a->buf, b->buf, a->len, out->buf);
 }
 
 void int_sqr(const WordArray *a, WordArray *out)
@@ -720,7 +934,7 @@ void int_sqr(const WordArray *a, WordArray *out)
     ASSERT(out != NULL);
     ASSERT(2 * a->len == out->len);
 
-    int_mul(a, a, out);
+    words_mul(a->buf, a->buf, a->len, out->buf);
 }
 
 void int_div(const WordArray *a, const WordArray *b, WordArray *q, WordArray *r)
@@ -803,7 +1017,7 @@ int int_rand(const WordArray *in, WordArray *out)
 
     do {
         DO(drbg_random(e));
-        DO(wa_from_ba(e, out));
+        wa_from_le(ba_get_buf_const(e), ba_get_len(e), out);
         int_truncate(out, n_bit_len);
     } while (int_cmp(out, in) >= 0 || int_is_zero(out));
 
@@ -975,8 +1189,6 @@ int int_rabin_miller_primary_test(WordArray *num, bool *is_prime)
             goto cleanup;
         } else {
             wa_free(mul_pow);
-            wa_change_len(mul, mul->len >> 1);
-            mul->len <<= 1;
             wa_free(mul);
             mul = NULL;
             mul_pow = NULL;
@@ -1126,18 +1338,19 @@ cleanup:
     return ret;
 }
 
-int int_get_naf(const WordArray *in, int width, int **out)
+int int_get_naf(const WordArray *in, int width, int *naf)
 {
-    WordArray *k_naf = NULL;
-    WordArray *z_naf = NULL;
-    int *naf = NULL;
     int ret = RET_OK;
     size_t bitlen = 0;
 
     CHECK_PARAM(in != NULL);
-    CHECK_PARAM(out != NULL);
+    CHECK_PARAM(in->len <= INT_NAF_MAX_LEN);
+    CHECK_PARAM(naf != NULL);
     CHECK_PARAM(width >= 0);
 
+    WA_STACK(k_naf, INT_NAF_MAX_LEN, in->len);
+    WA_STACK(z_naf, INT_NAF_MAX_LEN, in->len);
+
     bitlen = in->len << WORD_BIT_LEN_SHIFT;
     word_t carry = 0;
     word_t mod = (word_t)1 << width;
@@ -1145,9 +1358,8 @@ int int_get_naf(const WordArray *in, int width, int **out)
     word_t mask_div2 = mask >> 1;
     int i = 0, j;
 
-    MALLOC_CHECKED(naf, (bitlen + 1) * sizeof(int));
-    CHECK_NOT_NULL(k_naf = wa_copy_with_alloc(in));
-    CHECK_NOT_NULL(z_naf = wa_alloc_with_zero(in->len));
+    wa_copy(in, k_naf);
+    wa_zero(z_naf);
 
     while (!int_is_zero(k_naf)) {
         word_t klow = k_naf->buf[0];
@@ -1171,20 +1383,15 @@ int int_get_naf(const WordArray *in, int width, int **out)
         i++;
     }
 
-    j = (int)(in->len << WORD_BIT_LEN_SHIFT) - i + 1;
+    j = (int)bitlen - i + 1;
     if (j > 0) {
         memset(&naf[i], 0, j * sizeof(int));
     }
 
-    *out = naf;
-    naf = NULL;
+    secure_zero(z_naf_buf, in->len * WORD_BYTE_LENGTH);
 
 cleanup:
 
-    wa_free(k_naf);
-    wa_free(z_naf);
-    free(naf);
-
     return ret;
 }
 
@@ -1448,44 +1655,52 @@ static const uint32_t PRIMES[NUMPRIMES] = {
     17789, 17791, 17807, 17827, 17837, 17839, 17851, 17863
 };
 
-static uint32_t int_mod_word(const WordArray *a, uint32_t w)
-{
-    ByteArray *ba = NULL;
-    WordArray *wa = NULL;
-    WordArray *div = NULL;
-    uint32_t out = 0;
-    int ret;
+/* Число нечетных кандидатов в одном окне решета. */
+#define INT_PRIME_SIEVE_LEN     2048
+/* Максимальное число потоков поиска простых чисел. */
+#define INT_PRIME_MAX_THREADS   8
 
-    CHECK_NOT_NULL(ba = ba_alloc_from_uint32(&w, 1));
-    CHECK_NOT_NULL(wa = wa_alloc_from_ba(ba));
-    CHECK_NOT_NULL(div = wa_alloc(a->len >> 1));
+/**
+ * Вычисляет остаток от деления большого числа на m < 2^32.
+ */
+static uint32_t words_mod_small(const word_t *a, size_t len, uint32_t m)
+{
+    uint64_t r = 0;
+    size_t i;
+    int j;
 
-    wa_change_len(wa, a->len >> 1);
-    int_div(a, wa, NULL, div);
+    for (i = len; i > 0; i--) {
+        for (j = WORD_BIT_LENGTH - 32; j >= 0; j -= 32) {
+            r = ((r << 32) | (uint32_t)(a[i - 1] >> j)) % m;
+        }
+    }
 
-    out = (uint32_t)div->buf[0];
+    return (uint32_t)r;
+}
 
-cleanup:
+/**
+ * Прибавляет к a малое число d.
+ *
+ * @return перенос из старшего слова
+ */
+static word_t words_add_small(const word_t *a, word_t d, size_t len, word_t *out)
+{
+    size_t i;
 
-    ba_free(ba);
-    wa_free(wa);
-    wa_free(div);
+    for (i = 0; i < len; i++) {
+        out[i] = a[i] + d;
+        d = (out[i] < d);
+    }
 
-    return out;
+    return d;
 }
 
 /**
- * @param bits - число бітов для генерации случайного числа
- * @return  - сгенерированное случайное число
+ * Генерирует случайное нечетное число длины bits с двумя установленными старшими битами.
  */
-int int_gen_prime(const size_t bits, WordArray **out)
+static int int_gen_prime_start(const size_t bits, WordArray **out)
 {
-    WordArray *a = NULL;
     ByteArray *rnd_bytes = NULL;
-    uint32_t gamma[NUMPRIMES];
-    uint32_t delta = 0;
-    uint32_t max_delta = 0xffffffffL - PRIMES[NUMPRIMES - 1];
-    size_t i = 0;
     size_t bits_idxs = 0;
     size_t bits_mod_8 = 0;
     size_t last_byte_idx = 0;
@@ -1493,9 +1708,6 @@ int int_gen_prime(const size_t bits, WordArray **out)
     size_t set_bit_num = 0;
     size_t byte_len;
     int ret = RET_OK;
-    bool is_prime = false;
-
-    CHECK_PARAM(bits >= 8);
 
     //Генерируем нечетное большое число
     byte_len = (bits + 7) >> 3;
@@ -1523,94 +1735,214 @@ int int_gen_prime(const size_t bits, WordArray **out)
     //Сетим предпоследний бит
     rnd_bytes->buf[pre_last_byte_idx] |= 0x01 << ((set_bit_num - 1) % 8);
 
-    CHECK_NOT_NULL(a = wa_alloc_from_ba(rnd_bytes));
+    CHECK_NOT_NULL(*out = wa_alloc_from_ba(rnd_bytes));
+
+cleanup:
 
     ba_free(rnd_bytes);
-    rnd_bytes = NULL;
+
+    return ret;
+}
+
+/**
+ * Ищет простое число длины bits, начиная со случайной точки.
+ * Кандидаты отсеиваются решетом по малым простым в окнах по INT_PRIME_SIEVE_LEN
+ * нечетных чисел, остатки от деления обновляются при сдвиге окна.
+ * Поиск прекращается досрочно (*out == NULL), если *stop стал ненулевым.
+ */
+static int int_gen_prime_search(const size_t bits, volatile long *stop, WordArray **out)
+{
+    WordArray *a = NULL;
+    WordArray *b = NULL;
+    uint32_t residues[NUMPRIMES];
+    uint8_t sieve[INT_PRIME_SIEVE_LEN];
+    uint32_t d;
+    size_t nprimes = NUMPRIMES;
+    size_t i;
+    size_t j;
+    bool is_prime = false;
+    int ret = RET_OK;
+
+    *out = NULL;
+
+    //Для коротких чисел решето только по простым, меньшим кандидата
+    if (bits < 34) {
+        for (nprimes = 1; nprimes < NUMPRIMES && PRIMES[nprimes] < ((uint32_t)1 << (bits - 2)); nprimes++);
+    }
 
 again:
-    if (bits % 256 == 0) {
-        //Генерируем гамму для получения простого числа
-        if (bits < WORD_BIT_LENGTH) {
-            for (i = 0; i < NUMPRIMES && a->buf[0] < PRIMES[i]; i++) {
-                gamma[i] = int_mod_word(a, PRIMES[i]);
+    wa_free(a);
+    a = NULL;
+    DO(int_gen_prime_start(bits, &a));
+    if (b == NULL) {
+        CHECK_NOT_NULL(b = wa_alloc(a->len));
+    }
+
+    for (i = 1; i < nprimes; i++) {
+        residues[i] = words_mod_small(a->buf, a->len, PRIMES[i]);
+    }
+
+    while (!ATOMIC_LOAD_LONG(stop)) {
+        //a + 2j делится на PRIMES[i] <=> 2j = -residues[i] (mod PRIMES[i])
+        memset(sieve, 0, sizeof(sieve));
+        for (i = 1; i < nprimes; i++) {
+            d = (PRIMES[i] - residues[i]) % PRIMES[i];
+            if (d & 1) {
+                d += PRIMES[i];
             }
-        } else {
-            for (i = 0; i < NUMPRIMES; i++) {
-                gamma[i] = int_mod_word(a, PRIMES[i]);
+            for (j = d >> 1; j < INT_PRIME_SIEVE_LEN; j += PRIMES[i]) {
+                sieve[j] = 1;
             }
         }
-        delta = 0;
-loop:
-        if (bits < WORD_BIT_LENGTH) {
-            for (i = 1; i < NUMPRIMES && a->buf[0] < PRIMES[i]; i++) {
-                if (((gamma[i] + delta) % PRIMES[i]) == 0) {
-                    delta += 2;
-                    if (delta > max_delta) {
-                        goto again;
-                    }
-                    goto loop;
-                }
+
+        for (j = 0; j < INT_PRIME_SIEVE_LEN; j++) {
+            if (sieve[j]) {
+                continue;
             }
-        } else {
-            for (i = 1; i < NUMPRIMES; i++) {
-                if (((gamma[i] + delta) % PRIMES[i]) <= 1) {
-                    delta += 2;
-                    if (delta > max_delta) {
-                        goto again;
-                    }
-                    goto loop;
-                }
+            if (ATOMIC_LOAD_LONG(stop)) {
+                goto cleanup;
+            }
+            if (words_add_small(a->buf, (word_t)(2 * j), a->len, b->buf) != 0 || int_bit_len(b) != bits) {
+                goto again;
+            }
+
+            DO(int_is_prime(b, &is_prime));
+            if (is_prime) {
+                *out = b;
+                b = NULL;
+                goto cleanup;
             }
         }
 
-        a->buf[0] += delta;
+        //Сдвигаем окно
+        if (words_add_small(a->buf, 2 * INT_PRIME_SIEVE_LEN, a->len, a->buf) != 0 || int_bit_len(a) != bits) {
+            goto again;
+        }
+        for (i = 1; i < nprimes; i++) {
+            residues[i] = (residues[i] + 2 * INT_PRIME_SIEVE_LEN) % PRIMES[i];
+        }
+    }
 
-        if (bits < WORD_BIT_LENGTH) {
-            for (i = 1; i < NUMPRIMES && a->buf[0] < PRIMES[i]; i++) {
-                if (int_mod_word(a, PRIMES[i]) != 0) {
-                    continue;
-                } else {
-                    i = 0;
-                    a->buf[0] += 2;
-                    goto again;
-                }
+cleanup:
+
+    wa_free(a);
+    wa_free(b);
+
+    return ret;
+}
+
+typedef struct IntPrimeSearch_st {
+    size_t bits;
+    size_t count;
+    size_t found;
+    WordArray **out;
+    volatile long stop;
+    int ret;
+    pthread_mutex_t mutex;
+} IntPrimeSearch;
+
+static void int_prime_search_run(IntPrimeSearch *search)
+{
+    WordArray *prime = NULL;
+    int ret;
+
+    while (!ATOMIC_LOAD_LONG(&search->stop)) {
+        ret = int_gen_prime_search(search->bits, &search->stop, &prime);
+
+        pthread_mutex_lock(&search->mutex);
+        if (ret != RET_OK) {
+            if (search->ret == RET_OK) {
+                search->ret = ret;
             }
-        } else {
-            for (i = 1; i < NUMPRIMES; i++) {
-                if (int_mod_word(a, PRIMES[i]) != 0) {
-                    continue;
-                } else {
-                    i = 0;
-                    a->buf[0] += 2;
-                    goto again;
-                }
+            ATOMIC_INC(&search->stop);
+        } else if (prime != NULL && search->found < search->count) {
+            search->out[search->found++] = prime;
+            prime = NULL;
+            if (search->found == search->count) {
+                ATOMIC_INC(&search->stop);
             }
         }
+        pthread_mutex_unlock(&search->mutex);
+
+        wa_free(prime);
+        prime = NULL;
     }
+}
 
-    DO(int_is_prime(a, &is_prime));
+static void *int_prime_search_thread(void *arg)
+{
+    int_prime_search_run((IntPrimeSearch *)arg);
+    return NULL;
+}
 
-    if (!is_prime) {
-        a->buf[0] += 2;
-        if (a->buf[0] % 5 == 0) {
-            a->buf[0] += 2;
+/**
+ * Генерирует count случайных простых чисел длины bits.
+ * Поиск ведется параллельно из независимых случайных точек
+ * (до INT_PRIME_MAX_THREADS потоков, включая вызывающий).
+ *
+ * @param bits  число битов простого числа
+ * @param count количество простых чисел
+ * @param out   массив для count простых чисел
+ */
+int int_gen_primes(const size_t bits, const size_t count, WordArray **out)
+{
+    IntPrimeSearch search;
+    pthread_t threads[INT_PRIME_MAX_THREADS];
+    size_t nthreads;
+    size_t started = 0;
+    size_t i;
+    int ret = RET_OK;
+
+    CHECK_PARAM(bits >= 8);
+    CHECK_PARAM(count > 0);
+    CHECK_PARAM(out != NULL);
+
+    for (i = 0; i < count; i++) {
+        out[i] = NULL;
+    }
+
+    memset(&search, 0, sizeof(search));
+    search.bits = bits;
+    search.count = count;
+    search.out = out;
+    search.ret = RET_OK;
+    pthread_mutex_init(&search.mutex, NULL);
+
+    nthreads = pthread_cpu_count();
+    if (nthreads > INT_PRIME_MAX_THREADS) {
+        nthreads = INT_PRIME_MAX_THREADS;
+    }
+    for (started = 0; started + 1 < nthreads; started++) {
+        if (pthread_create(&threads[started], NULL, int_prime_search_thread, &search) != 0) {
+            break;
         }
-        goto again;
     }
 
-    if (int_bit_len(a) != bits) {
-        a->buf[0] += 2;
-        goto again;
+    int_prime_search_run(&search);
+
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
     }
+    pthread_mutex_destroy(&search.mutex);
 
-    *out = a;
-    a = NULL;
+    if (search.ret != RET_OK) {
+        for (i = 0; i < count; i++) {
+            wa_free(out[i]);
+            out[i] = NULL;
+        }
+        SET_ERROR(search.ret);
+    }
 
 cleanup:
 
-    wa_free(a);
-    ba_free(rnd_bytes);
-
     return ret;
 }
+
+/**
+ * @param bits - число бітов для генерации случайного числа
+ * @return  - сгенерированное случайное число
+ */
+int int_gen_prime(const size_t bits, WordArray **out)
+{
+    return int_gen_primes(bits, 1, out);
+}
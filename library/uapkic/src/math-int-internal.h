@@ -45,6 +45,49 @@ typedef struct Dword_st {
     word_t hi;
 } Dword;
 
+#if defined(ARCH64) && defined(__SIZEOF_INT128__)
+typedef unsigned __int128 dword_t;
+# define DWORD_NATIVE
+#elif defined(ARCH32)
+typedef uint64_t dword_t;
+# define DWORD_NATIVE
+#endif
+
+/**
+ * Обчислює (hi, lo) = a * b + c + d. Результат завжди вміщується у два слова.
+ *
+ * @param a множник
+ * @param b множник
+ * @param c доданок
+ * @param d доданок
+ * @param hi старше слово результату
+ * @param lo молодше слово результату
+ */
+static __inline void word_mul_add(word_t a, word_t b, word_t c, word_t d, word_t *hi, word_t *lo)
+{
+#ifdef DWORD_NATIVE
+    dword_t t = (dword_t)a * b + c + d;
+
+    *lo = (word_t)t;
+    *hi = (word_t)(t >> WORD_BIT_LENGTH);
+#else
+    word_t ll = WORD_LO(a) * WORD_LO(b);
+    word_t lh = WORD_LO(a) * WORD_HI(b);
+    word_t hl = WORD_HI(a) * WORD_LO(b);
+    word_t hh = WORD_HI(a) * WORD_HI(b);
+    word_t mid = WORD_HI(ll) + WORD_LO(lh) + WORD_LO(hl);
+    word_t l = (mid << HALF_WORD_BIT_LENGTH) | WORD_LO(ll);
+    word_t h = hh + WORD_HI(lh) + WORD_HI(hl) + WORD_HI(mid);
+
+    l += c;
+    h += (l < c);
+    l += d;
+    h += (l < d);
+    *lo = l;
+    *hi = h;
+#endif
+}
+
 /**
  * Перевіряє равенство нулю большого целого числа.
  *
@@ -181,6 +224,12 @@ void int_mul(const WordArray *a, const WordArray *b, WordArray *out);
  */
 void int_sqr(const WordArray *a, WordArray *out);
 
+#ifdef UAPKIC_INT_MUL_BENCH
+/* Пороги методу Карацуби, змінюються лише в uapkic-int-mul-bench. */
+extern size_t int_karatsuba_mul_threshold;
+extern size_t int_karatsuba_sqr_threshold;
+#endif
+
 /**
  * Вычисляет частное і остатоквідделения больших целых чисел.
  * a = q * b + r
@@ -227,12 +276,27 @@ void factorial(size_t n, WordArray *fac);
  */
 int int_mult_and_div(const WordArray *a, word_t b, word_t c, int n, WordArray *abc);
 
-int int_get_naf(const WordArray *in, int width, int **out);
+/* Найбільша довжина числа для int_get_naf, достатня для скалярів еліптичних кривих. */
+#define INT_NAF_MAX_LEN WA_LEN_FROM_BITS(2048)
+#define INT_NAF_BUF_LEN (INT_NAF_MAX_LEN * WORD_BIT_LENGTH + 1)
+
+/**
+ * Обчислює NAF-подання числа з вікном width.
+ *
+ * @param in число довжиною не більше INT_NAF_MAX_LEN слів
+ * @param width ширина вікна
+ * @param naf буфер для результату довжиною (in->len * WORD_BIT_LENGTH + 1)
+ *
+ * @return код помилки
+ */
+int int_get_naf(const WordArray *in, int width, int *naf);
 
 int int_get_naf_extra_add(const WordArray *in, const int *naf, int width, int *extra_addition);
 
 int int_gen_prime(const size_t bits, WordArray **out);
 
+int int_gen_primes(const size_t bits, const size_t count, WordArray **out);
+
 #ifdef  __cplusplus
 }
 #endif
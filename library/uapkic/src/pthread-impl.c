@@ -217,3 +217,32 @@ unsigned long pthread_id(void)
 
     return ret;
 }
+
+size_t pthread_cpu_count(void)
+{
+    size_t ret = 1;
+
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    if (info.dwNumberOfProcessors > 0) {
+        ret = (size_t)info.dwNumberOfProcessors;
+    }
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long cnt = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cnt > 0) {
+        ret = (size_t)cnt;
+    }
+#endif
+
+    return ret;
+}
+
+void pthread_sleep_ms(unsigned int ms)
+{
+#ifdef _WIN32
+    Sleep(ms);
+#else
+    usleep((useconds_t)ms * 1000);
+#endif
+}
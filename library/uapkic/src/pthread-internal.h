@@ -106,6 +106,31 @@ int pthread_attr_destroy(pthread_attr_t* attr);
 #include <unistd.h>
 #endif /* _WIN32 */
 
+#include <stddef.h>
+
 unsigned long pthread_id(void);
 
+/* Кількість доступних логічних процесорів (не менше 1). */
+size_t pthread_cpu_count(void);
+
+/* Призупиняє поточний потік на ms мілісекунд. */
+void pthread_sleep_ms(unsigned int ms);
+
+/* Атомарні операції для лічильників посилань і публікації вказівників без блокування. */
+#ifdef _WIN32
+#define ATOMIC_INC(p)           InterlockedIncrement(p)
+#define ATOMIC_DEC(p)           InterlockedDecrement(p)
+#define ATOMIC_LOAD_LONG(p)     InterlockedCompareExchange((p), 0, 0)
+#define ATOMIC_XCHG_LONG(p, v)  InterlockedExchange((p), (v))
+#define ATOMIC_LOAD_PTR(pp)     InterlockedCompareExchangePointer((PVOID volatile *)(pp), NULL, NULL)
+#define ATOMIC_STORE_PTR(pp, v) InterlockedExchangePointer((PVOID volatile *)(pp), (v))
+#else
+#define ATOMIC_INC(p)           __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+#define ATOMIC_DEC(p)           __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#define ATOMIC_LOAD_LONG(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ATOMIC_XCHG_LONG(p, v)  __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+#define ATOMIC_LOAD_PTR(pp)     __atomic_load_n((pp), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE_PTR(pp, v) __atomic_store_n((pp), (v), __ATOMIC_RELEASE)
+#endif
+
 #endif /* PTHREAD_INTERNAL_H_ */
@@ -57,6 +57,11 @@ struct RsaCtx_st {
     GfpCtx *gfp;
     WordArray *e;
     WordArray *d;
+    GfpCtx *gfp_p;          /* Параметри CRT: поле за модулем p */
+    GfpCtx *gfp_q;          /* Параметри CRT: поле за модулем q */
+    WordArray *dmp1;        /* d mod (p - 1) */
+    WordArray *dmq1;        /* d mod (q - 1) */
+    WordArray *iqmp;        /* q^(-1) mod p */
 };
 
 #define MIN_RSA_BITS     (512)
@@ -156,6 +161,116 @@ cleanup:
     return ret;
 }
 
+/**
+ * Обчислює src^d (mod n) за китайською теоремою про залишки.
+ * Результат перевіряється публічною експонентою для захисту від збоїв обчислення.
+ */
+static int rsa_crt_exp(const RsaCtx *ctx, const WordArray *src, WordArray *dst)
+{
+    int ret = RET_OK;
+    size_t plen = ctx->gfp_p->p->len;
+    size_t qlen = ctx->gfp_q->p->len;
+    size_t len = (plen > qlen) ? plen : qlen;
+    WordArray *cp = NULL;
+    WordArray *cq = NULL;
+    WordArray *m1 = NULL;
+    WordArray *m2 = NULL;
+    WordArray *h = NULL;
+    WordArray *wq = NULL;
+    WordArray *hq = NULL;
+    WordArray *m = NULL;
+    WordArray *check = NULL;
+
+    CHECK_NOT_NULL(cp = wa_alloc(plen));
+    CHECK_NOT_NULL(cq = wa_alloc(qlen));
+    CHECK_NOT_NULL(m1 = wa_alloc(plen));
+    CHECK_NOT_NULL(m2 = wa_alloc(qlen));
+    CHECK_NOT_NULL(h = wa_alloc(plen));
+
+    /* m1 = c^dP (mod p), m2 = c^dQ (mod q). */
+    int_div(src, ctx->gfp_p->p, NULL, cp);
+    int_div(src, ctx->gfp_q->p, NULL, cq);
+    gfp_mod_pow(ctx->gfp_p, cp, ctx->dmp1, m1);
+    gfp_mod_pow(ctx->gfp_q, cq, ctx->dmq1, m2);
+
+    /* h = qInv * (m1 - m2) (mod p). */
+    int_div(m2, ctx->gfp_p->p, NULL, cp);
+    gfp_mod_sub(ctx->gfp_p, m1, cp, h);
+    gfp_mod_mul(ctx->gfp_p, h, ctx->iqmp, h);
+
+    /* m = m2 + h * q. */
+    CHECK_NOT_NULL(wq = wa_copy_with_alloc(ctx->gfp_q->p));
+    CHECK_NOT_NULL(m = wa_alloc_with_zero(2 * len));
+    CHECK_NOT_NULL(hq = wa_alloc(2 * len));
+    wa_change_len(wq, len);
+    wa_change_len(h, len);
+    int_mul(h, wq, hq);
+    memcpy(m->buf, m2->buf, qlen * WORD_BYTE_LENGTH);
+    int_add(hq, m, m);
+    wa_change_len(m, dst->len);
+
+    CHECK_NOT_NULL(check = wa_alloc(dst->len));
+    gfp_mod_pow(ctx->gfp, m, ctx->e, check);
+    if (!int_equals(check, src)) {
+        SET_ERROR(RET_INVALID_CTX);
+    }
+
+    DO(wa_copy(m, dst));
+
+cleanup:
+
+    wa_free_private(cp);
+    wa_free_private(cq);
+    wa_free_private(m1);
+    wa_free_private(m2);
+    wa_free_private(h);
+    wa_free_private(hq);
+    wa_free_private(m);
+    wa_free(wq);
+    wa_free(check);
+
+    return ret;
+}
+
+/**
+ * Операція з особистим ключем: з параметрами CRT, якщо вони задані, інакше піднесенням до степеня d.
+ */
+static int rsa_private_exp(const RsaCtx *ctx, WordArray *src, WordArray **dst)
+{
+    int ret = RET_OK;
+
+    if (ctx->gfp_p == NULL || int_cmp(src, ctx->gfp->p) >= 0) {
+        return rsaedp(ctx->gfp, ctx->d, src, dst);
+    }
+
+    CHECK_NOT_NULL(*dst = wa_alloc(ctx->gfp->p->len));
+    wa_change_len(src, ctx->gfp->p->len);
+    ret = rsa_crt_exp(ctx, src, *dst);
+    if (ret != RET_OK) {
+        wa_free(*dst);
+        *dst = NULL;
+        return rsaedp(ctx->gfp, ctx->d, src, dst);
+    }
+
+cleanup:
+
+    return ret;
+}
+
+static void rsa_crt_free(RsaCtx *ctx)
+{
+    gfp_free(ctx->gfp_p);
+    gfp_free(ctx->gfp_q);
+    wa_free_private(ctx->dmp1);
+    wa_free_private(ctx->dmq1);
+    wa_free_private(ctx->iqmp);
+    ctx->gfp_p = NULL;
+    ctx->gfp_q = NULL;
+    ctx->dmp1 = NULL;
+    ctx->dmq1 = NULL;
+    ctx->iqmp = NULL;
+}
+
 static int rsa_encrypt_pkcs1_v1_5(const RsaCtx *ctx, const ByteArray *data, ByteArray **out)
 {
     uint8_t *m = NULL;
@@ -233,7 +348,7 @@ static int rsa_decrypt_pkcs1_v1_5(const RsaCtx *ctx, const ByteArray *data, Byte
 
     CHECK_NOT_NULL(wdata = wa_alloc_from_be(data->buf, data->len));
 
-    DO(rsaedp(ctx->gfp, ctx->d, wdata, &wm));
+    DO(rsa_private_exp(ctx, wdata, &wm));
     len = ctx->gfp->p->len * WORD_BYTE_LENGTH;
     MALLOC_CHECKED(m, len);
     DO(wa_to_uint8(wm, m, len));
@@ -384,7 +499,7 @@ static int rsa_decrypt_oaep(RsaCtx *ctx, const ByteArray *msg, ByteArray **out)
 
     CHECK_NOT_NULL(lhash = oaep_get_lhash(ctx->hash_alg, ctx->label));
 
-    DO(rsaedp(ctx->gfp, ctx->d, wc, &wem));
+    DO(rsa_private_exp(ctx, wc, &wem));
 
     MALLOC_CHECKED(em, len);
     DO(wa_to_uint8(wem, em, len));
@@ -459,6 +574,7 @@ static int rsa_gen_privkey_core(const size_t bits, const ByteArray *e,
     WordArray *wmin_val = NULL;
     WordArray *one = NULL;
     WordArray *q_tmp = NULL;
+    WordArray *primes[2] = {NULL, NULL};
     size_t wplen = 0;
     size_t bitplen = 0;
     bool is_goto_begin = false;
@@ -474,7 +590,14 @@ static int rsa_gen_privkey_core(const size_t bits, const ByteArray *e,
 
     begin:
 
-    DO(int_gen_prime(bitplen, &wp));
+    if (bits - bitplen == bitplen) {
+        //  p и q одной длины ищутся одновременно
+        DO(int_gen_primes(bitplen, 2, primes));
+        wp = primes[0];
+        wq = primes[1];
+    } else {
+        DO(int_gen_prime(bitplen, &wp));
+    }
 
     CHECK_NOT_NULL(one = wa_alloc_with_zero(wp->len));
     one->buf[0] = 1;
@@ -485,10 +608,10 @@ static int rsa_gen_privkey_core(const size_t bits, const ByteArray *e,
     wa_change_len(wmin_val, wp->len);
 
     do {
-        wa_free(wq);
-        wq = NULL;
-
-        DO(int_gen_prime(bits - bitplen, &wq));
+        comp_p_q = 0;
+        if (wq == NULL) {
+            DO(int_gen_prime(bits - bitplen, &wq));
+        }
         ret = int_cmp(wq, wp);
         if (ret != 0) {
             if (ret > 0) {
@@ -506,6 +629,10 @@ static int rsa_gen_privkey_core(const size_t bits, const ByteArray *e,
             wa_free(wsub_p_q);
             wsub_p_q = NULL;
         }
+        if (comp_p_q != 1) {
+            wa_free(wq);
+            wq = NULL;
+        }
     } while (comp_p_q != 1);
 
     ret = RET_OK;
@@ -528,7 +655,7 @@ static int rsa_gen_privkey_core(const size_t bits, const ByteArray *e,
     CHECK_NOT_NULL(we = wa_alloc_from_ba(e));
     wa_change_len(we, 2 * wplen);
 
-    wd = gfp_mod_inv_core(we, fi);
+    wd = gfp_mod_inv_core_with_alloc(we, fi);
     if (wd == NULL) {
         is_goto_begin = true;
         goto cleanup;
@@ -572,6 +699,13 @@ cleanup:
     wa_free(wmin_val);
     if (is_goto_begin) {
         is_goto_begin = false;
+        wn = NULL;
+        wd = NULL;
+        fi = NULL;
+        wp = NULL;
+        we = NULL;
+        one = NULL;
+        wmin_val = NULL;
         goto begin;
     }
 
@@ -656,7 +790,7 @@ int rsa_generate_privkey_ext(const size_t bits, const ByteArray *e, ByteArray **
 
     /* coefficient = (inverse of q) mod p */
     CHECK_NOT_NULL(gfp = gfp_alloc(wp));
-    CHECK_NOT_NULL(wiqmp = gfp_mod_inv_core(wq, wp));
+    CHECK_NOT_NULL(wiqmp = gfp_mod_inv_core_with_alloc(wq, wp));
 
     WA_TO_BE_WITH_TRUNC(wn, *n);
     WA_TO_BE_WITH_TRUNC(wp, *p);
@@ -740,7 +874,7 @@ bool rsa_validate_key(RsaCtx *ctx, const ByteArray *n, const ByteArray *e, const
     wa_change_len(we, 2 * wplen);
 
     /* d = e^-1 mod fi*/
-    CHECK_NOT_NULL(wd = gfp_mod_inv_core(we, fi));
+    CHECK_NOT_NULL(wd = gfp_mod_inv_core_with_alloc(we, fi));
     CHECK_NOT_NULL(wa_exp = wa_alloc_from_be(d->buf, d->len));
     if (!int_equals(wa_exp, wd)) {
         SET_ERROR(RET_INVALID_RSA_D);
@@ -775,7 +909,7 @@ bool rsa_validate_key(RsaCtx *ctx, const ByteArray *n, const ByteArray *e, const
 
     /* coefficient = (inverse of q) mod p */
     CHECK_NOT_NULL(gfp = gfp_alloc(wp));
-    CHECK_NOT_NULL(wiqmp = gfp_mod_inv_core(wq, wp));
+    CHECK_NOT_NULL(wiqmp = gfp_mod_inv_core_with_alloc(wq, wp));
     CHECK_NOT_NULL(wa_exp = wa_alloc_from_be(iqmp->buf, iqmp->len));
     if (!int_equals(wa_exp, wiqmp)) {
         SET_ERROR(RET_INVALID_RSA_IQMP);
@@ -815,6 +949,7 @@ static int rsa_init_private(RsaCtx* ctx, const ByteArray* n, const ByteArray* d)
 
     wa_free(ctx->e);
     ctx->e = NULL;
+    rsa_crt_free(ctx);
 
     gfp_free(ctx->gfp);
     CHECK_NOT_NULL(wn = wa_alloc_from_be(n->buf, n->len));
@@ -838,6 +973,7 @@ static int rsa_init_public(RsaCtx* ctx, const ByteArray* n, const ByteArray* e)
 
     wa_free_private(ctx->d);
     ctx->d = NULL;
+    rsa_crt_free(ctx);
 
     wa_free(ctx->e);
     CHECK_NOT_NULL(ctx->e = wa_alloc_from_be(e->buf, e->len));
@@ -978,12 +1114,89 @@ cleanup:
     return ret;
 }
 
+int rsa_init_crt(RsaCtx* ctx, const ByteArray* e, const ByteArray* p, const ByteArray* q,
+    const ByteArray* dmp1, const ByteArray* dmq1, const ByteArray* iqmp)
+{
+    int ret = RET_OK;
+    WordArray* wp = NULL;
+    WordArray* wq = NULL;
+    WordArray* wn = NULL;
+    size_t len;
+
+    CHECK_PARAM(ctx != NULL);
+    CHECK_PARAM(e != NULL);
+    CHECK_PARAM(p != NULL);
+    CHECK_PARAM(q != NULL);
+    CHECK_PARAM(dmp1 != NULL);
+    CHECK_PARAM(dmq1 != NULL);
+    CHECK_PARAM(iqmp != NULL);
+
+    if (ctx->d == NULL || ctx->gfp == NULL) {
+        SET_ERROR(RET_INVALID_CTX);
+    }
+
+    rsa_crt_free(ctx);
+
+    CHECK_NOT_NULL(wp = wa_alloc_from_be(p->buf, p->len));
+    CHECK_NOT_NULL(wq = wa_alloc_from_be(q->buf, q->len));
+    wa_change_len(wp, int_word_len(wp));
+    wa_change_len(wq, int_word_len(wq));
+    if (wp->len == 0 || wq->len == 0 || (wp->buf[0] & 1) == 0 || (wq->buf[0] & 1) == 0) {
+        SET_ERROR(RET_INVALID_PARAM);
+    }
+
+    /* n = p * q */
+    len = (wp->len > wq->len) ? wp->len : wq->len;
+    CHECK_NOT_NULL(wn = wa_alloc(2 * len));
+    wa_change_len(wp, len);
+    wa_change_len(wq, len);
+    int_mul(wp, wq, wn);
+    wa_change_len(wp, int_word_len(wp));
+    wa_change_len(wq, int_word_len(wq));
+    if (int_word_len(wn) > ctx->gfp->p->len) {
+        SET_ERROR(RET_INVALID_RSA_N);
+    }
+    wa_change_len(wn, ctx->gfp->p->len);
+    if (!int_equals(wn, ctx->gfp->p)) {
+        SET_ERROR(RET_INVALID_RSA_N);
+    }
+
+    CHECK_NOT_NULL(ctx->gfp_p = gfp_alloc(wp));
+    CHECK_NOT_NULL(ctx->gfp_q = gfp_alloc(wq));
+    CHECK_NOT_NULL(ctx->dmp1 = wa_alloc_from_be(dmp1->buf, dmp1->len));
+    CHECK_NOT_NULL(ctx->dmq1 = wa_alloc_from_be(dmq1->buf, dmq1->len));
+    CHECK_NOT_NULL(ctx->iqmp = wa_alloc_from_be(iqmp->buf, iqmp->len));
+    if (int_word_len(ctx->iqmp) > wp->len) {
+        SET_ERROR(RET_INVALID_RSA_IQMP);
+    }
+    wa_change_len(ctx->iqmp, wp->len);
+    if (int_cmp(ctx->iqmp, ctx->gfp_p->p) >= 0) {
+        SET_ERROR(RET_INVALID_RSA_IQMP);
+    }
+
+    wa_free(ctx->e);
+    CHECK_NOT_NULL(ctx->e = wa_alloc_from_be(e->buf, e->len));
+    wa_change_len(ctx->e, ctx->gfp->p->len);
+
+cleanup:
+
+    if (ret != RET_OK && ctx != NULL) {
+        rsa_crt_free(ctx);
+    }
+    wa_free_private(wp);
+    wa_free_private(wq);
+    wa_free(wn);
+
+    return ret;
+}
+
 void rsa_free(RsaCtx* ctx)
 {
     if (ctx) {
         wa_free_private(ctx->e);
         wa_free_private(ctx->d);
         gfp_free(ctx->gfp);
+        rsa_crt_free(ctx);
     }
     free(ctx);
 }
@@ -1145,7 +1358,7 @@ static int rsa_sign_pkcs1_v1_5(RsaCtx *ctx, const ByteArray *H, ByteArray **sign
     DO(ba_to_uint8(H, em + len - hlen, hlen));
 
     CHECK_NOT_NULL(em_wa = wa_alloc_from_be(em, len));
-    DO(rsaedp(ctx->gfp, ctx->d, em_wa, &sign_wa));
+    DO(rsa_private_exp(ctx, em_wa, &sign_wa));
 
     WA_TO_BE_WITH_N_LEN(ctx, sign_wa, *sign);
 
@@ -1379,7 +1592,7 @@ static int rsa_sign_pss(RsaCtx* ctx, const ByteArray* H, const ByteArray* salt,
 
     DO(rsa_pss_encode(ctx, H, salt, &ba_encoded));
     CHECK_NOT_NULL(wa_encoded = wa_alloc_from_be(ba_encoded->buf, ba_encoded->len));
-    DO(rsaedp(ctx->gfp, ctx->d, wa_encoded, &wa_sign));
+    DO(rsa_private_exp(ctx, wa_encoded, &wa_sign));
     WA_TO_BE_WITH_N_LEN(ctx, wa_sign, *sign);
 
 cleanup:
@@ -1704,6 +1917,129 @@ cleanup:
     return ret;
 }
 
+static int rsa_crt_self_test(void)
+{
+    // Ключ з p < q, підпис PKCS#1 v1.5 (SHA-256) повідомлення "abc" обчислено без CRT
+    static const uint8_t test_n[128] = {
+        0xBE, 0x6E, 0x82, 0x41, 0x91, 0x79, 0xF5, 0x79, 0xBA, 0x56, 0x79, 0xCA, 0xAE, 0x83, 0x68, 0xBB,
+        0xE0, 0x00, 0xFF, 0xEF, 0x1C, 0xD7, 0xF7, 0xA1, 0xFA, 0xE3, 0x08, 0xEF, 0x81, 0x11, 0x8A, 0x9B,
+        0xD8, 0x93, 0xA9, 0x4F, 0xEE, 0x0F, 0xB0, 0x83, 0x11, 0x30, 0x15, 0x4B, 0x65, 0x4C, 0x4C, 0xF5,
+        0xC2, 0xB7, 0xA2, 0xDA, 0x2A, 0x19, 0x2C, 0xFA, 0x6B, 0x38, 0xCF, 0x31, 0xEE, 0xBA, 0x5A, 0x30,
+        0xBE, 0x1A, 0x6F, 0xE7, 0xA2, 0xBC, 0x8B, 0x22, 0xED, 0x41, 0x55, 0x0C, 0xCC, 0xD5, 0xF9, 0xA1,
+        0xB7, 0xFD, 0xB8, 0xEE, 0x9F, 0x88, 0x37, 0x37, 0x5D, 0xD4, 0x64, 0x9F, 0xCB, 0xCF, 0xDF, 0x5B,
+        0xA2, 0xA4, 0x47, 0x97, 0x4C, 0xD8, 0xB8, 0x98, 0x32, 0xA0, 0x32, 0xC2, 0x96, 0x5D, 0x50, 0xA6,
+        0x4D, 0x2F, 0x73, 0xA6, 0x0E, 0x37, 0x9E, 0xE9, 0x39, 0xE0, 0xAC, 0xF7, 0x98, 0x3E, 0x7C, 0xA9 };
+    static const uint8_t test_d[128] = {
+        0x65, 0xD7, 0xA1, 0xEF, 0xC1, 0x06, 0x71, 0x62, 0xA5, 0x65, 0xE4, 0x02, 0xA2, 0x2C, 0x03, 0x12,
+        0x1E, 0xED, 0x49, 0xF2, 0xAE, 0x01, 0x4E, 0x1D, 0x21, 0x98, 0xD3, 0xC9, 0x8A, 0xC4, 0x3F, 0xD5,
+        0xB3, 0x10, 0xDD, 0x46, 0xB2, 0xF1, 0x4F, 0x1B, 0xF9, 0x50, 0x36, 0xC3, 0x38, 0xAC, 0x82, 0xA8,
+        0x18, 0x77, 0xAF, 0x2F, 0x6F, 0xBE, 0x41, 0x10, 0xB7, 0xD1, 0x0C, 0xF6, 0x0E, 0x4F, 0x39, 0x35,
+        0xD4, 0xA1, 0x20, 0xDC, 0xCD, 0x60, 0x2F, 0xF7, 0x84, 0xBF, 0x6E, 0x80, 0xCE, 0x04, 0x6E, 0xB6,
+        0x5A, 0x0F, 0x7B, 0x2E, 0x5A, 0x4A, 0xA4, 0xFE, 0x22, 0x2F, 0x9A, 0xBA, 0x13, 0x1C, 0xF6, 0x38,
+        0x3C, 0x9F, 0xF7, 0x1D, 0x18, 0x63, 0xBD, 0xBB, 0x93, 0xA9, 0x73, 0xE3, 0x46, 0x1B, 0x4C, 0x9C,
+        0xDC, 0x3B, 0x72, 0xA3, 0xC8, 0x50, 0x8E, 0xB6, 0xB9, 0xE6, 0x28, 0x48, 0x51, 0xA8, 0xB1, 0xA5 };
+    static const uint8_t test_p[64] = {
+        0xC6, 0x67, 0xED, 0xFE, 0x99, 0x32, 0x53, 0x71, 0x3A, 0x5E, 0x00, 0x66, 0x70, 0xB7, 0x29, 0xF4,
+        0x68, 0x1A, 0x33, 0xBE, 0xDA, 0x46, 0x38, 0x42, 0x13, 0x18, 0xAB, 0x42, 0xF7, 0x28, 0x42, 0xC8,
+        0x58, 0xD9, 0x21, 0x32, 0xF9, 0xB0, 0x99, 0xA2, 0x48, 0x2D, 0xFB, 0xBE, 0xE8, 0x74, 0x00, 0x5C,
+        0x4E, 0xD9, 0x54, 0x85, 0xEB, 0xA5, 0x68, 0xE1, 0x20, 0xE0, 0x10, 0x03, 0xFD, 0x2F, 0xED, 0xCB };
+    static const uint8_t test_q[64] = {
+        0xF5, 0xB5, 0xFC, 0xE7, 0x64, 0x61, 0x6D, 0xDE, 0xD8, 0xE6, 0x11, 0x5E, 0xD3, 0xCF, 0x6C, 0xE6,
+        0x02, 0x01, 0xBC, 0x42, 0xAB, 0x84, 0xAF, 0xEE, 0x0B, 0x84, 0xC1, 0x1D, 0x54, 0x92, 0x0A, 0x51,
+        0x40, 0xDD, 0xD4, 0x0F, 0x61, 0xDA, 0x8B, 0x2A, 0xFD, 0xD4, 0xB6, 0xA3, 0xE4, 0xD9, 0x2C, 0x78,
+        0x00, 0xBE, 0x97, 0xAD, 0x67, 0x38, 0x32, 0x13, 0xFB, 0xF4, 0x7A, 0xCF, 0x15, 0xF8, 0x30, 0xDB };
+    static const uint8_t test_dmp1[64] = {
+        0xB6, 0x43, 0x91, 0x79, 0xFA, 0xE8, 0x25, 0x89, 0x75, 0xF2, 0x16, 0xF2, 0x04, 0x87, 0xEF, 0x2D,
+        0xCC, 0x58, 0x8D, 0xC2, 0xBD, 0x28, 0x16, 0xD4, 0x74, 0x50, 0x8C, 0x3C, 0x07, 0x6B, 0x5F, 0xF6,
+        0x46, 0xD0, 0xA8, 0xD3, 0xF8, 0x57, 0x08, 0xBB, 0xF1, 0x0C, 0xF5, 0x20, 0x8A, 0xD0, 0xCD, 0xE7,
+        0xFE, 0xB3, 0x5E, 0x17, 0x6C, 0xC3, 0xD6, 0x96, 0x42, 0x2A, 0x33, 0xEC, 0x46, 0x32, 0x3A, 0x83 };
+    static const uint8_t test_dmq1[64] = {
+        0x0D, 0x10, 0xE1, 0x62, 0xF8, 0x9E, 0x89, 0xB6, 0x28, 0xF8, 0x8B, 0x01, 0xEC, 0xE7, 0x81, 0xD5,
+        0xF5, 0x53, 0x5C, 0x4C, 0x7B, 0x4C, 0x72, 0x02, 0x89, 0x90, 0x44, 0xA8, 0xA7, 0x9F, 0xA0, 0x76,
+        0xD3, 0xA9, 0x38, 0x26, 0x9D, 0x40, 0x7E, 0xD8, 0x09, 0x69, 0x6F, 0x50, 0xE5, 0xD1, 0x7A, 0xA0,
+        0xE3, 0x01, 0x3F, 0x95, 0x94, 0x00, 0x94, 0x01, 0x26, 0x0B, 0xC9, 0x20, 0x0B, 0xFE, 0x07, 0xB3 };
+    static const uint8_t test_iqmp[64] = {
+        0x05, 0xEF, 0x9C, 0xA0, 0xA6, 0x0C, 0x06, 0xCD, 0x6F, 0xD9, 0x45, 0x14, 0xFB, 0x66, 0x9E, 0x0F,
+        0x60, 0x29, 0xD8, 0x25, 0xD1, 0x8C, 0x9D, 0x50, 0x84, 0xC4, 0xBC, 0x5F, 0x37, 0x93, 0x1F, 0x62,
+        0x80, 0x1D, 0x06, 0xA9, 0xC1, 0x18, 0x90, 0x80, 0x98, 0x79, 0x30, 0x15, 0x4F, 0x0D, 0x43, 0x87,
+        0x04, 0x62, 0xCB, 0x76, 0x56, 0xFA, 0x12, 0xDA, 0xCA, 0x11, 0x99, 0x5A, 0x01, 0x00, 0x7B, 0x76 };
+    static const uint8_t test_ipmq[64] = {
+        0xEE, 0x5C, 0x10, 0x17, 0x63, 0x84, 0x1D, 0x68, 0xD2, 0x23, 0x93, 0x3B, 0xC4, 0xAA, 0x08, 0xFF,
+        0xBC, 0xEF, 0xFF, 0xB0, 0x48, 0x64, 0x1D, 0xE0, 0x4F, 0xE3, 0xB0, 0x54, 0xA2, 0x35, 0x3A, 0xD1,
+        0xC3, 0xC6, 0x47, 0x0E, 0x7B, 0x1C, 0x6F, 0xEB, 0x7E, 0x13, 0x25, 0x71, 0x2B, 0x95, 0xB8, 0x6F,
+        0xDF, 0xE9, 0xBD, 0x49, 0xAB, 0x7A, 0x70, 0x2F, 0x78, 0x90, 0x44, 0x7E, 0xF5, 0x21, 0xE5, 0x28 };
+    static const uint8_t test_s[128] = {
+        0xA9, 0xF3, 0xA5, 0xF5, 0x4C, 0xEC, 0x07, 0xB0, 0x56, 0x31, 0x54, 0xE9, 0x10, 0x11, 0x46, 0xCC,
+        0xFF, 0xEF, 0x36, 0x6F, 0x17, 0x9E, 0xEE, 0x5B, 0x7C, 0x33, 0x7F, 0x1B, 0xD0, 0x20, 0xFF, 0x2C,
+        0xE5, 0xAB, 0xC3, 0xF3, 0x3C, 0x66, 0x6E, 0xCA, 0xE8, 0xE7, 0xD2, 0xE3, 0xD7, 0x65, 0x43, 0x8D,
+        0xA9, 0xA8, 0xF1, 0xA8, 0xC7, 0x91, 0x04, 0x0D, 0x44, 0x69, 0xA9, 0xFD, 0xBA, 0x6F, 0x31, 0x71,
+        0x45, 0xF0, 0xF4, 0xA6, 0x73, 0x93, 0x33, 0xAF, 0x4F, 0x2A, 0x6A, 0x2C, 0x08, 0xAC, 0x20, 0x4A,
+        0x57, 0x2B, 0x62, 0x9D, 0x7C, 0xF1, 0x38, 0x1E, 0x1C, 0x41, 0x2B, 0x99, 0xE4, 0x26, 0x6C, 0x2B,
+        0xAF, 0x82, 0xCC, 0xF3, 0x5B, 0x9F, 0xA9, 0x7A, 0xB0, 0xC5, 0x96, 0xB5, 0xC8, 0xCA, 0x2C, 0x2D,
+        0x1F, 0xFA, 0x54, 0xD6, 0xAE, 0x37, 0xB1, 0xF6, 0xAA, 0x55, 0xF1, 0xBB, 0x92, 0xD6, 0x7D, 0x7F };
+    static const uint8_t test_e[3] = { 0x01, 0x00, 0x01 };
+    static const uint8_t test_m[] = "abc";
+    static const ByteArray ba_n = { (uint8_t*)test_n, sizeof(test_n) };
+    static const ByteArray ba_d = { (uint8_t*)test_d, sizeof(test_d) };
+    static const ByteArray ba_p = { (uint8_t*)test_p, sizeof(test_p) };
+    static const ByteArray ba_q = { (uint8_t*)test_q, sizeof(test_q) };
+    static const ByteArray ba_dmp1 = { (uint8_t*)test_dmp1, sizeof(test_dmp1) };
+    static const ByteArray ba_dmq1 = { (uint8_t*)test_dmq1, sizeof(test_dmq1) };
+    static const ByteArray ba_iqmp = { (uint8_t*)test_iqmp, sizeof(test_iqmp) };
+    static const ByteArray ba_ipmq = { (uint8_t*)test_ipmq, sizeof(test_ipmq) };
+    static const ByteArray ba_s = { (uint8_t*)test_s, sizeof(test_s) };
+    static const ByteArray ba_e = { (uint8_t*)test_e, sizeof(test_e) };
+    static const ByteArray ba_m = { (uint8_t*)test_m, sizeof(test_m) - 1 };
+
+    int ret = RET_OK;
+    RsaCtx* rsa_ctx = NULL;
+    HashCtx* hash_ctx = NULL;
+    ByteArray* ba_hash = NULL;
+    ByteArray* ba_signature = NULL;
+    ByteArray* ba_bad_dmp1 = NULL;
+
+    CHECK_NOT_NULL(hash_ctx = hash_alloc(HASH_ALG_SHA256));
+    DO(hash_update(hash_ctx, &ba_m));
+    DO(hash_final(hash_ctx, &ba_hash));
+    CHECK_NOT_NULL(rsa_ctx = rsa_alloc());
+    DO(rsa_init_sign_pkcs1_v1_5(rsa_ctx, HASH_ALG_SHA256, &ba_n, &ba_d));
+
+    /* p < q. */
+    DO(rsa_init_crt(rsa_ctx, &ba_e, &ba_p, &ba_q, &ba_dmp1, &ba_dmq1, &ba_iqmp));
+    DO(rsa_sign(rsa_ctx, ba_hash, &ba_signature));
+    if (ba_cmp(ba_signature, &ba_s) != 0) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+    ba_free(ba_signature);
+    ba_signature = NULL;
+
+    /* p та q поміняно місцями, qInv = p^-1 (mod q). */
+    DO(rsa_init_crt(rsa_ctx, &ba_e, &ba_q, &ba_p, &ba_dmq1, &ba_dmp1, &ba_ipmq));
+    DO(rsa_sign(rsa_ctx, ba_hash, &ba_signature));
+    if (ba_cmp(ba_signature, &ba_s) != 0) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+    ba_free(ba_signature);
+    ba_signature = NULL;
+
+    /* Хибна dP: результат CRT не проходить перевірку, підпис обчислюється через d. */
+    CHECK_NOT_NULL(ba_bad_dmp1 = ba_copy_with_alloc(&ba_dmp1, 0, 0));
+    ba_bad_dmp1->buf[ba_bad_dmp1->len - 1] ^= 0x02;
+    DO(rsa_init_crt(rsa_ctx, &ba_e, &ba_p, &ba_q, ba_bad_dmp1, &ba_dmq1, &ba_iqmp));
+    DO(rsa_sign(rsa_ctx, ba_hash, &ba_signature));
+    if (ba_cmp(ba_signature, &ba_s) != 0) {
+        SET_ERROR(RET_SELF_TEST_FAIL);
+    }
+
+cleanup:
+    ba_free(ba_signature);
+    ba_free(ba_bad_dmp1);
+    ba_free(ba_hash);
+    rsa_free(rsa_ctx);
+    hash_free(hash_ctx);
+    return ret;
+}
+
 int rsa_self_test(void)
 {
     int ret = RET_OK;
@@ -1711,6 +2047,7 @@ int rsa_self_test(void)
     DO(rsa_sign_pss_self_test());
     DO(rsa_sign_pkcs_self_test());
     DO(rsa_encrypt_oaep_self_test());
+    DO(rsa_crt_self_test());
 
 cleanup:
     return ret;
@@ -35,8 +35,13 @@
 
 #include "byte-utils-internal.h"
 #include "byte-array-internal.h"
+#include "cpu-features-internal.h"
 #include "macros-internal.h"
 
+#if defined(CPU_X86_64)
+# include <immintrin.h>
+#endif
+
 #define SCHEDULE(i)                                                             \
     temp = schedule[(i - 3) & 0xF] ^ schedule[(i - 8) & 0xF]^               \
                schedule[(i - 14) & 0xF] ^ schedule[(i - 16) & 0xF];             \
@@ -132,7 +137,9 @@ struct Sha1Ctx_st {
     uint8_t k_opad[64];
 };
 
-__inline static void sha1_compress(uint32_t *state, uint8_t *block8)
+typedef void (*Sha1TransfFunc)(uint32_t *state, const uint8_t *data, size_t block_nb);
+
+__inline static void sha1_compress(uint32_t *state, const uint8_t *block8)
 {
     uint32_t block[16];
 
@@ -173,8 +180,121 @@ __inline static void sha1_compress(uint32_t *state, uint8_t *block8)
     state[2] += c;
     state[3] += d;
     state[4] += e;
+}
+
+static void sha1_transf_soft(uint32_t *state, const uint8_t *data, size_t block_nb)
+{
+    size_t i;
+
+    for (i = 0; i < block_nb; i++) {
+        sha1_compress(state, data + (i << 6));
+    }
+}
+
+#if defined(CPU_X86_64)
+
+#define SHA1_NI_MSG(g)                                                                          \
+        if ((g) < 4) {                                                                          \
+            m[(g) & 3] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * (g))), bswap); \
+        }                                                                                       \
+        if ((g) >= 3 && (g) < 19) {                                                             \
+            m[((g) + 1) & 3] = _mm_sha1msg2_epu32(m[((g) + 1) & 3], m[(g) & 3]);                \
+        }
+
+#define SHA1_NI_SCHEDULE(g)                                                                     \
+        if ((g) >= 1 && (g) < 17) {                                                             \
+            m[((g) - 1) & 3] = _mm_sha1msg1_epu32(m[((g) - 1) & 3], m[(g) & 3]);                \
+        }                                                                                       \
+        if ((g) >= 2 && (g) < 18) {                                                             \
+            m[((g) - 2) & 3] = _mm_xor_si128(m[((g) - 2) & 3], m[(g) & 3]);                     \
+        }
+
+/* Група g з 4 раундів; функція раунду змінюється кожні 5 груп. */
+#define SHA1_NI_ROUNDS_EVEN(g)                                                                  \
+        SHA1_NI_MSG(g)                                                                          \
+        e0 = ((g) == 0) ? _mm_add_epi32(e0, m[0]) : _mm_sha1nexte_epu32(e0, m[(g) & 3]);        \
+        e1 = abcd;                                                                              \
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, (g) / 5);                                          \
+        SHA1_NI_SCHEDULE(g)
+
+#define SHA1_NI_ROUNDS_ODD(g)                                                                   \
+        SHA1_NI_MSG(g)                                                                          \
+        e1 = _mm_sha1nexte_epu32(e1, m[(g) & 3]);                                               \
+        e0 = abcd;                                                                              \
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, (g) / 5);                                          \
+        SHA1_NI_SCHEDULE(g)
+
+/*
+ * SHA-1 на інструкціях SHA extensions: 4 раунди за sha1rnds4, змінна E обчислюється sha1nexte,
+ * розклад повідомлення - sha1msg1/sha1msg2.
+ */
+CPU_TARGET("sse2,ssse3,sse4.1,sha")
+static void sha1_transf_shani(uint32_t *state, const uint8_t *data, size_t block_nb)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i abcd, abcd_save, e0, e1, e0_save;
+    __m128i m[4];
+    size_t i;
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1B);
+    e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+    for (i = 0; i < block_nb; i++, data += 64) {
+        abcd_save = abcd;
+        e0_save = e0;
+
+        SHA1_NI_ROUNDS_EVEN(0);  SHA1_NI_ROUNDS_ODD(1);  SHA1_NI_ROUNDS_EVEN(2);  SHA1_NI_ROUNDS_ODD(3);
+        SHA1_NI_ROUNDS_EVEN(4);  SHA1_NI_ROUNDS_ODD(5);  SHA1_NI_ROUNDS_EVEN(6);  SHA1_NI_ROUNDS_ODD(7);
+        SHA1_NI_ROUNDS_EVEN(8);  SHA1_NI_ROUNDS_ODD(9);  SHA1_NI_ROUNDS_EVEN(10); SHA1_NI_ROUNDS_ODD(11);
+        SHA1_NI_ROUNDS_EVEN(12); SHA1_NI_ROUNDS_ODD(13); SHA1_NI_ROUNDS_EVEN(14); SHA1_NI_ROUNDS_ODD(15);
+        SHA1_NI_ROUNDS_EVEN(16); SHA1_NI_ROUNDS_ODD(17); SHA1_NI_ROUNDS_EVEN(18); SHA1_NI_ROUNDS_ODD(19);
 
-    uint32_to_uint8(block, 16, block8, 64);
+        e0 = _mm_sha1nexte_epu32(e0, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = (uint32_t)_mm_extract_epi32(e0, 3);
+
+    secure_zero(m, sizeof(m));
+}
+
+#endif
+
+/* Реалізації перетворення, від найшвидшої до загальної; остання не потребує розширень. */
+static const struct {
+    const char *name;
+    uint32_t features;
+    Sha1TransfFunc transf;
+} SHA1_TRANSF_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"sha-ni", CPU_FEATURE_SHANI | CPU_FEATURE_SSE41 | CPU_FEATURE_SSSE3, sha1_transf_shani},
+#endif
+    {"generic", 0, sha1_transf_soft}
+};
+
+static Sha1TransfFunc volatile sha1_transf_selected = NULL;
+
+void sha1_dispatch_init(void)
+{
+    uint32_t features = cpu_features();
+    size_t i = 0;
+
+    while ((SHA1_TRANSF_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+
+    sha1_transf_selected = SHA1_TRANSF_IMPLS[i].transf;
+    cpu_dispatch_set(CPU_PRIMITIVE_SHA1, SHA1_TRANSF_IMPLS[i].name);
+}
+
+static __inline void sha1_transf(uint32_t *state, const uint8_t *data, size_t block_nb)
+{
+    if (sha1_transf_selected == NULL) {
+        sha1_dispatch_init();
+    }
+
+    sha1_transf_selected(state, data, block_nb);
 }
 
 static __inline int sha1_init(Sha1Ctx *ctx)
@@ -252,14 +372,13 @@ int sha1_update(Sha1Ctx *ctx, const ByteArray *msg_ba)
     }
 
     memcpy(&ctx->msg_last_block[ctx->rem], msg_buf, 64 - ctx->rem);
-    sha1_compress(ctx->state, ctx->msg_last_block);
+    sha1_transf(ctx->state, ctx->msg_last_block, 1);
     memset(ctx->msg_last_block, 0, 64);
 
     shifted_buf = msg_buf + (64 - ctx->rem);
     msg_buf_size -= (64 - ctx->rem);
-    for (i = 0; i + 64 <= msg_buf_size; i += 64) {
-        sha1_compress(ctx->state, shifted_buf + i);
-    }
+    i = msg_buf_size & ~(size_t)63;
+    sha1_transf(ctx->state, shifted_buf, msg_buf_size >> 6);
 
     ctx->rem = msg_buf_size - i;
     if (ctx->rem != 0) {
@@ -290,7 +409,7 @@ int sha1_final(Sha1Ctx *ctx, ByteArray **hash_code)
         memset(&ctx->msg_last_block[rem], 0, 56 - rem);
     } else {
         memset(&ctx->msg_last_block[rem], 0, 64 - rem);
-        sha1_compress(ctx->state, ctx->msg_last_block);
+        sha1_transf(ctx->state, ctx->msg_last_block, 1);
         memset(&ctx->msg_last_block[0], 0, 56);
     }
 
@@ -299,7 +418,7 @@ int sha1_final(Sha1Ctx *ctx, ByteArray **hash_code)
         ctx->msg_last_block[64 - 1 - i] = (uint8_t) (wlen >> (i << 3));
     }
 
-    sha1_compress(ctx->state, ctx->msg_last_block);
+    sha1_transf(ctx->state, ctx->msg_last_block, 1);
 
     OUTPUT_TRANSFORM(ctx->state, ctx->msg_last_block);
 
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef UAPKIC_SHA2_INTERNAL_H
+#define UAPKIC_SHA2_INTERNAL_H
+
+#include "sha2.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Обчислює SHA2 від кількох незалежних повідомлень. За наявності AVX2 повідомлення
+ * обробляються паралельно у 8 (SHA-224/256) або 4 (SHA-384/512) доріжках.
+ *
+ * @param variant варіант SHA2
+ * @param msgs повідомлення
+ * @param count кількість повідомлень
+ * @param hashes масив з count елементів для гешів від повідомлень
+ * @return код помилки
+ */
+int sha2_hash_multi(Sha2Variant variant, const ByteArray *const *msgs, size_t count, ByteArray **hashes);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -32,10 +32,17 @@
 #include <stddef.h>
 
 #include "sha2.h"
+#include "hash.h"
+#include "sha2-internal.h"
 #include "byte-utils-internal.h"
 #include "byte-array-internal.h"
+#include "cpu-features-internal.h"
 #include "macros-internal.h"
 
+#if defined(CPU_X86_64)
+# include <immintrin.h>
+#endif
+
 #define SHA224_DIGEST_SIZE (224 >> 3)
 #define SHA256_DIGEST_SIZE (256 >> 3)
 #define SHA384_DIGEST_SIZE (384 >> 3)
@@ -65,6 +72,18 @@ typedef struct Sha256Ctx_st Sha256Ctx;
 typedef struct Sha512Ctx_st Sha384Ctx;
 typedef struct Sha512Ctx_st Sha512Ctx;
 
+typedef void (*Sha256TransfFunc)(Sha256Ctx *ctx, const uint8_t *data, size_t block_nb);
+typedef void (*Sha512TransfFunc)(Sha512Ctx *ctx, const uint8_t *data, size_t block_nb);
+typedef int (*Sha256MultiFunc)(const uint32_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes);
+typedef int (*Sha512MultiFunc)(const uint64_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes);
+
+static int sha256_multi_soft(const uint32_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes);
+static int sha512_multi_soft(const uint64_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes);
+
 struct Sha2Ctx_st {
     Sha2Variant variant;
     uint8_t k_opad[SHA512_BLOCK_SIZE];
@@ -371,7 +390,7 @@ static __inline void sha512_init(Sha2Ctx *ctx)
 }
 
 /* SHA-256 functions */
-static __inline void sha256_transf(Sha256Ctx *ctx, const uint8_t *data, size_t block_len)
+static void sha256_transf_soft(Sha256Ctx *ctx, const uint8_t *data, size_t block_len)
 {
     uint32_t w[64];
     uint32_t wv[8];
@@ -435,7 +454,7 @@ static __inline void sha256_transf(Sha256Ctx *ctx, const uint8_t *data, size_t b
 }
 
 /* SHA-512 functions */
-static __inline void sha512_transf(Sha512Ctx *ctx, const uint8_t *msg, size_t block_nb)
+static void sha512_transf_soft(Sha512Ctx *ctx, const uint8_t *msg, size_t block_nb)
 {
     uint64_t w[80];
     uint64_t wv[8];
@@ -502,6 +521,624 @@ static __inline void sha512_transf(Sha512Ctx *ctx, const uint8_t *msg, size_t bl
     }
 }
 
+/*
+ * Доріжка багатобуферного гешування: спочатку повні блоки повідомлення,
+ * потім один або два доповнені блоки хвоста з довжиною повідомлення.
+ */
+typedef struct Sha2Lane_st {
+    const uint8_t *data;
+    size_t full_nb;
+    const uint8_t *tail_ptr;
+    size_t tail_nb;
+    size_t idx;
+    int active;
+    uint8_t tail[SHA512_BLOCK_SIZE << 1];
+} Sha2Lane;
+
+static const uint8_t SHA2_ZERO_BLOCK[SHA512_BLOCK_SIZE] = {0};
+
+static void sha2_lane_load(Sha2Lane *lane, const ByteArray *msg, size_t idx, size_t block_size)
+{
+    const size_t len_size = block_size >> 3;
+    const size_t rem = msg->len % block_size;
+    size_t pad_len;
+
+    lane->data = msg->buf;
+    lane->full_nb = msg->len / block_size;
+    lane->tail_nb = (rem + 1 + len_size <= block_size) ? 1 : 2;
+    pad_len = lane->tail_nb * block_size;
+
+    memset(lane->tail, 0, pad_len);
+    if (rem > 0) {
+        memcpy(lane->tail, msg->buf + msg->len - rem, rem);
+    }
+    lane->tail[rem] = 0x80;
+    UNPACK64((uint64_t)msg->len << 3, lane->tail + pad_len - 8);
+    if (len_size == 16) {
+        UNPACK64((uint64_t)msg->len >> 61, lane->tail + pad_len - 16);
+    }
+
+    lane->tail_ptr = lane->tail;
+    lane->idx = idx;
+    lane->active = 1;
+}
+
+static __inline const uint8_t *sha2_lane_next(Sha2Lane *lane, size_t block_size)
+{
+    const uint8_t *block;
+
+    if (lane->full_nb > 0) {
+        block = lane->data;
+        lane->data += block_size;
+        lane->full_nb--;
+    }
+    else {
+        block = lane->tail_ptr;
+        lane->tail_ptr += block_size;
+        lane->tail_nb--;
+    }
+
+    return block;
+}
+
+static __inline int sha2_lane_done(const Sha2Lane *lane)
+{
+    return lane->active && (lane->full_nb == 0) && (lane->tail_nb == 0);
+}
+
+#if defined(CPU_X86_64)
+
+/*
+ * SHA-256 на інструкціях SHA extensions. Стан зберігається у парах ABEF / CDGH,
+ * кожні 4 раунди обробляються двома sha256rnds2, розклад повідомлення - sha256msg1/msg2.
+ */
+CPU_TARGET("sse2,ssse3,sse4.1,sha")
+static void sha256_transf_shani(Sha256Ctx *ctx, const uint8_t *data, size_t block_nb)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, abef, cdgh, msg, tmp;
+    __m128i m[4];
+    size_t i, j;
+
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->h[0]), 0xB1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->h[4]), 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (i = 0; i < block_nb; i++, data += SHA256_BLOCK_SIZE) {
+        abef = state0;
+        cdgh = state1;
+
+        for (j = 0; j < 16; j++) {
+            if (j < 4) {
+                m[j] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * j)), bswap);
+            }
+
+            msg = _mm_add_epi32(m[j & 3], _mm_loadu_si128((const __m128i *)&sha256_k[4 * j]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+
+            /* W[4j + 4 .. 4j + 7] = msg2(msg1(...) + W[4j - 3 .. 4j], W[4j .. 4j + 3]) */
+            if (j >= 3 && j < 15) {
+                tmp = _mm_alignr_epi8(m[j & 3], m[(j - 1) & 3], 4);
+                m[(j + 1) & 3] = _mm_add_epi32(m[(j + 1) & 3], tmp);
+                m[(j + 1) & 3] = _mm_sha256msg2_epu32(m[(j + 1) & 3], m[j & 3]);
+            }
+
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+
+            if (j >= 1 && j < 13) {
+                m[(j - 1) & 3] = _mm_sha256msg1_epu32(m[(j - 1) & 3], m[j & 3]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    _mm_storeu_si128((__m128i *)&ctx->h[0], _mm_blend_epi16(tmp, state1, 0xF0));
+    _mm_storeu_si128((__m128i *)&ctx->h[4], _mm_alignr_epi8(state1, tmp, 8));
+
+    secure_zero(m, sizeof(m));
+}
+
+#define SHA512_EXP_WK(a, b, c, d, e, f, g ,h, j)            \
+{                                                           \
+    t1 = wv[h] + SHA512_F2(wv[e]) + CH(wv[e], wv[f], wv[g]) \
+         + wk[j];                                           \
+    t2 = SHA512_F1(wv[a]) + MAJ(wv[a], wv[b], wv[c]);       \
+    wv[d] += t1;                                            \
+    wv[h] = t1 + t2;                                        \
+}
+
+#define SHA512_EXP_WK_UNROLL(i)                                         \
+        SHA512_EXP_WK(0, 1, 2, 3, 4, 5, 6, 7, 0 + i);                   \
+        SHA512_EXP_WK(7, 0, 1, 2, 3, 4, 5, 6, 1 + i);                   \
+        SHA512_EXP_WK(6, 7, 0, 1, 2, 3, 4, 5, 2 + i);                   \
+        SHA512_EXP_WK(5, 6, 7, 0, 1, 2, 3, 4, 3 + i);                   \
+        SHA512_EXP_WK(4, 5, 6, 7, 0, 1, 2, 3, 4 + i);                   \
+        SHA512_EXP_WK(3, 4, 5, 6, 7, 0, 1, 2, 5 + i);                   \
+        SHA512_EXP_WK(2, 3, 4, 5, 6, 7, 0, 1, 6 + i);                   \
+        SHA512_EXP_WK(1, 2, 3, 4, 5, 6, 7, 0, 7 + i)
+
+/* Раунди SHA-512 над готовими сумами W[j] + K[j]. */
+static __inline void sha512_rounds_wk(uint64_t *h, const uint64_t *wk)
+{
+    uint64_t wv[8];
+    uint64_t t1, t2;
+
+    wv[0] = h[0];
+    wv[1] = h[1];
+    wv[2] = h[2];
+    wv[3] = h[3];
+    wv[4] = h[4];
+    wv[5] = h[5];
+    wv[6] = h[6];
+    wv[7] = h[7];
+
+    SHA512_EXP_WK_UNROLL(0);
+    SHA512_EXP_WK_UNROLL(8);
+    SHA512_EXP_WK_UNROLL(16);
+    SHA512_EXP_WK_UNROLL(24);
+    SHA512_EXP_WK_UNROLL(32);
+    SHA512_EXP_WK_UNROLL(40);
+    SHA512_EXP_WK_UNROLL(48);
+    SHA512_EXP_WK_UNROLL(56);
+    SHA512_EXP_WK_UNROLL(64);
+    SHA512_EXP_WK_UNROLL(72);
+
+    h[0] += wv[0];
+    h[1] += wv[1];
+    h[2] += wv[2];
+    h[3] += wv[3];
+    h[4] += wv[4];
+    h[5] += wv[5];
+    h[6] += wv[6];
+    h[7] += wv[7];
+}
+
+#define SHA512_AVX2_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+
+/*
+ * SHA-512 з розкладом повідомлення на AVX2: розклад двох блоків обчислюється одночасно,
+ * 128-бітна лінія YMM містить пару слів W[2j], W[2j + 1] одного блоку.
+ * Раунди виконуються скалярно над підготовленими W + K.
+ */
+CPU_TARGET("avx2")
+static void sha512_transf_avx2(Sha512Ctx *ctx, const uint8_t *msg, size_t block_nb)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL,
+            0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    uint64_t wk[2][80];
+    __m256i w[40];
+    __m256i s0, s1, x;
+    const uint8_t *b0, *b1;
+    size_t i, j;
+
+    for (i = 0; i < block_nb; i += 2) {
+        b0 = msg + (i << 7);
+        b1 = (i + 1 < block_nb) ? b0 + SHA512_BLOCK_SIZE : b0;
+
+        for (j = 0; j < 8; j++) {
+            x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(b0 + 16 * j))),
+                    _mm_loadu_si128((const __m128i *)(b1 + 16 * j)), 1);
+            w[j] = _mm256_shuffle_epi8(x, bswap);
+        }
+
+        for (j = 8; j < 40; j++) {
+            x = _mm256_alignr_epi8(w[j - 7], w[j - 8], 8);
+            s0 = _mm256_xor_si256(_mm256_xor_si256(SHA512_AVX2_ROTR(x, 1), SHA512_AVX2_ROTR(x, 8)),
+                    _mm256_srli_epi64(x, 7));
+            x = w[j - 1];
+            s1 = _mm256_xor_si256(_mm256_xor_si256(SHA512_AVX2_ROTR(x, 19), SHA512_AVX2_ROTR(x, 61)),
+                    _mm256_srli_epi64(x, 6));
+            x = _mm256_add_epi64(_mm256_add_epi64(w[j - 8], s0),
+                    _mm256_add_epi64(_mm256_alignr_epi8(w[j - 3], w[j - 4], 8), s1));
+            w[j] = x;
+        }
+
+        for (j = 0; j < 40; j++) {
+            x = _mm256_add_epi64(w[j], _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&sha512_k[2 * j])));
+            _mm_storeu_si128((__m128i *)&wk[0][2 * j], _mm256_castsi256_si128(x));
+            _mm_storeu_si128((__m128i *)&wk[1][2 * j], _mm256_extracti128_si256(x, 1));
+        }
+
+        sha512_rounds_wk(ctx->h, wk[0]);
+        if (i + 1 < block_nb) {
+            sha512_rounds_wk(ctx->h, wk[1]);
+        }
+    }
+
+    secure_zero(wk, sizeof(wk));
+    secure_zero(w, sizeof(w));
+}
+
+/*
+ * Багатобуферні SHA-256 (8 доріжок) і SHA-512 (4 доріжки) на AVX2: кожен 32- або 64-бітний
+ * елемент регістра містить слово стану окремого повідомлення, раунди виконуються одночасно.
+ */
+#define SHA256X8_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define SHA256X8_XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+#define SHA256X8_F1(x) SHA256X8_XOR3(SHA256X8_ROTR(x,  2), SHA256X8_ROTR(x, 13), SHA256X8_ROTR(x, 22))
+#define SHA256X8_F2(x) SHA256X8_XOR3(SHA256X8_ROTR(x,  6), SHA256X8_ROTR(x, 11), SHA256X8_ROTR(x, 25))
+#define SHA256X8_F3(x) SHA256X8_XOR3(SHA256X8_ROTR(x,  7), SHA256X8_ROTR(x, 18), _mm256_srli_epi32(x,  3))
+#define SHA256X8_F4(x) SHA256X8_XOR3(SHA256X8_ROTR(x, 17), SHA256X8_ROTR(x, 19), _mm256_srli_epi32(x, 10))
+
+#define SHA512X4_ROTR(x, n) SHA512_AVX2_ROTR(x, n)
+#define SHA512X4_F1(x) SHA256X8_XOR3(SHA512X4_ROTR(x, 28), SHA512X4_ROTR(x, 34), SHA512X4_ROTR(x, 39))
+#define SHA512X4_F2(x) SHA256X8_XOR3(SHA512X4_ROTR(x, 14), SHA512X4_ROTR(x, 18), SHA512X4_ROTR(x, 41))
+#define SHA512X4_F3(x) SHA256X8_XOR3(SHA512X4_ROTR(x,  1), SHA512X4_ROTR(x,  8), _mm256_srli_epi64(x,  7))
+#define SHA512X4_F4(x) SHA256X8_XOR3(SHA512X4_ROTR(x, 19), SHA512X4_ROTR(x, 61), _mm256_srli_epi64(x,  6))
+
+#define SIMD_CH(x, y, z)  _mm256_xor_si256(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define SIMD_MAJ(x, y, z) _mm256_xor_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_xor_si256((x), (y))))
+
+#define SHA256X8_EXP(a, b, c, d, e, f, g, h, j)                                     \
+{                                                                                   \
+    t1 = _mm256_add_epi32(_mm256_add_epi32(wv[h], SHA256X8_F2(wv[e])),              \
+            _mm256_add_epi32(SIMD_CH(wv[e], wv[f], wv[g]),                          \
+            _mm256_add_epi32(w[j], _mm256_set1_epi32((int)sha256_k[t + (j)]))));    \
+    t2 = _mm256_add_epi32(SHA256X8_F1(wv[a]), SIMD_MAJ(wv[a], wv[b], wv[c]));       \
+    wv[d] = _mm256_add_epi32(wv[d], t1);                                            \
+    wv[h] = _mm256_add_epi32(t1, t2);                                               \
+}
+
+#define SHA512X4_EXP(a, b, c, d, e, f, g, h, j)                                     \
+{                                                                                   \
+    t1 = _mm256_add_epi64(_mm256_add_epi64(wv[h], SHA512X4_F2(wv[e])),              \
+            _mm256_add_epi64(SIMD_CH(wv[e], wv[f], wv[g]),                          \
+            _mm256_add_epi64(w[j], _mm256_set1_epi64x((long long)sha512_k[t + (j)])))); \
+    t2 = _mm256_add_epi64(SHA512X4_F1(wv[a]), SIMD_MAJ(wv[a], wv[b], wv[c]));       \
+    wv[d] = _mm256_add_epi64(wv[d], t1);                                            \
+    wv[h] = _mm256_add_epi64(t1, t2);                                               \
+}
+
+#define SIMD_EXP_UNROLL(EXP, i)                                                     \
+        EXP(0, 1, 2, 3, 4, 5, 6, 7, 0 + i);                                         \
+        EXP(7, 0, 1, 2, 3, 4, 5, 6, 1 + i);                                         \
+        EXP(6, 7, 0, 1, 2, 3, 4, 5, 2 + i);                                         \
+        EXP(5, 6, 7, 0, 1, 2, 3, 4, 3 + i);                                         \
+        EXP(4, 5, 6, 7, 0, 1, 2, 3, 4 + i);                                         \
+        EXP(3, 4, 5, 6, 7, 0, 1, 2, 5 + i);                                         \
+        EXP(2, 3, 4, 5, 6, 7, 0, 1, 6 + i);                                         \
+        EXP(1, 2, 3, 4, 5, 6, 7, 0, 7 + i)
+
+/* Завантажує слова 8 блоків з перестановкою: w[k] містить k-те слово кожної доріжки. */
+CPU_TARGET("avx2")
+static __inline void sha256x8_load(__m256i *w, const uint8_t *const *blocks, size_t offset)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+            0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m256i r[8], t[8], u[8];
+    size_t l;
+
+    for (l = 0; l < 8; l++) {
+        r[l] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(blocks[l] + offset)), bswap);
+    }
+    for (l = 0; l < 8; l += 2) {
+        t[l] = _mm256_unpacklo_epi32(r[l], r[l + 1]);
+        t[l + 1] = _mm256_unpackhi_epi32(r[l], r[l + 1]);
+    }
+    for (l = 0; l < 8; l += 4) {
+        u[l] = _mm256_unpacklo_epi64(t[l], t[l + 2]);
+        u[l + 1] = _mm256_unpackhi_epi64(t[l], t[l + 2]);
+        u[l + 2] = _mm256_unpacklo_epi64(t[l + 1], t[l + 3]);
+        u[l + 3] = _mm256_unpackhi_epi64(t[l + 1], t[l + 3]);
+    }
+    for (l = 0; l < 4; l++) {
+        w[l] = _mm256_permute2x128_si256(u[l], u[l + 4], 0x20);
+        w[l + 4] = _mm256_permute2x128_si256(u[l], u[l + 4], 0x31);
+    }
+}
+
+CPU_TARGET("avx2")
+static void sha256_compress_x8(uint32_t st[8][8], const uint8_t *const *blocks)
+{
+    __m256i w[16], wv[8], t1, t2;
+    size_t t, j;
+
+    sha256x8_load(&w[0], blocks, 0);
+    sha256x8_load(&w[8], blocks, 32);
+    for (j = 0; j < 8; j++) {
+        wv[j] = _mm256_loadu_si256((const __m256i *)st[j]);
+    }
+
+    for (t = 0; t < 64; t += 16) {
+        if (t > 0) {
+            for (j = 0; j < 16; j++) {
+                w[j] = _mm256_add_epi32(_mm256_add_epi32(w[j], SHA256X8_F4(w[(j + 14) & 15])),
+                        _mm256_add_epi32(w[(j + 9) & 15], SHA256X8_F3(w[(j + 1) & 15])));
+            }
+        }
+        SIMD_EXP_UNROLL(SHA256X8_EXP, 0);
+        SIMD_EXP_UNROLL(SHA256X8_EXP, 8);
+    }
+
+    for (j = 0; j < 8; j++) {
+        _mm256_storeu_si256((__m256i *)st[j], _mm256_add_epi32(wv[j], _mm256_loadu_si256((const __m256i *)st[j])));
+    }
+}
+
+/* Завантажує слова 4 блоків з перестановкою: w[k] містить k-те слово кожної доріжки. */
+CPU_TARGET("avx2")
+static __inline void sha512x4_load(__m256i *w, const uint8_t *const *blocks, size_t offset)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL,
+            0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    __m256i r[4], t[4];
+    size_t l;
+
+    for (l = 0; l < 4; l++) {
+        r[l] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(blocks[l] + offset)), bswap);
+    }
+    t[0] = _mm256_unpacklo_epi64(r[0], r[1]);
+    t[1] = _mm256_unpackhi_epi64(r[0], r[1]);
+    t[2] = _mm256_unpacklo_epi64(r[2], r[3]);
+    t[3] = _mm256_unpackhi_epi64(r[2], r[3]);
+    w[0] = _mm256_permute2x128_si256(t[0], t[2], 0x20);
+    w[1] = _mm256_permute2x128_si256(t[1], t[3], 0x20);
+    w[2] = _mm256_permute2x128_si256(t[0], t[2], 0x31);
+    w[3] = _mm256_permute2x128_si256(t[1], t[3], 0x31);
+}
+
+CPU_TARGET("avx2")
+static void sha512_compress_x4(uint64_t st[8][4], const uint8_t *const *blocks)
+{
+    __m256i w[16], wv[8], t1, t2;
+    size_t t, j;
+
+    for (j = 0; j < 4; j++) {
+        sha512x4_load(&w[4 * j], blocks, 32 * j);
+    }
+    for (j = 0; j < 8; j++) {
+        wv[j] = _mm256_loadu_si256((const __m256i *)st[j]);
+    }
+
+    for (t = 0; t < 80; t += 16) {
+        if (t > 0) {
+            for (j = 0; j < 16; j++) {
+                w[j] = _mm256_add_epi64(_mm256_add_epi64(w[j], SHA512X4_F4(w[(j + 14) & 15])),
+                        _mm256_add_epi64(w[(j + 9) & 15], SHA512X4_F3(w[(j + 1) & 15])));
+            }
+        }
+        SIMD_EXP_UNROLL(SHA512X4_EXP, 0);
+        SIMD_EXP_UNROLL(SHA512X4_EXP, 8);
+    }
+
+    for (j = 0; j < 8; j++) {
+        _mm256_storeu_si256((__m256i *)st[j], _mm256_add_epi64(wv[j], _mm256_loadu_si256((const __m256i *)st[j])));
+    }
+}
+
+/*
+ * Повідомлення розподіляються по доріжках; доріжка, що завершила своє повідомлення,
+ * одразу отримує наступне, тож повідомлення різної довжини не простоюють.
+ */
+static int sha256_multi_avx2(const uint32_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes)
+{
+    int ret = RET_OK;
+    Sha2Lane lanes[8];
+    uint32_t st[8][8];
+    const uint8_t *blocks[8];
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    size_t next = 0, active = 0;
+    size_t l, i;
+
+    for (l = 0; l < 8; l++) {
+        lanes[l].active = 0;
+        if (next < count) {
+            sha2_lane_load(&lanes[l], msgs[next], next, SHA256_BLOCK_SIZE);
+            for (i = 0; i < 8; i++) {
+                st[i][l] = h0[i];
+            }
+            next++;
+            active++;
+        }
+    }
+
+    while (active > 0) {
+        for (l = 0; l < 8; l++) {
+            blocks[l] = lanes[l].active ? sha2_lane_next(&lanes[l], SHA256_BLOCK_SIZE) : SHA2_ZERO_BLOCK;
+        }
+
+        sha256_compress_x8(st, blocks);
+
+        for (l = 0; l < 8; l++) {
+            if (!sha2_lane_done(&lanes[l])) {
+                continue;
+            }
+            for (i = 0; i < 8; i++) {
+                UNPACK32(st[i][l], &digest[i << 2]);
+            }
+            CHECK_NOT_NULL(hashes[lanes[l].idx] = ba_alloc_from_uint8(digest, digest_size));
+
+            if (next < count) {
+                sha2_lane_load(&lanes[l], msgs[next], next, SHA256_BLOCK_SIZE);
+                for (i = 0; i < 8; i++) {
+                    st[i][l] = h0[i];
+                }
+                next++;
+            }
+            else {
+                lanes[l].active = 0;
+                active--;
+            }
+        }
+    }
+
+cleanup:
+    secure_zero(lanes, sizeof(lanes));
+    secure_zero(st, sizeof(st));
+    secure_zero(digest, sizeof(digest));
+    return ret;
+}
+
+static int sha512_multi_avx2(const uint64_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes)
+{
+    int ret = RET_OK;
+    Sha2Lane lanes[4];
+    uint64_t st[8][4];
+    const uint8_t *blocks[4];
+    uint8_t digest[SHA512_DIGEST_SIZE];
+    size_t next = 0, active = 0;
+    size_t l, i;
+
+    for (l = 0; l < 4; l++) {
+        lanes[l].active = 0;
+        if (next < count) {
+            sha2_lane_load(&lanes[l], msgs[next], next, SHA512_BLOCK_SIZE);
+            for (i = 0; i < 8; i++) {
+                st[i][l] = h0[i];
+            }
+            next++;
+            active++;
+        }
+    }
+
+    while (active > 0) {
+        for (l = 0; l < 4; l++) {
+            blocks[l] = lanes[l].active ? sha2_lane_next(&lanes[l], SHA512_BLOCK_SIZE) : SHA2_ZERO_BLOCK;
+        }
+
+        sha512_compress_x4(st, blocks);
+
+        for (l = 0; l < 4; l++) {
+            if (!sha2_lane_done(&lanes[l])) {
+                continue;
+            }
+            for (i = 0; i < 8; i++) {
+                UNPACK64(st[i][l], &digest[i << 3]);
+            }
+            CHECK_NOT_NULL(hashes[lanes[l].idx] = ba_alloc_from_uint8(digest, digest_size));
+
+            if (next < count) {
+                sha2_lane_load(&lanes[l], msgs[next], next, SHA512_BLOCK_SIZE);
+                for (i = 0; i < 8; i++) {
+                    st[i][l] = h0[i];
+                }
+                next++;
+            }
+            else {
+                lanes[l].active = 0;
+                active--;
+            }
+        }
+    }
+
+cleanup:
+    secure_zero(lanes, sizeof(lanes));
+    secure_zero(st, sizeof(st));
+    secure_zero(digest, sizeof(digest));
+    return ret;
+}
+
+#endif
+
+/* Реалізації перетворень, від найшвидшої до загальної; остання не потребує розширень. */
+static const struct {
+    const char *name;
+    uint32_t features;
+    Sha256TransfFunc transf;
+} SHA256_TRANSF_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"sha-ni", CPU_FEATURE_SHANI | CPU_FEATURE_SSE41 | CPU_FEATURE_SSSE3, sha256_transf_shani},
+#endif
+    {"generic", 0, sha256_transf_soft}
+};
+
+static const struct {
+    const char *name;
+    uint32_t features;
+    Sha512TransfFunc transf;
+} SHA512_TRANSF_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"avx2", CPU_FEATURE_AVX2, sha512_transf_avx2},
+#endif
+    {"generic", 0, sha512_transf_soft}
+};
+
+static const struct {
+    const char *name;
+    uint32_t features;
+    Sha256MultiFunc multi;
+} SHA256_MULTI_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"avx2x8", CPU_FEATURE_AVX2, sha256_multi_avx2},
+#endif
+    {"generic", 0, sha256_multi_soft}
+};
+
+static const struct {
+    const char *name;
+    uint32_t features;
+    Sha512MultiFunc multi;
+} SHA512_MULTI_IMPLS[] = {
+#if defined(CPU_X86_64)
+    {"avx2x4", CPU_FEATURE_AVX2, sha512_multi_avx2},
+#endif
+    {"generic", 0, sha512_multi_soft}
+};
+
+static Sha256TransfFunc volatile sha256_transf_selected = NULL;
+static Sha512TransfFunc volatile sha512_transf_selected = NULL;
+static Sha256MultiFunc volatile sha256_multi_selected = NULL;
+static Sha512MultiFunc volatile sha512_multi_selected = NULL;
+
+void sha2_dispatch_init(void)
+{
+    uint32_t features = cpu_features();
+    size_t i;
+
+    i = 0;
+    while ((SHA256_TRANSF_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    sha256_transf_selected = SHA256_TRANSF_IMPLS[i].transf;
+    cpu_dispatch_set(CPU_PRIMITIVE_SHA256, SHA256_TRANSF_IMPLS[i].name);
+
+    i = 0;
+    while ((SHA512_TRANSF_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    sha512_transf_selected = SHA512_TRANSF_IMPLS[i].transf;
+    cpu_dispatch_set(CPU_PRIMITIVE_SHA512, SHA512_TRANSF_IMPLS[i].name);
+
+    i = 0;
+    while ((SHA256_MULTI_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    sha256_multi_selected = SHA256_MULTI_IMPLS[i].multi;
+    cpu_dispatch_set(CPU_PRIMITIVE_SHA256_MULTI, SHA256_MULTI_IMPLS[i].name);
+
+    i = 0;
+    while ((SHA512_MULTI_IMPLS[i].features & ~features) != 0) {
+        i++;
+    }
+    sha512_multi_selected = SHA512_MULTI_IMPLS[i].multi;
+    cpu_dispatch_set(CPU_PRIMITIVE_SHA512_MULTI, SHA512_MULTI_IMPLS[i].name);
+}
+
+static __inline void sha256_transf(Sha256Ctx *ctx, const uint8_t *data, size_t block_nb)
+{
+    if (sha256_transf_selected == NULL) {
+        sha2_dispatch_init();
+    }
+
+    sha256_transf_selected(ctx, data, block_nb);
+}
+
+static __inline void sha512_transf(Sha512Ctx *ctx, const uint8_t *data, size_t block_nb)
+{
+    if (sha512_transf_selected == NULL) {
+        sha2_dispatch_init();
+    }
+
+    sha512_transf_selected(ctx, data, block_nb);
+}
+
 static void sha224_update(Sha224Ctx *ctx, const ByteArray *data_ba)
 {
     uint8_t *shifted_message = NULL;
@@ -783,6 +1420,99 @@ cleanup:
     return ret;
 }
 
+/* Послідовне гешування повідомлень обраним перетворенням, без виділення контекстів. */
+static int sha256_multi_soft(const uint32_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes)
+{
+    int ret = RET_OK;
+    Sha2Lane lane;
+    Sha256Ctx ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    size_t n, i;
+
+    for (n = 0; n < count; n++) {
+        sha2_lane_load(&lane, msgs[n], n, SHA256_BLOCK_SIZE);
+        BASE_INIT((&ctx), h0);
+        if (lane.full_nb > 0) {
+            sha256_transf(&ctx, lane.data, lane.full_nb);
+        }
+        sha256_transf(&ctx, lane.tail, lane.tail_nb);
+
+        for (i = 0; i < 8; i++) {
+            UNPACK32(ctx.h[i], &digest[i << 2]);
+        }
+        CHECK_NOT_NULL(hashes[n] = ba_alloc_from_uint8(digest, digest_size));
+    }
+
+cleanup:
+    secure_zero(&lane, sizeof(lane));
+    secure_zero(&ctx, sizeof(ctx));
+    secure_zero(digest, sizeof(digest));
+    return ret;
+}
+
+static int sha512_multi_soft(const uint64_t *h0, size_t digest_size, const ByteArray *const *msgs, size_t count,
+        ByteArray **hashes)
+{
+    int ret = RET_OK;
+    Sha2Lane lane;
+    Sha512Ctx ctx;
+    uint8_t digest[SHA512_DIGEST_SIZE];
+    size_t n, i;
+
+    for (n = 0; n < count; n++) {
+        sha2_lane_load(&lane, msgs[n], n, SHA512_BLOCK_SIZE);
+        BASE_INIT((&ctx), h0);
+        if (lane.full_nb > 0) {
+            sha512_transf(&ctx, lane.data, lane.full_nb);
+        }
+        sha512_transf(&ctx, lane.tail, lane.tail_nb);
+
+        for (i = 0; i < 8; i++) {
+            UNPACK64(ctx.h[i], &digest[i << 3]);
+        }
+        CHECK_NOT_NULL(hashes[n] = ba_alloc_from_uint8(digest, digest_size));
+    }
+
+cleanup:
+    secure_zero(&lane, sizeof(lane));
+    secure_zero(&ctx, sizeof(ctx));
+    secure_zero(digest, sizeof(digest));
+    return ret;
+}
+
+int sha2_hash_multi(Sha2Variant variant, const ByteArray *const *msgs, size_t count, ByteArray **hashes)
+{
+    int ret = RET_OK;
+
+    CHECK_PARAM(msgs != NULL);
+    CHECK_PARAM(hashes != NULL);
+
+    if ((sha256_multi_selected == NULL) || (sha512_multi_selected == NULL)) {
+        sha2_dispatch_init();
+    }
+
+    switch (variant) {
+    case SHA2_VARIANT_224:
+        DO(sha256_multi_selected(sha224_h0, SHA224_DIGEST_SIZE, msgs, count, hashes));
+        break;
+    case SHA2_VARIANT_256:
+        DO(sha256_multi_selected(sha256_h0, SHA256_DIGEST_SIZE, msgs, count, hashes));
+        break;
+    case SHA2_VARIANT_384:
+        DO(sha512_multi_selected(sha384_h0, SHA384_DIGEST_SIZE, msgs, count, hashes));
+        break;
+    case SHA2_VARIANT_512:
+        DO(sha512_multi_selected(sha512_h0, SHA512_DIGEST_SIZE, msgs, count, hashes));
+        break;
+    default:
+        SET_ERROR(RET_INVALID_PARAM);
+    }
+
+cleanup:
+    return ret;
+}
+
 Sha2Ctx *sha2_alloc(Sha2Variant variant)
 {
     int ret = RET_OK;
@@ -1090,6 +1820,54 @@ cleanup:
     return ret;
 }
 
+static int sha2_multi_self_test(void)
+{
+    //  Довжини охоплюють межі блоків доповнення, повідомлень більше, ніж доріжок
+    static const size_t LENS[] = { 0, 1, 3, 55, 56, 63, 64, 65, 111, 112, 119, 120, 127, 128, 129, 200, 255, 256, 300 };
+    static const HashAlg ALGS[] = { HASH_ALG_SHA224, HASH_ALG_SHA256, HASH_ALG_SHA384, HASH_ALG_SHA512 };
+    enum { CNT_MSGS = sizeof(LENS) / sizeof(LENS[0]) };
+
+    int ret = RET_OK;
+    uint8_t data[300 + CNT_MSGS];
+    ByteArray msgs[CNT_MSGS];
+    const ByteArray* refs[CNT_MSGS];
+    ByteArray* hashes[CNT_MSGS] = { NULL };
+    ByteArray* H = NULL;
+    size_t i, j;
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7 + 1);
+    }
+    for (i = 0; i < CNT_MSGS; i++) {
+        msgs[i].buf = data + i;
+        msgs[i].len = LENS[i];
+        refs[i] = &msgs[i];
+    }
+
+    for (j = 0; j < sizeof(ALGS) / sizeof(ALGS[0]); j++) {
+        DO(hash_multi(ALGS[j], refs, CNT_MSGS, hashes));
+        for (i = 0; i < CNT_MSGS; i++) {
+            DO(hash(ALGS[j], refs[i], &H));
+            if (ba_cmp(H, hashes[i]) != 0) {
+                SET_ERROR(RET_SELF_TEST_FAIL);
+            }
+            ba_free(H);
+            H = NULL;
+        }
+        for (i = 0; i < CNT_MSGS; i++) {
+            ba_free(hashes[i]);
+            hashes[i] = NULL;
+        }
+    }
+
+cleanup:
+    for (i = 0; i < CNT_MSGS; i++) {
+        ba_free(hashes[i]);
+    }
+    ba_free(H);
+    return ret;
+}
+
 int sha2_self_test(void)
 {
     int ret = RET_OK;
@@ -1098,6 +1876,7 @@ int sha2_self_test(void)
     DO(sha256_self_test());
     DO(sha384_self_test());
     DO(sha512_self_test());
+    DO(sha2_multi_self_test());
 
 cleanup:
     return ret;
@@ -93,7 +93,8 @@ cleanup:
     return ret;
 }
 
-static int sm2dsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* K, ByteArray** R, ByteArray** S)
+static int sm2dsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const WordArray* K, const ECPoint* kp,
+        ByteArray** R, ByteArray** S)
 {
     ByteArray* r = NULL;
     ByteArray* s = NULL;
@@ -125,12 +126,11 @@ static int sm2dsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const Word
     /* A4 */
     if (ctx->params->ec_field == EC_FIELD_PRIME) {
         CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ecp->len));
-        DO(ecp_dual_mul_opt(ctx->params->ecp, ctx->params->precomp_p, K, NULL, NULL, C));
     }
     else {
         CHECK_NOT_NULL(C = ec_point_alloc(ctx->params->ec2m->len));
-        DO(ec2m_dual_mul_opt(ctx->params->ec2m, ctx->params->precomp_p, K, NULL, NULL, C));
     }
+    DO(ec_sign_nonce_point(ctx, K, kp, C));
 
     CHECK_NOT_NULL(tmp = wa_alloc(q->len * 2));
     CHECK_NOT_NULL(wr = wa_alloc(q->len));
@@ -157,7 +157,7 @@ static int sm2dsa_sign_internal(const EcCtx* ctx, const ByteArray* H, const Word
     wa_zero(t);
     t->buf[0] = 1;
     int_add(ctx->priv_key, t, t);
-    CHECK_NOT_NULL(t_inv = gfp_mod_inv_core(t, q));
+    CHECK_NOT_NULL(t_inv = gfp_mod_inv_core_with_alloc(t, q));
     int_mul(wr, ctx->priv_key, tmp);
     int_div(tmp, q, NULL, ws);
     int_sub(q, ws, ws);
@@ -207,6 +207,7 @@ cleanup:
 int sm2dsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray** s)
 {
     WordArray* k = NULL;
+    ECPoint* kp = NULL;
     const WordArray* q;
     int ret = RET_OK;
 
@@ -225,13 +226,16 @@ int sm2dsa_sign(const EcCtx* ctx, const ByteArray* H, ByteArray** r, ByteArray**
 
     do {
         /* Шаг 2. Згенерувати випадкове число k (0 < k < q). */
-        DO(int_rand(q, k));
-        ret = sm2dsa_sign_internal(ctx, H, k, r, s);
+        DO(ec_sign_nonce(ctx, k, &kp));
+        ret = sm2dsa_sign_internal(ctx, H, k, kp, r, s);
+        ec_point_free_private(kp);
+        kp = NULL;
     } while (ret == -1);
 
 cleanup:
 
     wa_free_private(k);
+    ec_point_free_private(kp);
 
     return ret;
 }
@@ -486,7 +490,7 @@ static int sm2dsa_p_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(sm2dsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(sm2dsa_sign_internal(ec_ctx, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
@@ -568,7 +572,7 @@ static int sm2dsa_b_self_test(void)
     CHECK_NOT_NULL(wa_k = wa_alloc_from_be(test_k, sizeof(test_k)));
 
     DO(ec_init_sign(ec_ctx, &ba_d));
-    DO(sm2dsa_sign_internal(ec_ctx, ba_hash, wa_k, &ba_R, &ba_S));
+    DO(sm2dsa_sign_internal(ec_ctx, ba_hash, wa_k, NULL, &ba_R, &ba_S));
 
     if (ba_R->len != sizeof(test_R) ||
         ba_S->len != sizeof(test_S) ||
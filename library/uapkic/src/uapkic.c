@@ -28,6 +28,7 @@
 #define FILE_MARKER "uapkic/uapkic.c"
 
 #include "uapkic.h"
+#include "cpu-features-internal.h"
 #include "macros-internal.h"
 
 uint32_t uapkic_self_test(void)
@@ -95,6 +96,11 @@ int uapkic_init(uint32_t *version, uint32_t* self_test_status)
 		*version = UAPKIC_VERSION;
 	}
 
+	// Реалізації примітивів обираються до самотестування, щоб тестувались саме вони
+	if (initialized == 0) {
+		cpu_dispatch_init();
+	}
+
 	if (self_test_status) {
 		*self_test_status = uapkic_self_test();
 	}
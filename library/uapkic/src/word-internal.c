@@ -198,6 +198,44 @@ cleanup:
     return ret;
 }
 
+/*
+ * Завантажує число з байтів у WordArray без зміни його довжини.
+ * Старші байти, що не вміщуються в out, відкидаються, як у wa_change_len.
+ */
+void wa_from_le(const uint8_t *in, size_t in_len, WordArray *out)
+{
+    size_t i;
+    size_t len = out->len * WORD_BYTE_LENGTH;
+
+    ASSERT(in != NULL || in_len == 0);
+
+    memset(out->buf, 0, len);
+    if (in_len > len) {
+        in_len = len;
+    }
+    for (i = 0; i < in_len; i++) {
+        out->buf[i / WORD_BYTE_LENGTH] |= (word_t)in[i] << ((i % WORD_BYTE_LENGTH) << 3);
+    }
+}
+
+void wa_from_be(const uint8_t *in, size_t in_len, WordArray *out)
+{
+    size_t i;
+    size_t len = out->len * WORD_BYTE_LENGTH;
+
+    ASSERT(in != NULL || in_len == 0);
+
+    memset(out->buf, 0, len);
+    if (in_len > len) {
+        len = in_len - len;
+        in += len;
+        in_len -= len;
+    }
+    for (i = 0; i < in_len; i++) {
+        out->buf[i / WORD_BYTE_LENGTH] |= (word_t)in[in_len - 1 - i] << ((i % WORD_BYTE_LENGTH) << 3);
+    }
+}
+
 WordArray *wa_copy_with_alloc(const WordArray *in)
 {
     WordArray *wa = NULL;
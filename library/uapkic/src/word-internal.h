@@ -33,6 +33,7 @@
 #include <stdint.h>
 
 #include "byte-array-internal.h"
+#include "stacktrace.h"
 
 #ifdef  __cplusplus
 extern "C" {
@@ -88,6 +89,17 @@ typedef struct WordArray_st {
     size_t len;
 } WordArray;
 
+/*
+ * Оголошує тимчасовий WordArray *_name довжини _len у буфері на стеку з _max слів.
+ * Використовується для проміжних значень у гарячих циклах замість wa_alloc/wa_free.
+ * Аргументи, з яких обчислюється _len, мають бути перевірені до оголошення.
+ */
+#define WA_STACK(_name, _max, _len)                 \
+    ASSERT((size_t)(_len) <= (size_t)(_max));       \
+    word_t _name##_buf[_max];                       \
+    WordArray _name##_wa = { _name##_buf, (_len) }; \
+    WordArray *_name = &_name##_wa
+
 WordArray *wa_alloc(size_t len);
 WordArray *wa_alloc_with_zero(size_t len);
 WordArray *wa_alloc_with_one(size_t len);
@@ -97,6 +109,8 @@ WordArray *wa_alloc_from_ba(const ByteArray *in);
 WordArray *wa_alloc_from_le(const uint8_t *in, size_t in_len);
 WordArray *wa_alloc_from_be(const uint8_t *in, size_t in_len);
 int wa_from_ba(const ByteArray *ba, WordArray *wa);
+void wa_from_le(const uint8_t *in, size_t in_len, WordArray *out);
+void wa_from_be(const uint8_t *in, size_t in_len, WordArray *out);
 WordArray *wa_copy_with_alloc(const WordArray *in);
 int wa_copy(const WordArray *in, WordArray *out);
 int wa_copy_part(const WordArray *in, size_t off, size_t len, WordArray *out);
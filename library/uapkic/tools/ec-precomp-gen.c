@@ -0,0 +1,225 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Генератор вбудованих таблиць передобчислень базової точки стандартних кривих
+ * (src/math-ec-precomp-tables.h). Таблиці записуються у внутрішньому поданні
+ * (ПБ, форма Монтгомері) для розрядності слова платформи, на якій запущено генератор.
+ *
+ * Використання: uapkic-precomp-gen <файл>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ec-internal.h"
+#include "math-ecp-internal.h"
+#include "math-ec2m-internal.h"
+#include "macros-internal.h"
+
+#define PARAMS_NAME(_id) {_id, #_id}
+
+typedef struct {
+    EcParamsId id;
+    const char *name;
+} ParamsName;
+
+static const ParamsName params_names[] = {
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M163_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M167_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M173_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M179_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M191_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M233_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M257_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M307_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M367_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M431_PB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M173_ONB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M179_ONB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M191_ONB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M233_ONB),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M431_ONB),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_P192),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_P224),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_P256),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_P384),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_P521),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_B163),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_B233),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_B283),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_B409),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_B571),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_K163),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_K233),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_K283),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_K409),
+    PARAMS_NAME(EC_PARAMS_ID_NIST_K571),
+    PARAMS_NAME(EC_PARAMS_ID_SEC_P256_K1),
+    PARAMS_NAME(EC_PARAMS_ID_BRAINPOOL_P224_R1),
+    PARAMS_NAME(EC_PARAMS_ID_BRAINPOOL_P256_R1),
+    PARAMS_NAME(EC_PARAMS_ID_BRAINPOOL_P384_R1),
+    PARAMS_NAME(EC_PARAMS_ID_BRAINPOOL_P512_R1),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P256_A),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P256_B),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P256_C),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P512_A),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P512_B),
+    PARAMS_NAME(EC_PARAMS_ID_SM2_P256),
+    PARAMS_NAME(EC_PARAMS_ID_CN_P256),
+    PARAMS_NAME(EC_PARAMS_ID_CN_B257),
+    PARAMS_NAME(EC_PARAMS_ID_DSTU4145_M163_PB_TEST),
+    PARAMS_NAME(EC_PARAMS_ID_GOST_P256_TEST)
+};
+
+/* Вбудовуються таблиці для вікна EC_DEFAULT_WIN_WIDTH (типове передобчислення підпису) і гребеня ширини 5. */
+#define GEN_COMB_WIDTH 5
+
+static void print_words(FILE *out, const WordArray *wa)
+{
+    size_t i;
+
+    fprintf(out, "   ");
+    for (i = 0; i < wa->len; i++) {
+#ifdef ARCH64
+        fprintf(out, " 0x%016llx,", (unsigned long long)wa->buf[i]);
+#else
+        fprintf(out, " 0x%08lx,", (unsigned long)wa->buf[i]);
+#endif
+    }
+    fprintf(out, "\n");
+}
+
+static int print_table(FILE *out, const ParamsName *params, const char *suffix, ECPoint **points, size_t count)
+{
+    size_t i;
+    int ret = RET_OK;
+
+    //  Точки афінні, z-координата у всіх однакова і зберігається один раз
+    for (i = 1; i < count; i++) {
+        if (wa_cmp(points[i]->z, points[0]->z) != 0) {
+            fprintf(stderr, "%s_%s: z-coordinates differ\n", params->name, suffix);
+            SET_ERROR(RET_INVALID_CTX);
+        }
+    }
+
+    fprintf(out, "static const word_t %s_%s_XY[] = {\n", params->name, suffix);
+    for (i = 0; i < count; i++) {
+        print_words(out, points[i]->x);
+        print_words(out, points[i]->y);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const word_t %s_%s_Z[] = {\n", params->name, suffix);
+    print_words(out, points[0]->z);
+    fprintf(out, "};\n\n");
+
+cleanup:
+
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *out = NULL;
+    EcCtx *ctx = NULL;
+    EcPrecomp *win = NULL;
+    EcPrecomp *comb = NULL;
+    EcParamsCtx *params = NULL;
+    char suffix[16];
+    size_t i;
+    int ret = RET_OK;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <math-ec-precomp-tables.h>\n", argv[0]);
+        return 1;
+    }
+
+    out = fopen(argv[1], "w");
+    if (out == NULL) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(out, "/*\n * Таблиці передобчислень базових точок стандартних кривих.\n"
+            " * Файл згенеровано tools/ec-precomp-gen.c, не редагувати вручну.\n */\n\n");
+    fprintf(out, "#ifndef UAPKIC_MATH_EC_PRECOMP_TABLES_H\n#define UAPKIC_MATH_EC_PRECOMP_TABLES_H\n\n");
+    fprintf(out, "#if WORD_BIT_LENGTH == %d\n\n#define EC_PRECOMP_STATIC_TABLES\n\n", WORD_BIT_LENGTH);
+
+    for (i = 0; i < sizeof(params_names) / sizeof(params_names[0]); i++) {
+        CHECK_NOT_NULL(ctx = ec_alloc_new(params_names[i].id));
+        params = ctx->params;
+
+        if (params->ec_field == EC_FIELD_BINARY) {
+            DO(ec2m_calc_win_precomp(params->ec2m, params->p, EC_DEFAULT_WIN_WIDTH, &win));
+            DO(ec2m_calc_comb_precomp(params->ec2m, params->p, GEN_COMB_WIDTH, &comb));
+        } else {
+            DO(ecp_calc_win_precomp(params->ecp, params->p, EC_DEFAULT_WIN_WIDTH, &win));
+            DO(ecp_calc_comb_precomp(params->ecp, params->p, GEN_COMB_WIDTH, &comb));
+        }
+
+        sprintf(suffix, "WIN_%d", EC_DEFAULT_WIN_WIDTH);
+        DO(print_table(out, &params_names[i], suffix, win->ctx.win->precomp, (size_t)win->ctx.win->precomp_len));
+        sprintf(suffix, "COMB_%d", GEN_COMB_WIDTH);
+        DO(print_table(out, &params_names[i], suffix, comb->ctx.comb->precomp, ((size_t)1 << GEN_COMB_WIDTH) - 1));
+
+        ec_precomp_free(win);
+        win = NULL;
+        ec_precomp_free(comb);
+        comb = NULL;
+        ec_free(ctx);
+        ctx = NULL;
+    }
+
+    fprintf(out, "static const EcPrecompStatic EC_PRECOMP_STATIC[] = {\n");
+    for (i = 0; i < sizeof(params_names) / sizeof(params_names[0]); i++) {
+        CHECK_NOT_NULL(ctx = ec_alloc_new(params_names[i].id));
+        fprintf(out, "    {%s, EC_PRECOMP_TYPE_WIN, %d, %d, %d, %s_WIN_%d_XY, %s_WIN_%d_Z},\n",
+                params_names[i].name, EC_DEFAULT_WIN_WIDTH, (int)ctx->params->p->x->len, 1 << (EC_DEFAULT_WIN_WIDTH - 2),
+                params_names[i].name, EC_DEFAULT_WIN_WIDTH, params_names[i].name, EC_DEFAULT_WIN_WIDTH);
+        fprintf(out, "    {%s, EC_PRECOMP_TYPE_COMB, %d, %d, %d, %s_COMB_%d_XY, %s_COMB_%d_Z},\n",
+                params_names[i].name, GEN_COMB_WIDTH, (int)ctx->params->p->x->len, (1 << GEN_COMB_WIDTH) - 1,
+                params_names[i].name, GEN_COMB_WIDTH, params_names[i].name, GEN_COMB_WIDTH);
+        ec_free(ctx);
+        ctx = NULL;
+    }
+    fprintf(out, "};\n\n#endif\n\n#endif\n");
+
+cleanup:
+
+    ec_precomp_free(win);
+    ec_precomp_free(comb);
+    ec_free(ctx);
+    if (out != NULL) {
+        fclose(out);
+    }
+    if (ret != RET_OK) {
+        fprintf(stderr, "error %d\n", ret);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Вимірювання швидкодії GHASH і AES-GCM для всіх доступних реалізацій GHASH.
+ * GHASH вимірюється як AES-GCM лише з відкритими даними (auth_data), без шифрування.
+ *
+ * Використання: uapkic-ghash-bench [мінімальний час виміру, с]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "aes.h"
+#include "cpu-features.h"
+#include "macros-internal.h"
+
+static const size_t bench_sizes[] = { 64, 1024, 16384, 1048576 };
+
+static double bench_gcm(AesCtx *ctx, const ByteArray *key, const ByteArray *iv, const ByteArray *data,
+        int aad_only, double min_time)
+{
+    ByteArray *tag = NULL;
+    ByteArray *ct = NULL;
+    clock_t start = clock();
+    double elapsed;
+    size_t bytes = 0;
+
+    do {
+        if (aes_init_gcm(ctx, key, iv, 16) != RET_OK
+                || aes_encrypt_mac(ctx, aad_only ? data : NULL, aad_only ? NULL : data, &tag, &ct) != RET_OK) {
+            return 0;
+        }
+        ba_free(tag);
+        ba_free(ct);
+        tag = NULL;
+        ct = NULL;
+        bytes += ba_get_len(data);
+        elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    } while (elapsed < min_time);
+
+    return (double)bytes / elapsed / 1e6;
+}
+
+static int bench_all(double min_time)
+{
+    int ret = RET_OK;
+    AesCtx *ctx = NULL;
+    ByteArray *key = NULL;
+    ByteArray *iv = NULL;
+    ByteArray *data = NULL;
+    size_t i;
+
+    CHECK_NOT_NULL(ctx = aes_alloc());
+    CHECK_NOT_NULL(key = ba_alloc_by_len(32));
+    CHECK_NOT_NULL(iv = ba_alloc_by_len(12));
+    DO(ba_set(key, 0x5a));
+    DO(ba_set(iv, 0xa5));
+
+    printf("%-10s %12s %12s\n", "size", "GHASH, MB/s", "GCM, MB/s");
+    for (i = 0; i < sizeof(bench_sizes) / sizeof(bench_sizes[0]); i++) {
+        CHECK_NOT_NULL(data = ba_alloc_by_len(bench_sizes[i]));
+        DO(ba_set(data, 0x3c));
+        printf("%-10zu %12.1f %12.1f\n", bench_sizes[i],
+                bench_gcm(ctx, key, iv, data, 1, min_time),
+                bench_gcm(ctx, key, iv, data, 0, min_time));
+        ba_free(data);
+        data = NULL;
+    }
+
+cleanup:
+    aes_free(ctx);
+    ba_free(key);
+    ba_free(iv);
+    ba_free(data);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    double min_time = (argc > 1) ? atof(argv[1]) : 0.5;
+    int ret = RET_OK;
+
+    if (min_time <= 0) {
+        fprintf(stderr, "Використання: %s [мінімальний час виміру, с]\n", argv[0]);
+        return 1;
+    }
+
+    printf("ghash: %s, aes: %s\n", cpu_primitive_impl(CPU_PRIMITIVE_GHASH), cpu_primitive_impl(CPU_PRIMITIVE_AES));
+    DO(bench_all(min_time));
+
+    cpu_features_set_mask(0);
+    printf("\nghash: %s, aes: %s\n", cpu_primitive_impl(CPU_PRIMITIVE_GHASH), cpu_primitive_impl(CPU_PRIMITIVE_AES));
+    DO(bench_all(min_time));
+
+cleanup:
+    if (ret != RET_OK) {
+        fprintf(stderr, "Помилка: %d\n", ret);
+    }
+    return (ret == RET_OK) ? 0 : 1;
+}
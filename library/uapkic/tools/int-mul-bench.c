@@ -0,0 +1,162 @@
+/*
+ * Copyright 2021 The UAPKI Project Authors.
+ * 
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions are 
+ * met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright 
+ * notice, this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the 
+ * documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS 
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A 
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT 
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED 
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR 
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Пошук порогів методу Карацуби (INT_KARATSUBA_MUL_DEFAULT_THRESHOLD,
+ * INT_KARATSUBA_SQR_DEFAULT_THRESHOLD у src/math-int-internal.c).
+ * Для кожної довжини множників порівнюється метод Comba з одним рівнем методу Карацуби,
+ * половини якого множаться методом Comba.
+ * Поріг T обирається так, щоб сумарний відносний програш обраного методу (Comba для
+ * довжин < T, Карацуба для довжин >= T) був найменшим, що стійкіше до шуму окремих вимірів.
+ * Вимір слід виконувати на ненавантаженій системі.
+ *
+ * Використання: uapkic-int-mul-bench [мінімальний час виміру, с]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "math-int-internal.h"
+#include "macros-internal.h"
+
+#define BENCH_MIN_LEN   8
+#define BENCH_MAX_LEN   96
+#define BENCH_LEN_STEP  2
+/* Методи вимірюються по черзі кілька разів, береться найкращий час. */
+#define BENCH_ROUNDS    5
+
+static double bench_mul(const WordArray *a, const WordArray *b, WordArray *out, size_t threshold, double min_time)
+{
+    clock_t start = clock();
+    double elapsed;
+    size_t count = 0;
+    size_t i;
+
+    int_karatsuba_mul_threshold = threshold;
+    int_karatsuba_sqr_threshold = threshold;
+    do {
+        for (i = 0; i < 256; i++) {
+            if (a == b) {
+                int_sqr(a, out);
+            } else {
+                int_mul(a, b, out);
+            }
+        }
+        count += 256;
+        elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    } while (elapsed < min_time);
+
+    return elapsed / (double)count * 1e9;
+}
+
+static int bench_all(int sqr, double min_time)
+{
+    int ret = RET_OK;
+    WordArray *a = NULL;
+    WordArray *b = NULL;
+    WordArray *out = NULL;
+    size_t len, i;
+    size_t threshold;
+    int round;
+    double comba, karatsuba, t, cost, best_cost;
+    double gain[(BENCH_MAX_LEN - BENCH_MIN_LEN) / BENCH_LEN_STEP + 1];
+
+    printf("%-6s %14s %14s\n", "words", "Comba, ns", "Karatsuba, ns");
+    for (len = BENCH_MIN_LEN; len <= BENCH_MAX_LEN; len += BENCH_LEN_STEP) {
+        CHECK_NOT_NULL(a = wa_alloc(len));
+        CHECK_NOT_NULL(b = wa_alloc(len));
+        CHECK_NOT_NULL(out = wa_alloc(2 * len));
+        for (i = 0; i < len; i++) {
+            a->buf[i] = (word_t)(0x9E3779B97F4A7C15ULL * (i + 1));
+            b->buf[i] = (word_t)(0xC2B2AE3D27D4EB4FULL * (i + 1));
+        }
+
+        /* Поріг більший за довжину - лише Comba, рівний довжині - один рівень Карацуби. */
+        comba = karatsuba = 0;
+        for (round = 0; round < BENCH_ROUNDS; round++) {
+            t = bench_mul(a, sqr ? a : b, out, len + 1, min_time / BENCH_ROUNDS);
+            comba = (round == 0 || t < comba) ? t : comba;
+            t = bench_mul(a, sqr ? a : b, out, len, min_time / BENCH_ROUNDS);
+            karatsuba = (round == 0 || t < karatsuba) ? t : karatsuba;
+        }
+        printf("%-6zu %14.1f %14.1f\n", len, comba, karatsuba);
+        gain[(len - BENCH_MIN_LEN) / BENCH_LEN_STEP] = karatsuba / comba - 1.0;
+
+        wa_free(a);
+        wa_free(b);
+        wa_free(out);
+        a = NULL;
+        b = NULL;
+        out = NULL;
+    }
+
+    /* cost - сумарний відносний програш методу Карацуби для довжин >= len. */
+    threshold = BENCH_MAX_LEN + BENCH_LEN_STEP;
+    cost = best_cost = 0;
+    for (len = BENCH_MAX_LEN; len >= BENCH_MIN_LEN; len -= BENCH_LEN_STEP) {
+        cost += gain[(len - BENCH_MIN_LEN) / BENCH_LEN_STEP];
+        if (cost < best_cost) {
+            best_cost = cost;
+            threshold = len;
+        }
+    }
+
+    if (threshold <= BENCH_MAX_LEN) {
+        printf("%s: %zu\n", sqr ? "INT_KARATSUBA_SQR_THRESHOLD" : "INT_KARATSUBA_MUL_THRESHOLD", threshold);
+    } else {
+        printf("%s: > %d\n", sqr ? "INT_KARATSUBA_SQR_THRESHOLD" : "INT_KARATSUBA_MUL_THRESHOLD", BENCH_MAX_LEN);
+    }
+
+cleanup:
+    wa_free(a);
+    wa_free(b);
+    wa_free(out);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    double min_time = (argc > 1) ? atof(argv[1]) : 0.5;
+    int ret = RET_OK;
+
+    if (min_time <= 0) {
+        fprintf(stderr, "Використання: %s [мінімальний час виміру, с]\n", argv[0]);
+        return 1;
+    }
+
+    printf("int_mul, word: %d bits\n", WORD_BIT_LENGTH);
+    DO(bench_all(0, min_time));
+
+    printf("\nint_sqr, word: %d bits\n", WORD_BIT_LENGTH);
+    DO(bench_all(1, min_time));
+
+cleanup:
+    if (ret != RET_OK) {
+        fprintf(stderr, "Помилка: %d\n", ret);
+    }
+    return (ret == RET_OK) ? 0 : 1;
+}